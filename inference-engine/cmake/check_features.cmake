@@ -60,6 +60,11 @@ if (NOT ENABLE_MKL_DNN)
     set(ENABLE_MKL OFF)
 endif()
 
+# concurrent execution of the primitives is used by the TBB threading only
+if (NOT THREADING STREQUAL "TBB")
+    set(ENABLE_MKLDNN_CONCURRENT_EXEC OFF)
+endif()
+
 #next section set defines to be accesible in c++/c code for certain feature
 if (ENABLE_PROFILING_RAW)
     add_definitions(-DENABLE_PROFILING_RAW=1)
@@ -73,6 +78,10 @@ if (ENABLE_MKL_DNN)
     add_definitions(-DENABLE_MKL_DNN=1)
 endif()
 
+if (ENABLE_MKLDNN_CONCURRENT_EXEC)
+    add_definitions(-DMKLDNN_ENABLE_CONCURRENT_EXEC)
+endif()
+
 if (ENABLE_GNA)
     add_definitions(-DENABLE_GNA)
 endif()
@@ -19,6 +19,8 @@ ie_option (ENABLE_PROFILING_ITT "ITT tracing of IE and plugins internals" ON)
 
 ie_option (ENABLE_PROFILING_RAW "Raw counters profiling (just values, no start/stop time or timeline)" OFF)
 
+ie_option (ENABLE_MKLDNN_CONCURRENT_EXEC "MKL-DNN primitives own the scratchpads, so they can be executed concurrently" ON)
+
 # "MKL-DNN library might use MKL-ML or OpenBLAS for gemm tasks: MKL|OPENBLAS|JIT"
 if (NOT GEMM STREQUAL "MKL"
         AND NOT GEMM STREQUAL "OPENBLAS"
@@ -78,6 +80,8 @@ ie_option (COVERAGE "enable code coverage" OFF)
 
 ie_option (ENABLE_STRESS_UNIT_TESTS "stress unit tests" OFF)
 
+ie_option (ENABLE_SINGLE_LAYER_BENCHMARKS "single layer performance benchmarks" OFF)
+
 ie_option (VERBOSE_BUILD "shows extra information about build" OFF)
 
 ie_option (ENABLE_UNSAFE_LOCATIONS "skip check for MD5 for dependency" OFF)
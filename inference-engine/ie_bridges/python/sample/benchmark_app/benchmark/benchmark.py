@@ -15,7 +15,7 @@
 """
 
 from statistics import median
-from openvino.inference_engine import IENetwork, IEPlugin
+from openvino.inference_engine import IENetwork, IEPlugin, AsyncInferQueue
 
 from .utils.benchmark_utils import *
 
@@ -138,7 +138,7 @@ def main(args=None):
             print("[BENCHMARK RESULT] Latency is {:.4f} msec".format(latency * 1e3))
             print("[BENCHMARK RESULT] Throughput is {:.4f} FPS".format(fps))
         else:
-            infer_requests = exe_network.requests
+            infer_queue = AsyncInferQueue(exe_network)
 
             if args.number_iterations is not None:
                 logger.info("Start inference asynchronously ({}"
@@ -149,43 +149,29 @@ def main(args=None):
                 logger.info("Start inference asynchronously ({} s duration, "
                             "{} inference requests in parallel)".format(duration, args.number_infer_requests))
 
-            current_inference = 0
-            required_inference_requests_were_executed = False
-            previous_inference = 1 - args.number_infer_requests
-            step = 0
-            steps_count = args.number_infer_requests - 1
-            if args.number_iterations is not None:
-                steps_count += args.number_iterations
+            failed_requests = []
+
+            def completion_callback(request, status, userdata):
+                if status != 0:
+                    failed_requests.append(status)
 
             # warming up - out of scope
-            infer_requests[0].async_infer(input_images)
-            infer_requests[0].wait()
+            infer_queue.start_async(input_images)
+            infer_queue.wait_all()
+            infer_queue.set_callback(completion_callback)
 
+            step = 0
             start_time = datetime.now()
-            while not required_inference_requests_were_executed or step < steps_count or \
+            while args.number_iterations is not None and step < args.number_iterations or \
                     args.number_iterations is None and (datetime.now() - start_time).total_seconds() < duration:
-                exe_network.start_async(current_inference, input_images)
-
-                if previous_inference >= 0:
-                    status = infer_requests[previous_inference].wait()
-                    if status is not 0:
-                        raise Exception("Infer request not completed successfully")
-
-                current_inference += 1
-                if current_inference >= args.number_infer_requests:
-                    current_inference = 0
-                    required_inference_requests_were_executed = True
-
-                previous_inference += 1
-                if previous_inference >= args.number_infer_requests:
-                    previous_inference = 0
-
+                # blocks until one of the requests is idle
+                infer_queue.start_async(input_images)
                 step += 1
 
             # wait the latest inference executions
-            for not_completed_index in range(args.number_infer_requests):
-                if infer_requests[not_completed_index].wait(0) != 0:
-                    infer_requests[not_completed_index].wait()
+            infer_queue.wait_all()
+            if failed_requests:
+                raise Exception("Infer request not completed successfully")
 
             total_duration = (datetime.now() - start_time).total_seconds()
             fps = batch_size * step / total_duration
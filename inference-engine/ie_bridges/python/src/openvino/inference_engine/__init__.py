@@ -1,3 +1,3 @@
 from .ie_api import *
 __version__ = get_version()
-__all__ = ['IENetwork', "IEPlugin", "IENetReader"]
\ No newline at end of file
+__all__ = ['IENetwork', "IEPlugin", "IENetReader", "AsyncInferQueue"]
\ No newline at end of file
@@ -26,7 +26,7 @@ cdef class InferRequest:
     cpdef wait(self, timeout = ?)
     cpdef get_perf_counts(self)
     cdef public:
-        _inputs_list, _outputs_list
+        _inputs_list, _outputs_list, _py_callback, _py_data, _user_blobs
 
 cdef class IENetwork:
     cdef C.IENetwork impl
@@ -8,6 +8,7 @@ from libcpp.pair cimport pair
 from libcpp.map cimport map
 from libcpp.memory cimport unique_ptr
 from libc.stdint cimport int64_t
+from cpython.buffer cimport PyObject_GetBuffer, PyBuffer_Release, PyBUF_C_CONTIGUOUS, PyBUF_WRITABLE
 import os
 import numpy as np
 from copy import deepcopy
@@ -141,10 +142,10 @@ cdef class ExecutableNetwork:
         self.inputs = []
         self.outputs = []
 
-    def infer(self, inputs=None):
+    def infer(self, inputs=None, copy=False):
         current_request = self.requests[0]
         current_request.infer(inputs)
-        return deepcopy(current_request.outputs)
+        return current_request.get_outputs(copy)
 
     def start_async(self, request_id, inputs=None):
         if request_id not in list(range(len(self.requests))):
@@ -153,21 +154,81 @@ cdef class ExecutableNetwork:
         current_request.async_infer(inputs)
         return current_request
 
+    def get_idle_request_id(self, timeout=-1):
+        cdef int64_t c_timeout = timeout
+        cdef int request_id
+        with nogil:
+            request_id = deref(self.impl).getIdleRequestId(c_timeout)
+        return request_id
+
+    def _set_request_idle(self, int request_id):
+        deref(self.impl).setRequestIdle(request_id)
+
+    def wait_all(self):
+        with nogil:
+            deref(self.impl).waitAll()
+
     @property
     def requests(self):
-        requests = []
-        for i in range(deref(self.impl).infer_requests.size()):
-            infer_request = InferRequest()
-            infer_request.impl = &(deref(self.impl).infer_requests[i])
-            infer_request._inputs_list = self.inputs
-            infer_request._outputs_list = self.outputs
-            requests.append(infer_request)
-        return requests
+        # the requests are created once: the completion callbacks keep pointers to them
+        cdef InferRequest infer_request
+        if not self._requests:
+            for i in range(deref(self.impl).infer_requests.size()):
+                infer_request = InferRequest()
+                infer_request.impl = &(deref(self.impl).infer_requests[i])
+                infer_request._inputs_list = self.inputs
+                infer_request._outputs_list = self.outputs
+                self._requests.append(infer_request)
+        return self._requests
+
+class AsyncInferQueue:
+    """Starts the inputs on the idle requests of the executable network, waiting for them without the GIL"""
+
+    def __init__(self, exec_net: ExecutableNetwork, callback=None):
+        self._exec_net = exec_net
+        self._callback = callback
+        self._userdata = [None] * len(exec_net.requests)
+        for request_id, request in enumerate(exec_net.requests):
+            request.set_completion_callback(self._on_complete, request_id)
+
+    def __len__(self):
+        return len(self._exec_net.requests)
+
+    def __getitem__(self, request_id):
+        return self._exec_net.requests[request_id]
+
+    def set_callback(self, callback):
+        self._callback = callback
+
+    def start_async(self, inputs=None, userdata=None):
+        request_id = self._exec_net.get_idle_request_id()
+        self._userdata[request_id] = userdata
+        try:
+            self._exec_net.start_async(request_id, inputs)
+        except:
+            self._exec_net._set_request_idle(request_id)
+            raise
+        return request_id
+
+    def wait_all(self):
+        self._exec_net.wait_all()
+
+    def _on_complete(self, status, request_id):
+        if self._callback is not None:
+            self._callback(self._exec_net.requests[request_id], status, self._userdata[request_id])
+
+cdef void user_callback(void * py_request, int status) with gil:
+    cdef InferRequest request = <InferRequest> py_request
+    request._py_callback(status, request._py_data)
 
 cdef class InferRequest:
     def __init__(self):
         self._inputs_list = []
         self._outputs_list = []
+        self._py_callback = None
+        self._py_data = None
+        # the arrays of the caller the blobs of the request point to
+        self._user_blobs = {}
 
     cpdef BlobBuffer _get_blob_buffer(self, const string & blob_name):
         cdef BlobBuffer buffer = BlobBuffer()
@@ -180,18 +241,30 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        with nogil:
+            deref(self.impl).infer()
 
     cpdef async_infer(self, inputs=None):
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer_async()
+        with nogil:
+            deref(self.impl).infer_async()
 
     cpdef wait(self, timeout=None):
-        if timeout is None:
-            timeout = -1
-        return deref(self.impl).wait(<int64_t> timeout)
+        cdef int64_t c_timeout = -1 if timeout is None else timeout
+        cdef int status
+        with nogil:
+            status = deref(self.impl).wait(c_timeout)
+        return status
+
+    def set_completion_callback(self, py_callback, py_data=None):
+        if py_callback is None:
+            deref(self.impl).setCyCallback(NULL, NULL)
+        else:
+            deref(self.impl).setCyCallback(<C.InferRequestWrap.cy_callback> user_callback, <void *> self)
+        self._py_callback = py_callback
+        self._py_data = py_data
 
     cpdef get_perf_counts(self):
         cdef map[string, C.ProfileInfo] c_profile = deref(self.impl).getPerformanceCounts()
@@ -213,10 +286,26 @@ cdef class InferRequest:
 
     @property
     def outputs(self):
+        return self.get_outputs()
+
+    def get_outputs(self, copy=False):
         outputs = {}
         for output in self._outputs_list:
             outputs[output] = self._get_blob_buffer(output.encode()).to_numpy()
-        return deepcopy(outputs)
+        return deepcopy(outputs) if copy else outputs
+
+    def set_blob(self, blob_name: str, array: np.ndarray):
+        cdef Py_buffer view
+        expected = self._get_blob_buffer(blob_name.encode()).to_numpy()
+        if array.dtype != expected.dtype or array.shape != expected.shape or not array.flags.c_contiguous:
+            raise ValueError("Blob {} expects a C-contiguous array of type {} and shape {}, got {} of shape {}".format(
+                blob_name, expected.dtype, expected.shape, array.dtype, array.shape))
+        PyObject_GetBuffer(array, &view, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE)
+        try:
+            deref(self.impl).setBlobData(blob_name.encode(), view.buf, view.len)
+        finally:
+            PyBuffer_Release(&view)
+        self._user_blobs[blob_name] = array
 
     @property
     def latency(self):
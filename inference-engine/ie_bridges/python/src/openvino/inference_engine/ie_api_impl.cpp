@@ -318,7 +318,12 @@ void InferenceEnginePython::IEPlugin::setConfig(const std::map<std::string, std:
 }
 
 InferenceEnginePython::IEExecNetwork::IEExecNetwork(const std::string &name, size_t num_requests) :
-        infer_requests(num_requests), name(name) {
+        infer_requests(num_requests), name(name),
+        idle_requests(std::make_shared<IdleInferRequestQueue>(num_requests)) {
+    for (size_t i = 0; i < num_requests; ++i) {
+        infer_requests[i].index = static_cast<int>(i);
+        infer_requests[i].idle_requests = idle_requests;
+    }
 }
 
 void InferenceEnginePython::IEExecNetwork::infer() {
@@ -326,6 +331,57 @@ void InferenceEnginePython::IEExecNetwork::infer() {
     request.infer();
 }
 
+int InferenceEnginePython::IEExecNetwork::getIdleRequestId(int64_t timeout) {
+    return idle_requests->getIdleRequestId(timeout);
+}
+
+void InferenceEnginePython::IEExecNetwork::setRequestIdle(int index) {
+    idle_requests->setRequestIdle(index);
+}
+
+void InferenceEnginePython::IEExecNetwork::waitAll() {
+    idle_requests->waitAll();
+}
+
+InferenceEnginePython::IdleInferRequestQueue::IdleInferRequestQueue(size_t num_requests) : busy(num_requests, false) {
+    for (size_t i = 0; i < num_requests; ++i) {
+        idle_ids.push(static_cast<int>(i));
+    }
+}
+
+int InferenceEnginePython::IdleInferRequestQueue::getIdleRequestId(int64_t timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto has_idle = [this] { return !idle_ids.empty(); };
+    if (timeout < 0) {
+        cv.wait(lock, has_idle);
+    } else if (!cv.wait_for(lock, std::chrono::milliseconds(timeout), has_idle)) {
+        return -1;
+    }
+    int index = idle_ids.front();
+    idle_ids.pop();
+    busy[index] = true;
+    busy_count++;
+    return index;
+}
+
+void InferenceEnginePython::IdleInferRequestQueue::setRequestIdle(int index) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // the requests started bypassing the queue are not tracked
+        if (index < 0 || index >= busy.size() || !busy[index])
+            return;
+        busy[index] = false;
+        busy_count--;
+        idle_ids.push(index);
+    }
+    cv.notify_all();
+}
+
+void InferenceEnginePython::IdleInferRequestQueue::waitAll() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] { return busy_count == 0; });
+}
+
 
 void InferenceEnginePython::InferRequestWrap::getBlobPtr(const std::string &blob_name, InferenceEngine::Blob::Ptr &blob_ptr)
 {
@@ -333,22 +389,77 @@ void InferenceEnginePython::InferRequestWrap::getBlobPtr(const std::string &blob
     IE_CHECK_CALL(request_ptr->GetBlob(blob_name.c_str(), blob_ptr, &response));
 }
 
+template <typename T>
+InferenceEngine::Blob::Ptr wrap_user_data(const InferenceEngine::TensorDesc &desc, void *data) {
+    return InferenceEngine::make_shared_blob<T>(desc, static_cast<T *>(data));
+}
+
+void InferenceEnginePython::InferRequestWrap::setBlobData(const std::string &blob_name, void *data, size_t size) {
+    InferenceEngine::ResponseDesc response;
+    InferenceEngine::Blob::Ptr blob;
+    IE_CHECK_CALL(request_ptr->GetBlob(blob_name.c_str(), blob, &response));
+    if (blob->byteSize() != size) {
+        THROW_IE_EXCEPTION << "Blob " << blob_name << " takes " << blob->byteSize() << " bytes, but the data has "
+                           << size << " bytes";
+    }
+    // the blob reads and writes the memory of the caller, it is neither copied nor owned
+    const InferenceEngine::TensorDesc &desc = blob->getTensorDesc();
+    InferenceEngine::Blob::Ptr user_blob;
+    switch (desc.getPrecision()) {
+        case InferenceEngine::Precision::FP32:
+            user_blob = wrap_user_data<float>(desc, data);
+            break;
+        case InferenceEngine::Precision::FP16:
+        case InferenceEngine::Precision::Q78:
+        case InferenceEngine::Precision::I16:
+            user_blob = wrap_user_data<int16_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::U8:
+            user_blob = wrap_user_data<uint8_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::I8:
+            user_blob = wrap_user_data<int8_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::U16:
+            user_blob = wrap_user_data<uint16_t>(desc, data);
+            break;
+        case InferenceEngine::Precision::I32:
+            user_blob = wrap_user_data<int32_t>(desc, data);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported precision " << desc.getPrecision() << " of blob " << blob_name;
+    }
+    IE_CHECK_CALL(request_ptr->SetBlob(blob_name.c_str(), user_blob, &response));
+}
 
 void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
     InferenceEngine::ResponseDesc response;
     IE_CHECK_CALL(request_ptr->SetBatch(size, &response));
 }
 
+void InferenceEnginePython::InferRequestWrap::setCyCallback(cy_callback callback, void *data) {
+    user_callback = callback;
+    user_data = data;
+}
+
 void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code){
-    if (code != InferenceEngine::StatusCode::OK) {
-        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
-    }
     InferenceEnginePython::InferRequestWrap *requestWrap;
     InferenceEngine::ResponseDesc dsc;
     request->GetUserData(reinterpret_cast<void**>(&requestWrap), &dsc);
     auto end_time = Time::now();
     auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
     requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
+    // the python callback takes the GIL itself, the requests without it never touch the interpreter
+    if (requestWrap->user_callback) {
+        requestWrap->user_callback(requestWrap->user_data, static_cast<int>(code));
+    }
+    // the request is reused only after its callback has read the outputs
+    if (requestWrap->idle_requests) {
+        requestWrap->idle_requests->setRequestIdle(requestWrap->index);
+    }
+    if (code != InferenceEngine::StatusCode::OK) {
+        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
+    }
 }
 
 void InferenceEnginePython::InferRequestWrap::infer() {
@@ -366,7 +477,13 @@ void InferenceEnginePython::InferRequestWrap::infer_async() {
     start_time = Time::now();
     IE_CHECK_CALL(request_ptr->SetUserData(this, &response));
     request_ptr->SetCompletionCallback(latency_callback);
-    IE_CHECK_CALL(request_ptr->StartAsync(&response));
+    auto code = request_ptr->StartAsync(&response);
+    if (code != InferenceEngine::StatusCode::OK) {
+        if (idle_requests) {
+            idle_requests->setRequestIdle(index);
+        }
+        THROW_IE_EXCEPTION << response.msg;
+    }
 }
 
 int InferenceEnginePython::InferRequestWrap::wait(int64_t timeout) {
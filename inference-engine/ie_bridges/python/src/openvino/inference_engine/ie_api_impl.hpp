@@ -29,6 +29,10 @@
 
 #include <sstream>
 #include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <queue>
 #include "inference_engine.hpp"
 
 typedef std::chrono::high_resolution_clock Time;
@@ -114,10 +118,41 @@ struct IENetwork {
     IENetwork() = default;
 };
 
+/**
+ * The idle requests of an executable network: a request is taken out while it runs asynchronously and is put back
+ * after its completion callback, so the callers block on the condition variable instead of polling the requests
+ */
+class IdleInferRequestQueue {
+public:
+    explicit IdleInferRequestQueue(size_t num_requests);
+
+    // takes out the first idle request, returns -1 if none gets idle during the timeout (-1 to wait infinitely)
+    int getIdleRequestId(int64_t timeout);
+
+    void setRequestIdle(int index);
+
+    void waitAll();
+
+private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::queue<int> idle_ids;
+    std::vector<bool> busy;
+    size_t busy_count = 0;
+};
+
 struct InferRequestWrap {
+    // called on the completion of the async request with the status of the request
+    typedef void (*cy_callback)(void *user_data, int status);
+
     InferenceEngine::IInferRequest::Ptr request_ptr;
     Time::time_point start_time;
     double exec_time;
+    cy_callback user_callback = nullptr;
+    void *user_data = nullptr;
+    int index = 0;
+    std::shared_ptr<IdleInferRequestQueue> idle_requests;
+
     void infer();
 
     void infer_async();
@@ -126,8 +161,12 @@ struct InferRequestWrap {
 
     void getBlobPtr(const std::string &blob_name, InferenceEngine::Blob::Ptr &blob_ptr);
 
+    void setBlobData(const std::string &blob_name, void *data, size_t size);
+
     void setBatch(int size);
 
+    void setCyCallback(cy_callback callback, void *data);
+
     std::map<std::string, InferenceEnginePython::ProfileInfo> getPerformanceCounts();
 };
 
@@ -136,10 +175,17 @@ struct IEExecNetwork {
     InferenceEngine::IExecutableNetwork::Ptr actual;
     std::vector<InferRequestWrap> infer_requests;
     std::string name;
+    std::shared_ptr<IdleInferRequestQueue> idle_requests;
 
     IEExecNetwork(const std::string &name, size_t num_requests);
 
     void infer();
+
+    int getIdleRequestId(int64_t timeout);
+
+    void setRequestIdle(int index);
+
+    void waitAll();
 };
 
 
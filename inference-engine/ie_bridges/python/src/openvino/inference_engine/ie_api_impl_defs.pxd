@@ -69,6 +69,9 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
 
     cdef cppclass IEExecNetwork:
         vector[InferRequestWrap] infer_requests
+        int getIdleRequestId(int64_t timeout) nogil
+        void setRequestIdle(int index) nogil
+        void waitAll() nogil
 
     cdef cppclass IENetwork:
         IENetwork() except +
@@ -100,13 +103,16 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         string version
 
     cdef cppclass InferRequestWrap:
+        ctypedef void (*cy_callback) (void*, int)
         double exec_time;
         void getBlobPtr(const string &blob_name, Blob.Ptr &blob_ptr) except +
+        void setBlobData(const string &blob_name, void *data, size_t size) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
-        void infer_async() except +
-        int wait(int64_t timeout) except +
+        void infer() nogil except +
+        void infer_async() nogil except +
+        int wait(int64_t timeout) nogil except +
         void setBatch(int size) except +
+        void setCyCallback(cy_callback callback, void *data)
 
     cdef T*get_buffer[T](Blob &)
 
@@ -11,6 +11,7 @@
 #include <ie_context.hpp>
 #include <ie_common.h>
 #include <ie_blob.h>
+#include <unordered_map>
 #include <utility>
 #include <memory>
 #include <string>
@@ -234,6 +235,28 @@ public:
 
 private:
     std::map<std::string, Parameter> parameters;
+
+    /**
+     * @brief The positions of the layers by their ids, it is rebuilt when the layers are changed
+     */
+    mutable std::unordered_map<idx_t, size_t> layersIndex;
+    /**
+     * @brief The positions of the connections of every layer, valid for indexedConnections connections
+     */
+    mutable std::unordered_map<idx_t, std::vector<size_t>> connectionsIndex;
+    mutable size_t indexedConnections = 0;
+    /**
+     * @brief The ids below it are taken, the new layers without the id get the first free one from it
+     */
+    idx_t firstFreeId = 0;
+    /**
+     * @brief The network made by build() was validated as a whole, so its layers are not validated on every access
+     */
+    bool validated = false;
+
+    Layer::Ptr findLayer(idx_t layerId) const;
+    void indexLayers() const;
+    void indexConnections() const;
 };
 
 /**
@@ -56,5 +56,67 @@ DECLARE_CLDNN_CONFIG_KEY(GRAPH_DUMPS_DIR);
 */
 DECLARE_CLDNN_CONFIG_KEY(SOURCES_DUMPS_DIR);
 
+/**
+* @brief This key defines the directory where the binaries of the built OpenCL programs are cached.
+* The programs found in the cache for the same sources, build options, device and driver are not compiled again
+* on the next network loading. Empty by default (means no caching).
+*/
+DECLARE_CLDNN_CONFIG_KEY(KERNELS_CACHE_DIR);
+
+/**
+* @brief This key defines the number of host threads which build the OpenCL programs concurrently.
+* This option should be used with an unsigned integer value, 0 (the default) means the number of hardware threads.
+*/
+DECLARE_CLDNN_CONFIG_KEY(KERNELS_BUILD_THREADS);
+
+/**
+* @brief Optimize GPU execution to maximize throughput.
+* This option should be used with a positive integer value (1 by default) which is the number of streams. Every stream
+* executes its own copy of the network on a separate command queue, so the infer requests of different streams run
+* concurrently. The requests are bound to the streams round-robin. Not supported with the dynamic batch.
+*/
+DECLARE_CLDNN_CONFIG_KEY(THROUGHPUT_STREAMS);
+
+/**
+* @brief This key makes the 3 channel image inputs take the NV12 frames as the video decoders produce them.
+* This option should be used with the "<width>x<height>" value of the even frame size. The input blobs are U8 NCHW of
+* the dims {N, 1, height * 3 / 2, width}, the Y plane followed by the interleaved UV plane. The frames are converted to
+* BGR and resized to the network input size on the GPU.
+*/
+DECLARE_CLDNN_CONFIG_KEY(NV12_INPUT_SIZE);
+
+/**
+* @brief This key makes the DetectionOutput layers run on the GPU, so the network is executed without reading the
+* intermediate results back to the host. The layers the GPU kernels do not support run on the host.
+* This option should be used with YES or NO values, turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(DETECTION_OUTPUT_GPU);
+/**
+* @brief This key makes the FP32 networks run in FP16 except the layers of the types set by the FP32_LAYERS key.
+* The weights are converted when the network is loaded and the data is reordered between the FP16 and FP32 layers,
+* the inputs and the outputs keep their precisions. This option should be used with YES or NO values, turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(FP16_AUTO);
+/**
+* @brief This key defines the comma separated types of the layers which stay in FP32 when FP16_AUTO is enabled.
+* By default they are the layers sensitive to the precision loss:
+* "SoftMax,MVN,Normalize,ArgMax,Gather,ReverseSequence,PriorBox,DetectionOutput,Proposal,SimplerNMS,RegionYolo".
+*/
+DECLARE_CLDNN_CONFIG_KEY(FP32_LAYERS);
+/**
+* @brief This key makes the loading of the network execute every network of its streams once on zero inputs, so the
+* lazy allocations, the finalization of the kernel binaries in the driver and the one time kernels are done before the
+* first inference and it runs with the steady state latency. The loading takes one inference longer.
+* This option should be used with YES or NO values, turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(WARM_UP);
+/**
+* @brief The value of PluginConfigParams::KEY_DEVICE_ID which loads the network on all the GPUs.
+* The clDNN plugin also takes the comma separated device ids, like "0,1". Every device gets its own copy of the
+* network with THROUGHPUT_STREAMS streams and the infer requests are bound to the streams of all the devices
+* round-robin. Not supported with the dynamic batch.
+*/
+DECLARE_CLDNN_CONFIG_VALUE(ALL_DEVICES);
+
 }  // namespace CLDNNConfigParams
 }  // namespace InferenceEngine
@@ -229,6 +229,7 @@ public:
 
     /**
      * @brief Serialize network to IR and weights files.
+     * A path with the .cir extension and no binPath writes a single compact IR file with the weights.
      * @param xmlPath Path to output IR file.
      * @param binPath Path to output weights file. The parameter is skipped in case
      * of executable graph info serialization.
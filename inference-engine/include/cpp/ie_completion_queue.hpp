@@ -0,0 +1,131 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides the queue of the completed asynchronous infer requests
+ * @file ie_completion_queue.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "cpp/ie_infer_request.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Collects the completions of many asynchronous infer requests, so a single thread can wait for any or for
+ * all of them instead of waiting for the requests one by one
+ * @note The completion callbacks of the added requests are replaced. The queue must outlive the inference of the
+ * requests, its destructor waits for the started ones
+ */
+class CompletionQueue {
+public:
+    /**
+     * @brief The id of a request in the queue and the status of its inference
+     */
+    using Completion = std::pair<size_t, StatusCode>;
+
+    CompletionQueue() = default;
+
+    CompletionQueue(const CompletionQueue &) = delete;
+
+    CompletionQueue &operator=(const CompletionQueue &) = delete;
+
+    ~CompletionQueue() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [this] { return _running == 0; });
+    }
+
+    /**
+     * @brief Adds the request to the queue
+     * @return the id of the request
+     */
+    size_t add(InferRequest request) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        size_t id = _requests.size();
+        request.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [this, id](InferRequest, StatusCode status) {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _completed.emplace_back(id, status);
+                    _running--;
+                    _cond.notify_all();
+                });
+        _requests.push_back(request);
+        return id;
+    }
+
+    /**
+     * @brief Returns the request with the given id
+     */
+    InferRequest &get(size_t id) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _requests.at(id);
+    }
+
+    /**
+     * @brief Starts the inference of the request with the given id
+     */
+    void startAsync(size_t id) {
+        InferRequest request;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            request = _requests.at(id);
+            _running++;
+        }
+        try {
+            request.StartAsync();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _running--;
+            throw;
+        }
+    }
+
+    /**
+     * @brief Waits for the completion of any started request. The completions are returned in the order they happened
+     * @param completion the id and the status of the completed request
+     * @param millis_timeout the timeout in milliseconds, IInferRequest::WaitMode::RESULT_READY waits infinitely
+     * @return false if no request was completed in the given time or no request is running
+     */
+    bool waitAny(Completion &completion, int64_t millis_timeout = IInferRequest::WaitMode::RESULT_READY) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto isReady = [this] { return !_completed.empty() || _running == 0; };
+        if (millis_timeout == IInferRequest::WaitMode::RESULT_READY) {
+            _cond.wait(lock, isReady);
+        } else {
+            _cond.wait_for(lock, std::chrono::milliseconds(millis_timeout), isReady);
+        }
+        if (_completed.empty()) return false;
+        completion = _completed.front();
+        _completed.pop_front();
+        return true;
+    }
+
+    /**
+     * @brief Waits for the completion of all the started requests
+     * @return the completions not returned by waitAny yet, in the order they happened
+     */
+    std::vector<Completion> waitAll() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [this] { return _running == 0; });
+        std::vector<Completion> completed(_completed.begin(), _completed.end());
+        _completed.clear();
+        return completed;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    std::vector<InferRequest> _requests;
+    std::deque<Completion> _completed;
+    size_t _running = 0;
+};
+
+}  // namespace InferenceEngine
@@ -118,6 +118,16 @@ public:
         return CNNNetwork(ptr);
     }
 
+    /**
+     * @brief Wraps original method IExecutableNetwork::GetMetrics
+     * @return Map of the metrics names to the counters and the latency histograms
+     */
+    std::map<std::string, InferenceEngineMetricInfo> GetMetrics() {
+        std::map<std::string, InferenceEngineMetricInfo> metrics;
+        CALL_STATUS_FNC(GetMetrics, metrics);
+        return metrics;
+    }
+
     /**
      *@brief see original function InferenceEngine::IExecutableNetwork::QueryState
      */
@@ -11,6 +11,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include "ie_iinfer_request.hpp"
 #include "details/ie_exception_conversion.hpp"
 
@@ -79,6 +80,14 @@ public:
         CALL_STATUS_FNC(SetBlob, name.c_str(), data);
     }
 
+    /**
+     * @brief Wraps original method
+     * IInferRequest::SetRoiBlobs
+     */
+    void SetRoiBlobs(const std::string &name, const Blob::Ptr &frame, const std::vector<ROI> &rois) {
+        CALL_STATUS_FNC(SetRoiBlobs, name.c_str(), frame, rois);
+    }
+
     /**
      * @brief Wraps original method
      * IInferRequest::GetBlob
@@ -143,6 +152,15 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+    * @brief Sets the scheduling priority and the deadline of the following asynchronous inference calls.
+    * @param priority the priority of the request, the higher the sooner, 0 by default
+    * @param millis_deadline the deadline in milliseconds from the start of an inference, 0 for no deadline
+    */
+    void SetPriority(const int priority, const int64_t millis_deadline = 0) {
+        CALL_STATUS_FNC(SetPriority, priority, millis_deadline);
+    }
+
     /**
      * constructs InferRequest from initialised shared_pointer
      * @param actual
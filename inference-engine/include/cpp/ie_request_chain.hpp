@@ -0,0 +1,148 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides the chain of the asynchronous infer requests of a multi-model pipeline
+ * @file ie_request_chain.hpp
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "cpp/ie_infer_request.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Runs the infer requests of several executable networks one after another: a request is started from the
+ * completion callback of the previous one, so the application waits only for the last one.
+ * The outputs of a request are bound to the inputs of the next ones by sharing the output blob, the data is not
+ * copied on the host. The GPU plugin maps such a blob into the next network on the devices with the host unified
+ * memory instead of uploading it, the CPU plugin reads it in place when the layout matches.
+ * @note The completion callbacks of the added requests are replaced. The chain must outlive the inference of the
+ * requests, its destructor waits for the started ones
+ */
+class RequestChain {
+public:
+    RequestChain() = default;
+
+    RequestChain(const RequestChain &) = delete;
+
+    RequestChain &operator=(const RequestChain &) = delete;
+
+    ~RequestChain() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock, [this] { return !_running; });
+    }
+
+    /**
+     * @brief Appends the request to the chain
+     * @return the index of the request in the chain
+     */
+    size_t add(InferRequest request) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_running) THROW_IE_EXCEPTION << "Cannot add a request to the running chain";
+        size_t index = _requests.size();
+        request.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [this, index](InferRequest, StatusCode status) {
+                    onCompletion(index, status);
+                });
+        _requests.push_back(request);
+        return index;
+    }
+
+    /**
+     * @brief Returns the request with the given index
+     */
+    InferRequest &get(size_t index) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _requests.at(index);
+    }
+
+    /**
+     * @brief Makes the output of the producer request the input of the consumer request
+     * @param producer the index of the producer, it precedes the consumer in the chain
+     * @param output the name of the output of the producer
+     * @param consumer the index of the consumer
+     * @param input the name of the input of the consumer
+     */
+    void bind(size_t producer, const std::string &output, size_t consumer, const std::string &input) {
+        if (producer >= consumer) THROW_IE_EXCEPTION << "The producer of " << input << " must precede its consumer";
+        get(consumer).SetBlob(input, get(producer).GetBlob(output));
+    }
+
+    /**
+     * @brief Starts the first request, the others are started when the previous ones complete
+     */
+    void startAsync() {
+        InferRequest first;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_requests.empty()) THROW_IE_EXCEPTION << "The chain has no requests";
+            if (_running) THROW_IE_EXCEPTION << "The chain is already running";
+            first = _requests.front();
+            _running = true;
+            _status = INFER_NOT_STARTED;
+        }
+        try {
+            first.StartAsync();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _running = false;
+            _cond.notify_all();
+            throw;
+        }
+    }
+
+    /**
+     * @brief Waits for the completion of the chain
+     * @param millis_timeout the timeout in milliseconds, IInferRequest::WaitMode::RESULT_READY waits infinitely
+     * @return OK if all the requests completed successfully, the status of the failed request,
+     * RESULT_NOT_READY if the chain is still running or INFER_NOT_STARTED if it was never started
+     */
+    StatusCode wait(int64_t millis_timeout = IInferRequest::WaitMode::RESULT_READY) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto isReady = [this] { return !_running; };
+        if (millis_timeout == IInferRequest::WaitMode::RESULT_READY) {
+            _cond.wait(lock, isReady);
+        } else {
+            _cond.wait_for(lock, std::chrono::milliseconds(millis_timeout), isReady);
+        }
+        return _running ? RESULT_NOT_READY : _status;
+    }
+
+private:
+    void onCompletion(size_t index, StatusCode status) {
+        InferRequest next;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (status == OK && index + 1 < _requests.size())
+                next = _requests[index + 1];
+        }
+        if (next) {
+            try {
+                next.StartAsync();
+                return;
+            } catch (const details::InferenceEngineException &) {
+                status = GENERAL_ERROR;
+            }
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        _status = status;
+        _running = false;
+        _cond.notify_all();
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    std::vector<InferRequest> _requests;
+    StatusCode _status = INFER_NOT_STARTED;
+    bool _running = false;
+};
+
+}  // namespace InferenceEngine
@@ -68,12 +68,30 @@ DECLARE_GNA_CONFIG_KEY(COMPACT_MODE);
 */
 DECLARE_GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN);
 
+/**
+* @brief The maximal error of the optimized PWL approximation of activation functions, in percent of the function range.
+* Default value is 1.0. The bigger error budget gives less PWL segments and so less GNA cycles per activation.
+* The value can be overridden for a particular activation layer by its "pwl_max_error_percent" parameter
+*/
+DECLARE_GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT);
+
+/**
+* @brief if enabled, the batch of the network is treated as up to 8 independent streams that are inferred in one
+* GNA pass, default value is NO. Memory layers keep the state of every stream separately, and QueryState returns
+* the state per stream, in order of the streams in the batch
+*/
+DECLARE_GNA_CONFIG_KEY(MULTI_STREAM);
+
 /**
 * @brief By default, the GNA plugin uses one worker thread for inference computations.
 * This parameter allows you to create up to 127 threads for software modes.
 *
 * Note that multithreading mode does not guarantee the same computation order as order
 * of issuing. Additionally, in this case, software modes do not implement any serializations.
+*
+* Every thread also gets a request slot with its own input, output and memory layers buffers. The infer requests
+* of a network with memory layers are bound to the slots in the order of their creation, so every request keeps
+* its own state as long as there are no more requests than threads.
 */
 DECLARE_GNA_CONFIG_KEY(LIB_N_THREADS);
 }  // namespace GNAConfigParams
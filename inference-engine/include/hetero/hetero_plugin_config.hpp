@@ -30,5 +30,13 @@ namespace HeteroConfigParams {
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 DECLARE_HETERO_CONFIG_KEY(DUMP_DLA_MESSAGES);
 
+/**
+ * @brief The key for the minimal number of layers in a subgraph produced by the default fallback policy.
+ * Smaller subgraphs are merged into a neighbouring device that supports all their layers.
+ * Subgraphs which transfer more data through their boundaries than they compute are merged regardless of this value.
+ * This option should be used with a positive integer value, the default value is 1
+ */
+DECLARE_HETERO_CONFIG_KEY(MIN_SUBGRAPH_SIZE);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -62,4 +62,22 @@ public:
  */
 INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateDefaultAllocator() noexcept;
 
+/**
+ * @brief Creates the built-in allocator of the given kind
+ * @param kind One of the PluginConfigParams::KEY_BLOB_ALLOCATOR values
+ * @return The Inference Engine IAllocator* instance or nullptr for the unknown kind
+ */
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateAllocator(const char *kind) noexcept;
+
+/**
+ * @brief Creates the allocator of a named shared memory region, the blobs allocated by the allocators of the same
+ * name in different processes share their data. The first allocator of the name creates the region and removes it
+ * when its blob is released. One blob can be allocated by the allocator at a time.
+ * The plugins read and write such blobs in place like any other blob set to the infer request, the CPU plugin binds
+ * them to the layers when their layout is the one of the network.
+ * @param name The name of the region, one POSIX shared memory object or Windows file mapping
+ * @return The Inference Engine IAllocator* instance or nullptr if the name is empty
+ */
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateSharedMemoryAllocator(const char *name) noexcept;
+
 }  // namespace InferenceEngine
@@ -0,0 +1,31 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides the executable network which batches the single inference requests
+ * @file ie_auto_batch.hpp
+ */
+#pragma once
+
+#include <cstdint>
+#include "ie_api.h"
+#include "cpp/ie_executable_network.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Creates an executable network which collects the asynchronous requests of batch 1 and infers them as one
+ * batch of the given network. The batch is started when maxBatch requests are collected or when timeoutUSec passed
+ * since the first of them. The outputs are scattered back to the requests and their completion callbacks are called.
+ * @note The network should be loaded with the batch not less than maxBatch. If it's loaded with
+ * PluginConfigParams::KEY_DYN_BATCH_ENABLED, only the collected requests are inferred, otherwise the whole batch is
+ * @param network the network loaded with the maximal batch
+ * @param maxBatch the maximal number of the requests in a batch, 0 means the batch of the network
+ * @param timeoutUSec the time to wait for more requests after the first one, in microseconds
+ * @return the executable network that creates the requests of batch 1
+ */
+INFERENCE_ENGINE_API_CPP(ExecutableNetwork) CreateAutoBatchExecutableNetwork(ExecutableNetwork network,
+                                                                             size_t maxBatch, int64_t timeoutUSec);
+
+}  // namespace InferenceEngine
@@ -167,6 +167,37 @@ struct InferenceEngineProfileInfo {
     unsigned execution_index;
 };
 
+/**
+ * @struct InferenceEngineMetricInfo
+ * @brief Represents a request counter or a latency histogram collected by an executable network.
+ * The metrics are gathered for every inference, so they cover the whole lifetime of the executable network.
+ */
+struct InferenceEngineMetricInfo {
+    /**
+     * @brief Defines the kind of the metric
+     */
+    enum MetricType {
+        COUNTER,
+        HISTOGRAM
+    };
+
+    MetricType type = COUNTER;
+    /**
+     * @brief The value of the counter or the number of the samples of the histogram
+     */
+    unsigned long long count = 0;
+    /**
+     * @brief The sum of the histogram samples in microseconds
+     */
+    unsigned long long sum_uSec = 0;
+    /**
+     * @brief The number of the histogram samples per bucket: the bucket 0 holds the samples below 1 microsecond,
+     * the bucket i holds the samples of [2^(i-1), 2^i) microseconds and the last one all the longer samples.
+     * Empty for the counters.
+     */
+    std::vector<unsigned long long> buckets;
+};
+
 
 /**
  * @enum StatusCode
@@ -31,6 +31,7 @@ enum class TargetDevice : uint8_t {
     eGNA = 7,
     eHETERO = 8,
     eKMB = 9,
+    eMULTI = 10,
 };
 
 /**
@@ -55,7 +56,8 @@ class TargetDeviceInfo {
             DECL_DEVICE(HDDL),
             DECL_DEVICE(GNA),
             DECL_DEVICE(HETERO),
-            DECL_DEVICE(KMB)
+            DECL_DEVICE(KMB),
+            DECL_DEVICE(MULTI)
         };
 #undef DECLARE
         return g_allDeviceInfos;
@@ -72,7 +74,8 @@ class TargetDeviceInfo {
             { "GNA", InferenceEngine::TargetDevice::eGNA },
             { "BALANCED", InferenceEngine::TargetDevice::eBalanced },
             { "HETERO", InferenceEngine::TargetDevice::eHETERO },
-            { "KMB", InferenceEngine::TargetDevice::eKMB }
+            { "KMB", InferenceEngine::TargetDevice::eKMB },
+            { "MULTI", InferenceEngine::TargetDevice::eMULTI }
         };
         auto val = deviceFromNameMap.find(deviceName);
         return val != deviceFromNameMap.end() ? val->second : InferenceEngine::TargetDevice::eDefault;
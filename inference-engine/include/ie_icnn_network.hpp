@@ -185,6 +185,8 @@ public:
 
     /**
      * @brief Serialize network to IR and weights files.
+     * If xmlPath has the .cir extension and binPath is empty, the network is written to a single compact IR file
+     * with the weights, which is read by CNNNetReader without XML parsing.
      * @param xmlPath Path to output IR file.
      * @param binPath Path to output weights file.
      * @return Status code of the operation
@@ -97,6 +97,18 @@ public:
      * @return Status code of the operation: OK (0) for success, OUT_OF_BOUNDS (-6) no memory state for given index
      */
     virtual StatusCode  QueryState(IMemoryState::Ptr & pState, size_t  idx, ResponseDesc *resp) noexcept = 0;
+
+    /**
+     * @brief Gets the metrics collected by the infer requests of the executable network: the counters of the
+     * requests and the latency histograms of the queue wait, preprocessing, inference and callback stages, both
+     * total and per stream (the names with the ".stream<N>" suffix, reported when the network has several streams).
+     * The metrics are scraped without blocking the running requests.
+     * @param metrics Map of the metrics names to the values
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success
+     */
+    virtual StatusCode GetMetrics(std::map<std::string, InferenceEngineMetricInfo> &metrics,
+                                  ResponseDesc *resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
@@ -14,6 +14,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include <details/ie_irelease.hpp>
 
 namespace InferenceEngine {
@@ -47,6 +48,20 @@ public:
      */
     virtual StatusCode SetBlob(const char *name, const Blob::Ptr &data, ResponseDesc *resp) noexcept = 0;
 
+    /**
+     * @brief Sets ROIs of one frame to be resized and placed to the consecutive batches of the input
+     * @note: Memory allocation does not happen, the ROIs share the memory of the frame
+     * @param name Name of input blob.
+     * @param frame Reference to the frame blob with the batch size 1. The precision and the number of channels must
+     * match the network input, a resize algorithm must be set for the input.
+     * @param rois ROIs inside of the frame, the ROI i is placed to the batch i. The number of ROIs must not exceed the
+     * network batch size.
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: OK (0) for success
+     */
+    virtual StatusCode SetRoiBlobs(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois,
+                                   ResponseDesc *resp) noexcept = 0;
+
     /**
      * @brief Gets input/output data for inference
      * @note: Memory allocation does not happen
@@ -132,6 +147,17 @@ public:
     * @return Enumeration of the resulted action: OK (0) for success
     */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc *resp) noexcept = 0;
+
+    /**
+    * @brief Sets the scheduling priority and the deadline of the following asynchronous inference calls.
+    * A started request waiting in the device queue goes ahead of the waiting requests with a lower priority, and
+    * it is completed with an error instead of being inferred if its deadline expires before the inference starts.
+    * @param priority the priority of the request, the higher the sooner, 0 by default
+    * @param millis_deadline the deadline in milliseconds from the start of an inference, 0 for no deadline
+    * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if occurred)
+    * @return Enumeration of the resulted action: OK (0) for success, NOT_IMPLEMENTED if the plugin doesn't queue the requests
+    */
+    virtual InferenceEngine::StatusCode SetPriority(int priority, int64_t millis_deadline, ResponseDesc *resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
@@ -1290,6 +1290,10 @@ using RNNCell  = RNNCellBase;
  *   [N,T,D]  Xt - input data
  *   [ND,N,S] Ht-1 - initial hidden state
  *   [ND,N,S] Ct-1 - initial cell state  // if NS==2
+ *   [N]      seq_lengths - the lengths of the sequences  // optional, follows the initial states
+ *
+ * The steps beyond the length of a sequence are not computed, their outputs are zeros and the output states
+ * are the states of the last step of the sequence.
  *
  * Outputs:
  *   [ND,N,T,S] Xt - input data
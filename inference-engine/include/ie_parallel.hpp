@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+
 #define IE_THREAD_TBB 0
 #define IE_THREAD_OMP 1
 #define IE_THREAD_SEQ 2
@@ -276,6 +279,59 @@ inline void splitter(T n, Q team, Q tid, T &n_start, T &n_end) {
     n_end += n_start;
 }
 
+/**
+ * @brief Options of the parallel_for* loops
+ */
+struct parallel_options {
+    /**
+     * @brief The least number of the iterations per thread, the loops shorter than two grains run serially
+     */
+    size_t grain = 1;
+    /**
+     * @brief The iterations are split over the threads in the same way on every call, so the threads revisit their
+     * data in the caches (the static partitioner of TBB, the OpenMP loops are always split so)
+     */
+    bool affinity = false;
+};
+
+/**
+ * @brief Runs func(ithr, nthr) on the threads worth to split the work amount into: each thread gets at least the grain
+ * of it, and the loops nested into an OpenMP parallel region run on their thread. The tiny loops are run by the
+ * calling thread without the fork-join.
+ */
+template <typename F>
+void parallel_split(size_t work_amount, const parallel_options &options, F func) {
+#if IE_THREAD == IE_THREAD_SEQ
+    const bool serial = true;
+#elif IE_THREAD == IE_THREAD_OMP
+    // the nested region would be a team of one thread, but costs the fork-join anyway
+    const bool serial = omp_in_parallel() != 0;
+#else
+    const bool serial = false;
+#endif
+    const size_t grain = options.grain > 0 ? options.grain : 1;
+    const size_t max_threads = static_cast<size_t>(parallel_get_max_threads());
+    const int nthr = serial ? 1 : static_cast<int>(std::min(max_threads, work_amount / grain));
+    if (nthr <= 1) {
+        func(0, 1);
+        return;
+    }
+#if IE_THREAD == IE_THREAD_TBB
+    if (options.affinity) {
+        tbb::parallel_for(0, nthr, [&](int ithr) {
+            func(ithr, nthr);
+        }, tbb::static_partitioner{});
+    } else {
+        tbb::parallel_for(0, nthr, [&](int ithr) {
+            func(ithr, nthr);
+        });
+    }
+#elif IE_THREAD == IE_THREAD_OMP
+#   pragma omp parallel num_threads(nthr)
+    func(parallel_get_thread_num(), parallel_get_num_threads());
+#endif
+}
+
 
 template <typename T0, typename F>
 void for_1d(const int ithr, const int nthr, const T0 &D0, F func) {
@@ -285,18 +341,15 @@ void for_1d(const int ithr, const int nthr, const T0 &D0, F func) {
 }
 
 template <typename T0, typename F>
-void parallel_for(const T0 &D0, F func) {
-#if IE_THREAD == IE_THREAD_TBB
-    const int nthr = parallel_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+void parallel_for(const parallel_options &options, const T0 &D0, F func) {
+    parallel_split((size_t)D0, options, [&](int ithr, int nthr) {
         for_1d(ithr, nthr, D0, func);
     });
-#elif IE_THREAD == IE_THREAD_OMP
-    #   pragma omp parallel
-    for_1d(parallel_get_thread_num(), parallel_get_num_threads(), D0, func);
-#elif IE_THREAD == IE_THREAD_SEQ
-    for_1d(0, 1, D0, func);
-#endif
+}
+
+template <typename T0, typename F>
+void parallel_for(const T0 &D0, F func) {
+    parallel_for(parallel_options(), D0, func);
 }
 
 
@@ -316,18 +369,15 @@ void for_2d(const int ithr, const int nthr, const T0 &D0, const T1 &D1, F func)
 }
 
 template <typename T0, typename T1, typename F>
-void parallel_for2d(const T0 &D0, const T1 &D1, F func) {
-#if IE_THREAD == IE_THREAD_TBB
-    const int nthr = parallel_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+void parallel_for2d(const parallel_options &options, const T0 &D0, const T1 &D1, F func) {
+    parallel_split((size_t)D0 * D1, options, [&](int ithr, int nthr) {
         for_2d(ithr, nthr, D0, D1, func);
     });
-#elif IE_THREAD == IE_THREAD_OMP
-    #   pragma omp parallel
-    for_2d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, func);
-#elif IE_THREAD == IE_THREAD_SEQ
-    for_2d(0, 1, D0, D1, func);
-#endif
+}
+
+template <typename T0, typename T1, typename F>
+void parallel_for2d(const T0 &D0, const T1 &D1, F func) {
+    parallel_for2d(parallel_options(), D0, D1, func);
 }
 
 
@@ -348,18 +398,15 @@ void for_3d(const int ithr, const int nthr, const T0 &D0, const T1 &D1,
 }
 
 template <typename T0, typename T1, typename T2, typename F>
-void parallel_for3d(const T0 &D0, const T1 &D1, const T2 &D2, F func) {
-#if IE_THREAD == IE_THREAD_TBB
-    const int nthr = parallel_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+void parallel_for3d(const parallel_options &options, const T0 &D0, const T1 &D1, const T2 &D2, F func) {
+    parallel_split((size_t)D0 * D1 * D2, options, [&](int ithr, int nthr) {
         for_3d(ithr, nthr, D0, D1, D2, func);
     });
-#elif IE_THREAD == IE_THREAD_OMP
-    #   pragma omp parallel
-    for_3d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, D2, func);
-#elif IE_THREAD == IE_THREAD_SEQ
-    for_3d(0, 1, D0, D1, D2, func);
-#endif
+}
+
+template <typename T0, typename T1, typename T2, typename F>
+void parallel_for3d(const T0 &D0, const T1 &D1, const T2 &D2, F func) {
+    parallel_for3d(parallel_options(), D0, D1, D2, func);
 }
 
 template <typename T0, typename T1, typename T2, typename T3, typename F>
@@ -379,18 +426,15 @@ void for_4d(const int ithr, const int nthr, const T0 &D0, const T1 &D1,
 }
 
 template <typename T0, typename T1, typename T2, typename T3, typename F>
-void parallel_for4d(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3, F func) {
-#if IE_THREAD == IE_THREAD_TBB
-    const int nthr = parallel_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+void parallel_for4d(const parallel_options &options, const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3, F func) {
+    parallel_split((size_t)D0 * D1 * D2 * D3, options, [&](int ithr, int nthr) {
         for_4d(ithr, nthr, D0, D1, D2, D3, func);
     });
-#elif IE_THREAD == IE_THREAD_OMP
-    #   pragma omp parallel
-    for_4d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, D2, D3, func);
-#elif IE_THREAD == IE_THREAD_SEQ
-    for_4d(0, 1, D0, D1, D2, D3, func);
-#endif
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename F>
+void parallel_for4d(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3, F func) {
+    parallel_for4d(parallel_options(), D0, D1, D2, D3, func);
 }
 
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename F>
@@ -410,19 +454,17 @@ void for_5d(const int ithr, const int nthr, const T0 &D0, const T1 &D1,
 }
 
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename F>
-void parallel_for5d(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3,
+void parallel_for5d(const parallel_options &options, const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3,
                     const T4 &D4, F func) {
-#if IE_THREAD == IE_THREAD_TBB
-    const int nthr = parallel_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+    parallel_split((size_t)D0 * D1 * D2 * D3 * D4, options, [&](int ithr, int nthr) {
         for_5d(ithr, nthr, D0, D1, D2, D3, D4, func);
     });
-#elif IE_THREAD == IE_THREAD_OMP
-    #   pragma omp parallel
-    for_5d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, D2, D3, D4, func);
-#elif IE_THREAD == IE_THREAD_SEQ
-    for_5d(0, 1, D0, D1, D2, D3, D4, func);
-#endif
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4, typename F>
+void parallel_for5d(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3,
+                    const T4 &D4, F func) {
+    parallel_for5d(parallel_options(), D0, D1, D2, D3, D4, func);
 }
 
 
@@ -444,19 +486,17 @@ void for_6d(const int ithr, const int nthr, const T0 &D0, const T1 &D1,
 }
 
 template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename F>
-void parallel_for6d(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3,
+void parallel_for6d(const parallel_options &options, const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3,
     const T4 &D4, const T5 &D5, F func) {
-#if IE_THREAD == IE_THREAD_TBB
-    const int nthr = parallel_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+    parallel_split((size_t)D0 * D1 * D2 * D3 * D4 * D5, options, [&](int ithr, int nthr) {
         for_6d(ithr, nthr, D0, D1, D2, D3, D4, D5, func);
     });
-#elif IE_THREAD == IE_THREAD_OMP
-#   pragma omp parallel
-    for_6d(parallel_get_thread_num(), parallel_get_num_threads(), D0, D1, D2, D3, D4, D5, func);
-#elif IE_THREAD == IE_THREAD_SEQ
-    for_6d(0, 1, D0, D1, D2, D3, D4, D5, func);
-#endif
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4, typename T5, typename F>
+void parallel_for6d(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3,
+    const T4 &D4, const T5 &D5, F func) {
+    parallel_for6d(parallel_options(), D0, D1, D2, D3, D4, D5, func);
 }
 
 }  // namespace InferenceEngine
@@ -55,15 +55,139 @@ DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 * @brief Optimize CPU execution to maximize throughput.
 * It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
 * - KEY_CPU_THROUGHPUT_NUMA creates as many streams as needed to accomodate NUMA and avoid associated penalties
-* - KEY_CPU_THROUGHPUT_AUTO creates bare minimum of streams to improve the performance,
-*   this is the most portable option if you have no insights into how many cores you target machine will have
-*   (and what is the optimal number of streams)
+* - KEY_CPU_THROUGHPUT_AUTO chooses the streams for the network when it is loaded (the CPU plugin estimates the work
+*   of the layers: the light networks get more streams of fewer threads), this is the most portable option if you have
+*   no insights into how many cores you target machine will have (and what is the optimal number of streams).
+*   The choice is reported by the "Streams" and "ThreadsPerStream" metrics of the executable network
 * - finally, specifying the positive integer value creates the requested number of streams
 */
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+* @brief The name for setting the inter-layer parallelism option of the CPU plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO (default)
+* When enabled, independent branches of the network are executed concurrently within the stream.
+* Ignored, if the OpenVINO compiled without TBB threading or without MKL-DNN concurrent execution support
+*/
+DECLARE_CONFIG_KEY(CPU_INTER_LAYER_PARALLELISM);
+
+/**
+* @brief The name for setting the depth-first execution of the CPU plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO (default)
+* When enabled, the chains of the convolutions, poolings and activations are executed by the tiles of rows,
+* so the intermediate tensors of a tile stay in the cache. It pays off for the high resolution inputs.
+* Ignored, if the batch is set dynamically.
+*/
+DECLARE_CONFIG_KEY(CPU_DEPTH_FIRST);
+
+/**
+* @brief The name for setting the BF16 inference of the CPU plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO (default)
+* The CPU plugin has no BF16 execution path yet: with YES, LoadNetwork throws NOT_IMPLEMENTED, naming the missing
+* AVX512_BF16 CPU or the missing BF16 primitives of MKL-DNN, rather than run the network in FP32 silently.
+*/
+DECLARE_CONFIG_KEY(ENFORCE_BF16);
+
+/**
+* @brief The name for setting the dynamic spatial dims option of the CPU plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* the number of the input shapes the executable graphs are kept for, 0 (default) disables the option.
+* When enabled, the input blobs may have the spatial dims smaller than the network was loaded with,
+* the output blobs are re-allocated with the corresponding dims, so they should be taken after the inference
+*/
+DECLARE_CONFIG_KEY(CPU_DYN_SHAPES_CACHE_SIZE);
+
+/**
+* @brief The name for setting the capacity of the process-wide cache of the JIT kernels of the CPU plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* the maximum number of the cached kernels, 256 by default, 0 disables the cache.
+* The convolutions of the same parameters in all the loaded networks share the generated code of the cached kernels
+*/
+DECLARE_CONFIG_KEY(CPU_KERNEL_CACHE_CAPACITY);
+
+/**
+* @brief The name for setting the execution trace option of the CPU plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* the name of the file the trace is written to in the Chrome trace event format, empty (default) disables the option.
+* When enabled, the start and the end of every node execution and of every inference are recorded with the thread,
+* the stream and the implementation type of the node; the file is written when the executable network is destroyed
+*/
+DECLARE_CONFIG_KEY(CPU_TRACE_FILE);
+
+/**
+* @brief The name for setting the size of the execution trace buffer of the CPU plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* the number of the most recent events kept for the trace, 65536 by default
+*/
+DECLARE_CONFIG_KEY(CPU_TRACE_BUFFER_SIZE);
+
+/**
+* @brief The name for setting the number of threads that run the completion callbacks of the CPU plugin requests.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* 0 (default) - the callbacks of every network run one by one on a thread of the network,
+* N > 0 - the number of threads of a pool shared by all the networks, the callbacks of the different requests run concurrently.
+* The pool is created with the value of the first network that uses it
+*/
+DECLARE_CONFIG_KEY(CPU_CALLBACK_THREADS);
+
+/**
+* @brief The name for setting the spin-wait time of the CPU plugin, the low-latency mode.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* 0 (default) - the idle threads of the requests block at once,
+* N > 0 - the microseconds the idle stream threads spin for a new request before they block, and the
+* InferRequest::Wait polls the request before it blocks. It saves the wakeups of the OS on the short inferences
+* at the cost of the cores burnt by the spinning, so it pays off only when the cores are not shared with other work.
+* The threads of the OpenMP builds also follow OMP_WAIT_POLICY
+*/
+DECLARE_CONFIG_KEY(CPU_SPIN_WAIT_TIME);
+
+/**
+* @brief The name for setting the persistent state option of the RNN sequences of the CPU plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO (default)
+* When enabled, the hidden (and the cell) state of every RNN sequence is kept by the plugin between the inferences,
+* so each request continues the sequence of the previous one. The initial state inputs are used only after the
+* state is reset. The states are available through the IExecutableNetwork::QueryState() by the layer names
+*/
+DECLARE_CONFIG_KEY(CPU_RNN_PERSISTENT_STATE);
+
+/**
+* @brief The name for setting the INT8 weights compression of the CPU plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* PluginConfigParams::YES or PluginConfigParams::NO (default)
+* When enabled, the weights of the large FP32 fully connected layers are stored as INT8 with a scale per output
+* channel and dequantized during the multiplication, the compute stays FP32 and no calibration is needed.
+* A layer is compressed only if it is faster so, the results differ by the rounding of the weights
+*/
+DECLARE_CONFIG_KEY(CPU_INT8_WEIGHTS_COMPRESSION);
+
+/**
+* @brief The name for setting the allocator of the blobs created by the plugin.
+* It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
+* - ALLOCATOR_SYSTEM (default) allocates every buffer from the heap
+* - ALLOCATOR_POOL keeps the released buffers in the size classes of a process-wide pool for the next blobs
+* - ALLOCATOR_HUGEPAGES backs the buffers of 1 MB and more by the 2 MB pages
+* - ALLOCATOR_NUMA binds the buffers to the NUMA node of the thread that creates them
+* The CPU plugin applies it to the blobs of the infer requests and to the memory of the intermediate layers
+*/
+DECLARE_CONFIG_VALUE(ALLOCATOR_SYSTEM);
+DECLARE_CONFIG_VALUE(ALLOCATOR_POOL);
+DECLARE_CONFIG_VALUE(ALLOCATOR_HUGEPAGES);
+DECLARE_CONFIG_VALUE(ALLOCATOR_NUMA);
+DECLARE_CONFIG_KEY(BLOB_ALLOCATOR);
+
+/**
+* @brief The name of the scratch arena of the intermediate layers data, empty (default) means a private one.
+* The CPU executable networks loaded with the same name place the data of their intermediate layers in one arena
+* (per stream), sized for the largest of them and allocated by the BLOB_ALLOCATOR allocator. The networks must not
+* run at the same time: the inputs, outputs, constants and states stay private, everything else is overwritten.
+*/
+DECLARE_CONFIG_KEY(CPU_SCRATCH_ARENA);
 
 /**
 * @brief The name for setting performance counters option.
@@ -111,6 +235,8 @@ DECLARE_CONFIG_KEY(DUMP_KERNELS);
 * @brief This key controls performance tuning done or used by the plugin.
 * This option should be used with values: PluginConfigParams::TUNING_CREATE,
 * PluginConfigParams::TUNING_USE_EXISTING or PluginConfigParams::TUNING_DISABLED (default)
+* The CPU plugin times the implementations of the convolutions, deconvolutions and fully connected layers
+* at the load (TUNING_CREATE) and keeps the fastest ones in the tuning file by the shape and the ISA.
 */
 DECLARE_CONFIG_KEY(TUNING_MODE);
 
@@ -161,5 +287,21 @@ DECLARE_CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS);
  */
 DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
 
+/**
+ * @brief This key enables the cache of the compiled networks.
+ * Should be passed into LoadNetwork method, the value is a directory. The plugins supporting the export of the
+ * executable networks import the network from the directory if it was compiled before with the same IR, inputs and
+ * outputs settings and config, otherwise the compiled network is exported there. Empty value (default) disables it.
+ */
+DECLARE_CONFIG_KEY(CACHE_DIR);
+
+/**
+ * @brief This key caps the threads of the whole process: the parallel runtime shared by the plugins, the
+ * pre-processing and the extensions, the thread pools, the threads of the CPU streams and the GNA library.
+ * Should be passed into LoadNetwork method of any plugin, the value is the number of the threads, 0 (default)
+ * means no limit. The limit is process-wide and the last loaded network that sets it wins.
+ */
+DECLARE_CONFIG_KEY(PROCESS_THREADS_LIMIT);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
@@ -56,6 +56,13 @@ public:
                 InferenceEngine::ResponseDesc response;
                 ptr->SetConfig({ { "TARGET_FALLBACK", deviceName.substr(7, deviceName.length() - 7) } }, &response);
             }
+        } else if (deviceName.find("MULTI:") == 0) {
+            // the same for MULTI: the devices to load the network on and their numbers of requests
+            ptr = getSuitablePlugin(InferenceEngine::TargetDeviceInfo::fromStr("MULTI"));
+            if (ptr) {
+                InferenceEngine::ResponseDesc response;
+                ptr->SetConfig({ { "MULTI_DEVICE_PRIORITIES", deviceName.substr(6, deviceName.length() - 6) } }, &response);
+            }
         } else {
             ptr = getSuitablePlugin(InferenceEngine::TargetDeviceInfo::fromStr(deviceName));
         }
@@ -0,0 +1,33 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for Multi-Device plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods of the plugin
+ *
+ * @file multi_device_config.hpp
+ */
+
+#pragma once
+
+#include <string>
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+namespace MultiDeviceConfigParams {
+
+#define MULTI_CONFIG_KEY(name) InferenceEngine::MultiDeviceConfigParams::_CONFIG_KEY(MULTI_##name)
+#define DECLARE_MULTI_CONFIG_KEY(name) DECLARE_CONFIG_KEY(MULTI_##name)
+#define DECLARE_MULTI_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(MULTI_##name)
+
+/**
+ * @brief The key for the devices the network is loaded on, in the order of priority, separated by commas.
+ * A device can be followed by the number of its infer requests in parentheses, e.g. "GPU(4),CPU(2)",
+ * the default number is 2. The "MULTI:GPU(4),CPU(2)" device name of the PluginDispatcher sets this key
+ */
+DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
+
+}  // namespace MultiDeviceConfigParams
+}  // namespace InferenceEngine
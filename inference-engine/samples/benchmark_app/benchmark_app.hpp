@@ -80,6 +80,27 @@ static const char report_folder_message[] = "Optional. Path to a folder where st
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] = "Optional. Path to a file where to store executable graph information serialized.";
 
+// @brief message for qps option
+static const char qps_message[] = "Optional. Start the async requests at the given rate (requests per second) with the Poisson " \
+                                  "arrivals instead of restarting them as soon as they complete, to measure the latency at " \
+                                  "this load. A request arriving when all the infer requests are busy waits for an idle one.";
+
+// @brief message for trace_file option
+static const char trace_file_message[] = "Optional. Path to a file where to store the arrival, start and end times of each "
+                                         "infer request: a Chrome trace (chrome://tracing) for a .json path, a .csv table otherwise.";
+
+// @brief message for sweep option
+static const char sweep_message[] = "Optional. Explore the throughput streams, the CPU threads, the batch and the number of the infer "
+                                    "requests of the async execution and print the Pareto front of the throughput and the latency. "
+                                    "The dimensions set with -nthreads and -b are fixed.";
+
+// @brief message for sweep_time option
+static const char sweep_time_message[] = "Optional. Measurement time of every configuration of the sweep in seconds. Default value is 5.";
+
+// @brief message for sweep_config option
+static const char sweep_config_message[] = "Optional. Path to a .json file where to store the plugin configuration with the best "
+                                           "throughput found by the sweep.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -138,6 +159,21 @@ DEFINE_string(report_folder, "", report_folder_message);
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
+/// @brief Rate of the fixed-rate load in requests per second, 0 to restart the requests as they complete
+DEFINE_double(qps, 0.0, qps_message);
+
+/// @brief Path to a file where to store the timelines of the infer requests
+DEFINE_string(trace_file, "", trace_file_message);
+
+/// @brief Enables the sweep over the configurations of the async execution
+DEFINE_bool(sweep, false, sweep_message);
+
+/// @brief Measurement time of every configuration of the sweep
+DEFINE_double(sweep_time, 5.0, sweep_time_message);
+
+/// @brief Path to a file where to store the best configuration found by the sweep
+DEFINE_string(sweep_config, "", sweep_config_message);
+
 /**
 * @brief This function show a help message
 */
@@ -159,6 +195,11 @@ static void showUsage() {
     std::cout << "    -nireq \"<integer>\"        " << infer_requests_count_message << std::endl;
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
+    std::cout << "    -qps \"<float>\"            " << qps_message << std::endl;
+    std::cout << std::endl << "  Configuration sweep options:" << std::endl;
+    std::cout << "    -sweep                    " << sweep_message << std::endl;
+    std::cout << "    -sweep_time \"<float>\"     " << sweep_time_message << std::endl;
+    std::cout << "    -sweep_config \"<path>\"    " << sweep_config_message << std::endl;
     std::cout << std::endl << "  CPU-specific performance options:" << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
     std::cout << "    -pin \"YES\"/\"NO\"           " << infer_threads_pinning_message << std::endl;
@@ -166,4 +207,5 @@ static void showUsage() {
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
+    std::cout << "    -trace_file \"<path>\"      " << trace_file_message << std::endl;
 }
@@ -0,0 +1,205 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cldnn/cldnn_config.hpp>
+#include <samples/slog.hpp>
+
+#include "config_sweep.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::vector<size_t> powersOfTwoUpTo(size_t limit) {
+    std::vector<size_t> values;
+    for (size_t value = 1; value < limit; value *= 2) {
+        values.push_back(value);
+    }
+    values.push_back(limit);
+    return values;
+}
+
+}  // namespace
+
+ConfigSweep::ConfigSweep(InferencePlugin &plugin, CNNNetwork &network, Config config, FillInputs fillInputs) :
+        _plugin(plugin), _network(network), _config(std::move(config)), _fillInputs(std::move(fillInputs)) {}
+
+std::vector<SweepPoint> ConfigSweep::run() {
+    const bool isCPU = _config.device == "CPU";
+    const bool isGPU = _config.device == "GPU";
+    const size_t cores = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<size_t> streamsValues = {0};
+    if (isCPU) {
+        streamsValues = powersOfTwoUpTo(cores);
+    } else if (isGPU) {
+        streamsValues = {1, 2};
+    }
+    std::vector<size_t> threadsValues = {_config.nthreads};
+    if (isCPU && _config.nthreads == 0 && cores > 1) {
+        // the default uses all the logical cores, the half of them is the number of the physical ones with hyper-threading
+        threadsValues = {0, cores / 2};
+    }
+    std::vector<size_t> batchValues = {_config.batch};
+    if (_config.batch == 0) {
+        batchValues = {1, 2, 4, 8};
+        batchValues.push_back(_network.getBatchSize());
+        std::sort(batchValues.begin(), batchValues.end());
+        batchValues.erase(std::unique(batchValues.begin(), batchValues.end()), batchValues.end());
+    }
+
+    std::vector<SweepPoint> points;
+    for (size_t batch : batchValues) {
+        if (batch != _network.getBatchSize()) {
+            ICNNNetwork::InputShapes shapes = _network.getInputShapes();
+            if (shapes.begin()->second.size() != 4) {
+                slog::warn << "Unsupported model for batch size changing, batch " << batch << " is skipped" << slog::endl;
+                continue;
+            }
+            shapes.begin()->second[0] = batch;
+            _network.reshape(shapes);
+        }
+
+        for (size_t streams : streamsValues) {
+            for (size_t nthreads : threadsValues) {
+                SweepPoint point = {streams, nthreads, batch, 0, 0.0, 0.0, 0.0};
+                ExecutableNetwork exeNetwork;
+                try {
+                    exeNetwork = _plugin.LoadNetwork(_network, networkConfig(point));
+                } catch (const std::exception &ex) {
+                    slog::warn << "streams " << streams << ", threads " << nthreads << ", batch " << batch <<
+                               " are skipped: " << ex.what() << slog::endl;
+                    continue;
+                }
+                // the requests beyond the streams hide the latency of the host side of the requests
+                for (size_t nireq : {std::max<size_t>(streams, 1), 2 * std::max<size_t>(streams, 1)}) {
+                    point.nireq = nireq;
+                    points.push_back(measure(exeNetwork, point));
+                    const auto &measured = points.back();
+                    slog::info << "streams " << measured.streams << ", threads " << measured.nthreads << ", batch " <<
+                               measured.batch << ", requests " << measured.nireq << ": " << measured.fps << " FPS, " <<
+                               measured.medianLatency << " ms" << slog::endl;
+                }
+            }
+        }
+    }
+    return points;
+}
+
+SweepPoint ConfigSweep::measure(ExecutableNetwork &exeNetwork, SweepPoint point) {
+    std::vector<InferReqWrap::Ptr> requests;
+    for (size_t i = 0; i < point.nireq; i++) {
+        requests.push_back(std::make_shared<InferReqWrap>(exeNetwork, i));
+        _fillInputs(*requests.back(), point.batch);
+    }
+
+    // warming up - out of scope
+    requests[0]->startAsync();
+    requests[0]->wait();
+
+    std::vector<double> latencies;
+    size_t iterations = 0;
+    double totalDuration = 0.0;
+    {
+        InferRequestsQueue queue(requests);
+        const auto startTime = Time::now();
+        const auto duration = std::chrono::duration_cast<Time::duration>(
+                std::chrono::duration<double>(_config.secondsPerPoint));
+        while (Time::now() - startTime < duration) {
+            queue.getIdleRequest()->startAsync();
+            iterations++;
+        }
+        queue.waitAll();
+        totalDuration = std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
+        for (const auto &completion : queue.takeCompletions()) {
+            latencies.push_back(std::chrono::duration_cast<ns>(completion.end - completion.start).count() * 0.000001);
+        }
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    point.fps = totalDuration > 0 ? point.batch * 1000.0 * iterations / totalDuration : 0.0;
+    if (!latencies.empty()) {
+        point.medianLatency = latencies[latencies.size() / 2];
+        point.p99Latency = latencies[std::min(latencies.size() - 1, latencies.size() * 99 / 100)];
+    }
+    return point;
+}
+
+std::vector<SweepPoint> ConfigSweep::paretoFront(const std::vector<SweepPoint> &points) {
+    std::vector<SweepPoint> front;
+    for (const auto &point : points) {
+        bool dominated = std::any_of(points.begin(), points.end(), [&point](const SweepPoint &other) {
+            return other.fps >= point.fps && other.medianLatency <= point.medianLatency &&
+                   (other.fps > point.fps || other.medianLatency < point.medianLatency);
+        });
+        if (!dominated) {
+            front.push_back(point);
+        }
+    }
+    return front;
+}
+
+void ConfigSweep::printTable(const std::vector<SweepPoint> &points) {
+    std::vector<SweepPoint> sorted(points);
+    std::sort(sorted.begin(), sorted.end(), [](const SweepPoint &a, const SweepPoint &b) { return a.fps > b.fps; });
+    const auto front = paretoFront(points);
+    auto onFront = [&front](const SweepPoint &point) {
+        return std::any_of(front.begin(), front.end(), [&point](const SweepPoint &other) {
+            return other.streams == point.streams && other.nthreads == point.nthreads &&
+                   other.batch == point.batch && other.nireq == point.nireq;
+        });
+    };
+
+    std::cout << std::endl << "Pareto front of the throughput and the median latency is marked with *" << std::endl;
+    std::cout << std::setw(2) << "" << std::setw(9) << "streams" << std::setw(9) << "threads" << std::setw(7) << "batch" <<
+              std::setw(7) << "nireq" << std::setw(12) << "FPS" << std::setw(14) << "median, ms" << std::setw(12) <<
+              "p99, ms" << std::endl;
+    for (const auto &point : sorted) {
+        std::cout << std::setw(2) << (onFront(point) ? "*" : "") << std::setw(9) << point.streams << std::setw(9) <<
+                  point.nthreads << std::setw(7) << point.batch << std::setw(7) << point.nireq << std::fixed <<
+                  std::setprecision(2) << std::setw(12) << point.fps << std::setw(14) << point.medianLatency <<
+                  std::setw(12) << point.p99Latency << std::defaultfloat << std::endl;
+    }
+}
+
+std::map<std::string, std::string> ConfigSweep::networkConfig(const SweepPoint &point) const {
+    std::map<std::string, std::string> config;
+    if (_config.device == "CPU") {
+        config[PluginConfigParams::KEY_CPU_BIND_THREAD] = _config.cpuPin;
+        config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = std::to_string(point.streams);
+        if (point.nthreads != 0) {
+            config[PluginConfigParams::KEY_CPU_THREADS_NUM] = std::to_string(point.nthreads);
+        }
+    } else if (_config.device == "GPU" && point.streams != 0) {
+        config[CLDNNConfigParams::KEY_CLDNN_THROUGHPUT_STREAMS] = std::to_string(point.streams);
+    }
+    return config;
+}
+
+void ConfigSweep::dumpConfig(const SweepPoint &point, const std::string &path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Cannot open the config file " + path);
+    }
+    const auto config = networkConfig(point);
+    file << "{";
+    const char *separator = "\n";
+    for (const auto &item : config) {
+        file << separator << "    \"" << item.first << "\": \"" << item.second << "\"";
+        separator = ",\n";
+    }
+    file << "\n}" << std::endl;
+    slog::info << "configuration is stored to " << path << slog::endl;
+}
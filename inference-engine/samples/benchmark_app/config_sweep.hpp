@@ -0,0 +1,69 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "infer_request_wrap.hpp"
+
+/// @brief Measured point of the configuration space of the async execution
+struct SweepPoint {
+    // throughput streams, 0 for the devices without the streams
+    size_t streams;
+    // CPU threads, 0 for the plugin default
+    size_t nthreads;
+    size_t batch;
+    size_t nireq;
+    double fps;
+    double medianLatency;
+    double p99Latency;
+};
+
+/// @brief Explores the streams, the threads, the batch and the number of the infer requests of the async execution.
+/// A network is loaded once per streams, threads and batch, the infer requests are varied on the loaded network.
+class ConfigSweep {
+public:
+    struct Config {
+        std::string device;
+        std::string cpuPin;
+        // fixed values of the dimensions, 0 to explore them
+        size_t nthreads;
+        size_t batch;
+        // measurement time of every point
+        double secondsPerPoint;
+    };
+
+    using FillInputs = std::function<void(InferReqWrap &request, size_t batch)>;
+
+    ConfigSweep(InferenceEngine::InferencePlugin &plugin, InferenceEngine::CNNNetwork &network,
+                Config config, FillInputs fillInputs);
+
+    std::vector<SweepPoint> run();
+
+    /// @brief The points not dominated by another one with a higher or equal throughput and a lower or equal latency
+    static std::vector<SweepPoint> paretoFront(const std::vector<SweepPoint> &points);
+
+    /// @brief Prints the points sorted by the throughput, marking the Pareto front
+    static void printTable(const std::vector<SweepPoint> &points);
+
+    /// @brief The configuration of the plugin for the point, it can be passed to SetConfig or LoadNetwork
+    std::map<std::string, std::string> networkConfig(const SweepPoint &point) const;
+
+    /// @brief Stores the network configuration of the point as a JSON object of the config keys
+    void dumpConfig(const SweepPoint &point, const std::string &path) const;
+
+private:
+    SweepPoint measure(InferenceEngine::ExecutableNetwork &exeNetwork, SweepPoint point);
+
+    InferenceEngine::InferencePlugin &_plugin;
+    InferenceEngine::CNNNetwork &_network;
+    Config _config;
+    FillInputs _fillInputs;
+};
@@ -8,6 +8,11 @@
 #include <map>
 #include <string>
 #include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <vector>
 
 #include "inference_engine.hpp"
 
@@ -18,21 +23,38 @@ typedef std::chrono::nanoseconds ns;
 class InferReqWrap {
 public:
     using Ptr = std::shared_ptr<InferReqWrap>;
+    using CallbackFunction = std::function<void(InferReqWrap &)>;
 
-    explicit InferReqWrap(InferenceEngine::ExecutableNetwork& net) : _request(net.CreateInferRequest()) {
+    explicit InferReqWrap(InferenceEngine::ExecutableNetwork& net, size_t id = 0) :
+            _request(net.CreateInferRequest()), _id(id) {
         _request.SetCompletionCallback(
                 [&]() {
                     _endTime = Time::now();
+                    if (_callback) {
+                        _callback(*this);
+                    }
                 });
     }
 
+    /// @brief Sets the function called on the completion of the asynchronous request, after its end time is taken
+    void setCallback(CallbackFunction callback) {
+        _callback = callback;
+    }
+
     void startAsync() {
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request which arrived at arrivalTime, the time since then is spent waiting for the request
+    void startAsync(Time::time_point arrivalTime) {
+        _arrivalTime = arrivalTime;
         _startTime = Time::now();
         _request.StartAsync();
     }
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
     }
@@ -57,8 +79,94 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    size_t getId() const {
+        return _id;
+    }
+
+    Time::time_point getArrivalTime() const {
+        return _arrivalTime;
+    }
+
+    Time::time_point getStartTime() const {
+        return _startTime;
+    }
+
+    Time::time_point getEndTime() const {
+        return _endTime;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    size_t _id;
+    CallbackFunction _callback;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
-};
\ No newline at end of file
+};
+
+/// @brief Hands out the idle infer requests, so the requests can be started at their arrival times
+class InferRequestsQueue {
+public:
+    /// @brief Times of a completed request
+    struct Completion {
+        size_t id;
+        Time::time_point arrival;
+        Time::time_point start;
+        Time::time_point end;
+    };
+
+    /// @param requests - the requests with the ids equal to their indices, none of them is running
+    explicit InferRequestsQueue(const std::vector<InferReqWrap::Ptr> &requests) : _requests(requests) {
+        for (auto &request : _requests) {
+            _idleIds.push(request->getId());
+            request->setCallback([this](InferReqWrap &request) {
+                putIdleRequest(request);
+            });
+        }
+    }
+
+    ~InferRequestsQueue() {
+        waitAll();
+        for (auto &request : _requests) {
+            request->setCallback(nullptr);
+        }
+    }
+
+    /// @brief Waits for any request to complete if all of them are running
+    InferReqWrap::Ptr getIdleRequest() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return !_idleIds.empty(); });
+        auto request = _requests[_idleIds.front()];
+        _idleIds.pop();
+        return request;
+    }
+
+    void waitAll() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return _idleIds.size() == _requests.size(); });
+    }
+
+    /// @brief Gets the times of the requests completed since the previous call
+    std::vector<Completion> takeCompletions() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::vector<Completion> completions;
+        completions.swap(_completions);
+        return completions;
+    }
+
+private:
+    void putIdleRequest(InferReqWrap &request) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _completions.push_back({request.getId(), request.getArrivalTime(), request.getStartTime(), request.getEndTime()});
+            _idleIds.push(request.getId());
+        }
+        _cv.notify_all();
+    }
+
+    std::vector<InferReqWrap::Ptr> _requests;
+    std::queue<size_t> _idleIds;
+    std::vector<Completion> _completions;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+};
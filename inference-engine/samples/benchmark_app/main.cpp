@@ -4,9 +4,12 @@
 
 #include <algorithm>
 #include <chrono>
+#include <iomanip>
 #include <memory>
 #include <map>
+#include <random>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -19,6 +22,7 @@
 #include <samples/args_helper.hpp>
 
 #include "benchmark_app.hpp"
+#include "config_sweep.hpp"
 #include "infer_request_wrap.hpp"
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
@@ -27,6 +31,13 @@ using namespace InferenceEngine;
 
 long long getDurationInNanoseconds(const std::string& device);
 
+void printStreamsUtilization(InferenceEngine::ExecutableNetwork& exeNetwork, double totalDuration);
+
+void printLoadBreakdown(InferenceEngine::ExecutableNetwork& exeNetwork, double readDuration, double loadDuration);
+
+StatisticsReport::RequestTimeline getTimeline(size_t requestId, Time::time_point arrival, Time::time_point start,
+                                              Time::time_point end, Time::time_point origin);
+
 void fillBlobWithImage(
     Blob::Ptr& inputBlob,
     const std::vector<std::string>& filePaths,
@@ -68,6 +79,22 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Number of inference requests should be positive (invalid -nireq option value)");
     }
 
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("Requests rate should be positive (invalid -qps option value)");
+    }
+
+    if (FLAGS_qps > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Fixed-rate load (-qps option) requires the async API");
+    }
+
+    if (FLAGS_sweep && (FLAGS_api != "async" || FLAGS_qps > 0)) {
+        throw std::logic_error("Configuration sweep (-sweep option) requires the async API without -qps");
+    }
+
+    if (FLAGS_sweep && FLAGS_sweep_time <= 0) {
+        throw std::logic_error("Sweep time should be positive (invalid -sweep_time option value)");
+    }
+
     if (FLAGS_b < 0) {
         throw std::logic_error("Batch size should be positive (invalid -b option value)");
     }
@@ -142,10 +169,12 @@ int main(int argc, char *argv[]) {
 
         slog::info << "Loading network files" << slog::endl;
 
+        const auto readStart = Time::now();
         InferenceEngine::CNNNetReader netBuilder;
         netBuilder.ReadNetwork(FLAGS_m);
         const std::string binFileName = fileNameNoExt(FLAGS_m) + ".bin";
         netBuilder.ReadWeights(binFileName);
+        const double readDuration = std::chrono::duration_cast<ns>(Time::now() - readStart).count() * 0.000001;
 
         InferenceEngine::CNNNetwork cnnNetwork = netBuilder.getNetwork();
         const InferenceEngine::InputsDataMap inputInfo(cnnNetwork.getInputsInfo());
@@ -221,6 +250,34 @@ int main(int argc, char *argv[]) {
         progressBar.addProgress(1);
         progressBar.finish();
 
+        if (FLAGS_sweep) {
+            std::cout << "[Step 5/8] Sweep over the configurations of the async execution" << std::endl;
+            ConfigSweep::Config sweepConfig = {FLAGS_d, FLAGS_pin, FLAGS_nthreads, FLAGS_b, FLAGS_sweep_time};
+            ConfigSweep sweep(plugin, cnnNetwork, sweepConfig, [&](InferReqWrap& request, size_t batch) {
+                for (const InputsDataMap::value_type& item : inputInfo) {
+                    Blob::Ptr inputBlob = request.getBlob(item.first);
+                    fillBlobWithImage(inputBlob, inputImages, batch, *item.second);
+                }
+            });
+            const auto points = sweep.run();
+            if (points.empty()) {
+                throw std::logic_error("no configuration of the sweep was loaded");
+            }
+            ConfigSweep::printTable(points);
+
+            const auto best = *std::max_element(points.begin(), points.end(),
+                    [](const SweepPoint& a, const SweepPoint& b) { return a.fps < b.fps; });
+            std::cout << "Best throughput: " << best.fps << " FPS with -nireq " << best.nireq << " -b " << best.batch;
+            for (const auto& item : sweep.networkConfig(best)) {
+                std::cout << " " << item.first << "=" << item.second;
+            }
+            std::cout << std::endl;
+            if (!FLAGS_sweep_config.empty()) {
+                sweep.dumpConfig(best, FLAGS_sweep_config);
+            }
+            return 0;
+        }
+
         // --------------------------- 5. Loading model to the plugin ------------------------------------------
 
         std::cout << "[Step 5/8] Loading model to the plugin " << std::endl;
@@ -242,10 +299,13 @@ int main(int argc, char *argv[]) {
             networkConfig[PluginConfigParams::KEY_PERF_COUNT] = PluginConfigParams::YES;
         }
 
+        const auto loadStart = Time::now();
         InferenceEngine::ExecutableNetwork exeNetwork = plugin.LoadNetwork(cnnNetwork, networkConfig);
+        const double loadDuration = std::chrono::duration_cast<ns>(Time::now() - loadStart).count() * 0.000001;
 
         progressBar.addProgress(1);
         progressBar.finish();
+        printLoadBreakdown(exeNetwork, readDuration, loadDuration);
 
         // --------------------------- 6. Create infer requests and fill input blobs ---------------------------
 
@@ -257,7 +317,7 @@ int main(int argc, char *argv[]) {
         inferRequests.reserve(numOfReq);
 
         for (size_t i = 0; i < numOfReq; i++) {
-            inferRequests.push_back(std::make_shared<InferReqWrap>(exeNetwork));
+            inferRequests.push_back(std::make_shared<InferReqWrap>(exeNetwork, i));
             slog::info << "Infer Request " << i << " created" << slog::endl;
 
             for (const InputsDataMap::value_type& item : inputInfo) {
@@ -324,6 +384,8 @@ int main(int argc, char *argv[]) {
                 statistics.add((FLAGS_report_type == detailedCntReport || FLAGS_report_type == medianCntReport) ?
                                inferRequest->getPerformanceCounts() : emptyStat,
                                inferRequest->getExecTime());
+                statistics.addTimeline(getTimeline(inferRequest->getId(), inferRequest->getArrivalTime(),
+                                                   inferRequest->getStartTime(), inferRequest->getEndTime(), startTime));
 
                 iteration++;
 
@@ -343,7 +405,7 @@ int main(int argc, char *argv[]) {
             fps = batchSize * 1000.0 / statistics.getMedianLatency();
             totalDuration = std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
             progressBar.finish();
-        } else {
+        } else if (FLAGS_qps == 0) {
             std::cout << "[Step 7/8] ";
             if (FLAGS_niter != 0) {
                 std::cout << "Start inference asynchronously (" << FLAGS_niter <<
@@ -385,6 +447,9 @@ int main(int argc, char *argv[]) {
                     statistics.add((FLAGS_report_type == detailedCntReport || FLAGS_report_type == medianCntReport) ?
                                    inferRequests[previousInference]->getPerformanceCounts() : emptyStat,
                                    inferRequests[previousInference]->getExecTime());
+                    const auto& request = inferRequests[previousInference];
+                    statistics.addTimeline(getTimeline(request->getId(), request->getArrivalTime(),
+                                                       request->getStartTime(), request->getEndTime(), startTime));
                 }
 
                 currentInference++;
@@ -422,6 +487,9 @@ int main(int argc, char *argv[]) {
                     statistics.add((FLAGS_report_type == detailedCntReport || FLAGS_report_type == medianCntReport) ?
                                    inferRequests[previousInference]->getPerformanceCounts() : emptyStat,
                                    inferRequests[previousInference]->getExecTime());
+                    const auto& request = inferRequests[previousInference];
+                    statistics.addTimeline(getTimeline(request->getId(), request->getArrivalTime(),
+                                                       request->getStartTime(), request->getEndTime(), startTime));
                 }
 
                 previousInference++;
@@ -432,6 +500,64 @@ int main(int argc, char *argv[]) {
             totalDuration = std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
             fps = batchSize * 1000.0 * iteration / totalDuration;
             progressBar.finish();
+        } else {
+            std::cout << "[Step 7/8] ";
+            if (FLAGS_niter != 0) {
+                std::cout << "Start inference at " << FLAGS_qps << " requests per second (" << FLAGS_niter <<
+                    " async inference executions, " << FLAGS_nireq << " inference requests in parallel)" << std::endl;
+                progressBarTotalCount = FLAGS_niter;
+            } else {
+                std::cout << "Start inference at " << FLAGS_qps << " requests per second (" <<
+                    durationInNanoseconds * 0.000001 << " ms duration, " << FLAGS_nireq <<
+                    " inference requests in parallel)" << std::endl;
+                progressBarTotalCount = progressBarDefaultTotalCount;
+            }
+
+            // warming up - out of scope
+            inferRequests[0]->startAsync();
+            inferRequests[0]->wait();
+
+            InferRequestsQueue requestsQueue(inferRequests);
+            // the arrivals are a Poisson process: the intervals between them are exponentially distributed
+            std::mt19937 generator(0);
+            std::exponential_distribution<double> arrivalInterval(FLAGS_qps);
+
+            const auto startTime = Time::now();
+            auto arrivalTime = startTime;
+            auto execTime = 0LL;
+
+            /** Start the requests at their arrival times, their latency includes the wait for an idle request **/
+            progressBar.newBar(progressBarTotalCount);
+            while ((iteration < FLAGS_niter) ||
+                   ((FLAGS_niter == 0LL) && (execTime < durationInNanoseconds))) {
+                std::this_thread::sleep_until(arrivalTime);
+                requestsQueue.getIdleRequest()->startAsync(arrivalTime);
+                arrivalTime += std::chrono::duration_cast<Time::duration>(
+                        std::chrono::duration<double>(arrivalInterval(generator)));
+
+                iteration++;
+
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                if (FLAGS_niter > 0) {
+                    progressBar.addProgress(1);
+                } else {
+                    auto progressIntervalTime = durationInNanoseconds / progressBarTotalCount;
+                    size_t newProgress = execTime / progressIntervalTime - progressCnt;
+                    progressBar.addProgress(newProgress);
+                    progressCnt += newProgress;
+                }
+            }
+
+            // wait the latest inference executions
+            requestsQueue.waitAll();
+            totalDuration = std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
+            for (const auto& completion : requestsQueue.takeCompletions()) {
+                auto timeline = getTimeline(completion.id, completion.arrival, completion.start, completion.end, startTime);
+                statistics.add(emptyStat, timeline.end - timeline.arrival);
+                statistics.addTimeline(timeline);
+            }
+            fps = batchSize * 1000.0 * iteration / totalDuration;
+            progressBar.finish();
         }
 
         std::cout << "[Step 8/8] Dump statistics report" << std::endl;
@@ -446,7 +572,13 @@ int main(int argc, char *argv[]) {
         progressBar.addProgress(1);
         progressBar.finish();
 
+        if (!FLAGS_trace_file.empty()) {
+            statistics.dumpTimeline(FLAGS_trace_file);
+        }
+
         std::cout << "Latency: " << statistics.getMedianLatency() << " ms" << std::endl;
+        statistics.printLatencyStatistics();
+        printStreamsUtilization(exeNetwork, totalDuration);
         std::cout << "Throughput: " << fps << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -490,6 +622,76 @@ long long getDurationInNanoseconds(const std::string& device) {
     return duration * 1000000000LL;
 }
 
+void printStreamsUtilization(InferenceEngine::ExecutableNetwork& exeNetwork, double totalDuration) {
+    std::map<std::string, InferenceEngineMetricInfo> metrics;
+    try {
+        metrics = exeNetwork.GetMetrics();
+    } catch (const std::exception& ex) {
+        slog::warn << "Metrics of the executable network are not available: " << ex.what() << slog::endl;
+        return;
+    }
+
+    auto mean = [](const InferenceEngineMetricInfo& metric) {
+        return metric.count == 0 ? 0.0 : metric.sum_uSec * 0.001 / metric.count;
+    };
+    auto queueWait = metrics.find("QueueWait");
+    auto infer = metrics.find("Infer");
+    if (queueWait != metrics.end() && infer != metrics.end() && infer->second.count > 0) {
+        std::cout << "Plugin queue wait: mean " << mean(queueWait->second) << " ms, execution: mean " <<
+            mean(infer->second) << " ms" << std::endl;
+    }
+
+    if (totalDuration <= 0) {
+        return;
+    }
+    // the busy time of the streams since the network was loaded, the per-stream histograms exist for several streams only
+    const std::string streamPrefix = "Infer.stream";
+    bool perStream = false;
+    for (const auto& metric : metrics) {
+        if (metric.first.compare(0, streamPrefix.size(), streamPrefix) == 0) {
+            std::cout << "Stream " << metric.first.substr(streamPrefix.size()) << " utilization: " <<
+                100.0 * metric.second.sum_uSec * 0.001 / totalDuration << "%" << std::endl;
+            perStream = true;
+        }
+    }
+    if (!perStream && infer != metrics.end()) {
+        std::cout << "Utilization: " << 100.0 * infer->second.sum_uSec * 0.001 / totalDuration << "%" << std::endl;
+    }
+}
+
+void printLoadBreakdown(InferenceEngine::ExecutableNetwork& exeNetwork, double readDuration, double loadDuration) {
+    std::cout << "Read IR: " << readDuration << " ms, load network: " << loadDuration << " ms" << std::endl;
+    std::map<std::string, InferenceEngineMetricInfo> metrics;
+    try {
+        metrics = exeNetwork.GetMetrics();
+    } catch (const std::exception&) {
+        // the breakdown is optional, the plugins without the metrics print the totals only
+        return;
+    }
+
+    // the phases of the load of the plugin, the nested ones and the ones of the parallel streams may overlap
+    const std::string loadPrefix = "Load.";
+    for (const auto& metric : metrics) {
+        if (metric.first.compare(0, loadPrefix.size(), loadPrefix) != 0 || metric.first == "Load.Total") {
+            continue;
+        }
+        std::cout << "    " << std::left << std::setw(40) << metric.first.substr(loadPrefix.size()) << std::right <<
+            std::setw(12) << metric.second.sum_uSec * 0.001 << " ms";
+        if (metric.second.count > 1) {
+            std::cout << " (" << metric.second.count << " times)";
+        }
+        std::cout << std::endl;
+    }
+}
+
+StatisticsReport::RequestTimeline getTimeline(size_t requestId, Time::time_point arrival, Time::time_point start,
+                                              Time::time_point end, Time::time_point origin) {
+    auto toMilliseconds = [&origin](Time::time_point time) {
+        return std::chrono::duration_cast<ns>(time - origin).count() * 0.000001;
+    };
+    return {requestId, toMilliseconds(arrival), toMilliseconds(start), toMilliseconds(end)};
+}
+
 void fillBlobWithImage(
     Blob::Ptr& inputBlob,
     const std::vector<std::string>& filePaths,
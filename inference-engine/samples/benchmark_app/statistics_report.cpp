@@ -7,6 +7,8 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <fstream>
 
 #include "statistics_report.hpp"
 
@@ -181,6 +183,11 @@ void StatisticsReport::dump(const double &fps, const size_t &numProcessedReq, co
     completeCsvRow(dumper, numOfColumns, 2);
     dumper << "latency" << getMedianValue<double>(_latencies);
     completeCsvRow(dumper, numOfColumns, 2);
+    const std::vector<std::pair<std::string, double>> percentiles = {{"p90", 90.0}, {"p99", 99.0}, {"p99.9", 99.9}};
+    for (const auto &percentile : percentiles) {
+        dumper << "latency " + percentile.first << getPercentileValue<double>(_latencies, percentile.second);
+        completeCsvRow(dumper, numOfColumns, 2);
+    }
     dumper << "throughput" << fps;
     completeCsvRow(dumper, numOfColumns, 2);
     dumper << "total execution time" << totalExecTime;
@@ -193,6 +200,79 @@ double StatisticsReport::getMedianLatency() {
     return getMedianValue<double>(_latencies);
 }
 
+double StatisticsReport::getLatencyPercentile(double percentile) {
+    return getPercentileValue<double>(_latencies, percentile);
+}
+
+void StatisticsReport::addTimeline(const RequestTimeline &timeline) {
+    _timelines.push_back(timeline);
+}
+
+void StatisticsReport::printLatencyStatistics() {
+    if (_latencies.empty()) {
+        return;
+    }
+    std::cout << "Latency percentiles: p50 " << getLatencyPercentile(50.0) << " ms, p90 " << getLatencyPercentile(90.0) <<
+        " ms, p99 " << getLatencyPercentile(99.0) << " ms, p99.9 " << getLatencyPercentile(99.9) << " ms" << std::endl;
+
+    if (_timelines.empty()) {
+        return;
+    }
+    std::vector<double> queueWaits, executions;
+    queueWaits.reserve(_timelines.size());
+    executions.reserve(_timelines.size());
+    for (const auto &timeline : _timelines) {
+        queueWaits.push_back(timeline.start - timeline.arrival);
+        executions.push_back(timeline.end - timeline.start);
+    }
+    std::cout << "Queue wait: median " << getMedianValue<double>(queueWaits) << " ms, p99 " <<
+        getPercentileValue<double>(queueWaits, 99.0) << " ms" << std::endl;
+    std::cout << "Execution: median " << getMedianValue<double>(executions) << " ms, p99 " <<
+        getPercentileValue<double>(executions, 99.0) << " ms" << std::endl;
+}
+
+void StatisticsReport::dumpTimeline(const std::string &path) {
+    const std::string chromeTraceExt = ".json";
+    bool chromeTrace = path.size() >= chromeTraceExt.size() &&
+                       path.compare(path.size() - chromeTraceExt.size(), chromeTraceExt.size(), chromeTraceExt) == 0;
+    if (!chromeTrace) {
+        CsvDumper dumper(true, path);
+        dumper << "request" << "arrival" << "start" << "end" << "queue wait" << "execution";
+        dumper.endLine();
+        for (const auto &timeline : _timelines) {
+            dumper << timeline.requestId << timeline.arrival << timeline.start << timeline.end <<
+                timeline.start - timeline.arrival << timeline.end - timeline.start;
+            dumper.endLine();
+        }
+        slog::info << "requests timeline is stored to " << dumper.getFilename() << slog::endl;
+        return;
+    }
+
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Cannot open the trace file " + path);
+    }
+    // complete events of the trace event format in microseconds, the infer requests are shown as threads
+    auto event = [&file](const char *name, size_t requestId, double begin, double end) {
+        file << "{\"name\": \"" << name << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << requestId <<
+             ", \"ts\": " << begin * 1000.0 << ", \"dur\": " << (end - begin) * 1000.0 << "}";
+    };
+    file << "{\"traceEvents\": [";
+    const char *separator = "\n";
+    for (const auto &timeline : _timelines) {
+        if (timeline.start > timeline.arrival) {
+            file << separator;
+            event("queue_wait", timeline.requestId, timeline.arrival, timeline.start);
+            separator = ",\n";
+        }
+        file << separator;
+        event("infer", timeline.requestId, timeline.start, timeline.end);
+        separator = ",\n";
+    }
+    file << "\n]}" << std::endl;
+    slog::info << "requests timeline is stored to " << path << slog::endl;
+}
+
 std::vector<std::pair<std::string, InferenceEngine::InferenceEngineProfileInfo>> StatisticsReport::preparePmStatistics() {
     if (_performanceCounters.empty()) {
         throw std::logic_error("preparePmStatistics() was called when no PM data was collected");
@@ -220,3 +300,14 @@ T StatisticsReport::getMedianValue(const std::vector<T> &vec) {
            sortedVec[sortedVec.size() / 2ULL] :
            (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
 }
+
+template <typename T>
+T StatisticsReport::getPercentileValue(const std::vector<T> &vec, double percentile) {
+    if (vec.empty()) {
+        return T();
+    }
+    std::vector<T> sortedVec(vec);
+    std::sort(sortedVec.begin(), sortedVec.end());
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sortedVec.size()));
+    return sortedVec[std::min(std::max<size_t>(rank, 1ULL), sortedVec.size()) - 1ULL];
+}
@@ -34,6 +34,15 @@ public:
         std::string report_folder;
     };
 
+    /// @brief Times of an infer request in milliseconds since the start of the measurements
+    struct RequestTimeline {
+        size_t requestId;
+        // the request waits for an idle infer request from its arrival till its start
+        double arrival;
+        double start;
+        double end;
+    };
+
     explicit StatisticsReport(Config config) : _config(std::move(config)) {
         if (_config.niter > 0) {
             _performanceCounters.reserve(_config.niter);
@@ -46,16 +55,32 @@ public:
 
     double getMedianLatency();
 
+    double getLatencyPercentile(double percentile);
+
+    void addTimeline(const RequestTimeline &timeline);
+
+    /// @brief Prints the latency percentiles and the split of the latency into the queue wait and the execution
+    void printLatencyStatistics();
+
+    /// @brief Stores the timelines of the requests as a Chrome trace for a .json path, as a .csv table otherwise
+    void dumpTimeline(const std::string &path);
+
 private:
     std::vector<std::pair<std::string, InferenceEngine::InferenceEngineProfileInfo>> preparePmStatistics();
 
     template <typename T>
     T getMedianValue(const std::vector<T> &vec);
 
+    // nearest-rank percentile
+    template <typename T>
+    T getPercentileValue(const std::vector<T> &vec, double percentile);
+
     // Contains PM data for each processed infer request
     std::vector<std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>> _performanceCounters;
     // Contains latency of each processed infer request
     std::vector<double> _latencies;
+    // Contains timeline of each processed infer request
+    std::vector<RequestTimeline> _timelines;
 
     // configuration of current benchmark execution
     const Config _config;
@@ -0,0 +1,99 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <gflags/gflags.h>
+#include <iostream>
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message";
+
+/// @brief message for suite argument
+static const char suite_message[] = "Required. Path to a suite file, every line of it is "
+                                    "\"<name> <path to .xml> <device>[,<device>...] [<KEY>=<VALUE> ...]\". "
+                                    "The relative paths of the models are resolved against the folder of the suite "
+                                    "file, the lines starting with # are skipped.";
+
+/// @brief message for plugin_path argument
+static const char plugin_path_message[] = "Optional. Path to a plugin folder.";
+
+/// @brief message for user library argument
+static const char custom_cpu_library_message[] = "Required for CPU custom layers. Absolute path to a shared library with the kernels implementations.";
+
+/// @brief message for clDNN custom kernels desc
+static const char custom_cldnn_message[] = "Required for GPU custom kernels. Absolute path to an .xml file with the kernels description.";
+
+/// @brief message for time argument
+static const char time_message[] = "Optional. Measurement time of every model in seconds. Default value is 10.";
+
+/// @brief message for requests count
+static const char infer_requests_count_message[] = "Optional. Number of infer requests. Default value is 2.";
+
+/// @brief message for output argument
+static const char output_message[] = "Optional. Path to a file where to store the results as JSON. "
+                                     "Default value is \"benchmark_suite.json\".";
+
+/// @brief message for baseline argument
+static const char baseline_message[] = "Optional. Path to the results of a previous run to compare with. "
+                                       "The application returns 2 if any of the models regressed.";
+
+/// @brief message for threshold argument
+static const char threshold_message[] = "Optional. Change of a metric in percents which is reported as a regression. "
+                                        "Default value is 5.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Define parameter for the suite file <br>
+/// It is a required parameter
+DEFINE_string(suite, "", suite_message);
+
+/// @brief Define parameter for set path to plugins <br>
+DEFINE_string(pp, "", plugin_path_message);
+
+/// @brief Define parameter for the CPU extensions library <br>
+DEFINE_string(l, "", custom_cpu_library_message);
+
+/// @brief Define parameter for the clDNN custom kernels <br>
+DEFINE_string(c, "", custom_cldnn_message);
+
+/// @brief Measurement time of every model
+DEFINE_double(t, 10.0, time_message);
+
+/// @brief Number of infer requests
+DEFINE_uint32(nireq, 2, infer_requests_count_message);
+
+/// @brief Path to a file where to store the results
+DEFINE_string(o, "benchmark_suite.json", output_message);
+
+/// @brief Path to the results to compare with
+DEFINE_string(baseline, "", baseline_message);
+
+/// @brief Regression threshold in percents
+DEFINE_double(threshold, 5.0, threshold_message);
+
+/**
+* @brief This function show a help message
+*/
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "benchmark_suite [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h                        " << help_message << std::endl;
+    std::cout << "    -suite \"<path>\"           " << suite_message << std::endl;
+    std::cout << "    -pp \"<path>\"              " << plugin_path_message << std::endl;
+    std::cout << "    -l \"<absolute_path>\"      " << custom_cpu_library_message << std::endl;
+    std::cout << "          Or" << std::endl;
+    std::cout << "    -c \"<absolute_path>\"      " << custom_cldnn_message << std::endl;
+    std::cout << "    -t \"<float>\"              " << time_message << std::endl;
+    std::cout << "    -nireq \"<integer>\"        " << infer_requests_count_message << std::endl;
+    std::cout << std::endl << "  Baseline options:" << std::endl;
+    std::cout << "    -o \"<path>\"               " << output_message << std::endl;
+    std::cout << "    -baseline \"<path>\"        " << baseline_message << std::endl;
+    std::cout << "    -threshold \"<float>\"      " << threshold_message << std::endl;
+}
@@ -0,0 +1,105 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+#include <samples/slog.hpp>
+
+#include "benchmark_suite.hpp"
+#include "suite.hpp"
+
+using namespace InferenceEngine;
+
+bool ParseAndCheckCommandLine(int argc, char *argv[]) {
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_suite.empty()) {
+        throw std::logic_error("Suite file is required but not set. Please set -suite option.");
+    }
+
+    if (FLAGS_t <= 0) {
+        throw std::logic_error("Measurement time should be positive (invalid -t option value)");
+    }
+
+    if (FLAGS_threshold < 0) {
+        throw std::logic_error("Regression threshold should not be negative (invalid -threshold option value)");
+    }
+
+    return true;
+}
+
+/**
+* @brief The entry point the benchmark suite
+*/
+int main(int argc, char *argv[]) {
+    try {
+        slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
+
+        if (!ParseAndCheckCommandLine(argc, argv)) {
+            return 0;
+        }
+
+        const std::vector<SuiteEntry> entries = parseSuite(FLAGS_suite);
+        if (entries.empty()) {
+            throw std::logic_error("no models are found in the suite file " + FLAGS_suite);
+        }
+        // the baseline is read first, so a wrong path is reported before the models are measured
+        std::vector<SuiteResult> baseline;
+        if (!FLAGS_baseline.empty()) {
+            baseline = readResults(FLAGS_baseline);
+        }
+
+        SuiteRunner runner({FLAGS_pp, FLAGS_l, FLAGS_c, FLAGS_t, FLAGS_nireq});
+        std::vector<SuiteResult> results;
+        size_t failures = 0;
+        for (size_t i = 0; i < entries.size(); i++) {
+            const auto &entry = entries[i];
+            slog::info << "[" << i + 1 << "/" << entries.size() << "] " << entry.name << " on " << entry.device <<
+                       slog::endl;
+            try {
+                results.push_back(runner.run(entry));
+            } catch (const std::exception &ex) {
+                // a model failing on a device does not stop the others
+                slog::err << entry.name << " on " << entry.device << " failed: " << ex.what() << slog::endl;
+                failures++;
+                continue;
+            }
+            const auto &result = results.back();
+            slog::info << std::fixed << std::setprecision(2) << result.fps << " FPS, latency p50 " <<
+                       result.latencyP50 << " ms, p90 " << result.latencyP90 << " ms, p99 " << result.latencyP99 <<
+                       " ms, load " << result.loadTime << " ms, peak RSS " << result.peakRssMb << " MB" <<
+                       std::defaultfloat << slog::endl;
+        }
+
+        writeResults(FLAGS_o, results);
+
+        if (failures != 0) {
+            slog::err << failures << " of " << entries.size() << " models failed" << slog::endl;
+        }
+        if (!FLAGS_baseline.empty()) {
+            const size_t regressions = compareResults(baseline, results, FLAGS_threshold);
+            if (regressions != 0) {
+                slog::err << regressions << " metrics regressed beyond " << FLAGS_threshold << "%" << slog::endl;
+                return 2;
+            }
+            slog::info << "No regressions beyond " << FLAGS_threshold << "%" << slog::endl;
+        }
+        if (failures != 0) {
+            return 1;
+        }
+    } catch (const std::exception& ex) {
+        slog::err << ex.what() << slog::endl;
+        return 1;
+    }
+
+    return 0;
+}
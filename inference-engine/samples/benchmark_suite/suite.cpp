@@ -0,0 +1,441 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cldnn/cldnn_config.hpp>
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include "infer_request_wrap.hpp"
+#include "suite.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+double elapsedMs(Time::time_point start, Time::time_point end) {
+    return std::chrono::duration_cast<ns>(end - start).count() * 0.000001;
+}
+
+/// @brief Nearest-rank percentile of the sorted values
+double percentile(const std::vector<double> &sorted, double value) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t rank = static_cast<size_t>(value / 100.0 * sorted.size());
+    return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+/*
+ * The peak RSS is only known on Linux: writing 5 to clear_refs resets VmHWM of /proc/self/status,
+ * so the peak is taken per entry and not over the whole run
+ */
+void resetPeakRss() {
+#ifdef __linux__
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs.is_open()) {
+        clearRefs << "5";
+    }
+#endif
+}
+
+double getPeakRssMb() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::stod(line.substr(6)) / 1024.0;
+        }
+    }
+#endif
+    return 0.0;
+}
+
+void fillRandom(InferReqWrap &request, const InputsDataMap &inputs) {
+    std::mt19937 generator(0);
+    for (const auto &input : inputs) {
+        Blob::Ptr blob = request.getBlob(input.first);
+        if (blob->precision() == Precision::U8) {
+            std::uniform_int_distribution<int> distribution(0, 255);
+            auto data = blob->buffer().as<uint8_t *>();
+            for (size_t i = 0; i < blob->size(); i++) {
+                data[i] = static_cast<uint8_t>(distribution(generator));
+            }
+        } else if (blob->precision() == Precision::FP32) {
+            std::uniform_real_distribution<float> distribution(0.f, 1.f);
+            auto data = blob->buffer().as<float *>();
+            for (size_t i = 0; i < blob->size(); i++) {
+                data[i] = distribution(generator);
+            }
+        } else {
+            std::memset(blob->buffer().as<void *>(), 0, blob->byteSize());
+        }
+    }
+}
+
+std::string trim(const std::string &value) {
+    const auto begin = value.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    return value.substr(begin, value.find_last_not_of(" \t\r") - begin + 1);
+}
+
+/// @brief Reader of the JSON written by writeResults: an object with an array of the flat objects of the results
+class ResultsReader {
+public:
+    explicit ResultsReader(const std::string &text) : _text(text), _pos(0) {}
+
+    std::vector<SuiteResult> read() {
+        std::vector<SuiteResult> results;
+        expect('{');
+        while (!consume('}')) {
+            std::string key = readString();
+            expect(':');
+            if (key == "results") {
+                expect('[');
+                while (!consume(']')) {
+                    results.push_back(readResult());
+                    consume(',');
+                }
+            } else {
+                readValue();
+            }
+            consume(',');
+        }
+        return results;
+    }
+
+private:
+    SuiteResult readResult() {
+        SuiteResult result = {"", "", 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0};
+        expect('{');
+        while (!consume('}')) {
+            std::string key = readString();
+            expect(':');
+            std::string value = readValue();
+            if (key == "name") {
+                result.name = value;
+            } else if (key == "device") {
+                result.device = value;
+            } else if (key == "fps") {
+                result.fps = std::stod(value);
+            } else if (key == "latency_p50_ms") {
+                result.latencyP50 = std::stod(value);
+            } else if (key == "latency_p90_ms") {
+                result.latencyP90 = std::stod(value);
+            } else if (key == "latency_p99_ms") {
+                result.latencyP99 = std::stod(value);
+            } else if (key == "load_time_ms") {
+                result.loadTime = std::stod(value);
+            } else if (key == "peak_rss_mb") {
+                result.peakRssMb = std::stod(value);
+            } else if (key == "iterations") {
+                result.iterations = std::stoul(value);
+            }
+            consume(',');
+        }
+        return result;
+    }
+
+    void skipSpaces() {
+        while (_pos < _text.size() && std::isspace(static_cast<unsigned char>(_text[_pos]))) {
+            _pos++;
+        }
+    }
+
+    bool consume(char symbol) {
+        skipSpaces();
+        if (_pos < _text.size() && _text[_pos] == symbol) {
+            _pos++;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char symbol) {
+        if (!consume(symbol)) {
+            throw std::logic_error(std::string("Malformed results file: '") + symbol + "' is expected at " +
+                                   std::to_string(_pos));
+        }
+    }
+
+    std::string readString() {
+        expect('"');
+        std::string value;
+        while (_pos < _text.size() && _text[_pos] != '"') {
+            if (_text[_pos] == '\\') {
+                _pos++;
+            }
+            if (_pos < _text.size()) {
+                value += _text[_pos++];
+            }
+        }
+        expect('"');
+        return value;
+    }
+
+    /// @brief Reads a string or a number, the values of the other types are not written
+    std::string readValue() {
+        skipSpaces();
+        if (_pos < _text.size() && _text[_pos] == '"') {
+            return readString();
+        }
+        const size_t begin = _pos;
+        while (_pos < _text.size() && _text[_pos] != ',' && _text[_pos] != '}' && _text[_pos] != ']') {
+            _pos++;
+        }
+        return trim(_text.substr(begin, _pos - begin));
+    }
+
+    const std::string &_text;
+    size_t _pos;
+};
+
+std::string escape(const std::string &value) {
+    std::string escaped;
+    for (char symbol : value) {
+        if (symbol == '"' || symbol == '\\') {
+            escaped += '\\';
+        }
+        escaped += symbol;
+    }
+    return escaped;
+}
+
+}  // namespace
+
+std::vector<SuiteEntry> parseSuite(const std::string &path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Cannot open the suite file " + path);
+    }
+    const auto separator = path.find_last_of("/\\");
+    const std::string folder = separator == std::string::npos ? "" : path.substr(0, separator + 1);
+
+    std::vector<SuiteEntry> entries;
+    std::string line;
+    while (std::getline(file, line)) {
+        line = trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream stream(line);
+        std::string name, model, devices;
+        if (!(stream >> name >> model >> devices)) {
+            throw std::logic_error("The suite line \"" + line + "\" has no name, model or device");
+        }
+        if (model[0] != '/' && model[0] != '\\' && model.find(':') == std::string::npos) {
+            model = folder + model;
+        }
+
+        std::map<std::string, std::string> config;
+        std::string option;
+        while (stream >> option) {
+            const auto equal = option.find('=');
+            if (equal == std::string::npos) {
+                throw std::logic_error("The option \"" + option + "\" of the suite line \"" + line +
+                                       "\" is not <KEY>=<VALUE>");
+            }
+            config[option.substr(0, equal)] = option.substr(equal + 1);
+        }
+
+        // HETERO:<devices> keeps its devices together
+        std::vector<std::string> deviceList;
+        if (devices.find("HETERO:") == 0) {
+            deviceList.push_back(devices);
+        } else {
+            std::istringstream deviceStream(devices);
+            std::string device;
+            while (std::getline(deviceStream, device, ',')) {
+                deviceList.push_back(device);
+            }
+        }
+        for (const auto &device : deviceList) {
+            entries.push_back({name, model, device, config});
+        }
+    }
+    return entries;
+}
+
+SuiteRunner::SuiteRunner(Config config) : _config(std::move(config)) {}
+
+InferencePlugin &SuiteRunner::getPlugin(const std::string &device) {
+    auto found = _plugins.find(device);
+    if (found != _plugins.end()) {
+        return found->second;
+    }
+    InferencePlugin plugin = PluginDispatcher({ _config.pluginPath }).getPluginByDevice(device);
+    if (!_config.cpuExtension.empty() && device.find("CPU") != std::string::npos) {
+        plugin.AddExtension(make_so_pointer<IExtension>(_config.cpuExtension));
+    }
+    if (!_config.gpuKernels.empty() && device.find("GPU") != std::string::npos) {
+        plugin.SetConfig({ {CONFIG_KEY(CONFIG_FILE), _config.gpuKernels} });
+    }
+    slog::info << device << ": " << plugin.GetVersion() << slog::endl;
+    return _plugins.emplace(device, plugin).first->second;
+}
+
+SuiteResult SuiteRunner::run(const SuiteEntry &entry) {
+    SuiteResult result = {entry.name, entry.device, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0};
+    InferencePlugin &plugin = getPlugin(entry.device);
+    resetPeakRss();
+
+    const auto loadStart = Time::now();
+    CNNNetReader reader;
+    reader.ReadNetwork(entry.model);
+    reader.ReadWeights(fileNameNoExt(entry.model) + ".bin");
+    CNNNetwork network = reader.getNetwork();
+    const InputsDataMap inputs = network.getInputsInfo();
+    for (const auto &input : inputs) {
+        // the images are fed as U8 like in the benchmark application
+        if (input.second->getTensorDesc().getDims().size() == 4) {
+            input.second->setPrecision(Precision::U8);
+        }
+    }
+    ExecutableNetwork exeNetwork = plugin.LoadNetwork(network, entry.config);
+    result.loadTime = elapsedMs(loadStart, Time::now());
+
+    std::vector<InferReqWrap::Ptr> requests;
+    for (size_t i = 0; i < std::max<size_t>(_config.nireq, 1); i++) {
+        requests.push_back(std::make_shared<InferReqWrap>(exeNetwork, i));
+        fillRandom(*requests.back(), inputs);
+    }
+
+    // warming up - out of scope
+    requests[0]->infer();
+
+    std::vector<double> latencies;
+    double totalDuration = 0.0;
+    {
+        InferRequestsQueue queue(requests);
+        const auto startTime = Time::now();
+        const auto duration = std::chrono::duration_cast<Time::duration>(
+                std::chrono::duration<double>(_config.seconds));
+        while (Time::now() - startTime < duration) {
+            queue.getIdleRequest()->startAsync();
+            result.iterations++;
+        }
+        queue.waitAll();
+        totalDuration = elapsedMs(startTime, Time::now());
+        for (const auto &completion : queue.takeCompletions()) {
+            latencies.push_back(elapsedMs(completion.start, completion.end));
+        }
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    result.fps = totalDuration > 0 ? network.getBatchSize() * 1000.0 * result.iterations / totalDuration : 0.0;
+    result.latencyP50 = percentile(latencies, 50);
+    result.latencyP90 = percentile(latencies, 90);
+    result.latencyP99 = percentile(latencies, 99);
+    result.peakRssMb = getPeakRssMb();
+    return result;
+}
+
+void writeResults(const std::string &path, const std::vector<SuiteResult> &results) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Cannot open the results file " + path);
+    }
+    file << std::fixed << std::setprecision(3);
+    file << "{\n    \"inference_engine\": \"" << escape(GetInferenceEngineVersion()->buildNumber) << "\",\n";
+    file << "    \"results\": [";
+    const char *separator = "\n";
+    for (const auto &result : results) {
+        file << separator << "        {\"name\": \"" << escape(result.name) << "\", \"device\": \"" <<
+             escape(result.device) << "\", \"fps\": " << result.fps << ", \"latency_p50_ms\": " << result.latencyP50 <<
+             ", \"latency_p90_ms\": " << result.latencyP90 << ", \"latency_p99_ms\": " << result.latencyP99 <<
+             ", \"load_time_ms\": " << result.loadTime << ", \"peak_rss_mb\": " << result.peakRssMb <<
+             ", \"iterations\": " << result.iterations << "}";
+        separator = ",\n";
+    }
+    file << "\n    ]\n}" << std::endl;
+    slog::info << "results are stored to " << path << slog::endl;
+}
+
+std::vector<SuiteResult> readResults(const std::string &path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Cannot open the results file " + path);
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text = buffer.str();
+    return ResultsReader(text).read();
+}
+
+size_t compareResults(const std::vector<SuiteResult> &baseline, const std::vector<SuiteResult> &current,
+                      double threshold) {
+    struct Metric {
+        const char *name;
+        double SuiteResult::*value;
+        bool higherIsBetter;
+    };
+    static const Metric metrics[] = {
+        {"FPS", &SuiteResult::fps, true},
+        {"p50, ms", &SuiteResult::latencyP50, false},
+        {"p90, ms", &SuiteResult::latencyP90, false},
+        {"p99, ms", &SuiteResult::latencyP99, false},
+        {"load, ms", &SuiteResult::loadTime, false},
+        {"peak RSS, MB", &SuiteResult::peakRssMb, false},
+    };
+
+    size_t regressions = 0;
+    std::cout << std::endl << "Comparison with the baseline, the changes beyond " << threshold <<
+              "% are marked" << std::endl;
+    std::cout << std::setw(32) << std::left << "model" << std::setw(14) << "metric" << std::right << std::setw(14) <<
+              "baseline" << std::setw(14) << "current" << std::setw(10) << "change" << std::endl;
+    for (const auto &result : current) {
+        auto found = std::find_if(baseline.begin(), baseline.end(), [&result](const SuiteResult &other) {
+            return other.name == result.name && other.device == result.device;
+        });
+        const std::string model = result.name + " " + result.device;
+        if (found == baseline.end()) {
+            std::cout << std::setw(32) << std::left << model << "is not in the baseline" << std::right << std::endl;
+            continue;
+        }
+        for (const auto &metric : metrics) {
+            const double before = (*found).*metric.value;
+            const double after = result.*metric.value;
+            if (before <= 0.0 || after <= 0.0) {
+                // not measured on this OS
+                continue;
+            }
+            const double change = (after - before) / before * 100.0;
+            const bool regressed = metric.higherIsBetter ? change < -threshold : change > threshold;
+            const bool improved = metric.higherIsBetter ? change > threshold : change < -threshold;
+            if (regressed) {
+                regressions++;
+            }
+            std::cout << std::setw(32) << std::left << model << std::setw(14) << metric.name << std::right <<
+                      std::fixed << std::setprecision(2) << std::setw(14) << before << std::setw(14) << after <<
+                      std::setw(9) << std::showpos << change << "%" << std::noshowpos << std::defaultfloat <<
+                      (regressed ? "  REGRESSION" : improved ? "  improved" : "") << std::endl;
+        }
+    }
+    for (const auto &result : baseline) {
+        auto found = std::find_if(current.begin(), current.end(), [&result](const SuiteResult &other) {
+            return other.name == result.name && other.device == result.device;
+        });
+        if (found == current.end()) {
+            std::cout << std::setw(32) << std::left << (result.name + " " + result.device) <<
+                      "is not measured" << std::right << std::endl;
+        }
+    }
+    return regressions;
+}
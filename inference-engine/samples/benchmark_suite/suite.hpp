@@ -0,0 +1,73 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+/// @brief Model of the suite measured on one device
+struct SuiteEntry {
+    std::string name;
+    std::string model;
+    std::string device;
+    // passed to LoadNetwork, e.g. the streams or the threads of the CPU
+    std::map<std::string, std::string> config;
+};
+
+/// @brief Measured performance of a suite entry, the results are matched by the name and the device
+struct SuiteResult {
+    std::string name;
+    std::string device;
+    double fps;
+    double latencyP50;
+    double latencyP90;
+    double latencyP99;
+    // reading of the IR and LoadNetwork
+    double loadTime;
+    // peak resident memory of the process while the entry is measured, 0 if it is unknown on the OS
+    double peakRssMb;
+    size_t iterations;
+};
+
+/// @brief Reads the suite file, an entry is made for every device of a line
+std::vector<SuiteEntry> parseSuite(const std::string &path);
+
+/// @brief Loads the networks of the entries to the plugins of their devices and measures them
+class SuiteRunner {
+public:
+    struct Config {
+        std::string pluginPath;
+        std::string cpuExtension;
+        std::string gpuKernels;
+        double seconds;
+        size_t nireq;
+    };
+
+    explicit SuiteRunner(Config config);
+
+    SuiteResult run(const SuiteEntry &entry);
+
+private:
+    InferenceEngine::InferencePlugin &getPlugin(const std::string &device);
+
+    Config _config;
+    std::map<std::string, InferenceEngine::InferencePlugin> _plugins;
+};
+
+void writeResults(const std::string &path, const std::vector<SuiteResult> &results);
+
+std::vector<SuiteResult> readResults(const std::string &path);
+
+/**
+ * @brief Compares the results with the baseline ones and prints the changes of the metrics
+ * @param threshold - change in percents of a metric which is a regression: the lower throughput or the higher
+ * latencies, load time and memory
+ * @return the number of the regressed metrics
+ */
+size_t compareResults(const std::vector<SuiteResult> &baseline, const std::vector<SuiteResult> &current,
+                      double threshold);
@@ -124,7 +124,8 @@ float Int8Calibrator::compare_NRMSD(InferenceEngine::Blob::Ptr res, InferenceEng
 }
 
 
-InferenceEngine::NetworkStatsMap Int8Calibrator::getStatistic(float threshold) {
+InferenceEngine::NetworkStatsMap Int8Calibrator::aggregateStatistic(
+        const std::function<void(const std::string &, size_t, float &, float &)> &getMinMax) {
     InferenceEngine::NetworkStatsMap netNodesStats;
     // go over all outputs and get aggregated statistics
     for (auto l : _statData.registeredLayers()) {
@@ -138,12 +139,24 @@ InferenceEngine::NetworkStatsMap Int8Calibrator::getStatistic(float threshold) {
             nodeStats = netNodesStats[l];
         }
         for (size_t c = 0; c < channels; c++) {
-            _statData.getDataMinMax(l, c, nodeStats->_minOutputs[c], nodeStats->_maxOutputs[c], threshold);
+            getMinMax(l, c, nodeStats->_minOutputs[c], nodeStats->_maxOutputs[c]);
         }
     }
     return netNodesStats;
 }
 
+InferenceEngine::NetworkStatsMap Int8Calibrator::getStatistic(float threshold) {
+    return aggregateStatistic([&](const std::string &layer, size_t channel, float &min, float &max) {
+        _statData.getDataMinMax(layer, channel, min, max, threshold);
+    });
+}
+
+InferenceEngine::NetworkStatsMap Int8Calibrator::getStatisticKL() {
+    return aggregateStatistic([&](const std::string &layer, size_t channel, float &min, float &max) {
+        _statData.getDataMinMaxKL(layer, channel, min, max);
+    });
+}
+
 
 void Int8Calibrator::collectFP32Statistic() {
     _collectByLayer = false;
@@ -482,32 +495,20 @@ void Int8Calibrator::collectCalibrationStatistic(size_t pics) {
                 continue;
             }
 
-            // Counting min/max outputs per channel
-            for (size_t n = 0; n < N; n++) {
-                if (outBlob->dims().size() == 4) {
-                    size_t _HW = outBlob->dims()[0] * outBlob->dims()[1];
-                    for (size_t c = 0; c < C; c++) {
-                        if (outBlob->getTensorDesc().getPrecision() == Precision::FP32) {
-                            float *ptr = &outBlob->buffer().as<float *>()[(n * C + c) * _HW];
-                            _statData.addTensorStatistics(outName, c, ptr, _HW);
-                        } else if (outBlob->getTensorDesc().getPrecision() == Precision::U8) {
-                            uint8_t *ptr = &outBlob->buffer().as<uint8_t *>()[(n * C + c) * _HW];
-                            _statData.addTensorStatistics(outName, c, ptr, _HW);
-                        } else {
-                            throw std::logic_error(std::string("Unsupported precision: ") + outBlob->getTensorDesc().getPrecision().name());
-                        }
-                    }
-                } else if (outBlob->dims().size() == 2) {
-                    if (outBlob->getTensorDesc().getPrecision() == Precision::FP32) {
-                        float *ptr = &outBlob->buffer().as<float *>()[n * C];
-                        _statData.addTensorStatistics(outName, 0, ptr, C);
-                    } else if (outBlob->getTensorDesc().getPrecision() == Precision::U8) {
-                        uint8_t *ptr = &outBlob->buffer().as<uint8_t *>()[n * C];
-                        _statData.addTensorStatistics(outName, 0, ptr, C);
-                    } else {
-                        throw std::logic_error(std::string("Unsupported precision: ") + outBlob->getTensorDesc().getPrecision().name());
-                    }
-                }
+            // Counting min/max outputs per channel, the 2D outputs are one channel of C values
+            size_t channels = C, size = 1;
+            if (outBlob->dims().size() == 4) {
+                size = outBlob->dims()[0] * outBlob->dims()[1];
+            } else {
+                channels = 1;
+                size = C;
+            }
+            if (outBlob->getTensorDesc().getPrecision() == Precision::FP32) {
+                _statData.addBlobStatistics(outName, outBlob->buffer().as<float *>(), N, channels, size);
+            } else if (outBlob->getTensorDesc().getPrecision() == Precision::U8) {
+                _statData.addBlobStatistics(outName, outBlob->buffer().as<uint8_t *>(), N, channels, size);
+            } else {
+                throw std::logic_error(std::string("Unsupported precision: ") + outBlob->getTensorDesc().getPrecision().name());
             }
         }
     }
@@ -12,6 +12,7 @@
 #include "data_stats.h"
 #include <map>
 #include <memory>
+#include <functional>
 
 /**
  * Calibrator class representing unified stages for calibration of any kind of networks
@@ -81,12 +82,22 @@ public:
      */
     InferenceEngine::NetworkStatsMap getStatistic(float threshold);
 
+    /**
+     * Statistic collected in the collectFP32Statistic is clipped by the thresholds which minimize the KL divergence
+     * of the activation histograms of the layers and of their quantized versions
+     * @return InferenceEngine::NetworkStatsMap - mapping of layer name to NetworkNodeStatsPtr
+     */
+    InferenceEngine::NetworkStatsMap getStatisticKL();
+
     /**
      * returns by-layer accuracy drop container
      */
     std::map<std::string, float> layersAccuracyDrop();
 
 protected:
+    InferenceEngine::NetworkStatsMap aggregateStatistic(
+            const std::function<void(const std::string &, size_t, float &, float &)> &getMinMax);
+
     /**
      * This function should be called from final callibrator after and each Infer for each picture
      * It calculates by layer accuracy drop and as well it also collect activation values statistic
@@ -6,34 +6,77 @@
 #include <cfloat>
 #include <cmath>
 #include <stdint.h>
+#include <atomic>
 #include <iostream>
 #include <limits>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <algorithm>
 #include <string>
 
 #include "data_stats.h"
 
+// the tensors below it are processed by the calling thread, starting the threads costs more
+static const size_t parallelWork = 256 * 1024;
+static const size_t histogramChunk = 64 * 1024;
 
-TensorStatistic::TensorStatistic(float* data, size_t count, size_t nbuckets) {
-    _min = std::numeric_limits<float>::max();
-    _max = std::numeric_limits<float>::min();
-    for (size_t i = 0; i < count; i++) {
-        float val = static_cast<float>(data[i]);
-        if (_min > val) {
-            _min = val;
-        }
+template <typename F>
+static void parallelFor(size_t count, size_t work, const F &func) {
+    const size_t threads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), count);
+    if (work < parallelWork || threads <= 1) {
+        for (size_t i = 0; i < count; i++)
+            func(i);
+        return;
+    }
 
-        if (_max < val) {
-            _max = val;
+    std::atomic<size_t> next(0);
+    auto worker = [&] {
+        for (size_t i = next++; i < count; i = next++)
+            func(i);
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; t++)
+        pool.emplace_back(worker);
+    worker();
+    for (auto &thread : pool)
+        thread.join();
+}
+
+// the lanes are independent, so the compiler vectorizes the loop
+template <typename T>
+static void minMax(const T* data, size_t count, float &min, float &max) {
+    const size_t lanes = 16;
+    size_t i = 0;
+    if (count >= lanes) {
+        T laneMin[lanes], laneMax[lanes];
+        for (size_t k = 0; k < lanes; k++)
+            laneMin[k] = laneMax[k] = data[k];
+        for (i = lanes; i + lanes <= count; i += lanes) {
+            for (size_t k = 0; k < lanes; k++) {
+                T val = data[i + k];
+                laneMin[k] = val < laneMin[k] ? val : laneMin[k];
+                laneMax[k] = val > laneMax[k] ? val : laneMax[k];
+            }
+        }
+        for (size_t k = 0; k < lanes; k++) {
+            min = std::min(min, static_cast<float>(laneMin[k]));
+            max = std::max(max, static_cast<float>(laneMax[k]));
         }
     }
-
-    if (_min == _max) {
-        return;
+    for (; i < count; i++) {
+        float val = static_cast<float>(data[i]);
+        min = std::min(min, val);
+        max = std::max(max, val);
     }
 }
 
+TensorStatistic::TensorStatistic(float* data, size_t count, size_t nbuckets) {
+    _min = std::numeric_limits<float>::max();
+    _max = std::numeric_limits<float>::lowest();
+    minMax(data, count, _min, _max);
+}
+
 float TensorStatistic::getMaxValue() const {
     return _max;
 }
@@ -43,9 +86,103 @@ float TensorStatistic::getMinValue() const {
     return _min;
 }
 
+const size_t AbsHistogram::bins;
+
+void AbsHistogram::extend(float absMax) {
+    if (!(absMax > 0.f))
+        return;
+    if (_counts.empty()) {
+        _binWidth = absMax / bins;
+        _counts.assign(bins, 0);
+        return;
+    }
+    // the values at the range end go to the last bin
+    while (absMax > _binWidth * bins) {
+        for (size_t i = 0; i < bins / 2; i++)
+            _counts[i] = _counts[2 * i] + _counts[2 * i + 1];
+        std::fill(_counts.begin() + bins / 2, _counts.end(), 0);
+        _binWidth *= 2;
+    }
+}
+
+template <typename T>
+void AbsHistogram::add(const T* data, size_t count, std::vector<uint64_t> &counts) const {
+    if (_counts.empty())
+        return;
+    const float scale = 1.f / _binWidth;
+    for (size_t i = 0; i < count; i++) {
+        const float bin = std::fabs(static_cast<float>(data[i])) * scale;
+        counts[bin < bins - 1 ? static_cast<size_t>(bin) : bins - 1]++;
+    }
+}
+
+void AbsHistogram::merge(const std::vector<uint64_t> &counts) {
+    for (size_t i = 0; i < _counts.size(); i++)
+        _counts[i] += counts[i];
+}
+
+float AbsHistogram::klThreshold(size_t levels) const {
+    uint64_t total = 0;
+    size_t last = 0;
+    for (size_t i = 0; i < _counts.size(); i++) {
+        total += _counts[i];
+        if (_counts[i] != 0)
+            last = i + 1;
+    }
+    if (total == 0 || last <= levels)
+        return _binWidth * last;
+
+    std::vector<double> p(last), q(last);
+    double bestDivergence = std::numeric_limits<double>::max();
+    size_t bestBins = last;
+    // the outliers above the first i bins are clipped to the last of them
+    uint64_t outliers = total;
+    for (size_t i = 0; i < levels; i++)
+        outliers -= _counts[i];
+    for (size_t i = levels; i <= last; i++) {
+        outliers -= _counts[i - 1];
+        for (size_t j = 0; j < i; j++)
+            p[j] = static_cast<double>(_counts[j]);
+        p[i - 1] += static_cast<double>(outliers);
+
+        // the quantized distribution of the bins without the outliers spreads every level evenly
+        // over the bins which are not empty in the reference one
+        for (size_t level = 0; level < levels; level++) {
+            const size_t begin = level * i / levels, end = (level + 1) * i / levels;
+            double sum = 0;
+            size_t nonEmpty = 0;
+            for (size_t j = begin; j < end; j++) {
+                sum += static_cast<double>(_counts[j]);
+                nonEmpty += p[j] != 0;
+            }
+            for (size_t j = begin; j < end; j++)
+                q[j] = p[j] != 0 ? sum / nonEmpty : 0.0;
+        }
+
+        double pSum = 0, qSum = 0;
+        for (size_t j = 0; j < i; j++) {
+            pSum += p[j];
+            qSum += q[j];
+        }
+        double divergence = 0;
+        for (size_t j = 0; j < i; j++) {
+            if (p[j] == 0)
+                continue;
+            // a bin the quantized distribution misses costs as much as a tiny probability of it
+            const double pj = p[j] / pSum, qj = std::max(q[j] / qSum, 1e-12);
+            divergence += pj * std::log(pj / qj);
+        }
+        if (divergence < bestDivergence) {
+            bestDivergence = divergence;
+            bestBins = i;
+        }
+    }
+    return _binWidth * (bestBins + 0.5f);
+}
+
 std::vector<std::string> AggregatedDataStats::registeredLayers() {
     std::vector<std::string> layers;
-    for (auto l : _data) {
+    for (auto &l : _data) {
         layers.push_back(l.first);
     }
     return layers;
@@ -56,22 +193,71 @@ void AggregatedDataStats::registerLayer(std::string layer) {
 }
 
 void AggregatedDataStats::addTensorStatistics(const std::string& name, size_t channel, float* data, size_t count) {
-    auto&& byChannel = _data[name];
+    auto&& byChannel = _data[name].byChannel;
     byChannel[channel].push_back(TensorStatistic(data, count));
 }
 
 void AggregatedDataStats::addTensorStatistics(const std::string &name, size_t channel, uint8_t *data, size_t count) {
-    std::vector<float> intermediate;
-    for (size_t i = 0; i < count; i++) {
-        intermediate.push_back(data[i]);
+    float min = std::numeric_limits<float>::max();
+    float max = std::numeric_limits<float>::lowest();
+    minMax(data, count, min, max);
+    _data[name].byChannel[channel].push_back(TensorStatistic(min, max));
+}
+
+template <typename T>
+void AggregatedDataStats::addBlob(const std::string &name, const T *data, size_t images, size_t channels, size_t size) {
+    LayerStatistic &layer = _data[name];
+    std::vector<std::vector<TensorStatistic>*> byChannel(channels);
+    for (size_t c = 0; c < channels; c++)
+        byChannel[c] = &layer.byChannel[c];
+
+    std::vector<float> mins(images * channels, std::numeric_limits<float>::max());
+    std::vector<float> maxs(images * channels, std::numeric_limits<float>::lowest());
+    parallelFor(images * channels, images * channels * size, [&](size_t i) {
+        minMax(data + i * size, size, mins[i], maxs[i]);
+    });
+
+    float absMax = 0.f;
+    for (size_t n = 0; n < images; n++) {
+        for (size_t c = 0; c < channels; c++) {
+            const size_t i = n * channels + c;
+            byChannel[c]->push_back(TensorStatistic(mins[i], maxs[i]));
+            absMax = std::max(absMax, std::max(std::fabs(mins[i]), std::fabs(maxs[i])));
+        }
     }
-    addTensorStatistics(name, channel, intermediate.data(), count);
+
+    layer.histogram.extend(absMax);
+    layer.klThreshold = -1.f;
+    if (layer.histogram.empty())
+        return;
+
+    // every chunk is counted into its own bins, which are merged then
+    const size_t total = images * channels * size;
+    const size_t chunks = (total + histogramChunk - 1) / histogramChunk;
+    std::mutex mergeMutex;
+    parallelFor(chunks, total, [&](size_t chunk) {
+        const size_t begin = chunk * histogramChunk;
+        std::vector<uint64_t> counts(AbsHistogram::bins, 0);
+        layer.histogram.add(data + begin, std::min(histogramChunk, total - begin), counts);
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        layer.histogram.merge(counts);
+    });
+}
+
+void AggregatedDataStats::addBlobStatistics(const std::string &name, const float *data,
+                                            size_t images, size_t channels, size_t size) {
+    addBlob(name, data, images, channels, size);
+}
+
+void AggregatedDataStats::addBlobStatistics(const std::string &name, const uint8_t *data,
+                                            size_t images, size_t channels, size_t size) {
+    addBlob(name, data, images, channels, size);
 }
 
 size_t AggregatedDataStats::getNumberChannels(const std::string& name) const {
     auto it = _data.find(name);
     if (it != _data.end()) {
-        return it->second.size();
+        return it->second.byChannel.size();
     }
     return 0;
 }
@@ -79,11 +265,13 @@ size_t AggregatedDataStats::getNumberChannels(const std::string& name) const {
 void AggregatedDataStats::getDataMinMax(const std::string& name, size_t channel, float& min, float& max, float threshold) {
     // take data by name
     auto it = _data.find(name);
-    if (it != _data.end()) {
-        auto stats = it->second[channel];
+    if (it != _data.end() && !it->second.byChannel[channel].empty()) {
+        const std::vector<TensorStatistic> &stats = it->second.byChannel[channel];
         // having absolute min/max values, we can create new statistic
         std::vector<float> maxValues;
         std::vector<float> minValues;
+        maxValues.reserve(stats.size());
+        minValues.reserve(stats.size());
         for (size_t i = 0; i < stats.size(); i++) {
             const TensorStatistic& tsS = stats[i];
             maxValues.push_back(tsS.getMaxValue());
@@ -91,9 +279,11 @@ void AggregatedDataStats::getDataMinMax(const std::string& name, size_t channel,
         }
         // define number of elements to throw out
         size_t elementToTake = static_cast<size_t>(maxValues.size() * (threshold / 100));
-        int elementsToThrow = maxValues.size() - elementToTake;
-        std::sort(maxValues.begin(), maxValues.end());
-        std::sort(minValues.begin(), minValues.end());
+        elementToTake = std::max<size_t>(1, std::min(elementToTake, maxValues.size()));
+        size_t elementsToThrow = maxValues.size() - elementToTake;
+        // only the order statistics are needed, not the whole sorted arrays
+        std::nth_element(maxValues.begin(), maxValues.begin() + (elementToTake - 1), maxValues.end());
+        std::nth_element(minValues.begin(), minValues.begin() + elementsToThrow, minValues.end());
 
         min = minValues[elementsToThrow];
         max = maxValues[elementToTake - 1];
@@ -102,3 +292,14 @@ void AggregatedDataStats::getDataMinMax(const std::string& name, size_t channel,
     }
 }
 
+void AggregatedDataStats::getDataMinMaxKL(const std::string& name, size_t channel, float& min, float& max) {
+    getDataMinMax(name, channel, min, max, 100.f);
+    auto it = _data.find(name);
+    if (it == _data.end() || it->second.histogram.empty())
+        return;
+    if (it->second.klThreshold < 0.f)
+        it->second.klThreshold = it->second.histogram.klThreshold();
+    const float threshold = it->second.klThreshold;
+    min = std::max(min, -threshold);
+    max = std::min(max, threshold);
+}
@@ -7,9 +7,11 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <cstdint>
 
 struct TensorStatistic {
     TensorStatistic(float* data, size_t count, size_t nbuckets = 1000);
+    TensorStatistic(float min, float max) : _min(min), _max(max) {}
     float getMaxValue() const;
     float getMinValue()const;
 protected:
@@ -17,15 +19,71 @@ protected:
     float _max;
 };
 
+/**
+ * @brief Streaming histogram of the absolute values of a layer. When a value exceeds the range, the range is doubled
+ * by merging the neighbour bins, so the memory and the cost do not depend on the number of the images
+ */
+class AbsHistogram {
+public:
+    static const size_t bins = 2048;
+
+    /**
+     * @brief Widens the range to hold the values up to absMax, must be called before add() of such values
+     */
+    void extend(float absMax);
+
+    template <typename T>
+    void add(const T* data, size_t count, std::vector<uint64_t> &counts) const;
+
+    void merge(const std::vector<uint64_t> &counts);
+
+    /**
+     * @brief The threshold which quantization to the given number of levels loses the least information:
+     * the Kullback-Leibler divergence of the clipped histogram and its quantized version is minimal
+     */
+    float klThreshold(size_t levels = 128) const;
+
+    bool empty() const {
+        return _counts.empty();
+    }
+
+private:
+    float _binWidth = 0.f;
+    std::vector<uint64_t> _counts;
+};
+
 class AggregatedDataStats {
 public:
     void addTensorStatistics(const std::string& name, size_t channel, float* data, size_t count);
     void addTensorStatistics(const std::string &name, size_t channel, uint8_t *data, size_t count);
+
+    /**
+     * @brief Adds the min and max of every channel of every image of the data laid out as [images][channels][size]
+     * and the values to the histogram of the layer, the channels are processed in parallel
+     */
+    void addBlobStatistics(const std::string &name, const float *data, size_t images, size_t channels, size_t size);
+    void addBlobStatistics(const std::string &name, const uint8_t *data, size_t images, size_t channels, size_t size);
+
     void getDataMinMax(const std::string& name, size_t channel, float& min, float& max, float threshold);
+
+    /**
+     * @brief Gives the min and max of the channel clipped by the KL threshold of the layer histogram
+     */
+    void getDataMinMaxKL(const std::string& name, size_t channel, float& min, float& max);
+
     size_t getNumberChannels(const std::string& name) const;
     std::vector <std::string> registeredLayers();
     void registerLayer(std::string layer);
 protected:
-    std::map<std::string, std::map<size_t, std::vector<TensorStatistic> > > _data;
-};
+    struct LayerStatistic {
+        std::map<size_t, std::vector<TensorStatistic> > byChannel;
+        AbsHistogram histogram;
+        // the KL threshold is computed once for all the channels of the layer
+        float klThreshold = -1.f;
+    };
 
+    template <typename T>
+    void addBlob(const std::string &name, const T *data, size_t images, size_t channels, size_t size);
+
+    std::map<std::string, LayerStatistic> _data;
+};
@@ -124,6 +124,14 @@ static const char number_of_pictures_message[] = "Number of pictures from the wh
                                                  "the whole provided dataset";
 static const char output_model_name[] = "Output name for calibrated model. Default is <original_model_name>_i8.xml|bin";
 
+static const char search_message[] = "Search of the layers returned to FP32 when the accuracy drop of the network"
+                                     " with all Int8 layers is above the threshold. Options: \"sequential\" (default)"
+                                     " returns the most sensitive layers one by one, \"binary\" bisects the number"
+                                     " of the most sensitive layers to be returned";
+static const char sensitivity_message[] = "Path to a file caching the per-layer accuracy drop. If the file exists,"
+                                          " the drop is read from it instead of the per-layer validation, otherwise"
+                                          " the collected drop is written to it";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 /// @brief Define parameter for a path to images <br>
@@ -192,6 +200,10 @@ DEFINE_string(lbl, "", labels_file_message);
 
 DEFINE_bool(convert_fc, false, convert_fc_message);
 
+DEFINE_string(search, "sequential", search_message);
+
+DEFINE_string(sensitivity, "", sensitivity_message);
+
 /**
  * @brief This function shows a help message
  */
@@ -220,6 +232,8 @@ static void showUsage() {
     std::cout << "    -subset                  " << number_of_pictures_message << std::endl;
     std::cout << "    -output <output_IR>      " << output_model_name << std::endl;
     std::cout << "    -threshold               " << accuracy_threshold_message << std::endl;
+    std::cout << "    -search <type>           " << search_message << std::endl;
+    std::cout << "    -sensitivity <path>      " << sensitivity_message << std::endl;
 
     std::cout << std::endl;
     std::cout << "    Classification-specific options:" << std::endl;
@@ -297,6 +311,43 @@ void SaveCalibratedIR(const std::string &originalName,
     networkReader.getNetwork().serialize(outModelName + ".xml", outModelName + ".bin");
 }
 
+/**
+ * @brief Reads the per-layer accuracy drop written by writeLayersAccuracyDrop
+ * @return false if the file cannot be opened
+ */
+bool readLayersAccuracyDrop(const std::string &fileName, std::map<std::string, float> &layersAccuracyDrop) {
+    std::ifstream file(fileName);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t separator = line.rfind('\t');
+        if (line.empty() || line[0] == '#' || separator == std::string::npos) {
+            continue;
+        }
+        layersAccuracyDrop[line.substr(0, separator)] = std::stof(line.substr(separator + 1));
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the per-layer accuracy drop as "<layer name>\t<drop>" lines
+ */
+void writeLayersAccuracyDrop(const std::string &fileName, const std::string &modelName,
+                             const std::map<std::string, float> &layersAccuracyDrop) {
+    std::ofstream file(fileName);
+    if (!file.is_open()) {
+        slog::warn << "Cannot write the per-layer accuracy drop to " << fileName << slog::endl;
+        return;
+    }
+    file << "# per-layer accuracy drop of " << modelName << std::endl;
+    file << std::setprecision(std::numeric_limits<float>::max_digits10);
+    for (auto &&drop : layersAccuracyDrop) {
+        file << drop.first << '\t' << drop.second << std::endl;
+    }
+}
+
 /**
  * @brief The main function of inference engine sample application
  * @param argc - The number of arguments
@@ -340,6 +391,10 @@ int main(int argc, char *argv[]) {
         if (FLAGS_d.empty()) ee << UserException(5, "Target device is not specified (missing -d option)");
         if (FLAGS_b < 0) ee << UserException(6, "Batch must be positive (invalid -b option value)");
 
+        if (FLAGS_search != "sequential" && FLAGS_search != "binary") {
+            ee << UserException(7, "Unknown search type specified (invalid -search option)");
+        }
+
         if (netType == ObjDetection) {
             // Checking required OD-specific options
             if (FLAGS_ODa.empty()) ee << UserException(11, "Annotations folder is not specified for object detection (missing -a option)");
@@ -458,43 +513,106 @@ int main(int argc, char *argv[]) {
                 std::cout << "   Accuracy is " << OUTPUT_FLOATING(100.0 * mI8->AccuracyResult) << "%" << std::endl;
             }
 
-            statMap = calibrator->getStatistic(bestThreshold);
+            bool bestKL = false;
+            {
+                std::cout << "Validate int8 accuracy, KL divergence thresholds for activation statistics" << std::endl;
+                InferenceEngine::NetworkStatsMap tmpStatMap = calibrator->getStatisticKL();
+                calibrator->validateInt8Config(tmpStatMap, {}, FLAGS_convert_fc);
+                shared_ptr<Processor::InferenceMetrics> pIM_I8 = processor->Process(FLAGS_stream_output);
+                const CalibrationMetrics *mI8 = dynamic_cast<const CalibrationMetrics *>(pIM_I8.get());
+                if (maximalAccuracy < mI8->AccuracyResult) {
+                    maximalAccuracy = mI8->AccuracyResult;
+                    bestKL = true;
+                }
+                std::cout << "   Accuracy is " << OUTPUT_FLOATING(100.0 * mI8->AccuracyResult) << "%" << std::endl;
+            }
+
+            statMap = bestKL ? calibrator->getStatisticKL() : calibrator->getStatistic(bestThreshold);
 
             if ((mFP32->AccuracyResult - maximalAccuracy) > (FLAGS_threshold / 100)) {
                 slog::info << "Accuracy of all layers conversion does not correspond to the required threshold\n";
                 cout << "FP32 Accuracy: " << OUTPUT_FLOATING(100.0 * mFP32->AccuracyResult) << "% vs " <<
                     "all Int8 layers Accuracy: " << OUTPUT_FLOATING(100.0 * maximalAccuracy) << "%, " <<
                     "threshold for activation statistics: " << bestThreshold << "%" << std::endl;
-                slog::info << "Collecting intermediate per-layer accuracy drop" << slog::endl;
                 // getting statistic on accuracy drop by layers
-                calibrator->collectByLayerStatistic(statMap);
-                processor->Process(FLAGS_stream_output);
+                std::map<std::string, float> layersAccuracyDrop;
+                if (!FLAGS_sensitivity.empty() && readLayersAccuracyDrop(FLAGS_sensitivity, layersAccuracyDrop)) {
+                    slog::info << "Per-layer accuracy drop is read from " << FLAGS_sensitivity << slog::endl;
+                } else {
+                    slog::info << "Collecting intermediate per-layer accuracy drop" << slog::endl;
+                    calibrator->collectByLayerStatistic(statMap);
+                    processor->Process(FLAGS_stream_output);
+                    layersAccuracyDrop = calibrator->layersAccuracyDrop();
+                    if (!FLAGS_sensitivity.empty()) {
+                        writeLayersAccuracyDrop(FLAGS_sensitivity, FLAGS_m, layersAccuracyDrop);
+                    }
+                }
                 // starting to reduce number of layers being converted to Int8
-                std::map<std::string, float>  layersAccuracyDrop = calibrator->layersAccuracyDrop();
-
                 std::map<float, std::string> orderedLayersAccuracyDrop;
                 for (auto d : layersAccuracyDrop) {
                     orderedLayersAccuracyDrop[d.second] = d.first;
                     layersToInt8[d.first] = true;
                 }
-                std::map<float, std::string>::const_reverse_iterator it = orderedLayersAccuracyDrop.crbegin();
+                // the most sensitive layers go first
+                std::vector<std::string> orderedLayers;
+                for (auto it = orderedLayersAccuracyDrop.crbegin(); it != orderedLayersAccuracyDrop.crend(); it++) {
+                    orderedLayers.push_back(it->second);
+                }
 
-                shared_ptr<Processor::InferenceMetrics> pIM_I8;
-                const CalibrationMetrics *mI8;
-                while (it != orderedLayersAccuracyDrop.crend() && bAccuracy == false) {
-                    slog::info << "Returning of '" << it->second << "' to FP32 precision, start validation\n";
-                    layersToInt8[it->second] = false;
+                // validates the configuration with the given number of the most sensitive layers returned to FP32,
+                // the accuracy of each validated configuration is kept for the following steps of the search
+                std::map<size_t, float> validatedAccuracy;
+                auto validateFP32Layers = [&](size_t fp32Layers) -> float {
+                    auto validated = validatedAccuracy.find(fp32Layers);
+                    if (validated != validatedAccuracy.end()) {
+                        return validated->second;
+                    }
+                    for (size_t l = 0; l < orderedLayers.size(); l++) {
+                        layersToInt8[orderedLayers[l]] = l >= fp32Layers;
+                    }
+                    slog::info << "Returning of " << fp32Layers << " most sensitive layers to FP32 precision, start validation\n";
                     calibrator->validateInt8Config(statMap, layersToInt8, FLAGS_convert_fc);
-                    pIM_I8 = processor->Process(FLAGS_stream_output);
-                    mI8 = dynamic_cast<const CalibrationMetrics *>(pIM_I8.get());
-                    maximalAccuracy = mI8->AccuracyResult;
-                    if ((mFP32->AccuracyResult - maximalAccuracy) > (FLAGS_threshold / 100)) {
+                    shared_ptr<Processor::InferenceMetrics> pIM_I8 = processor->Process(FLAGS_stream_output);
+                    const CalibrationMetrics *mI8 = dynamic_cast<const CalibrationMetrics *>(pIM_I8.get());
+                    validatedAccuracy[fp32Layers] = mI8->AccuracyResult;
+                    if ((mFP32->AccuracyResult - mI8->AccuracyResult) > (FLAGS_threshold / 100)) {
                         cout << "FP32 Accuracy: " << OUTPUT_FLOATING(100.0 * mFP32->AccuracyResult) << "% vs " <<
-                            "current Int8 configuration Accuracy: " << OUTPUT_FLOATING(100.0 * maximalAccuracy) << "%" << std::endl;
-                    } else {
+                            "current Int8 configuration Accuracy: " << OUTPUT_FLOATING(100.0 * mI8->AccuracyResult) << "%" << std::endl;
+                    }
+                    return mI8->AccuracyResult;
+                };
+                auto satisfiesThreshold = [&](float accuracy) -> bool {
+                    return (mFP32->AccuracyResult - accuracy) <= (FLAGS_threshold / 100);
+                };
+
+                size_t fp32Layers = 0;
+                if (FLAGS_search == "binary") {
+                    // the accuracy is assumed to grow with the number of the returned layers, so the least number
+                    // of the layers satisfying the threshold is bisected between 1 and all of them
+                    if (!orderedLayers.empty() && satisfiesThreshold(validateFP32Layers(orderedLayers.size()))) {
+                        size_t lo = 1, hi = orderedLayers.size();
+                        while (lo < hi) {
+                            size_t mid = lo + (hi - lo) / 2;
+                            if (satisfiesThreshold(validateFP32Layers(mid))) {
+                                hi = mid;
+                            } else {
+                                lo = mid + 1;
+                            }
+                        }
+                        fp32Layers = hi;
                         bAccuracy = true;
                     }
-                    it++;
+                } else {
+                    while (fp32Layers < orderedLayers.size() && bAccuracy == false) {
+                        fp32Layers++;
+                        bAccuracy = satisfiesThreshold(validateFP32Layers(fp32Layers));
+                    }
+                }
+                if (fp32Layers > 0) {
+                    maximalAccuracy = validateFP32Layers(fp32Layers);
+                    for (size_t l = 0; l < orderedLayers.size(); l++) {
+                        layersToInt8[orderedLayers[l]] = l >= fp32Layers;
+                    }
                 }
             } else {
                 bAccuracy = true;
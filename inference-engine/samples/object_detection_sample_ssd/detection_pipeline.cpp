@@ -0,0 +1,281 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "detection_pipeline.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <format_reader_ptr.h>
+
+using namespace InferenceEngine;
+
+namespace {
+
+typedef std::chrono::duration<double, std::ratio<1, 1000>> ms;
+
+void printStage(std::ostream &stream, const char *name, std::vector<double> times) {
+    if (times.empty()) {
+        return;
+    }
+    std::sort(times.begin(), times.end());
+    double sum = 0.0;
+    for (double time : times) {
+        sum += time;
+    }
+    stream << std::setw(14) << std::left << name << std::right << std::fixed << std::setprecision(2) <<
+           std::setw(10) << sum / times.size() << std::setw(10) << times[std::min(times.size() - 1, times.size() * 9 / 10)] <<
+           std::setw(10) << times.back() << std::defaultfloat << std::endl;
+}
+
+}  // namespace
+
+void fillImageInput(const Blob::Ptr &input, const std::vector<std::shared_ptr<unsigned char>> &images) {
+    const size_t num_channels = input->getTensorDesc().getDims()[1];
+    const size_t image_size = input->getTensorDesc().getDims()[3] * input->getTensorDesc().getDims()[2];
+    unsigned char *data = static_cast<unsigned char *>(input->buffer());
+
+    /** Iterate over all input images **/
+    for (size_t image_id = 0; image_id < images.size(); ++image_id) {
+        /** Iterate over all pixel in image (b,g,r) **/
+        for (size_t pid = 0; pid < image_size; pid++) {
+            /** Iterate over all channels **/
+            for (size_t ch = 0; ch < num_channels; ++ch) {
+                /**          [images stride + channels stride + pixel id ] all in bytes            **/
+                data[image_id * image_size * num_channels + ch * image_size + pid] = images[image_id].get()[pid * num_channels + ch];
+            }
+        }
+    }
+}
+
+void fillImInfoInput(const Blob::Ptr &input, size_t height, size_t width, size_t batchSize) {
+    const size_t imInfoDim = input->getTensorDesc().getDims()[1];
+    float *p = input->buffer().as<PrecisionTrait<Precision::FP32>::value_type *>();
+
+    for (size_t image_id = 0; image_id < batchSize; ++image_id) {
+        p[image_id * imInfoDim + 0] = static_cast<float>(height);
+        p[image_id * imInfoDim + 1] = static_cast<float>(width);
+        for (size_t k = 2; k < imInfoDim; k++) {
+            p[image_id * imInfoDim + k] = 1.0f;  // all scale factors are set to 1.0
+        }
+    }
+}
+
+std::vector<Detection> parseDetections(const Blob::Ptr &output,
+                                       const std::vector<size_t> &imageWidths,
+                                       const std::vector<size_t> &imageHeights) {
+    const SizeVector outputDims = output->getTensorDesc().getDims();
+    const int maxProposalCount = static_cast<int>(outputDims[2]);
+    const int objectSize = static_cast<int>(outputDims[3]);
+    const float *detection = output->buffer().as<PrecisionTrait<Precision::FP32>::value_type *>();
+
+    std::vector<Detection> detections;
+    /* Each detection has image_id that denotes processed image */
+    for (int curProposal = 0; curProposal < maxProposalCount; curProposal++) {
+        const float *object = detection + curProposal * objectSize;
+        auto image_id = static_cast<int>(object[0]);
+        if (image_id < 0) {
+            break;
+        }
+        if (static_cast<size_t>(image_id) >= imageWidths.size()) {
+            // the padding images of a partial batch
+            continue;
+        }
+
+        Detection item;
+        item.proposal = curProposal;
+        item.imageId = image_id;
+        item.label = static_cast<int>(object[1]);
+        item.confidence = object[2];
+        item.xmin = static_cast<int>(object[3] * imageWidths[image_id]);
+        item.ymin = static_cast<int>(object[4] * imageHeights[image_id]);
+        item.xmax = static_cast<int>(object[5] * imageWidths[image_id]);
+        item.ymax = static_cast<int>(object[6] * imageHeights[image_id]);
+        detections.push_back(item);
+    }
+    return detections;
+}
+
+DetectionPipeline::DetectionPipeline(ExecutableNetwork &network, Config config) :
+        _config(std::move(config)), _slots(std::max<size_t>(_config.nireq, 1)) {
+    for (size_t i = 0; i < _slots.size(); i++) {
+        Slot &slot = _slots[i];
+        slot.request = network.CreateInferRequest();
+        if (!_config.imInfoInputName.empty()) {
+            const SizeVector imageDims = slot.request.GetBlob(_config.imageInputName)->getTensorDesc().getDims();
+            fillImInfoInput(slot.request.GetBlob(_config.imInfoInputName), imageDims[2], imageDims[3], _config.batchSize);
+        }
+        // the completion is stamped by the callback, so the time of the inference does not include the time the
+        // postprocessing thread spends on the previous batch
+        slot.request.SetCompletionCallback(
+                std::function<void(InferRequest, StatusCode)>([this, &slot](InferRequest, StatusCode code) {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    slot.finished = Time::now();
+                    slot.status = code;
+                    slot.done = true;
+                    _cv.notify_all();
+                }));
+    }
+}
+
+void DetectionPipeline::preprocess(Slot &slot, const std::vector<std::string> &images, bool keepOriginals) {
+    const SizeVector dims = slot.request.GetBlob(_config.imageInputName)->getTensorDesc().getDims();
+    std::vector<std::shared_ptr<unsigned char>> resized;
+    slot.originals.clear();
+    slot.widths.clear();
+    slot.heights.clear();
+    for (size_t b = 0; b < _config.batchSize; b++) {
+        const std::string &image = images[(slot.iteration * _config.batchSize + b) % images.size()];
+        FormatReader::ReaderPtr reader(image.c_str());
+        if (reader.get() == nullptr) {
+            throw std::logic_error("Image " + image + " cannot be read!");
+        }
+        resized.push_back(reader->getData(dims[3], dims[2]));
+        if (resized.back() == nullptr) {
+            throw std::logic_error("Image " + image + " cannot be resized!");
+        }
+        if (keepOriginals) {
+            slot.originals.push_back(reader->getData());
+        }
+        slot.widths.push_back(reader->width());
+        slot.heights.push_back(reader->height());
+    }
+    fillImageInput(slot.request.GetBlob(_config.imageInputName), resized);
+}
+
+void DetectionPipeline::postprocessLoop(size_t iterations) {
+    while (true) {
+        size_t index;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            // the batches are postprocessed in the order they are started
+            _cv.wait(lock, [this] {
+                return (!_inFlight.empty() && _slots[_inFlight.front()].done) || (_submitted && _inFlight.empty());
+            });
+            if (_inFlight.empty()) {
+                return;
+            }
+            index = _inFlight.front();
+            _inFlight.pop_front();
+        }
+
+        Slot &slot = _slots[index];
+        const auto started = Time::now();
+        if (slot.status != StatusCode::OK) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _error = "Inference of batch " + std::to_string(slot.iteration) + " failed with status " +
+                     std::to_string(slot.status);
+        } else {
+            try {
+                auto detections = parseDetections(slot.request.GetBlob(_config.outputName), slot.widths, slot.heights);
+                if (slot.iteration + 1 == iterations) {
+                    _lastDetections = std::move(detections);
+                    _lastImages = std::move(slot.originals);
+                    _lastWidths = slot.widths;
+                    _lastHeights = slot.heights;
+                }
+            } catch (const std::exception &ex) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _error = ex.what();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _inferTimes.push_back(std::chrono::duration_cast<ms>(slot.finished - slot.started).count());
+        _postprocessTimes.push_back(std::chrono::duration_cast<ms>(Time::now() - started).count());
+        _idle.push_back(index);
+        _cv.notify_all();
+    }
+}
+
+std::vector<Detection> DetectionPipeline::run(const std::vector<std::string> &images, size_t iterations) {
+    _idle.clear();
+    _inFlight.clear();
+    for (size_t i = 0; i < _slots.size(); i++) {
+        _idle.push_back(i);
+    }
+    _submitted = false;
+    _error.clear();
+    _lastDetections.clear();
+    _lastImages.clear();
+    _preprocessTimes.clear();
+    _inferTimes.clear();
+    _postprocessTimes.clear();
+    _stallTimes.clear();
+
+    const auto t0 = Time::now();
+    std::thread postprocessing(&DetectionPipeline::postprocessLoop, this, iterations);
+    std::string error;
+    try {
+        for (size_t iteration = 0; iteration < iterations; iteration++) {
+            size_t index;
+            {
+                const auto waitStarted = Time::now();
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this] { return !_idle.empty() || !_error.empty(); });
+                if (!_error.empty()) {
+                    break;
+                }
+                index = _idle.front();
+                _idle.pop_front();
+                _stallTimes.push_back(std::chrono::duration_cast<ms>(Time::now() - waitStarted).count());
+            }
+
+            Slot &slot = _slots[index];
+            const auto started = Time::now();
+            slot.iteration = iteration;
+            preprocess(slot, images, iteration + 1 == iterations);
+            _preprocessTimes.push_back(std::chrono::duration_cast<ms>(Time::now() - started).count());
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                slot.done = false;
+                slot.started = Time::now();
+            }
+            slot.request.StartAsync();
+            std::lock_guard<std::mutex> lock(_mutex);
+            _inFlight.push_back(index);
+            _cv.notify_all();
+        }
+    } catch (const std::exception &ex) {
+        error = ex.what();
+    }
+
+    {
+        // the postprocessing thread drains the started requests and exits
+        std::lock_guard<std::mutex> lock(_mutex);
+        _submitted = true;
+        _cv.notify_all();
+    }
+    postprocessing.join();
+    _totalTime = std::chrono::duration_cast<ms>(Time::now() - t0).count();
+    _frames = _postprocessTimes.size() * _config.batchSize;
+
+    if (error.empty()) {
+        error = _error;
+    }
+    if (!error.empty()) {
+        throw std::logic_error(error);
+    }
+    return _lastDetections;
+}
+
+void DetectionPipeline::printStatistics(std::ostream &stream) const {
+    stream << std::endl << "Pipeline of " << _slots.size() << " infer requests, batch " << _config.batchSize <<
+           ", " << _postprocessTimes.size() << " batches" << std::endl;
+    stream << std::setw(14) << std::left << "stage, ms" << std::right << std::setw(10) << "mean" << std::setw(10) <<
+           "p90" << std::setw(10) << "max" << std::endl;
+    printStage(stream, "preprocess", _preprocessTimes);
+    printStage(stream, "infer", _inferTimes);
+    printStage(stream, "postprocess", _postprocessTimes);
+    // the time the main thread waits for an idle request, the stage that is not hidden by the others
+    printStage(stream, "stall", _stallTimes);
+    stream << std::endl << "Total time: " << _totalTime << " ms" << std::endl;
+    stream << "Throughput: " << (_totalTime > 0 ? 1000.0 * _frames / _totalTime : 0.0) << " FPS" << std::endl;
+}
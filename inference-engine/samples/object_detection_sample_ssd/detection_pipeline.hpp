@@ -0,0 +1,103 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+/// @brief Object found by the DetectionOutput layer, the coordinates are scaled to the original image
+struct Detection {
+    int proposal;
+    int imageId;
+    int label;
+    float confidence;
+    int xmin, ymin, xmax, ymax;
+};
+
+/// @brief Fills the input with the images resized to the input, the interleaved BGR pixels are reordered to planes
+void fillImageInput(const InferenceEngine::Blob::Ptr &input, const std::vector<std::shared_ptr<unsigned char>> &images);
+
+/// @brief Fills the "image info" input of the Faster-RCNN like networks, all the scale factors are 1
+void fillImInfoInput(const InferenceEngine::Blob::Ptr &input, size_t height, size_t width, size_t batchSize);
+
+/// @brief Parses the whole batch of the DetectionOutput blob in one pass
+std::vector<Detection> parseDetections(const InferenceEngine::Blob::Ptr &output,
+                                       const std::vector<size_t> &imageWidths,
+                                       const std::vector<size_t> &imageHeights);
+
+/**
+ * @brief Runs the detection as a pipeline of the infer requests: the main thread reads and preprocesses the next batch
+ * while the previously started requests are inferred and a postprocessing thread parses the completed ones
+ */
+class DetectionPipeline {
+public:
+    struct Config {
+        std::string imageInputName;
+        std::string imInfoInputName;
+        std::string outputName;
+        size_t batchSize;
+        size_t nireq;
+    };
+
+    DetectionPipeline(InferenceEngine::ExecutableNetwork &network, Config config);
+
+    /**
+     * @brief Processes the given number of batches, the batches take the images in turn
+     * @return the detections of the last batch, its original images are kept for drawing
+     */
+    std::vector<Detection> run(const std::vector<std::string> &images, size_t iterations);
+
+    const std::vector<std::shared_ptr<unsigned char>> &lastImages() const { return _lastImages; }
+    const std::vector<size_t> &lastWidths() const { return _lastWidths; }
+    const std::vector<size_t> &lastHeights() const { return _lastHeights; }
+
+    InferenceEngine::InferRequest &request(size_t i) { return _slots[i].request; }
+
+    /// @brief Prints the time of the stages and the throughput of the last run
+    void printStatistics(std::ostream &stream) const;
+
+private:
+    using Time = std::chrono::high_resolution_clock;
+
+    struct Slot {
+        InferenceEngine::InferRequest request;
+        size_t iteration = 0;
+        std::vector<std::shared_ptr<unsigned char>> originals;
+        std::vector<size_t> widths, heights;
+        Time::time_point started, finished;
+        InferenceEngine::StatusCode status = InferenceEngine::StatusCode::OK;
+        bool done = false;
+    };
+
+    void preprocess(Slot &slot, const std::vector<std::string> &images, bool keepOriginals);
+    void postprocessLoop(size_t iterations);
+
+    Config _config;
+    std::vector<Slot> _slots;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque<size_t> _idle;
+    std::deque<size_t> _inFlight;
+    bool _submitted = false;
+    std::string _error;
+
+    std::vector<Detection> _lastDetections;
+    std::vector<std::shared_ptr<unsigned char>> _lastImages;
+    std::vector<size_t> _lastWidths, _lastHeights;
+
+    // per batch, in ms
+    std::vector<double> _preprocessTimes, _inferTimes, _postprocessTimes, _stallTimes;
+    double _totalTime = 0.0;
+    size_t _frames = 0;
+};
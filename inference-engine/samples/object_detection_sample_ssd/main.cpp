@@ -23,6 +23,7 @@
 #include <samples/slog.hpp>
 #include <samples/args_helper.hpp>
 #include "object_detection_sample_ssd.h"
+#include "detection_pipeline.hpp"
 
 using namespace InferenceEngine;
 
@@ -42,6 +43,10 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Parameter -ni should be greater than 0 (default: 1)");
     }
 
+    if (FLAGS_nireq < 1) {
+        throw std::logic_error("Parameter -nireq should be greater than 0 (default: 3)");
+    }
+
     if (FLAGS_i.empty()) {
         throw std::logic_error("Parameter -i is not set");
     }
@@ -203,7 +208,6 @@ int main(int argc, char *argv[]) {
 
         const SizeVector outputDims = outputInfo->getTensorDesc().getDims();
 
-        const int maxProposalCount = outputDims[2];
         const int objectSize = outputDims[3];
 
         if (objectSize != 7) {
@@ -232,6 +236,7 @@ int main(int argc, char *argv[]) {
         /** Collect images data ptrs **/
         std::vector<std::shared_ptr<unsigned char>> imagesData, originalImagesData;
         std::vector<size_t> imageWidths, imageHeights;
+        std::vector<std::string> validImages;
         for (auto & i : images) {
             FormatReader::ReaderPtr reader(i.c_str());
             if (reader.get() == nullptr) {
@@ -246,54 +251,33 @@ int main(int argc, char *argv[]) {
                 imagesData.push_back(data);
                 imageWidths.push_back(reader->width());
                 imageHeights.push_back(reader->height());
+                validImages.push_back(i);
             }
         }
         if (imagesData.empty()) throw std::logic_error("Valid input images were not found!");
 
         size_t batchSize = network.getBatchSize();
         slog::info << "Batch size is " << std::to_string(batchSize) << slog::endl;
-        if (batchSize != imagesData.size()) {
+        if (FLAGS_async) {
+            /** The pipeline takes the images in turn, so a batch can repeat the images **/
+            slog::info << "Pipeline of " << FLAGS_nireq << " infer requests processes " << FLAGS_ni << " batches of " <<
+                       validImages.size() << " images" << slog::endl;
+        } else if (batchSize != imagesData.size()) {
             slog::warn << "Number of images " + std::to_string(imagesData.size()) + \
                 " doesn't match batch size " + std::to_string(batchSize) << slog::endl;
             batchSize = std::min(batchSize, imagesData.size());
             slog::warn << "Number of images to be processed is "<< std::to_string(batchSize) << slog::endl;
         }
-
-        /** Creating input blob **/
-        Blob::Ptr imageInput = infer_request.GetBlob(imageInputName);
+        imagesData.resize(std::min(imagesData.size(), batchSize));
 
         /** Filling input tensor with images. First b channel, then g and r channels **/
-        size_t num_channels = imageInput->getTensorDesc().getDims()[1];
-        size_t image_size = imageInput->getTensorDesc().getDims()[3] * imageInput->getTensorDesc().getDims()[2];
-
-        unsigned char* data = static_cast<unsigned char*>(imageInput->buffer());
-
-        /** Iterate over all input images **/
-        for (size_t image_id = 0; image_id < std::min(imagesData.size(), batchSize); ++image_id) {
-            /** Iterate over all pixel in image (b,g,r) **/
-            for (size_t pid = 0; pid < image_size; pid++) {
-                /** Iterate over all channels **/
-                for (size_t ch = 0; ch < num_channels; ++ch) {
-                    /**          [images stride + channels stride + pixel id ] all in bytes            **/
-                    data[image_id * image_size * num_channels + ch * image_size + pid] = imagesData.at(image_id).get()[pid*num_channels + ch];
-                }
-            }
-        }
+        fillImageInput(infer_request.GetBlob(imageInputName), imagesData);
 
         if (imInfoInputName != "") {
-            Blob::Ptr input2 = infer_request.GetBlob(imInfoInputName);
-            auto imInfoDim = inputsInfo.find(imInfoInputName)->second->getTensorDesc().getDims()[1];
-
-            /** Fill input tensor with values **/
-            float *p = input2->buffer().as<PrecisionTrait<Precision::FP32>::value_type*>();
-
-            for (size_t image_id = 0; image_id < std::min(imagesData.size(), batchSize); ++image_id) {
-                p[image_id * imInfoDim + 0] = static_cast<float>(inputsInfo[imageInputName]->getTensorDesc().getDims()[2]);
-                p[image_id * imInfoDim + 1] = static_cast<float>(inputsInfo[imageInputName]->getTensorDesc().getDims()[3]);
-                for (size_t k = 2; k < imInfoDim; k++) {
-                    p[image_id * imInfoDim + k] = 1.0f;  // all scale factors are set to 1.0
-                }
-            }
+            fillImInfoInput(infer_request.GetBlob(imInfoInputName),
+                            inputsInfo[imageInputName]->getTensorDesc().getDims()[2],
+                            inputsInfo[imageInputName]->getTensorDesc().getDims()[3],
+                            imagesData.size());
         }
         // -----------------------------------------------------------------------------------------------------
 
@@ -305,50 +289,53 @@ int main(int argc, char *argv[]) {
         typedef std::chrono::duration<float> fsec;
 
         double total = 0.0;
-        /** Start inference & calc performance **/
-        for (size_t iter = 0; iter < FLAGS_ni; ++iter) {
-            auto t0 = Time::now();
-            infer_request.Infer();
-            auto t1 = Time::now();
-            fsec fs = t1 - t0;
-            ms d = std::chrono::duration_cast<ms>(fs);
-            total += d.count();
+        std::vector<Detection> detections;
+        std::unique_ptr<DetectionPipeline> pipeline;
+        if (FLAGS_async) {
+            /** Reading and preprocessing of a batch, its inference and the postprocessing of the completed ones overlap **/
+            pipeline.reset(new DetectionPipeline(executable_network,
+                    {imageInputName, imInfoInputName, outputName, batchSize, FLAGS_nireq}));
+            detections = pipeline->run(validImages, FLAGS_ni);
+            originalImagesData = pipeline->lastImages();
+            imageWidths = pipeline->lastWidths();
+            imageHeights = pipeline->lastHeights();
+        } else {
+            /** Start inference & calc performance **/
+            for (size_t iter = 0; iter < FLAGS_ni; ++iter) {
+                auto t0 = Time::now();
+                infer_request.Infer();
+                auto t1 = Time::now();
+                fsec fs = t1 - t0;
+                ms d = std::chrono::duration_cast<ms>(fs);
+                total += d.count();
+            }
         }
         // -----------------------------------------------------------------------------------------------------
 
         // --------------------------- 11. Process output -------------------------------------------------------
         slog::info << "Processing output blobs" << slog::endl;
 
-        const Blob::Ptr output_blob = infer_request.GetBlob(outputName);
-        const float* detection = static_cast<PrecisionTrait<Precision::FP32>::value_type*>(output_blob->buffer());
+        if (!FLAGS_async) {
+            imageWidths.resize(batchSize);
+            imageHeights.resize(batchSize);
+            detections = parseDetections(infer_request.GetBlob(outputName), imageWidths, imageHeights);
+        }
 
         std::vector<std::vector<int> > boxes(batchSize);
         std::vector<std::vector<int> > classes(batchSize);
 
-        /* Each detection has image_id that denotes processed image */
-        for (int curProposal = 0; curProposal < maxProposalCount; curProposal++) {
-            auto image_id = static_cast<int>(detection[curProposal * objectSize + 0]);
-            if (image_id < 0) {
-                break;
-            }
-
-            float confidence = detection[curProposal * objectSize + 2];
-            auto label = static_cast<int>(detection[curProposal * objectSize + 1]);
-            auto xmin = static_cast<int>(detection[curProposal * objectSize + 3] * imageWidths[image_id]);
-            auto ymin = static_cast<int>(detection[curProposal * objectSize + 4] * imageHeights[image_id]);
-            auto xmax = static_cast<int>(detection[curProposal * objectSize + 5] * imageWidths[image_id]);
-            auto ymax = static_cast<int>(detection[curProposal * objectSize + 6] * imageHeights[image_id]);
+        for (const auto &detection : detections) {
+            std::cout << "[" << detection.proposal << "," << detection.label << "] element, prob = " << detection.confidence <<
+                "    (" << detection.xmin << "," << detection.ymin << ")-(" << detection.xmax << "," << detection.ymax << ")" <<
+                " batch id : " << detection.imageId;
 
-            std::cout << "[" << curProposal << "," << label << "] element, prob = " << confidence <<
-                "    (" << xmin << "," << ymin << ")-(" << xmax << "," << ymax << ")" << " batch id : " << image_id;
-
-            if (confidence > 0.5) {
+            if (detection.confidence > 0.5) {
                 /** Drawing only objects with >50% probability **/
-                classes[image_id].push_back(label);
-                boxes[image_id].push_back(xmin);
-                boxes[image_id].push_back(ymin);
-                boxes[image_id].push_back(xmax - xmin);
-                boxes[image_id].push_back(ymax - ymin);
+                classes[detection.imageId].push_back(detection.label);
+                boxes[detection.imageId].push_back(detection.xmin);
+                boxes[detection.imageId].push_back(detection.ymin);
+                boxes[detection.imageId].push_back(detection.xmax - detection.xmin);
+                boxes[detection.imageId].push_back(detection.ymax - detection.ymin);
                 std::cout << " WILL BE PRINTED!";
             }
             std::cout << std::endl;
@@ -365,14 +352,18 @@ int main(int argc, char *argv[]) {
             }
         }
         // -----------------------------------------------------------------------------------------------------
-        std::cout << std::endl << "total inference time: " << total << std::endl;
-        std::cout << "Average running time of one iteration: " << total / static_cast<double>(FLAGS_ni) << " ms" << std::endl;
-        std::cout << std::endl << "Throughput: " << 1000 * static_cast<double>(FLAGS_ni) * batchSize / total << " FPS" << std::endl;
+        if (FLAGS_async) {
+            pipeline->printStatistics(std::cout);
+        } else {
+            std::cout << std::endl << "total inference time: " << total << std::endl;
+            std::cout << "Average running time of one iteration: " << total / static_cast<double>(FLAGS_ni) << " ms" << std::endl;
+            std::cout << std::endl << "Throughput: " << 1000 * static_cast<double>(FLAGS_ni) * batchSize / total << " FPS" << std::endl;
+        }
         std::cout << std::endl;
 
         /** Show performance results **/
         if (FLAGS_pc) {
-            printPerformanceCounts(infer_request, std::cout);
+            printPerformanceCounts(FLAGS_async ? pipeline->request(0) : infer_request, std::cout);
         }
     }
     catch (const std::exception& error) {
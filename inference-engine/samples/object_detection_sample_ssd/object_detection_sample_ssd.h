@@ -55,6 +55,14 @@ static const char custom_cpu_library_message[] = "Required for CPU custom layers
 /// @brief message for plugin messages
 static const char plugin_err_message[] = "Optional. Enables messages from a plugin";
 
+/// @brief message for async pipeline
+static const char async_message[] = "Optional. Runs the inference as a pipeline of the infer requests: the images of " \
+"the next batch are read and preprocessed while the started requests are inferred and the completed ones are " \
+"postprocessed. The -ni batches take the images in turn. Reports the time of every stage.";
+
+/// @brief message for the number of infer requests
+static const char nireq_message[] = "Optional. Number of infer requests of the -async pipeline. Default value is 3";
+
 /// \brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -90,6 +98,12 @@ DEFINE_uint32(ni, 1, iterations_count_message);
 /// @brief Enable plugin messages
 DEFINE_bool(p_msg, false, plugin_err_message);
 
+/// @brief Asynchronous pipeline mode
+DEFINE_bool(async, false, async_message);
+
+/// @brief Number of infer requests of the pipeline (default 3)
+DEFINE_uint32(nireq, 3, nireq_message);
+
 /**
 * \brief This function show a help message
 */
@@ -109,4 +123,6 @@ static void showUsage() {
     std::cout << "    -pc                     " << performance_counter_message << std::endl;
     std::cout << "    -ni \"<integer>\"         " << iterations_count_message << std::endl;
     std::cout << "    -p_msg                  " << plugin_err_message << std::endl;
+    std::cout << "    -async                  " << async_message << std::endl;
+    std::cout << "    -nireq \"<integer>\"      " << nireq_message << std::endl;
 }
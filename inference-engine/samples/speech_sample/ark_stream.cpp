@@ -0,0 +1,89 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ark_stream.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+ArkReader::ArkReader(const std::string &fileName) : _fileName(fileName), _file(fileName, std::ios::binary) {
+    if (!_file.good()) {
+        throw std::runtime_error("Failed to open " + fileName + " for reading");
+    }
+}
+
+bool ArkReader::nextUtterance(std::string &name, uint32_t &numRows, uint32_t &numColumns) {
+    if (_rowsLeft != 0) {
+        _file.seekg(static_cast<std::streamoff>(_rowsLeft) * _numColumns * sizeof(float), _file.cur);
+        _rowsLeft = 0;
+    }
+
+    std::string line;
+    std::getline(_file, name, '\0');  // read variable length name followed by space and NUL
+    std::getline(_file, line, '\4');  // read "BFM" followed by space and control-D
+    if (!_file.good() || line.compare("BFM ") != 0) {
+        return false;
+    }
+    _file.read(reinterpret_cast<char *>(&numRows), sizeof(uint32_t));     // read number of rows
+    std::getline(_file, line, '\4');                                      // read control-D
+    _file.read(reinterpret_cast<char *>(&numColumns), sizeof(uint32_t));  // read number of columns
+    if (!_file.good()) {
+        throw std::runtime_error("Truncated header of utterance " + name + " in " + _fileName);
+    }
+
+    _rowsLeft = numRows;
+    _numColumns = numColumns;
+    return true;
+}
+
+uint32_t ArkReader::readRows(float *dst, uint32_t numRows) {
+    numRows = std::min(numRows, _rowsLeft);
+    _file.read(reinterpret_cast<char *>(dst), static_cast<std::streamsize>(numRows) * _numColumns * sizeof(float));
+    if (!_file.good()) {
+        throw std::runtime_error("Truncated data in " + _fileName);
+    }
+    _rowsLeft -= numRows;
+    return numRows;
+}
+
+ArkWriter::ArkWriter(const std::string &fileName) : _fileName(fileName), _file(fileName, std::ios::binary) {
+    if (!_file.good()) {
+        throw std::runtime_error("Failed to open " + fileName + " for writing");
+    }
+}
+
+void ArkWriter::beginUtterance(const std::string &name, uint32_t numRows, uint32_t numColumns) {
+    if (_rowsLeft != 0) {
+        throw std::logic_error("Utterance in " + _fileName + " is not completed");
+    }
+    _file.write(name.c_str(), name.length());  // write name
+    _file.write("\0", 1);
+    _file.write("BFM ", 4);
+    _file.write("\4", 1);
+    _file.write(reinterpret_cast<const char *>(&numRows), sizeof(uint32_t));
+    _file.write("\4", 1);
+    _file.write(reinterpret_cast<const char *>(&numColumns), sizeof(uint32_t));
+    _rowsLeft = numRows;
+    _numColumns = numColumns;
+}
+
+void ArkWriter::writeRows(const float *src, uint32_t numRows) {
+    if (numRows > _rowsLeft) {
+        throw std::logic_error("More rows are written to " + _fileName + " than declared in the utterance header");
+    }
+    _file.write(reinterpret_cast<const char *>(src), static_cast<std::streamsize>(numRows) * _numColumns * sizeof(float));
+    _rowsLeft -= numRows;
+}
+
+void ArkWriter::endUtterance() {
+    if (_rowsLeft != 0) {
+        throw std::logic_error("Utterance in " + _fileName + " misses " + std::to_string(_rowsLeft) + " rows");
+    }
+    // the scores of an utterance are visible to a reader of the file as soon as the utterance is completed
+    _file.flush();
+    if (!_file.good()) {
+        throw std::runtime_error("Failed to write to " + _fileName);
+    }
+}
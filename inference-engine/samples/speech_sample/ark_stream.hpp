@@ -0,0 +1,57 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+/**
+ * @brief Reads the utterances of a Kaldi ARK file one after another, the rows of an utterance are read on demand,
+ * so only the frames in flight are kept in memory
+ */
+class ArkReader {
+public:
+    explicit ArkReader(const std::string &fileName);
+
+    /**
+     * @brief Moves to the next utterance, the unread rows of the current one are skipped
+     * @return false at the end of the file
+     */
+    bool nextUtterance(std::string &name, uint32_t &numRows, uint32_t &numColumns);
+
+    /**
+     * @brief Reads up to numRows rows of the current utterance to dst
+     * @return the number of the rows read
+     */
+    uint32_t readRows(float *dst, uint32_t numRows);
+
+private:
+    std::string _fileName;
+    std::ifstream _file;
+    uint32_t _rowsLeft = 0;
+    uint32_t _numColumns = 0;
+};
+
+/**
+ * @brief Writes the utterances to a Kaldi ARK file row by row, in the same format as SaveKaldiArkArray()
+ */
+class ArkWriter {
+public:
+    explicit ArkWriter(const std::string &fileName);
+
+    /// @brief Writes the header of an utterance, exactly numRows rows are expected to follow
+    void beginUtterance(const std::string &name, uint32_t numRows, uint32_t numColumns);
+
+    void writeRows(const float *src, uint32_t numRows);
+
+    void endUtterance();
+
+private:
+    std::string _fileName;
+    std::ofstream _file;
+    uint32_t _rowsLeft = 0;
+    uint32_t _numColumns = 0;
+};
@@ -5,6 +5,7 @@
 #include "speech_sample.hpp"
 
 #include <gflags/gflags.h>
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -27,6 +28,8 @@
 #include <samples/args_helper.hpp>
 #include <ext_list.hpp>
 
+#include "ark_stream.hpp"
+
 #ifndef ALIGN
 #define ALIGN(memSize, pad)   ((static_cast<int>((memSize) + pad - 1) / pad) * pad)
 #endif
@@ -466,9 +469,190 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Not valid value for 'cw' argument. It should be > 0 ");
     }
 
+    if (FLAGS_stream && FLAGS_cw > 0) {
+        throw std::logic_error("Context windows (-cw) are not supported in the streaming mode (-stream)");
+    }
+
+    if (FLAGS_rt && !FLAGS_stream) {
+        throw std::logic_error("Real-time pacing (-rt) requires the streaming mode (-stream)");
+    }
+
+    if (FLAGS_fs <= 0) {
+        throw std::logic_error("Not valid value for 'fs' argument. It should be > 0 ");
+    }
+
     return true;
 }
 
+/**
+ * @brief Infers the utterances of the input ark file keeping the requests in flight, the frames are read, the scores
+ * are compared and written as the frame batches complete. Utterance state is reset between the utterances.
+ */
+void InferStreaming(ExecutableNetwork &executableNet,
+                    std::vector<InferRequestStruct> &inferRequests,
+                    const std::string &inputName,
+                    const std::string &outputName,
+                    const std::string &inputArkName,
+                    uint32_t batchSize) {
+    ArkReader input(inputArkName);
+    std::unique_ptr<ArkReader> reference;
+    if (!FLAGS_r.empty()) {
+        reference.reset(new ArkReader(FLAGS_r));
+    }
+    std::unique_ptr<ArkWriter> output;
+    if (!FLAGS_o.empty()) {
+        output.reset(new ArkWriter(FLAGS_o));
+    }
+
+    const uint32_t numScoresPerFrame = inferRequests[0].inferRequest.GetBlob(outputName)->size() / batchSize;
+    // time when the last frame of the batch of a request was available
+    std::vector<Time::time_point> readyTimes(inferRequests.size());
+    std::vector<float> referenceScores(batchSize * numScoresPerFrame);
+    double totalAudioTime = 0.0, totalTime = 0.0;
+
+    std::string uttName;
+    uint32_t numFrames(0), numFrameElements(0);
+    for (uint32_t utteranceIndex = 0; input.nextUtterance(uttName, numFrames, numFrameElements); ++utteranceIndex) {
+        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> utterancePerfMap, callPerfMap;
+        const size_t inputSize = inferRequests[0].inferRequest.GetBlob(inputName)->size();
+        if (inputSize != numFrameElements * batchSize) {
+            throw std::logic_error("network input size(" + std::to_string(inputSize) +
+                                   ") mismatch to ark file size (" + std::to_string(numFrameElements * batchSize) + ")");
+        }
+        if (reference) {
+            std::string refUtteranceName;
+            uint32_t numFramesReference(0), numFrameElementsReference(0);
+            if (!reference->nextUtterance(refUtteranceName, numFramesReference, numFrameElementsReference) ||
+                numFramesReference != numFrames || numFrameElementsReference != numScoresPerFrame) {
+                throw std::logic_error("Reference scores of utterance " + uttName + " mismatch to the network output");
+            }
+        }
+        if (output) {
+            output->beginUtterance(uttName, numFrames, numScoresPerFrame);
+        }
+
+        score_error_t frameError, totalError;
+        ClearScoreError(&totalError);
+        totalError.threshold = frameError.threshold = MAX_SCORE_DIFFERENCE;
+        std::vector<double> latencies;
+        size_t next = 0, inFlight = 0, numCalls = 0;
+
+        // the requests complete in the order they are started, so the oldest one is always consumed first
+        auto consumeOldest = [&](int64_t timeout) {
+            auto &inferRequest = inferRequests[(next + inferRequests.size() - inFlight) % inferRequests.size()];
+            const StatusCode code = inferRequest.inferRequest.Wait(timeout);
+            if (code == StatusCode::RESULT_NOT_READY) {
+                return false;
+            }
+            if (code != StatusCode::OK) {
+                throw std::logic_error("Inference of utterance " + uttName + " failed with status " +
+                                       std::to_string(code));
+            }
+            latencies.push_back(std::chrono::duration_cast<ms>(
+                    Time::now() - readyTimes[&inferRequest - &inferRequests.front()]).count());
+            inFlight--;
+
+            Blob::Ptr outputBlob = inferRequest.inferRequest.GetBlob(outputName);
+            if (output) {
+                output->writeRows(outputBlob->buffer().as<float *>(), inferRequest.numFramesThisBatch);
+            }
+            if (reference) {
+                reference->readRows(referenceScores.data(), inferRequest.numFramesThisBatch);
+                CompareScores(outputBlob->buffer().as<float *>(),
+                              referenceScores.data(),
+                              &frameError,
+                              inferRequest.numFramesThisBatch,
+                              numScoresPerFrame);
+                UpdateScoreError(&frameError, &totalError);
+            }
+            if (FLAGS_pc) {
+                getPerformanceCounters(inferRequest.inferRequest, callPerfMap);
+                sumPerformanceCounters(callPerfMap, utterancePerfMap);
+            }
+            inferRequest.frameIndex = -1;
+            return true;
+        };
+
+        auto t0 = Time::now();
+        uint32_t frameIndex = 0;
+        while (frameIndex < numFrames) {
+            auto &inferRequest = inferRequests[next];
+            if (inFlight == inferRequests.size()) {
+                consumeOldest(IInferRequest::WaitMode::RESULT_READY);
+            }
+
+            Blob::Ptr inputBlob = inferRequest.inferRequest.GetBlob(inputName);
+            float *inputFrames = inputBlob->buffer().as<float *>();
+            const uint32_t numFramesThisBatch = input.readRows(inputFrames, batchSize);
+            // the tail of the last batch of the utterance does not produce scores
+            std::fill(inputFrames + numFramesThisBatch * numFrameElements, inputFrames + inputBlob->size(), 0.0f);
+
+            if (FLAGS_rt) {
+                // a live source provides the last frame of the batch after its audio has been captured
+                const auto arrival = t0 + std::chrono::duration_cast<Time::duration>(
+                        ms((frameIndex + numFramesThisBatch) * FLAGS_fs));
+                while (Time::now() < arrival) {
+                    const auto left = std::chrono::duration_cast<ms>(arrival - Time::now()).count();
+                    if (inFlight == 0) {
+                        std::this_thread::sleep_until(arrival);
+                    } else {
+                        consumeOldest(std::max<int64_t>(1, static_cast<int64_t>(left)));
+                    }
+                }
+            }
+
+            readyTimes[next] = Time::now();
+            inferRequest.inferRequest.StartAsync();
+            inferRequest.frameIndex = frameIndex;
+            inferRequest.numFramesThisBatch = numFramesThisBatch;
+            frameIndex += numFramesThisBatch;
+            next = (next + 1) % inferRequests.size();
+            inFlight++;
+            numCalls++;
+        }
+        while (inFlight != 0) {
+            consumeOldest(IInferRequest::WaitMode::RESULT_READY);
+        }
+        const double utteranceTime = std::chrono::duration_cast<ms>(Time::now() - t0).count();
+
+        // resetting state between utterances
+        for (auto &&state : executableNet.QueryState()) {
+            state.Reset();
+        }
+        if (output) {
+            output->endUtterance();
+        }
+
+        const double audioTime = numFrames * FLAGS_fs;
+        totalAudioTime += audioTime;
+        totalTime += utteranceTime;
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&latencies](size_t p) {
+            return latencies.empty() ? 0.0 : latencies[std::min(latencies.size() - 1, latencies.size() * p / 100)];
+        };
+
+        std::cout << "Utterance " << utteranceIndex << ": " << uttName << std::endl;
+        std::cout << "Total time in Infer (HW and SW):\t" << utteranceTime << " ms" << std::endl;
+        std::cout << "Frames in utterance:\t\t\t" << numFrames << " frames" << std::endl;
+        std::cout << "Average Infer time per frame:\t\t" << utteranceTime / std::max(1u, numFrames) << " ms"
+                  << std::endl;
+        std::cout << "Batch latency p50/p90/p99:\t\t" << percentile(50) << " / " << percentile(90) << " / "
+                  << percentile(99) << " ms" << std::endl;
+        std::cout << "Real-time factor:\t\t\t" << (audioTime > 0 ? utteranceTime / audioTime : 0.0) << std::endl;
+        if (FLAGS_pc) {
+            printPerformanceCounters(utterancePerfMap, numCalls, std::cout);
+        }
+        if (reference) {
+            printReferenceCompareResults(totalError, numFrames, std::cout);
+        }
+        std::cout << "End of Utterance " << utteranceIndex << std::endl << std::endl;
+    }
+
+    std::cout << "Total audio:\t\t\t\t" << totalAudioTime << " ms" << std::endl;
+    std::cout << "Total time in Infer (HW and SW):\t" << totalTime << " ms" << std::endl;
+    std::cout << "Real-time factor:\t\t\t" << (totalAudioTime > 0 ? totalTime / totalAudioTime : 0.0) << std::endl;
+}
+
 /**
  * @brief The entry point for inference engine automatic speech recognition sample
  * @file speech_sample/main.cpp
@@ -499,7 +683,8 @@ int main(int argc, char *argv[]) {
         std::string inputArkName = fileNameNoExt(FLAGS_i) + ".ark";
 
         uint32_t numUtterances(0), numBytesThisUtterance(0);
-        if (!FLAGS_i.empty()) {
+        // the streaming mode reads the utterances as it goes, the loop over the utterances below is skipped
+        if (!FLAGS_i.empty() && !FLAGS_stream) {
             GetKaldiArkInfo(inputArkName.c_str(), 0, &numUtterances, &numBytesThisUtterance);
         }
         // -----------------------------------------------------------------------------------------------------
@@ -681,6 +866,11 @@ int main(int argc, char *argv[]) {
         // -----------------------------------------------------------------------------------------------------
 
         // --------------------------- 9. Do inference ---------------------------------------------------------
+        if (FLAGS_stream) {
+            InferStreaming(executableNet, inferRequests, cInputInfo.begin()->first, cOutputInfo.begin()->first,
+                           inputArkName, batchSize);
+        }
+
         std::vector<uint8_t> ptrUtterance;
         std::vector<uint8_t> ptrScores;
         std::vector<uint8_t> ptrReferenceScores;
@@ -80,6 +80,19 @@ static const char context_window_message[] = "Optional. Number of frames for con
                                              "Works only with context window networks."
                                              " If you use the cw flag, then batch size and nthreads arguments are ignored.";
 
+/// @brief message for streaming mode argument
+static const char stream_message[] = "Optional. Streaming mode: the input, reference and output ark files are read and " \
+                                     "written frame batch by frame batch while -nthreads requests are in flight. " \
+                                     "Reports the latency of the frame batches and the real-time factor.";
+
+/// @brief message for real-time pacing argument
+static const char real_time_message[] = "Optional. Feeds the frames in the streaming mode at the rate of a live audio "
+                                        "source (one frame every -fs ms) instead of as fast as possible.";
+
+/// @brief message for frame shift argument
+static const char frame_shift_message[] = "Optional. Frame shift of the features in ms used for the real-time factor and "
+                                          "the -rt pacing (default 10).";
+
 /// \brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -142,6 +155,15 @@ DEFINE_int32(nthreads, 1, infer_num_threads_message);
 /// @brief Batch size (default 0)
 DEFINE_int32(cw, 0, context_window_message);
 
+/// @brief Streaming mode (default false)
+DEFINE_bool(stream, false, stream_message);
+
+/// @brief Real-time pacing of the streaming mode (default false)
+DEFINE_bool(rt, false, real_time_message);
+
+/// @brief Frame shift in ms (default 10)
+DEFINE_double(fs, 10.0, frame_shift_message);
+
 /**
  * \brief This function show a help message
  */
@@ -169,5 +191,8 @@ static void showUsage() {
     std::cout << "    -we \"<path>\"            " << write_embedded_model_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"   " << infer_num_threads_message << std::endl;
     std::cout << "    -cw \"<integer>\"         " << context_window_message << std::endl;
+    std::cout << "    -stream                   " << stream_message << std::endl;
+    std::cout << "    -rt                       " << real_time_message << std::endl;
+    std::cout << "    -fs \"<double>\"          " << frame_shift_message << std::endl;
 }
 
@@ -2,7 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 #include <memory>
 
@@ -41,53 +46,76 @@ std::shared_ptr<Processor::InferenceMetrics> ClassificationProcessor::Process(bo
      }
 
      auto validationMap = generator.getValidationMap(imagesPath);
-     ImageDecoder decoder;
+     ParallelImageDecoder decoder(decodeThreadsNum);
 
      // ----------------------------Do inference-------------------------------------------------------------
      slog::info << "Starting inference" << slog::endl;
 
-     std::vector<int> expected(batch);
-     std::vector<std::string> files(batch);
-
      ConsoleProgress progress(validationMap.size(), stream_output);
 
      ClassificationInferenceMetrics im;
 
      std::string firstInputName = this->inputInfo.begin()->first;
      std::string firstOutputName = this->outInfo.begin()->first;
-     auto firstInputBlob = inferRequest.GetBlob(firstInputName);
-     auto firstOutputBlob = inferRequest.GetBlob(firstOutputName);
 
-     auto iter = validationMap.begin();
-     while (iter != validationMap.end()) {
-         size_t b = 0;
+     // the ring of the infer requests: the next batch is decoded into the input blob of the oldest request while
+     // the others are inferred, the results are consumed in the order of the batches
+     struct Slot {
+         InferRequest request;
+         std::vector<int> expected;
+         // empty for the batch positions without an image
+         std::vector<std::string> files;
          int filesWatched = 0;
-         for (; b < batch && iter != validationMap.end(); b++, iter++, filesWatched++) {
-             expected[b] = iter->first;
-             try {
-                 decoder.insertIntoBlob(iter->second, b, *firstInputBlob, preprocessingOptions);
-                 files[b] = iter->second;
-             } catch (const InferenceEngineException& iex) {
-                 slog::warn << "Can't read file " << iter->second << slog::endl;
-                 slog::warn << "Error: " << iex.what() << slog::endl;
-                 // Could be some non-image file in directory
-                 b--;
-                 continue;
+         bool busy = false;
+         bool done = false;
+         std::chrono::high_resolution_clock::time_point start, end;
+     };
+     std::vector<Slot> slots(inferRequestsNum);
+     // the completion is signaled by the callback, since it takes the end time
+     std::mutex doneMutex;
+     std::condition_variable doneCondition;
+     for (size_t r = 0; r < slots.size(); r++) {
+         Slot& slot = slots[r];
+         slot.request = r == 0 ? inferRequest : executableNetwork.CreateInferRequest();
+         slot.request.SetCompletionCallback([&slot, &doneMutex, &doneCondition] {
+             {
+                 std::lock_guard<std::mutex> lock(doneMutex);
+                 slot.end = std::chrono::high_resolution_clock::now();
+                 slot.done = true;
              }
-         }
-
-         Infer(progress, filesWatched, im);
+             doneCondition.notify_all();
+         });
+     }
 
+     auto consume = [&](Slot& slot) {
+         {
+             std::unique_lock<std::mutex> lock(doneMutex);
+             doneCondition.wait(lock, [&slot] { return slot.done; });
+         }
+         slot.busy = false;
+         StatusCode status = slot.request.Wait(IInferRequest::WaitMode::RESULT_READY);
+         if (status != OK) {
+             THROW_IE_EXCEPTION << "Inference failed with the status " << status;
+         }
+         double time = std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(slot.end - slot.start).count();
+         im.maxDuration = std::min(im.maxDuration, time);
+         im.minDuration = std::max(im.minDuration, time);
+         im.totalTime += time;
+         im.nRuns++;
+         progress.addProgress(slot.filesWatched);
+
+         auto firstOutputBlob = slot.request.GetBlob(firstOutputName);
          std::vector<unsigned> results;
          auto firstOutputData = firstOutputBlob->buffer().as<PrecisionTrait<Precision::FP32>::value_type*>();
          InferenceEngine::TopResults(TOP_COUNT, *firstOutputBlob, results);
 
-         for (size_t i = 0; i < b; i++) {
-             int expc = expected[i];
+         for (size_t i = 0; i < batch; i++) {
+             if (slot.files[i].empty()) continue;
+             int expc = slot.expected[i];
              if (zeroBackground) expc++;
 
              bool top1Scored = (static_cast<int>(results[0 + TOP_COUNT * i]) == expc);
-             dumper << "\"" + files[i] + "\"" << top1Scored;
+             dumper << "\"" + slot.files[i] + "\"" << top1Scored;
              if (top1Scored) im.top1Result++;
              for (int j = 0; j < TOP_COUNT; j++) {
                  unsigned classId = results[j + TOP_COUNT * i];
@@ -99,7 +127,58 @@ std::shared_ptr<Processor::InferenceMetrics> ClassificationProcessor::Process(bo
              dumper.endLine();
              im.total++;
          }
+     };
+
+     auto pipelineStart = std::chrono::high_resolution_clock::now();
+     auto iter = validationMap.begin();
+     size_t next = 0;
+     for (; iter != validationMap.end(); next = (next + 1) % slots.size()) {
+         Slot& slot = slots[next];
+         if (slot.busy) consume(slot);
+
+         slot.expected.assign(batch, 0);
+         slot.files.assign(batch, "");
+         slot.filesWatched = 0;
+         auto firstInputBlob = slot.request.GetBlob(firstInputName);
+         // the positions of the files which cannot be read are filled with the next files
+         std::vector<int> freePositions(batch);
+         for (size_t b = 0; b < batch; b++) freePositions[b] = static_cast<int>(batch - 1 - b);
+         while (!freePositions.empty() && iter != validationMap.end()) {
+             std::vector<std::pair<std::string, int>> images;
+             for (; !freePositions.empty() && iter != validationMap.end(); iter++, slot.filesWatched++) {
+                 images.emplace_back(iter->second, freePositions.back());
+                 slot.expected[freePositions.back()] = iter->first;
+                 freePositions.pop_back();
+             }
+             auto errors = decoder.insertIntoBlob(images, *firstInputBlob, preprocessingOptions);
+             for (size_t i = 0; i < images.size(); i++) {
+                 if (errors[i].empty()) {
+                     slot.files[images[i].second] = images[i].first;
+                 } else {
+                     // Could be some non-image file in directory
+                     slog::warn << "Can't read file " << images[i].first << slog::endl;
+                     slog::warn << "Error: " << errors[i] << slog::endl;
+                     freePositions.push_back(images[i].second);
+                 }
+             }
+         }
+
+         slot.done = false;
+         slot.start = std::chrono::high_resolution_clock::now();
+         slot.request.StartAsync();
+         slot.busy = true;
+     }
+     // the remaining requests in the order they were started
+     for (size_t r = 0; r < slots.size(); r++) {
+         Slot& slot = slots[(next + r) % slots.size()];
+         if (slot.busy) consume(slot);
+     }
+     // the callbacks refer to the slots, and the first request is kept by the processor
+     for (auto& slot : slots) {
+         slot.request.SetCompletionCallback([] {});
      }
+     im.pipelineTime = std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+             std::chrono::high_resolution_clock::now() - pipelineStart).count();
      progress.finish();
 
      return std::shared_ptr<Processor::InferenceMetrics>(new ClassificationInferenceMetrics(im));
@@ -114,6 +193,10 @@ void ClassificationProcessor::Report(const Processor::InferenceMetrics& im) {
                 << cim.total << " images were detected correctly, top class is correct)" << "\n";
         cout << "Top5 accuracy: " << OUTPUT_FLOATING(100.0 * cim.topCountResult / cim.total) << "% (" << cim.topCountResult << " of "
             << cim.total << " images were detected correctly, top five classes contain required class)" << "\n";
+        if (cim.pipelineTime > 0) {
+            cout << "Pipeline throughput: " << OUTPUT_FLOATING(1000.0 * cim.total / cim.pipelineTime) << " images per second ("
+                << inferRequestsNum << " infer requests, " << std::max<size_t>(decodeThreadsNum, 1) << " decode threads)" << "\n";
+        }
     }
 }
 
@@ -22,6 +22,8 @@ class ClassificationProcessor : public Processor {
         int top1Result = 0;
         int topCountResult = 0;
         int total = 0;
+        // wall time of the decode and inference pipeline
+        double pipelineTime = 0;
     };
 
 protected:
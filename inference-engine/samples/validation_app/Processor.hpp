@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <string>
@@ -37,6 +38,7 @@ protected:
     std::string targetDevice;
     std::string imagesPath;
     size_t batch;
+    InferenceEngine::ExecutableNetwork executableNetwork;
     InferenceEngine::InferRequest inferRequest;
     InferenceEngine::InputsDataMap inputInfo;
     InferenceEngine::OutputsDataMap outInfo;
@@ -51,12 +53,24 @@ protected:
 
     std::string approach;
 
+    // the processors supporting the pipeline decode the images in parallel and infer several requests asynchronously
+    size_t inferRequestsNum = 1;
+    size_t decodeThreadsNum = 1;
+
     double Infer(ConsoleProgress& progress, int filesWatched, InferenceMetrics& im);
 
 public:
     Processor(const std::string& flags_m, const std::string& flags_d, const std::string& flags_i, int flags_b,
             InferenceEngine::InferencePlugin plugin, CsvDumper& dumper, const std::string& approach, PreprocessingOptions preprocessingOptions);
 
+    /**
+     * @brief Sets the number of the infer requests and of the threads decoding the images of the pipeline
+     */
+    void setPipeline(size_t inferRequests, size_t decodeThreads) {
+        inferRequestsNum = std::max<size_t>(inferRequests, 1);
+        decodeThreadsNum = decodeThreads;
+    }
+
     virtual shared_ptr<InferenceMetrics> Process(bool stream_output = false) = 0;
     virtual void Report(const InferenceMetrics& im) {
         double averageTime = im.totalTime / im.nRuns;
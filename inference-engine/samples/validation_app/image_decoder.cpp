@@ -127,3 +127,73 @@ std::map<std::string, cv::Size> ImageDecoder::loadToBlob(std::vector<std::string
 Size ImageDecoder::insertIntoBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions) {
     return convertToBlob({ name }, batch_pos, blob, preprocessingOptions).at(name);
 }
+
+ParallelImageDecoder::ParallelImageDecoder(size_t threads) {
+    for (size_t i = 0; threads > 1 && i < threads; i++) {
+        _threads.emplace_back(&ParallelImageDecoder::work, this);
+    }
+}
+
+ParallelImageDecoder::~ParallelImageDecoder() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _taskAdded.notify_all();
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+}
+
+void ParallelImageDecoder::work() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _taskAdded.wait(lock, [this] { return _stop || !_tasks.empty(); });
+            if (_tasks.empty()) {
+                return;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop();
+        }
+        task();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _pending--;
+        }
+        _taskDone.notify_all();
+    }
+}
+
+std::vector<std::string> ParallelImageDecoder::insertIntoBlob(const std::vector<std::pair<std::string, int>>& images,
+                                                              Blob& blob, PreprocessingOptions preprocessingOptions) {
+    std::vector<std::string> errors(images.size());
+    // the images do not share the batch positions, so the tasks write the blob without synchronization
+    auto decode = [&](size_t i) {
+        try {
+            convertToBlob({ images[i].first }, images[i].second, blob, preprocessingOptions);
+        } catch (const std::exception& ex) {
+            errors[i] = ex.what();
+        }
+    };
+
+    if (_threads.empty()) {
+        for (size_t i = 0; i < images.size(); i++) {
+            decode(i);
+        }
+        return errors;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (size_t i = 0; i < images.size(); i++) {
+            _tasks.push([&decode, i] { decode(i); });
+        }
+        _pending += images.size();
+    }
+    _taskAdded.notify_all();
+    std::unique_lock<std::mutex> lock(_mutex);
+    _taskDone.wait(lock, [this] { return _pending == 0; });
+    return errors;
+}
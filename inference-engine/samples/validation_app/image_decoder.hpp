@@ -4,7 +4,13 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
 
 #include <opencv2/core/core.hpp>
 #include <opencv2/core/mat.hpp>
@@ -47,3 +53,37 @@ public:
      */
     Size insertIntoBlob(std::string name, int batch_pos, Blob& blob, PreprocessingOptions preprocessingOptions);
 };
+
+/**
+ * @brief Decodes the images of a batch in parallel: every image is decoded and preprocessed into its own batch
+ * position of the blob by a pool of worker threads
+ */
+class ParallelImageDecoder {
+public:
+    /**
+     * @param threads - number of the worker threads, the images are decoded by the calling thread for 0 or 1
+     */
+    explicit ParallelImageDecoder(size_t threads);
+    ~ParallelImageDecoder();
+
+    /**
+     * @brief Inserts the images to the blob at their batch positions and waits for all of them.
+     *        Does no checks if blob has sufficient space
+     * @param images - image file names and distinct batch positions
+     * @param blob - blob object to load images data to
+     * @return the error messages of the images which cannot be read, empty for the loaded ones
+     */
+    std::vector<std::string> insertIntoBlob(const std::vector<std::pair<std::string, int>>& images, Blob& blob,
+                                            PreprocessingOptions preprocessingOptions);
+
+private:
+    void work();
+
+    std::vector<std::thread> _threads;
+    std::queue<std::function<void()>> _tasks;
+    std::mutex _mutex;
+    std::condition_variable _taskAdded;
+    std::condition_variable _taskDone;
+    size_t _pending = 0;
+    bool _stop = false;
+};
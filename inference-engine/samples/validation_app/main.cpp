@@ -19,6 +19,7 @@
 #include <limits>
 #include <iomanip>
 #include <memory>
+#include <thread>
 
 #include <ext_list.hpp>
 
@@ -96,6 +97,12 @@ static const char zero_background_message[] = "\"Zero is a background\" flag. So
 
 static const char plain_output_message[] = "Flag for plain output";
 
+static const char infer_requests_message[] = "Number of the infer requests inferred asynchronously while the next images"
+                                             " are decoded. Default value is 2";
+
+static const char decode_threads_message[] = "Number of the threads decoding the images of a batch in parallel."
+                                             " Default value is 0, the number of the logical cores";
+
 
 /// @brief Network type options and their descriptions
 static const char* types_descriptions[][2] = {
@@ -164,6 +171,10 @@ DEFINE_bool(plain, false, plain_output_message);
 
 DEFINE_string(lbl, "", labels_file_message);
 
+DEFINE_int32(nireq, 2, infer_requests_message);
+
+DEFINE_int32(decode_threads, 0, decode_threads_message);
+
 /**
  * @brief This function shows a help message
  */
@@ -193,6 +204,8 @@ static void showUsage() {
     std::cout << std::endl;
     std::cout << "    Classification-specific options:" << std::endl;
     std::cout << "      -Czb true               " << zero_background_message << std::endl;
+    std::cout << "      -nireq N                " << infer_requests_message << std::endl;
+    std::cout << "      -decode_threads N       " << decode_threads_message << std::endl;
 
     std::cout << std::endl;
     std::cout << "    Object detection-specific options:" << std::endl;
@@ -252,6 +265,8 @@ int main(int argc, char *argv[]) {
         if (FLAGS_i.empty()) ee << UserException(4, "Images list is not specified (missing -i option)");
         if (FLAGS_d.empty()) ee << UserException(5, "Target device is not specified (missing -d option)");
         if (FLAGS_b < 0) ee << UserException(6, "Batch must be positive (invalid -b option value)");
+        if (FLAGS_nireq < 1) ee << UserException(7, "Number of infer requests must be positive (invalid -nireq option value)");
+        if (FLAGS_decode_threads < 0) ee << UserException(8, "Number of decode threads must not be negative (invalid -decode_threads option value)");
 
         if (netType == ObjDetection) {
             // Checking required OD-specific options
@@ -336,6 +351,7 @@ int main(int argc, char *argv[]) {
         if (!processor.get()) {
             THROW_USER_EXCEPTION(2) <<  "Processor pointer is invalid" << FLAGS_ppType;
         }
+        processor->setPipeline(FLAGS_nireq, FLAGS_decode_threads > 0 ? FLAGS_decode_threads : std::thread::hardware_concurrency());
         slog::info << (FLAGS_d.empty() ? "Plugin: " + FLAGS_p : "Device: " + FLAGS_d) << slog::endl;
         shared_ptr<Processor::InferenceMetrics> pIM = processor->Process(FLAGS_plain);
         processor->Report(*pIM.get());
@@ -9,6 +9,7 @@
 #include <map>
 #include <vector>
 #include <iostream>
+#include <fstream>
 #include <cmath>
 #include <debug.h>
 #include <ie_data.h>
@@ -27,6 +28,7 @@
 #include "cldnn_engine.h"
 #include "cldnn_graph.h"
 #include "cldnn_custom_layer.h"
+#include "cldnn_model_serial.h"
 
 #ifdef __linux__
 #include <dlfcn.h>
@@ -42,6 +44,8 @@ namespace CLDNNPlugin {
 
 struct clDNNEngine::impl {
     CLDNNGraph::Config m_config;
+    // the program binaries of the network being imported
+    std::shared_ptr<const CLDNNGraph::ProgramBinaries> m_importedBinaries;
 };
 
 clDNNEngine::clDNNEngine() {
@@ -91,6 +95,7 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(InferenceEngine::
 
     CLDNNGraph::Config conf = this->_impl->m_config;
     conf.LoadFromMap(config);
+    conf.programBinaries = this->_impl->m_importedBinaries;
 
     // verification of supported input
     InferenceEngine::InputsDataMap _networkInputs;
@@ -113,17 +118,31 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(InferenceEngine::
     return std::make_shared<CLDNNGraph>(network, conf, max_batch);
 }
 
-INFERENCE_PLUGIN_API(StatusCode) CreatePluginEngine(IInferencePlugin *&plugin, ResponseDesc *resp) noexcept {
+IExecutableNetwork::Ptr clDNNEngine::ImportNetwork(const std::string &modelFileName,
+                                                   const std::map<std::string, std::string> &config) {
+    std::ifstream is(modelFileName, std::ios::in | std::ios::binary);
+    if (!is.is_open())
+        THROW_IE_EXCEPTION << "Cannot open file " << modelFileName << " for the import";
+
+    CNNNetReader reader;
+    std::map<std::string, std::string> importConfig;
+    auto binaries = std::make_shared<CLDNNGraph::ProgramBinaries>();
+    CLDNNModelSerial::Import(is, reader, importConfig, *binaries);
+    // the import config overrides the one the network was exported with
+    for (const auto &it : config)
+        importConfig[it.first] = it.second;
+
+    IExecutableNetwork::Ptr executableNetwork;
+    CNNNetwork network = reader.getNetwork();
+    _impl->m_importedBinaries = binaries;
     try {
-        plugin = make_ie_compatible_plugin(
-                {1, 6,
-                 CI_BUILD_NUMBER,
-                 "clDNNPlugin"}, std::make_shared<clDNNEngine>());
-        return OK;
-    }
-    catch (std::exception &ex) {
-        return DescriptionBuffer(GENERAL_ERROR, resp) << ex.what();
+        LoadNetwork(executableNetwork, network, importConfig);
+    } catch (...) {
+        _impl->m_importedBinaries.reset();
+        throw;
     }
+    _impl->m_importedBinaries.reset();
+    return executableNetwork;
 }
 
 void clDNNEngine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -26,6 +26,12 @@ public:
     InferenceEngine::ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network,
                                                                        const std::map<std::string, std::string> &config) override;
 
+    /**
+     * @brief Loads the network exported by CLDNNGraph::Export, the OpenCL programs are created from their binaries
+     */
+    InferenceEngine::IExecutableNetwork::Ptr ImportNetwork(const std::string &modelFileName,
+                                                           const std::map<std::string, std::string> &config) override;
+
     void SetConfig(const std::map<std::string, std::string> &config) override;
     /**
      * @depricated Use the version with config parameter
@@ -47,6 +47,7 @@
 #include <CPP/shuffle_channels.hpp>
 #include <CPP/strided_slice.hpp>
 #include <CPP/reverse_sequence.hpp>
+#include <CPP/nv12_to_bgr.hpp>
 #include <chrono>
 #include <cmath>
 #include <algorithm>
@@ -57,7 +58,11 @@
 #include <graph_tools.hpp>
 #include <ie_layers_internal.hpp>
 #include <net_pass.h>
+#include <ie_util_internal.hpp>
+#include <precision_utils.h>
+#include <details/ie_cnn_network_tools.h>
 #include "cldnn_infer_request.h"
+#include "cldnn_model_serial.h"
 #include <cpp_interfaces/ie_executor_manager.hpp>
 #include "details/caseless.hpp"
 #include <fstream>
@@ -87,11 +92,13 @@ const cldnn::primitive_id CLDNNGraph::m_preProcessTag("_cldnn_input_preprocess")
 const cldnn::primitive_id CLDNNGraph::m_weightsTag("_cldnn_weights");
 const cldnn::primitive_id CLDNNGraph::m_biasesTag("_cldnn_biases");
 const cldnn::primitive_id CLDNNGraph::m_meanValuesTag("_cldnn_mean_values");
+const cldnn::primitive_id CLDNNGraph::m_nv12ToBgrTag("_cldnn_nv12_to_bgr");
 const cldnn::primitive_id CLDNNGraph::m_postProcessTag("_cldnn_output_postprocess");
 const cldnn::primitive_id CLDNNGraph::m_scalesTag("_cldnn_scales");
 const cldnn::primitive_id CLDNNGraph::m_workaroundTag("_cldnn_workaround");
 const cldnn::primitive_id CLDNNGraph::m_preCustomLayerTag("_cldnn_custom_preprocess");
 const cldnn::primitive_id CLDNNGraph::m_postCustomLayerTag("_cldnn_custom_postprocess");
+const cldnn::primitive_id CLDNNGraph::m_precisionTag("_cldnn_precision");
 
 static void ValidateLayer(const InferenceEngine::CNNLayerPtr& layer, unsigned inputs) {  // todo: add more checks
     if (inputs && layer->insData.size() != inputs) {
@@ -108,6 +115,34 @@ static void ValidateEltwiseLayer(const InferenceEngine::CNNLayerPtr& layer) {
     }
 }
 
+// converts the FP32 layers to FP16 except the given types, the data keeps its precision, so the outputs are FP32
+static void ConvertToFP16(InferenceEngine::ICNNNetwork& network, const caseless_set<std::string>& fp32Layers) {
+    for (auto& layer : CNNNetSortTopologically(network)) {
+        if (layer->precision != Precision::FP32 || fp32Layers.find(layer->type) != fp32Layers.end())
+            continue;
+        layer->precision = Precision::FP16;
+
+        for (auto& blob : layer->blobs) {
+            if (blob.second->precision() != Precision::FP32)
+                continue;
+            const auto& desc = blob.second->getTensorDesc();
+            auto fp16Blob = make_shared_blob<uint16_t>(TensorDesc(Precision::FP16, desc.getDims(), desc.getLayout()));
+            fp16Blob->allocate();
+            PrecisionUtils::f32tof16Arrays(fp16Blob->buffer().as<short*>(), blob.second->cbuffer().as<const float*>(),
+                                           blob.second->size());
+            blob.second = fp16Blob;
+        }
+        if (auto weightable = dynamic_cast<WeightableLayer*>(layer.get())) {
+            auto weights = layer->blobs.find("weights");
+            if (weights != layer->blobs.end())
+                weightable->_weights = weights->second;
+            auto biases = layer->blobs.find("biases");
+            if (biases != layer->blobs.end())
+                weightable->_biases = biases->second;
+        }
+    }
+}
+
 #if defined(_WIN32)
 #define mkdir(dir, mode) _mkdir(dir)
 #endif
@@ -229,6 +264,87 @@ void CLDNNGraph::Config::LoadFromMap(const std::map<std::string, std::string>& c
                 sources_dumps_dir = val;
                 mkdir(sources_dumps_dir.c_str(), 0755);
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_DIR) == 0) {
+            if (!val.empty()) {
+                kernels_cache_dir = val;
+                mkdir(kernels_cache_dir.c_str(), 0755);
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_KERNELS_BUILD_THREADS) == 0) {
+            std::stringstream ss(val);
+            uint16_t uVal(0);
+            ss >> uVal;
+            if (ss.fail()) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            kernelsBuildThreads = uVal;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_THROUGHPUT_STREAMS) == 0) {
+            std::stringstream ss(val);
+            uint16_t uVal(0);
+            ss >> uVal;
+            if (ss.fail() || uVal == 0) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            throughputStreams = uVal;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_NV12_INPUT_SIZE) == 0) {
+            std::stringstream ss(val);
+            size_t width(0), height(0);
+            char separator(0);
+            ss >> width >> separator >> height;
+            if (ss.fail() || !ss.eof() || separator != 'x' || width == 0 || height == 0 || width % 2 || height % 2) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            nv12Width = width;
+            nv12Height = height;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_DETECTION_OUTPUT_GPU) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                detectionOutputGpu = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                detectionOutputGpu = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_FP16_AUTO) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                fp16Auto = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                fp16Auto = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_WARM_UP) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                warmUp = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                warmUp = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_FP32_LAYERS) == 0) {
+            std::stringstream ss(val);
+            std::string type;
+            fp32Layers.clear();
+            while (std::getline(ss, type, ',')) {
+                if (!type.empty())
+                    fp32Layers.insert(type);
+            }
+        } else if (key.compare(PluginConfigParams::KEY_DEVICE_ID) == 0) {
+            deviceIds.clear();
+            if (val.compare(CLDNNConfigParams::CLDNN_ALL_DEVICES) != 0) {
+                std::stringstream ss(val);
+                std::string id;
+                while (std::getline(ss, id, ',')) {
+                    std::stringstream idStream(id);
+                    uint16_t uVal(0);
+                    idStream >> uVal;
+                    if (idStream.fail() || !idStream.eof()) {
+                        THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+                    }
+                    deviceIds.push_back(uVal);
+                }
+                if (deviceIds.empty()) {
+                    THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+                }
+            }
         } else if (key.compare(PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0) {
                 exclusiveAsyncRequests = true;
@@ -287,20 +403,18 @@ bool CLDNNGraph::CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const
 }
 
 CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& config, int max_batch) : m_config(config),
+    m_nextStream(0),
     m_defaultFormat(cldnn::format::bfyx),
     m_curBatch(-1) {
-    m_env.engine = std::make_shared<cldnn::engine>(cldnn::engine_configuration(
-        (config.useProfiling || (config.tuningConfig.mode != cldnn::tuning_mode::tuning_disabled)),
-        false,
-        config.dumpCustomKernels,
-        std::string(),
-        std::string(),
-        true,
-        std::string(),
-        config.sources_dumps_dir,
-        config.queuePriority,
-        config.queueThrottle,
-        config.memory_pool_on));
+    std::vector<uint16_t> deviceIds = config.deviceIds;
+    if (deviceIds.empty()) {
+        const auto devices = cldnn::engine::engine_count(cldnn::engine_types::ocl);
+        for (uint32_t device = 0; device < devices; device++)
+            deviceIds.push_back(static_cast<uint16_t>(device));
+        if (deviceIds.empty())
+            THROW_CLDNN_EXCEPTION("No GPU devices are found");
+    }
+    m_env.engine = CreateEngine(config, deviceIds.front());
 #if 0
         m_env.debugOptions.PrintOptions();
 #endif
@@ -309,6 +423,7 @@ CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& conf
         _taskExecutor = executorManager->getExecutor(TargetDeviceInfo::name(TargetDevice::eGPU));
     }
 
+    std::unique_ptr<LoadPhaseScope> transformations(new LoadPhaseScope("NetworkTransformations"));
     bool res = !NetPass::CombineRNNSeq(network) ? NetPass::UnrollTI(network) : true;
     res &= NetPass::UnrollRNN_if(network, [] (RNNCellBase rnn) -> bool {
         if (rnn.clip != 0.0f)
@@ -328,6 +443,22 @@ CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& conf
         THROW_CLDNN_EXCEPTION("Plugin doesn't support Tensor Iterator in pure form. "
                               "No one TI optimization pattern was not applied successfully");
 
+    m_transformedNetwork = cloneNet(network);
+    // the conversion works on a copy, so the network of the user keeps its precision
+    InferenceEngine::ICNNNetwork* loadedNetwork = &network;
+    InferenceEngine::ICNNNetwork::Ptr fp16Network;
+    if (config.fp16Auto && network.getPrecision() == Precision::FP32) {
+        fp16Network = cloneNet(network);
+        ConvertToFP16(*fp16Network, config.fp32Layers);
+        loadedNetwork = fp16Network.get();
+    }
+    transformations.reset();
+
+    if (max_batch > 1 && config.throughputStreams > 1)
+        THROW_CLDNN_EXCEPTION("Throughput streams are not supported with dynamic batch!");
+    if (max_batch > 1 && deviceIds.size() > 1)
+        THROW_CLDNN_EXCEPTION("Several devices are not supported with dynamic batch!");
+
     if (max_batch > 1) {
         // check topology for applicability
         if (!CanProcessDynBatch(network)) {
@@ -364,28 +495,107 @@ CLDNNGraph::CLDNNGraph(InferenceEngine::ICNNNetwork& network, const Config& conf
             m_env.inputLayouts.clear();
             m_env.outputDims.clear();
             m_env.primitiveIDs.clear();
+            m_precisionReorders.clear();
 
             changeInputBatch(1 << b);
-            Load(network);
+            Load(*loadedNetwork);
             CompileNetwork();
             m_env.batchNetworks.insert(m_env.batchNetworks.begin(), m_env.network);
 
             m_topology.reset();
             m_env.engine->release_pending_memory();
         }
+        m_blobMemories.clear();
     } else {
         m_topology = std::make_shared<cldnn::topology>(cldnn::topology());
-        Load(network);
+        Load(*loadedNetwork);
         CompileNetwork();
         m_topology.reset();
         m_env.engine->release_pending_memory();
+        m_streamEngines.assign(m_streamNetworks.size(), m_env.engine);
+
+        // every other device gets its own copy of the network, its streams follow the ones of the first device
+        const InferenceEnv firstDeviceEnv = m_env;
+        auto streamNetworks = m_streamNetworks;
+        for (size_t device = 1; device < deviceIds.size(); device++) {
+            m_env.engine = CreateEngine(config, deviceIds[device]);
+            // the program binaries are named by their sources, the device and its driver, so the devices of the same
+            // model load the programs compiled for the first one instead of compiling them again
+            for (const auto& name : firstDeviceEnv.engine->get_program_binary_names())
+                m_env.engine->add_program_binary(name, firstDeviceEnv.engine->get_program_binary(name));
+
+            m_topology = std::make_shared<cldnn::topology>(cldnn::topology());
+            m_env.inputLayouts.clear();
+            m_env.outputDims.clear();
+            m_env.primitiveIDs.clear();
+            m_env.profilingIDs.clear();
+            m_precisionReorders.clear();
+            Load(*loadedNetwork);
+            CompileNetwork();
+            m_topology.reset();
+            m_env.engine->release_pending_memory();
+            streamNetworks.insert(streamNetworks.end(), m_streamNetworks.begin(), m_streamNetworks.end());
+            m_streamEngines.insert(m_streamEngines.end(), m_streamNetworks.size(), m_env.engine);
+        }
+        if (deviceIds.size() > 1) {
+            m_env = firstDeviceEnv;
+            m_streamNetworks = streamNetworks;
+            _metrics = std::make_shared<MetricsRegistry>(m_streamNetworks.size());
+        }
+    }
+
+    // every stream executes the requests in its own thread, unless all the requests are muxed into a single queue
+    m_streamExecutors.assign(1, _taskExecutor);
+    m_streamSynchronizers.assign(1, _taskSynchronizer);
+    for (size_t stream = 1; stream < m_streamNetworks.size(); stream++) {
+        m_streamExecutors.push_back(config.exclusiveAsyncRequests ? _taskExecutor : std::make_shared<TaskExecutor>());
+        m_streamSynchronizers.push_back(config.exclusiveAsyncRequests ? _taskSynchronizer : std::make_shared<TaskSynchronizer>());
     }
 
+    if (config.warmUp)
+        WarmUp();
+
     m_env.debugOptions.AddTimedEvent("Loading", "Loading Begin");
     m_env.debugOptions.PrintTimedEvents();
     m_env.debugOptions.ClearTimedEvents();
 }
 
+std::shared_ptr<const cldnn::engine> CLDNNGraph::CreateEngine(const Config& config, uint16_t deviceId) {
+    auto engine = std::make_shared<cldnn::engine>(cldnn::engine_types::ocl, deviceId, cldnn::engine_configuration(
+        (config.useProfiling || (config.tuningConfig.mode != cldnn::tuning_mode::tuning_disabled)),
+        false,
+        config.dumpCustomKernels,
+        std::string(),
+        std::string(),
+        true,
+        std::string(),
+        config.sources_dumps_dir,
+        config.queuePriority,
+        config.queueThrottle,
+        config.memory_pool_on,
+        nullptr,
+        "cache.json",
+        config.kernels_cache_dir,
+        config.kernelsBuildThreads,
+        config.throughputStreams));
+    if (config.programBinaries) {
+        for (const auto& binary : *config.programBinaries)
+            engine->add_program_binary(binary.first, binary.second);
+    }
+    return engine;
+}
+
+void CLDNNGraph::Export(const std::string &modelFileName) {
+    ProgramBinaries binaries;
+    for (const auto& name : m_env.engine->get_program_binary_names())
+        binaries[name] = m_env.engine->get_program_binary(name);
+
+    std::ofstream os(modelFileName, std::ios::out | std::ios::binary);
+    if (!os.is_open())
+        THROW_IE_EXCEPTION << "Cannot open file " << modelFileName << " for the export";
+    CLDNNModelSerial::Export(os, *m_transformedNetwork, m_config, binaries, _networkInputs, _networkOutputs);
+}
+
 inline std::string layer_type_name_ID(InferenceEngine::CNNLayer* layer) {
     return layer->type + ":" + layer->name;
 }
@@ -449,13 +659,53 @@ void CLDNNGraph::CompileNetwork() {
     }
     options.set_option(cldnn::build_option::optimize_data(true));
     options.set_option(cldnn::build_option::tuning_config(m_config.tuningConfig));
+    options.set_option(cldnn::build_option::detection_output_gpu(m_config.detectionOutputGpu));
 
+    // the graph optimizations, the kernels selection and compilation and the weights reorders of clDNN
+    std::unique_ptr<LoadPhaseScope> build(new LoadPhaseScope("ProgramBuild"));
+    cldnn::program program(*(m_env.engine), *m_topology, options);
+    build.reset();
+    LoadPhaseScope phase("NetworkCreation");
     m_env.network.reset();
-    m_env.network = std::make_shared<cldnn::network>(cldnn::network(*(m_env.engine), *m_topology, options));
+    m_env.network = std::make_shared<cldnn::network>(program, 0);
+    // the networks of the streams share the compiled program and the memory of its constant data (weights)
+    m_streamNetworks.assign(1, m_env.network);
+    for (uint16_t stream = 1; stream < m_config.throughputStreams; stream++)
+        m_streamNetworks.push_back(std::make_shared<cldnn::network>(program, stream));
+    _metrics = std::make_shared<MetricsRegistry>(m_streamNetworks.size());
     m_env.debugOptions.AddTimedEvent("Network Build", "Network Build Begin");
 }
 
+void CLDNNGraph::WarmUp() {
+    LoadPhaseScope phase("WarmUp");
+    auto execute = [&](const std::shared_ptr<cldnn::network>& network, int batch) {
+        for (const auto& input : m_env.inputLayouts) {
+            auto layout = input.second;
+            if (batch > 0)
+                layout.size.batch[0] = batch;
+            auto memory = cldnn::memory::allocate(network->get_engine(), layout);
+            {
+                auto ptr = memory.pointer<uint8_t>();
+                std::fill(ptr.begin(), ptr.end(), 0);
+            }
+            network->set_input_data("Input:" + input.first, memory);
+        }
+        // waiting for all the outputs makes every kernel of the network run once
+        for (auto& output : network->execute())
+            output.second.get_event().wait();
+    };
+
+    // the networks of the dynamic batch are compiled for the batches of the powers of two
+    for (size_t b = 0; b < m_env.batchNetworks.size(); b++)
+        execute(m_env.batchNetworks[b], 1 << b);
+    if (m_env.batchNetworks.empty()) {
+        for (const auto& network : m_streamNetworks)
+            execute(network, 0);
+    }
+}
+
 void CLDNNGraph::Load(InferenceEngine::ICNNNetwork &network) {
+    LoadPhaseScope phase("TopologyCreation");
     InitFormat(network);
     auto _networkPrecision = network.getPrecision();
 
@@ -527,6 +777,7 @@ void CLDNNGraph::Load(InferenceEngine::ICNNNetwork &network) {
         }
 
         infLoopProtection = 0;  // found a layer with all inputs already existing
+        AddPrecisionReorders(currLayer);
         CreateSingleLayerPrimitive(currLayer);  // currLayer will be advanced if layer was skipped or merged
         m_env.prevPrimitiveIDs[layerName] = GetPrevLayersPrimitives(currLayer);
 
@@ -686,6 +937,17 @@ void CLDNNGraph::CreatePrimitiveFromBlob(cldnn::primitive_id primID,
                                          cldnn::layout blobLayout,
                                          size_t blobByteOffset,
                                          WeightRearrangeType rearrange) {
+    if (pBlob != nullptr) {
+        auto cached = m_blobMemories.equal_range(pBlob->cbuffer().as<const void*>());
+        for (auto it = cached.first; it != cached.second; ++it) {
+            const auto& blobMemory = it->second;
+            if (blobMemory.byteOffset == blobByteOffset && blobMemory.rearrange == rearrange && blobMemory.layout == blobLayout) {
+                m_topology->add(cldnn::data(primID, blobMemory.memory));
+                return;
+            }
+        }
+    }
+
     auto mem = cldnn::memory::allocate(*(m_env.engine), blobLayout);
     auto tmpPointer = mem.pointer<char>();  // implicitly maps buffer - unmap in destructor
     auto buf = tmpPointer.data();
@@ -746,6 +1008,10 @@ void CLDNNGraph::CreatePrimitiveFromBlob(cldnn::primitive_id primID,
         }
     }
     m_topology->add(cldnn::data(primID, mem));
+    if (m_env.m_max_batch > 1) {
+        m_blobMemories.emplace(pBlob->cbuffer().as<const void*>(),
+                               BlobMemory{ pBlob, blobByteOffset, rearrange, blobLayout, mem });
+    }
 }
 
 void CLDNNGraph::CreateWeightAndBiasPrimitives(const InferenceEngine::CNNLayerPtr& layer,
@@ -1737,7 +2003,9 @@ void CLDNNGraph::CreateCustomLayerPrimitive(InferenceEngine::CNNLayerPtr & layer
             THROW_CLDNN_EXCEPTION("Invalid custom layer param type: " << param.type << " in layer: " << genericLayer->name);
         }
     }
-    const std::string layerTitle("\n// Layer " + layer->name + " using Custom Layer " + customLayer->Name() + "\n");
+    // the source does not name the layer, so the layers with the same defines and shapes share the kernel,
+    // and its cached binary is found for the other networks
+    const std::string layerTitle("\n// Custom Layer " + customLayer->Name() + "\n");
     const std::string defineTitle("// Custom Layer User Defines\n");
 
     auto dims = genericLayer->outData[0]->dims;
@@ -3003,6 +3271,57 @@ void CLDNNGraph::CreateRNNPrimitive(InferenceEngine::CNNLayerPtr &layer) {
     m_topology->add(cldnn::reshape(inHiddenReshapeID+"_1", inputPrimitives[1], hiddenStateShape));
     m_topology->add(cldnn::reshape(inHiddenReshapeID+"_2", inputPrimitives[2], hiddenStateShape));
 
+    cldnn::tensor hiddenSz = cldnn::tensor{ lstm_batch_size, 1, lstm_hidden_size, 1 };
+    cldnn::tensor cellCropSz = cldnn::tensor{0, 1, 0, 0};
+    std::string hiddenStr = hasInitialHidden ? inHiddenReshapeID+"_1" : "";
+    std::string cellStr = hasInitialCell ? inHiddenReshapeID+"_2" : "";
+
+    if (isForward) {
+        // the forward sequence is a single lstm primitive, clDNN runs it as one kernel iterating over the steps
+        cldnn::primitive_id lstmID = layerName + "_lstm";
+        cldnn::primitive_id lstmInputID = permuteID;
+        if (permute_input) {
+            lstmInputID = layerName + "_inputSwap";
+            m_topology->add(cldnn::permute(lstmInputID, permuteID, { 1, 0, 2, 3 }));
+        }
+        bool emitCell = layer->outData.size() > 2;
+        m_topology->add(cldnn::lstm(lstmID, { lstmInputID }, weightID, recurrentID,
+                                    hasBias ? biasID : "", hiddenStr, cellStr, "", 0, false, {}, {},
+                                    emitCell ? cldnn_lstm_output_sequence_cell : cldnn_lstm_output_sequence,
+                                    cldnn_lstm_offset_order_fizo));
+
+        cldnn::primitive_id outputCropID = permute_input ? layerName + "_outputCrop" : layerName;
+        m_topology->add(cldnn::crop(outputCropID, lstmID,
+                                    cldnn::tensor{ lstm_batch_size, lstm_sequence_len, lstm_hidden_size, 1 },
+                                    cldnn::tensor{ 0, 0, 0, 0 }));
+        if (permute_input) {
+            m_topology->add(cldnn::permute(layerName, outputCropID, { 1, 0, 2, 3 }));
+        }
+
+        // last hidden state crop (output 2)
+        if (layer->outData.size() > 1) {
+            hiddenStr = layerName + "_lastHidden";
+            m_topology->add(cldnn::crop(hiddenStr, lstmID, hiddenSz, cldnn::tensor{ 0, lstm_sequence_len - 1, 0, 0 }));
+            cldnn::primitive_id outputHiddenID = layer->type + ":" + layer->outData[1]->name;
+            m_env.primitiveIDs[hiddenStr] = hiddenStr;
+            m_env.primitiveIDs[outputHiddenID] = hiddenStr;
+        }
+
+        // last cell state crop (output 3)
+        if (emitCell) {
+            cellStr = layerName + "_lastCell";
+            m_topology->add(cldnn::crop(cellStr, lstmID, hiddenSz, cldnn::tensor{ 0, lstm_sequence_len, 0, 0 }));
+            cldnn::primitive_id outputCellID = layer->type + ":" + layer->outData[2]->name;
+            m_env.primitiveIDs[cellStr] = cellStr;
+            m_env.primitiveIDs[outputCellID] = cellStr;
+        }
+
+        m_env.primitiveIDs[layerName] = layerName;
+        m_env.primitiveIDs[layer->type + ":" + layer->outData[0]->name] = layerName;
+        m_env.profilingIDs.push_back(layerName);
+        return;
+    }
+
     for (int i = 0; i < lstm_sequence_len; ++i)
         input_ids_offsets.push_back({ get_string_id(i), {0, i, 0, 0} });
 
@@ -3015,11 +3334,6 @@ void CLDNNGraph::CreateRNNPrimitive(InferenceEngine::CNNLayerPtr &layer) {
         m_topology->add(cldnn::split(inputSplitID, permuteID, input_ids_offsets));
     }
 
-    cldnn::tensor hiddenSz = cldnn::tensor{ lstm_batch_size, 1, lstm_hidden_size, 1 };
-    cldnn::tensor cellCropSz = cldnn::tensor{0, 1, 0, 0};
-    std::string hiddenStr = hasInitialHidden ? inHiddenReshapeID+"_1" : "";
-    std::string cellStr = hasInitialCell ? inHiddenReshapeID+"_2" : "";
-
     for (int i = 0; i < lstm_sequence_len; ++i) {
         std::string lstm_gemm_id = layerName + "_lstm_gemm" + get_string_id(i);
         std::string lstm_elt_id = layerName + "_lstm_elt" + get_string_id(i);
@@ -3159,6 +3473,8 @@ void CLDNNGraph::CreateGatherPrimitive(InferenceEngine::CNNLayerPtr &layer) {
     auto gatherLayer = dynamic_cast<InferenceEngine::GenericLayer*> (layer.get());
 
     int axis = gatherLayer->GetParamAsInt("axis", 0);
+    if (!gatherLayer->GetParamAsString("reduction", "").empty())
+        THROW_CLDNN_EXCEPTION("Gather with reduction is not supported: " << layer->name);
 
     // Be careful, TensorFlow consist negative axis interpretation bug. Here: -3 = b, -2 = f, -1 = y, but must be -3 = f, -2 = y, -1 = x
     auto cldnnAxisFromIE = [](int axis) {
@@ -3368,6 +3684,11 @@ bool CLDNNGraph::IsValidSplitConvMerge(const InferenceEngine::SplitLayer *splitL
     return true;
 }
 
+bool CLDNNGraph::IsNV12Input(const InferenceEngine::InputInfo::Ptr& inputInfo) const {
+    const auto& dims = inputInfo->getTensorDesc().getDims();
+    return m_config.nv12Width != 0 && dims.size() == 4 && dims[1] == 3;
+}
+
 void CLDNNGraph::AddInputPrimitive(InferenceEngine::InputInfo::Ptr inputInfo, Precision inputPrecision) {
     // first create and add the input layout
     auto inputDims = inputInfo->getDims();
@@ -3420,11 +3741,24 @@ void CLDNNGraph::AddInputPrimitive(InferenceEngine::InputInfo::Ptr inputInfo, Pr
         FormatFromLayout(l),
         dataTensor);
 
-    // save the input dims
-    m_env.inputLayouts.insert({ inputInfo->name(), inputLayout });
-
     auto inputName = "Input:" + inputInfo->name();
-    m_topology->add(cldnn::input_layout(inputName, inputLayout));
+    auto preprocessInputID = inputName;
+    if (IsNV12Input(inputInfo)) {
+        // the input takes the NV12 frames, which are converted to the images of the network input first
+        cldnn::layout frameLayout(cldnn::data_types::u8, cldnn::format::bfyx,
+            cldnn::tensor(batch, 1, TensorValue(m_config.nv12Width), TensorValue(m_config.nv12Height * 3 / 2)));
+        m_env.inputLayouts.insert({ inputInfo->name(), frameLayout });
+        m_topology->add(cldnn::input_layout(inputName, frameLayout));
+
+        preprocessInputID = inputName + m_nv12ToBgrTag;
+        m_topology->add(cldnn::nv12_to_bgr(preprocessInputID, inputName, dataTensor, DataTypeFromPrecision(inputPrecision)));
+        m_env.profilingIDs.push_back(preprocessInputID);
+        InitProfileInfo(preprocessInputID, "NV12ToBGR");
+    } else {
+        // save the input dims
+        m_env.inputLayouts.insert({ inputInfo->name(), inputLayout });
+        m_topology->add(cldnn::input_layout(inputName, inputLayout));
+    }
 
     // create preprocess primitive for this input
     auto preProcess = inputInfo->getPreProcess();
@@ -3446,12 +3780,10 @@ void CLDNNGraph::AddInputPrimitive(InferenceEngine::InputInfo::Ptr inputInfo, Pr
         std::vector<float> meanValues;
         if (meanChannels > 0) {
             for (size_t c = 0; c < meanChannels; c++) {
-                if (fabs(preProcess[c]->stdScale - 1.0f) > 1e-10)
-                    THROW_CLDNN_EXCEPTION("not supporting stdScale yet in input " + inputName);
                 meanValues.push_back(preProcess[c]->meanValue);
             }
         }
-        m_topology->add(cldnn::reorder(preprocessPrimID, inputName, inputLayout, meanValues));
+        m_topology->add(cldnn::reorder(preprocessPrimID, preprocessInputID, inputLayout, meanValues));
         m_env.profilingIDs.push_back(preprocessPrimID);
         InitProfileInfo(preprocessPrimID, "Reorder");
     }
@@ -3473,8 +3805,6 @@ void CLDNNGraph::AddInputPrimitive(InferenceEngine::InputInfo::Ptr inputInfo, Pr
         meanBlob.allocate();
         auto meanBlobData = meanBlob.data();
         for (size_t c = 0; c < meanChannels; c++) {
-            if (fabs(preProcess[c]->stdScale - 1.0f) > 1e-10)
-                THROW_CLDNN_EXCEPTION("not supporting stdScale yet in input " + inputName);
             auto channelMeanBlob = std::dynamic_pointer_cast<TBlob<float>>(preProcess[c]->meanData);
             auto channelSize = channelMeanBlob->size();
             auto channelBlobData = channelMeanBlob->data();
@@ -3494,7 +3824,7 @@ void CLDNNGraph::AddInputPrimitive(InferenceEngine::InputInfo::Ptr inputInfo, Pr
             meanBlobPtr,
             meanBlobLayout);
         m_topology->add(cldnn::reorder(preprocessPrimID,
-            inputName,
+            preprocessInputID,
             inputLayout,
             inputName + m_meanValuesTag));
         m_env.profilingIDs.push_back(preprocessPrimID);
@@ -3505,6 +3835,27 @@ void CLDNNGraph::AddInputPrimitive(InferenceEngine::InputInfo::Ptr inputInfo, Pr
     default: THROW_CLDNN_EXCEPTION("Invalid mean variant in input " + inputName);
         break;
     }
+
+    // the std scales are applied on the device as well, by a scale primitive after the mean subtraction
+    std::vector<float> invStdScales;
+    bool withStdScales = false;
+    for (size_t c = 0; c < meanChannels; c++) {
+        float stdScale = preProcess[c]->stdScale;
+        if (stdScale == 0.0f)
+            THROW_CLDNN_EXCEPTION("Zero stdScale in input " + inputName);
+        withStdScales |= fabs(stdScale - 1.0f) > 1e-10;
+        invStdScales.push_back(1.0f / stdScale);
+    }
+    if (withStdScales) {
+        auto scalesPrimID = inputName + m_scalesTag;
+        auto normalizePrimID = preprocessPrimID + m_scalesTag;
+        AddFeatureValuesPrimitive(scalesPrimID, inputLayout.data_type, invStdScales);
+        m_topology->add(cldnn::scale(normalizePrimID, preprocessPrimID, scalesPrimID));
+        m_env.profilingIDs.push_back(normalizePrimID);
+        InitProfileInfo(normalizePrimID, "ScaleShift");
+        m_env.primitiveIDs[normalizePrimID] = normalizePrimID;
+        preprocessPrimID = normalizePrimID;
+    }
     m_env.primitiveIDs[inputName] = preprocessPrimID;
     m_env.primitiveIDs[preprocessPrimID] = preprocessPrimID;
 }
@@ -3531,11 +3882,48 @@ std::vector<cldnn::primitive_id> CLDNNGraph::GetPrevLayersPrimitives(const Infer
         } else {
             prevName = prevData->name;
         }
-        inputPrimitives.push_back(m_env.primitiveIDs.at(prevName));
+        auto prevID = m_env.primitiveIDs.at(prevName);
+        if (!m_precisionReorders.empty() &&
+            (layer->precision == Precision::FP16 || layer->precision == Precision::FP32)) {
+            // the inputs of the other precision are taken through the reorders added by AddPrecisionReorders
+            auto reorder = m_precisionReorders.find({ prevID, DataTypeFromPrecision(layer->precision) });
+            if (reorder != m_precisionReorders.end())
+                prevID = reorder->second;
+        }
+        inputPrimitives.push_back(prevID);
     }
     return inputPrimitives;
 }
 
+void CLDNNGraph::AddPrecisionReorders(const InferenceEngine::CNNLayerPtr& layer) {
+    auto isFloat = [](Precision p) { return p == Precision::FP16 || p == Precision::FP32; };
+    if (!m_config.fp16Auto || !isFloat(layer->precision))
+        return;
+
+    auto inputPrimitives = GetPrevLayersPrimitives(layer);
+    for (size_t i = 0; i < layer->insData.size(); i++) {
+        auto prevCreator = layer->insData[i].lock()->creatorLayer.lock();
+        if (!prevCreator || !isFloat(prevCreator->precision) || prevCreator->precision == layer->precision)
+            continue;
+
+        // the input converted for another consumer is already taken through its reorder
+        bool converted = std::any_of(m_precisionReorders.begin(), m_precisionReorders.end(),
+            [&](const std::pair<const std::pair<cldnn::primitive_id, cldnn::data_types>, cldnn::primitive_id>& reorder) {
+                return reorder.second == inputPrimitives[i];
+            });
+        if (converted)
+            continue;
+
+        auto dataType = DataTypeFromPrecision(layer->precision);
+        auto reorderID = inputPrimitives[i] + m_precisionTag + "_" + layer->precision.name();
+        m_topology->add(cldnn::reorder(reorderID, inputPrimitives[i], m_defaultFormat, dataType));
+        m_env.primitiveIDs[reorderID] = reorderID;
+        m_env.profilingIDs.push_back(reorderID);
+        InitProfileInfo(reorderID, "Reorder");
+        m_precisionReorders[{ inputPrimitives[i], dataType }] = reorderID;
+    }
+}
+
 void CLDNNGraph::AddOutputPrimitive(std::string outputName, const InferenceEngine::DataPtr outputData, Precision outputPrecision) {
     // TODO: add precision check once there's an outputInfo object
     if (outputData->layout != InferenceEngine::NCHW &&
@@ -3607,6 +3995,37 @@ void CLDNNGraph::AddSingleValuePrimitive(cldnn::primitive_id valPrimID, cldnn::d
     m_topology->add(cldnn::data(valPrimID, primMem));
 }
 
+void CLDNNGraph::AddFeatureValuesPrimitive(cldnn::primitive_id valPrimID, cldnn::data_types dataType,
+                                           const std::vector<float>& values) {
+    cldnn::layout primLayout(dataType, m_defaultFormat, cldnn::feature(TensorValue(values.size())));
+    auto primMem = cldnn::memory::allocate(*(m_env.engine), primLayout);
+    switch (dataType) {
+    case cldnn::data_types::f32:
+    {
+        auto tmpPointer = primMem.pointer<float>();  // implicitly maps buffer - unmap in destructor
+        for (size_t i = 0; i < values.size(); i++)
+            tmpPointer[i] = values[i];
+    }
+        break;
+    case cldnn::data_types::f16:
+    {
+        auto tmpPointer = primMem.pointer<uint16_t>();  // implicitly maps buffer - unmap in destructor
+        for (size_t i = 0; i < values.size(); i++) {
+            cldnn_status status = CLDNN_SUCCESS;
+            tmpPointer[i] = cldnn_float_to_half(values[i], &status);
+            if (status != CLDNN_SUCCESS) {
+                THROW_CLDNN_EXCEPTION("Error converting value to fp16.");
+            }
+        }
+    }
+        break;
+    default:
+        THROW_CLDNN_EXCEPTION("Unhandled data type (precision)");
+    }
+
+    m_topology->add(cldnn::data(valPrimID, primMem));
+}
+
 cldnn::data_types CLDNNGraph::DataTypeFromPrecision(InferenceEngine::Precision p) {
     switch (p) {
     case Precision::I16:
@@ -3728,6 +4147,21 @@ cldnn::tensor CLDNNGraph::CldnnTensorFromIEDims(const InferenceEngine::SizeVecto
     return outputTensor;
 }
 
+void CLDNNGraph::setNetworkInputs(const InputsDataMap networkInputs) {
+    ExecutableNetworkThreadSafeDefault::setNetworkInputs(networkInputs);
+
+    // the NV12 inputs take the U8 frames instead of the images
+    for (auto& input : _networkInputs) {
+        if (!IsNV12Input(input.second))
+            continue;
+        size_t batch = input.second->getTensorDesc().getDims()[0];
+        TensorDesc frameDesc(Precision::U8, { batch, 1, m_config.nv12Height * 3 / 2, m_config.nv12Width }, Layout::NCHW);
+        InputInfo::Ptr frameInfo = std::make_shared<InputInfo>();
+        frameInfo->setInputData(std::make_shared<Data>(input.first, frameDesc));
+        input.second = frameInfo;
+    }
+}
+
 InferRequestInternal::Ptr
 CLDNNGraph::CreateInferRequestImpl(InputsDataMap networkInputs, OutputsDataMap networkOutputs) {
     if (m_env.network == nullptr) {
@@ -3736,6 +4170,27 @@ CLDNNGraph::CreateInferRequestImpl(InputsDataMap networkInputs, OutputsDataMap n
     return std::make_shared<CLDNNInferRequest>(m_env, m_config.useProfiling, networkInputs, networkOutputs);
 }
 
+void CLDNNGraph::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
+    if (m_streamNetworks.size() <= 1) {
+        ExecutableNetworkThreadSafeDefault::CreateInferRequest(asyncRequest);
+        return;
+    }
+
+    // the requests are bound to the streams of all the devices round-robin
+    const size_t stream = m_nextStream++ % m_streamNetworks.size();
+    InferenceEnv env = m_env;
+    env.network = m_streamNetworks[stream];
+    env.engine = m_streamEngines[stream];
+    auto syncRequestImpl = std::make_shared<CLDNNInferRequest>(env, m_config.useProfiling, _networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    syncRequestImpl->setMetricsRegistry(_metrics, static_cast<int>(stream));
+    auto asyncTreadSafeImpl = std::make_shared<AsyncInferRequestThreadSafeDefault>(
+            syncRequestImpl, m_streamExecutors[stream], m_streamSynchronizers[stream], _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<AsyncInferRequestThreadSafeDefault>(asyncTreadSafeImpl),
+                       [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+}
+
 void CLDNNGraph::InitProfileInfo(const std::string& layerName,
                                  const std::string& layerType,
                                  bool isCPU,
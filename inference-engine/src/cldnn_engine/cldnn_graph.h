@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <atomic>
 #include "ie_blob.h"
 #include "ie_plugin.hpp"
 #include "cpp/ie_cnn_network.h"
@@ -27,6 +28,7 @@
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 #include <CPP/upsampling.hpp>
 #include "cldnn_custom_layer.h"
+#include "details/caseless.hpp"
 
 namespace CLDNNPlugin {
 
@@ -68,12 +70,24 @@ struct InferenceEnv {
 class CLDNNGraph : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     typedef std::shared_ptr<CLDNNGraph> Ptr;
+    // the binaries of the OpenCL programs by their names in the kernels cache
+    typedef std::map<std::string, std::vector<unsigned char>> ProgramBinaries;
     struct Config {
         Config() : useProfiling(false), dumpCustomKernels(false), exclusiveAsyncRequests(false),
             memory_pool_on(true),
             enableDynamicBatch(false),
             queuePriority(cldnn::priority_mode_types::disabled),
-            queueThrottle(cldnn::throttle_mode_types::disabled) {}
+            queueThrottle(cldnn::throttle_mode_types::disabled),
+            kernelsBuildThreads(0),
+            throughputStreams(1),
+            nv12Width(0),
+            nv12Height(0),
+            detectionOutputGpu(false),
+            deviceIds({ 0 }),
+            fp16Auto(false),
+            warmUp(false),
+            fp32Layers({ "SoftMax", "MVN", "Normalize", "ArgMax", "Gather", "ReverseSequence", "PriorBox",
+                         "DetectionOutput", "Proposal", "SimplerNMS", "RegionYolo" }) {}
 
         void LoadFromMap(const std::map<std::string, std::string>& configMap);
 
@@ -84,16 +98,38 @@ public:
         bool memory_pool_on;
         cldnn::priority_mode_types queuePriority;
         cldnn::throttle_mode_types queueThrottle;
+        uint16_t kernelsBuildThreads;
+        uint16_t throughputStreams;
+        // the size of the NV12 frames the image inputs take, 0 if the inputs take the images as is
+        size_t nv12Width;
+        size_t nv12Height;
+        bool detectionOutputGpu;
+        // the indices of the GPUs the network is loaded on, all the GPUs if empty
+        std::vector<uint16_t> deviceIds;
+        // the FP32 networks run in FP16 except the layers of these types
+        bool fp16Auto;
+        InferenceEngine::details::caseless_set<std::string> fp32Layers;
+        // the networks are executed once on loading
+        bool warmUp;
         CLDNNCustomLayerMap customLayers;
         cldnn::tuning_config_options tuningConfig;
         std::string graph_dumps_dir;
         std::string sources_dumps_dir;
+        std::string kernels_cache_dir;
+        // the programs with these binaries are not compiled, set by the import of the network
+        std::shared_ptr<const ProgramBinaries> programBinaries;
     };
     explicit CLDNNGraph(InferenceEngine::ICNNNetwork &network, const Config& config = {}, int max_batch = -1);
 
     InferenceEngine::InferRequestInternal::Ptr
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs, InferenceEngine::OutputsDataMap networkOutputs) override;
 
+    void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
+
+    void Export(const std::string &modelFileName) override;
+
+    void setNetworkInputs(const InferenceEngine::InputsDataMap networkInputs) override;
+
     static bool IsLayerSupported(const std::string &type) {
         return LayerTypeFromStr(type) != NO_TYPE;
     }
@@ -103,6 +139,15 @@ protected:
     std::shared_ptr<cldnn::topology> m_topology;
     InferenceEnv m_env;
     Config m_config;
+    InferenceEngine::ICNNNetwork::Ptr m_transformedNetwork;
+
+    // the networks of the throughput streams of all the devices (the first one is m_env.network) with their engines and
+    // the executors of their requests
+    std::vector<std::shared_ptr<cldnn::network>> m_streamNetworks;
+    std::vector<std::shared_ptr<const cldnn::engine>> m_streamEngines;
+    std::vector<InferenceEngine::ITaskExecutor::Ptr> m_streamExecutors;
+    std::vector<InferenceEngine::TaskSynchronizer::Ptr> m_streamSynchronizers;
+    std::atomic<size_t> m_nextStream;
 
     InferenceEngine::InputsDataMap*  p_currentInputs;
     InferenceEngine::OutputsDataMap* p_currentOutputs;
@@ -111,11 +156,13 @@ protected:
     static const cldnn::primitive_id m_weightsTag;
     static const cldnn::primitive_id m_biasesTag;
     static const cldnn::primitive_id m_meanValuesTag;
+    static const cldnn::primitive_id m_nv12ToBgrTag;
     static const cldnn::primitive_id m_postProcessTag;
     static const cldnn::primitive_id m_scalesTag;
     static const cldnn::primitive_id m_workaroundTag;
     static const cldnn::primitive_id m_preCustomLayerTag;
     static const cldnn::primitive_id m_postCustomLayerTag;
+    static const cldnn::primitive_id m_precisionTag;
 
     // internal types
     enum LayerType {
@@ -179,6 +226,21 @@ protected:
         NO_REARRANGE
     };
 
+    // the memories of the constant blobs, so the networks of all the batch sizes share one copy of the weights
+    // the blob is kept alive to keep its buffer address from being reused by another blob
+    struct BlobMemory {
+        InferenceEngine::Blob::Ptr blob;
+        size_t byteOffset;
+        WeightRearrangeType rearrange;
+        cldnn::layout layout;
+        cldnn::memory memory;
+    };
+    std::multimap<const void*, BlobMemory> m_blobMemories;
+
+    // the reorders between the FP16 and FP32 layers of the network converted by FP16_AUTO, by the converted primitive
+    // and the data type of its consumers
+    std::map<std::pair<cldnn::primitive_id, cldnn::data_types>, cldnn::primitive_id> m_precisionReorders;
+
     cldnn::format m_defaultFormat;
     void InitFormat(InferenceEngine::ICNNNetwork &network);
 
@@ -186,6 +248,7 @@ protected:
     static cldnn::format     FormatFromLayout(InferenceEngine::Layout l);
     static cldnn::upsampling_sample_type UpsamplingTypeFromString(const std::string& str);
 
+    static std::shared_ptr<const cldnn::engine> CreateEngine(const Config& config, uint16_t deviceId);
     void Load(InferenceEngine::ICNNNetwork &network);
     static LayerType LayerTypeFromStr(const std::string& str);
     static cldnn::pooling_mode PoolingModeFromIEPooling(InferenceEngine::PoolingLayer::PoolType pt, bool excludePadding = false);
@@ -205,10 +268,12 @@ protected:
                                            cldnn::primitive_id weightsPrimID,
                                            cldnn::primitive_id biasesPrimID);
     void AddPreProcessPrimitive(InferenceEngine::InputInfo::Ptr inputInfo);
+    bool IsNV12Input(const InferenceEngine::InputInfo::Ptr& inputInfo) const;
     void AddInputPrimitive(InferenceEngine::InputInfo::Ptr inputInfo, InferenceEngine::Precision inputPrecision);
     void AddOutputPrimitive(std::string outputName, const InferenceEngine::DataPtr outputData,
                             InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::UNSPECIFIED);
     void CreateSingleLayerPrimitive(InferenceEngine::CNNLayerPtr& layer);
+    void AddPrecisionReorders(const InferenceEngine::CNNLayerPtr& layer);
     bool IsValidSplitConvMerge(const InferenceEngine::SplitLayer* splitLayer) const;
     bool CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const;
     static std::vector<InferenceEngine::CNNLayerPtr> GetNextLayers(const InferenceEngine::DataPtr data);
@@ -217,6 +282,7 @@ protected:
     static InferenceEngine::CNNLayerPtr GetNextSingleLayer(const InferenceEngine::CNNLayerPtr layer);
     std::vector<cldnn::primitive_id> GetPrevLayersPrimitives(const InferenceEngine::CNNLayerPtr layer) const;
     void AddSingleValuePrimitive(cldnn::primitive_id valPrimID, cldnn::data_types dataType, float value);
+    void AddFeatureValuesPrimitive(cldnn::primitive_id valPrimID, cldnn::data_types dataType, const std::vector<float>& values);
 
     void CreateGenericLayerBlobPrimitives(const InferenceEngine::GenericLayer* layer);
     static void ValidateGenericLayerBlobs(const InferenceEngine::GenericLayer* layer, const std::vector<std::string>& blobNames);
@@ -233,6 +299,7 @@ protected:
                                     = InferenceEngine::InferenceEngineProfileInfo::EXECUTED);
     void changeInputBatch(size_t batch);
     void CompileNetwork();
+    void WarmUp();
 
     // Layer Primitive Creators
     void CreatePReLUPrimitive(InferenceEngine::CNNLayerPtr &layer);
@@ -149,6 +149,30 @@ void CLDNNInferRequest::copyOutputData(const cldnn::memory& outputMemory,
     }
 }
 
+bool CLDNNInferRequest::readOutputAsync(const cldnn::memory& outputMemory, Blob::Ptr bptr, std::vector<cldnn::event>& events) {
+    // the padded outputs are copied element by element
+    const auto& layout = outputMemory.get_layout();
+    if (layout.data_padding || bptr->byteSize() != outputMemory.size()) {
+        return false;
+    }
+
+    switch (bptr->precision()) {
+    case Precision::FP32:
+        if (layout.data_type != cldnn::data_types::f32)
+            return false;
+        break;
+    case Precision::FP16:
+        if (layout.data_type != cldnn::data_types::f16)
+            return false;
+        break;
+    default:
+        return false;
+    }
+
+    events.push_back(m_env.network->read_memory_async(outputMemory, bptr->buffer().as<void*>(), outputMemory.size()));
+    return true;
+}
+
 void CLDNNInferRequest::copyInputData(std::shared_ptr<cldnn::network> network,
                                     const cldnn::primitive_id &inputName,
                                     const cldnn::layout& inputLayout,
@@ -260,6 +284,7 @@ void CLDNNInferRequest::AllocateOutputs() {
 
         _outputs[no.first] = createOutputBlob(desc, output_mem_ptr.data());
         outputsMap[no.first] = outputID;
+        outputsHostPtrs[no.first] = output_mem_ptr.data();
     }
 }
 
@@ -363,7 +388,8 @@ CLDNNInferRequest::CLDNNInferRequest(InferenceEnv env, bool useProfiling,
                                      InputsDataMap networkInputs, OutputsDataMap networkOutputs)
         : InferRequestInternal(networkInputs, networkOutputs),
           m_env(env),
-          m_useProfiling(useProfiling) {
+          m_useProfiling(useProfiling),
+          m_hostUnifiedMemory(env.engine->get_info().supports_host_unified_memory != 0) {
     if (m_env.m_max_batch > 1) {
         SetBatch(m_env.m_max_batch);
         AllocateInputsDyn();
@@ -416,23 +442,27 @@ CLDNNInferRequest::CLDNNInferRequest(InferenceEnv env, bool useProfiling,
 }
 
 void CLDNNInferRequest::execAndParse() {
-    auto networkOutputs = m_env.network->execute();
+    // the device starts the network once the inputs are uploaded, the host does not wait for the uploads
+    auto networkOutputs = m_env.network->execute(inputEvents);
+    inputEvents.clear();
 
-    // Collect outputs as requested by the model
+    // Collect outputs as requested by the model, the reads of all the outputs are enqueued before waiting for them
+    std::vector<cldnn::event> outputEvents;
     for (auto& no : _networkOutputs) {
         std::string outputID = outputsMap[no.first];
-        auto outputMemory = networkOutputs.at(outputID).get_memory();
         Blob::Ptr bptr = _outputs[no.first];
 
-        auto out_ptr = outputMemory.pointer<uint8_t>();
-        auto blob_ptr = bptr->buffer().as<uint8_t*>();
-
         // If Async API is used, copy of output blobs is not needed, unless SetBlob function was called.
         // But in the case when old API is used we have to copy data to memory provided by user.
-        if (blob_ptr != &out_ptr[0]) {
-            copyOutputData(outputMemory, bptr);
+        if (bptr->buffer().as<const void*>() == outputsHostPtrs[no.first]) {
+            outputEvents.push_back(networkOutputs.at(outputID).get_event());
+        } else if (!readOutputAsync(m_env.network->get_output_memory(outputID), bptr, outputEvents)) {
+            copyOutputData(networkOutputs.at(outputID).get_memory(), bptr);
         }
     }
+    for (auto& event : outputEvents) {
+        event.wait();
+    }
 
     // finally collect profiling info
     if (m_useProfiling) {
@@ -590,12 +620,16 @@ void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const
 
     cldnn::primitive_id internalName = "Input:" + inputName;
     const cldnn::memory& memory = inputsMemory.at(inputName);
+    auto shared = sharedInputsMemory.find(inputName);
     if (inputBlob.precision() == Precision::I16) {
         // clDNN doesn't support I16 input precision, so we always have to convert input data to fp32 precision
         const cldnn::memory& fp32_mem = inputsMemory.at(inputName+fp32_suffix);
         cldnn::pointer<float> ptr = fp32_mem.pointer<float>();
         InferenceEngine::copyToFloat<int16_t>(ptr.data(), &inputBlob);
         m_env.network->set_input_data(internalName, fp32_mem);
+    } else if (shared != sharedInputsMemory.end() && shared->second.first == inputBlob.cbuffer().as<const void*>()) {
+        // The device already works on the blob set by user in the previous inference.
+        m_env.network->set_input_data(internalName, shared->second.second);
     } else if (is_same_buffer(inputBlob, memory)) {
         // If input memory was allocated by cldnn engine and wasn't overwritten by user set_input_data method won't copy input data.
         switch (inputBlob.precision()) {
@@ -608,12 +642,62 @@ void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const
             default:
                 THROW_IE_EXCEPTION << "Unsupported input precision " << inputBlob.precision();
         }
-    } else {
+    } else if (!shareInputMemory(inputName, inputLayout, inputBlob) && !uploadInputAsync(inputName, inputBlob)) {
         // Otherwise, we have to attach to user memory and then copy the data.
         copyInputData(m_env.network, inputName, inputLayout, inputBlob);
     }
 }
 
+bool CLDNNInferRequest::shareInputMemory(const cldnn::primitive_id &inputName, const cldnn::layout& inputLayout,
+                                         const Blob &inputBlob) {
+    // The driver doesn't copy the host buffer only if it is page aligned and its size is a multiple of the cache line.
+    const size_t pageSize = 4096;
+    const size_t cacheLineSize = 64;
+
+    auto blob_ptr = const_cast<uint8_t*>(inputBlob.cbuffer().as<const uint8_t*>());
+    if (!m_hostUnifiedMemory || blob_ptr == nullptr || reinterpret_cast<uintptr_t>(blob_ptr) % pageSize != 0 ||
+        inputBlob.byteSize() != inputLayout.bytes_count() || inputBlob.byteSize() % cacheLineSize != 0) {
+        return false;
+    }
+
+    switch (inputBlob.precision()) {
+        case Precision::FP32:
+        case Precision::FP16:
+        case Precision::U8:
+            break;
+        default:
+            return false;
+    }
+
+    cldnn::memory sharedMem = cldnn::memory::share_host_buffer(*(m_env.engine), inputLayout, blob_ptr, inputBlob.byteSize());
+    sharedInputsMemory.erase(inputName);
+    sharedInputsMemory.insert({ inputName, { blob_ptr, sharedMem } });
+    m_env.network->set_input_data("Input:" + inputName, sharedMem);
+    return true;
+}
+
+bool CLDNNInferRequest::uploadInputAsync(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
+    switch (inputBlob.precision()) {
+        case Precision::FP32:
+        case Precision::FP16:
+        case Precision::U8:
+            break;
+        default:
+            return false;
+    }
+
+    const cldnn::memory& memory = inputsMemory.at(inputName);
+    if (inputBlob.byteSize() != memory.size()) {
+        return false;
+    }
+
+    // The blob is uploaded to the engine buffer of the request on the transfer queue, so the upload does not wait
+    // for the executions of the other requests. The blob is not changed until the outputs of the request are complete.
+    inputEvents.push_back(memory.write_async(inputBlob.cbuffer().as<const void*>(), memory.size()));
+    m_env.network->set_input_data("Input:" + inputName, memory);
+    return true;
+}
+
 void CLDNNInferRequest::PrepareInputDyn(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
     // now try to get execution results
     for (unsigned nb = 0; nb < m_env.m_bv_sz; nb++) {
@@ -38,10 +38,17 @@ public:
 
 protected:
     std::map<std::string, cldnn::memory> inputsMemory;
+    // the engine buffers used by the device in place of the user input blobs, by the names of the inputs
+    std::map<std::string, std::pair<const void*, cldnn::memory>> sharedInputsMemory;
     std::map<std::string, cldnn::primitive_id> outputsMap;
+    // the pointers the output blobs are created with, the outputs are copied only to the blobs set by user
+    std::map<std::string, const void*> outputsHostPtrs;
+    // the uploads of the input blobs the next execution waits for on the device
+    std::vector<cldnn::event> inputEvents;
     std::map<cldnn::primitive_id, std::string> implementationsMap;
     bool m_useProfiling;
     InferenceEnv m_env;
+    bool m_hostUnifiedMemory;
 
     // dynamic batch stuff
     std::map<std::string, std::vector<buf_info>> batchInputs;
@@ -50,6 +57,7 @@ protected:
     InferenceEngine::Blob::Ptr createInputBlob(const InferenceEngine::TensorDesc& desc, uint8_t* mem_ptr = nullptr);
     InferenceEngine::Blob::Ptr createOutputBlob(const InferenceEngine::TensorDesc& desc, uint8_t* mem_ptr = nullptr);
     void copyOutputData(const cldnn::memory& outputMemory, InferenceEngine::Blob::Ptr bptr, buf_info* bi = nullptr);
+    bool readOutputAsync(const cldnn::memory& outputMemory, InferenceEngine::Blob::Ptr bptr, std::vector<cldnn::event>& events);
     void copyInputData(std::shared_ptr<cldnn::network> network, const cldnn::primitive_id &inputName,
                                                 const cldnn::layout& inputLayout, const InferenceEngine::Blob &inputBlob,
                                                 buf_info* bi = nullptr);
@@ -61,6 +69,10 @@ protected:
     void execAndParse();
     void execAndParseDyn();
 
+    bool uploadInputAsync(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
+    bool shareInputMemory(const cldnn::primitive_id &inputName, const cldnn::layout& inputLayout,
+                          const InferenceEngine::Blob &inputBlob);
+
     void PrepareInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
     void PrepareInputDyn(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
 
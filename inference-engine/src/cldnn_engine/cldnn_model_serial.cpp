@@ -0,0 +1,247 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <map>
+#include <details/ie_exception.hpp>
+#include <ie_plugin_config.hpp>
+#include <cldnn/cldnn_config.hpp>
+#include <network_serializer.h>
+#include "cldnn_model_serial.h"
+
+using namespace InferenceEngine;
+using namespace CLDNNPlugin;
+
+namespace {
+
+const char cldnn_header_magic[4] = {'C', 'L', 'D', 'N'};
+// the weights section starts at the aligned offset, so the file can be mapped into memory
+const uint64_t weights_alignment = 64;
+
+template <class T>
+inline void writeBits(const T & obj, std::ostream & os) {
+    os.write(reinterpret_cast<const char *>(&obj), sizeof(T));
+}
+
+template <class T>
+inline void readBits(T & obj, std::istream & is) {
+    is.read(reinterpret_cast<char *>(&obj), sizeof(T));
+}
+
+inline void writeString(const std::string & str, std::ostream & os) {
+    writeBits(static_cast<uint64_t>(str.size()), os);
+    os.write(str.data(), str.size());
+}
+
+inline std::string readString(std::istream & is) {
+    uint64_t size = 0ull;
+    readBits(size, is);
+    std::string str(size, '\0');
+    is.read(&str[0], size);
+    return str;
+}
+
+std::map<std::string, std::string> configToProperties(const CLDNNGraph::Config &config) {
+    auto yesNo = [](bool value) { return value ? PluginConfigParams::YES : PluginConfigParams::NO; };
+    std::string tuningMode = PluginConfigParams::TUNING_DISABLED;
+    if (config.tuningConfig.mode == cldnn::tuning_mode::tuning_tune_and_cache)
+        tuningMode = PluginConfigParams::TUNING_CREATE;
+    else if (config.tuningConfig.mode == cldnn::tuning_mode::tuning_use_cache)
+        tuningMode = PluginConfigParams::TUNING_USE_EXISTING;
+
+    std::map<std::string, std::string> properties = {
+        {PluginConfigParams::KEY_PERF_COUNT, yesNo(config.useProfiling)},
+        {PluginConfigParams::KEY_DYN_BATCH_ENABLED, yesNo(config.enableDynamicBatch)},
+        {PluginConfigParams::KEY_DUMP_KERNELS, yesNo(config.dumpCustomKernels)},
+        {PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, yesNo(config.exclusiveAsyncRequests)},
+        {PluginConfigParams::KEY_TUNING_MODE, tuningMode},
+        {PluginConfigParams::KEY_TUNING_FILE, config.tuningConfig.cache_file_path},
+        {CLDNNConfigParams::KEY_CLDNN_MEM_POOL, yesNo(config.memory_pool_on)},
+        {CLDNNConfigParams::KEY_CLDNN_PLUGIN_PRIORITY, std::to_string(static_cast<int>(config.queuePriority))},
+        {CLDNNConfigParams::KEY_CLDNN_PLUGIN_THROTTLE, std::to_string(static_cast<int>(config.queueThrottle))},
+        {CLDNNConfigParams::KEY_CLDNN_KERNELS_BUILD_THREADS, std::to_string(config.kernelsBuildThreads)},
+        {CLDNNConfigParams::KEY_CLDNN_THROUGHPUT_STREAMS, std::to_string(config.throughputStreams)},
+        {CLDNNConfigParams::KEY_CLDNN_DETECTION_OUTPUT_GPU, yesNo(config.detectionOutputGpu)},
+        {CLDNNConfigParams::KEY_CLDNN_FP16_AUTO, yesNo(config.fp16Auto)},
+        {CLDNNConfigParams::KEY_CLDNN_WARM_UP, yesNo(config.warmUp)}
+    };
+    // the directories are created on loading, so only the ones in use are stored
+    if (!config.kernels_cache_dir.empty())
+        properties[CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_DIR] = config.kernels_cache_dir;
+    if (config.nv12Width != 0)
+        properties[CLDNNConfigParams::KEY_CLDNN_NV12_INPUT_SIZE] =
+            std::to_string(config.nv12Width) + "x" + std::to_string(config.nv12Height);
+    if (config.fp16Auto) {
+        std::string fp32Layers;
+        for (const auto &type : config.fp32Layers)
+            fp32Layers += (fp32Layers.empty() ? "" : ",") + type;
+        properties[CLDNNConfigParams::KEY_CLDNN_FP32_LAYERS] = fp32Layers;
+    }
+    return properties;
+}
+
+}  // namespace
+
+void CLDNNModelSerial::Export(std::ostream &os,
+                               const ICNNNetwork &network,
+                               const CLDNNGraph::Config &config,
+                               const CLDNNGraph::ProgramBinaries &binaries,
+                               const InputsDataMap &inputs,
+                               const OutputsDataMap &outputs) {
+    std::ostringstream xml;
+    std::ostringstream bin;
+    details::NetworkSerializer::serialize(xml, &bin, network);
+
+    os.write(cldnn_header_magic, sizeof(cldnn_header_magic));
+    writeBits(static_cast<uint16_t>(CLDNN_HEADER_MAJOR), os);
+    writeBits(static_cast<uint32_t>(CLDNN_HEADER_MINOR), os);
+
+    auto properties = configToProperties(config);
+    writeBits(static_cast<uint64_t>(properties.size()), os);
+    for (const auto &property : properties) {
+        writeString(property.first, os);
+        writeString(property.second, os);
+    }
+
+    writeBits(static_cast<uint64_t>(inputs.size()), os);
+    for (const auto &input : inputs) {
+        writeString(input.first, os);
+        writeString(input.second->getPrecision().name(), os);
+        writeBits(static_cast<uint8_t>(input.second->getLayout()), os);
+        writeBits(static_cast<int32_t>(input.second->getPreProcess().getResizeAlgorithm()), os);
+    }
+
+    writeBits(static_cast<uint64_t>(outputs.size()), os);
+    for (const auto &output : outputs) {
+        writeString(output.first, os);
+        writeString(output.second->getPrecision().name(), os);
+        writeBits(static_cast<uint8_t>(output.second->getLayout()), os);
+    }
+
+    writeBits(static_cast<uint64_t>(binaries.size()), os);
+    for (const auto &binary : binaries) {
+        writeString(binary.first, os);
+        writeBits(static_cast<uint64_t>(binary.second.size()), os);
+        os.write(reinterpret_cast<const char *>(binary.second.data()), binary.second.size());
+    }
+
+    writeString(xml.str(), os);
+
+    const std::string weights = bin.str();
+    writeBits(static_cast<uint64_t>(weights.size()), os);
+    const uint64_t position = static_cast<uint64_t>(os.tellp()) + sizeof(uint64_t);
+    const uint64_t padding = (weights_alignment - position % weights_alignment) % weights_alignment;
+    writeBits(padding, os);
+    os.write(std::string(padding, '\0').data(), padding);
+    os.write(weights.data(), weights.size());
+
+    if (!os.good()) {
+        THROW_IE_EXCEPTION << "Error during the executable network export";
+    }
+}
+
+void CLDNNModelSerial::Import(std::istream &is,
+                               CNNNetReader &reader,
+                               std::map<std::string, std::string> &config,
+                               CLDNNGraph::ProgramBinaries &binaries) {
+    is.exceptions(std::istream::failbit);
+
+    char magic[sizeof(cldnn_header_magic)];
+    is.read(magic, sizeof(magic));
+    if (!std::equal(magic, magic + sizeof(magic), cldnn_header_magic)) {
+        THROW_IE_EXCEPTION << "Imported file unsupported: magic number should be CLDN";
+    }
+    uint16_t major = 0u;
+    uint32_t minor = 0u;
+    readBits(major, is);
+    readBits(minor, is);
+    if (major != CLDNN_HEADER_MAJOR) {
+        THROW_IE_EXCEPTION << "Imported file unsupported: major version should be " << CLDNN_HEADER_MAJOR
+                           << ", but was " << major;
+    }
+
+    uint64_t count = 0ull;
+    readBits(count, is);
+    for (uint64_t i = 0; i < count; i++) {
+        std::string key = readString(is);
+        config[key] = readString(is);
+    }
+
+    struct PortInfo {
+        Precision precision;
+        Layout layout;
+        ResizeAlgorithm resize;
+    };
+    std::map<std::string, PortInfo> inputsInfo, outputsInfo;
+
+    readBits(count, is);
+    for (uint64_t i = 0; i < count; i++) {
+        PortInfo info;
+        std::string name = readString(is);
+        info.precision = Precision::FromStr(readString(is));
+        uint8_t layout = 0u;
+        int32_t resize = 0;
+        readBits(layout, is);
+        readBits(resize, is);
+        info.layout = static_cast<Layout>(layout);
+        info.resize = static_cast<ResizeAlgorithm>(resize);
+        inputsInfo[name] = info;
+    }
+
+    readBits(count, is);
+    for (uint64_t i = 0; i < count; i++) {
+        PortInfo info;
+        std::string name = readString(is);
+        info.precision = Precision::FromStr(readString(is));
+        uint8_t layout = 0u;
+        readBits(layout, is);
+        info.layout = static_cast<Layout>(layout);
+        outputsInfo[name] = info;
+    }
+
+    readBits(count, is);
+    for (uint64_t i = 0; i < count; i++) {
+        std::string name = readString(is);
+        uint64_t size = 0ull;
+        readBits(size, is);
+        std::vector<unsigned char> &binary = binaries[name];
+        binary.resize(size);
+        is.read(reinterpret_cast<char *>(binary.data()), size);
+    }
+
+    const std::string xml = readString(is);
+    reader.ReadNetwork(xml.data(), xml.size());
+
+    uint64_t weightsSize = 0ull, padding = 0ull;
+    readBits(weightsSize, is);
+    readBits(padding, is);
+    is.seekg(padding, std::ios_base::cur);
+    TBlob<uint8_t>::Ptr weights = make_shared_blob<uint8_t>(
+            TensorDesc(Precision::U8, {static_cast<size_t>(weightsSize)}, Layout::C));
+    weights->allocate();
+    is.read(weights->buffer().as<char*>(), weightsSize);
+    reader.SetWeights(weights);
+
+    CNNNetwork network = reader.getNetwork();
+    InputsDataMap inputs = network.getInputsInfo();
+    for (const auto &info : inputsInfo) {
+        auto input = inputs.find(info.first);
+        if (input == inputs.end())
+            THROW_IE_EXCEPTION << "Imported file is corrupted: cannot find input " << info.first;
+        input->second->setPrecision(info.second.precision);
+        input->second->setLayout(info.second.layout);
+        input->second->getPreProcess().setResizeAlgorithm(info.second.resize);
+    }
+    OutputsDataMap outputs = network.getOutputsInfo();
+    for (const auto &info : outputsInfo) {
+        auto output = outputs.find(info.first);
+        if (output == outputs.end())
+            THROW_IE_EXCEPTION << "Imported file is corrupted: cannot find output " << info.first;
+        output->second->setPrecision(info.second.precision);
+        output->second->setLayout(info.second.layout);
+    }
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <map>
+#include <string>
+#include <cpp/ie_cnn_net_reader.h>
+#include "cldnn_graph.h"
+
+/**
+ * version history
+ * 1.0 - transformed network in IR form, config, inputs/outputs info and the binaries of the OpenCL programs
+ */
+
+#define CLDNN_HEADER_MAJOR 1
+#define CLDNN_HEADER_MINOR 0
+
+namespace CLDNNPlugin {
+
+/**
+ * @brief Serialization of the GPU executable network.
+ * The model consists of the network after the plugin front-end transformations (TensorIterator and RNN unrolling),
+ * the configuration and the inputs/outputs info the network was loaded with and the binaries of all the OpenCL
+ * programs built for the network, so the import creates every program from its binary instead of compiling it.
+ * The weights are stored aligned as the last section of the file.
+ */
+class CLDNNModelSerial {
+public:
+    static void Export(std::ostream &os,
+                       const InferenceEngine::ICNNNetwork &network,
+                       const CLDNNGraph::Config &config,
+                       const CLDNNGraph::ProgramBinaries &binaries,
+                       const InferenceEngine::InputsDataMap &inputs,
+                       const InferenceEngine::OutputsDataMap &outputs);
+
+    /**
+     * @brief Reads the model into the reader and fills the config and the program binaries it was exported with
+     */
+    static void Import(std::istream &is,
+                       InferenceEngine::CNNNetReader &reader,
+                       std::map<std::string, std::string> &config,
+                       CLDNNGraph::ProgramBinaries &binaries);
+};
+
+}  // namespace CLDNNPlugin
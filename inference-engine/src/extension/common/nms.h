@@ -0,0 +1,174 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "defs.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include "ie_parallel.hpp"
+
+// The boxes sorted by the score are split into the blocks, the suppressed boxes of a block are the bits of its word
+#define NMS_BLOCK_SIZE 64
+
+// The mask of the boxes [begin, end) suppressed by the box, the bit 0 is the box begin
+static inline
+uint64_t nms_suppression_mask(const float* x0, const float* y0, const float* x1, const float* y1,
+                              const int box, const int begin, const int end,
+                              const float nms_thresh, const float coordinates_offset) {
+    uint64_t mask = 0;
+    int tail = begin;
+
+    const float x0i = x0[box];
+    const float y0i = y0[box];
+    const float x1i = x1[box];
+    const float y1i = y1[box];
+
+#if defined(HAVE_AVX2)
+    __m256  vc_fone = _mm256_set1_ps(coordinates_offset);
+    __m256  vc_zero = _mm256_set1_ps(0.0f);
+
+    __m256 vc_nms_thresh = _mm256_set1_ps(nms_thresh);
+
+    __m256 vx0i = _mm256_set1_ps(x0i);
+    __m256 vy0i = _mm256_set1_ps(y0i);
+    __m256 vx1i = _mm256_set1_ps(x1i);
+    __m256 vy1i = _mm256_set1_ps(y1i);
+
+    __m256 vA_width  = _mm256_sub_ps(vx1i, vx0i);
+    __m256 vA_height = _mm256_sub_ps(vy1i, vy0i);
+    __m256 vA_area   = _mm256_mul_ps(_mm256_add_ps(vA_width, vc_fone), _mm256_add_ps(vA_height, vc_fone));
+
+    for (; tail <= end - 8; tail += 8) {
+        __m256 vx0j = _mm256_loadu_ps(x0 + tail);
+        __m256 vy0j = _mm256_loadu_ps(y0 + tail);
+        __m256 vx1j = _mm256_loadu_ps(x1 + tail);
+        __m256 vy1j = _mm256_loadu_ps(y1 + tail);
+
+        __m256 vx0 = _mm256_max_ps(vx0i, vx0j);
+        __m256 vy0 = _mm256_max_ps(vy0i, vy0j);
+        __m256 vx1 = _mm256_min_ps(vx1i, vx1j);
+        __m256 vy1 = _mm256_min_ps(vy1i, vy1j);
+
+        __m256 vwidth  = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), vc_fone);
+        __m256 vheight = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), vc_fone);
+        __m256 varea = _mm256_mul_ps(_mm256_max_ps(vc_zero, vwidth), _mm256_max_ps(vc_zero, vheight));
+
+        __m256 vB_width  = _mm256_sub_ps(vx1j, vx0j);
+        __m256 vB_height = _mm256_sub_ps(vy1j, vy0j);
+        __m256 vB_area   = _mm256_mul_ps(_mm256_add_ps(vB_width, vc_fone), _mm256_add_ps(vB_height, vc_fone));
+
+        __m256 vdivisor = _mm256_sub_ps(_mm256_add_ps(vA_area, vB_area), varea);
+        __m256 vintersection_area = _mm256_div_ps(varea, vdivisor);
+
+        __m256 vcmp_0 = _mm256_cmp_ps(vx0i, vx1j, _CMP_LE_OS);
+        __m256 vcmp_1 = _mm256_cmp_ps(vy0i, vy1j, _CMP_LE_OS);
+        __m256 vcmp_2 = _mm256_cmp_ps(vx0j, vx1i, _CMP_LE_OS);
+        __m256 vcmp_3 = _mm256_cmp_ps(vy0j, vy1i, _CMP_LE_OS);
+        __m256 vcmp_4 = _mm256_cmp_ps(vc_nms_thresh, vintersection_area, _CMP_LT_OS);
+
+        vcmp_0 = _mm256_and_ps(vcmp_0, vcmp_1);
+        vcmp_2 = _mm256_and_ps(vcmp_2, vcmp_3);
+        vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_0);
+        vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_2);
+
+        mask |= static_cast<uint64_t>(_mm256_movemask_ps(vcmp_4)) << (tail - begin);
+    }
+#endif
+
+    for (; tail < end; ++tail) {
+        float res = 0.0f;
+
+        const float x0j = x0[tail];
+        const float y0j = y0[tail];
+        const float x1j = x1[tail];
+        const float y1j = y1[tail];
+
+        if (x0i <= x1j && y0i <= y1j && x0j <= x1i && y0j <= y1i) {
+            // overlapped region (= box)
+            const float x0 = std::max<float>(x0i, x0j);
+            const float y0 = std::max<float>(y0i, y0j);
+            const float x1 = std::min<float>(x1i, x1j);
+            const float y1 = std::min<float>(y1i, y1j);
+
+            // intersection area
+            const float width  = std::max<float>(0.0f,  x1 - x0 + coordinates_offset);
+            const float height = std::max<float>(0.0f,  y1 - y0 + coordinates_offset);
+            const float area   = width * height;
+
+            // area of A, B
+            const float A_area = (x1i - x0i + coordinates_offset) * (y1i - y0i + coordinates_offset);
+            const float B_area = (x1j - x0j + coordinates_offset) * (y1j - y0j + coordinates_offset);
+
+            // IoU
+            res = area / (A_area + B_area - area);
+        }
+
+        if (nms_thresh < res)
+            mask |= static_cast<uint64_t>(1) << (tail - begin);
+    }
+
+    return mask;
+}
+
+// Greedy NMS over the boxes sorted by the score, is_dead holds the suppression bits of the blocks of the boxes.
+// The boxes of a block are resolved one by one, then the boxes kept in it suppress the boxes of all the next
+// blocks at once, in parallel over the blocks. So each kept box is compared once with the boxes after it, and
+// nothing is computed for the blocks after the last kept box.
+static inline
+void nms_cpu(const int num_boxes, uint64_t is_dead[],
+             const float* boxes, int index_out[], int* const num_out,
+             const int base_index, const float nms_thresh, const int max_num_out,
+             float coordinates_offset) {
+    const int num_proposals = num_boxes;
+    const int num_blocks = (num_boxes + NMS_BLOCK_SIZE - 1) / NMS_BLOCK_SIZE;
+    int count = 0;
+
+    const float* x0 = boxes + 0 * num_proposals;
+    const float* y0 = boxes + 1 * num_proposals;
+    const float* x1 = boxes + 2 * num_proposals;
+    const float* y1 = boxes + 3 * num_proposals;
+
+    memset(is_dead, 0, num_blocks * sizeof(uint64_t));
+
+    for (int block = 0; block < num_blocks && count < max_num_out; ++block) {
+        const int begin = block * NMS_BLOCK_SIZE;
+        const int end = std::min<int>(begin + NMS_BLOCK_SIZE, num_boxes);
+        const int block_count = count;
+
+        for (int box = begin; box < end; ++box) {
+            if ((is_dead[block] >> (box - begin)) & 1)
+                continue;
+
+            index_out[count++] = base_index + box;
+            if (count == max_num_out)
+                break;
+
+            if (box + 1 < end)
+                is_dead[block] |= nms_suppression_mask(x0, y0, x1, y1, box, box + 1, end,
+                                                       nms_thresh, coordinates_offset) << (box + 1 - begin);
+        }
+
+        if (count == max_num_out)
+            break;
+
+        InferenceEngine::parallel_for(num_blocks - block - 1, [&](size_t i) {
+            const int next = block + 1 + static_cast<int>(i);
+            const int next_begin = next * NMS_BLOCK_SIZE;
+            const int next_end = std::min<int>(next_begin + NMS_BLOCK_SIZE, num_boxes);
+            const uint64_t all = next_end - next_begin == NMS_BLOCK_SIZE ? ~static_cast<uint64_t>(0)
+                                 : (static_cast<uint64_t>(1) << (next_end - next_begin)) - 1;
+
+            uint64_t mask = is_dead[next];
+            for (int kept = block_count; kept < count && mask != all; ++kept)
+                mask |= nms_suppression_mask(x0, y0, x1, y1, index_out[kept] - base_index, next_begin, next_end,
+                                             nms_thresh, coordinates_offset);
+            is_dead[next] = mask;
+        });
+    }
+
+    *num_out = count;
+}
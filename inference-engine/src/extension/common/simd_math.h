@@ -0,0 +1,299 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+/**
+ * The vector math of the layers: exp, log, sigmoid, tanh, rsqrt and erf on the widest vectors the library is built
+ * for (HAVE_AVX512F, HAVE_AVX2 or HAVE_SSE, see set_target_cpu_flags), with the scalar versions of the same
+ * approximations for the builds without them. The *_array functions process the whole arrays, the tails are
+ * computed as a padded vector, so every element gets the same approximation.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include "defs.h"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace simd {
+
+#if defined(HAVE_AVX512F)
+#define SIMD_WIDTH 16
+typedef __m512 vec;
+typedef __m512i ivec;
+typedef __mmask16 mask;
+
+static inline vec set1(float v) { return _mm512_set1_ps(v); }
+static inline vec loadu(const float *p) { return _mm512_loadu_ps(p); }
+static inline void storeu(float *p, vec v) { _mm512_storeu_ps(p, v); }
+static inline vec add(vec a, vec b) { return _mm512_add_ps(a, b); }
+static inline vec sub(vec a, vec b) { return _mm512_sub_ps(a, b); }
+static inline vec mul(vec a, vec b) { return _mm512_mul_ps(a, b); }
+static inline vec div(vec a, vec b) { return _mm512_div_ps(a, b); }
+static inline vec fmadd(vec a, vec b, vec c) { return _mm512_fmadd_ps(a, b, c); }
+static inline vec max(vec a, vec b) { return _mm512_max_ps(a, b); }
+static inline vec min(vec a, vec b) { return _mm512_min_ps(a, b); }
+static inline vec sqrt(vec a) { return _mm512_sqrt_ps(a); }
+static inline vec rsqrt_approx(vec a) { return _mm512_rsqrt14_ps(a); }
+static inline vec floor(vec a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+static inline ivec to_int(vec a) { return _mm512_cvttps_epi32(a); }
+static inline vec to_float(ivec a) { return _mm512_cvtepi32_ps(a); }
+static inline ivec as_int(vec a) { return _mm512_castps_si512(a); }
+static inline vec as_float(ivec a) { return _mm512_castsi512_ps(a); }
+static inline ivec iset1(int v) { return _mm512_set1_epi32(v); }
+static inline ivec iadd(ivec a, ivec b) { return _mm512_add_epi32(a, b); }
+static inline ivec isub(ivec a, ivec b) { return _mm512_sub_epi32(a, b); }
+static inline ivec iand(ivec a, ivec b) { return _mm512_and_si512(a, b); }
+static inline ivec ior(ivec a, ivec b) { return _mm512_or_si512(a, b); }
+static inline ivec ixor(ivec a, ivec b) { return _mm512_xor_si512(a, b); }
+static inline ivec isrli(ivec a, unsigned n) { return _mm512_srli_epi32(a, n); }
+static inline ivec islli(ivec a, unsigned n) { return _mm512_slli_epi32(a, n); }
+static inline mask cmplt(vec a, vec b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OS); }
+// the elements of b where the mask is set, of a elsewhere
+static inline vec select(mask m, vec a, vec b) { return _mm512_mask_blend_ps(m, a, b); }
+#elif defined(HAVE_AVX2)
+#define SIMD_WIDTH 8
+typedef __m256 vec;
+typedef __m256i ivec;
+typedef __m256 mask;
+
+static inline vec set1(float v) { return _mm256_set1_ps(v); }
+static inline vec loadu(const float *p) { return _mm256_loadu_ps(p); }
+static inline void storeu(float *p, vec v) { _mm256_storeu_ps(p, v); }
+static inline vec add(vec a, vec b) { return _mm256_add_ps(a, b); }
+static inline vec sub(vec a, vec b) { return _mm256_sub_ps(a, b); }
+static inline vec mul(vec a, vec b) { return _mm256_mul_ps(a, b); }
+static inline vec div(vec a, vec b) { return _mm256_div_ps(a, b); }
+#if defined(HAVE_FMA)
+static inline vec fmadd(vec a, vec b, vec c) { return _mm256_fmadd_ps(a, b, c); }
+#else
+static inline vec fmadd(vec a, vec b, vec c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#endif
+static inline vec max(vec a, vec b) { return _mm256_max_ps(a, b); }
+static inline vec min(vec a, vec b) { return _mm256_min_ps(a, b); }
+static inline vec sqrt(vec a) { return _mm256_sqrt_ps(a); }
+static inline vec rsqrt_approx(vec a) { return _mm256_rsqrt_ps(a); }
+static inline vec floor(vec a) { return _mm256_floor_ps(a); }
+static inline ivec to_int(vec a) { return _mm256_cvttps_epi32(a); }
+static inline vec to_float(ivec a) { return _mm256_cvtepi32_ps(a); }
+static inline ivec as_int(vec a) { return _mm256_castps_si256(a); }
+static inline vec as_float(ivec a) { return _mm256_castsi256_ps(a); }
+static inline ivec iset1(int v) { return _mm256_set1_epi32(v); }
+static inline ivec iadd(ivec a, ivec b) { return _mm256_add_epi32(a, b); }
+static inline ivec isub(ivec a, ivec b) { return _mm256_sub_epi32(a, b); }
+static inline ivec iand(ivec a, ivec b) { return _mm256_and_si256(a, b); }
+static inline ivec ior(ivec a, ivec b) { return _mm256_or_si256(a, b); }
+static inline ivec ixor(ivec a, ivec b) { return _mm256_xor_si256(a, b); }
+static inline ivec isrli(ivec a, int n) { return _mm256_srli_epi32(a, n); }
+static inline ivec islli(ivec a, int n) { return _mm256_slli_epi32(a, n); }
+static inline mask cmplt(vec a, vec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OS); }
+static inline vec select(mask m, vec a, vec b) { return _mm256_blendv_ps(a, b, m); }
+#elif defined(HAVE_SSE)
+#define SIMD_WIDTH 4
+typedef __m128 vec;
+typedef __m128i ivec;
+typedef __m128 mask;
+
+static inline vec set1(float v) { return _mm_set1_ps(v); }
+static inline vec loadu(const float *p) { return _mm_loadu_ps(p); }
+static inline void storeu(float *p, vec v) { _mm_storeu_ps(p, v); }
+static inline vec add(vec a, vec b) { return _mm_add_ps(a, b); }
+static inline vec sub(vec a, vec b) { return _mm_sub_ps(a, b); }
+static inline vec mul(vec a, vec b) { return _mm_mul_ps(a, b); }
+static inline vec div(vec a, vec b) { return _mm_div_ps(a, b); }
+static inline vec fmadd(vec a, vec b, vec c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+static inline vec max(vec a, vec b) { return _mm_max_ps(a, b); }
+static inline vec min(vec a, vec b) { return _mm_min_ps(a, b); }
+static inline vec sqrt(vec a) { return _mm_sqrt_ps(a); }
+static inline vec rsqrt_approx(vec a) { return _mm_rsqrt_ps(a); }
+static inline vec floor(vec a) { return _mm_floor_ps(a); }
+static inline ivec to_int(vec a) { return _mm_cvttps_epi32(a); }
+static inline vec to_float(ivec a) { return _mm_cvtepi32_ps(a); }
+static inline ivec as_int(vec a) { return _mm_castps_si128(a); }
+static inline vec as_float(ivec a) { return _mm_castsi128_ps(a); }
+static inline ivec iset1(int v) { return _mm_set1_epi32(v); }
+static inline ivec iadd(ivec a, ivec b) { return _mm_add_epi32(a, b); }
+static inline ivec isub(ivec a, ivec b) { return _mm_sub_epi32(a, b); }
+static inline ivec iand(ivec a, ivec b) { return _mm_and_si128(a, b); }
+static inline ivec ior(ivec a, ivec b) { return _mm_or_si128(a, b); }
+static inline ivec ixor(ivec a, ivec b) { return _mm_xor_si128(a, b); }
+static inline ivec isrli(ivec a, int n) { return _mm_srli_epi32(a, n); }
+static inline ivec islli(ivec a, int n) { return _mm_slli_epi32(a, n); }
+static inline mask cmplt(vec a, vec b) { return _mm_cmplt_ps(a, b); }
+static inline vec select(mask m, vec a, vec b) { return _mm_blendv_ps(a, b, m); }
+#endif
+
+#if defined(SIMD_WIDTH)
+static inline vec abs(vec a) { return as_float(iand(as_int(a), iset1(0x7fffffff))); }
+static inline vec copysign(vec magnitude, vec sign) {
+    return as_float(ior(as_int(abs(magnitude)), iand(as_int(sign), iset1(static_cast<int>(0x80000000u)))));
+}
+
+/// @brief exp(x) by the range reduction to exp(r) * 2^n, |r| <= ln(2)/2, the inputs are clamped to [-87.3, 88.3]
+static inline vec exp(vec x) {
+    x = max(min(x, set1(88.3762626647949f)), set1(-87.3365402f));
+
+    vec n = floor(fmadd(x, set1(1.44269504088896341f), set1(0.5f)));
+    vec r = fmadd(n, set1(-0.693359375f), x);
+    r = fmadd(n, set1(2.12194440e-4f), r);
+
+    vec y = set1(1.9875691500e-4f);
+    y = fmadd(y, r, set1(1.3981999507e-3f));
+    y = fmadd(y, r, set1(8.3334519073e-3f));
+    y = fmadd(y, r, set1(4.1665795894e-2f));
+    y = fmadd(y, r, set1(1.6666665459e-1f));
+    y = fmadd(y, r, set1(5.0000001201e-1f));
+    y = fmadd(y, mul(r, r), add(r, set1(1.0f)));
+
+    ivec pow2n = islli(iadd(to_int(n), iset1(0x7f)), 23);
+    return mul(y, as_float(pow2n));
+}
+
+/// @brief log(x) of the positive x by the split to the mantissa in [sqrt(0.5), sqrt(2)) and the exponent
+static inline vec log(vec x) {
+    ivec xi = as_int(x);
+    vec e = to_float(isub(isrli(xi, 23), iset1(126)));
+    vec m = as_float(ior(iand(xi, iset1(0x007fffff)), iset1(0x3f000000)));  // in [0.5, 1)
+
+    mask small = cmplt(m, set1(0.707106781186547524f));
+    e = select(small, e, sub(e, set1(1.0f)));
+    m = select(small, sub(m, set1(1.0f)), sub(add(m, m), set1(1.0f)));
+
+    vec z = mul(m, m);
+    vec y = set1(7.0376836292e-2f);
+    y = fmadd(y, m, set1(-1.1514610310e-1f));
+    y = fmadd(y, m, set1(1.1676998740e-1f));
+    y = fmadd(y, m, set1(-1.2420140846e-1f));
+    y = fmadd(y, m, set1(1.4249322787e-1f));
+    y = fmadd(y, m, set1(-1.6668057665e-1f));
+    y = fmadd(y, m, set1(2.0000714765e-1f));
+    y = fmadd(y, m, set1(-2.4999993993e-1f));
+    y = fmadd(y, m, set1(3.3333331174e-1f));
+    y = mul(mul(y, m), z);
+    y = fmadd(e, set1(-2.12194440e-4f), y);
+    y = fmadd(z, set1(-0.5f), y);
+    return fmadd(e, set1(0.693359375f), add(m, y));
+}
+
+static inline vec sigmoid(vec x) {
+    vec one = set1(1.0f);
+    return div(one, add(one, exp(sub(set1(0.0f), x))));
+}
+
+/// @brief tanh(x), the odd polynomial near zero keeps the relative accuracy of the small x
+static inline vec tanh(vec x) {
+    vec ax = abs(x);
+    vec e = exp(mul(ax, set1(-2.0f)));
+    vec large = div(sub(set1(1.0f), e), add(set1(1.0f), e));
+
+    vec z = mul(x, x);
+    vec p = set1(-5.70498872745e-3f);
+    p = fmadd(p, z, set1(2.06390887954e-2f));
+    p = fmadd(p, z, set1(-5.37397155531e-2f));
+    p = fmadd(p, z, set1(1.33314422036e-1f));
+    p = fmadd(p, z, set1(-3.33332819422e-1f));
+    vec small = fmadd(mul(p, z), ax, ax);
+
+    return copysign(select(cmplt(ax, set1(0.625f)), large, small), x);
+}
+
+/// @brief 1 / sqrt(x), the hardware approximation refined by a Newton step
+static inline vec rsqrt(vec x) {
+    vec y = rsqrt_approx(x);
+    vec yyx = mul(mul(y, y), x);
+    return mul(mul(y, set1(0.5f)), sub(set1(3.0f), yyx));
+}
+
+/// @brief erf(x) by the Abramowitz-Stegun 7.1.26 approximation, the absolute error is below 1.5e-7
+static inline vec erf(vec x) {
+    vec ax = abs(x);
+    vec t = div(set1(1.0f), fmadd(ax, set1(0.3275911f), set1(1.0f)));
+
+    vec p = set1(1.061405429f);
+    p = fmadd(p, t, set1(-1.453152027f));
+    p = fmadd(p, t, set1(1.421413741f));
+    p = fmadd(p, t, set1(-0.284496736f));
+    p = fmadd(p, t, set1(0.254829592f));
+    p = mul(p, t);
+
+    vec y = sub(set1(1.0f), mul(p, exp(sub(set1(0.0f), mul(ax, ax)))));
+    return copysign(y, x);
+}
+
+/// @brief Applies the vector function to the array, the source and the destination may be the same
+template <typename F>
+static inline void apply(const float *src, float *dst, size_t n, F f) {
+    size_t i = 0;
+    for (; i + SIMD_WIDTH <= n; i += SIMD_WIDTH)
+        storeu(dst + i, f(loadu(src + i)));
+    if (i < n) {
+        // 1 is in the domain of all the functions
+        float tail[SIMD_WIDTH];
+        for (size_t j = 0; j < SIMD_WIDTH; j++)
+            tail[j] = 1.0f;
+        memcpy(tail, src + i, (n - i) * sizeof(float));
+        storeu(tail, f(loadu(tail)));
+        memcpy(dst + i, tail, (n - i) * sizeof(float));
+    }
+}
+
+static inline void exp_array(const float *src, float *dst, size_t n) { apply(src, dst, n, [](vec x) { return exp(x); }); }
+static inline void log_array(const float *src, float *dst, size_t n) { apply(src, dst, n, [](vec x) { return log(x); }); }
+static inline void sigmoid_array(const float *src, float *dst, size_t n) {
+    apply(src, dst, n, [](vec x) { return sigmoid(x); });
+}
+static inline void tanh_array(const float *src, float *dst, size_t n) { apply(src, dst, n, [](vec x) { return tanh(x); }); }
+static inline void rsqrt_array(const float *src, float *dst, size_t n) {
+    apply(src, dst, n, [](vec x) { return rsqrt(x); });
+}
+static inline void erf_array(const float *src, float *dst, size_t n) { apply(src, dst, n, [](vec x) { return erf(x); }); }
+#else
+static inline void exp_array(const float *src, float *dst, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] = std::exp(src[i]);
+}
+static inline void log_array(const float *src, float *dst, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] = std::log(src[i]);
+}
+static inline void sigmoid_array(const float *src, float *dst, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] = 1.0f / (1.0f + std::exp(-src[i]));
+}
+static inline void tanh_array(const float *src, float *dst, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] = std::tanh(src[i]);
+}
+static inline void rsqrt_array(const float *src, float *dst, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] = 1.0f / std::sqrt(src[i]);
+}
+static inline void erf_array(const float *src, float *dst, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] = std::erf(src[i]);
+}
+#endif
+
+/// @brief The index of the first maximum of the non-empty array: the maximum is reduced on the vectors first
+static inline size_t argmax(const float *src, size_t n) {
+    float best = src[0];
+    size_t i = 0;
+#if defined(SIMD_WIDTH)
+    if (n >= SIMD_WIDTH) {
+        vec m = loadu(src);
+        for (i = SIMD_WIDTH; i + SIMD_WIDTH <= n; i += SIMD_WIDTH)
+            m = max(m, loadu(src + i));
+        float lanes[SIMD_WIDTH];
+        storeu(lanes, m);
+        for (size_t j = 0; j < SIMD_WIDTH; j++)
+            best = std::max(best, lanes[j]);
+    }
+#endif
+    for (; i < n; i++)
+        best = std::max(best, src[i]);
+    return std::find(src, src + n, best) - src;
+}
+
+}  // namespace simd
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -11,6 +11,10 @@
 #include <cmath>
 #include <utility>
 #include <functional>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -55,38 +59,180 @@ public:
         float* dst_data = outputs[0]->buffer();
 
         int num = count(in_dims) / dim;
-        std::vector<std::pair<float, int> > src_vector(dim);
+        int outer = num / axis_dist;
 
-        for (int i = 0; i < num; ++i) {
-            for (int j = 0; j < dim; ++j) {
-                src_vector[j] = std::make_pair(
-                        src_data[(i / axis_dist * dim + j) * axis_dist + i % axis_dist], j);
+        auto store = [&](int i, int j, float value, int index) {
+            if (out_max_val_) {
+                if (has_axis_) {
+                    // Produces max_val per axis
+                    dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = value;
+                } else {
+                    // Produces max_ind and max_val
+                    dst_data[2 * i * top_k_ + j] = static_cast<float>(index);
+                    dst_data[2 * i * top_k_ + top_k_ + j] = value;
+                }
+            } else {
+                // Produces max_ind per axis
+                dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = static_cast<float>(index);
+            }
+        };
+
+        if (top_k_ == 1) {
+            if (axis_dist == 1) {
+                parallel_for(num, [&](int i) {
+                    float value;
+                    int index;
+                    argmax_row(src_data + i * dim, dim, value, index);
+                    store(i, 0, value, index);
+                });
+            } else {
+                parallel_for2d(outer, div_up(axis_dist, blk_size), [&](int o, int ib) {
+                    float values[blk_size];
+                    int indices[blk_size];
+                    const int i0 = ib * blk_size;
+                    const int len = axis_dist - i0 < blk_size ? axis_dist - i0 : blk_size;
+                    argmax_columns(src_data + o * dim * axis_dist + i0, dim, axis_dist, len, values, indices);
+                    for (int l = 0; l < len; l++)
+                        store(o * axis_dist + i0 + l, 0, values[l], indices[l]);
+                });
             }
+        } else {
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                int start = 0, end = 0;
+                splitter(num, nthr, ithr, start, end);
+
+                // the k best (value, index) pairs seen so far, the heap top is the worst of them
+                std::vector<std::pair<float, int> > heap(top_k_);
+                const std::greater<std::pair<float, int> > greater;
 
-            std::partial_sort(src_vector.begin(), src_vector.begin() + top_k_,
-                              src_vector.end(), std::greater<std::pair<float, int> >());
-
-            for (int j = 0; j < top_k_; ++j) {
-                if (out_max_val_) {
-                    if (has_axis_) {
-                        // Produces max_val per axis
-                        dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].first;
-                    } else {
-                        // Produces max_ind and max_val
-                        dst_data[2 * i * top_k_ + j] = static_cast<float>(src_vector[j].second);
-                        dst_data[2 * i * top_k_ + top_k_ + j] = src_vector[j].first;
+                for (int i = start; i < end; ++i) {
+                    const float* src_row = src_data + i / axis_dist * dim * axis_dist + i % axis_dist;
+                    int filled = 0;
+                    for (int j = 0; j < dim; ++j) {
+                        std::pair<float, int> candidate(src_row[j * axis_dist], j);
+                        if (filled < top_k_) {
+                            heap[filled++] = candidate;
+                            if (filled == top_k_)
+                                std::make_heap(heap.begin(), heap.end(), greater);
+                        } else if (greater(candidate, heap[0])) {
+                            std::pop_heap(heap.begin(), heap.end(), greater);
+                            heap[top_k_ - 1] = candidate;
+                            std::push_heap(heap.begin(), heap.end(), greater);
+                        }
                     }
-                } else {
-                    // Produces max_ind per axis
-                    dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = static_cast<float>(src_vector[j].second);
+
+                    if (filled == top_k_)
+                        std::sort_heap(heap.begin(), heap.end(), greater);
+                    else
+                        std::sort(heap.begin(), heap.begin() + filled, greater);
+
+                    for (int j = 0; j < filled; ++j)
+                        store(i, j, heap[j].first, heap[j].second);
                 }
-            }
+            });
         }
 
         return OK;
     }
 
 private:
+#if defined(HAVE_AVX512F)
+    static const int blk_size = 16;
+#else
+    static const int blk_size = 8;
+#endif
+
+    // The ties go to the bigger index, as with the std::greater ordering of the (value, index) pairs
+    static void argmax_row(const float* src, const int dim, float& value, int& index) {
+        int j = 0;
+        value = src[0];
+        index = 0;
+#if defined(HAVE_AVX2)
+        if (dim >= 8) {
+            __m256 vmax = _mm256_loadu_ps(src);
+            __m256i vidx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256i vcur = vidx;
+            const __m256i vstep = _mm256_set1_epi32(8);
+            for (j = 8; j <= dim - 8; j += 8) {
+                vcur = _mm256_add_epi32(vcur, vstep);
+                __m256 vsrc = _mm256_loadu_ps(src + j);
+                __m256 vmask = _mm256_cmp_ps(vsrc, vmax, _CMP_GE_OQ);
+                vmax = _mm256_blendv_ps(vmax, vsrc, vmask);
+                vidx = _mm256_blendv_epi8(vidx, vcur, _mm256_castps_si256(vmask));
+            }
+
+            float lane_values[8];
+            int lane_indices[8];
+            _mm256_storeu_ps(lane_values, vmax);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lane_indices), vidx);
+            value = lane_values[0];
+            index = lane_indices[0];
+            for (int l = 1; l < 8; l++) {
+                if (lane_values[l] > value || (lane_values[l] == value && lane_indices[l] > index)) {
+                    value = lane_values[l];
+                    index = lane_indices[l];
+                }
+            }
+        }
+#endif
+        for (; j < dim; j++) {
+            if (src[j] >= value) {
+                value = src[j];
+                index = j;
+            }
+        }
+    }
+
+    // The argmax of the len adjacent columns of a [dim x stride] matrix, the columns are reduced side by side
+    static void argmax_columns(const float* src, const int dim, const int stride, const int len,
+                               float* values, int* indices) {
+#if defined(HAVE_AVX512F)
+        if (len == blk_size) {
+            __m512 vmax = _mm512_loadu_ps(src);
+            __m512i vidx = _mm512_setzero_si512();
+            for (int j = 1; j < dim; j++) {
+                __m512 vsrc = _mm512_loadu_ps(src + j * stride);
+                __mmask16 kmask = _mm512_cmp_ps_mask(vsrc, vmax, _CMP_GE_OQ);
+                vmax = _mm512_mask_blend_ps(kmask, vmax, vsrc);
+                vidx = _mm512_mask_blend_epi32(kmask, vidx, _mm512_set1_epi32(j));
+            }
+            _mm512_storeu_ps(values, vmax);
+            _mm512_storeu_si512(indices, vidx);
+            return;
+        }
+#elif defined(HAVE_AVX2)
+        if (len == blk_size) {
+            __m256 vmax = _mm256_loadu_ps(src);
+            __m256i vidx = _mm256_setzero_si256();
+            for (int j = 1; j < dim; j++) {
+                __m256 vsrc = _mm256_loadu_ps(src + j * stride);
+                __m256 vmask = _mm256_cmp_ps(vsrc, vmax, _CMP_GE_OQ);
+                vmax = _mm256_blendv_ps(vmax, vsrc, vmask);
+                vidx = _mm256_blendv_epi8(vidx, _mm256_set1_epi32(j), _mm256_castps_si256(vmask));
+            }
+            _mm256_storeu_ps(values, vmax);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(indices), vidx);
+            return;
+        }
+#endif
+        for (int l = 0; l < len; l++) {
+            values[l] = src[l];
+            indices[l] = 0;
+        }
+        for (int j = 1; j < dim; j++) {
+            for (int l = 0; l < len; l++) {
+                if (src[j * stride + l] >= values[l]) {
+                    values[l] = src[j * stride + l];
+                    indices[l] = j;
+                }
+            }
+        }
+    }
+
+    static inline int div_up(const int a, const int b) {
+        return (a + b - 1) / b;
+    }
+
     bool out_max_val_;
     int top_k_;
     bool has_axis_;
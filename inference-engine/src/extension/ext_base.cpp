@@ -55,6 +55,29 @@ ExtLayerBase::init(LayerConfig& config, ResponseDesc *resp) noexcept {
     return OK;
 }
 
+void ExtLayerBase::getFusedScaleShift(const CNNLayer* layer, size_t channels, size_t padded_channels,
+                                      std::vector<float>& scales, std::vector<float>& shifts) {
+    scales.assign(padded_channels, 0.0f);
+    shifts.assign(padded_channels, 0.0f);
+    std::fill_n(scales.begin(), channels, 1.0f);
+
+    auto weights = layer->blobs.find("fused_weights");
+    if (weights != layer->blobs.end()) {
+        if (weights->second->size() != channels)
+            THROW_IE_EXCEPTION << layer->name << " has the fused weights of wrong size!";
+        const float* data = weights->second->cbuffer().as<const float*>();
+        std::copy(data, data + channels, scales.begin());
+    }
+
+    auto biases = layer->blobs.find("fused_biases");
+    if (biases != layer->blobs.end()) {
+        if (biases->second->size() != channels)
+            THROW_IE_EXCEPTION << layer->name << " has the fused biases of wrong size!";
+        const float* data = biases->second->cbuffer().as<const float*>();
+        std::copy(data, data + channels, shifts.begin());
+    }
+}
+
 void ExtLayerBase::addConfig(const CNNLayer* layer, std::vector<DataConfigurator> in_l, std::vector<DataConfigurator> out_l, bool dynBatchSupport) {
     LayerConfig config;
 
@@ -39,6 +39,10 @@ protected:
 
     void addConfig(const CNNLayer* layer, std::vector<DataConfigurator> in_l,
                    std::vector<DataConfigurator> out_l, bool dynBatchSupport = false);
+    // The per channel scales and shifts of the ScaleShift the CPU plugin has fused into the layer ("fused_weights"
+    // and "fused_biases" blobs), ones and zeros without it. Both are padded with zeros up to the padded channels.
+    void getFusedScaleShift(const CNNLayer* layer, size_t channels, size_t padded_channels,
+                            std::vector<float>& scales, std::vector<float>& shifts);
     std::string errorMsg;
     std::vector<LayerConfig> confs;
 
@@ -5,9 +5,12 @@
 #include "ext_list.hpp"
 #include "ext_base.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
+#include "ie_parallel.hpp"
+#include "simd_math.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -45,43 +48,26 @@ public:
         size_t N_ = inputs[0]->getTensorDesc().getDims()[1];
         size_t C_ = inputs[0]->getTensorDesc().getDims()[2];
 
-        // Fill output_sequences with -1
-        for (size_t ii = 0; ii < T_*N_; ii++) {
-            output_sequences[ii] = -1;
-        }
-
-        for (size_t n = 0; n < N_; ++n) {
-            int prev_class_idx = -1;
-            size_t output_index = n*T_;
-
-            for (int t = 0; /* check at end */; ++t) {
-                // get maximum probability and its index
-                int max_class_idx = 0;
-
-                const float* probs = probabilities + t*C_*N_ + n*C_;
-                float max_prob = probs[0];
-                ++probs;
+        // the sequences are independent: every one is decoded into its own row of the output
+        parallel_for(N_, [&](size_t n) {
+            float* output_row = output_sequences + n*T_;
+            std::fill(output_row, output_row + T_, -1.f);
 
-                for (size_t c = 1; c < C_; ++c, ++probs) {
-                    if (*probs > max_prob) {
-                        max_class_idx = static_cast<int>(c);
-                        max_prob = *probs;
-                    }
-                }
-
-                if (max_class_idx < static_cast<int>(C_) - 1 &&
-                        max_class_idx != prev_class_idx) {
-                    output_sequences[output_index] = static_cast<float>(max_class_idx);
-                    output_index++;
-                }
+            // the sequence lasts while its indicators are set, the first step is always decoded
+            size_t length = 1;
+            while (length < T_ && sequence_indicators[length*N_ + n] != 0)
+                length++;
 
+            const int blank_idx = static_cast<int>(C_) - 1;
+            int prev_class_idx = -1;
+            size_t output_index = 0;
+            for (size_t t = 0; t < length; ++t) {
+                const int max_class_idx = static_cast<int>(simd::argmax(probabilities + t*C_*N_ + n*C_, C_));
+                if (max_class_idx < blank_idx && max_class_idx != prev_class_idx)
+                    output_row[output_index++] = static_cast<float>(max_class_idx);
                 prev_class_idx = max_class_idx;
-
-                if (t + 1 == static_cast<int>(T_) || sequence_indicators[(t + 1)*N_ + n] == 0) {
-                    break;
-                }
             }
-        }
+        });
         return OK;
     }
 };
@@ -66,7 +66,6 @@ public:
             ownStrides[2] = block_size * C;
             ownStrides[3] = 1;
             ownStrides[4] = C;
-            work_amount_dst = ownStrides[0] * own_dims[0];
 
             addConfig(layer, { DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
@@ -80,32 +79,15 @@ public:
         float* dst_data = outputs[0]->cbuffer().as<float *>() +
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
-        //  Parallel
-        parallel_nt(0, [&](const int ithr, const int nthr) {
-            size_t start = 0, end = 0, src_idx = 0;
-            size_t counters[CNTR_SIZE] = { 0 };
-            splitter(work_amount_dst, nthr, ithr, start, end);
-            for (int j = CNTR_SIZE - 1, i = start; j >= 0; j--) {
-                counters[j] = i % own_dims[j];
-                src_idx += counters[j] * ownStrides[j];
-                i /= own_dims[j];
-            }
-
-            for (size_t iwork = start, i = 1; iwork < end; ++iwork) {
-                dst_data[iwork] = src_data[src_idx];
-                for (int j = CNTR_SIZE - 1; j >= 0; j--) {
-                    counters[j]++;
-                    if (counters[j] < own_dims[j]) {
-                        src_idx += ownStrides[j];
-                        break;
-                    } else {
-                        counters[j] = i = 0;
-                    }
-                }
-                if (!i) {
-                    for (src_idx = 0; i < CNTR_SIZE; ++i)
-                        src_idx += counters[i] * ownStrides[i];
-                }
+        //  The rows of the destination interleave the rows of block_size source channels, a row at a time
+        const size_t W = own_dims[3];
+        const size_t block_size = own_dims[4];
+        parallel_for3d(own_dims[0], own_dims[1], own_dims[2], [&](size_t x, size_t h, size_t c) {
+            float* dst = dst_data + ((x * own_dims[1] + h) * own_dims[2] + c) * W * block_size;
+            const float* src = src_data + x * ownStrides[0] + h * ownStrides[1] + c * ownStrides[2];
+            for (size_t b = 0; b < block_size; b++, src += ownStrides[4]) {
+                for (size_t w = 0; w < W; w++)
+                    dst[w * block_size + b] = src[w];
             }
         });
 
@@ -113,7 +95,6 @@ public:
     }
 
 private:
-    size_t work_amount_dst;
     size_t own_dims[CNTR_SIZE];
     size_t ownStrides[CNTR_SIZE];
 };
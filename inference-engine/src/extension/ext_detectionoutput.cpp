@@ -12,6 +12,9 @@
 #include <utility>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#if defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -20,7 +23,7 @@ namespace Cpu {
 template <typename T>
 static bool SortScorePairDescend(const std::pair<float, T>& pair1,
                                  const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
+    return pair1.first > pair2.first || (pair1.first == pair2.first && pair1.second < pair2.second);
 }
 
 class DetectionOutputImpl: public ExtLayerBase {
@@ -163,45 +166,41 @@ public:
             }
         }
 
-        for (int n = 0; n < N; ++n) {
-            for (int c = 0; c < _num_classes; ++c) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                }
+        parallel_for2d(N, _num_classes, [&](int n, int c) {
+            for (int p = 0; p < _num_priors; ++p) {
+                reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
             }
-        }
+        });
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
-
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                        const float *pboxes;
-                        const float *psizes;
-                        if (_share_location) {
-                            pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
-                        } else {
-                            pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                        }
-
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+        if (!_decrease_label_id) {
+            // Caffe style, the classes of all the images are independent
+            parallel_for2d(N, _num_classes, [&](int n, int c) {
+                if (c != _background_label_id) {  // Ignore background class
+                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes + c;
+
+                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    const float *pboxes;
+                    const float *psizes;
+                    if (_share_location) {
+                        pboxes = decoded_bboxes_data + n*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_priors;
+                    } else {
+                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                     }
-                });
-            } else {
-                // MXNet style
+
+                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                }
+            });
+        } else {
+            // MXNet style
+            parallel_for(N, [&](int n) {
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                int *pbuffer = buffer_data + n*_num_classes*_num_priors;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
@@ -209,41 +208,48 @@ public:
                 const float *psizes = bbox_sizes_data + n*_num_priors;
 
                 nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
-            }
+            });
+        }
 
-            for (int c = 0; c < _num_classes; ++c) {
-                detections_total += detections_data[n*_num_classes + c];
-            }
+        if (_keep_top_k > -1) {
+            parallel_for(N, [&](int n) {
+                int detections_total = 0;
+                for (int c = 0; c < _num_classes; ++c) {
+                    detections_total += detections_data[n*_num_classes + c];
+                }
 
-            if (_keep_top_k > -1 && detections_total > _keep_top_k) {
-                std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                if (detections_total > _keep_top_k) {
+                    std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                    conf_index_class_map.reserve(detections_total);
 
-                for (int c = 0; c < _num_classes; ++c) {
-                    int detections = detections_data[n*_num_classes + c];
-                    int *pindices = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                    float *pconf  = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    for (int c = 0; c < _num_classes; ++c) {
+                        int detections = detections_data[n*_num_classes + c];
+                        int *pindices = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                        float *pconf  = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
 
-                    for (int i = 0; i < detections; ++i) {
-                        int idx = pindices[i];
-                        conf_index_class_map.push_back(std::make_pair(pconf[idx], std::make_pair(c, idx)));
+                        for (int i = 0; i < detections; ++i) {
+                            int idx = pindices[i];
+                            conf_index_class_map.push_back(std::make_pair(pconf[idx], std::make_pair(c, idx)));
+                        }
                     }
-                }
 
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
-                conf_index_class_map.resize(_keep_top_k);
+                    // only the kept detections have to be ordered
+                    std::partial_sort(conf_index_class_map.begin(), conf_index_class_map.begin() + _keep_top_k,
+                                      conf_index_class_map.end(), SortScorePairDescend<std::pair<int, int>>);
+                    conf_index_class_map.resize(_keep_top_k);
 
-                // Store the new indices.
-                memset(detections_data + n*_num_classes, 0, _num_classes * sizeof(int));
+                    // Store the new indices.
+                    memset(detections_data + n*_num_classes, 0, _num_classes * sizeof(int));
 
-                for (size_t j = 0; j < conf_index_class_map.size(); ++j) {
-                    int label = conf_index_class_map[j].second.first;
-                    int idx = conf_index_class_map[j].second.second;
-                    int *pindices = indices_data + n * _num_classes * _num_priors + label * _num_priors;
-                    pindices[detections_data[n*_num_classes + label]] = idx;
-                    detections_data[n*_num_classes + label]++;
+                    for (size_t j = 0; j < conf_index_class_map.size(); ++j) {
+                        int label = conf_index_class_map[j].second.first;
+                        int idx = conf_index_class_map[j].second.second;
+                        int *pindices = indices_data + n * _num_classes * _num_priors + label * _num_priors;
+                        pindices[detections_data[n*_num_classes + label]] = idx;
+                        detections_data[n*_num_classes + label]++;
+                    }
                 }
-            }
+            });
         }
 
         const int DETECTION_SIZE = outputs[0]->getTensorDesc().getDims()[3];
@@ -374,20 +380,10 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decoded_bbox[idx1*4 + 0];
-    float ymin1 = decoded_bbox[idx1*4 + 1];
-    float xmax1 = decoded_bbox[idx1*4 + 2];
-    float ymax1 = decoded_bbox[idx1*4 + 3];
-
-    float xmin2 = decoded_bbox[idx2*4 + 0];
-    float ymin2 = decoded_bbox[idx2*4 + 1];
-    float ymax2 = decoded_bbox[idx2*4 + 3];
-    float xmax2 = decoded_bbox[idx2*4 + 2];
-
+static inline float JaccardOverlap(const float xmin1, const float ymin1, const float xmax1, const float ymax1,
+                                   const float bbox1_size,
+                                   const float xmin2, const float ymin2, const float xmax2, const float ymax2,
+                                   const float bbox2_size) {
     if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
         return 0.0f;
     }
@@ -405,12 +401,20 @@ static inline float JaccardOverlap(const float *decoded_bbox,
     }
 
     float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
 
     return intersect_size / (bbox1_size + bbox2_size - intersect_size);
 }
 
+static inline float JaccardOverlap(const float *decoded_bbox,
+                                   const float *bbox_sizes,
+                                   const int idx1,
+                                   const int idx2) {
+    return JaccardOverlap(decoded_bbox[idx1*4 + 0], decoded_bbox[idx1*4 + 1],
+                          decoded_bbox[idx1*4 + 2], decoded_bbox[idx1*4 + 3], bbox_sizes[idx1],
+                          decoded_bbox[idx2*4 + 0], decoded_bbox[idx2*4 + 1],
+                          decoded_bbox[idx2*4 + 2], decoded_bbox[idx2*4 + 3], bbox_sizes[idx2]);
+}
+
 void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
                                    const float *loc_data,
                                    const float *variance_data,
@@ -532,20 +536,63 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+    // the kept boxes are stored by coordinates to test the overlap with several of them at once
+    std::vector<float> kept(5 * num_output_scores);
+    float *kept_xmin = kept.data();
+    float *kept_ymin = kept_xmin + num_output_scores;
+    float *kept_xmax = kept_ymin + num_output_scores;
+    float *kept_ymax = kept_xmax + num_output_scores;
+    float *kept_size = kept_ymax + num_output_scores;
+
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
 
+        const float xmin = bboxes[idx*4 + 0];
+        const float ymin = bboxes[idx*4 + 1];
+        const float xmax = bboxes[idx*4 + 2];
+        const float ymax = bboxes[idx*4 + 3];
+        const float size = sizes[idx];
+
         bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
+        int k = 0;
+#if defined(HAVE_AVX2)
+        __m256 vxmin = _mm256_set1_ps(xmin);
+        __m256 vymin = _mm256_set1_ps(ymin);
+        __m256 vxmax = _mm256_set1_ps(xmax);
+        __m256 vymax = _mm256_set1_ps(ymax);
+        __m256 vsize = _mm256_set1_ps(size);
+        __m256 vc_zero = _mm256_setzero_ps();
+        __m256 vc_nms_thresh = _mm256_set1_ps(_nms_threshold);
+
+        for (; keep && k <= detections - 8; k += 8) {
+            __m256 vwidth  = _mm256_sub_ps(_mm256_min_ps(vxmax, _mm256_loadu_ps(kept_xmax + k)),
+                                           _mm256_max_ps(vxmin, _mm256_loadu_ps(kept_xmin + k)));
+            __m256 vheight = _mm256_sub_ps(_mm256_min_ps(vymax, _mm256_loadu_ps(kept_ymax + k)),
+                                           _mm256_max_ps(vymin, _mm256_loadu_ps(kept_ymin + k)));
+            __m256 vintersect = _mm256_mul_ps(vwidth, vheight);
+            __m256 voverlap = _mm256_div_ps(vintersect,
+                    _mm256_sub_ps(_mm256_add_ps(vsize, _mm256_loadu_ps(kept_size + k)), vintersect));
+
+            __m256 vcmp = _mm256_and_ps(_mm256_cmp_ps(vwidth, vc_zero, _CMP_GT_OS),
+                                        _mm256_cmp_ps(vheight, vc_zero, _CMP_GT_OS));
+            vcmp = _mm256_and_ps(vcmp, _mm256_cmp_ps(voverlap, vc_nms_thresh, _CMP_GT_OS));
+            keep = _mm256_movemask_ps(vcmp) == 0;
+        }
+#endif
+        for (; keep && k < detections; ++k) {
+            float overlap = JaccardOverlap(xmin, ymin, xmax, ymax, size,
+                                           kept_xmin[k], kept_ymin[k], kept_xmax[k], kept_ymax[k], kept_size[k]);
             if (overlap > _nms_threshold) {
                 keep = false;
-                break;
             }
         }
         if (keep) {
             indices[detections] = idx;
+            kept_xmin[detections] = xmin;
+            kept_ymin[detections] = ymin;
+            kept_xmax[detections] = xmax;
+            kept_ymax[detections] = ymax;
+            kept_size[detections] = size;
             detections++;
         }
     }
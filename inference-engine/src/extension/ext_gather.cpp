@@ -10,9 +10,10 @@
 #include <vector>
 #include <cassert>
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include "ie_parallel.hpp"
-#include "simple_copy.h"
+#include "simd_math.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -63,6 +64,22 @@ public:
             if (dataLength == 0)
                 THROW_IE_EXCEPTION << layer->name << " Incorrect input parameters dimension!";
 
+            //  Embedding bag: the rows of each bag of the last index dimension are summed or averaged
+            std::string reductionType = layer->GetParamAsString("reduction", "");
+            if (reductionType == "sum")
+                reduction = Reduction::Sum;
+            else if (reductionType == "mean")
+                reduction = Reduction::Mean;
+            else if (!reductionType.empty())
+                THROW_IE_EXCEPTION << layer->name << " Incorrect reduction type " << reductionType << "!";
+
+            if (reduction != Reduction::None) {
+                const SizeVector& idx_dims = layer->insData[GATHER_INDEXES].lock()->getTensorDesc().getDims();
+                if (numDictionaries != 1 || idx_dims.empty() || idx_dims.back() == 0)
+                    THROW_IE_EXCEPTION << layer->name << " Reduction is supported only for the axis 0 and the non-empty bags!";
+                bagSize = idx_dims.back();
+            }
+
             addConfig(layer, { DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN) },
                       { DataConfigurator(ConfLayout::PLN) });
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
@@ -86,15 +103,33 @@ public:
     }
 
 private:
+    enum class Reduction { None, Sum, Mean };
+
     template <typename data_t>
     void gather(data_t *src_dataIdx, Blob::Ptr indexes, Blob::Ptr dictionary, Blob::Ptr output);
+    template <typename data_t>
+    void gatherReduce(const data_t *src_dataIdx, size_t numBags, const float *src_dataDict, float *dst_data);
+
+    inline void prefetchRow(const float *row) const {
+#if defined(HAVE_SSE)
+        //  The rows are far apart in the big tables, so the hardware prefetcher does not see the next one coming
+        const char *p = reinterpret_cast<const char *>(row);
+        for (size_t offset = 0; offset < std::min(rowPrefetchBytes, dataLength * sizeof(float)); offset += 64)
+            _mm_prefetch(p + offset, _MM_HINT_T0);
+#endif
+    }
 
     int axis = 0;
+    Reduction reduction = Reduction::None;
+    size_t bagSize = 1;
     size_t numDictionaries = 1;
     size_t indexRange = 0;
     size_t dataLength = 1;
     const size_t GATHER_DICTIONARY = 0;
     const size_t GATHER_INDEXES = 1;
+    //  How many indices ahead the rows are prefetched and how much of each row
+    const size_t prefetchDistance = 4;
+    const size_t rowPrefetchBytes = 1024;
 };
 
 template <typename data_t>
@@ -104,31 +139,42 @@ void GatherImpl::gather(data_t *src_dataIdx, Blob::Ptr indexes, Blob::Ptr dictio
     float* dst_data = output->cbuffer().as<float *>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
     src_dataIdx += indexes->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
-    if (axis == 0) {
-        parallel_for(src_dataIdxSize, [&](size_t i) {
-            unsigned int idx = static_cast<unsigned int>(src_dataIdx[i]);
+    if (reduction != Reduction::None) {
+        gatherReduce(src_dataIdx, src_dataIdxSize / bagSize, src_dataDict, dst_data);
+    } else if (axis == 0) {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(src_dataIdxSize, nthr, ithr, start, end);
+            for (size_t i = start; i < end; i++) {
+                if (i + prefetchDistance < end) {
+                    unsigned int next = static_cast<unsigned int>(src_dataIdx[i + prefetchDistance]);
+                    if (next < indexRange)
+                        prefetchRow(&src_dataDict[dataLength * next]);
+                }
 
-            //  Index clipping
-            if (idx < indexRange) {
-                //  Copying data to destination from Dictionary
-                simple_copy(&dst_data[i * dataLength],
-                            output->byteSize() - (dataLength * i),
-                            &src_dataDict[dataLength * idx],
-                            sizeof(float) * dataLength);
-            } else {
-                std::fill_n(&dst_data[i * dataLength], dataLength, 0.f);
+                unsigned int idx = static_cast<unsigned int>(src_dataIdx[i]);
+
+                //  Index clipping
+                if (idx < indexRange) {
+                    //  Copying data to destination from Dictionary
+                    std::memcpy(&dst_data[i * dataLength], &src_dataDict[dataLength * idx], sizeof(float) * dataLength);
+                } else {
+                    std::fill_n(&dst_data[i * dataLength], dataLength, 0.f);
+                }
             }
         });
     } else {
-        parallel_for(src_dataIdxSize, [&](size_t i) {
+        // the short rows are copied by the blocks of at least 16K floats per thread
+        parallel_options options;
+        options.grain = std::max<size_t>(1, 16384 / std::max<size_t>(1, dataLength * numDictionaries));
+        parallel_for(options, src_dataIdxSize, [&](size_t i) {
             unsigned int idx = static_cast<unsigned int>(src_dataIdx[i]);
 
             //  Index clipping
             if (idx < indexRange) {
                 //  Copying data to destination from Dictionary
                 for (size_t j = 0; j < numDictionaries; j++) {
-                    simple_copy(&dst_data[dataLength * (i + j * src_dataIdxSize)],
-                                output->byteSize() - (dataLength * (i + j * src_dataIdxSize)),
+                    std::memcpy(&dst_data[dataLength * (i + j * src_dataIdxSize)],
                                 &src_dataDict[dataLength * (idx + j * indexRange)],
                                 sizeof(float) * dataLength);
                 }
@@ -141,6 +187,45 @@ void GatherImpl::gather(data_t *src_dataIdx, Blob::Ptr indexes, Blob::Ptr dictio
     }
 }
 
+template <typename data_t>
+void GatherImpl::gatherReduce(const data_t *src_dataIdx, size_t numBags, const float *src_dataDict, float *dst_data) {
+    //  The indices out of the range are skipped, so the bags of the different length can be padded with -1
+    parallel_for(numBags, [&](size_t bag) {
+        const data_t *bagIdx = src_dataIdx + bag * bagSize;
+        float *dst_row = &dst_data[bag * dataLength];
+        std::fill_n(dst_row, dataLength, 0.f);
+
+        size_t count = 0;
+        for (size_t k = 0; k < bagSize; k++) {
+            if (k + prefetchDistance < bagSize) {
+                unsigned int next = static_cast<unsigned int>(bagIdx[k + prefetchDistance]);
+                if (next < indexRange)
+                    prefetchRow(&src_dataDict[dataLength * next]);
+            }
+
+            unsigned int idx = static_cast<unsigned int>(bagIdx[k]);
+            if (idx >= indexRange)
+                continue;
+
+            const float *src_row = &src_dataDict[dataLength * idx];
+            size_t j = 0;
+#if defined(SIMD_WIDTH)
+            for (; j + SIMD_WIDTH <= dataLength; j += SIMD_WIDTH)
+                simd::storeu(dst_row + j, simd::add(simd::loadu(dst_row + j), simd::loadu(src_row + j)));
+#endif
+            for (; j < dataLength; j++)
+                dst_row[j] += src_row[j];
+            count++;
+        }
+
+        if (reduction == Reduction::Mean && count > 1) {
+            const float scale = 1.f / count;
+            for (size_t j = 0; j < dataLength; j++)
+                dst_row[j] *= scale;
+        }
+    });
+}
+
 REG_FACTORY_FOR(ImplFactory<GatherImpl>, Gather);
 
 }  // namespace Cpu
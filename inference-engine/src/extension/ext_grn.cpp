@@ -5,15 +5,22 @@
 #include "ext_list.hpp"
 #include "ext_base.hpp"
 
+#include <cassert>
 #include <cmath>
 #include <string>
 #include <vector>
 #include "ie_parallel.hpp"
+#include "simd_math.h"
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+inline int div_up(const int a, const int b) {
+    assert(b);
+    return (a + b - 1) / b;
+}
+
 class GRNImpl: public ExtLayerBase {
 public:
     explicit GRNImpl(const CNNLayer* layer) {
@@ -23,7 +30,19 @@ public:
 
             bias = layer->GetParamAsFloat("bias");
 
+            const SizeVector& dims = layer->insData[0].lock()->getTensorDesc().getDims();
+            const size_t C = dims.size() > 1 ? dims[1] : 1;
+            getFusedScaleShift(layer, C, div_up(static_cast<int>(C), 16) * 16, scales, shifts);
+
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}});
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() == 4) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, {{blk_layout, false, -1}}, {{blk_layout, false, 0}});
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -41,21 +60,105 @@ public:
         int H = static_cast<int>((dims.size() > 2) ? dims[2] : 1);
         int W = static_cast<int>((dims.size() > 3) ? dims[3] : 1);
 
-        parallel_for3d(N, H, W, [&](int b, int h, int w) {
-            double variance = 0;
+        if (inputs[0]->layout() == BLOCKED) {
+            grn_blk(src_data, dst_data, N, C, H, W);
+            return OK;
+        }
+
+        // the rows of all the channels are processed together, so the data is read by rows, not with a plane stride
+        parallel_for2d(N, H, [&](int b, int h) {
+            std::vector<float> norms(W, 0.0f);
             for (int c = 0; c < C; c++) {
-                variance += std::pow(src_data[b*C*H*W + c*H*W + h*W + w], 2);
+                const float* src_row = src_data + ((b*C + c)*H + h)*W;
+                for (int w = 0; w < W; w++)
+                    norms[w] += src_row[w] * src_row[w];
             }
-            variance = std::pow(variance + bias, 0.5f);
+            for (int w = 0; w < W; w++)
+                norms[w] += bias;
+            simd::rsqrt_array(norms.data(), norms.data(), W);
+
             for (int c = 0; c < C; c++) {
-                dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] / static_cast<float>(variance);
+                const float* src_row = src_data + ((b*C + c)*H + h)*W;
+                float* dst_row = dst_data + ((b*C + c)*H + h)*W;
+                for (int w = 0; w < W; w++)
+                    dst_row[w] = src_row[w] * norms[w] * scales[c] + shifts[c];
             }
         });
         return OK;
     }
 
 private:
+    // nChw8c/nChw16c: the squares of the channel blocks are accumulated for a whole row of pixels, the padded
+    // channels of the last block are masked out of the sums
+    void grn_blk(const float* src_data, float* dst_data, const int N, const int C, const int H, const int W) {
+#if defined(HAVE_AVX512F)
+        const int blk_size = 16;
+#else
+        const int blk_size = 8;
+#endif
+        const int CB = div_up(C, blk_size);
+
+        std::vector<float> mask(CB * blk_size, 0.0f);
+        for (int c = 0; c < C; c++)
+            mask[c] = 1.0f;
+
+        parallel_for2d(N, H, [&](int b, int h) {
+            std::vector<float> sums(W * blk_size, 0.0f);
+            std::vector<float> norms(W);
+
+            for (int cb = 0; cb < CB; cb++) {
+                const float* src_row = src_data + ((b*CB + cb)*H + h)*W*blk_size;
+                const float* pmask = &mask[cb*blk_size];
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                auto vmask = _mm_uni_loadu_ps(pmask);
+                for (int w = 0; w < W; w++) {
+                    auto vsrc = _mm_uni_mul_ps(_mm_uni_loadu_ps(src_row + w*blk_size), vmask);
+                    _mm_uni_storeu_ps(&sums[w*blk_size],
+                                      _mm_uni_add_ps(_mm_uni_loadu_ps(&sums[w*blk_size]), _mm_uni_mul_ps(vsrc, vsrc)));
+                }
+#else
+                for (int w = 0; w < W; w++) {
+                    for (int c = 0; c < blk_size; c++)
+                        sums[w*blk_size + c] += pmask[c] * src_row[w*blk_size + c] * src_row[w*blk_size + c];
+                }
+#endif
+            }
+
+            for (int w = 0; w < W; w++) {
+                double variance = 0;
+                for (int c = 0; c < blk_size; c++)
+                    variance += sums[w*blk_size + c];
+                norms[w] = static_cast<float>(variance + bias);
+            }
+            simd::rsqrt_array(norms.data(), norms.data(), W);
+
+            for (int cb = 0; cb < CB; cb++) {
+                const float* src_row = src_data + ((b*CB + cb)*H + h)*W*blk_size;
+                float* dst_row = dst_data + ((b*CB + cb)*H + h)*W*blk_size;
+                const float* pscl = &scales[cb*blk_size];
+                const float* pshift = &shifts[cb*blk_size];
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                auto vscl = _mm_uni_loadu_ps(pscl);
+                auto vshift = _mm_uni_loadu_ps(pshift);
+                for (int w = 0; w < W; w++) {
+                    auto vnorm = _mm_uni_mul_ps(vscl, _mm_uni_set1_ps(norms[w]));
+                    _mm_uni_storeu_ps(dst_row + w*blk_size,
+                                      _mm_uni_add_ps(_mm_uni_mul_ps(_mm_uni_loadu_ps(src_row + w*blk_size), vnorm), vshift));
+                }
+#else
+                for (int w = 0; w < W; w++) {
+                    for (int c = 0; c < blk_size; c++)
+                        dst_row[w*blk_size + c] = src_row[w*blk_size + c] * norms[w] * pscl[c] + pshift[c];
+                }
+#endif
+            }
+        });
+    }
+
     float bias = 1.0f;
+    // the fused ScaleShift, the scales are zero in the padded channels, so they are written as zeros
+    std::vector<float> scales;
+    std::vector<float> shifts;
 };
 
 REG_FACTORY_FOR(ImplFactory<GRNImpl>, GRN);
@@ -36,6 +36,7 @@ public:
 #endif
 
             addConfig(layer,  {DataConfigurator(blk_layout)}, {DataConfigurator(blk_layout)});
+            addConfig(layer,  {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -43,8 +44,10 @@ public:
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
                        ResponseDesc *resp) noexcept override {
+        bool planar = inputs[0]->getTensorDesc().getLayout() == NCHW;
+
         int IN = static_cast<int>(inputs[0]->getTensorDesc().getDims()[0]);
-        int IC = static_cast<int>(
+        int IC = planar ? static_cast<int>(inputs[0]->getTensorDesc().getDims()[1]) : static_cast<int>(
                 inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims()[1] *
                 inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims()[4]);
         int IH = static_cast<int>(inputs[0]->getTensorDesc().getDims()[2]);
@@ -59,7 +62,8 @@ public:
         const auto *src_data = inputs[0]->buffer().as<const float *>();
         auto *dst_data = outputs[0]->buffer().as<float *>();
 
-        interpolate(IN, IC, src_data, -pad_beg, -pad_beg, IH_pad, IW_pad, IH, IW, dst_data, 0, 0, OH, OW, OH, OW);
+        interpolate(IN, IC, src_data, -pad_beg, -pad_beg, IH_pad, IW_pad, IH, IW, dst_data, 0, 0, OH, OW, OH, OW,
+                    planar);
         return OK;
     }
 
@@ -68,17 +72,34 @@ private:
     int pad_end;
     bool align_corners;
 
-    void interpolate(const int N, const int C,
-                     const float *src, const int x1, const int y1,
-                     const int IH_pad, const int IW_pad, const int IH, const int IW,
-                     float *dst, const int x2, const int y2,
-                     const int OH_pad, const int OW_pad, const int OH, const int OW) {
-        if (IH_pad == OH_pad && IW_pad == OW_pad) {
-            for (int i = 0; i < N * C * OH * OW; i++) {
-                dst[i] = src[i];
+    // The source columns of the output columns and their weights, and the same for the rows. They depend only on
+    // the shapes, so they are computed once and reused while the shapes are the same.
+    struct InterpTable {
+        std::vector<int> idx0;
+        std::vector<int> idx1;
+        std::vector<float> lambda0;
+
+        void init(int in_pad, int out_pad, float ratio) {
+            idx0.resize(out_pad);
+            idx1.resize(out_pad);
+            lambda0.resize(out_pad);
+            for (int o = 0; o < out_pad; o++) {
+                float f = ratio * o;
+                idx0[o] = static_cast<int>(f);
+                idx1[o] = (idx0[o] < in_pad - 1) ? idx0[o] + 1 : idx0[o];
+                lambda0[o] = f - idx0[o];
             }
-            return;
         }
+    };
+
+    InterpTable h_table;
+    InterpTable w_table;
+    std::vector<int> table_shape;
+
+    void prepareTables(const int IH_pad, const int IW_pad, const int OH_pad, const int OW_pad) {
+        std::vector<int> shape = {IH_pad, IW_pad, OH_pad, OW_pad};
+        if (shape == table_shape)
+            return;
 
         float rh;
         float rw;
@@ -90,6 +111,86 @@ private:
             rw = static_cast<float>(IW_pad) / (OW_pad);
         }
 
+        h_table.init(IH_pad, OH_pad, rh);
+        w_table.init(IW_pad, OW_pad, rw);
+        table_shape = shape;
+    }
+
+    void interpolate(const int N, const int C,
+                     const float *src, const int x1, const int y1,
+                     const int IH_pad, const int IW_pad, const int IH, const int IW,
+                     float *dst, const int x2, const int y2,
+                     const int OH_pad, const int OW_pad, const int OH, const int OW, bool planar) {
+        if (IH_pad == OH_pad && IW_pad == OW_pad) {
+            for (int i = 0; i < N * C * OH * OW; i++) {
+                dst[i] = src[i];
+            }
+            return;
+        }
+
+        prepareTables(IH_pad, IW_pad, OH_pad, OW_pad);
+
+        if (planar)
+            interpolate_pln(N, C, src, x1, y1, IH, IW, dst, x2, y2, OH_pad, OW_pad, OH, OW);
+        else
+            interpolate_blk(N, C, src, x1, y1, IH, IW, dst, x2, y2, OH_pad, OW_pad, OH, OW);
+    }
+
+    void interpolate_pln(const int N, const int C,
+                         const float *src, const int x1, const int y1, const int IH, const int IW,
+                         float *dst, const int x2, const int y2,
+                         const int OH_pad, const int OW_pad, const int OH, const int OW) {
+        const int *iw0 = &w_table.idx0[0];
+        const int *iw1 = &w_table.idx1[0];
+        const float *w_lambda = &w_table.lambda0[0];
+
+        parallel_for3d(N, C, OH_pad, [&](int n, int c, int h) {
+                    const float *psrc = src + (n * C + c) * IH * IW;
+                    const float *psrc0 = psrc + (y1 + h_table.idx0[h]) * IW + x1;
+                    const float *psrc1 = psrc + (y1 + h_table.idx1[h]) * IW + x1;
+
+                    float h_lambda0 = h_table.lambda0[h];
+                    float h_lambda1 = 1.0f - h_lambda0;
+
+                    float *pdst = dst + (n * C + c) * OH * OW + (y2 + h) * OW + x2;
+
+                    int w = 0;
+#if defined(HAVE_AVX2)
+                    __m256 vone = _mm256_set1_ps(1.0f);
+                    __m256 vhl0 = _mm256_set1_ps(h_lambda0);
+                    __m256 vhl1 = _mm256_set1_ps(h_lambda1);
+                    for (; w <= OW_pad - 8; w += 8) {
+                        __m256i viw0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(iw0 + w));
+                        __m256i viw1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(iw1 + w));
+                        __m256 vwl0 = _mm256_loadu_ps(w_lambda + w);
+                        __m256 vwl1 = _mm256_sub_ps(vone, vwl0);
+
+                        __m256 vsrc00 = _mm256_i32gather_ps(psrc0, viw0, 4);
+                        __m256 vsrc01 = _mm256_i32gather_ps(psrc0, viw1, 4);
+                        __m256 vsrc10 = _mm256_i32gather_ps(psrc1, viw0, 4);
+                        __m256 vsrc11 = _mm256_i32gather_ps(psrc1, viw1, 4);
+
+                        __m256 vdst0 = _mm256_fmadd_ps(vwl1, vsrc00, _mm256_mul_ps(vwl0, vsrc01));
+                        __m256 vdst1 = _mm256_fmadd_ps(vwl1, vsrc10, _mm256_mul_ps(vwl0, vsrc11));
+                        __m256 vdst  = _mm256_fmadd_ps(vhl1, vdst0, _mm256_mul_ps(vhl0, vdst1));
+
+                        _mm256_storeu_ps(pdst + w, vdst);
+                    }
+#endif
+                    for (; w < OW_pad; ++w) {
+                        float w_lambda0 = w_lambda[w];
+                        float w_lambda1 = 1.0f - w_lambda0;
+
+                        pdst[w] = h_lambda1 * (w_lambda1 * psrc0[iw0[w]] + w_lambda0 * psrc0[iw1[w]]) +
+                                  h_lambda0 * (w_lambda1 * psrc1[iw0[w]] + w_lambda0 * psrc1[iw1[w]]);
+                    }
+        });
+    }
+
+    void interpolate_blk(const int N, const int C,
+                         const float *src, const int x1, const int y1, const int IH, const int IW,
+                         float *dst, const int x2, const int y2,
+                         const int OH_pad, const int OW_pad, const int OH, const int OW) {
 #if defined(HAVE_AVX512F)
         const int block_size = 16;
 #else
@@ -102,34 +203,24 @@ private:
         int CH = (C + block_size - 1) / block_size;
 
         parallel_for3d(N, CH, OH_pad, [&](int n, int cb, int h) {
-                    const float *psrc = src + n * CB * IH * IW;
-
-                    float fh = rh * h;
-                    int ih0 = static_cast<int>(fh);
-                    int ih1 = (ih0 < IH_pad - 1) ? ih0 + 1 : ih0;
+                    const float *psrc = src + n * CB * IH * IW + cb * block_size * IW * IH;
+                    const float *psrc0 = psrc + (y1 + h_table.idx0[h]) * IW * block_size + x1 * block_size;
+                    const float *psrc1 = psrc + (y1 + h_table.idx1[h]) * IW * block_size + x1 * block_size;
 
-                    float h_lambda0 = fh - ih0;
+                    float h_lambda0 = h_table.lambda0[h];
                     float h_lambda1 = 1.0f - h_lambda0;
 
-                    for (int w = 0; w < OW_pad; ++w) {
-                        float fw = rw * w;
-                        int iw0 = static_cast<int>(fw);
-                        int iw1 = (iw0 < IW_pad - 1) ? iw0 + 1 : iw0;
+                    float *pdst = dst + n * CB * OH * OW + cb * block_size * OW * OH + (y2 + h) * OW * block_size +
+                                  x2 * block_size;
 
-                        float w_lambda0 = fw - iw0;
+                    for (int w = 0; w < OW_pad; ++w, pdst += block_size) {
+                        float w_lambda0 = w_table.lambda0[w];
                         float w_lambda1 = 1.0f - w_lambda0;
 
-                        const float *psrc00 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih0) * IW * block_size + (x1 + iw0) * block_size;
-                        const float *psrc01 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih0) * IW * block_size + (x1 + iw1) * block_size;
-                        const float *psrc10 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih1) * IW * block_size + (x1 + iw0) * block_size;
-                        const float *psrc11 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih1) * IW * block_size + (x1 + iw1) * block_size;
-
-                        float *pdst = dst + n * CB * OH * OW + cb * block_size * OW * OH + (y2 + h) * OW * block_size +
-                                      (x2 + w) * block_size;
+                        const float *psrc00 = psrc0 + w_table.idx0[w] * block_size;
+                        const float *psrc01 = psrc0 + w_table.idx1[w] * block_size;
+                        const float *psrc10 = psrc1 + w_table.idx0[w] * block_size;
+                        const float *psrc11 = psrc1 + w_table.idx1[w] * block_size;
 
 #if defined(HAVE_AVX512F)
                         __m512 vwl0 = _mm512_set1_ps(w_lambda0);
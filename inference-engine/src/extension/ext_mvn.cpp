@@ -10,10 +10,8 @@
 #include <vector>
 #include <cassert>
 #include <algorithm>
-#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-#include <immintrin.h>
-#endif
 #include "ie_parallel.hpp"
+#include "simd_math.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -35,6 +33,10 @@ public:
             normalize_variance = layer->GetParamAsBool("normalize_variance", false);
             eps = layer->GetParamAsFloat("eps");
 
+            const SizeVector& dims = layer->insData[0].lock()->getTensorDesc().getDims();
+            const size_t C = dims.size() > 1 ? dims[1] : 1;
+            getFusedScaleShift(layer, C, div_up(static_cast<int>(C), 16) * 16, scales, shifts);
+
 #if defined(HAVE_AVX512F)
             auto blk_layout = ConfLayout::BLK16;
 #else
@@ -65,11 +67,76 @@ private:
     void mvn_pln(const float* src_data, float* dst_data, const SizeVector& dims);
     void mvn_blk(const float* src_data, float* dst_data, const SizeVector& dims);
 
+    // The statistics are gathered in one pass: the sum and the sum of squares, the chunks are summed up in floats
+    // and the chunk sums are accumulated in doubles. Then the output is written in one more pass as
+    // src * a + b, where a and b fold the mean, the variance and the fused ScaleShift.
+    static void accumulate(const float* src, size_t size, double& sum, double& sqsum);
+    static void scale_shift(const float* src, float* dst, size_t size, float a, float b);
+    void get_scale_shift(double sum, double sqsum, double size, size_t c, float& a, float& b) const;
+
     bool across_channels = false;
     bool normalize_variance = true;
     float eps = 1e-9f;
+    // the fused ScaleShift, the scales are zero in the padded channels, so they are written as zeros
+    std::vector<float> scales;
+    std::vector<float> shifts;
 };
 
+void MVNImpl::accumulate(const float* src, size_t size, double& sum, double& sqsum) {
+    const size_t chunk = 256;
+    for (size_t start = 0; start < size; start += chunk) {
+        const size_t end = std::min(size, start + chunk);
+        size_t i = start;
+        float chunk_sum = 0.0f;
+        float chunk_sqsum = 0.0f;
+#if defined(SIMD_WIDTH)
+        simd::vec vsum = simd::set1(0.0f);
+        simd::vec vsqsum = simd::set1(0.0f);
+        for (; i + SIMD_WIDTH <= end; i += SIMD_WIDTH) {
+            simd::vec vsrc = simd::loadu(src + i);
+            vsum = simd::add(vsum, vsrc);
+            vsqsum = simd::fmadd(vsrc, vsrc, vsqsum);
+        }
+        float lanes[SIMD_WIDTH], sqlanes[SIMD_WIDTH];
+        simd::storeu(lanes, vsum);
+        simd::storeu(sqlanes, vsqsum);
+        for (size_t j = 0; j < SIMD_WIDTH; j++) {
+            chunk_sum += lanes[j];
+            chunk_sqsum += sqlanes[j];
+        }
+#endif
+        for (; i < end; i++) {
+            chunk_sum += src[i];
+            chunk_sqsum += src[i] * src[i];
+        }
+        sum += chunk_sum;
+        sqsum += chunk_sqsum;
+    }
+}
+
+void MVNImpl::scale_shift(const float* src, float* dst, size_t size, float a, float b) {
+    size_t i = 0;
+#if defined(SIMD_WIDTH)
+    simd::vec va = simd::set1(a);
+    simd::vec vb = simd::set1(b);
+    for (; i + SIMD_WIDTH <= size; i += SIMD_WIDTH)
+        simd::storeu(dst + i, simd::fmadd(simd::loadu(src + i), va, vb));
+#endif
+    for (; i < size; i++)
+        dst[i] = src[i] * a + b;
+}
+
+void MVNImpl::get_scale_shift(double sum, double sqsum, double size, size_t c, float& a, float& b) const {
+    double mean = sum / size;
+    double inv_std = 1.0;
+    if (normalize_variance) {
+        double variance = std::max(sqsum / size - mean * mean, 0.0);
+        inv_std = 1.0 / std::sqrt(variance + eps);
+    }
+    a = static_cast<float>(inv_std * scales[c]);
+    b = static_cast<float>(shifts[c] - mean * inv_std * scales[c]);
+}
+
 void MVNImpl::mvn_pln(const float* src_data, float* dst_data, const SizeVector& dims) {
     size_t dims_size = dims.size();
     size_t N = (dims_size > 0) ? dims[0] : 1lu;
@@ -78,153 +145,48 @@ void MVNImpl::mvn_pln(const float* src_data, float* dst_data, const SizeVector&
     size_t H = (dims_size > 3) ? dims[dims_size - 2] : 1lu;
     size_t W = (dims_size > 2) ? dims[dims_size - 1] : 1lu;
 
-    size_t C1 = H * W;
-    size_t C2 = C1 * D;
-    size_t C3 = C2 * C;
+    size_t C2 = D * H * W;
 
     for (size_t b = 0lu; b < N; b++) {
-        // Calculate mean value
-        size_t cb = b * C3;
+        const float* src_b = src_data + b * C * C2;
+        float* dst_b = dst_data + b * C * C2;
+
         if (across_channels) {
-            double mean = 0.0;
-            mean = parallel_sum(C, mean, [&](size_t c)->double {
-                double mean_internal = 0.0;
-                size_t cc = cb + c * C2;
-                for (size_t d = 0lu; d < D; d++) {
-                    size_t cd = cc + d * C1;
-                    for (size_t h = 0lu; h < H; h++) {
-                        size_t ch = cd + h * W;
-                        for (size_t w = 0lu; w < W; w++) {
-                            mean_internal += src_data[ch + w];
-                        }
-                    }
-                }
-                return mean_internal;
+            std::vector<double> sums(C, 0.0), sqsums(C, 0.0);
+            parallel_for(C, [&](size_t c) {
+                accumulate(src_b + c * C2, C2, sums[c], sqsums[c]);
             });
 
-            mean /= C3;
-            parallel_for(C, [&](int c) {
-                size_t cc = cb + c * C2;
-                for (size_t d = 0lu; d < D; d++) {
-                    size_t cd = cc + d * C1;
-                    for (size_t h = 0lu; h < H; h++) {
-                        size_t ch = cd + h * W;
-                        for (size_t w = 0lu; w < W; w++) {
-                            size_t cw = ch + w;
-                            dst_data[cw] = src_data[cw] - static_cast<float>(mean);
-                        }
-                    }
-                }
+            double sum = 0.0, sqsum = 0.0;
+            for (size_t c = 0lu; c < C; c++) {
+                sum += sums[c];
+                sqsum += sqsums[c];
+            }
+
+            parallel_for(C, [&](size_t c) {
+                float a, shift;
+                get_scale_shift(sum, sqsum, static_cast<double>(C * C2), c, a, shift);
+                scale_shift(src_b + c * C2, dst_b + c * C2, C2, a, shift);
             });
         } else {
+            // the channel is read the second time right after the first one, while it is still in the cache
             parallel_for(C, [&](size_t c) {
-                double mean = 0.f;
-                size_t cc = cb + c * C2;
-                for (size_t d = 0lu; d < D; d++) {
-                    size_t cd = cc + d * C1;
-                    for (size_t h = 0lu; h < H; h++) {
-                        size_t ch = cd + h * W;
-                        for (size_t w = 0lu; w < W; w++) {
-                            mean += src_data[ch + w];
-                        }
-                    }
-                }
+                double sum = 0.0, sqsum = 0.0;
+                accumulate(src_b + c * C2, C2, sum, sqsum);
 
-                mean /= static_cast<double>(C2);
-
-                for (size_t d = 0lu; d < D; d++) {
-                    size_t cd = cc + d * C1;
-                    for (size_t h = 0lu; h < H; h++) {
-                        size_t ch = cd + h * W;
-                        for (size_t w = 0lu; w < W; w++) {
-                            size_t cw = ch + w;
-                            dst_data[cw] = src_data[cw] - static_cast<float>(mean);
-                        }
-                    }
-                }
+                float a, shift;
+                get_scale_shift(sum, sqsum, static_cast<double>(C2), c, a, shift);
+                scale_shift(src_b + c * C2, dst_b + c * C2, C2, a, shift);
             });
         }
     }
-
-    if (normalize_variance) {
-        for (size_t b = 0lu; b < N; b++) {
-            // Calculate variances value
-            size_t cb = b * C3;
-            if (across_channels) {
-                double variance = 0.0;
-                variance = parallel_sum(C, variance, [&](size_t c)->double {
-                    double variance_internal = 0.0;
-                    size_t cc = cb + c * C2;
-                    for (size_t d = 0lu; d < D; d++) {
-                        size_t cd = cc + d * C1;
-                        for (size_t h = 0lu; h < H; h++) {
-                            size_t ch = cd + h * W;
-                            for (size_t w = 0lu; w < W; w++) {
-                                variance_internal += std::pow(dst_data[ch + w], 2);
-                            }
-                        }
-                    }
-                    return variance_internal;
-                });
-
-                variance /= C3;
-                variance += eps;
-                variance = std::pow(variance, 0.5f);
-                parallel_for(C, [&](int c) {
-                    size_t cc = cb + c * C2;
-                    for (size_t d = 0lu; d < D; d++) {
-                        size_t cd = cc + d * C1;
-                        for (size_t h = 0lu; h < H; h++) {
-                            size_t ch = cd + h * W;
-                            for (size_t w = 0lu; w < W; w++) {
-                                dst_data[ch + w] /= static_cast<float>(variance);
-                            }
-                        }
-                    }
-                });
-            } else {
-                parallel_for(C, [&](size_t c) {
-                    double variance = 0.0;
-                    size_t cc = cb + c * C2;
-                    for (size_t d = 0lu; d < D; d++) {
-                        size_t cd = cc + d * C1;
-                        for (size_t h = 0lu; h < H; h++) {
-                            size_t ch = cd + h * W;
-                            for (size_t w = 0lu; w < W; w++) {
-                                variance += std::pow(dst_data[ch + w], 2);
-                            }
-                        }
-                    }
-
-                    variance /= static_cast<double>(C2);
-                    variance += eps;
-                    variance = std::pow(variance, 0.5f);
-                    for (size_t d = 0lu; d < D; d++) {
-                        size_t cd = cc + d * C1;
-                        for (size_t h = 0lu; h < H; h++) {
-                            size_t ch = cd + h * W;
-                            for (size_t w = 0lu; w < W; w++) {
-                                dst_data[ch + w] /= static_cast<float>(variance);
-                            }
-                        }
-                    }
-                });
-            }
-        }
-    }
 }
 
 void MVNImpl::mvn_blk(const float* src_data, float* dst_data, const SizeVector& dims) {
 #if defined(HAVE_AVX512F)
-    size_t blk_size = 16;
+    const size_t blk_size = 16;
 #else
-    size_t blk_size = 8lu;
-#endif
-
-#if defined(HAVE_AVX512F)
-    typedef __m512 vec_type;
-#elif defined(HAVE_AVX2)
-    typedef __m256 vec_type;
+    const size_t blk_size = 8lu;
 #endif
     size_t dims_size = dims.size();
     size_t N = (dims_size > 0) ? dims[0] : 1lu;
@@ -233,254 +195,74 @@ void MVNImpl::mvn_blk(const float* src_data, float* dst_data, const SizeVector&
     size_t H = (dims_size > 3) ? dims[dims_size - 2] : 1lu;
     size_t W = (dims_size > 2) ? dims[dims_size - 1] : 1lu;
 
-    int CB = div_up(static_cast<int>(C), static_cast<int>(blk_size));
-
-    size_t C0 = W * blk_size;
-    size_t C1 = C0 * H;
-    size_t C2 = C1 * D;
-    size_t C3 = C2 * CB;
-    size_t C5 = C * D * H * W;
-
-    if (normalize_variance) {
-        for (size_t b = 0lu; b < N; b++) {
-            size_t ccb = b * C3;
-            if (across_channels) {
-                double mean = 0.0;
-                mean = parallel_sum3d(CB, D, H, mean, [&](size_t cb, size_t d, size_t h)->double {
-                    size_t ccbd = ccb + cb * C2 + d * C1 + h * C0;
-                    size_t min_cb = std::min(blk_size, C - cb * blk_size);
-                    double mean_internal = 0.0;
-                    for (size_t w = 0lu; w < W; w++) {
-                        size_t cw = ccbd + w * blk_size;
-                        for (size_t c = 0lu; c < min_cb; c++) {
-                            mean_internal += src_data[cw + c];
-                        }
-                    }
-                    return mean_internal;
-                });
-
-                mean /= static_cast<double>(C5);
-
-                double variance = 0.0;
-                variance = parallel_sum3d(CB, D, H, variance, [&](size_t cb, size_t d, size_t h)->double {
-                    size_t ccbd = ccb + cb * C2 + d * C1 + h * C0;
-                    double variance_internal = 0.0;
-                    for (size_t w = 0lu, min_cb = std::min(blk_size, C - cb * blk_size); w < W; w++) {
-                        size_t cw = ccbd + w * blk_size;
-                        for (size_t c = 0lu; c < min_cb; c++) {
-                            variance_internal += std::pow(static_cast<double>(src_data[cw + c]) - mean, 2);
-                        }
-                    }
-                    return variance_internal;
-                });
-
-                variance /= static_cast<double>(C5);
-                variance += eps;
-                variance = std::pow(variance, 0.5f);
-
-                parallel_for3d(CB, D, H, [&](size_t cb, size_t d, size_t h) {
-                    size_t ccbd = ccb + cb * C2 + d * C1 + h * C0;
-                    for (size_t w = 0lu, min_cb = std::min(blk_size, C - cb * blk_size); w < W; w++) {
-                        size_t cw = ccbd + w * blk_size;
-                        for (size_t c = 0lu; c < min_cb; c++) {
-                            size_t src_offset = cw + c;
-
-                            dst_data[src_offset] = static_cast<float>((static_cast<double>(src_data[src_offset]) - mean) / variance);
-                        }
-                    }
-                });
-            } else {
-                parallel_for(CB, [&](size_t cb) {
-                    size_t src_off = ccb + cb * C2;
-#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-                    vec_type vmean = _mm_uni_setzero_ps();
-                    for (size_t d = 0lu; d < D; d++) {
-                        size_t cd = src_off + d * C1;
-                        for (size_t h = 0lu; h < H; h++) {
-                            size_t ch = cd + h * C0;
-                            for (size_t w = 0lu; w < W; w++) {
-                                vec_type vsrc = _mm_uni_loadu_ps(src_data + ch + w * blk_size);
-                                vmean = _mm_uni_add_ps(vmean, vsrc);
-                            }
-                        }
-                    }
-
-                    vec_type vsize = _mm_uni_set1_ps(static_cast<float>(D * H * W));
-                    vmean = _mm_uni_div_ps(vmean, vsize);
-
-                    vec_type vvariance = _mm_uni_setzero_ps();
-                    for (size_t d = 0lu; d < D; d++) {
-                        size_t cd = src_off + d * C1;
-                        for (size_t h = 0lu; h < H; h++) {
-                            size_t ch = cd + h * C0;
-                            for (size_t w = 0lu; w < W; w++) {
-                                vec_type vsrc = _mm_uni_loadu_ps(src_data + ch + w * blk_size);
-                                vsrc = _mm_uni_sub_ps(vsrc, vmean);
-                                vvariance = _mm_uni_add_ps(vvariance, _mm_uni_mul_ps(vsrc, vsrc));
-                            }
-                        }
-                    }
-                    vvariance = _mm_uni_div_ps(vvariance, vsize);
-
-                    vec_type veps = _mm_uni_set1_ps(eps);
-                    vvariance = _mm_uni_add_ps(vvariance, veps);
-
-                    vvariance = _mm_uni_sqrt_ps(vvariance);
-
-                    for (size_t d = 0lu; d < D; d++) {
-                        size_t cd = src_off + d * C1;
-                        for (size_t h = 0lu; h < H; h++) {
-                            size_t ch = cd + h * C0;
-                            for (size_t w = 0lu; w < W; w++) {
-                                size_t offset = ch + w * blk_size;
-                                vec_type vsrc = _mm_uni_loadu_ps(src_data + offset);
-                                vsrc = _mm_uni_sub_ps(vsrc, vmean);
-                                _mm_uni_storeu_ps(dst_data + offset, _mm_uni_div_ps(vsrc, vvariance));
-                            }
-                        }
-                    }
-#else
-                    size_t min_cb = std::min(blk_size, C - cb * blk_size);
-                    for (size_t c = 0; c < min_cb; c++) {
-                        size_t cc = src_off + c;
-
-                        double mean = 0.0;
-                        for (size_t d = 0; d < D; d++) {
-                            size_t cd = cc + d * C1;
-                            for (size_t h = 0; h < H; h++) {
-                                size_t ch = cd + h * C0;
-                                for (size_t w = 0; w < W; w++) {
-                                    mean += src_data[ch + w * blk_size];
-                                }
-                            }
-                        }
-
-                        size_t C4 = D * H * W;
-                        mean /= static_cast<double>(C4);
-
-                        double variance = 0.0;
-                        for (size_t d = 0lu; d < D; d++) {
-                            size_t cd = cc + d * C1;
-                            for (size_t h = 0lu; h < H; h++) {
-                                size_t ch = cd + h * C0;
-                                for (size_t w = 0lu; w < W; w++) {
-                                    double value = static_cast<double>(src_data[ch + w * blk_size]) - mean;
-                                    variance += std::pow(value, 2);
-                                }
-                            }
-                        }
-
-                        variance /= static_cast<double>(C4);
-                        variance += eps;
-                        variance = std::pow(variance, 0.5f);
-
-                        for (size_t d = 0lu; d < D; d++) {
-                            size_t cd = cc + d * C1;
-                            for (size_t h = 0lu; h < H; h++) {
-                                size_t ch = cd + h * C0;
-                                for (size_t w = 0lu; w < W; w++) {
-                                    size_t index = ch + w * blk_size;
-                                    dst_data[index] = (src_data[index] - static_cast<float>(mean)) / static_cast<float>(variance);
-                                }
-                            }
-                        }
-                    }
-#endif
-                });
+    size_t CB = div_up(static_cast<int>(C), static_cast<int>(blk_size));
+    size_t C2 = D * H * W * blk_size;
+
+    // the sums of the channels of a block, the rows are summed up in floats and accumulated in doubles
+    auto accumulate_blk = [&](const float* src, double* sums, double* sqsums) {
+        for (size_t dh = 0lu; dh < D * H; dh++) {
+            const float* src_row = src + dh * W * blk_size;
+            float row_sums[blk_size] = {}, row_sqsums[blk_size] = {};
+            for (size_t w = 0lu; w < W; w++) {
+                for (size_t c = 0lu; c < blk_size; c++) {
+                    float value = src_row[w * blk_size + c];
+                    row_sums[c] += value;
+                    row_sqsums[c] += value * value;
+                }
+            }
+            for (size_t c = 0lu; c < blk_size; c++) {
+                sums[c] += row_sums[c];
+                sqsums[c] += row_sqsums[c];
             }
         }
-    } else {
-        for (size_t b = 0; b < N; b++) {
-            size_t ccb = b * C3;
-            if (across_channels) {
-                double mean = 0.0;
-                mean = parallel_sum3d(CB, D, H, mean, [&](size_t cb, size_t d, size_t h)->double {
-                    size_t ccbd = ccb + cb * C2 + d * C1 + h * C0;
-                    double mean_internal = 0.f;
-                    for (size_t w = 0lu, min_cb = std::min(blk_size, C - cb * blk_size); w < W; w++) {
-                        size_t cw = ccbd + w * blk_size;
-                        for (size_t c = 0lu; c < min_cb; c++) {
-                            mean_internal += src_data[cw + c];
-                        }
-                    }
-                    return mean_internal;
-                });
-
-                mean /= static_cast<double>(C5);
-
-                parallel_for3d(CB, D, H, [&](size_t cb, size_t d, size_t h) {
-                    size_t ccbd = ccb + cb * C2 + d * C1 + h * C0;
-                    for (size_t w = 0lu, min_cb = std::min(blk_size, C - cb * blk_size); w < W; w++) {
-                        size_t cw = ccbd + w * blk_size;
-                        for (size_t c = 0lu; c < min_cb; c++) {
-                            size_t src_offset = cw + c;
-
-                            dst_data[src_offset] = src_data[src_offset] - static_cast<float>(mean);
-                        }
-                    }
-                });
-            } else {
-                parallel_for(CB, [&](size_t cb) {
-                    size_t src_off = ccb + cb * C2;
-#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-                    vec_type vmean = _mm_uni_setzero_ps();
-                    for (size_t d = 0lu; d < D; d++) {
-                        size_t cd = src_off + d * C1;
-                        for (size_t h = 0lu; h < H; h++) {
-                            size_t ch = cd + h * C0;
-                            for (size_t w = 0lu; w < W; w++) {
-                                vec_type vsrc = _mm_uni_loadu_ps(src_data + ch + w * blk_size);
-                                vmean = _mm_uni_add_ps(vmean, vsrc);
-                            }
-                        }
-                    }
-
-                    vec_type vsize = _mm_uni_set1_ps(static_cast<float>(D * H * W));
-                    vmean = _mm_uni_div_ps(vmean, vsize);
-
-                    for (size_t d = 0lu; d < D; d++) {
-                        size_t cd = src_off + d * C1;
-                        for (size_t h = 0lu; h < H; h++) {
-                            size_t ch = cd + h * C0;
-                            for (size_t w = 0lu; w < W; w++) {
-                                size_t offset = ch + w * blk_size;
-                                vec_type vsrc = _mm_uni_loadu_ps(src_data + offset);
-                                _mm_uni_storeu_ps(dst_data + offset, _mm_uni_sub_ps(vsrc, vmean));
-                            }
-                        }
-                    }
-#else
-                    size_t min_cb = std::min(blk_size, C - cb * blk_size);
-                    for (size_t c = 0lu; c < min_cb; c++) {
-                        size_t cc = src_off + c;
-                        double mean = 0.0;
-                        for (size_t d = 0lu; d < D; d++) {
-                            size_t cd = cc + d * C1;
-                            for (size_t h = 0lu; h < H; h++) {
-                                size_t ch = cd + h * C0;
-                                for (size_t w = 0lu; w < W; w++) {
-                                    mean += src_data[ch + w * blk_size];
-                                }
-                            }
-                        }
-
-                        size_t C4 = D * H * W;
-                        mean /= static_cast<double>(C4);
-
-                        for (size_t d = 0lu; d < D; d++) {
-                            size_t cd = cc + d * C1;
-                            for (size_t h = 0lu; h < H; h++) {
-                                size_t ch = cd + h * C0;
-                                for (size_t w = 0lu; w < W; w++) {
-                                    size_t index = ch + w * blk_size;
-                                    dst_data[index] = src_data[index] - static_cast<float>(mean);
-                                }
-                            }
-                        }
-                    }
+    };
+
+    auto scale_shift_blk = [&](const float* src, float* dst, const float* a, const float* b) {
+        for (size_t i = 0lu; i < D * H * W; i++) {
+            size_t c = 0;
+#if defined(SIMD_WIDTH)
+            for (; c + SIMD_WIDTH <= blk_size; c += SIMD_WIDTH)
+                simd::storeu(dst + i * blk_size + c,
+                             simd::fmadd(simd::loadu(src + i * blk_size + c), simd::loadu(a + c), simd::loadu(b + c)));
 #endif
-                });
+            for (; c < blk_size; c++)
+                dst[i * blk_size + c] = src[i * blk_size + c] * a[c] + b[c];
+        }
+    };
+
+    for (size_t b = 0lu; b < N; b++) {
+        const float* src_b = src_data + b * CB * C2;
+        float* dst_b = dst_data + b * CB * C2;
+
+        if (across_channels) {
+            std::vector<double> sums(CB * blk_size, 0.0), sqsums(CB * blk_size, 0.0);
+            parallel_for(CB, [&](size_t cb) {
+                accumulate_blk(src_b + cb * C2, &sums[cb * blk_size], &sqsums[cb * blk_size]);
+            });
+
+            // the padded channels of the last block are not summed up
+            double sum = 0.0, sqsum = 0.0;
+            for (size_t c = 0lu; c < C; c++) {
+                sum += sums[c];
+                sqsum += sqsums[c];
             }
+
+            parallel_for(CB, [&](size_t cb) {
+                float a[blk_size], shift[blk_size];
+                for (size_t c = 0lu; c < blk_size; c++)
+                    get_scale_shift(sum, sqsum, static_cast<double>(C * D * H * W), cb * blk_size + c, a[c], shift[c]);
+                scale_shift_blk(src_b + cb * C2, dst_b + cb * C2, a, shift);
+            });
+        } else {
+            parallel_for(CB, [&](size_t cb) {
+                double sums[blk_size] = {}, sqsums[blk_size] = {};
+                accumulate_blk(src_b + cb * C2, sums, sqsums);
+
+                float a[blk_size], shift[blk_size];
+                for (size_t c = 0lu; c < blk_size; c++)
+                    get_scale_shift(sums[c], sqsums[c], static_cast<double>(D * H * W), cb * blk_size + c, a[c], shift[c]);
+                scale_shift_blk(src_b + cb * C2, dst_b + cb * C2, a, shift);
+            });
         }
     }
 }
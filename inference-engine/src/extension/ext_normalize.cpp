@@ -6,6 +6,7 @@
 #include "ext_base.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <string>
 #include <vector>
 #include <map>
@@ -13,11 +14,18 @@
 #if defined(HAVE_SSE) || defined(HAVE_AVX2)
 #include <immintrin.h>
 #endif
+#include "ie_parallel.hpp"
+#include "simd_math.h"
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+inline int div_up(const int a, const int b) {
+    assert(b);
+    return (a + b - 1) / b;
+}
+
 class NormalizeImpl: public ExtLayerBase {
 public:
     explicit NormalizeImpl(const CNNLayer* layer) {
@@ -35,34 +43,29 @@ public:
             channel_shared = layer->GetParamAsBool("channel_shared", false);
             eps = layer->GetParamAsFloat("eps");
 
+            // the own scales of the layer are folded with the ScaleShift the plugin has fused into it
+            const size_t C = layer->insData[0].lock()->getTensorDesc().getDims()[1];
+            if (weights->size() < (channel_shared ? 1 : C))
+                THROW_IE_EXCEPTION << layer->name << " weights have wrong size!";
+            getFusedScaleShift(layer, C, div_up(static_cast<int>(C), 16) * 16, scales, shifts);
+            const float* scl = weights->cbuffer().as<const float*>();
+            for (size_t c = 0; c < C; c++)
+                scales[c] *= channel_shared ? scl[0] : scl[c];
+
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}}, true);
+            if (layer->insData[0].lock()->dims.size() == 4) {
+#if defined(HAVE_AVX512F)
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                addConfig(layer, {{blk_layout, false, -1}}, {{blk_layout, false, 0}}, true);
+            }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
-#if defined(HAVE_SSE) || defined(HAVE_AVX2)
-    float hsum_sse(__m128 v) {
-        __m128 shuf = _mm_movehdup_ps(v);
-        __m128 sum = _mm_add_ps(v, shuf);
-        shuf = _mm_movehl_ps(shuf, sum);
-        sum = _mm_add_ss(sum, shuf);
-
-        return _mm_cvtss_f32(sum);
-    }
-
-#if defined(HAVE_AVX2)
-    float hsum_avx2(__m256 v) {
-        __m128 vlow = _mm256_castps256_ps128(v);
-        __m128 vhigh = _mm256_extractf128_ps(v, 1);
-
-        __m128 sum = _mm_add_ps(vlow, vhigh);
-
-        return hsum_sse(sum);
-    }
-#endif
-#endif
-
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
                        ResponseDesc *resp) noexcept override {
         if (inputs.size() != 1 || outputs.empty()) {
@@ -73,7 +76,6 @@ public:
             return GENERAL_ERROR;
         }
         const float* src = inputs[0]->buffer();
-        const float* scl = weights->buffer();
         float* dst = outputs[0]->buffer();
 
         SizeVector dims = inputs[0]->getTensorDesc().getDims();
@@ -83,137 +85,234 @@ public:
         const int H = static_cast<int>(dims.size() > 2 ? dims[2] : 1);
         const int W = static_cast<int>(dims.size() > 3 ? dims[3] : 1);
 
-        for (int n = 0; n < N; n++) {
-            const float* psrc = src + n*C*H*W;
-            float* pdst = dst + n*C*H*W;
+        if (inputs[0]->layout() == BLOCKED) {
+            normalize_blk(src, dst, N, C, H, W);
+        } else {
+            normalize_pln(src, dst, N, C, H, W);
+        }
+        return OK;
+    }
 
-            if (across_spatial) {
-                float norm = eps;
-                int i = 0;
-#if defined(HAVE_AVX2)
-                {
-                    __m256 vsum = _mm256_setzero_ps();
-                    for (; i <= C*H*W-8; i += 8) {
-                        __m256 vsrc = _mm256_loadu_ps(psrc + i);
-                        vsum = _mm256_fmadd_ps(vsrc, vsrc, vsum);
-                    }
-                    norm += hsum_avx2(vsum);
-                }
-#elif defined(HAVE_SSE)
-                {
-                    __m128 vsum = _mm_setzero_ps();
-                    for (; i <= C*H*W-4; i += 4) {
-                        __m128 vsrc = _mm_loadu_ps(psrc + i);
-                        vsum = _mm_add_ps(_mm_mul_ps(vsrc, vsrc), vsum);
-                    }
-                    norm += hsum_sse(vsum);
-                }
+private:
+    static float sum_squares(const float* src, const int size) {
+        int i = 0;
+        float sum = 0.0f;
+#if defined(SIMD_WIDTH)
+        simd::vec vsum = simd::set1(0.0f);
+        for (; i + SIMD_WIDTH <= size; i += SIMD_WIDTH) {
+            simd::vec vsrc = simd::loadu(src + i);
+            vsum = simd::fmadd(vsrc, vsrc, vsum);
+        }
+        float lanes[SIMD_WIDTH];
+        simd::storeu(lanes, vsum);
+        for (int j = 0; j < SIMD_WIDTH; j++)
+            sum += lanes[j];
 #endif
-                for (; i < C*H*W; i++) {
-                    norm += psrc[i]*psrc[i];
-                }
-                norm = 1.0f / std::sqrt(norm);
+        for (; i < size; i++)
+            sum += src[i] * src[i];
+        return sum;
+    }
+
+    void normalize_pln(const float* src, float* dst, const int N, const int C, const int H, const int W) {
+        const int HW = H*W;
+        for (int n = 0; n < N; n++) {
+            const float* psrc = src + n*C*HW;
+            float* pdst = dst + n*C*HW;
 
-                for (int c = 0 ; c < C; c++) {
+            if (across_spatial) {
+                float norm = 0.0f;
+                norm = parallel_sum(C, norm, [&](int c) -> float {
+                    return sum_squares(psrc + c*HW, HW);
+                });
+                norm = 1.0f / std::sqrt(norm + eps);
+
+                parallel_for(C, [&](int c) {
+                    const float* psrc_c = psrc + c*HW;
+                    float* pdst_c = pdst + c*HW;
+                    const float scale = norm * scales[c];
                     int hw = 0;
-#if defined(HAVE_AVX2)
-                    __m256 vnorm_avx = _mm256_set1_ps(norm);
-                    __m256 vscl_avx = _mm256_set1_ps(channel_shared ? scl[0] : scl[c]);
-                    vnorm_avx = _mm256_mul_ps(vnorm_avx, vscl_avx);
-
-                    for ( ; hw <= H*W - 8; hw += 8) {
-                        __m256 vsrc = _mm256_loadu_ps(psrc + c*H*W + hw);
-                        _mm256_storeu_ps(pdst + c*H*W+hw, _mm256_mul_ps(vsrc, vnorm_avx));
-                    }
-#elif defined(HAVE_SSE)
-                    __m128 vnorm_sse = _mm_set1_ps(norm);
-                    __m128 vscl_sse = _mm_set1_ps(channel_shared ? scl[0] : scl[c]);
-                    vnorm_sse = _mm_mul_ps(vnorm_sse, vscl_sse);
-
-                    for ( ; hw <= H*W - 4; hw += 4) {
-                        __m128 vsrc = _mm_loadu_ps(psrc + c*H*W + hw);
-                        _mm_storeu_ps(pdst + c*H*W+hw, _mm_mul_ps(vsrc, vnorm_sse));
-                    }
+#if defined(SIMD_WIDTH)
+                    simd::vec vscl = simd::set1(scale);
+                    simd::vec vshift = simd::set1(shifts[c]);
+                    for (; hw + SIMD_WIDTH <= HW; hw += SIMD_WIDTH)
+                        simd::storeu(pdst_c + hw, simd::fmadd(simd::loadu(psrc_c + hw), vscl, vshift));
 #endif
-                    for ( ; hw < H*W; hw++) {
-                        float s = channel_shared ? scl[0] : scl[c];
-                        pdst[c*H*W+hw] = psrc[c*H*W+hw] * norm * s;
-                    }
-                }
+                    for (; hw < HW; hw++)
+                        pdst_c[hw] = psrc_c[hw] * scale + shifts[c];
+                });
             } else {
-                int wh = 0;
-#if defined(HAVE_AVX2)
-                for (; wh <= W*H - 8; wh += 8) {
-                    __m256 vnorm = _mm256_set1_ps(eps);
+                // the pixels are processed by the chunks, small enough for the chunk of all the channels to stay
+                // in the cache between the pass of the sums and the pass of the scaling
+                const int chunk = 128;
+                parallel_for(div_up(HW, chunk), [&](int ih) {
+                    const int hw_start = ih * chunk;
+                    const int len = std::min(chunk, HW - hw_start);
+                    float norms[chunk];
+                    std::fill_n(norms, len, eps);
+
                     for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
-                        vnorm = _mm256_fmadd_ps(vsrc, vsrc, vnorm);
+                        const float* psrc_c = psrc + c*HW + hw_start;
+                        int hw = 0;
+#if defined(SIMD_WIDTH)
+                        for (; hw + SIMD_WIDTH <= len; hw += SIMD_WIDTH) {
+                            simd::vec vsrc = simd::loadu(psrc_c + hw);
+                            simd::storeu(norms + hw, simd::fmadd(vsrc, vsrc, simd::loadu(norms + hw)));
+                        }
+#endif
+                        for (; hw < len; hw++)
+                            norms[hw] += psrc_c[hw] * psrc_c[hw];
                     }
-                    vnorm = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(vnorm));
+                    simd::rsqrt_array(norms, norms, len);
 
                     for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        float* pdst_c = pdst + c*W*H;
-
-                        __m256 vscl = _mm256_set1_ps(channel_shared ? scl[0] : scl[c]);
-
-                        __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
-                        __m256 vdst = _mm256_mul_ps(vsrc, vnorm);
-                        vdst = _mm256_mul_ps(vdst, vscl);
-
-                        _mm256_storeu_ps(pdst_c + wh, vdst);
+                        const float* psrc_c = psrc + c*HW + hw_start;
+                        float* pdst_c = pdst + c*HW + hw_start;
+                        int hw = 0;
+#if defined(SIMD_WIDTH)
+                        simd::vec vscl = simd::set1(scales[c]);
+                        simd::vec vshift = simd::set1(shifts[c]);
+                        for (; hw + SIMD_WIDTH <= len; hw += SIMD_WIDTH) {
+                            simd::vec vnorm = simd::mul(simd::loadu(norms + hw), vscl);
+                            simd::storeu(pdst_c + hw, simd::fmadd(simd::loadu(psrc_c + hw), vnorm, vshift));
+                        }
+#endif
+                        for (; hw < len; hw++)
+                            pdst_c[hw] = psrc_c[hw] * norms[hw] * scales[c] + shifts[c];
                     }
-                }
-#elif defined(HAVE_SSE)
-                for (; wh <= W*H - 4; wh += 4) {
-                    __m128 vnorm = _mm_set1_ps(eps);
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
+                });
+            }
+        }
+    }
 
-                        vnorm = _mm_add_ps(_mm_mul_ps(vsrc, vsrc), vnorm);
-                    }
+    // nChw8c/nChw16c: a row of a channel block is contiguous, so the squares of all the blocks are accumulated
+    // per pixel of a row first, then the row is scaled. The padded channels of the last block are skipped in
+    // the sums and are written as zeros.
+    void normalize_blk(const float* src, float* dst, const int N, const int C, const int H, const int W) {
+#if defined(HAVE_AVX512F)
+        const int blk_size = 16;
+#else
+        const int blk_size = 8;
+#endif
+        const int CB = div_up(C, blk_size);
 
-                    vnorm = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(vnorm));
+        // the mask of the real channels, padded up to the blocks
+        std::vector<float> mask(CB * blk_size, 0.0f);
+        for (int c = 0; c < C; c++)
+            mask[c] = 1.0f;
 
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                              float* pdst_c = pdst + c*W*H;
+        for (int n = 0; n < N; n++) {
+            const float* psrc = src + n*CB*H*W*blk_size;
+            float* pdst = dst + n*CB*H*W*blk_size;
 
-                        __m128 vscl = _mm_set1_ps(channel_shared ? scl[0] : scl[c]);
+            if (across_spatial) {
+                std::vector<float> block_sums(CB, 0.0f);
+                parallel_for(CB, [&](int cb) {
+                    const float* psrc_cb = psrc + cb*H*W*blk_size;
+                    const float* pmask = &mask[cb*blk_size];
+                    float lanes[blk_size] = {};
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                    auto vmask = _mm_uni_loadu_ps(pmask);
+                    auto vsum = _mm_uni_setzero_ps();
+                    for (int i = 0; i < H*W; i++) {
+                        auto vsrc = _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc_cb + i*blk_size), vmask);
+                        vsum = _mm_uni_add_ps(vsum, _mm_uni_mul_ps(vsrc, vsrc));
+                    }
+                    _mm_uni_storeu_ps(lanes, vsum);
+#else
+                    for (int i = 0; i < H*W; i++) {
+                        for (int c = 0; c < blk_size; c++)
+                            lanes[c] += pmask[c] * psrc_cb[i*blk_size + c] * psrc_cb[i*blk_size + c];
+                    }
+#endif
+                    float sum = 0.0f;
+                    for (int c = 0; c < blk_size; c++)
+                        sum += lanes[c];
+                    block_sums[cb] = sum;
+                });
 
-                        __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
-                        __m128 vdst = _mm_mul_ps(vsrc, vnorm);
-                        vdst = _mm_mul_ps(vdst, vscl);
+                float norm = eps;
+                for (int cb = 0; cb < CB; cb++)
+                    norm += block_sums[cb];
+                norm = 1.0f / std::sqrt(norm);
 
-                        _mm_storeu_ps(pdst_c + wh, vdst);
+                parallel_for2d(CB, H, [&](int cb, int h) {
+                    const float* psrc_row = psrc + (cb*H + h)*W*blk_size;
+                    float* pdst_row = pdst + (cb*H + h)*W*blk_size;
+                    const float* pscl = &scales[cb*blk_size];
+                    const float* pshift = &shifts[cb*blk_size];
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                    auto vscl = _mm_uni_mul_ps(_mm_uni_loadu_ps(pscl), _mm_uni_set1_ps(norm));
+                    auto vshift = _mm_uni_loadu_ps(pshift);
+                    for (int w = 0; w < W; w++)
+                        _mm_uni_storeu_ps(pdst_row + w*blk_size,
+                                          _mm_uni_add_ps(_mm_uni_mul_ps(_mm_uni_loadu_ps(psrc_row + w*blk_size), vscl), vshift));
+#else
+                    for (int w = 0; w < W; w++) {
+                        for (int c = 0; c < blk_size; c++)
+                            pdst_row[w*blk_size + c] = psrc_row[w*blk_size + c] * norm * pscl[c] + pshift[c];
                     }
-                }
 #endif
-                for (; wh < W*H; wh++) {
-                    float norm = eps;
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        norm += psrc_c[wh]*psrc_c[wh];
+                });
+            } else {
+                parallel_for(H, [&](int h) {
+                    std::vector<float> sums(W*blk_size, 0.0f);
+                    std::vector<float> norms(W);
+
+                    for (int cb = 0; cb < CB; cb++) {
+                        const float* psrc_row = psrc + (cb*H + h)*W*blk_size;
+                        const float* pmask = &mask[cb*blk_size];
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                        auto vmask = _mm_uni_loadu_ps(pmask);
+                        for (int w = 0; w < W; w++) {
+                            auto vsrc = _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc_row + w*blk_size), vmask);
+                            _mm_uni_storeu_ps(&sums[w*blk_size],
+                                              _mm_uni_add_ps(_mm_uni_loadu_ps(&sums[w*blk_size]), _mm_uni_mul_ps(vsrc, vsrc)));
+                        }
+#else
+                        for (int w = 0; w < W; w++) {
+                            for (int c = 0; c < blk_size; c++)
+                                sums[w*blk_size + c] += pmask[c] * psrc_row[w*blk_size + c] * psrc_row[w*blk_size + c];
+                        }
+#endif
                     }
 
-                    norm = 1.0f / std::sqrt(norm);
-
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        float* pdst_c = pdst + c*W*H;
-
-                        pdst_c[wh] = channel_shared ? (psrc_c[wh] * norm * scl[0]) : (psrc_c[wh] * norm * scl[c]);
+                    for (int w = 0; w < W; w++) {
+                        float norm = eps;
+                        for (int c = 0; c < blk_size; c++)
+                            norm += sums[w*blk_size + c];
+                        norms[w] = norm;
                     }
-                }
+                    simd::rsqrt_array(norms.data(), norms.data(), W);
+
+                    for (int cb = 0; cb < CB; cb++) {
+                        const float* psrc_row = psrc + (cb*H + h)*W*blk_size;
+                        float* pdst_row = pdst + (cb*H + h)*W*blk_size;
+                        const float* pscl = &scales[cb*blk_size];
+                        const float* pshift = &shifts[cb*blk_size];
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                        auto vscl = _mm_uni_loadu_ps(pscl);
+                        auto vshift = _mm_uni_loadu_ps(pshift);
+                        for (int w = 0; w < W; w++) {
+                            auto vnorm = _mm_uni_mul_ps(vscl, _mm_uni_set1_ps(norms[w]));
+                            _mm_uni_storeu_ps(pdst_row + w*blk_size,
+                                              _mm_uni_add_ps(_mm_uni_mul_ps(_mm_uni_loadu_ps(psrc_row + w*blk_size), vnorm), vshift));
+                        }
+#else
+                        for (int w = 0; w < W; w++) {
+                            for (int c = 0; c < blk_size; c++)
+                                pdst_row[w*blk_size + c] = psrc_row[w*blk_size + c] * norms[w] * pscl[c] + pshift[c];
+                        }
+#endif
+                    }
+                });
             }
         }
-        return OK;
     }
 
-private:
     TBlob<float>::Ptr weights;
+    // the scales of the layer times the scales of the fused ScaleShift and its shifts, zeros in the padded channels
+    std::vector<float> scales;
+    std::vector<float> shifts;
 
     bool across_spatial = true;
     bool channel_shared = true;
@@ -5,7 +5,9 @@
 #include "ext_list.hpp"
 #include "ext_base.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <cassert>
@@ -134,36 +136,37 @@ inline void parallel_step(size_t size, std::vector<size_t> &counters, std::vecto
 }
 
 void PadImpl::pad_constant(const float *src_data, float* dst_data) {
-    int offset = 0;
-    for (size_t i = 0; i < srcStrides.size(); ++i)
-        offset += pads_begin[i] * srcStrides[i];
+    //  The rows of the innermost dimension are either the padding as a whole or a copy of a source row
+    //  between the padded edges
+    size_t last = dst_dims.size() - 1;
+    size_t dst_row = dst_dims[last];
+    size_t src_row = src_dims[last];
+    size_t pad_row = pads_begin[last];
 
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
-        SizeVector counters(dst_dims.size(), 0);
-        splitter(work_amount, nthr, ithr, start, end);
-
-        parallel_init(start, dst_dims.size(), counters, dst_dims);
-        for (size_t iwork = start; iwork < end; ++iwork) {
-            int srcIdx = 1;
-            int dstIdx = 0;
-            for (size_t i = 0; i < dstStrides.size(); ++i)
-                dstIdx += counters[i] * dstStrides[i];
-
-            for (size_t i = 0; i < counters.size(); ++i) {
-                if (counters[i] < pads_begin[i] || counters[i] >= src_o_dms[i]) {
-                    dst_data[dstIdx] = pad_value;
-                    srcIdx = 0;
-                    break;
-                }
+        SizeVector counters(last, 0);
+        splitter(work_amount / dst_row, nthr, ithr, start, end);
+
+        parallel_init(start, last, counters, dst_dims);
+        for (size_t irow = start; irow < end; ++irow) {
+            float *dst = dst_data + irow * dst_row;
+            const float *src = src_data;
+            for (size_t i = 0; i < last && src; ++i) {
+                if (counters[i] < pads_begin[i] || counters[i] >= src_o_dms[i])
+                    src = nullptr;
+                else
+                    src += (counters[i] - pads_begin[i]) * srcStrides[i];
             }
-            if (srcIdx) {
-                int srcIdx = 0;
-                for (size_t i = 0; i < srcStrides.size(); ++i)
-                    srcIdx += counters[i] * srcStrides[i];
-                dst_data[dstIdx] = src_data[srcIdx - offset];
+
+            if (src) {
+                std::fill_n(dst, pad_row, pad_value);
+                memcpy(dst + pad_row, src, src_row * sizeof(float));
+                std::fill(dst + pad_row + src_row, dst + dst_row, pad_value);
+            } else {
+                std::fill_n(dst, dst_row, pad_value);
             }
-            parallel_step(dst_dims.size(), counters, dst_dims);
+            parallel_step(last, counters, dst_dims);
         }
     });
 }
@@ -45,9 +45,14 @@ public:
             stride_h_ = layer->GetParamAsFloat("stride_y", 0);
             stride_w_ = layer->GetParamAsFloat("stride_x", 0);
 
+            // the grid depends on the shapes of the feature map and of the image only, so with the constant priors
+            // the layer is computed once on load
+            auto priorsLayer = layer->insData[INPUT_PRIORS].lock()->getCreatorLayer().lock();
+            const bool isConst = priorsLayer && priorsLayer->type == "Const";
             addConfig(layer,
-                      {DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN)},
-                      {DataConfigurator(ConfLayout::PLN)});
+                      {DataConfigurator(ConfLayout::PLN, isConst), DataConfigurator(ConfLayout::PLN, isConst),
+                       DataConfigurator(ConfLayout::PLN, isConst)},
+                      {DataConfigurator(ConfLayout::PLN, isConst)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
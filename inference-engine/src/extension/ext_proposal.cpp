@@ -14,6 +14,8 @@
 #include <immintrin.h>
 #endif
 #include "ie_parallel.hpp"
+#include "nms.h"
+#include "opt_exp.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -82,23 +84,111 @@ void enumerate_proposals_cpu(const float* bottom4d, const float* d_anchor4d, con
     const float* p_anchors_wp = anchors + 2 * num_anchors;
     const float* p_anchors_hp = anchors + 3 * num_anchors;
 
-    parallel_for2d(bottom_H, bottom_W, [&](size_t h, size_t w) {
-            const float x = static_cast<float>((swap_xy ? h : w) * feat_stride);
-            const float y = static_cast<float>((swap_xy ? w : h) * feat_stride);
+    // the deltas and the scores of an anchor are contiguous along the row, so the row is decoded by the vectors
+    parallel_for2d(bottom_H, num_anchors, [&](size_t h, size_t anchor) {
+            const float* p_box   = d_anchor4d + anchor * 4 * bottom_area + h * bottom_W;
+            const float* p_score = bottom4d   + anchor * bottom_area + h * bottom_W;
 
-            const float* p_box   = d_anchor4d + h * bottom_W + w;
-            const float* p_score = bottom4d   + h * bottom_W + w;
+            float* p_proposal = proposals + (h * bottom_W * num_anchors + anchor) * 5;
 
-            float* p_proposal = proposals + (h * bottom_W + w) * num_anchors * 5;
+            int w = 0;
+#if defined(HAVE_AVX2)
+            const __m256 vc_zero = _mm256_setzero_ps();
+            const __m256 vc_half = _mm256_set1_ps(0.5f);
+            const __m256 vc_offset = _mm256_set1_ps(coordinates_offset);
+            const __m256 vc_stride = _mm256_set1_ps(static_cast<float>(feat_stride));
+            const __m256 vc_coordinate_scale = _mm256_set1_ps(box_coordinate_scale);
+            const __m256 vc_size_scale = _mm256_set1_ps(box_size_scale);
+            const __m256 vc_img_W = _mm256_set1_ps(img_W);
+            const __m256 vc_img_H = _mm256_set1_ps(img_H);
+            const __m256 vc_clip_W = _mm256_set1_ps(img_W - coordinates_offset);
+            const __m256 vc_clip_H = _mm256_set1_ps(img_H - coordinates_offset);
+            const __m256 vc_min_box_W = _mm256_set1_ps(min_box_W);
+            const __m256 vc_min_box_H = _mm256_set1_ps(min_box_H);
+
+            const __m256 vh = _mm256_set1_ps(static_cast<float>(h * feat_stride));
+
+            for (; w <= bottom_W - 8; w += 8) {
+                const __m256 vw = _mm256_mul_ps(_mm256_cvtepi32_ps(
+                        _mm256_add_epi32(_mm256_set1_epi32(w), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7))), vc_stride);
+                const __m256 vx = swap_xy ? vh : vw;
+                const __m256 vy = swap_xy ? vw : vh;
+
+                const __m256 vdx = _mm256_div_ps(_mm256_loadu_ps(p_box + 0 * bottom_area + w), vc_coordinate_scale);
+                const __m256 vdy = _mm256_div_ps(_mm256_loadu_ps(p_box + 1 * bottom_area + w), vc_coordinate_scale);
+                const __m256 vd_log_w = _mm256_div_ps(_mm256_loadu_ps(p_box + 2 * bottom_area + w), vc_size_scale);
+                const __m256 vd_log_h = _mm256_div_ps(_mm256_loadu_ps(p_box + 3 * bottom_area + w), vc_size_scale);
+
+                const __m256 vscore = _mm256_loadu_ps(p_score + w);
+
+                __m256 vx0 = _mm256_add_ps(vx, _mm256_set1_ps(p_anchors_wm[anchor]));
+                __m256 vy0 = _mm256_add_ps(vy, _mm256_set1_ps(p_anchors_hm[anchor]));
+                __m256 vx1 = _mm256_add_ps(vx, _mm256_set1_ps(p_anchors_wp[anchor]));
+                __m256 vy1 = _mm256_add_ps(vy, _mm256_set1_ps(p_anchors_hp[anchor]));
+
+                if (initial_clip) {
+                    vx0 = _mm256_max_ps(vc_zero, _mm256_min_ps(vx0, vc_img_W));
+                    vy0 = _mm256_max_ps(vc_zero, _mm256_min_ps(vy0, vc_img_H));
+                    vx1 = _mm256_max_ps(vc_zero, _mm256_min_ps(vx1, vc_img_W));
+                    vy1 = _mm256_max_ps(vc_zero, _mm256_min_ps(vy1, vc_img_H));
+                }
+
+                const __m256 vww = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), vc_offset);
+                const __m256 vhh = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), vc_offset);
+                const __m256 vctr_x = _mm256_add_ps(vx0, _mm256_mul_ps(vc_half, vww));
+                const __m256 vctr_y = _mm256_add_ps(vy0, _mm256_mul_ps(vc_half, vhh));
+
+                const __m256 vpred_ctr_x = _mm256_add_ps(_mm256_mul_ps(vdx, vww), vctr_x);
+                const __m256 vpred_ctr_y = _mm256_add_ps(_mm256_mul_ps(vdy, vhh), vctr_y);
+                const __m256 vpred_w = _mm256_mul_ps(_avx_opt_exp_ps(vd_log_w), vww);
+                const __m256 vpred_h = _mm256_mul_ps(_avx_opt_exp_ps(vd_log_h), vhh);
 
-            for (int anchor = 0; anchor < num_anchors; ++anchor) {
-                const float dx = p_box[(anchor * 4 + 0) * bottom_area] / box_coordinate_scale;
-                const float dy = p_box[(anchor * 4 + 1) * bottom_area] / box_coordinate_scale;
+                vx0 = _mm256_sub_ps(vpred_ctr_x, _mm256_mul_ps(vc_half, vpred_w));
+                vy0 = _mm256_sub_ps(vpred_ctr_y, _mm256_mul_ps(vc_half, vpred_h));
+                vx1 = _mm256_add_ps(vpred_ctr_x, _mm256_mul_ps(vc_half, vpred_w));
+                vy1 = _mm256_add_ps(vpred_ctr_y, _mm256_mul_ps(vc_half, vpred_h));
 
-                const float d_log_w = p_box[(anchor * 4 + 2) * bottom_area] / box_size_scale;
-                const float d_log_h = p_box[(anchor * 4 + 3) * bottom_area] / box_size_scale;
+                if (clip_before_nms) {
+                    vx0 = _mm256_max_ps(vc_zero, _mm256_min_ps(vx0, vc_clip_W));
+                    vy0 = _mm256_max_ps(vc_zero, _mm256_min_ps(vy0, vc_clip_H));
+                    vx1 = _mm256_max_ps(vc_zero, _mm256_min_ps(vx1, vc_clip_W));
+                    vy1 = _mm256_max_ps(vc_zero, _mm256_min_ps(vy1, vc_clip_H));
+                }
+
+                const __m256 vbox_w = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), vc_offset);
+                const __m256 vbox_h = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), vc_offset);
+                const __m256 vvalid = _mm256_and_ps(_mm256_cmp_ps(vc_min_box_W, vbox_w, _CMP_LE_OS),
+                                                    _mm256_cmp_ps(vc_min_box_H, vbox_h, _CMP_LE_OS));
+
+                float box[5][8];
+                _mm256_storeu_ps(box[0], vx0);
+                _mm256_storeu_ps(box[1], vy0);
+                _mm256_storeu_ps(box[2], vx1);
+                _mm256_storeu_ps(box[3], vy1);
+                _mm256_storeu_ps(box[4], _mm256_and_ps(vvalid, vscore));
+
+                for (int i = 0; i < 8; ++i) {
+                    float* p = p_proposal + (w + i) * num_anchors * 5;
+                    p[0] = box[0][i];
+                    p[1] = box[1][i];
+                    p[2] = box[2][i];
+                    p[3] = box[3][i];
+                    p[4] = box[4][i];
+                }
+            }
+#endif
 
-                const float score = p_score[anchor * bottom_area];
+            for (; w < bottom_W; ++w) {
+                const float x = static_cast<float>((swap_xy ? h : w) * feat_stride);
+                const float y = static_cast<float>((swap_xy ? w : h) * feat_stride);
+
+                const float dx = p_box[0 * bottom_area + w] / box_coordinate_scale;
+                const float dy = p_box[1 * bottom_area + w] / box_coordinate_scale;
+
+                const float d_log_w = p_box[2 * bottom_area + w] / box_size_scale;
+                const float d_log_h = p_box[3 * bottom_area + w] / box_size_scale;
+
+                const float score = p_score[w];
 
                 float x0 = x + p_anchors_wm[anchor];
                 float y0 = y + p_anchors_hm[anchor];
@@ -146,17 +236,21 @@ void enumerate_proposals_cpu(const float* bottom4d, const float* d_anchor4d, con
                 const float box_w = x1 - x0 + coordinates_offset;
                 const float box_h = y1 - y0 + coordinates_offset;
 
-                p_proposal[5*anchor + 0] = x0;
-                p_proposal[5*anchor + 1] = y0;
-                p_proposal[5*anchor + 2] = x1;
-                p_proposal[5*anchor + 3] = y1;
-                p_proposal[5*anchor + 4] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
+                float* p = p_proposal + w * num_anchors * 5;
+                p[0] = x0;
+                p[1] = y0;
+                p[2] = x1;
+                p[3] = y1;
+                p[4] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
             }
     });
 }
 
 static void unpack_boxes(const float* p_proposals, float* unpacked_boxes, int pre_nms_topn) {
-    parallel_for(pre_nms_topn, [&](size_t i) {
+    // a few copies per box, the threads are worth only for the thousands of them
+    parallel_options options;
+    options.grain = 1024;
+    parallel_for(options, pre_nms_topn, [&](size_t i) {
         unpacked_boxes[0*pre_nms_topn + i] = p_proposals[5*i + 0];
         unpacked_boxes[1*pre_nms_topn + i] = p_proposals[5*i + 1];
         unpacked_boxes[2*pre_nms_topn + i] = p_proposals[5*i + 2];
@@ -164,130 +258,6 @@ static void unpack_boxes(const float* p_proposals, float* unpacked_boxes, int pr
     });
 }
 
-static
-void nms_cpu(const int num_boxes, int is_dead[],
-             const float* boxes, int index_out[], int* const num_out,
-             const int base_index, const float nms_thresh, const int max_num_out,
-             float coordinates_offset) {
-    const int num_proposals = num_boxes;
-    int count = 0;
-
-    const float* x0 = boxes + 0 * num_proposals;
-    const float* y0 = boxes + 1 * num_proposals;
-    const float* x1 = boxes + 2 * num_proposals;
-    const float* y1 = boxes + 3 * num_proposals;
-
-    memset(is_dead, 0, num_boxes * sizeof(int));
-
-#if defined(HAVE_AVX2)
-    __m256  vc_fone = _mm256_set1_ps(coordinates_offset);
-    __m256i vc_ione = _mm256_set1_epi32(1);
-    __m256  vc_zero = _mm256_set1_ps(0.0f);
-
-    __m256 vc_nms_thresh = _mm256_set1_ps(nms_thresh);
-#endif
-
-    for (int box = 0; box < num_boxes; ++box) {
-        if (is_dead[box])
-            continue;
-
-        index_out[count++] = base_index + box;
-        if (count == max_num_out)
-            break;
-
-        int tail = box + 1;
-
-#if defined(HAVE_AVX2)
-        __m256 vx0i = _mm256_set1_ps(x0[box]);
-        __m256 vy0i = _mm256_set1_ps(y0[box]);
-        __m256 vx1i = _mm256_set1_ps(x1[box]);
-        __m256 vy1i = _mm256_set1_ps(y1[box]);
-
-        __m256 vA_width  = _mm256_sub_ps(vx1i, vx0i);
-        __m256 vA_height = _mm256_sub_ps(vy1i, vy0i);
-        __m256 vA_area   = _mm256_mul_ps(_mm256_add_ps(vA_width, vc_fone), _mm256_add_ps(vA_height, vc_fone));
-
-        for (; tail <= num_boxes - 8; tail += 8) {
-            __m256i *pdst = reinterpret_cast<__m256i*>(is_dead + tail);
-            __m256i  vdst = _mm256_loadu_si256(pdst);
-
-            __m256 vx0j = _mm256_loadu_ps(x0 + tail);
-            __m256 vy0j = _mm256_loadu_ps(y0 + tail);
-            __m256 vx1j = _mm256_loadu_ps(x1 + tail);
-            __m256 vy1j = _mm256_loadu_ps(y1 + tail);
-
-            __m256 vx0 = _mm256_max_ps(vx0i, vx0j);
-            __m256 vy0 = _mm256_max_ps(vy0i, vy0j);
-            __m256 vx1 = _mm256_min_ps(vx1i, vx1j);
-            __m256 vy1 = _mm256_min_ps(vy1i, vy1j);
-
-            __m256 vwidth  = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), vc_fone);
-            __m256 vheight = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), vc_fone);
-            __m256 varea = _mm256_mul_ps(_mm256_max_ps(vc_zero, vwidth), _mm256_max_ps(vc_zero, vheight));
-
-            __m256 vB_width  = _mm256_sub_ps(vx1j, vx0j);
-            __m256 vB_height = _mm256_sub_ps(vy1j, vy0j);
-            __m256 vB_area   = _mm256_mul_ps(_mm256_add_ps(vB_width, vc_fone), _mm256_add_ps(vB_height, vc_fone));
-
-            __m256 vdivisor = _mm256_sub_ps(_mm256_add_ps(vA_area, vB_area), varea);
-            __m256 vintersection_area = _mm256_div_ps(varea, vdivisor);
-
-            __m256 vcmp_0 = _mm256_cmp_ps(vx0i, vx1j, _CMP_LE_OS);
-            __m256 vcmp_1 = _mm256_cmp_ps(vy0i, vy1j, _CMP_LE_OS);
-            __m256 vcmp_2 = _mm256_cmp_ps(vx0j, vx1i, _CMP_LE_OS);
-            __m256 vcmp_3 = _mm256_cmp_ps(vy0j, vy1i, _CMP_LE_OS);
-            __m256 vcmp_4 = _mm256_cmp_ps(vc_nms_thresh, vintersection_area, _CMP_LT_OS);
-
-            vcmp_0 = _mm256_and_ps(vcmp_0, vcmp_1);
-            vcmp_2 = _mm256_and_ps(vcmp_2, vcmp_3);
-            vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_0);
-            vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_2);
-
-            _mm256_storeu_si256(pdst, _mm256_blendv_epi8(vdst, vc_ione, _mm256_castps_si256(vcmp_4)));
-        }
-#endif
-
-        for (; tail < num_boxes; ++tail) {
-            float res = 0.0f;
-
-            const float x0i = x0[box];
-            const float y0i = y0[box];
-            const float x1i = x1[box];
-            const float y1i = y1[box];
-
-            const float x0j = x0[tail];
-            const float y0j = y0[tail];
-            const float x1j = x1[tail];
-            const float y1j = y1[tail];
-
-            if (x0i <= x1j && y0i <= y1j && x0j <= x1i && y0j <= y1i) {
-                // overlapped region (= box)
-                const float x0 = std::max<float>(x0i, x0j);
-                const float y0 = std::max<float>(y0i, y0j);
-                const float x1 = std::min<float>(x1i, x1j);
-                const float y1 = std::min<float>(y1i, y1j);
-
-                // intersection area
-                const float width  = std::max<float>(0.0f,  x1 - x0 + coordinates_offset);
-                const float height = std::max<float>(0.0f,  y1 - y0 + coordinates_offset);
-                const float area   = width * height;
-
-                // area of A, B
-                const float A_area = (x1i - x0i + coordinates_offset) * (y1i - y0i + coordinates_offset);
-                const float B_area = (x1j - x0j + coordinates_offset) * (y1j - y0j + coordinates_offset);
-
-                // IoU
-                res = area / (A_area + B_area - area);
-            }
-
-            if (nms_thresh < res)
-                is_dead[tail] = 1;
-        }
-    }
-
-    *num_out = count;
-}
-
 static
 void retrieve_rois_cpu(const int num_rois, const int item_index,
                               const int num_proposals,
@@ -382,7 +352,6 @@ public:
             generate_anchors(base_size_, &ratios[0], &scales[0], ratios.size(), scales.size(), &anchors_[0],
                              coordinates_offset, shift_anchors, round_ratios);
 
-            roi_indices_.resize(post_nms_topn_);
             addConfig(layer, {DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN)},
                       {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
@@ -433,9 +402,6 @@ public:
         // number of top-n proposals before NMS
         const int pre_nms_topn = std::min<int>(num_proposals, pre_nms_topn_);
 
-        // number of final RoIs
-        int num_rois = 0;
-
         // enumerate all proposals
         //   num_proposals = num_anchors * H * W
         //   (x1, y1, x2, y2, score) for each proposal
@@ -447,29 +413,43 @@ public:
             float y1;
             float score;
         };
-        std::vector<ProposalBox> proposals_(num_proposals);
-        std::vector<float> unpacked_boxes(4 * pre_nms_topn);
-        std::vector<int> is_dead(pre_nms_topn);
 
-        // Execute
-        int nn = inputs[0]->getTensorDesc().getDims()[0];
-        for (int n = 0; n < nn; ++n) {
+        auto process_image = [&](size_t n) {
+            std::vector<ProposalBox> proposals_(num_proposals);
+            std::vector<float> unpacked_boxes(4 * pre_nms_topn);
+            std::vector<uint64_t> is_dead((pre_nms_topn + NMS_BLOCK_SIZE - 1) / NMS_BLOCK_SIZE);
+            std::vector<int> roi_indices(post_nms_topn_);
+
+            // number of final RoIs
+            int num_rois = 0;
+
             enumerate_proposals_cpu(p_bottom_item + num_proposals + n*num_proposals*2, p_d_anchor_item + n*num_proposals*4,
                                     &anchors_[0], reinterpret_cast<float *>(&proposals_[0]),
                                     anchors_shape_0, bottom_H, bottom_W, img_H, img_W,
                                     min_box_H, min_box_W, feat_stride_,
                                     box_coordinate_scale_, box_size_scale_,
                                     coordinates_offset, initial_clip, swap_xy, clip_before_nms);
-            std::partial_sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(),
-                              [](const ProposalBox& struct1, const ProposalBox& struct2) {
-                                  return (struct1.score > struct2.score);
-                              });
+
+            // the selection of the top-n is linear, only the selected proposals are sorted
+            auto greater_score = [](const ProposalBox& struct1, const ProposalBox& struct2) {
+                return (struct1.score > struct2.score);
+            };
+            std::nth_element(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(), greater_score);
+            std::sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, greater_score);
 
             unpack_boxes(reinterpret_cast<float *>(&proposals_[0]), &unpacked_boxes[0], pre_nms_topn);
-            nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], &roi_indices_[0], &num_rois, 0, nms_thresh_, post_nms_topn_, coordinates_offset);
-            retrieve_rois_cpu(num_rois, n, pre_nms_topn, &unpacked_boxes[0], &roi_indices_[0], p_roi_item + n*post_nms_topn_*5,
+            nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], &roi_indices[0], &num_rois, 0, nms_thresh_, post_nms_topn_, coordinates_offset);
+            retrieve_rois_cpu(num_rois, n, pre_nms_topn, &unpacked_boxes[0], &roi_indices[0], p_roi_item + n*post_nms_topn_*5,
                               post_nms_topn_, normalize_, img_H, img_W, clip_after_nms);
-        }
+        };
+
+        // Execute
+        // the images of the batch are processed in parallel, a single image is parallel inside the stages
+        const size_t nn = inputs[0]->getTensorDesc().getDims()[0];
+        if (nn == 1)
+            process_image(0);
+        else
+            parallel_for(nn, process_image);
 
         return OK;
     }
@@ -489,7 +469,6 @@ private:
 
     size_t anchors_shape_0;
     std::vector<float> anchors_;
-    std::vector<int> roi_indices_;
 
     // Framework specific parameters
     float coordinates_offset;
@@ -5,7 +5,6 @@
 #include "ext_list.hpp"
 #include "ext_base.hpp"
 
-#include <cassert>
 #include <cmath>
 #include <string>
 #include <vector>
@@ -15,32 +14,8 @@
 #include <immintrin.h>
 #endif
 #include "ie_parallel.hpp"
-
-
-namespace {
-struct Indexer {
-  const std::vector<int> dims_;
-  int total_{1};
-
-  explicit Indexer(const std::vector<int>& dims) : dims_(dims) {
-      total_ = 1;
-      for (size_t i = 0; i < dims_.size(); ++i) {
-          total_ *= dims_[i];
-      }
-  }
-
-  const int operator()(const std::vector<int>& idx) const {
-      int flat_idx = 0;
-      assert(idx.size() == dims_.size());
-      for (size_t i = 0; i < dims_.size(); ++i) {
-          assert(0 <= idx[i] && idx[i] < dims_[i]);
-          flat_idx = flat_idx * dims_[i] + idx[i];
-      }
-      assert(flat_idx < total_);
-      return flat_idx;
-  }
-};
-}  // namespace
+#include "nms.h"
+#include "opt_exp.h"
 
 
 namespace InferenceEngine {
@@ -54,24 +29,101 @@ void refine_anchors(const float* deltas, const float* scores, const float* ancho
                     const float min_box_H, const float min_box_W,
                     const float max_delta_log_wh,
                     float coordinates_offset) {
-    Indexer delta_idx({anchors_num, 4, bottom_H, bottom_W});
-    Indexer score_idx({anchors_num, 1, bottom_H, bottom_W});
-    Indexer proposal_idx({bottom_H, bottom_W, anchors_num, 5});
-    Indexer anchor_idx({bottom_H, bottom_W, anchors_num, 4});
+    // deltas: anchors_num x 4 x H x W, scores: anchors_num x 1 x H x W
+    // anchors: H x W x anchors_num x 4, proposals: H x W x anchors_num x 5
+    const int bottom_area = bottom_H * bottom_W;
+
+    // the deltas and the scores of an anchor are contiguous along the row, so the row is refined by the vectors
+    parallel_for2d(bottom_H, anchors_num, [&](int h, int anchor) {
+            const float* p_delta = deltas + anchor * 4 * bottom_area + h * bottom_W;
+            const float* p_score = scores + anchor * bottom_area + h * bottom_W;
+            const float* p_anchor = anchors + (h * bottom_W * anchors_num + anchor) * 4;
+            float* p_proposal = proposals + (h * bottom_W * anchors_num + anchor) * 5;
+
+            int w = 0;
+#if defined(HAVE_AVX2)
+            const __m256 vc_zero = _mm256_setzero_ps();
+            const __m256 vc_half = _mm256_set1_ps(0.5f);
+            const __m256 vc_offset = _mm256_set1_ps(coordinates_offset);
+            const __m256 vc_max_delta_log_wh = _mm256_set1_ps(max_delta_log_wh);
+            const __m256 vc_clip_W = _mm256_set1_ps(img_W - coordinates_offset);
+            const __m256 vc_clip_H = _mm256_set1_ps(img_H - coordinates_offset);
+            const __m256 vc_min_box_W = _mm256_set1_ps(min_box_W);
+            const __m256 vc_min_box_H = _mm256_set1_ps(min_box_H);
+
+            // the offsets of the anchors of the 8 neighbour positions
+            const __m256i vanchor_idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                                           _mm256_set1_epi32(anchors_num * 4));
+
+            for (; w <= bottom_W - 8; w += 8) {
+                const float* p_anchor_w = p_anchor + w * anchors_num * 4;
+                __m256 vx0 = _mm256_i32gather_ps(p_anchor_w + 0, vanchor_idx, 4);
+                __m256 vy0 = _mm256_i32gather_ps(p_anchor_w + 1, vanchor_idx, 4);
+                __m256 vx1 = _mm256_i32gather_ps(p_anchor_w + 2, vanchor_idx, 4);
+                __m256 vy1 = _mm256_i32gather_ps(p_anchor_w + 3, vanchor_idx, 4);
+
+                const __m256 vdx = _mm256_loadu_ps(p_delta + 0 * bottom_area + w);
+                const __m256 vdy = _mm256_loadu_ps(p_delta + 1 * bottom_area + w);
+                const __m256 vd_log_w = _mm256_loadu_ps(p_delta + 2 * bottom_area + w);
+                const __m256 vd_log_h = _mm256_loadu_ps(p_delta + 3 * bottom_area + w);
+
+                const __m256 vscore = _mm256_loadu_ps(p_score + w);
+
+                const __m256 vww = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), vc_offset);
+                const __m256 vhh = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), vc_offset);
+                const __m256 vctr_x = _mm256_add_ps(vx0, _mm256_mul_ps(vc_half, vww));
+                const __m256 vctr_y = _mm256_add_ps(vy0, _mm256_mul_ps(vc_half, vhh));
+
+                const __m256 vpred_ctr_x = _mm256_add_ps(_mm256_mul_ps(vdx, vww), vctr_x);
+                const __m256 vpred_ctr_y = _mm256_add_ps(_mm256_mul_ps(vdy, vhh), vctr_y);
+                const __m256 vpred_w = _mm256_mul_ps(_avx_opt_exp_ps(_mm256_min_ps(vd_log_w, vc_max_delta_log_wh)), vww);
+                const __m256 vpred_h = _mm256_mul_ps(_avx_opt_exp_ps(_mm256_min_ps(vd_log_h, vc_max_delta_log_wh)), vhh);
+
+                vx0 = _mm256_sub_ps(vpred_ctr_x, _mm256_mul_ps(vc_half, vpred_w));
+                vy0 = _mm256_sub_ps(vpred_ctr_y, _mm256_mul_ps(vc_half, vpred_h));
+                vx1 = _mm256_sub_ps(_mm256_add_ps(vpred_ctr_x, _mm256_mul_ps(vc_half, vpred_w)), vc_offset);
+                vy1 = _mm256_sub_ps(_mm256_add_ps(vpred_ctr_y, _mm256_mul_ps(vc_half, vpred_h)), vc_offset);
+
+                vx0 = _mm256_max_ps(vc_zero, _mm256_min_ps(vx0, vc_clip_W));
+                vy0 = _mm256_max_ps(vc_zero, _mm256_min_ps(vy0, vc_clip_H));
+                vx1 = _mm256_max_ps(vc_zero, _mm256_min_ps(vx1, vc_clip_W));
+                vy1 = _mm256_max_ps(vc_zero, _mm256_min_ps(vy1, vc_clip_H));
+
+                const __m256 vbox_w = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), vc_offset);
+                const __m256 vbox_h = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), vc_offset);
+                const __m256 vvalid = _mm256_and_ps(_mm256_cmp_ps(vc_min_box_W, vbox_w, _CMP_LE_OS),
+                                                    _mm256_cmp_ps(vc_min_box_H, vbox_h, _CMP_LE_OS));
+
+                float box[5][8];
+                _mm256_storeu_ps(box[0], vx0);
+                _mm256_storeu_ps(box[1], vy0);
+                _mm256_storeu_ps(box[2], vx1);
+                _mm256_storeu_ps(box[3], vy1);
+                _mm256_storeu_ps(box[4], _mm256_and_ps(vvalid, vscore));
+
+                for (int i = 0; i < 8; ++i) {
+                    float* p = p_proposal + (w + i) * anchors_num * 5;
+                    p[0] = box[0][i];
+                    p[1] = box[1][i];
+                    p[2] = box[2][i];
+                    p[3] = box[3][i];
+                    p[4] = box[4][i];
+                }
+            }
+#endif
 
-    parallel_for2d(bottom_H, bottom_W, [&](int h, int w) {
-            for (int anchor = 0; anchor < anchors_num; ++anchor) {
-                float x0 = anchors[anchor_idx({h, w, anchor, 0})];
-                float y0 = anchors[anchor_idx({h, w, anchor, 1})];
-                float x1 = anchors[anchor_idx({h, w, anchor, 2})];
-                float y1 = anchors[anchor_idx({h, w, anchor, 3})];
+            for (; w < bottom_W; ++w) {
+                float x0 = p_anchor[w * anchors_num * 4 + 0];
+                float y0 = p_anchor[w * anchors_num * 4 + 1];
+                float x1 = p_anchor[w * anchors_num * 4 + 2];
+                float y1 = p_anchor[w * anchors_num * 4 + 3];
 
-                const float dx = deltas[delta_idx({anchor, 0, h, w})];
-                const float dy = deltas[delta_idx({anchor, 1, h, w})];
-                const float d_log_w = deltas[delta_idx({anchor, 2, h, w})];
-                const float d_log_h = deltas[delta_idx({anchor, 3, h, w})];
+                const float dx = p_delta[0 * bottom_area + w];
+                const float dy = p_delta[1 * bottom_area + w];
+                const float d_log_w = p_delta[2 * bottom_area + w];
+                const float d_log_h = p_delta[3 * bottom_area + w];
 
-                const float score = scores[score_idx({anchor, 0, h, w})];
+                const float score = p_score[w];
 
                 // width & height of box
                 const float ww = x1 - x0 + coordinates_offset;
@@ -104,17 +156,21 @@ void refine_anchors(const float* deltas, const float* scores, const float* ancho
                 const float box_w = x1 - x0 + coordinates_offset;
                 const float box_h = y1 - y0 + coordinates_offset;
 
-                proposals[proposal_idx({h, w, anchor, 0})] = x0;
-                proposals[proposal_idx({h, w, anchor, 1})] = y0;
-                proposals[proposal_idx({h, w, anchor, 2})] = x1;
-                proposals[proposal_idx({h, w, anchor, 3})] = y1;
-                proposals[proposal_idx({h, w, anchor, 4})] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
+                float* p = p_proposal + w * anchors_num * 5;
+                p[0] = x0;
+                p[1] = y0;
+                p[2] = x1;
+                p[3] = y1;
+                p[4] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
             }
     });
 }
 
 static void unpack_boxes(const float* p_proposals, float* unpacked_boxes, int pre_nms_topn) {
-    parallel_for(pre_nms_topn, [&](size_t i) {
+    // a few copies per box, the threads are worth only for the thousands of them
+    parallel_options options;
+    options.grain = 1024;
+    parallel_for(options, pre_nms_topn, [&](size_t i) {
         unpacked_boxes[0*pre_nms_topn + i] = p_proposals[5*i + 0];
         unpacked_boxes[1*pre_nms_topn + i] = p_proposals[5*i + 1];
         unpacked_boxes[2*pre_nms_topn + i] = p_proposals[5*i + 2];
@@ -123,131 +179,6 @@ static void unpack_boxes(const float* p_proposals, float* unpacked_boxes, int pr
     });
 }
 
-static
-void nms_cpu(const int num_boxes, int is_dead[],
-             const float* boxes, int index_out[], int* const num_out,
-             const int base_index, const float nms_thresh, const int max_num_out,
-             float coordinates_offset) {
-    const int num_proposals = num_boxes;
-    int count = 0;
-
-    const float* x0 = boxes + 0 * num_proposals;
-    const float* y0 = boxes + 1 * num_proposals;
-    const float* x1 = boxes + 2 * num_proposals;
-    const float* y1 = boxes + 3 * num_proposals;
-
-    memset(is_dead, 0, num_boxes * sizeof(int));
-
-#if defined(HAVE_AVX2)
-    __m256  vc_fone = _mm256_set1_ps(coordinates_offset);
-    __m256i vc_ione = _mm256_set1_epi32(1);
-    __m256  vc_zero = _mm256_set1_ps(0.0f);
-
-    __m256 vc_nms_thresh = _mm256_set1_ps(nms_thresh);
-#endif
-
-    for (int box = 0; box < num_boxes; ++box) {
-        if (is_dead[box])
-            continue;
-
-        index_out[count++] = base_index + box;
-        if (count == max_num_out)
-            break;
-
-        int tail = box + 1;
-
-#if defined(HAVE_AVX2)
-        __m256 vx0i = _mm256_set1_ps(x0[box]);
-        __m256 vy0i = _mm256_set1_ps(y0[box]);
-        __m256 vx1i = _mm256_set1_ps(x1[box]);
-        __m256 vy1i = _mm256_set1_ps(y1[box]);
-
-        __m256 vA_width  = _mm256_sub_ps(vx1i, vx0i);
-        __m256 vA_height = _mm256_sub_ps(vy1i, vy0i);
-        __m256 vA_area   = _mm256_mul_ps(_mm256_add_ps(vA_width, vc_fone), _mm256_add_ps(vA_height, vc_fone));
-
-        for (; tail <= num_boxes - 8; tail += 8) {
-            __m256i *pdst = reinterpret_cast<__m256i*>(is_dead + tail);
-            __m256i  vdst = _mm256_loadu_si256(pdst);
-
-            __m256 vx0j = _mm256_loadu_ps(x0 + tail);
-            __m256 vy0j = _mm256_loadu_ps(y0 + tail);
-            __m256 vx1j = _mm256_loadu_ps(x1 + tail);
-            __m256 vy1j = _mm256_loadu_ps(y1 + tail);
-
-            __m256 vx0 = _mm256_max_ps(vx0i, vx0j);
-            __m256 vy0 = _mm256_max_ps(vy0i, vy0j);
-            __m256 vx1 = _mm256_min_ps(vx1i, vx1j);
-            __m256 vy1 = _mm256_min_ps(vy1i, vy1j);
-
-            __m256 vwidth  = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), vc_fone);
-            __m256 vheight = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), vc_fone);
-            __m256 varea = _mm256_mul_ps(_mm256_max_ps(vc_zero, vwidth), _mm256_max_ps(vc_zero, vheight));
-
-            __m256 vB_width  = _mm256_sub_ps(vx1j, vx0j);
-            __m256 vB_height = _mm256_sub_ps(vy1j, vy0j);
-            __m256 vB_area   = _mm256_mul_ps(_mm256_add_ps(vB_width, vc_fone), _mm256_add_ps(vB_height, vc_fone));
-
-            __m256 vdivisor = _mm256_sub_ps(_mm256_add_ps(vA_area, vB_area), varea);
-            __m256 vintersection_area = _mm256_div_ps(varea, vdivisor);
-
-            __m256 vcmp_0 = _mm256_cmp_ps(vx0i, vx1j, _CMP_LE_OS);
-            __m256 vcmp_1 = _mm256_cmp_ps(vy0i, vy1j, _CMP_LE_OS);
-            __m256 vcmp_2 = _mm256_cmp_ps(vx0j, vx1i, _CMP_LE_OS);
-            __m256 vcmp_3 = _mm256_cmp_ps(vy0j, vy1i, _CMP_LE_OS);
-            __m256 vcmp_4 = _mm256_cmp_ps(vc_nms_thresh, vintersection_area, _CMP_LT_OS);
-
-            vcmp_0 = _mm256_and_ps(vcmp_0, vcmp_1);
-            vcmp_2 = _mm256_and_ps(vcmp_2, vcmp_3);
-            vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_0);
-            vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_2);
-
-            _mm256_storeu_si256(pdst, _mm256_blendv_epi8(vdst, vc_ione, _mm256_castps_si256(vcmp_4)));
-        }
-#endif
-
-        for (; tail < num_boxes; ++tail) {
-            float res = 0.0f;
-
-            const float x0i = x0[box];
-            const float y0i = y0[box];
-            const float x1i = x1[box];
-            const float y1i = y1[box];
-
-            const float x0j = x0[tail];
-            const float y0j = y0[tail];
-            const float x1j = x1[tail];
-            const float y1j = y1[tail];
-
-            if (x0i <= x1j && y0i <= y1j && x0j <= x1i && y0j <= y1i) {
-                // overlapped region (= box)
-                const float x0 = std::max<float>(x0i, x0j);
-                const float y0 = std::max<float>(y0i, y0j);
-                const float x1 = std::min<float>(x1i, x1j);
-                const float y1 = std::min<float>(y1i, y1j);
-
-                // intersection area
-                const float width  = std::max<float>(0.0f,  x1 - x0 + coordinates_offset);
-                const float height = std::max<float>(0.0f,  y1 - y0 + coordinates_offset);
-                const float area   = width * height;
-
-                // area of A, B
-                const float A_area = (x1i - x0i + coordinates_offset) * (y1i - y0i + coordinates_offset);
-                const float B_area = (x1j - x0j + coordinates_offset) * (y1j - y0j + coordinates_offset);
-
-                // IoU
-                res = area / (A_area + B_area - area);
-            }
-
-            if (nms_thresh < res)
-                is_dead[tail] = 1;
-        }
-    }
-
-    *num_out = count;
-}
-
-
 static
 void fill_output_blobs(const float* proposals, const int* roi_indices,
                        float* rois, float* scores,
@@ -380,7 +311,7 @@ public:
         };
         std::vector<ProposalBox> proposals_(num_proposals);
         std::vector<float> unpacked_boxes(5 * pre_nms_topn);
-        std::vector<int> is_dead(pre_nms_topn);
+        std::vector<uint64_t> is_dead((pre_nms_topn + NMS_BLOCK_SIZE - 1) / NMS_BLOCK_SIZE);
 
         // Execute
         int batch_size = 1;  // inputs[INPUT_DELTAS]->getTensorDesc().getDims()[0];
@@ -391,10 +322,12 @@ public:
                            min_box_H, min_box_W,
                            static_cast<const float>(log(1000. / 16.)),
                            1.0f);
-            std::partial_sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(),
-                              [](const ProposalBox& struct1, const ProposalBox& struct2) {
-                                  return (struct1.score > struct2.score);
-                              });
+            // the selection of the top-n is linear, only the selected proposals are sorted
+            auto greater_score = [](const ProposalBox& struct1, const ProposalBox& struct2) {
+                return (struct1.score > struct2.score);
+            };
+            std::nth_element(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(), greater_score);
+            std::sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, greater_score);
 
             unpack_boxes(reinterpret_cast<float *>(&proposals_[0]), &unpacked_boxes[0], pre_nms_topn);
             nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], &roi_indices_[0], &num_rois, 0,
@@ -8,6 +8,7 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <cstring>
 #include "ie_parallel.hpp"
 
 namespace InferenceEngine {
@@ -41,6 +42,20 @@ public:
             nh = static_cast<int>(outDims[2]);
             nw = static_cast<int>(outDims[3]);
 
+            // the bilinear bins of a block of the output channels take a block of the input channels, so the
+            // blocked layouts let the bins be interpolated for the whole block at once
+            if (mode_ == "bilinear") {
+#if defined(HAVE_AVX512F)
+                const int blk_size = 16;
+                auto blk_layout = ConfLayout::BLK16;
+#else
+                const int blk_size = 8;
+                auto blk_layout = ConfLayout::BLK8;
+#endif
+                if (nc % blk_size == 0)
+                    addConfig(layer, {DataConfigurator(blk_layout), DataConfigurator(ConfLayout::PLN)},
+                              {DataConfigurator(blk_layout)});
+            }
             addConfig(layer, {DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
@@ -62,133 +77,156 @@ public:
             }
         }
 
-        size_t num_bins = spatial_bins_x_*spatial_bins_y_;
-
-        parallel_for(real_rois, [&](int n) {
-            const float* bottom_rois = bottom_rois_beginning + n * 5;
-            int roi_batch_ind = static_cast<int>(bottom_rois[0]);
-            float roi_start_w = 0.0f;
-            float roi_start_h = 0.0f;
-            float roi_end_w   = 0.0f;
-            float roi_end_h   = 0.0f;
-            float roi_width   = 0.0f;
-            float roi_height  = 0.0f;
-
-            if (mode_ == "bilinear") {
-                roi_start_w = bottom_rois[1] * spatial_scale_;
-                roi_start_h = bottom_rois[2] * spatial_scale_;
-                roi_end_w = bottom_rois[3] * spatial_scale_;
-                roi_end_h = bottom_rois[4] * spatial_scale_;
-                roi_width  = roi_end_w - roi_start_w;
-                roi_height = roi_end_h - roi_start_h;
-            } else if (mode_ == "average") {
-                roi_start_w = static_cast<float>(round(bottom_rois[1])) * spatial_scale_;
-                roi_start_h = static_cast<float>(round(bottom_rois[2])) * spatial_scale_;
-                roi_end_w   = static_cast<float>(round(bottom_rois[3]) + 1.0f) * spatial_scale_;
-                roi_end_h   = static_cast<float>(round(bottom_rois[4]) + 1.0f) * spatial_scale_;
-                // Force too small ROIs to be 1x1
-                roi_width  = std::max<float>(roi_end_w - roi_start_w, 0.1f);  // avoid 0
-                roi_height = std::max<float>(roi_end_h - roi_start_h, 0.1f);
-            }
+        if (mode_ == "average") {
+            psroi_average(bottom_data_beginning, bottom_rois_beginning, dst_data, real_rois);
+        } else if (mode_ == "bilinear") {
+            int blk_size = 1;
+            if (inputs[0]->layout() == BLOCKED)
+                blk_size = static_cast<int>(inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims().back());
+            psroi_bilinear(bottom_data_beginning, bottom_rois_beginning, dst_data, real_rois, blk_size);
+        }
 
-            for (int c = 0; c < nc; c++) {
-                for (int h = 0; h < nh; h++) {
-                    for (int w = 0; w < nw; w++) {
-                        size_t index = n*nc*nh*nw + c*nh*nw + h*nw + w;
-                        dst_data[index] = 0.0f;
+        // the tail of the ROIs is padded with zeros, the blocked output has no padded channels
+        if (real_rois < nn)
+            memset(dst_data + static_cast<size_t>(real_rois) * nc * nh * nw, 0,
+                   static_cast<size_t>(nn - real_rois) * nc * nh * nw * sizeof(float));
 
-                        if (mode_ == "average") {
-                            float bin_size_h = roi_height / static_cast<float>(pooled_height_);
-                            float bin_size_w = roi_width  / static_cast<float>(pooled_width_);
+        return OK;
+    }
 
-                            int hstart = static_cast<int>(floor(static_cast<float>(h + 0) * bin_size_h + roi_start_h));
-                            int hend = static_cast<int>(ceil(static_cast<float>(h + 1) * bin_size_h + roi_start_h));
+private:
+    void psroi_average(const float* bottom_data_beginning, const float* bottom_rois_beginning, float* dst_data,
+                       int real_rois) {
+        parallel_for2d(real_rois, nc, [&](int n, int c) {
+            const float* bottom_rois = bottom_rois_beginning + n * 5;
+            int roi_batch_ind = static_cast<int>(bottom_rois[0]);
+            float roi_start_w = static_cast<float>(round(bottom_rois[1])) * spatial_scale_;
+            float roi_start_h = static_cast<float>(round(bottom_rois[2])) * spatial_scale_;
+            float roi_end_w   = static_cast<float>(round(bottom_rois[3]) + 1.0f) * spatial_scale_;
+            float roi_end_h   = static_cast<float>(round(bottom_rois[4]) + 1.0f) * spatial_scale_;
+            // Force too small ROIs to be 1x1
+            float roi_width  = std::max<float>(roi_end_w - roi_start_w, 0.1f);  // avoid 0
+            float roi_height = std::max<float>(roi_end_h - roi_start_h, 0.1f);
+            float bin_size_h = roi_height / static_cast<float>(pooled_height_);
+            float bin_size_w = roi_width  / static_cast<float>(pooled_width_);
+
+            float* dst = dst_data + (n * nc + c) * nh * nw;
+            for (int h = 0; h < nh; h++) {
+                int hstart = static_cast<int>(floor(static_cast<float>(h + 0) * bin_size_h + roi_start_h));
+                int hend = static_cast<int>(ceil(static_cast<float>(h + 1) * bin_size_h + roi_start_h));
+                hstart = std::min<int>(std::max<int>(hstart, 0), height);
+                hend = std::min<int>(std::max<int>(hend, 0), height);
+
+                for (int w = 0; w < nw; w++) {
+                    int wstart = static_cast<int>(floor(static_cast<float>(w + 0) * bin_size_w + roi_start_w));
+                    int wend = static_cast<int>(ceil(static_cast<float>(w + 1) * bin_size_w + roi_start_w));
+                    wstart = std::min<int>(std::max<int>(wstart, 0), width);
+                    wend = std::min<int>(std::max<int>(wend, 0), width);
+
+                    float bin_area = static_cast<float>((hend - hstart) * (wend - wstart));
+                    if (bin_area == 0.0f) {
+                        dst[h * nw + w] = 0.0f;
+                        continue;
+                    }
 
-                            hstart = std::min<int>(std::max<int>(hstart, 0), height);
-                            hend = std::min<int>(std::max<int>(hend, 0), height);
-                            int wstart = static_cast<int>(floor(static_cast<float>(w + 0) * bin_size_w + roi_start_w));
-                            int wend = static_cast<int>(ceil(static_cast<float>(w + 1) * bin_size_w + roi_start_w));
+                    int gc = (c * group_size_ + h) * group_size_ + w;
+                    const float *bottom_data =
+                            bottom_data_beginning + ((roi_batch_ind * channels + gc) * height * width);
 
-                            wstart = std::min<int>(std::max<int>(wstart, 0), width);
-                            wend = std::min<int>(std::max<int>(wend, 0), width);
+                    float out_sum = 0.0f;
+                    for (int hh = hstart; hh < hend; ++hh) {
+                        const float *row = bottom_data + hh * width;
+                        for (int ww = wstart; ww < wend; ++ww)
+                            out_sum += row[ww];
+                    }
 
-                            float bin_area = static_cast<float>((hend - hstart) * (wend - wstart));
-                            if (bin_area) {
-                                int gc = (c * group_size_ + h) * group_size_ + w;
-                                const float *bottom_data =
-                                        bottom_data_beginning + ((roi_batch_ind * channels + gc) * height * width);
+                    dst[h * nw + w] = out_sum / bin_area;
+                }
+            }
+        });
+    }
 
-                                float out_sum = 0.0f;
-                                for (int hh = hstart; hh < hend; ++hh)
-                                    for (int ww = wstart; ww < wend; ++ww)
-                                        out_sum += bottom_data[hh * width + ww];
+    // blk_size is 1 for the planar layout, a block of the output channels reads a block of the input channels
+    void psroi_bilinear(const float* bottom_data_beginning, const float* bottom_rois_beginning, float* dst_data,
+                        int real_rois, int blk_size) {
+        const int ocb = nc / blk_size;
+        const int icb = channels / blk_size;
+        const size_t num_bins = spatial_bins_x_*spatial_bins_y_;
 
-                                dst_data[index] = out_sum / bin_area;
-                            }
-                        } else if (mode_ == "bilinear") {
-                            for (size_t bin_y = 0; bin_y < spatial_bins_y_; bin_y++) {
-                                for (size_t bin_x = 0; bin_x < spatial_bins_x_; bin_x++) {
-                                    float box_xmin = roi_start_w + (bin_x + 0) * (roi_width / spatial_bins_x_);
-                                    float box_xmax = roi_start_w + (bin_x + 1) * (roi_width / spatial_bins_x_);
-                                    float box_ymin = roi_start_h + (bin_y + 0) * (roi_height / spatial_bins_y_);
-                                    float box_ymax = roi_start_h + (bin_y + 1) * (roi_height / spatial_bins_y_);
-
-                                    size_t gc = c + (bin_y*spatial_bins_x_ + bin_x)*nc;
-                                    size_t src_idx = (roi_batch_ind * channels + gc) * height * width;
-                                    const float *bottom_data = bottom_data_beginning + src_idx;
-
-                                    float height_scale = nh > 1 ? (box_ymax - box_ymin) * (height - 1) / (pooled_height_ - 1)
-                                                                : 0.0f;
-                                    float width_scale = nw > 1 ? (box_xmax - box_xmin) * (width - 1) / (pooled_width_ - 1)
-                                                               : 0.0f;
-
-                                    float in_y = nh > 1 ? (h * height_scale + box_ymin * (height - 1))
-                                                        : 0.5f * (box_ymin + box_ymax) * (height - 1);
-                                    float in_x = nw > 1 ? (w * width_scale + box_xmin * (width - 1))
-                                                        : 0.5f * (box_xmin + box_xmax) * (width - 1);
-
-                                    if (!(in_y < 0 || in_y > height - 1 || in_x < 0 || in_x > width - 1)) {
-                                        int top_y_index = static_cast<int>(floorf(in_y));
-                                        int bottom_y_index = static_cast<int>(ceilf(in_y));
-                                        int left_x_index = static_cast<int>(floorf(in_x));
-                                        int right_x_index = static_cast<int>(ceilf(in_x));
-
-                                        if (right_x_index > width - 1)
-                                            right_x_index = width - 1;
-
-                                        if (bottom_y_index > height - 1)
-                                            bottom_y_index = height - 1;
-
-                                        const float top_left = bottom_data[top_y_index * width + left_x_index];
-                                        const float top_right = bottom_data[top_y_index * width + right_x_index];
-                                        const float bottom_left = bottom_data[bottom_y_index * width + left_x_index];
-                                        const float bottom_right = bottom_data[bottom_y_index * width + right_x_index];
-
-                                        const float top = top_left + (top_right - top_left) * (in_x - left_x_index);
-                                        const float bottom = bottom_left + (bottom_right - bottom_left) * (in_x - left_x_index);
-
-                                        dst_data[index] += top + (bottom - top) * (in_y - top_y_index);
-                                    }
-                                }
+        parallel_for2d(real_rois, ocb, [&](int n, int cb) {
+            const float* bottom_rois = bottom_rois_beginning + n * 5;
+            int roi_batch_ind = static_cast<int>(bottom_rois[0]);
+            float roi_start_w = bottom_rois[1] * spatial_scale_;
+            float roi_start_h = bottom_rois[2] * spatial_scale_;
+            float roi_end_w = bottom_rois[3] * spatial_scale_;
+            float roi_end_h = bottom_rois[4] * spatial_scale_;
+            float roi_width  = roi_end_w - roi_start_w;
+            float roi_height = roi_end_h - roi_start_h;
+
+            float* dst = dst_data + (n * ocb + cb) * nh * nw * blk_size;
+            for (int h = 0; h < nh; h++) {
+                for (int w = 0; w < nw; w++) {
+                    float* out = dst + (h * nw + w) * blk_size;
+                    for (int i = 0; i < blk_size; i++)
+                        out[i] = 0.0f;
+
+                    for (size_t bin_y = 0; bin_y < spatial_bins_y_; bin_y++) {
+                        for (size_t bin_x = 0; bin_x < spatial_bins_x_; bin_x++) {
+                            float box_xmin = roi_start_w + (bin_x + 0) * (roi_width / spatial_bins_x_);
+                            float box_xmax = roi_start_w + (bin_x + 1) * (roi_width / spatial_bins_x_);
+                            float box_ymin = roi_start_h + (bin_y + 0) * (roi_height / spatial_bins_y_);
+                            float box_ymax = roi_start_h + (bin_y + 1) * (roi_height / spatial_bins_y_);
+
+                            float height_scale = nh > 1 ? (box_ymax - box_ymin) * (height - 1) / (pooled_height_ - 1)
+                                                        : 0.0f;
+                            float width_scale = nw > 1 ? (box_xmax - box_xmin) * (width - 1) / (pooled_width_ - 1)
+                                                       : 0.0f;
+
+                            float in_y = nh > 1 ? (h * height_scale + box_ymin * (height - 1))
+                                                : 0.5f * (box_ymin + box_ymax) * (height - 1);
+                            float in_x = nw > 1 ? (w * width_scale + box_xmin * (width - 1))
+                                                : 0.5f * (box_xmin + box_xmax) * (width - 1);
+
+                            if (in_y < 0 || in_y > height - 1 || in_x < 0 || in_x > width - 1)
+                                continue;
+
+                            int top_y_index = static_cast<int>(floorf(in_y));
+                            int bottom_y_index = static_cast<int>(ceilf(in_y));
+                            int left_x_index = static_cast<int>(floorf(in_x));
+                            int right_x_index = static_cast<int>(ceilf(in_x));
+
+                            if (right_x_index > width - 1)
+                                right_x_index = width - 1;
+
+                            if (bottom_y_index > height - 1)
+                                bottom_y_index = height - 1;
+
+                            const float x_lerp = in_x - left_x_index;
+                            const float y_lerp = in_y - top_y_index;
+
+                            size_t gcb = cb + (bin_y*spatial_bins_x_ + bin_x) * ocb;
+                            const float *bottom_data =
+                                    bottom_data_beginning + (roi_batch_ind * icb + gcb) * height * width * blk_size;
+                            const float *top_left = bottom_data + (top_y_index * width + left_x_index) * blk_size;
+                            const float *top_right = bottom_data + (top_y_index * width + right_x_index) * blk_size;
+                            const float *bottom_left = bottom_data + (bottom_y_index * width + left_x_index) * blk_size;
+                            const float *bottom_right = bottom_data + (bottom_y_index * width + right_x_index) * blk_size;
+
+                            for (int i = 0; i < blk_size; i++) {
+                                const float top = top_left[i] + (top_right[i] - top_left[i]) * x_lerp;
+                                const float bottom = bottom_left[i] + (bottom_right[i] - bottom_left[i]) * x_lerp;
+                                out[i] += top + (bottom - top) * y_lerp;
                             }
-                            dst_data[index] /= num_bins;
                         }
                     }
+
+                    for (int i = 0; i < blk_size; i++)
+                        out[i] /= num_bins;
                 }
             }
         });
-
-        for (int n = real_rois; n < nn; n++) {
-            parallel_for3d(nc, nh, nw, [&](int c, int h, int w) {
-                int index = n * nc * nh * nw + c * nh * nw + h * nw + w;
-                dst_data[index] = 0.0f;
-            });
-        }
-
-        return OK;
     }
 
-private:
     size_t output_dim_ = 0;
     size_t group_size_ = 0;
     float spatial_scale_ = 0;
@@ -6,6 +6,7 @@
 #include "ext_base.hpp"
 #include "defs.h"
 #include "softmax.h"
+#include "simd_math.h"
 #include <vector>
 #include "simple_copy.h"
 
@@ -62,14 +63,10 @@ public:
         for (int b = 0; b < B; b++) {
             for (int n = 0; n < num_; n++) {
                 int index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, 0);
-                for (int i = index; i < index + 2 * IW * IH; i++) {
-                    dst_data[i] = logistic_activate(dst_data[i]);
-                }
+                simd::sigmoid_array(dst_data + index, dst_data + index, 2 * IW * IH);
 
                 index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, coords);
-                for (int i = index; i < index + end_index; i++) {
-                    dst_data[i] = logistic_activate(dst_data[i]);
-                }
+                simd::sigmoid_array(dst_data + index, dst_data + index, end_index);
             }
         }
 
@@ -98,10 +95,6 @@ private:
         return batch * outputs + n * width * height * (coords + classes + 1) +
                entry * width * height + loc;
     }
-
-    inline float logistic_activate(float x) {
-        return 1.f / (1.f + exp(-x));
-    }
 };
 
 REG_FACTORY_FOR(ImplFactory<RegionYoloImpl>, RegionYolo);
@@ -106,10 +106,11 @@ public:
                     Upsample_Nearest_BLK<2>(src_data, dst_data, IN, IC, IH, IW);
                 }
             } else {
+                prepareTables(IH, IW, OH, OW, fx, fy, 0, false);
                 if (layout == NCHW) {
-                    NearestNeighborKernel_PLN(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW);
+                    NearestNeighborKernel_PLN(src_data, dst_data, IN, IC, IH, IW, OH, OW);
                 } else {
-                    NearestNeighborKernel_BLK(src_data, dst_data, IN, IC, IH, IW, fx, fy, OH, OW);
+                    NearestNeighborKernel_BLK(src_data, dst_data, IN, IC, IH, IW, OH, OW);
                 }
             }
         } else if (type == "caffe.ResampleParameter.LINEAR") {
@@ -120,7 +121,10 @@ public:
                 Upsample4x_TriangleInterpolation(src_data, IW, IH, fx, fy, dst_data, OW, OH, IC, IN);
             else
 #endif
-                InterpolationKernel(src_data, IW, IH, fx, fy, dst_data, OW, OH, IC, IN, kernel_width, isDownsample && antialias);
+            {
+                prepareTables(IH, IW, OH, OW, fx, fy, kernel_width, isDownsample && antialias);
+                InterpolationKernel(src_data, IW, IH, dst_data, OW, OH, IC, IN);
+            }
         }
         return OK;
     }
@@ -133,103 +137,178 @@ private:
         return std::max(0.0f, 1 - std::abs(x));
     }
 
-    static void InterpolationKernel(const float *in_ptr_,
-                                    const size_t iw, const size_t ih,
-                                    const float fx, const float fy,
-                                    float *out_ptr_,
-                                    const size_t ow, const size_t oh, const size_t channels, const size_t batch,
-                                    size_t kernel_width, bool antialias) {
-        for (size_t b = 0; b < batch; b++) {
-            for (size_t c = 0; c < channels; c++) {
-                const float *in_ptr = in_ptr_ + iw * ih * channels * b + iw * ih * c;
-                float *out_ptr = out_ptr_ + ow * oh * channels * b + ow * oh * c;
-
-                for (size_t oy = 0; oy < oh; oy++) {
-                    for (size_t ox = 0; ox < ow; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
-
-                        int ix_r = static_cast<int>(round(ix));
-                        int iy_r = static_cast<int>(round(iy));
-
-                        float sum = 0;
-                        float wsum = 0;
-
-                        float ax = 1.0f / (antialias ? fx : 1.0f);
-                        float ay = 1.0f / (antialias ? fy : 1.0f);
+    // The source coordinates of the output columns and rows with their weights, they depend only on the shapes
+    // and the parameters, so they are computed once and reused while the shapes are the same
+    std::vector<size_t> table_shape;
+    // the nearest source column of each output column and the nearest source row of each output row
+    std::vector<int> nearest_x;
+    std::vector<int> nearest_y;
+    // the kernel_x taps of the output columns: the source columns and the normalized weights stored tap by tap,
+    // the taps out of the source have the zero weight, and the same for the rows
+    int kernel_x = 0;
+    int kernel_y = 0;
+    std::vector<int> linear_x;
+    std::vector<float> weight_x;
+    std::vector<int> linear_y;
+    std::vector<float> weight_y;
+
+    static void prepareNearestTable(std::vector<int> &table, const size_t in, const size_t out,
+                                    const float f, const float f_other) {
+        table.resize(out);
+        for (size_t o = 0; o < out; o++) {
+            float i = o * f + f_other / 2.0f - 0.5f;
+            table[o] = std::min(std::max(static_cast<int>(round(i)), 0), static_cast<int>(in) - 1);
+        }
+    }
 
-                        int rx = (fx < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ax));
-                        int ry = (fy < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / ay));
+    static void prepareLinearTable(std::vector<int> &taps, std::vector<float> &weights, int &kernel,
+                                   const size_t in, const size_t out, const float f, const float f_other,
+                                   const size_t kernel_width, bool antialias) {
+        float a = 1.0f / (antialias ? f : 1.0f);
+        int r = (f < 1.0f) ? 2 : static_cast<int>(ceil(static_cast<float>(kernel_width) / a));
+        kernel = 2 * r + 1;
+
+        taps.resize(out * kernel);
+        weights.resize(out * kernel);
+        for (size_t o = 0; o < out; o++) {
+            float i = o * f + f_other / 2.0f - 0.5f;
+            int i_r = static_cast<int>(round(i));
+
+            float wsum = 0.0f;
+            for (int k = 0; k < kernel; k++) {
+                int x = i_r - r + k;
+                bool inside = x >= 0 && x < static_cast<int>(in);
+                taps[k * out + o] = inside ? x : 0;
+                weights[k * out + o] = inside ? a * triangleCoeff(a * (i - x)) : 0.0f;
+                wsum += weights[k * out + o];
+            }
+            for (int k = 0; k < kernel; k++)
+                weights[k * out + o] = wsum ? weights[k * out + o] / wsum : 0.0f;
+        }
+    }
 
-                        for (int y = iy_r - ry; y <= iy_r + ry; y++) {
-                            for (int x = ix_r - rx; x <= ix_r + rx; x++) {
-                                if (y < 0 || x < 0 || y >= static_cast<int>(ih) || x >= static_cast<int>(iw))
-                                    continue;
+    void prepareTables(const size_t IH, const size_t IW, const size_t OH, const size_t OW,
+                       const float fx, const float fy, const size_t kernel_width, bool antialias) {
+        std::vector<size_t> shape = {IH, IW, OH, OW};
+        if (shape == table_shape)
+            return;
 
-                                float dx = ix - x;
-                                float dy = iy - y;
+        if (type == "caffe.ResampleParameter.NEAREST") {
+            prepareNearestTable(nearest_x, IW, OW, fx, fy);
+            prepareNearestTable(nearest_y, IH, OH, fy, fx);
+        } else {
+            prepareLinearTable(linear_x, weight_x, kernel_x, IW, OW, fx, fy, kernel_width, antialias);
+            prepareLinearTable(linear_y, weight_y, kernel_y, IH, OH, fy, fx, kernel_width, antialias);
+        }
+        table_shape = shape;
+    }
 
-                                float w = ax * triangleCoeff(ax * dx) * ay * triangleCoeff(ay * dy);
+    // The triangle filter is separable: the rows of the source are filtered along W first, then the output rows
+    // are the weighted sums of the filtered rows.
+    void InterpolationKernel(const float *in_ptr_,
+                             const size_t iw, const size_t ih,
+                             float *out_ptr_,
+                             const size_t ow, const size_t oh, const size_t channels, const size_t batch) {
+        parallel_for2d(batch, channels, [&](size_t b, size_t c) {
+            const float *in_ptr = in_ptr_ + iw * ih * channels * b + iw * ih * c;
+            float *out_ptr = out_ptr_ + ow * oh * channels * b + ow * oh * c;
+
+            std::vector<float> rows(ih * ow);
+            for (size_t y = 0; y < ih; y++) {
+                const float *in_row = in_ptr + y * iw;
+                float *row = &rows[y * ow];
+
+                size_t ox = 0;
+#if defined(HAVE_AVX2)
+                for (; ox + 8 <= ow; ox += 8) {
+                    __m256 vsum = _mm256_setzero_ps();
+                    for (int k = 0; k < kernel_x; k++) {
+                        __m256i vidx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&linear_x[k * ow + ox]));
+                        __m256 vw = _mm256_loadu_ps(&weight_x[k * ow + ox]);
+                        vsum = _mm256_fmadd_ps(vw, _mm256_i32gather_ps(in_row, vidx, 4), vsum);
+                    }
+                    _mm256_storeu_ps(row + ox, vsum);
+                }
+#endif
+                for (; ox < ow; ox++) {
+                    float sum = 0.0f;
+                    for (int k = 0; k < kernel_x; k++)
+                        sum += weight_x[k * ow + ox] * in_row[linear_x[k * ow + ox]];
+                    row[ox] = sum;
+                }
+            }
 
-                                sum += w * in_ptr[y * iw + x];
-                                wsum += w;
-                            }
-                        }
+            for (size_t oy = 0; oy < oh; oy++) {
+                float *out_row = out_ptr + oy * ow;
 
-                        out_ptr[oy * ow + ox] = (!wsum) ? 0 : (sum / wsum);
+                size_t ox = 0;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#if defined(HAVE_AVX512F)
+                const size_t vlen = 16;
+#else
+                const size_t vlen = 8;
+#endif
+                for (; ox + vlen <= ow; ox += vlen) {
+                    auto vsum = _mm_uni_setzero_ps();
+                    for (int k = 0; k < kernel_y; k++) {
+                        const float *row = &rows[linear_y[k * oh + oy] * ow + ox];
+                        vsum = _mm_uni_add_ps(vsum, _mm_uni_mul_ps(_mm_uni_set1_ps(weight_y[k * oh + oy]),
+                                                                   _mm_uni_loadu_ps(row)));
                     }
+                    _mm_uni_storeu_ps(out_row + ox, vsum);
+                }
+#endif
+                for (; ox < ow; ox++) {
+                    float sum = 0.0f;
+                    for (int k = 0; k < kernel_y; k++)
+                        sum += weight_y[k * oh + oy] * rows[linear_y[k * oh + oy] * ow + ox];
+                    out_row[ox] = sum;
                 }
             }
-        }
+        });
     }
 
-    static void NearestNeighborKernel_PLN(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, float fx, float fy, int OH, int OW) {
-        for (int b = 0; b < B; b++) {
-            for (int c = 0; c < C; c++) {
-                const float *in_ptr = in_ptr_ + IW * IH * C * b + IW * IH * c;
-                float *out_ptr = out_ptr_ + OW * OH * C * b + OW * OH * c;
-
-                for (int oy = 0; oy < OH; oy++) {
-                    for (int ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
-
-                        size_t ix_r = static_cast<size_t>(round(ix));
-                        size_t iy_r = static_cast<size_t>(round(iy));
+    void NearestNeighborKernel_PLN(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, int OH, int OW) {
+        parallel_for3d(B, C, OH, [&](int b, int c, int oy) {
+            const float *in_ptr = in_ptr_ + IW * IH * C * b + IW * IH * c + nearest_y[oy] * IW;
+            float *out_ptr = out_ptr_ + OW * OH * C * b + OW * OH * c + oy * OW;
 
-                        out_ptr[oy * OW + ox] = in_ptr[iy_r * IW + ix_r];
-                    }
-                }
+            int ox = 0;
+#if defined(HAVE_AVX2)
+            for (; ox <= OW - 8; ox += 8) {
+                __m256i vidx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&nearest_x[ox]));
+                _mm256_storeu_ps(out_ptr + ox, _mm256_i32gather_ps(in_ptr, vidx, 4));
             }
-        }
+#endif
+            for (; ox < OW; ox++) {
+                out_ptr[ox] = in_ptr[nearest_x[ox]];
+            }
+        });
     }
 
-    static void NearestNeighborKernel_BLK(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, float fx, float fy, int OH, int OW) {
+    void NearestNeighborKernel_BLK(const float *in_ptr_, float *out_ptr_, int B, int C, int IH, int IW, int OH, int OW) {
+#if defined(HAVE_AVX512F)
+        int blk_size = 16;
+#else
         int blk_size = 8;
+#endif
         int CB = div_up(C, blk_size);
 
-        for (int b = 0; b < B; b++) {
-            for (int cb = 0; cb < CB; cb++) {
-                const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size;
-                float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size;
-
-                for (int oy = 0; oy < OH; oy++) {
-                    for (int ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
-
-                        size_t ix_r = static_cast<size_t>(round(ix));
-                        size_t iy_r = static_cast<size_t>(round(iy));
-
-                        for (int c = 0; c < blk_size; c++) {
-                            float value = in_ptr[iy_r * IW * blk_size + ix_r * blk_size + c];
+        parallel_for3d(B, CB, OH, [&](int b, int cb, int oy) {
+            const float *in_ptr = in_ptr_ + IW * IH * CB * blk_size * b + IW * IH * cb * blk_size +
+                                  nearest_y[oy] * IW * blk_size;
+            float *out_ptr = out_ptr_ + OW * OH * CB * blk_size * b + OW * OH * cb * blk_size + oy * OW * blk_size;
 
-                            out_ptr[oy * OW * blk_size + ox * blk_size + c] = value;
-                        }
-                    }
+            for (int ox = 0; ox < OW; ox++) {
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                _mm_uni_storeu_ps(out_ptr + ox * blk_size, _mm_uni_loadu_ps(in_ptr + nearest_x[ox] * blk_size));
+#else
+                for (int c = 0; c < blk_size; c++) {
+                    out_ptr[ox * blk_size + c] = in_ptr[nearest_x[ox] * blk_size + c];
                 }
+#endif
             }
-        }
+        });
     }
 
     template <typename T, int factor>
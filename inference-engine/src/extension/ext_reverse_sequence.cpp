@@ -6,6 +6,7 @@
 #include "ext_base.hpp"
 
 #include <cmath>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <cassert>
@@ -87,31 +88,7 @@ public:
                     }
                 }
 
-                parallel_nt(0, [&](const int ithr, const int nthr) {
-                    size_t i, start = 0, end = 0, src_idx = 0;
-                    SizeVector counters(src_dims.size(), 0);
-                    splitter(work_amount_dst, nthr, ithr, start, end);
-                    for (int j = src_dims.size() - 1, i = start; j >= 0; j--) {
-                        counters[j] = i % src_dims[j];
-                        i /= src_dims[j];
-                    }
-
-                    for (size_t iwork = start; iwork < end; ++iwork) {
-                        for (i = 0, src_idx = 0; i < src_dims.size(); ++i) {
-                            size_t idx = counters[i];
-                            if (static_cast<int>(i) == seq_axis &&
-                                    static_cast<int>(idx) < static_cast<int32_t>(seq_lengths_data[counters[batch_axis]])) {
-                                idx = static_cast<int32_t>(seq_lengths_data[counters[batch_axis]]) - idx - 1;
-                            }
-                            src_idx += idx * srcStrides[i];
-                        }
-                        dst_data[iwork] = src_data[src_idx];
-                        for (int j = src_dims.size() - 1; j >= 0; j--) {
-                            counters[j] = (counters[j] + 1) % src_dims[j];
-                            if (counters[j] != 0) break;
-                        }
-                    }
-                });
+                reverse(src_data, dst_data, seq_lengths_data);
             }
             break;
             case Precision::I32: {
@@ -127,31 +104,7 @@ public:
                     }
                 }
 
-                parallel_nt(0, [&](const int ithr, const int nthr) {
-                    size_t i, start = 0, end = 0, src_idx = 0;
-                    SizeVector counters(src_dims.size(), 0);
-                    splitter(work_amount_dst, nthr, ithr, start, end);
-                    for (int j = src_dims.size() - 1, i = start; j >= 0; j--) {
-                        counters[j] = i % src_dims[j];
-                        i /= src_dims[j];
-                    }
-
-                    for (size_t iwork = start; iwork < end; ++iwork) {
-                        for (i = 0, src_idx = 0; i < src_dims.size(); ++i) {
-                            size_t idx = counters[i];
-                            if (static_cast<int>(i) == seq_axis &&
-                                    static_cast<int>(idx) < seq_lengths_data[counters[batch_axis]]) {
-                                idx = seq_lengths_data[counters[batch_axis]] - idx - 1;
-                            }
-                            src_idx += idx * srcStrides[i];
-                        }
-                        dst_data[iwork] = src_data[src_idx];
-                        for (int j = src_dims.size() - 1; j >= 0; j--) {
-                            counters[j] = (counters[j] + 1) % src_dims[j];
-                            if (counters[j] != 0) break;
-                        }
-                    }
-                });
+                reverse(src_data, dst_data, seq_lengths_data);
             }
             break;
             default:
@@ -162,6 +115,9 @@ public:
     }
 
 private:
+    template <typename T>
+    void reverse(const float *src_data, float *dst_data, const T *seq_lengths_data);
+
     const size_t REVERSESEQUENCE_DATA = 0;
     const size_t REVERSESEQUENCE_LENGTHS = 1;
 
@@ -172,6 +128,42 @@ private:
     size_t work_amount_dst;
 };
 
+template <typename T>
+void ReverseSequenceImpl::reverse(const float *src_data, float *dst_data, const T *seq_lengths_data) {
+    //  The dimensions after both the axes are not reordered: they are copied as contiguous blocks
+    const size_t axes = std::max(seq_axis, batch_axis) + 1;
+    const size_t block = srcStrides[axes - 1];
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t i, start = 0, end = 0, src_idx = 0;
+        SizeVector counters(axes, 0);
+        splitter(work_amount_dst / block, nthr, ithr, start, end);
+        i = start;
+        for (int j = axes - 1; j >= 0; j--) {
+            counters[j] = i % src_dims[j];
+            i /= src_dims[j];
+        }
+
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            const int length = static_cast<int32_t>(seq_lengths_data[counters[batch_axis]]);
+            for (i = 0, src_idx = 0; i < axes; ++i) {
+                size_t idx = counters[i];
+                if (static_cast<int>(i) == seq_axis && static_cast<int>(idx) < length)
+                    idx = length - idx - 1;
+                src_idx += idx * srcStrides[i];
+            }
+            if (block == 1)
+                dst_data[iwork] = src_data[src_idx];
+            else
+                memcpy(dst_data + iwork * block, src_data + src_idx, block * sizeof(float));
+            for (int j = axes - 1; j >= 0; j--) {
+                counters[j] = (counters[j] + 1) % src_dims[j];
+                if (counters[j] != 0) break;
+            }
+        }
+    });
+}
+
 REG_FACTORY_FOR(ImplFactory<ReverseSequenceImpl>, ReverseSequence);
 
 }  // namespace Cpu
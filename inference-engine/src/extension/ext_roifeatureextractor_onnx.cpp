@@ -145,15 +145,14 @@ void ROIAlignForward_cpu_kernel(
   int roi_cols = 4;
 
   int n_rois = nthreads / channels / pooled_width / pooled_height;
-  // (n, c, ph, pw) is an element in the pooled output
+  // the indeces and the weights are calculated per roi first, so the channels of a roi are pooled in parallel too
+  std::vector<std::vector<PreCalc<T>>> pre_calcs(n_rois);
+  std::vector<int> roi_bin_grids_h(n_rois), roi_bin_grids_w(n_rois), roi_batch_inds(n_rois, 0);
   parallel_for(n_rois, [&](size_t n) {
-    int index_n = n * channels * pooled_width * pooled_height;
-
     // roi could have 4 or 5 columns
     const T* offset_bottom_rois = bottom_rois + n * roi_cols;
-    int roi_batch_ind = 0;
     if (roi_cols == 5) {
-      roi_batch_ind = static_cast<int>(offset_bottom_rois[0]);
+      roi_batch_inds[n] = static_cast<int>(offset_bottom_rois[0]);
       offset_bottom_rois++;
     }
 
@@ -175,14 +174,12 @@ void ROIAlignForward_cpu_kernel(
         : static_cast<int>(ceil(roi_height / pooled_height));  // e.g., = 2
     int roi_bin_grid_w =
         (sampling_ratio > 0) ? sampling_ratio : static_cast<int>(ceil(roi_width / pooled_width));
-
-    // We do average (integral) pooling inside a bin
-    const T count = static_cast<T>(roi_bin_grid_h * roi_bin_grid_w);  // e.g. = 4
+    roi_bin_grids_h[n] = roi_bin_grid_h;
+    roi_bin_grids_w[n] = roi_bin_grid_w;
 
     // we want to precalculate indeces and weights shared by all chanels,
     // this is the key point of optimiation
-    std::vector<PreCalc<T>> pre_calc(
-        roi_bin_grid_h * roi_bin_grid_w * pooled_width * pooled_height);
+    pre_calcs[n].resize(roi_bin_grid_h * roi_bin_grid_w * pooled_width * pooled_height);
     pre_calc_for_bilinear_interpolate(
         height,
         width,
@@ -196,36 +193,44 @@ void ROIAlignForward_cpu_kernel(
         bin_size_w,
         roi_bin_grid_h,
         roi_bin_grid_w,
-        pre_calc);
-
-    for (int c = 0; c < channels; c++) {
-      int index_n_c = index_n + c * pooled_width * pooled_height;
-      const T* offset_bottom_data =
-          bottom_data + (roi_batch_ind * channels + c) * height * width;
-      int pre_calc_index = 0;
-
-      for (int ph = 0; ph < pooled_height; ph++) {
-        for (int pw = 0; pw < pooled_width; pw++) {
-          int index = index_n_c + ph * pooled_width + pw;
-
-          T output_val = 0.;
-          for (int iy = 0; iy < roi_bin_grid_h; iy++) {
-            for (int ix = 0; ix < roi_bin_grid_w; ix++) {
-              PreCalc<T> pc = pre_calc[pre_calc_index];
-              output_val += pc.w1 * offset_bottom_data[pc.pos1] +
-                  pc.w2 * offset_bottom_data[pc.pos2] +
-                  pc.w3 * offset_bottom_data[pc.pos3] +
-                  pc.w4 * offset_bottom_data[pc.pos4];
-
-              pre_calc_index += 1;
-            }
+        pre_calcs[n]);
+  });
+
+  // (n, c, ph, pw) is an element in the pooled output
+  parallel_for2d(n_rois, channels, [&](int n, int c) {
+    const int roi_bin_grid_h = roi_bin_grids_h[n];
+    const int roi_bin_grid_w = roi_bin_grids_w[n];
+    const std::vector<PreCalc<T>>& pre_calc = pre_calcs[n];
+
+    // We do average (integral) pooling inside a bin
+    const T count = static_cast<T>(roi_bin_grid_h * roi_bin_grid_w);  // e.g. = 4
+
+    int index_n_c = (n * channels + c) * pooled_width * pooled_height;
+    const T* offset_bottom_data =
+        bottom_data + (roi_batch_inds[n] * channels + c) * height * width;
+    int pre_calc_index = 0;
+
+    for (int ph = 0; ph < pooled_height; ph++) {
+      for (int pw = 0; pw < pooled_width; pw++) {
+        int index = index_n_c + ph * pooled_width + pw;
+
+        T output_val = 0.;
+        for (int iy = 0; iy < roi_bin_grid_h; iy++) {
+          for (int ix = 0; ix < roi_bin_grid_w; ix++) {
+            const PreCalc<T>& pc = pre_calc[pre_calc_index];
+            output_val += pc.w1 * offset_bottom_data[pc.pos1] +
+                pc.w2 * offset_bottom_data[pc.pos2] +
+                pc.w3 * offset_bottom_data[pc.pos3] +
+                pc.w4 * offset_bottom_data[pc.pos4];
+
+            pre_calc_index += 1;
           }
-          output_val /= count;
+        }
+        output_val /= count;
 
-          top_data[index] = output_val;
-        }  // for pw
-      }  // for ph
-    }  // for c
+        top_data[index] = output_val;
+      }  // for pw
+    }  // for ph
   });
 }
 
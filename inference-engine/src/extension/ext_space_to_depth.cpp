@@ -66,7 +66,6 @@ public:
             ownStrides[2] = block_size * C;
             ownStrides[3] = 1;
             ownStrides[4] = C;
-            work_amount_dst = ownStrides[0] * own_dims[0];
 
             addConfig(layer, { DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
@@ -80,41 +79,21 @@ public:
         float* dst_data = outputs[0]->cbuffer().as<float *>() +
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
-        //  Parallel
-        parallel_nt(0, [&](const int ithr, const int nthr) {
-            size_t i, start = 0, end = 0, dst_idx = 0;
-            size_t counters[CNTR_SIZE] = { 0 };
-            splitter(work_amount_dst, nthr, ithr, start, end);
-            i = start;
-            for (int j = CNTR_SIZE - 1; j >= 0; j--) {
-                counters[j] = i % own_dims[j];
-                dst_idx += counters[j] * ownStrides[j];
-                i /= own_dims[j];
-            }
-
-            for (size_t iwork = start, i = 1; iwork < end; ++iwork) {
-                dst_data[dst_idx] = src_data[iwork];
-                for (int j = CNTR_SIZE - 1; j >= 0; j--) {
-                    counters[j]++;
-                    if (counters[j] < own_dims[j]) {
-                        dst_idx += ownStrides[j];
-                        break;
-                    } else {
-                        counters[j] = i = 0;
-                    }
-                }
-                if (!i) {
-                    for (dst_idx = 0; i < CNTR_SIZE; ++i)
-                        dst_idx += counters[i] * ownStrides[i];
-                }
+        //  The rows of the source are deinterleaved into the rows of block_size destination channels, a row at a time
+        const size_t W = own_dims[3];
+        const size_t block_size = own_dims[4];
+        parallel_for3d(own_dims[0], own_dims[1], own_dims[2], [&](size_t x, size_t h, size_t c) {
+            const float* src = src_data + ((x * own_dims[1] + h) * own_dims[2] + c) * W * block_size;
+            float* dst = dst_data + x * ownStrides[0] + h * ownStrides[1] + c * ownStrides[2];
+            for (size_t b = 0; b < block_size; b++, dst += ownStrides[4]) {
+                for (size_t w = 0; w < W; w++)
+                    dst[w] = src[w * block_size + b];
             }
         });
-
         return OK;
     }
 
 private:
-    size_t work_amount_dst;
     size_t own_dims[CNTR_SIZE];
     size_t ownStrides[CNTR_SIZE];
 };
@@ -304,16 +304,20 @@ void StridedSliceImpl::strided_slice(const float *src_data, float* dst_data, std
 }
 
 void StridedSliceImpl::strided_slice_vp(const float *src_data, float* dst_data) {
-    //  Vectorized copy
+    //  Vectorized copy: the innermost dimensions taken whole are merged with the sliced one before them
+    //  into a single contiguous block
     size_t dims_size_1 = dst_dims.size() - 1;
-    size_t dataLength = dst_dims[dims_size_1];
-    size_t work_amount_dst = dstStrides[0] * dst_dims[0] / dst_dims[dims_size_1];
+    while (dims_size_1 > 0 && begin_dms[dims_size_1] == 0 && dst_dims[dims_size_1] == src_dims[dims_size_1] &&
+           stride_dms[dims_size_1 - 1] == 1)
+        dims_size_1--;
+    size_t dataLength = dst_dims[dims_size_1] * dstStrides[dims_size_1];
+    size_t work_amount_dst = dstStrides[0] * dst_dims[0] / dataLength;
 
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
         SizeVector counters(dims_size_1, 0);
         splitter(work_amount_dst, nthr, ithr, start, end);
-        size_t src_idx = begin_dms[dims_size_1];
+        size_t src_idx = begin_dms[dims_size_1] * srcStrides[dims_size_1];
         for (int j = dims_size_1 - 1, i = start; j >= 0; j--) {
             counters[j] = i % dst_dims[j];
             src_idx += (begin_dms[j] + counters[j] * stride_dms[j]) * srcStrides[j];
@@ -332,7 +336,7 @@ void StridedSliceImpl::strided_slice_vp(const float *src_data, float* dst_data)
                 }
             }
             if (!i) {
-                for (src_idx = begin_dms[dims_size_1]; i < dims_size_1; ++i)
+                for (src_idx = begin_dms[dims_size_1] * srcStrides[dims_size_1]; i < dims_size_1; ++i)
                     src_idx += (begin_dms[i] + counters[i] * stride_dms[i]) * srcStrides[i];
             }
         }
@@ -6,6 +6,8 @@
 #include "ext_base.hpp"
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <numeric>
 #include <vector>
 
 
@@ -55,10 +57,13 @@ public:
         auto *input_probs = inputs[INPUT_PROBS]->buffer().as<const float *>();
         auto *output_rois = outputs[OUTPUT_ROIS]->buffer().as<float *>();
 
-        std::vector<size_t> idx(input_rois_num);
-        iota(idx.begin(), idx.end(), 0);
-        // FIXME. partial_sort is enough here.
-        sort(idx.begin(), idx.end(), [&input_probs](size_t i1, size_t i2) {return input_probs[i1] > input_probs[i2];});
+        std::vector<int> idx(input_rois_num);
+        std::iota(idx.begin(), idx.end(), 0);
+        // only the top rois are ordered: they are selected in a linear time, then sorted among themselves
+        auto greater = [&input_probs](int i1, int i2) {return input_probs[i1] > input_probs[i2];};
+        if (top_rois_num < input_rois_num)
+            std::nth_element(idx.begin(), idx.begin() + top_rois_num, idx.end(), greater);
+        std::sort(idx.begin(), idx.begin() + top_rois_num, greater);
 
         for (int i = 0; i < top_rois_num; ++i) {
             std::memcpy(output_rois + 4 * i, input_rois + 4 * idx[i], 4 * sizeof(float));
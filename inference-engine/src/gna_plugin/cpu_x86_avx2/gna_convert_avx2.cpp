@@ -0,0 +1,135 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gna_convert_avx2.hpp"
+
+#include <immintrin.h>
+
+namespace GNAPluginNS {
+
+// same rounding (half away from zero) and saturation as ConvertFloatToInt16
+static inline int16_t quantize(float src) {
+    float value = src + ((src > 0) ? 0.5f : -0.5f);
+    if (value > 32767.0f) {
+        return 32767;
+    } else if (value < -32768.0f) {
+        return -32768;
+    }
+    return static_cast<int16_t>(value);
+}
+
+static inline __m256i quantize(__m256 src) {
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    __m256 value = _mm256_add_ps(src, _mm256_or_ps(_mm256_and_ps(src, sign), half));
+    value = _mm256_min_ps(_mm256_max_ps(value, _mm256_set1_ps(-32768.0f)), _mm256_set1_ps(32767.0f));
+    return _mm256_cvttps_epi32(value);
+}
+
+static inline void store8(int16_t *ptr_dst, __m256i value) {
+    __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr_dst), packed);
+}
+
+void ConvertToInt16_AVX2(int16_t *ptr_dst,
+                         const float *ptr_src,
+                         uint32_t num_elements,
+                         float scale_factor) {
+    const __m256 scale = _mm256_set1_ps(scale_factor);
+    uint32_t i = 0;
+    for (; i + 16 <= num_elements; i += 16) {
+        __m256i lo = quantize(_mm256_mul_ps(_mm256_loadu_ps(ptr_src + i), scale));
+        __m256i hi = quantize(_mm256_mul_ps(_mm256_loadu_ps(ptr_src + i + 8), scale));
+        // packs works within 128-bit lanes, restore the element order afterwards
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr_dst + i), packed);
+    }
+    for (; i + 8 <= num_elements; i += 8) {
+        store8(ptr_dst + i, quantize(_mm256_mul_ps(_mm256_loadu_ps(ptr_src + i), scale)));
+    }
+    for (; i < num_elements; i++) {
+        ptr_dst[i] = quantize(ptr_src[i] * scale_factor);
+    }
+}
+
+void ConvertToInt16Interleaved_AVX2(int16_t *ptr_dst,
+                                    const float *ptr_src,
+                                    uint32_t num_frames,
+                                    uint32_t num_group,
+                                    uint32_t num_vector_elements,
+                                    float scale_factor) {
+    const __m256 scale = _mm256_set1_ps(scale_factor);
+    uint32_t i = 0;
+    // 8 frames x 8 elements blocks are transposed in registers, so every row of the result is one store
+    for (; i + 8 <= num_frames; i += 8) {
+        const float *src = ptr_src + i * num_vector_elements;
+        uint32_t j = 0;
+        for (; j + 8 <= num_vector_elements; j += 8) {
+            __m256 r0 = _mm256_loadu_ps(src + 0 * num_vector_elements + j);
+            __m256 r1 = _mm256_loadu_ps(src + 1 * num_vector_elements + j);
+            __m256 r2 = _mm256_loadu_ps(src + 2 * num_vector_elements + j);
+            __m256 r3 = _mm256_loadu_ps(src + 3 * num_vector_elements + j);
+            __m256 r4 = _mm256_loadu_ps(src + 4 * num_vector_elements + j);
+            __m256 r5 = _mm256_loadu_ps(src + 5 * num_vector_elements + j);
+            __m256 r6 = _mm256_loadu_ps(src + 6 * num_vector_elements + j);
+            __m256 r7 = _mm256_loadu_ps(src + 7 * num_vector_elements + j);
+
+            __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+            __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+            __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+            __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+            __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+            __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+            __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+            __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+            __m256 s0 = _mm256_shuffle_ps(t0, t2, 0x44);
+            __m256 s1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+            __m256 s2 = _mm256_shuffle_ps(t1, t3, 0x44);
+            __m256 s3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+            __m256 s4 = _mm256_shuffle_ps(t4, t6, 0x44);
+            __m256 s5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+            __m256 s6 = _mm256_shuffle_ps(t5, t7, 0x44);
+            __m256 s7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+
+            int16_t *dst = ptr_dst + j * num_group + i;
+            store8(dst + 0 * num_group, quantize(_mm256_mul_ps(_mm256_permute2f128_ps(s0, s4, 0x20), scale)));
+            store8(dst + 1 * num_group, quantize(_mm256_mul_ps(_mm256_permute2f128_ps(s1, s5, 0x20), scale)));
+            store8(dst + 2 * num_group, quantize(_mm256_mul_ps(_mm256_permute2f128_ps(s2, s6, 0x20), scale)));
+            store8(dst + 3 * num_group, quantize(_mm256_mul_ps(_mm256_permute2f128_ps(s3, s7, 0x20), scale)));
+            store8(dst + 4 * num_group, quantize(_mm256_mul_ps(_mm256_permute2f128_ps(s0, s4, 0x31), scale)));
+            store8(dst + 5 * num_group, quantize(_mm256_mul_ps(_mm256_permute2f128_ps(s1, s5, 0x31), scale)));
+            store8(dst + 6 * num_group, quantize(_mm256_mul_ps(_mm256_permute2f128_ps(s2, s6, 0x31), scale)));
+            store8(dst + 7 * num_group, quantize(_mm256_mul_ps(_mm256_permute2f128_ps(s3, s7, 0x31), scale)));
+        }
+        for (; j < num_vector_elements; j++) {
+            for (uint32_t k = 0; k < 8; k++) {
+                ptr_dst[j * num_group + i + k] = quantize(src[k * num_vector_elements + j] * scale_factor);
+            }
+        }
+    }
+    for (; i < num_frames; i++) {
+        for (uint32_t j = 0; j < num_vector_elements; j++) {
+            ptr_dst[j * num_group + i] = quantize(ptr_src[i * num_vector_elements + j] * scale_factor);
+        }
+    }
+}
+
+void ConvertToFloat_AVX2(float *ptr_dst,
+                         const int32_t *ptr_src,
+                         uint32_t num_elements,
+                         float scale_factor) {
+    // division rather than multiplication by the reciprocal keeps the results identical to the scalar code
+    const __m256 scale = _mm256_set1_ps(scale_factor);
+    uint32_t i = 0;
+    for (; i + 8 <= num_elements; i += 8) {
+        __m256 value = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr_src + i)));
+        _mm256_storeu_ps(ptr_dst + i, _mm256_div_ps(value, scale));
+    }
+    for (; i < num_elements; i++) {
+        ptr_dst[i] = static_cast<float>(ptr_src[i]) / scale_factor;
+    }
+}
+
+}  // namespace GNAPluginNS
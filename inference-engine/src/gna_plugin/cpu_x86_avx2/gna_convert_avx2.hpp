@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+
+namespace GNAPluginNS {
+
+//------------------------------------------------------------------------
+//
+// Input quantization and output de-quantization manually vectored for AVX2
+// The rounding and saturation are bit exact with the scalar ConvertFloatToInt16
+//
+//------------------------------------------------------------------------
+
+void ConvertToInt16_AVX2(int16_t *ptr_dst,
+                         const float *ptr_src,
+                         uint32_t num_elements,
+                         float scale_factor);
+
+/**
+ * @brief Quantizes num_frames frames of num_vector_elements and rotates them into the interleaved layout:
+ * ptr_dst[j * num_group + i] = quantized ptr_src[i * num_vector_elements + j]. The padding is left to the caller.
+ */
+void ConvertToInt16Interleaved_AVX2(int16_t *ptr_dst,
+                                    const float *ptr_src,
+                                    uint32_t num_frames,
+                                    uint32_t num_group,
+                                    uint32_t num_vector_elements,
+                                    float scale_factor);
+
+void ConvertToFloat_AVX2(float *ptr_dst,
+                         const int32_t *ptr_src,
+                         uint32_t num_elements,
+                         float scale_factor);
+
+}  // namespace GNAPluginNS
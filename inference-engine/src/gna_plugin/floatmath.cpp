@@ -7,7 +7,27 @@
 #include "floatmath.h"
 #include "pwl.h"
 #include "gna_plugin_log.hpp"
+#include "ie_parallel.hpp"
 #include <cmath>
+#include <algorithm>
+
+// columns of C updated together by one pass over the rows of B, so the partial sums stay in the cache
+#define SGEMM_BLOCK_COLUMNS 256
+
+// C row += A row * B, the products are accumulated in the same order as the reference dot product
+// but the inner loop runs over contiguous columns and is vectorized by the compiler
+static inline void sgemm_row(const float *A_row, const float *B, int ldb, float *C_row, int N, int K) {
+    for (int j0 = 0; j0 < N; j0 += SGEMM_BLOCK_COLUMNS) {
+        int j1 = std::min(N, j0 + SGEMM_BLOCK_COLUMNS);
+        for (int k = 0; k < K; k++) {
+            const float a = A_row[k];
+            const float *B_row = B + k * ldb;
+            for (int j = j0; j < j1; j++) {
+                C_row[j] += a * B_row[j];
+            }
+        }
+    }
+}
 
 
 void CNNFilter32(intel_dnn_component_t *component) {
@@ -26,17 +46,18 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad problem dimensions in CNNFilter32!";
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
+    uint32_t num_filters = component->op.conv1D.num_filters;
+    InferenceEngine::parallel_for(num_filter_outputs, [&](uint32_t j) {
         float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
+        for (uint32_t i = 0; i < num_filters; i++) {
             float *ptr_coef = ptr_filters + i * num_filter_coefficients;
             float sum = ptr_biases[i];
             for (uint32_t k = 0; k < num_filter_coefficients; k++) {
                 sum += ptr_in[k] * ptr_coef[k];
             }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+            ptr_outputs[j * num_filters + i] = sum;
         }
-    }
+    });
 }
 
 void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number_type) {
@@ -278,26 +299,24 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
+        InferenceEngine::parallel_for(M, [&](int i) {
+            float *C_row = C + i * ldc;
+            if (beta != 1.0) {
+                std::fill(C_row, C_row + N, 0.0f);
             }
-        }
+            sgemm_row(A + i * lda, B, ldb, C_row, N, K);
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
+        InferenceEngine::parallel_for(M, [&](int i) {
+            for (int j = 0; j < N; j++) {
                 float sum;
                 sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
+                for (int k = 0; k < K; k++) {
                     sum += alpha * A[i * lda + k] * B[j * ldb + k];
                 }
                 C[i * ldc + j] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -356,16 +375,13 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
+        InferenceEngine::parallel_for(L, [&](int l) {
+            float *C_row = C + l * ldc;
+            if (beta != 1.0) {
+                std::fill(C_row, C_row + N, 0.0f);
             }
-        }
+            sgemm_row(A + OutputList[l] * lda, B, ldb, C_row, N, K);
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -406,18 +422,17 @@ void sgemv_split(const uint32_t N,
                  float *C) {
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
 
-    for (i = 0; i < num_rows; i++) {
+    InferenceEngine::parallel_for(num_rows, [&](uint32_t i) {
         float sum = B[i];
-        for (j = 0; j < K1; j++) {
+        for (uint32_t j = 0; j < K1; j++) {
             sum += A1[j] * X[i * num_columns + j];
         }
-        for (j = K1; j < num_columns; j++) {
+        for (uint32_t j = K1; j < num_columns; j++) {
             sum += A2[j - K1] * X[i * num_columns + j];
         }
         C[i] = sum;
-    }
+    });
 }
 
 #ifdef __cplusplus
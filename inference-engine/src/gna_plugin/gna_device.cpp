@@ -15,6 +15,8 @@
 #include "gna_plugin_log.hpp"
 #include "gna/gna_config.hpp"
 
+constexpr size_t GNADeviceHelper::LATENCY_BUCKETS;
+
 uint8_t* GNADeviceHelper::alloc(uint32_t size_requested, uint32_t *size_granted) {
     return reinterpret_cast<uint8_t *>(GNAAlloc(nGNAHandle, size_requested, size_granted));
 }
@@ -32,6 +34,8 @@ uint32_t GNADeviceHelper::propagate(const intel_nnet_type_t *pNeuralNetwork,
     nGNAStatus = GNAPropagateForward(nGNAHandle, pNeuralNetwork,
                                      pActiveIndices, nActiveIndices, &reqId, nGNAProcType);
     checkStatus();
+    std::lock_guard<std::mutex> lock(submitTimesMutex);
+    submitTimes[reqId] = std::chrono::steady_clock::now();
     return reqId;
 }
 
@@ -43,6 +47,42 @@ void GNADeviceHelper::wait(uint32_t reqId) {
         nGNAStatus = GNAWait(nGNAHandle, 1000000, reqId);
     }
     checkStatus();
+    updateLatencyHistogram(reqId);
+}
+
+void GNADeviceHelper::updateLatencyHistogram(uint32_t reqId) {
+    std::chrono::steady_clock::time_point submitTime;
+    {
+        std::lock_guard<std::mutex> lock(submitTimesMutex);
+        auto submitted = submitTimes.find(reqId);
+        if (submitted == submitTimes.end()) {
+            return;
+        }
+        submitTime = submitted->second;
+        submitTimes.erase(submitted);
+    }
+    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - submitTime).count();
+    size_t bucket = 0;
+    while (bucket + 1 < LATENCY_BUCKETS && latency >= (static_cast<int64_t>(2) << bucket)) {
+        bucket++;
+    }
+    latencyHistogram[bucket]++;
+}
+
+void GNADeviceHelper::getLatencyCounters(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& retPerfCounters) const {
+    InferenceEngine::InferenceEngineProfileInfo info;
+    info.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
+    info.cpu_uSec = 0;
+    std::strncpy(info.layer_type, "LatencyHistogram", sizeof(info.layer_type) - 1);
+
+    // the number of requests is kept as the execution index, the real time holds the lower bound of the bucket
+    for (size_t i = 0; i != LATENCY_BUCKETS; i++) {
+        info.realTime_uSec = (i == 0) ? 0 : (static_cast<int64_t>(1) << i);
+        info.execution_index = static_cast<unsigned>(latencyHistogram[i]);
+        std::string bucket = (i + 1 == LATENCY_BUCKETS) ? ">= " + std::to_string(info.realTime_uSec) + " us" :
+                                                        "< " + std::to_string(static_cast<int64_t>(2) << i) + " us";
+        retPerfCounters["2." + std::string(i < 10 ? "0" : "") + std::to_string(i) + " Device latency " + bucket] = info;
+    }
 }
 
 GNADeviceHelper::DumpResult GNADeviceHelper::dumpXnn(const intel_nnet_type_t *pNeuralNetwork,
@@ -11,6 +11,10 @@
 #include <string>
 #include <map>
 #include <thread>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 
 /**
  * holds gna - style handle in RAII way
@@ -24,6 +28,17 @@ class GNADeviceHelper {
     const uint32_t GNA_TIMEOUT = MAX_TIMEOUT;
     bool isPerformanceMeasuring;
 
+ public:
+    /**
+     * bucket i counts the requests with device latency in [2^i, 2^(i+1)) microseconds, the last one counts all the longer
+     */
+    static constexpr size_t LATENCY_BUCKETS = 20;
+
+ private:
+    std::array<std::atomic<uint64_t>, LATENCY_BUCKETS> latencyHistogram;
+    std::map<uint32_t, std::chrono::steady_clock::time_point> submitTimes;
+    std::mutex submitTimesMutex;
+
  public:
     explicit GNADeviceHelper(intel_gna_proc_t proc_type = GNA_AUTO,
                             uint8_t lib_async_n_threads = 1,
@@ -32,6 +47,9 @@ class GNADeviceHelper {
                                     nGNAProcType(proc_type),
                                     isPerformanceMeasuring(isPerformanceMeasuring) {
         initGnaPerfCounters();
+        for (auto && bucket : latencyHistogram) {
+            bucket = 0;
+        }
         open(lib_async_n_threads);
 
         if (use_openmp) {
@@ -73,6 +91,11 @@ class GNADeviceHelper {
     void updateGnaPerfCounters();
     void getGnaPerfCounters(std::map<std::string,
                         InferenceEngine::InferenceEngineProfileInfo>& retPerfCounters);
+    /**
+     * @brief reports always collected histogram of the time from submitting a request till its completion
+     */
+    void getLatencyCounters(std::map<std::string,
+                        InferenceEngine::InferenceEngineProfileInfo>& retPerfCounters) const;
 
  private:
     void open(uint8_t const n_threads);
@@ -83,6 +106,8 @@ class GNADeviceHelper {
 
     void setOMPThreads(uint8_t const n_threads);
 
+    void updateLatencyHistogram(uint32_t reqId);
+
     void initGnaPerfCounters() {
         nGNAPerfResults = {{0, 0, 0, 0, 0, 0, 0}, {0, 0}, {0, 0, 0}, {0, 0}};
         nGNAPerfResultsTotal = {{0, 0, 0, 0, 0, 0, 0}, {0, 0}, {0, 0, 0}, {0, 0}};
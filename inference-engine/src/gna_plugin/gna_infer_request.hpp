@@ -16,12 +16,15 @@ namespace GNAPluginNS {
 class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
     std::shared_ptr<GNAPlugin> plg;
     uint32_t inferRequestIdx = -1;
+    // the request slot the request always runs in, -1 to take any free one
+    int32_t requestSlot = -1;
 
  public:
     GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
                     InferenceEngine::InputsDataMap networkInputs,
                     InferenceEngine::OutputsDataMap networkOutputs)
-        : InferenceEngine::AsyncInferRequestInternal(networkInputs, networkOutputs), plg(plg) {
+        : InferenceEngine::AsyncInferRequestInternal(networkInputs, networkOutputs), plg(plg),
+          requestSlot(plg->AcquireRequestSlot()) {
         // TODO: internal connection API - better to generalize
         if (networkOutputs.empty()) {
             THROW_GNA_EXCEPTION << "GNAInferRequest :: network has zero outputs";
@@ -44,7 +47,7 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
     void InferImpl() override {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
-        plg->Infer(_inputs, _outputs);
+        plg->Wait(plg->QueueInference(_inputs, _outputs, requestSlot));
     }
 
     /**
@@ -64,7 +67,7 @@ class GNAInferRequest : public InferenceEngine::AsyncInferRequestInternal {
     void StartAsyncImpl() override {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
-        inferRequestIdx = plg->QueueInference(_inputs, _outputs);
+        inferRequestIdx = plg->QueueInference(_inputs, _outputs, requestSlot);
     }
 
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override {
@@ -163,6 +163,25 @@ class LayerInfo {
         IS_VALID();
         return InferenceEngine::details::CaselessEq<std::string>()(layer->type, "copy");
     }
+    bool isSoftMax() const noexcept {
+        IS_VALID();
+        return InferenceEngine::details::CaselessEq<std::string>()(layer->type, "softmax");
+    }
+    /**
+     * @brief layer is computed by the plugin on the host after the GNA model, so it can only be at the network output
+     */
+    bool isHostLayer() const noexcept {
+        return isSoftMax();
+    }
+    bool isNetworkOutput() const noexcept {
+        IS_VALID();
+        for (auto && outData : layer->outData) {
+            if (!outData->getInputTo().empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
     size_t paddingSize() const noexcept {
         static InferenceEngine::details::caseless_set<std::string> layersWithPossiblePadding = {"FullyConnected",
                                                                         "InnerProduct",
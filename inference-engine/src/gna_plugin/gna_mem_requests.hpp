@@ -39,6 +39,10 @@ struct MemRequest {
     size_t _offset;
     // expansion in bytes due to large depended layers
     size_t _padding = 0;
+    // execution order index of the layer which pushed the request
+    int _life_start = 0;
+    // buffer can share the space with other reusable buffers not alive at the same time
+    bool _reusable = false;
     MemRequest(rRegion region,
                 rType req,
                 void *ptr_out,
@@ -153,6 +157,26 @@ class GNAMemRequestsQueue {
      */
     void bind_ptr(void *source, const void *dest, size_t offset = 0, size_t num_bytes = 0)  {
         futureHeap().push_back({regionType(), REQUEST_BIND, source, dest, 1, num_bytes, 1, offset});
+        futureHeap().back()._life_start = _execution_order;
+    }
+
+    /**
+     * @brief reserves intermediate buffer, it is alive from the current execution order index
+     * till the index of the last request binded to it
+     * @param ptr_out
+     * @param num_bytes
+     */
+    void reserve_intermediate_ptr(void *ptr_out, size_t num_bytes)  {
+        futureHeap().push_back({regionType(), REQUEST_ALLOCATE, ptr_out, nullptr, 1, num_bytes});
+        futureHeap().back()._life_start = _execution_order;
+        futureHeap().back()._reusable = true;
+    }
+
+    /**
+     * @brief sets execution order index of the layer the next requests are pushed for
+     */
+    void set_execution_order(int order) {
+        _execution_order = order;
     }
     /**
      * @brief allocates buffer and set all its values to T value
@@ -168,6 +192,9 @@ class GNAMemRequestsQueue {
     virtual rRegion regionType() const = 0;
     virtual std::vector<MemRequest> & futureHeap()  = 0;
     virtual std::list<std::vector<char>> &localStorage() = 0;
+
+ protected:
+    int _execution_order = 0;
 };
 
 
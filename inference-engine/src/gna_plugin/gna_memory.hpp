@@ -9,6 +9,9 @@
 #include <list>
 #include <algorithm>
 #include <functional>
+#include <map>
+#include <cstdint>
+#include "memory_solver.hpp"
 
 /**
  * Pads memory size to given number of Bytes
@@ -42,6 +45,8 @@ class GNAMemory : public GNAMemRequestsQueue {
     Allocator _allocator;
     std::shared_ptr<uint8_t> heap;
     size_t _page_alignment = 1;
+    // offsets of reusable buffers in RW section by request index
+    std::map<size_t, size_t> _reused_offsets;
 
     class GNAMemRequestsReadOnlyQueue : public GNAMemRequestsQueue {
         std::reference_wrapper<GNAMemRequestsQueue> _that;
@@ -100,14 +105,16 @@ class GNAMemory : public GNAMemRequestsQueue {
         // allocation with memory setting to 0 internally
         heap = allocate(_total);
         auto setupOffsets = [&](std::function<bool(MemRequest & request)> filter, size_t offset) {
-            for (auto &re : _future_heap) {
+            for (size_t i = 0; i != _future_heap.size(); i++) {
+                auto &re = _future_heap[i];
                 if (re._type == REQUEST_BIND) continue;
                 if (filter(re)) continue;
 
                 auto sz = re._element_size * re._num_elements;
+                auto reused = _reused_offsets.find(i);
 
                 if (re._ptr_out != nullptr) {
-                    auto cptr = heap.get() + offset;
+                    auto cptr = heap.get() + (reused != _reused_offsets.end() ? reused->second : offset);
                     *reinterpret_cast<void **>(re._ptr_out) = cptr;
                     // std::cout << "ALLOCATED=" << cptr << ", size=" << re._element_size * re._num_elements << "\n";
                     iterate_binded(re, [](MemRequest & reference, MemRequest & binded) {
@@ -137,7 +144,9 @@ class GNAMemory : public GNAMemRequestsQueue {
                     }
                 }
 
-                offset += ALIGN(sz + re._padding, re._alignment);
+                if (reused == _reused_offsets.end()) {
+                    offset += ALIGN(sz + re._padding, re._alignment);
+                }
             }
         };
 
@@ -199,9 +208,12 @@ class GNAMemory : public GNAMemRequestsQueue {
  protected:
     void updateSectionsSizes() {
         // count total size and size of read/write regions
+        const size_t reuseAlignment = 64;
         _rw_section_size = 0;
         _ro_section_size = 0;
-        for (auto &re : _future_heap) {
+        std::vector<InferenceEngine::MemorySolver::Box> boxes;
+        for (size_t i = 0; i != _future_heap.size(); i++) {
+            auto &re = _future_heap[i];
             auto current = ALIGN(re._num_elements * re._element_size + re._padding, re._alignment);
 #ifdef GNA_HEAP_PROFILER
             std::cout << "chunk: " << " region: " << re._region << ", " <<
@@ -214,12 +226,37 @@ class GNAMemory : public GNAMemRequestsQueue {
 #endif
             if (re._type == REQUEST_BIND) continue;
 
+            if (re._region == REGION_RW && re._reusable) {
+                // buffer is alive while binded requests are used
+                int start = re._life_start;
+                int finish = re._life_start;
+                iterate_binded(re, [&](MemRequest & reference, MemRequest & binded) {
+                    start = std::min(start, binded._life_start);
+                    finish = std::max(finish, binded._life_start);
+                });
+                boxes.push_back({start, finish, ALIGN(current, reuseAlignment) / static_cast<int64_t>(reuseAlignment),
+                                 static_cast<int64_t>(i)});
+                continue;
+            }
+
             if (re._region == REGION_RW) {
                 _rw_section_size += current;
             } else {
                 _ro_section_size += current;
             }
         }
+
+        // reusable buffers are placed after other RW ones with respect to their live time
+        _reused_offsets.clear();
+        if (!boxes.empty()) {
+            size_t base = ALIGN(_rw_section_size, reuseAlignment);
+            InferenceEngine::MemorySolver solver(boxes);
+            _rw_section_size = base + static_cast<size_t>(solver.solve()) * reuseAlignment;
+            for (auto &box : boxes) {
+                _reused_offsets[static_cast<size_t>(box.id)] =
+                    base + static_cast<size_t>(solver.getOffset(static_cast<int>(box.id))) * reuseAlignment;
+            }
+        }
         _rw_section_size = ALIGN(_rw_section_size, _page_alignment);
         _ro_section_size = ALIGN(_ro_section_size, _page_alignment);
     }
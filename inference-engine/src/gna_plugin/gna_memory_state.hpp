@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <cpp_interfaces/impl/ie_memory_state_internal.hpp>
 #include "gna_plugin.hpp"
 
@@ -22,4 +23,18 @@ class GNAMemoryState : public InferenceEngine::MemoryStateInternal {
     }
 };
 
+/**
+ * @brief state of one of the streams packed into the batch in multi-stream mode
+ */
+class GNAStreamMemoryState : public InferenceEngine::MemoryStateInternal {
+    std::shared_ptr<GNAPlugin> plg;
+    uint32_t stream;
+ public:
+    GNAStreamMemoryState(std::shared_ptr<GNAPlugin> plg, uint32_t stream)
+        : InferenceEngine::MemoryStateInternal("GNAResetState_" + std::to_string(stream)), plg(plg), stream(stream) {}
+    void Reset() override {
+        plg->Reset(stream);
+    }
+};
+
 }  // namespace GNAPluginNS
\ No newline at end of file
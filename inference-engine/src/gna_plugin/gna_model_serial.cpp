@@ -4,6 +4,7 @@
 
 #include <vector>
 #include <array>
+#include <string>
 #include <details/ie_exception.hpp>
 #include <ios>
 #include <iomanip>
@@ -50,6 +51,9 @@ bool is_little_endian() {
 
 const int gna_header_magic = is_little_endian() ?  0x4d414e47 : 0x474e414d;
 
+// the gna memory region starts at the page aligned offset, so it can be mapped from the file
+const uint64_t gna_memory_alignment = 4096;
+
 ModelHeader GNAModelSerial::ReadHeader(std::istream &is) {
     is.exceptions(std::istream::failbit);
 
@@ -80,8 +84,9 @@ ModelHeader GNAModelSerial::ReadHeader(std::istream &is) {
     return header;
 }
 
-void GNAModelSerial::Import(void *basePointer, size_t gnaGraphSize,  std::istream & is) {
+void GNAModelSerial::Import(void *basePointer, const ModelHeader &header, std::istream & is) {
     is.exceptions(std::istream::failbit);
+    size_t gnaGraphSize = header.gnaMemSize;
 
     auto readPwl = [&is, basePointer] (intel_pwl_func_t & value) {
         readBits(value.nSegments, is);
@@ -179,6 +184,12 @@ void GNAModelSerial::Import(void *basePointer, size_t gnaGraphSize,  std::istrea
     }
 
 
+    if (header.version.major > 1 || header.version.minor >= 2) {
+        uint64_t padding = 0ull;
+        readBits(padding, is);
+        is.seekg(padding, std::ios_base::cur);
+    }
+
     // once structure has been read lets read whole gna graph
     is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
 }
@@ -315,6 +326,11 @@ void GNAModelSerial::Export(void * basePointer, size_t gnaGraphSize, std::ostrea
         writeBits(state.second, os);
     }
 
+    const uint64_t position = static_cast<uint64_t>(os.tellp()) + sizeof(uint64_t);
+    const uint64_t padding = (gna_memory_alignment - position % gna_memory_alignment) % gna_memory_alignment;
+    writeBits(padding, os);
+    os.write(std::string(padding, '\0').data(), padding);
+
     // once structure has been written lets push gna graph
     os.write(reinterpret_cast<char*>(basePointer), gnaGraphSize);
 }
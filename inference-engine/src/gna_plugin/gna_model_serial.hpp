@@ -15,10 +15,11 @@
  * version history
  * 1.0 - basic support
  * 1.1 - added memory information
+ * 1.2 - gna memory region is page aligned in the file
  */
 
 #define HEADER_MAJOR 1
-#define HEADER_MINOR 1
+#define HEADER_MINOR 2
 
 /**
  * @brief Header version 1.0
@@ -192,9 +193,10 @@ private:
      * buffers for pLayers, and pStructs are allocated here and required manual deallocation using mm_free
      * @param ptr_nnet
      * @param basePointer
-     * @param is - stream without header structure - TBD heder might be needed
+     * @param header - header returned by ReadHeader for this stream
+     * @param is - stream without header structure
      */
-    void Import(void *basePointer, size_t gnaGraphSize, std::istream &is);
+    void Import(void *basePointer, const ModelHeader &header, std::istream &is);
 
     /**
      * save gna graph to an outpus stream
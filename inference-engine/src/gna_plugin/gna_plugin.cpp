@@ -26,6 +26,7 @@ void ExportGnaNetworkAndrzej(const char *ptr_name, intel_nnet_type_t* pNeuralNet
 #include <vector>
 #include <malloc.h>
 #include <math.h>
+#include <cmath>
 #include <string.h>
 #include <list>
 #include <algorithm>
@@ -52,6 +53,11 @@ void ExportGnaNetworkAndrzej(const char *ptr_name, intel_nnet_type_t* pNeuralNet
 #include "gna_model_serial.hpp"
 #include "gna_memory_state.hpp"
 #include "details/ie_cnn_network_tools.h"
+#include "cpp_interfaces/ie_executor_manager.hpp"
+#include "cpu_detector.hpp"
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/gna_convert_avx2.hpp"
+#endif
 
 using namespace InferenceEngine;
 using namespace std;
@@ -72,6 +78,8 @@ using namespace InferenceEngine::details;
 
 
 #define PAGE_SIZE_BYTES 4096
+// maximal number of the streams packed into one GNA pass, it is the maximal GNA grouping
+#define GNA_MAX_STREAMS 8
 
 #define FROM_IR_DIM(mem, idx)\
 ((mem->dims.size() > idx - 1) ? mem->dims[idx - 1] : 1)
@@ -95,6 +103,12 @@ void GNAPluginNS::ConvertToInt16(int16_t *ptr_dst,
     if (!ptr_dst || !ptr_src) {
         return;
     }
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        ConvertToInt16_AVX2(ptr_dst, ptr_src, num_rows * num_columns, scale_factor);
+        return;
+    }
+#endif
     for (uint32_t i = 0; i < num_rows*num_columns; i++) {
         ptr_dst[i] = GNAPluginNS::ConvertFloatToInt16(ptr_src[i]*scale_factor);
     }
@@ -107,6 +121,12 @@ void GNAPluginNS::ConvertToFloat(float *ptr_dst,
     if (!ptr_dst || !ptr_src) {
         return;
     }
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        ConvertToFloat_AVX2(ptr_dst, ptr_src, num_rows * num_columns, scale_factor);
+        return;
+    }
+#endif
     for (uint32_t i = 0; i < num_rows; i++) {
         int32_t *ptr_int_row = ptr_src + i * num_columns;
         float *ptr_float_row = ptr_dst + i * num_columns;
@@ -116,6 +136,50 @@ void GNAPluginNS::ConvertToFloat(float *ptr_dst,
     }
 }
 
+namespace {
+
+template <typename T, typename U>
+void QuantizeVector(T *ptr_dst, const U *ptr_src, uint32_t num_elements, float scale_factor) {
+    for (uint32_t j = 0; j < num_elements; j++) {
+        ptr_dst[j] = GNAPluginNS::ConvertFloatToInt16(ptr_src[j] * scale_factor);
+    }
+}
+
+void QuantizeVector(int16_t *ptr_dst, const float *ptr_src, uint32_t num_elements, float scale_factor) {
+    GNAPluginNS::ConvertToInt16(ptr_dst, ptr_src, 1, num_elements, scale_factor);
+}
+
+template <typename T, typename U>
+void QuantizeInterleaved(T *dst,
+                         const U *src,
+                         uint32_t num_frames,
+                         uint32_t num_group,
+                         uint32_t num_vector_elements,
+                         float scale_factor) {
+    for (uint32_t i = 0; i < num_frames; i++) {
+        for (uint32_t j = 0; j < num_vector_elements; j++) {
+            dst[j * num_group + i] = GNAPluginNS::ConvertFloatToInt16(src[i * num_vector_elements + j] * scale_factor);
+        }
+    }
+}
+
+void QuantizeInterleaved(int16_t *dst,
+                         const float *src,
+                         uint32_t num_frames,
+                         uint32_t num_group,
+                         uint32_t num_vector_elements,
+                         float scale_factor) {
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        ConvertToInt16Interleaved_AVX2(dst, src, num_frames, num_group, num_vector_elements, scale_factor);
+        return;
+    }
+#endif
+    QuantizeInterleaved<int16_t, float>(dst, src, num_frames, num_group, num_vector_elements, scale_factor);
+}
+
+}  // namespace
+
 template <typename T, typename U>
 void GNAPlugin::copyInputData(T *dst,
                 const U *src,
@@ -128,14 +192,16 @@ void GNAPlugin::copyInputData(T *dst,
         return;
     }
     if (orientation == kDnnInterleavedOrientation) {
-        for (uint32_t i = 0; i < num_frames; i++) {
-            for (uint32_t j = 0; j < num_vector_elements; j++) {
-                if (!std::is_same<T, U>::value) {
-                    dst[j * num_group + i] = GNAPluginNS::ConvertFloatToInt16(src[i * num_vector_elements + j] * get_input_scale_factor());
-                } else {
+        if (!std::is_same<T, U>::value) {
+            QuantizeInterleaved(dst, src, num_frames, num_group, num_vector_elements, get_input_scale_factor());
+        } else {
+            for (uint32_t i = 0; i < num_frames; i++) {
+                for (uint32_t j = 0; j < num_vector_elements; j++) {
                     dst[j * num_group + i] = src[i * num_vector_elements + j];
                 }
             }
+        }
+        for (uint32_t i = 0; i < num_frames; i++) {
             // pad to meet weight matrix row length requirement
             for (uint32_t j = num_vector_elements; j < num_vector_stride; j++) {
                 dst[j * num_group + i] = 0;
@@ -153,9 +219,7 @@ void GNAPlugin::copyInputData(T *dst,
                 T *ptr_dst_vec = const_cast<T *>(reinterpret_cast<const T *>(dst) + i * num_vector_stride);
                 U *ptr_src_vec = const_cast<U *>(reinterpret_cast<const U *>(src) + i * num_vector_elements);
                 std::memset(ptr_dst_vec, 0, num_vector_stride * sizeof(T));
-                for (int j=0; j < num_vector_elements; j++) {
-                    ptr_dst_vec[j] = GNAPluginNS::ConvertFloatToInt16(ptr_src_vec[j] * get_input_scale_factor());
-                }
+                QuantizeVector(ptr_dst_vec, ptr_src_vec, num_vector_elements, get_input_scale_factor());
             }
 
         } else {
@@ -193,10 +257,12 @@ void GNAPlugin::copyInputDataWithSplit(T *const dst,
             // output layer with bind pointer as previous one. Skip
             continue;
         }
-        for (uint32_t i = begin; i < end; ++i) {
-            if (!std::is_same<T, U>::value) {
-                *(dst_ptr++) = GNAPluginNS::ConvertFloatToInt16(*(src_ptr++) * get_input_scale_factor());
-            } else {
+        if (!std::is_same<T, U>::value) {
+            QuantizeVector(dst_ptr, src_ptr, end - begin, get_input_scale_factor());
+            dst_ptr += end - begin;
+            src_ptr += end - begin;
+        } else {
+            for (uint32_t i = begin; i < end; ++i) {
                 *(dst_ptr++) = *(src_ptr++);
             }
         }
@@ -445,6 +511,12 @@ void GNAPlugin::ConvolutionPrimitive(InferenceEngine::CNNLayerPtr layer) {
     auto inputs = layer->insData.begin()->lock();
     auto outputs = *layer->outData.begin();
 
+    // the filter moves by whole rows of the feature maps, so the kernel is made of the stride sized rows
+    if (convolution._stride_x == 0 || convolution._kernel_x % convolution._stride_x != 0) {
+        THROW_GNA_EXCEPTION << "Layer :" << layer->name << " kernel " << convolution._kernel_x
+                            << " is not a multiple of stride " << convolution._stride_x;
+    }
+
     uint32_t num_feature_map_rows = FROM_IR_DIM(inputs, 1) / convolution._stride_x;
     uint32_t num_feature_map_columns = FROM_IR_DIM(inputs, 3) * convolution._stride_x / num_feature_maps;
 
@@ -536,6 +608,21 @@ void GNAPlugin::ConvolutionPrimitive(InferenceEngine::CNNLayerPtr layer) {
         transposedWeights.insert(transposedWeights.end(), transposedPart.begin(), transposedPart.end());
     }
 
+    // average pooling that follows is fused as sum pooling, in the quantized modes its 1/kernel factor
+    // is accounted by the output scale factor of the pooling, in the float mode it is folded to the weights
+    float avgPoolingFactor = 1.0f;
+    auto outputLayers = outputs->getInputTo();
+    if (quantized == nullptr && outputLayers.size() == 1) {
+        auto pooling = dynamic_cast<PoolingLayer *>(outputLayers.begin()->second.get());
+        if (pooling != nullptr && pooling->_type == PoolingLayer::AVG && pooling->_kernel[X_AXIS] > 1) {
+            avgPoolingFactor = 1.0f / pooling->_kernel[X_AXIS];
+            auto floatWeights = reinterpret_cast<float *>(transposedWeights.data());
+            for (size_t i = 0; i < transposedWeights.size() / sizeof(float); i++) {
+                floatWeights[i] *= avgPoolingFactor;
+            }
+        }
+    }
+
     if (num_padding == 0) {
         gnamem->readonly().push_local_ptr(ptr_weights, transposedWeights.data(), convolution._weights->byteSize(), 64);
     } else {
@@ -554,7 +641,14 @@ void GNAPlugin::ConvolutionPrimitive(InferenceEngine::CNNLayerPtr layer) {
         }, 64);
     }
 
-    if (convolution._biases) {
+    if (convolution._biases && avgPoolingFactor != 1.0f) {
+        const float *biases = convolution._biases->cbuffer().as<const float *>();
+        std::vector<float> scaledBiases(biases, biases + convolution._biases->size());
+        for (auto &bias : scaledBiases) {
+            bias *= avgPoolingFactor;
+        }
+        gnamem->readonly().push_local_ptr(ptr_biases, scaledBiases.data(), convolution._biases->byteSize(), 64);
+    } else if (convolution._biases) {
         gnamem->readonly().push_ptr(ptr_biases,
                                     convolution._biases->cbuffer().as<const void *>(),
                                     convolution._biases->byteSize(),
@@ -663,15 +757,23 @@ void GNAPlugin::PoolingPrimitive(InferenceEngine::CNNLayerPtr layer) {
 #ifdef PLOT
     cout << "IR layer : " << std::left << std::setw(20) << layer->name << dnnComponentsForLayer.size() - 1 << "\n";
 #endif
+    bool sumPooling = false;
     switch (pooling._type) {
         case PoolingLayer::MAX: break;
-        // we are loosing precision here
         case PoolingLayer::AVG:
+            // fused to the convolution as sum pooling, the convolution takes care of the 1/kernel factor
+            if (!LayerInfo(CNNNetPrevLayer(layer)).isConvolution()) {
+                THROW_GNA_EXCEPTION << "Layer :" << layer->name << " average pooling is supported after convolution only";
+            }
+            sumPooling = true;
+            break;
         default:
-            // TODO: convert to SUMM pooling
             THROW_GNA_EXCEPTION << "Layer :" << layer->name << " not supported";
     }
 
+    // overlapped pooling windows move by the stride of the layer
+    auto poolingStep = pooling._stride[X_AXIS] != 0 ? pooling._stride[X_AXIS] : pooling._kernel[X_AXIS];
+
     dnn.InitMaxpoolComponent(currentComponent,
                             1,
                             num_columns_in * num_rows_in ,
@@ -680,9 +782,9 @@ void GNAPlugin::PoolingPrimitive(InferenceEngine::CNNLayerPtr layer) {
                             inputs->precision.size(),
                             outputs->precision.size(),
                             pooling._kernel[X_AXIS],
-                            pooling._kernel[X_AXIS],
+                            poolingStep,
                             num_columns_in,
-                            false,
+                            sumPooling,
                             quantized == nullptr ? 1 : quantized->_dst_quant.scale,
                             ptr_inputs,
                             ptr_outputs);
@@ -1126,6 +1228,36 @@ void GNAPlugin::FillWeightOfAligningFilter(InferenceEngine::CNNLayerPtr layer, v
     }, 64);
 }
 
+void GNAPlugin::HostPrimitive(InferenceEngine::CNNLayerPtr layer) {
+    LayerInfo layerInfo(layer);
+    if (!layerInfo.isNetworkOutput()) {
+        THROW_GNA_EXCEPTION << "Host layer " << layer->name << " is supported only at the network output";
+    }
+    if (layerInfo.isSoftMax() && layer->GetParamAsInt("axis", 1) != 1) {
+        THROW_GNA_EXCEPTION << "SoftMax layer " << layer->name << " is supported only over axis 1";
+    }
+    hostLayers.push_back(layer);
+}
+
+void GNAPlugin::ApplyHostLayers(float *ptr_data, uint32_t num_frames, uint32_t num_vector_elements) const {
+    for (auto && layer : hostLayers) {
+        if (LayerInfo(layer).isSoftMax()) {
+            for (uint32_t i = 0; i < num_frames; i++) {
+                float *ptr_frame = ptr_data + i * num_vector_elements;
+                float max_value = *std::max_element(ptr_frame, ptr_frame + num_vector_elements);
+                float sum = 0.0f;
+                for (uint32_t j = 0; j < num_vector_elements; j++) {
+                    ptr_frame[j] = std::exp(ptr_frame[j] - max_value);
+                    sum += ptr_frame[j];
+                }
+                for (uint32_t j = 0; j < num_vector_elements; j++) {
+                    ptr_frame[j] /= sum;
+                }
+            }
+        }
+    }
+}
+
 void GNAPlugin::AffineFilterPrimitive(InferenceEngine::CNNLayerPtr layer) {
     auto filterLayer = dynamic_cast<InferenceEngine::WeightableLayer *> (layer.get());
 
@@ -1313,7 +1445,8 @@ void GNAPlugin::PWLPrimitive(InferenceEngine::CNNLayerPtr layer) {
             PwlDesignOpt16(activation_type,
                            ptr_pwl_segments,
                            input_scale_factor,
-                           output_scale_factor);
+                           output_scale_factor,
+                           layer->GetParamAsFloat("pwl_max_error_percent", pwlMaxErrorPercent));
         }
         ptr_pwl_segments_target = reinterpret_cast<intel_pwl_segment_t *>(&ptr_pwl_segments_target);
     }
@@ -1405,6 +1538,7 @@ void GNAPlugin::CreateLayerPrimitive(CNNLayerPtr layer) {
         {{"Reshape"}, SKIP},  // TODO: handled not in GNA but rather in GNA plugin
         {{"Crop"}, CREATE(CropPrimitive)},
         {{"Copy"}, CREATE(CopyPrimitive)},
+        {{"SoftMax"}, CREATE(HostPrimitive)},  // computed on the host over the output of the GNA model
     };
     auto it = LayersBuilder::getStorage().find(layer->type);
     if (it != LayersBuilder::getStorage().end()) {
@@ -1440,7 +1574,8 @@ GNAPluginNS::GNAPlugin::LayerType GNAPlugin::LayerTypeFromStr(const std::string
         { "Permute" , Permute },
         { "Power" , Power},
         { "Memory" , Memory },
-        { "Crop" , Crop }
+        { "Crop" , Crop },
+        { "SoftMax" , SoftMax }
     };
     auto it = LayerNameToType.find(str);
     if (it != LayerNameToType.end())
@@ -1486,6 +1621,12 @@ bool GNAPlugin::AreLayersSupported(ICNNNetwork& network, std::string& errMessage
         return false;
     }
 
+    if (multi_stream && batch_size > GNA_MAX_STREAMS) {
+        errMessage = "The plugin supports at most " + to_string(GNA_MAX_STREAMS) + " streams, but batch size is " +
+                     to_string(batch_size) + "\n";
+        return false;
+    }
+
     bool check_result = true;
     InferenceEngine::details::UnorderedDFS(allLayers,
                                            secondLayers.begin()->second,
@@ -1494,7 +1635,14 @@ bool GNAPlugin::AreLayersSupported(ICNNNetwork& network, std::string& errMessage
                                                     errMessage = "Layer is unsupported by GNA: " + layer->name + ":" + layer->type + "\n";
                                                     check_result =  false;
                                                 }
-                                                if (batch_size != 1 && LayerInfo::isBatchSizeConstrained(layer->type)) {
+                                                if (LayerInfo(layer).isHostLayer() && !LayerInfo(layer).isNetworkOutput()) {
+                                                    errMessage = "Layer is supported by GNA only at the network output: " +
+                                                                 layer->name + ":" + layer->type + "\n";
+                                                    check_result =  false;
+                                                }
+                                                // in multi-stream mode memory layers keep separate state of every batch entry
+                                                bool is_stream_state = multi_stream && LayerInfo(layer).isMemory();
+                                                if (batch_size != 1 && LayerInfo::isBatchSizeConstrained(layer->type) && !is_stream_state) {
                                                     errMessage = "topology with layer: " + layer->name + ", type: " + layer->type +
                                                                  ", and batch size(" + to_string(batch_size) + ") != 1 not supported";
                                                     check_result =  false;
@@ -1515,6 +1663,12 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
         THROW_GNA_EXCEPTION << error.c_str();
     }
 
+    // the threads of the GNA library take a part of the process-wide limit
+    auto threadsLimit = ExecutorManager::getInstance()->getThreadsLimit();
+    if (threadsLimit > 0 && gna_lib_async_threads_num > threadsLimit) {
+        gna_lib_async_threads_num = static_cast<uint8_t>(threadsLimit);
+    }
+
     // network optimisation phases
     auto run_passes = [&] (CNNNetPtr network) {
         auto layers = CNNNetSortTopologically(*network.get());
@@ -1573,6 +1727,7 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
 
     supported.setDefaultDevice(TargetDevice::eGNA);
     auto newNet = supported.find_configuration(network).convert(network);
+    num_streams = multi_stream ? static_cast<uint32_t>(network.getBatchSize()) : 1;
 
 
 
@@ -1605,10 +1760,6 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
     // fill in extra storage with memory layers
     fillMemoryConnections(memoryPairs);
 
-    if (memory_connection.size() != 0) {
-        gna_lib_async_threads_num = 1;
-    }
-
     auto networkPrecision = newNet->getPrecision();
 
     if (!networkPrecision.is_float()) {
@@ -1647,8 +1798,11 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
     // TODO: solely gna_example convolution hack
     num_feature_maps = 1;
     for (auto layer = sortedNoMem.begin(); layer != sortedNoMem.end(); ++layer) {
+        gnamem->set_execution_order(static_cast<int>(std::distance(sortedNoMem.begin(), layer)));
         CreateLayerPrimitive(*layer);
     }
+    // requests made from now on keep intermediate buffers alive till the end
+    gnamem->set_execution_order(static_cast<int>(sortedNoMem.size()));
     DnnComponentsForLayer::iterator output_component = std::find_if(dnnComponentsForLayer.begin(),
                                                         dnnComponentsForLayer.end(),
                                                         [&](const std::pair<std::string, intel_dnn_component_t>& v)
@@ -1669,7 +1823,7 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
     // make room for active list
     gnamem->reserve_ptr(nullptr, ALIGN64(output_component->second.num_bytes_per_output * output_component->second.num_rows_out));
 
-    void *pParallelExecutionData  = nullptr;
+    pParallelExecutionData = nullptr;
 
     // reserving more bytes for intermidiate data in parallel case - TODO: this works incorrectly in compact mode at lest
     rwSegmentSize = gnamem->getRWBytes();
@@ -1707,15 +1861,8 @@ void GNAPlugin::LoadNetwork(ICNNNetwork &network) {
         dnn.InitGNAStruct(&std::get<0>(nnets.back())->obj);
 
         // relocate rw pointers to new offset
-        auto basePtr = reinterpret_cast<uint8_t*>(pParallelExecutionData) + rwSegmentSize * (i - 1);
-
-        auto relocate = [basePtr, this](void *& ptr_out, void * ptr_in) {
-            if (ptr_in == nullptr) {
-                ptr_out = nullptr;
-            } else {
-                auto offset = reinterpret_cast<uint8_t *>(ptr_in) - reinterpret_cast<uint8_t *>(gnamem->getBasePtr());
-                ptr_out = basePtr + offset;
-            }
+        auto relocate = [i, this](void *& ptr_out, void * ptr_in) {
+            ptr_out = GetSlotPtr(ptr_in, i);
         };
 
         for (auto &&input : ptr_inputs_global_storage) {
@@ -1840,10 +1987,38 @@ void RotateFeatures(uint8_t *ptr_feat,
     }
 }
 
-uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &result) {
-    auto freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
-        return std::get<1>(item) == -1;
-    });
+void *GNAPlugin::GetSlotPtr(void *ptr, uint32_t slot) const {
+    if (ptr == nullptr || slot == 0) {
+        return ptr;
+    }
+    auto basePtr = reinterpret_cast<uint8_t*>(pParallelExecutionData) + rwSegmentSize * (slot - 1);
+    auto offset = reinterpret_cast<uint8_t *>(ptr) - reinterpret_cast<uint8_t *>(gnamem->getBasePtr());
+    return basePtr + offset;
+}
+
+int32_t GNAPlugin::AcquireRequestSlot() {
+    // without the state any free slot serves the request
+    if (memory_connection.empty() || nnets.size() < 2) {
+        return -1;
+    }
+    // the requests beyond the number of slots share the slots and their state
+    return static_cast<int32_t>(boundRequestsNum++ % nnets.size());
+}
+
+uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &result, int32_t slot) {
+    auto freeNnet = std::end(nnets);
+    if (slot >= 0) {
+        if (static_cast<size_t>(slot) >= nnets.size()) {
+            THROW_GNA_EXCEPTION << "request slot " << slot << " is out of " << nnets.size() << " slots";
+        }
+        // the state of the slot is updated by its previous inference
+        Wait(static_cast<uint32_t>(slot));
+        freeNnet = std::next(std::begin(nnets), slot);
+    } else {
+        freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
+            return std::get<1>(item) == -1;
+        });
+    }
 
     if (freeNnet == nnets.end()) {
         if (memory_connection.size() != 0) {
@@ -2028,14 +2203,42 @@ void GNAPlugin::Wait(uint32_t idx) {
         }
 #endif
     }
+
+    if (!hostLayers.empty() && output.layout() == Layout::NC) {
+        ApplyHostLayers(output.buffer(), output.dims()[1], output.dims()[0]);
+    }
 }
 
 void GNAPlugin::Reset() {
-    for (auto && memLayer : memory_connection) {
-        std::memset(memLayer.second.gna_ptr, 0, memLayer.second.reserved_size);
+    for (uint32_t slot = 0; slot != std::max<size_t>(nnets.size(), 1); slot++) {
+        for (auto && memLayer : memory_connection) {
+            std::memset(GetSlotPtr(memLayer.second.gna_ptr, slot), 0, memLayer.second.reserved_size);
+        }
+        for (auto && concatLayer : concat_connection) {
+            std::memset(GetSlotPtr(concatLayer.second.gna_ptr, slot), 0, concatLayer.second.reserved_size);
+        }
     }
-    for (auto && concatLayer : concat_connection) {
-        std::memset(concatLayer.second.gna_ptr, 0, concatLayer.second.reserved_size);
+}
+
+void GNAPlugin::Reset(uint32_t stream) {
+    if (stream >= num_streams) {
+        THROW_GNA_EXCEPTION << "stream " << stream << " is out of " << num_streams << " streams";
+    }
+    // the streams are the columns of interleaved state buffers
+    size_t element_size = gnadevice ? sizeof(int16_t) : sizeof(float);
+    auto reset_stream = [&](void *ptr, size_t size) {
+        auto ptr_bytes = reinterpret_cast<uint8_t *>(ptr);
+        for (size_t offset = stream * element_size; offset + element_size <= size; offset += num_streams * element_size) {
+            std::memset(ptr_bytes + offset, 0, element_size);
+        }
+    };
+    for (uint32_t slot = 0; slot != std::max<size_t>(nnets.size(), 1); slot++) {
+        for (auto && memLayer : memory_connection) {
+            reset_stream(GetSlotPtr(memLayer.second.gna_ptr, slot), memLayer.second.reserved_size);
+        }
+        for (auto && concatLayer : concat_connection) {
+            reset_stream(GetSlotPtr(concatLayer.second.gna_ptr, slot), concatLayer.second.reserved_size);
+        }
     }
 }
 
@@ -2081,6 +2284,14 @@ std::vector<InferenceEngine::MemoryStateInternal::Ptr>  GNAPlugin::QueryState()
         return {};
     }
 
+    if (num_streams > 1) {
+        std::vector<InferenceEngine::MemoryStateInternal::Ptr> states;
+        for (uint32_t stream = 0; stream != num_streams; stream++) {
+            states.push_back(std::make_shared<GNAStreamMemoryState>(shared_from_this(), stream));
+        }
+        return states;
+    }
+
     return {std::make_shared<GNAMemoryState>(shared_from_this())};
 }
 
@@ -2106,7 +2317,7 @@ InferenceEngine::IExecutableNetwork::Ptr GNAPlugin::ImportNetwork(const std::str
     std::get<0>(nnets.back())->obj.nGroup = header.nGroup;
     GNAModelSerial::MemoryType  mt;
     auto serial = GNAModelSerial(&std::get<0>(nnets.back())->obj, mt);
-    serial.Import(basePtr, header.gnaMemSize, inputStream);
+    serial.Import(basePtr, header, inputStream);
 
 
     get_ptr_inputs_global("input").push_back(reinterpret_cast<float*>(reinterpret_cast<uint8_t *> (basePtr) + header.input.descriptor_offset));
@@ -2169,6 +2380,10 @@ void GNAPlugin::Export(const std::string &fileName) {
         THROW_GNA_EXCEPTION << " exporting network with multiple inputs not supported";
     }
 
+    if (!hostLayers.empty()) {
+        THROW_GNA_EXCEPTION << " exporting network with host layers not supported";
+    }
+
     std::fstream outStream(fileName, ios_base::out | ios_base::binary);
 
     // TODO: nnet group parameter looks only used in application - so can we move this line into load network.
@@ -2199,6 +2414,9 @@ void GNAPlugin::GetPerformanceCounts(std::map<std::string, InferenceEngine::Infe
     if (performance_counting) {
         gnadevice->getGnaPerfCounters(perfMap);
     }
+    if (gnadevice) {
+        gnadevice->getLatencyCounters(perfMap);
+    }
 }
 
 void GNAPlugin::AddExtension(InferenceEngine::IExtensionPtr extension) {}
@@ -2212,6 +2430,8 @@ void GNAPlugin::SetConfig(const std::map<std::string, std::string> &config) {
         CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
         GNA_CONFIG_KEY(PRECISION),
         GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN),
+        GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT),
+        GNA_CONFIG_KEY(MULTI_STREAM),
         CONFIG_KEY(PERF_COUNT),
         GNA_CONFIG_KEY(LIB_N_THREADS),
         CONFIG_KEY(SINGLE_THREAD)
@@ -2303,6 +2523,17 @@ void GNAPlugin::SetConfig(const std::map<std::string, std::string> &config) {
         }
     });
 
+    if_set(GNA_CONFIG_KEY(MULTI_STREAM), [&] {
+        if (value == PluginConfigParams::YES) {
+            multi_stream = true;
+        } else if (value == PluginConfigParams::NO) {
+            multi_stream = false;
+        } else {
+            log << "GNA multi stream mode should be YES/NO, but not" << value;
+            THROW_GNA_EXCEPTION << "GNA multi stream mode should be YES/NO, but not" << value;
+        }
+    });
+
     if_set(CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS), [&] {
         if (value == PluginConfigParams::YES) {
             exclusive_async_requests  = true;
@@ -2336,6 +2567,15 @@ void GNAPlugin::SetConfig(const std::map<std::string, std::string> &config) {
         }
     });
 
+    if_set(GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT), [&] {
+        float max_error = std::stof(value);
+        if (max_error <= 0.0f || max_error > 100.0f) {
+            log << "GNA pwl max error percent should be greater than 0 and not greater than 100, but was: " << value;
+            THROW_GNA_EXCEPTION << "GNA pwl max error percent should be greater than 0 and not greater than 100, but was: " << value;
+        }
+        pwlMaxErrorPercent = max_error;
+    });
+
     if_set(CONFIG_KEY(PERF_COUNT), [&] {
         if (value == PluginConfigParams::YES) {
             performance_counting = true;
@@ -2400,7 +2640,8 @@ void GNAPlugin::QueryNetwork(const InferenceEngine::ICNNNetwork& network,
     InferenceEngine::details::UnorderedDFS(allLayers,
                                            secondLayers.begin()->second,
                                            [&](CNNLayerPtr const layer) {
-                                                if (GNAPluginNS::GNAPlugin::LayerTypeFromStr(layer->type) != NO_TYPE) {
+                                                if (GNAPluginNS::GNAPlugin::LayerTypeFromStr(layer->type) != NO_TYPE &&
+                                                    (!LayerInfo(layer).isHostLayer() || LayerInfo(layer).isNetworkOutput())) {
                                                     res.supportedLayers.insert(layer->name);
                                                 }
                                             }, false);
@@ -2508,7 +2749,11 @@ void GNAPlugin::connectOutput(InferenceEngine::CNNLayerPtr layer, void *ptr, voi
     }
     // cannot reuse suitable input
     if (unused_input == nullptr) {
-        gnamem->reserve_ptr(ptr, ALIGN64(num_data_bytes_out));
+        if (compact_mode) {
+            gnamem->reserve_intermediate_ptr(ptr, ALIGN64(num_data_bytes_out));
+        } else {
+            gnamem->reserve_ptr(ptr, ALIGN64(num_data_bytes_out));
+        }
     }
 }
 
@@ -84,8 +84,14 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
 
     bool use_dynamic_quantization = false;
     bool compact_mode = true;
+    bool multi_stream = false;
+    // independent streams packed into the batch, each has its own state in memory layers
+    uint32_t num_streams = 1;
     bool exclusive_async_requests = false;
     bool uniformPwlDesign = false;
+    // layers computed on the host over the de-quantized output of the GNA model, in order of execution
+    std::vector<InferenceEngine::CNNLayerPtr> hostLayers;
+    float pwlMaxErrorPercent = 1.0f;
     uint8_t gna_lib_async_threads_num = 1;
     bool gna_openmp_multithreading = false;
     // precision of GNA hardware model
@@ -120,6 +126,7 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
         Memory,
         Power,
         Crop,
+        SoftMax,
         NO_TYPE
     };
 
@@ -143,6 +150,10 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     void Infer(const InferenceEngine::Blob &input, InferenceEngine::Blob &result) override;
     void SetLogCallback(InferenceEngine::IErrorListener &listener) override {};
     void Reset();
+    /**
+     * @brief resets the state of one stream in multi-stream mode
+     */
+    void Reset(uint32_t stream);
     /**
      * @deprecated Use the version with config parameter
      */
@@ -151,7 +162,13 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     void QueryNetwork(const InferenceEngine::ICNNNetwork &network,
                       const std::map<std::string, std::string>& config,
                       InferenceEngine::QueryNetworkResult &res) const override;
-    uint32_t QueueInference(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result);
+    /**
+     * @brief Gives an infer request its own request slot (input, output and state buffers) for the networks with memory
+     * layers, so every request carries its own state, for example one channel of a multi-channel stream
+     * @return the slot index, or -1 if the request takes any free slot on every inference
+     */
+    int32_t AcquireRequestSlot();
+    uint32_t QueueInference(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result, int32_t slot = -1);
     void Wait(uint32_t idx = 0);
 
     /**
@@ -202,6 +219,7 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
     void CreateLayerPrimitive(InferenceEngine::CNNLayerPtr);
     void AffinePrimitive(InferenceEngine::CNNLayerPtr, bool isDiag = false);
     void AffineFilterPrimitive(InferenceEngine::CNNLayerPtr);
+    void HostPrimitive(InferenceEngine::CNNLayerPtr);
     void DiagonalPrimitive(InferenceEngine::CNNLayerPtr);
     void ConvolutionPrimitive(InferenceEngine::CNNLayerPtr);
     void PermutePrimitive(InferenceEngine::CNNLayerPtr);
@@ -370,6 +388,15 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
      * @brief size of RW segment without extra memory for parallel execution
      */
     uint32_t rwSegmentSize = 0;
+    /**
+     * @brief copies of RW segment for the request slots after the first one
+     */
+    void *pParallelExecutionData = nullptr;
+    uint32_t boundRequestsNum = 0;
+    /**
+     * @brief translates the pointer into RW segment of the first request slot to the same place in the given slot
+     */
+    void *GetSlotPtr(void *ptr, uint32_t slot) const;
     std::unique_ptr<gna_memory_type> gnamem;
 
     /**
@@ -425,6 +452,11 @@ class GNAPlugin : public InferenceEngine::IInferencePluginInternal, public std::
                      uint32_t num_vector_elements,
                      uint32_t num_vector_stride);
 
+    /**
+     * @brief computes host layers in place over de-quantized output frames
+     */
+    void ApplyHostLayers(float *ptr_data, uint32_t num_frames, uint32_t num_vector_elements) const;
+
     void ExportScores(void *ptr_dst,
                      void *ptr_src,
                      intel_dnn_orientation_t orientation,
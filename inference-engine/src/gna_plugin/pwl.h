@@ -64,7 +64,13 @@ void PwlDesign16(const DnnActivation activation_type,
                  const uint32_t num_segments,
                  const float scale_in,
                  const float scale_out);
+/**
+ * @brief designs the optimized PWL approximation, the designed segments of the function are kept in a process-wide cache
+ * since they depend only on the function and the allowed error, while the scale factors are applied afterwards
+ * @param allowed_err_pct - maximal error of the approximation in percent of the function range
+ */
 void PwlDesignOpt16(const DnnActivation activation_type,
                 std::vector<intel_pwl_segment_t> &ptr_segment,
                 const float scale_in,
-                const float scale_out);
+                const float scale_out,
+                const float allowed_err_pct = PWL_MAX_ERR_PERCENT);
@@ -9,6 +9,9 @@
 #include <vector>
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 #define FLOAT_TO_INT16(a) static_cast<int16_t>(((a) < 0)?((a) - 0.5):((a) + 0.5))
 #define FLOAT_TO_INT32(a) static_cast<int32_t>(((a) < 0)?((a)-0.5):((a)+0.5))
@@ -304,6 +307,33 @@ std::vector<pwl_t> pwl_search(const DnnActivationType fun,
     return(pwl);
 }
 
+std::vector<pwl_t> cached_pwl_search(const DnnActivationType fun,
+                                     const double l_bound,
+                                     const double u_bound,
+                                     const double allowed_err_pct) {
+    using pwl_key_t = std::tuple<DnnActivationType, double, double, double>;
+    static std::map<pwl_key_t, std::vector<pwl_t>> designed_pwls;
+    static std::mutex designed_pwls_mutex;
+
+    pwl_key_t key(fun, l_bound, u_bound, allowed_err_pct);
+    {
+        std::lock_guard<std::mutex> lock(designed_pwls_mutex);
+        auto designed = designed_pwls.find(key);
+        if (designed != designed_pwls.end()) {
+            return designed->second;
+        }
+    }
+
+    // search itself runs unlocked, a concurrent search of the same function gives the same result
+    double err_pct = 0.0;
+    auto pwl = pwl_search(fun, l_bound, u_bound, PWL_DESIGN_THRESHOLD, allowed_err_pct, PWL_DESIGN_SAMPLES, err_pct);
+    gnalog() << "PWL designed with " << pwl.size() << " segments, error " << err_pct << "%\n";
+
+    std::lock_guard<std::mutex> lock(designed_pwls_mutex);
+    designed_pwls.emplace(key, pwl);
+    return pwl;
+}
+
 pwl_gna_slope_scale_t gna_slope(const double slope,
                                 const double in_scale,
                                 const double out_scale) {
@@ -488,16 +518,16 @@ void make_gna_pwl(const DnnActivation  fun,
 void PwlDesignOpt16(const DnnActivation activation_type,
                     std::vector<intel_pwl_segment_t> &ptr_segment,
                     const float scale_in,
-                    const float scale_out) {
+                    const float scale_out,
+                    const float allowed_err_pct) {
     std::vector<pwl_t> pwl;
-    double err_pct = 0.0;
     switch (activation_type) {
         case kActSigmoid:
-            pwl = pwl_search(kActSigmoid, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = cached_pwl_search(kActSigmoid, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, allowed_err_pct);
             make_gna_pwl(activation_type, pwl, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, scale_in, scale_out, ptr_segment);
             break;
         case kActTanh:
-            pwl = pwl_search(kActTanh, -TANH_DOMAIN, TANH_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = cached_pwl_search(kActTanh, -TANH_DOMAIN, TANH_DOMAIN, allowed_err_pct);
             make_gna_pwl(activation_type, pwl, -TANH_DOMAIN, TANH_DOMAIN, scale_in, scale_out, ptr_segment);
             break;
         case kActRelu:
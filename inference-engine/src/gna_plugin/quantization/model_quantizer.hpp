@@ -4,6 +4,9 @@
 
 #pragma once
 #include <vector>
+#include <cmath>
+#include <algorithm>
+#include "ie_icnn_network_stats.hpp"
 #include "gna_plugin_config.hpp"
 #include "layer_transform.hpp"
 #include "graph_tools.hpp"
@@ -40,6 +43,12 @@ class ModelQuantizer {
         // another preprocessing
         cb(copiedNet);
 
+        // layers output ranges from the calibration statistics are used to fit scale factors into the target precision
+        InferenceEngine::ICNNNetworkStats* pstats = nullptr;
+        if (model.getStats(&pstats, nullptr) == InferenceEngine::StatusCode::OK && pstats && !pstats->isEmpty()) {
+            bindStatistics(*copiedNet, pstats->getNodesStats());
+        }
+
         LayersQuantizer<T> lc(scaleFactor);
         auto sortedNewNet = InferenceEngine::details::CNNNetSortTopologically(*copiedNet.get());
         gnalog() << "Sorted layers: " << std::endl;
@@ -59,6 +68,23 @@ class ModelQuantizer {
     }
 
  private :
+    void bindStatistics(InferenceEngine::ICNNNetwork &net, const InferenceEngine::NetworkStatsMap &stats) const {
+        for (auto && nodeStats : stats) {
+            InferenceEngine::CNNLayerPtr layer;
+            if (InferenceEngine::StatusCode::OK != net.getLayerByName(nodeStats.first.c_str(), layer, nullptr) || !nodeStats.second) {
+                continue;
+            }
+            float range = 0.0f;
+            for (auto && value : nodeStats.second->_minOutputs) {
+                range = std::max(range, std::abs(value));
+            }
+            for (auto && value : nodeStats.second->_maxOutputs) {
+                range = std::max(range, std::abs(value));
+            }
+            InferenceEngine::getInjectedData<QuantizedLayerParams>(layer)->_dst_range = range;
+        }
+    }
+
     void propagateScaleFactor(std::vector<InferenceEngine::CNNLayerPtr> & net, int weightsBytesSize, float scaleFactor) const {
         ScaleFactorCalculator sf(net, weightsBytesSize, scaleFactor);
 
@@ -19,6 +19,10 @@ struct QuantizedLayerParams {
     Quantization _bias_quant;
     float _o_shift = 0.0f;
     float _b_shift = 0.0f;
+    /**
+     * maximal absolute output value of the layer taken from the network statistics, 0 if there are no statistics
+     */
+    float _dst_range = 0.0f;
 };
 
 }  // namespace GNAPluginNS
\ No newline at end of file
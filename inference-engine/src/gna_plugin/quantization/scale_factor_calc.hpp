@@ -64,6 +64,10 @@ class ScaleFactorPerLayer<InferenceEngine::CNNLayer *> {
             // set the initial value
             float result = 1.0f;
             result = (layer.isIdentity()) ? identity_scale_factor : activation_scale_factor;
+            // calibrated output range allows to use the whole int16 output with the headroom of MAX_VAL_2B_FEAT
+            if (qunatizedParams->_dst_range > 0.0f) {
+                result = MAX_VAL_2B_FEAT / qunatizedParams->_dst_range;
+            }
             // if activation is one from relu family, we need to apply heuruistic to avoid activation output overflow
             if (layer.isRelu() &&
                     static_cast<uint64_t>(result * qunatizedParams->_src_quant.scale)
@@ -132,6 +136,12 @@ class ScaleFactorPerLayer<InferenceEngine::CNNLayer *> {
         quant->_dst_quant.scale = inputQuant->_dst_quant.scale;
         quant->_src_quant.scale = inputQuant->_dst_quant.scale;
 
+        // average pooling is computed as sum pooling, so the sum is the average with the kernel times bigger scale
+        auto pooling = dynamic_cast<InferenceEngine::PoolingLayer *>(cnnLayer);
+        if (pooling != nullptr && pooling->_type == InferenceEngine::PoolingLayer::AVG) {
+            quant->_dst_quant.scale *= pooling->_kernel[InferenceEngine::X_AXIS];
+        }
+
         if (layerInfo.isActivation()) {
             // todo: calculate proper scale factor where we need to expand it a bit to be safe to stay in int16 weights
             // set the initial value
@@ -324,7 +334,17 @@ class ScaleFactorPerLayer<InferenceEngine::WeightableLayer*> {
 
         double tmp_dst_quant_scale = quant->_weights_quant.scale * quantDataForInputLayer->_dst_quant.scale;
 
-        if (weightsSize == 1 &&
+        if (weightsSize == 1 && quant->_dst_range > 0.0f) {
+            // calibrated output range gives the exact weights scale reduction keeping the output in int32
+            double maxOutput = tmp_dst_quant_scale * quant->_dst_range;
+            if (maxOutput > std::numeric_limits<int32_t>::max() - 1) {
+                double reduction = (std::numeric_limits<int32_t>::max() - 1) / maxOutput;
+                gnalog() << "Output scale for " << wl->name << " is reduced by " << reduction
+                         << " to fit the calibrated output range " << quant->_dst_range << "\n";
+                quant->_weights_quant.scale *= reduction;
+                tmp_dst_quant_scale *= reduction;
+            }
+        } else if (weightsSize == 1 &&
             static_cast<uint64_t>(tmp_dst_quant_scale * quant->_src_quant.scale) >
                                                     static_cast<uint64_t>(std::numeric_limits<int32_t>::max()-1) * _scale_change_req_threshold) {
             gnawarn() << "Output scale for " << wl->name
@@ -17,13 +17,86 @@
 #include "fallback_policy.h"
 #include "hetero_device_loader.h"
 #include "details/ie_cnn_network_iterator.hpp"
+#include "details/caseless.hpp"
 #include "ie_layers.h"
 #include "ie_util_internal.hpp"
+#include "hetero/hetero_plugin_config.hpp"
 #include <fstream>
 #include <vector>
 #include <memory>
+#include <set>
+#include <string>
+#include <map>
+#include <algorithm>
 
 using namespace InferenceEngine;
+using namespace InferenceEngine::HeteroConfigParams;
+using namespace InferenceEngine::details;
+
+namespace {
+
+bool isInput(const CNNLayerPtr &layer) {
+    return CaselessEq<std::string>()(layer->type, "input");
+}
+
+size_t dataSize(const DataPtr &data) {
+    size_t size = 1;
+    for (auto dim : data->getTensorDesc().getDims()) {
+        size *= dim;
+    }
+    return size;
+}
+
+/**
+ * @brief Rough number of multiply-accumulate operations of the layer, the other layers cost one
+ * operation per an output element
+ */
+size_t layerCost(const CNNLayerPtr &layer) {
+    size_t outSize = 0;
+    for (auto &&out : layer->outData) {
+        outSize += dataSize(out);
+    }
+    if (layer->insData.empty() || layer->insData[0].lock() == nullptr) {
+        return outSize;
+    }
+    auto input = layer->insData[0].lock();
+    auto inDims = input->getTensorDesc().getDims();
+
+    if (auto conv = dynamic_cast<ConvolutionLayer *>(layer.get())) {
+        size_t kernel = 1;
+        for (size_t i = 0; i < conv->_kernel.size(); i++) {
+            kernel *= conv->_kernel[i];
+        }
+        size_t inChannels = inDims.size() > 1 ? inDims[1] : 1;
+        return outSize * kernel * inChannels / std::max(conv->_group, 1u);
+    }
+    if (dynamic_cast<FullyConnectedLayer *>(layer.get()) && !inDims.empty() && inDims[0] != 0) {
+        return outSize * (dataSize(input) / inDims[0]);
+    }
+    return outSize;
+}
+
+/**
+ * @brief Calls the function for every edge between the layer and the other non input layers
+ */
+template <class F>
+void forEachNeighbour(const CNNLayerPtr &layer, F f) {
+    for (auto &&in : layer->insData) {
+        auto data = in.lock();
+        if (!data) continue;
+        auto creator = data->getCreatorLayer().lock();
+        if (creator && !isInput(creator)) {
+            f(creator, dataSize(data));
+        }
+    }
+    for (auto &&out : layer->outData) {
+        for (auto &&to : out->getInputTo()) {
+            f(to.second, dataSize(out));
+        }
+    }
+}
+
+}  // namespace
 
 void dla_layer_colorer(const CNNLayerPtr layer,
                        ordered_properties &printed_properties,
@@ -95,6 +168,17 @@ void FallbackPolicy::setAffinity(const std::map<std::string, std::string>& confi
         i++;
     }
 
+    size_t minSubgraphSize = 1;
+    auto itMinSize = config.find(KEY_HETERO_MIN_SUBGRAPH_SIZE);
+    if (itMinSize != config.end()) {
+        try {
+            minSubgraphSize = std::stoul(itMinSize->second);
+        } catch (...) {
+            THROW_IE_EXCEPTION << "Wrong value " << itMinSize->second << " for " << KEY_HETERO_MIN_SUBGRAPH_SIZE;
+        }
+    }
+    mergeSubgraphs(queryResults, minSubgraphSize, network);
+
     if (_dumpDotFile) {
         std::stringstream stream(std::stringstream::out);
         stream << "hetero_affinity_" << network.getName() << ".dot";
@@ -103,3 +187,81 @@ void FallbackPolicy::setAffinity(const std::map<std::string, std::string>& confi
         saveGraphToDot(network, file, dla_layer_colorer);
     }
 }
+
+void FallbackPolicy::mergeSubgraphs(const std::map<std::string, QueryNetworkResult> &queryResults,
+                                    size_t minSubgraphSize, ICNNNetwork &network) {
+    if (_fallbackDevices.size() < 2) {
+        return;
+    }
+
+    std::vector<CNNLayerPtr> layers;
+    details::CNNNetworkIterator i(&network);
+    while (i != details::CNNNetworkIterator()) {
+        if (!isInput(*i) && !(*i)->affinity.empty()) {
+            layers.push_back(*i);
+        }
+        i++;
+    }
+
+    auto supports = [&](const std::string &device, const std::vector<CNNLayerPtr> &subgraph) {
+        auto &supported = queryResults.at(device).supportedLayers;
+        for (auto &&layer : subgraph) {
+            if (supported.find(layer->name) == supported.end()) return false;
+        }
+        return true;
+    };
+
+    // every move joins the subgraph with a neighbour, so the number of the moves is bounded by the number of layers
+    for (size_t iteration = 0; iteration < layers.size(); iteration++) {
+        bool moved = false;
+        std::set<std::string> visited;
+        for (auto &&start : layers) {
+            if (visited.count(start->name)) continue;
+
+            // collecting the connected layers with the same affinity
+            std::vector<CNNLayerPtr> subgraph = {start};
+            visited.insert(start->name);
+            for (size_t k = 0; k < subgraph.size(); k++) {
+                forEachNeighbour(subgraph[k], [&](const CNNLayerPtr &neighbour, size_t) {
+                    if (neighbour->affinity == start->affinity && !visited.count(neighbour->name)) {
+                        visited.insert(neighbour->name);
+                        subgraph.push_back(neighbour);
+                    }
+                });
+            }
+
+            size_t cost = 0;
+            size_t traffic = 0;
+            std::map<std::string, size_t> trafficToDevice;
+            for (auto &&layer : subgraph) {
+                cost += layerCost(layer);
+                forEachNeighbour(layer, [&](const CNNLayerPtr &neighbour, size_t size) {
+                    if (neighbour->affinity != start->affinity) {
+                        traffic += size;
+                        trafficToDevice[neighbour->affinity] += size;
+                    }
+                });
+            }
+            if (traffic == 0 || (subgraph.size() >= minSubgraphSize && traffic <= cost)) continue;
+
+            // the device which saves the most of the transfers, the priority order breaks the ties
+            std::string target;
+            size_t savedTraffic = 0;
+            for (auto &&device : _fallbackDevices) {
+                auto it = trafficToDevice.find(device);
+                if (it != trafficToDevice.end() && it->second > savedTraffic && supports(device, subgraph)) {
+                    target = device;
+                    savedTraffic = it->second;
+                }
+            }
+            if (target.empty()) continue;
+
+            for (auto &&layer : subgraph) {
+                layer->affinity = target;
+            }
+            moved = true;
+            break;
+        }
+        if (!moved) break;
+    }
+}
@@ -34,6 +34,13 @@ public:
     void setAffinity(const std::map<std::string, std::string>& config, ICNNNetwork& pNetwork);
 
 private:
+    /**
+     * @brief Moves the subgraphs which are too small or transfer more data than they compute
+     * to a neighbouring device that supports all their layers
+     */
+    void mergeSubgraphs(const std::map<std::string, QueryNetworkResult> &queryResults, size_t minSubgraphSize,
+                        ICNNNetwork &network);
+
     InferenceEngine::MapDeviceLoaders &_deviceLoaders;
     std::vector<std::string> _fallbackDevices;
     bool _dumpDotFile;
@@ -54,6 +54,11 @@ InferenceEngine::StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout
     return sts;
 }
 
+void HeteroAsyncInferRequest::SetPriority_ThreadUnsafe(int priority, int64_t millis_deadline) {
+    AsyncInferRequestThreadSafeDefault::SetPriority_ThreadUnsafe(priority, millis_deadline);
+    _heteroInferRequest->setPriority(priority, millis_deadline);
+}
+
 void HeteroAsyncInferRequest::SetCompletionCallback(IInferRequest::CompletionCallback callback) {
     AsyncInferRequestThreadSafeDefault::SetCompletionCallback(callback);
 
@@ -47,6 +47,8 @@ public:
 
     void SetCompletionCallback(InferenceEngine::IInferRequest::CompletionCallback callback) override;
 
+    void SetPriority_ThreadUnsafe(int priority, int64_t millis_deadline) override;
+
 private:
     HeteroInferRequest::Ptr _heteroInferRequest;
 };
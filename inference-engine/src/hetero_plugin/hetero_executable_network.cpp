@@ -18,6 +18,7 @@
 #include "hetero_async_infer_request.h"
 #include "ie_util_internal.hpp"
 #include "hetero_device_loader.h"
+#include "ie_network_cache.hpp"
 
 #include <array>
 #include <set>
@@ -25,6 +26,8 @@
 #include <unordered_map>
 #include <fstream>
 #include <algorithm>
+#include <mutex>
+#include <sstream>
 
 #include <ie_plugin_dispatcher.hpp>
 #include <ie_graph_splitter.hpp>
@@ -41,6 +44,64 @@ using namespace InferenceEngine::PluginConfigParams;
 using namespace InferenceEngine::HeteroConfigParams;
 
 namespace {
+/**
+ * The executable networks of the sub-networks are shared by the HETERO loads of the process: the same sub-network
+ * loaded by the same device loader with the same config is compiled once. The entries are weak, the sub-network is
+ * compiled again only after all the HETERO networks using it are released.
+ */
+class SubnetworksCache {
+public:
+    static std::string key(const ICNNNetwork &network, const std::string &device, const void *loader,
+                           const std::map<std::string, std::string> &config) {
+        std::stringstream owner;
+        owner << device << '@' << loader;
+        try {
+            return compiledNetworkCachePath("", network, owner.str(), config);
+        } catch (const details::InferenceEngineException &) {
+            // the network which cannot be serialized is not cached
+            return "";
+        }
+    }
+
+    static ExecutableNetwork::Ptr find(const std::string &key) {
+        if (key.empty())
+            return nullptr;
+        std::lock_guard<std::mutex> lock(mutex());
+        auto it = entries().find(key);
+        if (it == entries().end())
+            return nullptr;
+        auto network = it->second.lock();
+        if (!network)
+            entries().erase(it);
+        return network;
+    }
+
+    static void add(const std::string &key, const ExecutableNetwork::Ptr &network) {
+        if (key.empty())
+            return;
+        std::lock_guard<std::mutex> lock(mutex());
+        // the expired entries of the released networks are dropped on the way
+        for (auto it = entries().begin(); it != entries().end();) {
+            if (it->second.expired())
+                it = entries().erase(it);
+            else
+                ++it;
+        }
+        entries()[key] = network;
+    }
+
+private:
+    static std::mutex &mutex() {
+        static std::mutex instance;
+        return instance;
+    }
+
+    static std::map<std::string, std::weak_ptr<ExecutableNetwork>> &entries() {
+        static std::map<std::string, std::weak_ptr<ExecutableNetwork>> instance;
+        return instance;
+    }
+};
+
 std::vector<std::string> getAffinities(InferenceEngine::ICNNNetwork &network) {
     std::vector<std::string> ret;
     std::unordered_set<std::string> affinities;
@@ -352,13 +413,21 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
     }
 
     for (auto &&d : descs) {
-        IExecutableNetwork::Ptr ret;
-        ResponseDesc resp;
-        StatusCode status = d._deviceLoader->LoadNetwork(d._device, ret, *d._clonedNetwork, config, &resp);
-        if (status != OK) {
-            THROW_IE_EXCEPTION << resp.msg;
+        const std::string cacheKey = SubnetworksCache::key(*d._clonedNetwork, d._device, d._deviceLoader.get(), config);
+        d.network = SubnetworksCache::find(cacheKey);
+        if (!d.network) {
+            // the phases of the sub-network are reported by its own executable network
+            const std::string phase = "SubnetworkLoad." + d._device;
+            LoadPhaseScope loadPhase(phase.c_str());
+            IExecutableNetwork::Ptr ret;
+            ResponseDesc resp;
+            StatusCode status = d._deviceLoader->LoadNetwork(d._device, ret, *d._clonedNetwork, config, &resp);
+            if (status != OK) {
+                THROW_IE_EXCEPTION << resp.msg;
+            }
+            d.network = std::make_shared<ExecutableNetwork>(ret);
+            SubnetworksCache::add(cacheKey, d.network);
         }
-        d.network = std::make_shared<ExecutableNetwork>(ret);
         d._clonedNetwork = nullptr;
     }
 
@@ -389,6 +458,7 @@ void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncReques
     auto heteroInferRequest = std::dynamic_pointer_cast<HeteroInferRequest>(
             CreateInferRequestImpl(_networkInputs, _networkOutputs));
     heteroInferRequest->setPointerToExecutableNetworkInternal(shared_from_this());
+    heteroInferRequest->setMetricsRegistry(_metrics);
     auto asyncTreadSafeImpl = std::make_shared<HeteroAsyncInferRequest>(
             heteroInferRequest, _taskExecutor, _taskSynchronizer, _callbackExecutor);
     asyncRequest.reset(new InferRequestBase<HeteroAsyncInferRequest>(asyncTreadSafeImpl),
@@ -21,6 +21,9 @@
 #include <description_buffer.hpp>
 #include <debug.h>
 #include <ie_layouts.h>
+#include <blob_factory.hpp>
+#include <page_aligned_allocator.hpp>
+#include <details/ie_irelease.hpp>
 #include <assert.h>
 #include "ie_profiling.hpp"
 
@@ -55,7 +58,16 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
             if (_blobs.find(e) != _blobs.end()) {
                 r->SetBlob(e.c_str(), _blobs[e]);
             } else {
-                _blobs[e] = r->GetBlob(e.c_str());
+                // the producer writes the intermediate blob to the page aligned memory, so both the producer
+                // and the consumer can work on it directly instead of copying it to their internal memory
+                auto blob = r->GetBlob(e.c_str());
+                if (!PageAlignedAllocator::isAligned(blob->cbuffer().as<const void *>())) {
+                    blob = make_blob_with_precision(blob->getTensorDesc(),
+                                                    details::shared_from_irelease(new PageAlignedAllocator()));
+                    blob->allocate();
+                    r->SetBlob(e.c_str(), blob);
+                }
+                _blobs[e] = blob;
             }
         }
     });
@@ -88,6 +100,17 @@ void HeteroInferRequest::InferImpl() {
     }
 }
 
+void HeteroInferRequest::SetRoiBlobs(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois) {
+    InferRequestInternal::SetRoiBlobs(name, frame, rois);
+    // the sub-networks reading the input run the pre-processing, so the ROIs are set to their requests as is
+    for (auto &&desc : _inferRequests) {
+        if (desc._iNames.find(name) != desc._iNames.end()) {
+            desc._request->SetRoiBlobs(name, frame, rois);
+        }
+    }
+    _blobs[name] = frame;
+}
+
 void HeteroInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
     perfMap.clear();
     for (size_t i = 0; i < _inferRequests.size(); i++) {
@@ -138,7 +161,15 @@ void HeteroInferRequest::startFirstAsyncRequest() {
     firstAsyncRequest->StartAsync();
 }
 
+void HeteroInferRequest::setPriority(int priority, int64_t millis_deadline) {
+    for (auto &&desc : _inferRequests) {
+        // the deadline counts from the start of the whole pipeline, while the later subrequests start in the middle
+        desc._request->SetPriority(priority, &desc == &_inferRequests.front() ? millis_deadline : 0);
+    }
+}
+
 void HeteroInferRequest::setCallbackForLastRequest(std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)>& callback) {
+    _lastCallback = callback;
     auto lastRequest = _inferRequests.back()._request;
     if (lastRequest) lastRequest->SetCompletionCallback(callback);
 }
@@ -152,8 +183,15 @@ void HeteroInferRequest::setCallbackSequence() {
                     [=](InferRequest request, StatusCode sts) {
                         IE_PROFILING_AUTO_SCOPE(Callback)
                         if (sts == OK) {
-                            nextRequestDesc->_request->StartAsync();
+                            try {
+                                nextRequestDesc->_request->StartAsync();
+                                return;
+                            } catch (...) {
+                                sts = GENERAL_ERROR;
+                            }
                         }
+                        // the rest of the pipeline is not started, so report the failure as the completion
+                        if (_lastCallback) _lastCallback(request, sts);
                     });
         }
     }
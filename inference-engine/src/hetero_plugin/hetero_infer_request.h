@@ -53,6 +53,9 @@ public:
 
     void InferImpl() override;
 
+    void SetRoiBlobs(const char *name, const InferenceEngine::Blob::Ptr &frame,
+                     const std::vector<InferenceEngine::ROI> &rois) override;
+
     void
     GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 
@@ -64,6 +67,11 @@ public:
 
     InferenceEngine::StatusCode waitAllRequests(int64_t millis_timeout);
 
+    /**
+     * @brief Sets the priority of all the subrequests, the deadline is checked by the first one
+     */
+    void setPriority(int priority, int64_t millis_deadline);
+
     void setCallbackForLastRequest(std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)>& callback);
 
     bool isAnyRequestBusy();
@@ -71,6 +79,7 @@ public:
 private:
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
+    std::function<void(InferenceEngine::InferRequest, InferenceEngine::StatusCode)> _lastCallback;
 };
 
 }  // namespace HeteroPlugin
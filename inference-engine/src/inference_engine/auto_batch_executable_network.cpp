@@ -0,0 +1,167 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "ie_auto_batch.hpp"
+#include "auto_batch_executable_network.hpp"
+#include "ie_memcpy.h"
+#include "cpp_interfaces/base/ie_executable_network_base.hpp"
+#include "cpp_interfaces/base/ie_infer_async_request_base.hpp"
+
+namespace InferenceEngine {
+
+AutoBatchInferRequest::AutoBatchInferRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs,
+                                             AutoBatchExecutableNetwork &network)
+        : AsyncInferRequestForwardingInternal(networkInputs, networkOutputs), _network(network) {}
+
+void AutoBatchInferRequest::scheduleImpl() {
+    _network.enqueue(this);
+}
+
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(ExecutableNetwork network, size_t maxBatch,
+                                                       int64_t timeoutUSec)
+        : _network(network), _timeout(timeoutUSec) {
+    size_t networkBatch = 0;
+    for (auto &&input : _network.GetInputsInfo()) {
+        auto dims = input.second->getTensorDesc().getDims();
+        if (dims.empty() || (networkBatch != 0 && dims[0] != networkBatch)) {
+            THROW_IE_EXCEPTION << "Cannot batch the requests of the network with the input " << input.first;
+        }
+        networkBatch = dims[0];
+        dims[0] = 1;
+
+        auto &desc = input.second->getTensorDesc();
+        InputInfo::Ptr info(new InputInfo());
+        info->setInputData(std::make_shared<Data>(input.first, TensorDesc(desc.getPrecision(), dims, desc.getLayout())));
+        _networkInputs[input.first] = info;
+    }
+    for (auto &&output : _network.GetOutputsInfo()) {
+        auto dims = output.second->getTensorDesc().getDims();
+        if (dims.empty() || dims[0] != networkBatch) {
+            THROW_IE_EXCEPTION << "Cannot batch the requests of the network with the output " << output.first;
+        }
+        dims[0] = 1;
+
+        DataPtr data(new Data(*output.second));
+        data->reshape(dims, output.second->getTensorDesc().getLayout());
+        _networkOutputs[output.first] = data;
+    }
+
+    _maxBatch = maxBatch == 0 ? networkBatch : maxBatch;
+    if (_maxBatch > networkBatch) {
+        THROW_IE_EXCEPTION << "The maximal batch " << _maxBatch << " is more than the batch of the network "
+                           << networkBatch;
+    }
+    if (timeoutUSec < 0) {
+        THROW_IE_EXCEPTION << "Wrong timeout " << timeoutUSec;
+    }
+
+    _batchedRequest = _network.CreateInferRequest();
+    _thread = std::thread([this] { run(); });
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopped = true;
+    }
+    _queueCondVar.notify_all();
+    if (_thread.joinable()) _thread.join();
+}
+
+void AutoBatchExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
+    auto asyncRequestImpl = std::make_shared<AutoBatchInferRequest>(_networkInputs, _networkOutputs, *this);
+    asyncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    asyncRequestImpl->setMetricsRegistry(_metrics);
+    asyncRequest.reset(new InferRequestBase<AsyncInferRequestInternal>(asyncRequestImpl),
+                       [](IInferRequest *p) { p->Release(); });
+    asyncRequestImpl->SetPublicInterfacePtr(asyncRequest);
+}
+
+void AutoBatchExecutableNetwork::enqueue(AutoBatchInferRequest *request) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pending.emplace_back(request, std::chrono::steady_clock::now());
+    // the collecting thread waits either for the first request or for the full batch
+    if (_pending.size() == 1 || _pending.size() == _maxBatch) {
+        _queueCondVar.notify_one();
+    }
+}
+
+void AutoBatchExecutableNetwork::run() {
+    for (;;) {
+        std::vector<AutoBatchInferRequest *> batch;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _queueCondVar.wait(lock, [this] { return _isStopped || !_pending.empty(); });
+            if (_pending.empty()) break;
+            // the deadline is counted from the oldest request, which may wait since the previous batch
+            _queueCondVar.wait_until(lock, _pending.front().second + _timeout,
+                                     [this] { return _isStopped || _pending.size() >= _maxBatch; });
+
+            size_t batchSize = std::min(_pending.size(), _maxBatch);
+            for (size_t i = 0; i < batchSize; i++) {
+                batch.push_back(_pending.front().first);
+                _pending.pop_front();
+            }
+        }
+        inferBatch(batch);
+    }
+}
+
+void AutoBatchExecutableNetwork::inferBatch(const std::vector<AutoBatchInferRequest *> &batch) {
+    StatusCode status = OK;
+    try {
+        for (auto &&input : _networkInputs) {
+            auto batched = _batchedRequest.GetBlob(input.first);
+            auto dst = batched->buffer().as<uint8_t *>();
+            for (size_t i = 0; i < batch.size(); i++) {
+                auto &blob = batch[i]->getInputs().at(input.first);
+                ie_memcpy(dst + i * blob->byteSize(), batched->byteSize() - i * blob->byteSize(),
+                          blob->cbuffer().as<const uint8_t *>(), blob->byteSize());
+            }
+        }
+
+        if (_isDynamicBatch) {
+            try {
+                _batchedRequest.SetBatch(static_cast<int>(batch.size()));
+            } catch (const details::InferenceEngineException &) {
+                // the network is loaded without the dynamic batch, so the whole batch is inferred
+                _isDynamicBatch = false;
+            }
+        }
+        _batchedRequest.Infer();
+
+        for (auto &&output : _networkOutputs) {
+            auto batched = _batchedRequest.GetBlob(output.first);
+            auto src = batched->cbuffer().as<const uint8_t *>();
+            for (size_t i = 0; i < batch.size(); i++) {
+                auto &blob = batch[i]->getOutputs().at(output.first);
+                ie_memcpy(blob->buffer().as<uint8_t *>(), blob->byteSize(), src + i * blob->byteSize(),
+                          blob->byteSize());
+            }
+        }
+    } catch (const details::InferenceEngineException &) {
+        status = GENERAL_ERROR;
+    } catch (...) {
+        status = UNEXPECTED;
+    }
+
+    for (auto &&request : batch) {
+        request->complete(status);
+    }
+}
+
+ExecutableNetwork CreateAutoBatchExecutableNetwork(ExecutableNetwork network, size_t maxBatch, int64_t timeoutUSec) {
+    auto impl = std::make_shared<AutoBatchExecutableNetwork>(network, maxBatch, timeoutUSec);
+    IExecutableNetwork::Ptr executableNetwork(new ExecutableNetworkBase<ExecutableNetworkInternal>(impl),
+                                              [](details::IRelease *p) { p->Release(); });
+    return ExecutableNetwork(executableNetwork);
+}
+
+}  // namespace InferenceEngine
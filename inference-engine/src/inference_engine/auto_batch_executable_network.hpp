@@ -0,0 +1,82 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "cpp/ie_executable_network.hpp"
+#include "cpp_interfaces/impl/ie_executable_network_internal.hpp"
+#include "cpp_interfaces/impl/ie_infer_async_request_forwarding_internal.hpp"
+
+namespace InferenceEngine {
+
+class AutoBatchExecutableNetwork;
+
+/**
+ * @brief The request of batch 1, which is inferred as a part of the batch collected by AutoBatchExecutableNetwork
+ */
+class AutoBatchInferRequest : public AsyncInferRequestForwardingInternal {
+public:
+    typedef std::shared_ptr<AutoBatchInferRequest> Ptr;
+
+    AutoBatchInferRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs,
+                          AutoBatchExecutableNetwork &network);
+
+protected:
+    void scheduleImpl() override;
+
+private:
+    AutoBatchExecutableNetwork &_network;
+};
+
+/**
+ * @brief Collects the requests of batch 1 and infers them as one batch on a single request of the wrapped network
+ */
+class AutoBatchExecutableNetwork : public ExecutableNetworkInternal,
+                                   public std::enable_shared_from_this<AutoBatchExecutableNetwork> {
+public:
+    typedef std::shared_ptr<AutoBatchExecutableNetwork> Ptr;
+
+    AutoBatchExecutableNetwork(ExecutableNetwork network, size_t maxBatch, int64_t timeoutUSec);
+
+    ~AutoBatchExecutableNetwork();
+
+    void CreateInferRequest(IInferRequest::Ptr &asyncRequest) override;
+
+    /**
+     * @brief Adds the request to the batch being collected
+     */
+    void enqueue(AutoBatchInferRequest *request);
+
+    size_t getMaxBatch() const {
+        return _maxBatch;
+    }
+
+private:
+    void run();
+
+    void inferBatch(const std::vector<AutoBatchInferRequest *> &batch);
+
+    ExecutableNetwork _network;
+    InferRequest _batchedRequest;
+    size_t _maxBatch;
+    std::chrono::microseconds _timeout;
+    bool _isDynamicBatch = true;
+
+    std::mutex _mutex;
+    std::condition_variable _queueCondVar;
+    std::deque<std::pair<AutoBatchInferRequest *, std::chrono::steady_clock::time_point>> _pending;
+    bool _isStopped = false;
+    std::thread _thread;
+};
+
+}  // namespace InferenceEngine
@@ -4,19 +4,27 @@
 
 #include "cpu_detector.hpp"
 #include "blob_transform.hpp"
+#include "ie_parallel.hpp"
 #ifdef HAVE_SSE
 #include "blob_transform_sse42.hpp"
 #endif
+#ifdef HAVE_AVX2
+#include "blob_transform_avx2.hpp"
+#endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <vector>
 
 //----------------------------------------------------------------------
 
 namespace InferenceEngine {
 
+// The 3 channel NHWC <-> NCHW copies of U8 and FP32 done by the SSE4.2 split and merge, returns false when not applicable
 template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
+static bool blob_copy_4d_c3_t(Blob::Ptr src, Blob::Ptr dst) {
+#ifdef HAVE_SSE
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
 
     auto *src_ptr = src->buffer().as<data_t*>();
@@ -45,10 +53,8 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto C_dst_stride = dst_l == NHWC ? dst_strides[3] : dst_strides[1];
     const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
     const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
+    dst_ptr += dst_blk_desc.getOffsetPadding();
 
-    src_ptr += dst_blk_desc.getOffsetPadding();
-
-#ifdef HAVE_SSE
     if (src->layout() == NHWC && dst->layout() == NCHW && C == 3
         && C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 &&
         with_cpu_x86_sse42()) {
@@ -59,7 +65,7 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
                                     N_dst_stride, H_dst_stride, C_dst_stride,
                                     static_cast<int>(N), static_cast<int>(H),
                                     static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
@@ -69,7 +75,7 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
                                      N_dst_stride, H_dst_stride, C_dst_stride,
                                      static_cast<int>(N), static_cast<int>(H),
                                      static_cast<int>(W));
-            return;
+            return true;
         }
     }
 
@@ -83,7 +89,7 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
                                     N_dst_stride, H_dst_stride,
                                     static_cast<int>(N), static_cast<int>(H),
                                     static_cast<int>(W));
-            return;
+            return true;
         }
 
         if (PRC == Precision::FP32) {
@@ -93,64 +99,190 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
                                      N_dst_stride, H_dst_stride,
                                      static_cast<int>(N), static_cast<int>(H),
                                      static_cast<int>(W));
-            return;
+            return true;
         }
     }
 #endif  // HAVE_SSE
+    return false;
+}
+
+// the copies of fewer elements are not split between the threads
+static const size_t PARALLEL_COPY_SIZE = 32 * 1024;
+// the side of the square tiles of the transposing copy, so the source lines stay in the cache
+static const size_t TRANSPOSE_TILE = 32;
+
+// The element strides of the logical dims of a plain (not blocked) layout, false for the blocked ones
+static bool plain_strides(const TensorDesc &desc, SizeVector &strides) {
+    const auto &blk_desc = desc.getBlockingDesc();
+    const auto &order = blk_desc.getOrder();
+    if (order.size() != desc.getDims().size())
+        return false;
+
+    strides.assign(order.size(), 0);
+    for (size_t i = 0; i < order.size(); i++) {
+        strides[order[i]] = blk_desc.getStrides()[i];
+    }
+    return true;
+}
+
+// The logical dim with the smallest stride among the non trivial ones, or -1 if all the dims are 1
+static int innermost_dim(const SizeVector &dims, const SizeVector &strides) {
+    int inner = -1;
+    for (size_t d = 0; d < dims.size(); d++) {
+        if (dims[d] > 1 && (inner < 0 || strides[d] < strides[inner]))
+            inner = static_cast<int>(d);
+    }
+    return inner;
+}
+
+template <typename F>
+static void for_outer(size_t work, size_t elements, const F &func) {
+    if (elements < PARALLEL_COPY_SIZE) {
+        for (size_t i = 0; i < work; i++)
+            func(i);
+    } else {
+        parallel_for(work, func);
+    }
+}
 
-    if (src->layout() == NHWC && dst->layout() == NCHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t *dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t *src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t *src_ptr_l_l = src_ptr_l + h*H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
+template <typename data_t>
+static void transpose_2d(const data_t *src, data_t *dst, size_t src_stride, size_t dst_stride, size_t rows, size_t cols) {
+#ifdef HAVE_AVX2
+    if (sizeof(data_t) == sizeof(uint32_t) && with_cpu_x86_avx2()) {
+        blob_transpose_32_avx2(reinterpret_cast<const uint32_t*>(src), reinterpret_cast<uint32_t*>(dst),
+                               src_stride, dst_stride, rows, cols);
+        return;
+    }
+#endif
+    for (size_t r0 = 0; r0 < rows; r0 += TRANSPOSE_TILE) {
+        const size_t r1 = std::min(rows, r0 + TRANSPOSE_TILE);
+        for (size_t c0 = 0; c0 < cols; c0 += TRANSPOSE_TILE) {
+            const size_t c1 = std::min(cols, c0 + TRANSPOSE_TILE);
+            for (size_t c = c0; c < c1; c++) {
+                for (size_t r = r0; r < r1; r++) {
+                    dst[c * dst_stride + r] = src[r * src_stride + c];
                 }
             }
         }
-    } else if (src->layout() == NCHW && dst->layout() == NHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t *src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t *dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (int h = 0; h < H; h++) {
-                    data_t *src_ptr_l_l = src_ptr_l + h*H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
+    }
+}
+
+// The copy of the plain layouts of any rank: the rows along the innermost dim of the destination are copied
+// directly when it is the innermost dim of the source too, and transposed with the innermost dim of the source,
+// when it is not, for every index of the remaining (outer) dims
+template <typename data_t>
+static void blob_copy_plain_t(const data_t *src_ptr, data_t *dst_ptr, const SizeVector &dims,
+                              const SizeVector &src_strides, const SizeVector &dst_strides) {
+    const int dst_inner = innermost_dim(dims, dst_strides);
+    if (dst_inner < 0) {
+        *dst_ptr = *src_ptr;
+        return;
+    }
+    const int src_inner = innermost_dim(dims, src_strides);
+
+    std::vector<size_t> outer;
+    size_t work = 1;
+    for (size_t d = 0; d < dims.size(); d++) {
+        if (static_cast<int>(d) != dst_inner && static_cast<int>(d) != src_inner && dims[d] > 1) {
+            outer.push_back(d);
+            work *= dims[d];
+        }
+    }
+    const size_t elements = work * dims[dst_inner] * (src_inner != dst_inner ? dims[src_inner] : 1);
+
+    for_outer(work, elements, [&](size_t i) {
+        const data_t *src = src_ptr;
+        data_t *dst = dst_ptr;
+        for (size_t k = outer.size(); k-- > 0;) {
+            const size_t d = outer[k];
+            const size_t idx = i % dims[d];
+            i /= dims[d];
+            src += idx * src_strides[d];
+            dst += idx * dst_strides[d];
+        }
+
+        const size_t len = dims[dst_inner];
+        const size_t s_step = src_strides[dst_inner];
+        const size_t d_step = dst_strides[dst_inner];
+        if (src_inner == dst_inner) {
+            if (s_step == 1 && d_step == 1) {
+                std::copy(src, src + len, dst);
+            } else {
+                for (size_t j = 0; j < len; j++)
+                    dst[j * d_step] = src[j * s_step];
+            }
+        } else if (src_strides[src_inner] == 1 && d_step == 1) {
+            // the rows of the source matrix are along the destination inner dim
+            transpose_2d(src, dst, s_step, dst_strides[src_inner], len, dims[src_inner]);
+        } else {
+            for (size_t c = 0; c < dims[src_inner]; c++) {
+                for (size_t j = 0; j < len; j++)
+                    dst[j * d_step + c * dst_strides[src_inner]] = src[j * s_step + c * src_strides[src_inner]];
             }
         }
-    } else {
-        for (int i = 0; i < N*C*H*W; i++) {
-            dst_ptr[i] = src_ptr[i];
+    });
+}
+
+// The element by element copy of any layouts, including the blocked ones
+template <typename data_t>
+static void blob_copy_any_t(const data_t *src_ptr, data_t *dst_ptr, const TensorDesc &src_desc, const TensorDesc &dst_desc) {
+    const SizeVector &dims = src_desc.getDims();
+    const size_t inner = dims.back();
+    size_t work = 1;
+    for (size_t d = 0; d + 1 < dims.size(); d++)
+        work *= dims[d];
+
+    for_outer(work, work * inner, [&](size_t i) {
+        SizeVector index(dims.size(), 0);
+        for (size_t d = dims.size() - 1; d-- > 0;) {
+            index[d] = i % dims[d];
+            i /= dims[d];
+        }
+        for (size_t j = 0; j < inner; j++) {
+            index.back() = j;
+            dst_ptr[dst_desc.offset(index)] = src_ptr[src_desc.offset(index)];
         }
+    });
+}
+
+template <InferenceEngine::Precision::ePrecision PRC>
+static void blob_copy_t(Blob::Ptr src, Blob::Ptr dst) {
+    using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
+
+    const auto &src_desc = src->getTensorDesc();
+    const auto &dst_desc = dst->getTensorDesc();
+    if (src_desc.getDims().size() == 4 && blob_copy_4d_c3_t<PRC>(src, dst))
+        return;
+
+    const auto *src_ptr = src->buffer().as<const data_t*>();
+    auto *dst_ptr = dst->buffer().as<data_t*>();
+
+    SizeVector src_strides, dst_strides;
+    if (plain_strides(src_desc, src_strides) && plain_strides(dst_desc, dst_strides)) {
+        const SizeVector origin(src_desc.getDims().size(), 0);
+        blob_copy_plain_t(src_ptr + src_desc.offset(origin), dst_ptr + dst_desc.offset(origin),
+                          src_desc.getDims(), src_strides, dst_strides);
+    } else {
+        blob_copy_any_t(src_ptr, dst_ptr, src_desc, dst_desc);
     }
 }
 
-static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
+static inline void blob_copy_nd(Blob::Ptr src, Blob::Ptr dst) {
     switch (src->precision()) {
         case Precision::FP32:
         case Precision::I32:
-            blob_copy_4d_t<Precision::FP32>(src, dst);
+            blob_copy_t<Precision::FP32>(src, dst);
             break;
 
         case Precision::FP16:
         case Precision::U16:
         case Precision::I16:
-            blob_copy_4d_t<Precision::U16>(src, dst);
+            blob_copy_t<Precision::U16>(src, dst);
             break;
 
         case Precision::U8:
         case Precision::I8:
-            blob_copy_4d_t<Precision::U8>(src, dst);
+            blob_copy_t<Precision::U8>(src, dst);
             break;
 
         default:
@@ -172,10 +304,13 @@ void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
     if (src->dims() != dst->dims())
         THROW_IE_EXCEPTION << "Unimplemented blob transformation from different shapes ";
 
-    if (src->dims().size() == 4)
-        blob_copy_4d(src, dst);
-    else
-        THROW_IE_EXCEPTION << "Unimplemented blob transformation. Only 4d supported.";
+    if (src->getTensorDesc().getLayout() == ANY || dst->getTensorDesc().getLayout() == ANY)
+        THROW_IE_EXCEPTION << "Unimplemented blob transformation for ANY layout";
+
+    if (src->getTensorDesc().getDims().empty())
+        THROW_IE_EXCEPTION << "Unimplemented blob transformation of scalars";
+
+    blob_copy_nd(src, dst);
 }
 
 }  // namespace InferenceEngine
@@ -7,7 +7,10 @@
 
 #include <unordered_map>
 #include <unordered_set>
+#include <algorithm>
 #include <utility>
+#include <tuple>
+#include <set>
 #include <memory>
 #include <vector>
 #include <string>
@@ -41,20 +44,17 @@ Builder::Network::Network(const Context& ieContext, const std::string &name) {
 }
 
 Builder::Network::Network(const Context& ieContext, const INetwork &network): Network(ieContext, network.getName()) {
+    // every connection is reported by both of its layers
+    using ConnectionKey = std::tuple<idx_t, idx_t, idx_t, idx_t>;
+    std::set<ConnectionKey> added;
+    auto& layers = parameters["layers"].as<std::vector<Layer::Ptr>>();
+    auto& connections = parameters["connections"].as<std::vector<Connection>>();
     for (const auto& layer : network) {
-        parameters["layers"].as<std::vector<Layer::Ptr>>().push_back(std::make_shared<Layer>(layer));
-        const auto layerConnections = network.getLayerConnections(layer->getId());
-        for (const auto& connection : layerConnections) {
-            bool found = false;
-            for (const auto& con : parameters["connections"].as<std::vector<Connection>>()) {
-                if (con == connection) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                parameters["connections"].as<std::vector<Connection>>().push_back(connection);
-            }
+        layers.push_back(std::make_shared<Layer>(layer));
+        for (const auto& connection : network.getLayerConnections(layer->getId())) {
+            if (added.emplace(connection.from().layerId(), connection.from().portId(),
+                              connection.to().layerId(), connection.to().portId()).second)
+                connections.push_back(connection);
         }
     }
 }
@@ -262,9 +262,47 @@ const std::vector<Builder::Layer::Ptr>& Builder::Network::getLayers() const {
     return parameters.at("layers").as<std::vector<Layer::Ptr>>();
 }
 std::vector<Builder::Layer::Ptr>& Builder::Network::getLayers() {
+    validated = false;
     return parameters["layers"].as<std::vector<Layer::Ptr>>();
 }
 
+void Builder::Network::indexLayers() const {
+    const auto& layers = getLayers();
+    layersIndex.clear();
+    for (size_t i = 0; i < layers.size(); i++)
+        layersIndex[layers[i]->getId()] = i;
+}
+
+void Builder::Network::indexConnections() const {
+    const auto& connections = getConnections();
+    connectionsIndex.clear();
+    for (size_t i = 0; i < connections.size(); i++) {
+        connectionsIndex[connections[i].from().layerId()].push_back(i);
+        if (connections[i].to().layerId() != connections[i].from().layerId())
+            connectionsIndex[connections[i].to().layerId()].push_back(i);
+    }
+    indexedConnections = connections.size();
+}
+
+Builder::Layer::Ptr Builder::Network::findLayer(idx_t layerId) const {
+    const auto& layers = getLayers();
+    auto lookup = [&]() -> Layer::Ptr {
+        auto it = layersIndex.find(layerId);
+        if (it == layersIndex.end() || it->second >= layers.size() || layers[it->second]->getId() != layerId)
+            return nullptr;
+        return layers[it->second];
+    };
+    if (layersIndex.size() != layers.size())
+        indexLayers();
+    auto layer = lookup();
+    // the layers might be replaced through getLayers() since the index was built
+    if (!layer) {
+        indexLayers();
+        layer = lookup();
+    }
+    return layer;
+}
+
 idx_t Builder::Network::addLayer(const std::vector<PortInfo> &inputs,
                                  const Layer& layer) {
     auto layer_id = addLayer(layer);
@@ -275,20 +313,23 @@ idx_t Builder::Network::addLayer(const std::vector<PortInfo> &inputs,
 }
 
 idx_t Builder::Network::addLayer(const Layer& layer) {
+    auto& layers = getLayers();
+    if (layersIndex.size() != layers.size()) {
+        indexLayers();
+        firstFreeId = 0;
+    }
+    auto isTaken = [&](idx_t id) {
+        auto it = layersIndex.find(id);
+        return it != layersIndex.end() && it->second < layers.size() && layers[it->second]->getId() == id;
+    };
     auto getAvailableId = [&](idx_t defaultId) {
-        if (defaultId == (std::numeric_limits<idx_t>::max)())
-            defaultId = 0;
-
-        auto it = parameters["layers"].as<std::vector<Layer::Ptr>>().begin();
-        while (it != parameters["layers"].as<std::vector<Layer::Ptr>>().end()) {
-            for (it = parameters["layers"].as<std::vector<Layer::Ptr>>().begin();
-                    it != parameters["layers"].as<std::vector<Layer::Ptr>>().end(); it++) {
-                if ((*it)->getId() == defaultId) {
-                    defaultId++;
-                    break;
-                }
-            }
-        }
+        const bool autoId = defaultId == (std::numeric_limits<idx_t>::max)();
+        if (autoId)
+            defaultId = firstFreeId;
+        while (isTaken(defaultId))
+            defaultId++;
+        if (autoId)
+            firstFreeId = defaultId + 1;
         return defaultId;
     };
     auto generateAvailableName = [&](const std::string& name, idx_t id) {
@@ -299,7 +340,7 @@ idx_t Builder::Network::addLayer(const Layer& layer) {
         bool nameIsUnique(false);
         while (!nameIsUnique) {
             nameIsUnique = true;
-            for (const auto& layer : parameters["layers"].as<std::vector<Layer::Ptr>>()) {
+            for (const auto& layer : layers) {
                 if (generatedName == layer->getName()) {
                     nameIsUnique = false;
                     generatedName += "_" + idName;
@@ -310,8 +351,9 @@ idx_t Builder::Network::addLayer(const Layer& layer) {
     };
     idx_t generatedId = getAvailableId(layer.getId());
     const auto name = generateAvailableName(layer.getName(), generatedId);
-    parameters["layers"].as<std::vector<Layer::Ptr>>().emplace_back(std::make_shared<Layer>(generatedId, layer));
-    parameters["layers"].as<std::vector<Layer::Ptr>>()[parameters["layers"].as<std::vector<Layer::Ptr>>().size() - 1]->setName(name);
+    layers.emplace_back(std::make_shared<Layer>(generatedId, layer));
+    layers.back()->setName(name);
+    layersIndex[generatedId] = layers.size() - 1;
     return generatedId;
 }
 
@@ -380,7 +422,16 @@ void Builder::Network::connect(const PortInfo& input, const PortInfo& output) {
     if (!mergePortData())
         THROW_IE_EXCEPTION << "Cannot connect two ports with different data!";
 
-    parameters["connections"].as<std::vector<Connection>>().emplace_back(input, output);
+    auto& connections = parameters["connections"].as<std::vector<Connection>>();
+    const bool indexed = indexedConnections == connections.size();
+    connections.emplace_back(input, output);
+    validated = false;
+    if (indexed) {
+        connectionsIndex[input.layerId()].push_back(connections.size() - 1);
+        if (output.layerId() != input.layerId())
+            connectionsIndex[output.layerId()].push_back(connections.size() - 1);
+        indexedConnections = connections.size();
+    }
 }
 
 void Builder::Network::removeLayer(idx_t layerId) {
@@ -390,8 +441,13 @@ void Builder::Network::removeLayer(idx_t layerId) {
             break;
         }
     }
-    if (it != parameters["layers"].as<std::vector<Layer::Ptr>>().end())
+    if (it != parameters["layers"].as<std::vector<Layer::Ptr>>().end()) {
         parameters["layers"].as<std::vector<Layer::Ptr>>().erase(it);
+        // the positions of the next layers are shifted
+        layersIndex.clear();
+        firstFreeId = std::min(firstFreeId, layerId);
+        validated = false;
+    }
 }
 
 void Builder::Network::disconnect(const Connection& connection) {
@@ -400,8 +456,11 @@ void Builder::Network::disconnect(const Connection& connection) {
         if (connection == *it)
             break;
     }
-    if (it != parameters["connections"].as<std::vector<Connection>>().end())
+    if (it != parameters["connections"].as<std::vector<Connection>>().end()) {
         parameters["connections"].as<std::vector<Connection>>().erase(it);
+        indexedConnections = (std::numeric_limits<size_t>::max)();
+        validated = false;
+    }
 
     try {
         auto layer = getLayer(connection.to().layerId());
@@ -413,6 +472,7 @@ const INetwork::CPtr Builder::Network::build() {
     validate();
     InferenceEngine::Builder::Network::Ptr network =
             std::make_shared<InferenceEngine::Builder::Network>(static_cast<const INetwork&>(*this));
+    network->validated = true;
     return network;
 }
 
@@ -695,20 +755,18 @@ Builder::Network::operator const INetwork::CPtr() {
 
 const ILayer::CPtr Builder::Network::getLayer(idx_t layerId) const noexcept {
     try {
-        for (auto& layer : getLayers()) {
-            if (layer->getId() == layerId)
-                return layer->build();
-        }
+        auto layer = findLayer(layerId);
+        if (layer)
+            return validated ? std::static_pointer_cast<const ILayer>(layer) : layer->build();
     } catch(...) {}
 
     return nullptr;
 }
 
 Builder::Layer::Ptr Builder::Network::getLayer(idx_t layerId) {
-    for (auto& layer : getLayers()) {
-        if (layer->getId() == layerId)
-            return layer;
-    }
+    auto layer = findLayer(layerId);
+    if (layer)
+        return layer;
     THROW_IE_EXCEPTION << "Cannot find layer with id: " << layerId;
 }
 
@@ -760,7 +818,7 @@ const std::vector<ILayer::CPtr> Builder::Network::getInputs() const noexcept {
             }
         }
         if (isInputLayer) {
-            inputs.push_back(layer->build());
+            inputs.push_back(validated ? std::static_pointer_cast<const ILayer>(layer) : layer->build());
         }
     }
     return inputs;
@@ -794,7 +852,7 @@ const std::vector<ILayer::CPtr> Builder::Network::getOutputs() const noexcept {
             }
         }
         if (isOutputLayer) {
-            outputs.push_back(layer->build());
+            outputs.push_back(validated ? std::static_pointer_cast<const ILayer>(layer) : layer->build());
         }
     }
     return outputs;
@@ -823,9 +881,16 @@ const std::vector<Connection>& Builder::Network::getConnections() const {
 
 const std::vector<Connection> Builder::Network::getLayerConnections(idx_t layerId) const noexcept {
     std::vector<Connection> layerConnections;
-    for (const auto connection : parameters.at("connections").as<std::vector<Connection>>()) {
-        if (connection.from().layerId() == layerId || connection.to().layerId() == layerId)
-            layerConnections.push_back(connection);
-    }
+    try {
+        const auto& connections = getConnections();
+        if (indexedConnections != connections.size())
+            indexConnections();
+        auto it = connectionsIndex.find(layerId);
+        if (it == connectionsIndex.end())
+            return layerConnections;
+        layerConnections.reserve(it->second.size());
+        for (size_t i : it->second)
+            layerConnections.push_back(connections[i]);
+    } catch (...) {}
     return layerConnections;
 }
@@ -14,6 +14,7 @@
 #include "graph_tools.hpp"
 #include <vector>
 #include "network_serializer.h"
+#include "compact_ir.hpp"
 
 using namespace std;
 using namespace InferenceEngine;
@@ -227,7 +228,13 @@ CNNNetworkImpl::AddExtension(const InferenceEngine::IShapeInferExtensionPtr& ext
 
 StatusCode CNNNetworkImpl::serialize(const std::string &xmlPath, const std::string &binPath, ResponseDesc* resp) const noexcept {
     try {
-        NetworkSerializer::serialize(xmlPath, binPath, (InferenceEngine::ICNNNetwork&)*this);
+        const std::string compactExtension = CompactIR::extension;
+        if (binPath.empty() && xmlPath.size() > compactExtension.size() &&
+            xmlPath.compare(xmlPath.size() - compactExtension.size(), compactExtension.size(), compactExtension) == 0) {
+            NetworkSerializer::serializeCompact(xmlPath, (InferenceEngine::ICNNNetwork&)*this);
+        } else {
+            NetworkSerializer::serialize(xmlPath, binPath, (InferenceEngine::ICNNNetwork&)*this);
+        }
     } catch (const InferenceEngineException& e) {
         return DescriptionBuffer(GENERAL_ERROR, resp) << e.what();
     } catch (const std::exception& e) {
@@ -24,6 +24,7 @@
 #include "debug.h"
 #include <fstream>
 #include "ie_util_internal.hpp"
+#include "ie_layers_internal.hpp"
 #include <utility>
 
 
@@ -92,6 +93,9 @@ InferenceEngine::Blob::Ptr CNNStatisticHelper::getInputScale(CNNLayer::Ptr layer
         THROW_IE_EXCEPTION << "min and max sizes should be equal to input channels count for " << previousLayer->name;
     }
 
+    if (hasAsymmetricOutput(previousLayer->name)) {
+        return calculateScaleFactor(inputChannels, getStatistic(previousLayer), maxUnsign_, true);
+    }
     return calculateScaleFactor(inputChannels, getStatistic(previousLayer),
                                 hasNegativeOutput(previousLayer->name) ? maxSign_ : maxUnsign_);
 }
@@ -107,16 +111,44 @@ InferenceEngine::Blob::Ptr CNNStatisticHelper::getOutputScale(CNNLayer::Ptr laye
         THROW_IE_EXCEPTION << "min and max sizes should be equal to output channels count for " << layer->name;
     }
 
+    if (hasAsymmetricOutput(layer->name)) {
+        return calculateScaleFactor(outputChannels, getStatistic(layer), maxUnsign_, true);
+    }
     return calculateScaleFactor(outputChannels, getStatistic(layer),
                                 layer->outData[0]->getPrecision() == Precision::I8 ? maxSign_ : maxUnsign_);
 }
 
+void CNNStatisticHelper::setAsymmetricOutput(const std::string &layerName) {
+    asymmetricOutputs_.insert(layerName);
+}
+
+bool CNNStatisticHelper::hasAsymmetricOutput(const std::string &layerName) const {
+    return asymmetricOutputs_.find(layerName) != asymmetricOutputs_.end();
+}
+
+InferenceEngine::Blob::Ptr CNNStatisticHelper::getInputShift(CNNLayer::Ptr layer) const {
+    auto previousLayer = layer->insData[0].lock()->creatorLayer.lock();
+    if (!hasAsymmetricOutput(previousLayer->name)) {
+        return nullptr;
+    }
+    size_t inputChannels = layer->insData[0].lock()->getTensorDesc().getDims()[1];
+    return calculateZeroPoint(inputChannels, getStatistic(previousLayer), maxUnsign_);
+}
+
+InferenceEngine::Blob::Ptr CNNStatisticHelper::getOutputShift(CNNLayer::Ptr layer) const {
+    if (!hasAsymmetricOutput(layer->name)) {
+        return nullptr;
+    }
+    size_t outputChannels = layer->outData[0]->getTensorDesc().getDims()[1];
+    return calculateZeroPoint(outputChannels, getStatistic(layer), maxUnsign_);
+}
+
 int CNNStatisticHelper::getMaxSignValue() const {
     return maxSign_;
 }
 
 InferenceEngine::Blob::Ptr CNNStatisticHelper::calculateScaleFactor(size_t channels ,
-    NetworkNodeStatsPtr stats, int maxInt) const {
+    NetworkNodeStatsPtr stats, int maxInt, bool asymmetric) const {
     if (stats->_minOutputs.size() != channels || stats->_maxOutputs.size() != channels) {
         THROW_IE_EXCEPTION << "min and max sizes should be equal to channels count";
     }
@@ -129,9 +161,14 @@ InferenceEngine::Blob::Ptr CNNStatisticHelper::calculateScaleFactor(size_t chann
 
     for (int c = 0; c < channels; c++) {
         float maxc = 0;
+        if (asymmetric) {
+            // the range always contains 0 to have it exactly representable by the zero point
+            maxc = fmax(stats->_maxOutputs[c], 0.f) - fmin(stats->_minOutputs[c], 0.f);
+        } else {
             // maxc = fmax(maxc, fabs(stats[k]->_minOutputs[c]));        // TODO Check if we should take minimums into account
             maxc = fmax(maxc, fabs(stats->_maxOutputs[c]));
             maxc = fmax(maxc, fabs(stats->_minOutputs[c]));
+        }
 
         iScaleMemory[c] = maxc / static_cast<float>(maxInt);
 
@@ -142,6 +179,23 @@ InferenceEngine::Blob::Ptr CNNStatisticHelper::calculateScaleFactor(size_t chann
     return iScale;
 }
 
+InferenceEngine::Blob::Ptr CNNStatisticHelper::calculateZeroPoint(size_t channels,
+    NetworkNodeStatsPtr stats, int maxInt) const {
+    auto scale = calculateScaleFactor(channels, stats, maxInt, true);
+    float* scaleMemory = static_cast<float*>(scale->buffer());
+
+    std::shared_ptr<Data> shiftData = std::shared_ptr<Data>(new Data("shift", { channels }, Precision::FP32, Layout::C));
+    auto shift = CreateBlobFromData(shiftData);
+    shift->allocate();
+    float* shiftMemory = static_cast<float*>(shift->buffer());
+
+    for (size_t c = 0; c < channels; c++) {
+        float zeroPoint = round(-fmin(stats->_minOutputs[c], 0.f) / scaleMemory[c]);
+        shiftMemory[c] = fmin(fmax(zeroPoint, 0.f), static_cast<float>(maxInt));
+    }
+    return shift;
+}
+
 NetworkNodeStatsPtr CNNStatisticHelper::getStatistic(CNNLayer::Ptr layer) const {
     // TODO(amalyshe) all logic of traversing over network and get apropriate statistics should be here
     // for now it is a stub
@@ -310,6 +364,7 @@ void CNNStatisticHelper::NormalizeStatistic() {
                 if (CaselessEq<std::string>()(tl->type, "pooling") ||
                     CaselessEq<std::string>()(tl->type, "relu") ||
                     CNNNetworkInt8Normalizer::isReLULikeClamp(tl) ||
+                    CNNNetworkInt8Normalizer::isChannelPreservingPermute(tl) ||
                     CaselessEq<std::string>()(tl->type, "concat")) {
                     if (tl->outData.size() == 1) {
                         for (auto it : tl->outData[0]->inputTo) {
@@ -380,7 +435,8 @@ void CNNStatisticHelper::NormalizeStatistic() {
                     for (auto it : tl->outData[0]->inputTo) {
                         if (CaselessEq<std::string>()(it.second->type, "pooling") ||
                                 CaselessEq<std::string>()(it.second->type, "relu") ||
-                                CNNNetworkInt8Normalizer::isReLULikeClamp(it.second)) {
+                                CNNNetworkInt8Normalizer::isReLULikeClamp(it.second) ||
+                                CNNNetworkInt8Normalizer::isChannelPreservingPermute(it.second)) {
                             toAnalyze.push_back(it.second);
                         }
                     }
@@ -443,7 +499,8 @@ void CNNNetworkInt8Normalizer::AddLayerToCNNNetworkAfterData(DataPtr pData, CNNL
     }
 }
 
-void CNNNetworkInt8Normalizer::fillInScaleShift(ScaleShiftLayer* scshLayer, size_t c, float* weightsN, float* weightsD) {
+void CNNNetworkInt8Normalizer::fillInScaleShift(ScaleShiftLayer* scshLayer, size_t c, float* weightsN, float* weightsD,
+                                                float* shifts) {
     // Setting "scales"
     SizeVector weightsSize = { c };
     TensorDesc weightsDesc(Precision::FP32, weightsSize, InferenceEngine::C);
@@ -469,7 +526,7 @@ void CNNNetworkInt8Normalizer::fillInScaleShift(ScaleShiftLayer* scshLayer, size
     scshLayer->_biases->allocate();
     float * biasesData = scshLayer->_biases->buffer();
     for (size_t i = 0; i < c; i++) {
-        biasesData[i] = 0.f;  // Setting to constant "0"
+        biasesData[i] = shifts != nullptr ? shifts[i] : 0.f;  // Setting to constant "0" or to the zero points
     }
 }
 
@@ -514,6 +571,11 @@ void CNNNetworkInt8Normalizer::AddScaleShiftBetween(CNNNetwork& net, const CNNLa
         iScaleBlob = layer2->blobs["i-scale"];
     }
 
+    Blob::Ptr iShiftBlob = nullptr;
+    if (layer2->blobs.find("i-shift") != layer2->blobs.end()) {
+        iShiftBlob = layer2->blobs["i-shift"];
+    }
+
     if (iScaleBlob == nullptr && oScaleBlob == nullptr) {
         return;  // No multipliers found around this edge. We can't create a ScaleShift here;
     } else {
@@ -539,12 +601,13 @@ void CNNNetworkInt8Normalizer::AddScaleShiftBetween(CNNNetwork& net, const CNNLa
 
         {
             ScaleShiftLayer* scshLayer = dynamic_cast<ScaleShiftLayer*>(ssCnnLayer.get());
-            fillInScaleShift(scshLayer, c, oScaleBuffer, iScaleBuffer);
+            fillInScaleShift(scshLayer, c, oScaleBuffer, iScaleBuffer,
+                             iShiftBlob != nullptr ? static_cast<float*>(iShiftBlob->buffer()) : nullptr);
         }
 
         Precision odPrecision = Precision::FP32;
         if (layer2->precision == Precision::I8) {
-            odPrecision = statHelper.hasNegativeOutput(layer1->name) ? Precision::I8 : Precision::U8;
+            odPrecision = statHelper.hasNegativeOutput(layer1->name) && iShiftBlob == nullptr ? Precision::I8 : Precision::U8;
         }
         ssCnnLayer->outData[0]->setPrecision(odPrecision);
     }
@@ -790,6 +853,24 @@ void CNNNetworkInt8Normalizer::QuantizeConvolutionOrFullyConnected(CNNLayer::Ptr
 
     convolution->blobs["i-scale"] = iScale;
 
+    // the zero points of an asymmetric input are compensated in the biases, a layer without biases gets zero ones
+    auto iShift = statHelper.getInputShift(convolution);
+    if (iShift != nullptr) {
+        convolution->blobs["i-shift"] = iShift;
+        if (convolution->blobs.find("biases") == convolution->blobs.end()) {
+            std::shared_ptr<Data> biasesData = std::shared_ptr<Data>(new Data("biases", { outputChannels }, Precision::FP32, Layout::C));
+            auto zeroBiases = CreateBlobFromData(biasesData);
+            zeroBiases->allocate();
+            std::fill_n(static_cast<float *>(zeroBiases->buffer()), outputChannels, 0.f);
+            convolution->blobs["biases"] = zeroBiases;
+
+            WeightableLayer *pWeightable = dynamic_cast<WeightableLayer *>(convolution.get());
+            if (pWeightable != nullptr) {
+                pWeightable->_biases = zeroBiases;
+            }
+        }
+    }
+
     Blob::Ptr weights = nullptr;
     Blob::Ptr biases = nullptr;
 
@@ -817,6 +898,8 @@ void CNNNetworkInt8Normalizer::QuantizeConvolutionOrFullyConnected(CNNLayer::Ptr
     }
 
     std::vector<float> weightScalers;
+    // sum of the quantized weights multiplied by the input zero points per output channel
+    std::vector<float> shiftCompensation(outputChannels, 0.f);
 
 
     // Creating w-scale blob
@@ -881,17 +964,46 @@ void CNNNetworkInt8Normalizer::QuantizeConvolutionOrFullyConnected(CNNLayer::Ptr
         auto oScale = statHelper.getOutputScale(statHelper.getLatestInFuse(convolution));
         convolution->blobs["o-scale"] = oScale;
 
+        auto oShift = statHelper.getOutputShift(statHelper.getLatestInFuse(convolution));
+        if (oShift != nullptr) {
+            convolution->blobs["o-shift"] = oShift;
+        }
+
         // debug scales. Need to compare with actual values in FP32 scoring
         convolution->blobs["ext-scale"] = convolution->blobs["o-scale"];
 
         // Normalizing the weights
         ScaleDataToInt(&newWeights[0], weights->size(), int8weights, weightScalers);
+
+        if (iShift != nullptr) {
+            const int8_t *int8weight = static_cast<const int8_t *>(int8weights->buffer());
+            const float *iShiftMemory = static_cast<const float *>(iShift->buffer());
+            for (size_t g = 0; g < group; g++) {
+                for (size_t co = 0; co < W_CO; co++) {
+                    float compensation = 0.f;
+                    for (size_t ci = 0; ci < W_CI; ci++) {
+                        size_t kernelBase = g * W_CO * W_CI * W_HW + co * W_CI * W_HW + ci * W_HW;
+                        for (size_t hw = 0; hw < W_HW; hw++) {
+                            compensation += int8weight[kernelBase + hw] * iShiftMemory[g * W_CI + ci];
+                        }
+                    }
+                    shiftCompensation[g * W_CO + co] = compensation;
+                }
+            }
+        }
     }
 
     // Normalizing the biases
     if (biases) {
         const float *bias = static_cast<const float *>(biases->buffer());
         ScaleDataToInt(bias, biases->size(), int32biases, weightScalers);
+
+        if (iShift != nullptr) {
+            int32_t *int32bias = static_cast<int32_t *>(int32biases->buffer());
+            for (size_t co = 0; co < outputChannels; co++) {
+                int32bias[co] -= static_cast<int32_t>(shiftCompensation[co]);
+            }
+        }
     }
 }
 
@@ -922,6 +1034,7 @@ void CNNNetworkInt8Normalizer::returnTailToFP32(const CNNLayer::Ptr layer) {
         // 1. if it is Pooling layer, or concat layer, we can return it to FP32 as well
         // we need to return it's out data
         if ((CaselessEq<std::string>()(layerA->type, "pooling")
+            || CaselessEq<std::string>()(layerA->type, "permute")
             || CaselessEq<std::string>()(layerA->type, "concat")) &&
             layerA->outData.size() == 1) {
             layerA->precision = Precision::FP32;
@@ -950,6 +1063,7 @@ void CNNNetworkInt8Normalizer::returnTailToFP32(const CNNLayer::Ptr layer) {
                 DataPtr d = i.lock();
                 if (d->creatorLayer.lock()->precision != Precision::FP32
                     && (CaselessEq<std::string>()(layerA->type, "pooling")
+                        || CaselessEq<std::string>()(layerA->type, "permute")
                         || CaselessEq<std::string>()(layerA->type, "relu")
                         || isReLULikeClamp(layerA)
                         || CaselessEq<std::string>()(layerA->type, "concat"))) {
@@ -997,6 +1111,14 @@ bool CNNNetworkInt8Normalizer::isReLULikeClamp(CNNLayer::Ptr layer) {
     return false;
 }
 
+bool CNNNetworkInt8Normalizer::isChannelPreservingPermute(CNNLayer::Ptr layer) {
+    if (!CaselessEq<std::string>()(layer->type, "Permute") || layer->insData.size() != 1 || layer->outData.size() != 1) {
+        return false;
+    }
+    std::vector<int> order = layer->GetParamAsInts("order", {});
+    return order.size() > 1 && order[1] == 1;
+}
+
 void CNNNetworkInt8Normalizer::DefinesExecutionPrecision(CNNNetwork &net, CNNStatisticHelper &statHelper) {
     std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(net);
 
@@ -1218,9 +1340,18 @@ void CNNNetworkInt8Normalizer::DefinesExecutionPrecision(CNNNetwork &net, CNNSta
         } else if (CaselessEq<std::string>()(iter->type, "resample")) {
             iter->precision = Precision::I8;
             iter->outData[0]->setPrecision(iter->insData[0].lock()->getPrecision());
+        } else if (isChannelPreservingPermute(iter)) {
+            // the permute only moves the quantized data, it does not need a reorder to FP32 between int8 layers
+            auto prevLayer = iter->insData[0].lock()->creatorLayer.lock();
+            if (prevLayer && (prevLayer->precision == Precision::I8 || prevLayer->precision == Precision::U8)) {
+                iter->precision = Precision::I8;
+                iter->outData[0]->setPrecision(iter->insData[0].lock()->getPrecision());
+            }
         }
     }
 
+    DefinesAsymmetricData(net, statHelper);
+
     // quantization of weights/biases
     sortedLayers = CNNNetSortTopologically(net);
     for (auto iter : sortedLayers) {
@@ -1247,6 +1378,57 @@ void CNNNetworkInt8Normalizer::DefinesExecutionPrecision(CNNNetwork &net, CNNSta
     }
 }
 
+void CNNNetworkInt8Normalizer::DefinesAsymmetricData(CNNNetwork& net, CNNStatisticHelper& statHelper) {
+    std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(net);
+
+    for (auto iter : sortedLayers) {
+        if (iter->outData.size() != 1 || iter->outData[0]->inputTo.empty()) {
+            continue;
+        }
+
+        // the data is either quantized by the ScaleShift after FP32 layer or by the int8 convolution itself.
+        // The convolution must not be fused with the activation or the sum which would be applied after the zero points
+        bool fp32Producer = iter->precision == Precision::FP32;
+        bool int8Producer = CaselessEq<std::string>()(iter->type, "convolution") &&
+                            iter->precision == Precision::I8 &&
+                            iter->outData[0]->getPrecision() == Precision::I8 &&
+                            statHelper.getLatestInFuse(iter) == iter;
+        if (!fp32Producer && !int8Producer) {
+            continue;
+        }
+
+        bool allConsumersAllowed = true;
+        for (auto it : iter->outData[0]->inputTo) {
+            CNNLayer::Ptr consumer = it.second;
+            ConvolutionLayer *pConv = dynamic_cast<ConvolutionLayer *>(consumer.get());
+            if (!CaselessEq<std::string>()(consumer->type, "convolution") || pConv == nullptr ||
+                consumer->precision != Precision::I8 || consumer->insData.size() != 1) {
+                allConsumersAllowed = false;
+                break;
+            }
+            auto allPads = getPaddings(*pConv);
+            for (size_t i = 0; i < allPads.begin.size(); i++) {
+                if (allPads.begin[i] != 0 || allPads.end[i] != 0) {
+                    allConsumersAllowed = false;
+                }
+            }
+        }
+        if (!allConsumersAllowed) {
+            continue;
+        }
+
+        if (!statHelper.canLayerBeQuantized(iter->outData[0]->inputTo.begin()->second) ||
+            !statHelper.hasNegativeOutput(iter->name)) {
+            continue;
+        }
+
+        statHelper.setAsymmetricOutput(iter->name);
+        if (int8Producer) {
+            iter->outData[0]->setPrecision(Precision::U8);
+        }
+    }
+}
+
 void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net, const CNNStatisticHelper& statHelper) {
     std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(net);
 
@@ -1302,7 +1484,8 @@ void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net, const CNNS
                     if (l.second->precision == Precision::I8 || l.second->precision == Precision::U8) {
                         if (CaselessEq<std::string>()(l.second->type, "Pooling") ||
                             CaselessEq<std::string>()(l.second->type, "ReLU") ||
-                            CNNNetworkInt8Normalizer::isReLULikeClamp(l.second)
+                            CNNNetworkInt8Normalizer::isReLULikeClamp(l.second) ||
+                            CNNNetworkInt8Normalizer::isChannelPreservingPermute(l.second)
                         ) {
                             l.second->blobs["o-scale"] = iter->blobs["o-scale"];
                             // debug scales. Need to compare with actual values in FP32 scoring
@@ -1310,6 +1493,7 @@ void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net, const CNNS
                             int8Consumers++;
                         } else if (l.second->type == "Convolution") {
                             l.second->blobs.erase("i-scale");
+                            l.second->blobs.erase("i-shift");
                             int8Consumers++;
                         } else if (CaselessEq<std::string>()(l.second->type, "Eltwise")) {
                             if (statHelper.getLatestInFuse(iter) != iter) {
@@ -1364,12 +1548,16 @@ void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net, const CNNS
                     CaselessEq<std::string>()(iter->type, "FullyConnected")) {
                     if (int8Consumers) {
                         iter->blobs["oi-scale"] = iter->blobs["o-scale"];
+                        if (iter->blobs.find("o-shift") != iter->blobs.end()) {
+                            iter->blobs["oi-shift"] = iter->blobs["o-shift"];
+                        }
                     } else {
                         iter->outData[0]->setPrecision(Precision::FP32);
                     }
                 }
                 if (!fp32Consumers) {
                     iter->blobs.erase("o-scale");
+                    iter->blobs.erase("o-shift");
                 }
             }
         }
@@ -1408,6 +1596,7 @@ void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net, const CNNS
                     && curLayer->insData[0].lock()->inputTo.size() == 1) {
                     curLayer = curLayer->insData[0].lock()->creatorLayer.lock();
                     if (!CaselessEq<std::string>()(curLayer->type, "Pooling")
+                        && !CaselessEq<std::string>()(curLayer->type, "Permute")
                         && !CaselessEq<std::string>()(curLayer->type, "ReLU")
                         && !isReLULikeClamp(curLayer)
                         && !CaselessEq<std::string>()(curLayer->type, "Convolution")) {
@@ -1429,7 +1618,7 @@ void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net, const CNNS
                 iter->blobs.erase("o-scale");
                 auto iLayer = iter;
                 while (iLayer != curLayer) {
-                    if (iLayer->type == "Pooling") {
+                    if (iLayer->type == "Pooling" || iLayer->type == "Permute") {
                         iLayer->precision = Precision::FP32;
                     }
                     iLayer = iLayer->insData[0].lock()->creatorLayer.lock();
@@ -1465,6 +1654,16 @@ void precisionColoring(const CNNLayerPtr layer,
             std::pair<std::string, std::string>("i-scale", ""));
     }
 
+    // looking for the zero points
+    if (layer->blobs.find("oi-shift") != layer->blobs.end()) {
+        printed_properties.insert(printed_properties.begin(),
+            std::pair<std::string, std::string>("oi-shift", ""));
+    }
+    if (layer->blobs.find("i-shift") != layer->blobs.end()) {
+        printed_properties.insert(printed_properties.begin(),
+            std::pair<std::string, std::string>("i-shift", ""));
+    }
+
     printed_properties.insert(printed_properties.begin(),
         std::pair<std::string, std::string>("Precision", layer->precision == Precision::FP32 ? "FP32" : "I8"));
 
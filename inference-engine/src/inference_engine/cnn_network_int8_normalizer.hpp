@@ -6,6 +6,7 @@
 
 #include <map>
 #include <memory>
+#include <set>
 #include <float.h>
 
 #include <string>
@@ -79,6 +80,29 @@ public:
      */
     InferenceEngine::Blob::Ptr getOutputScale(CNNLayer::Ptr layer) const;
 
+    /**
+     * Marks the output of the layer to be quantized to U8 with zero points instead of the symmetric scales,
+     * the scales and the zero points are calculated from the whole [min, max] range of the statistic
+     */
+    void setAsymmetricOutput(const std::string &layerName);
+
+    /**
+     * Returns if the output of the layer is quantized with zero points
+     */
+    bool hasAsymmetricOutput(const std::string &layerName) const;
+
+    /**
+     * Returns zero points of the input of the layer
+     * @return blob with zero points per channel or nullptr if the input is quantized symmetrically
+     */
+    InferenceEngine::Blob::Ptr getInputShift(CNNLayer::Ptr layer) const;
+
+    /**
+     * Returns zero points of the output of the layer
+     * @return blob with zero points per channel or nullptr if the output is quantized symmetrically
+     */
+    InferenceEngine::Blob::Ptr getOutputShift(CNNLayer::Ptr layer) const;
+
     /**
      * provides max signed value as the only place for synchronization with other algorithms in
      * normalizer which require this
@@ -104,12 +128,21 @@ private:
      * @param stats redundant parameter, should be removed
      * @param maxInt - we can quantize to I8 even if data is unsigned, need to provide such max number
      *               explicitly
+     * @param asymmetric - the scale covers [min, max] range instead of [-max(|min|, |max|), max(|min|, |max|)]
      *
      * @return InferenceEngine::Blob::Ptr
      */
     InferenceEngine::Blob::Ptr calculateScaleFactor(size_t channels,
                                                     NetworkNodeStatsPtr stats,
-                                                    int maxInt) const;
+                                                    int maxInt,
+                                                    bool asymmetric = false) const;
+
+    /**
+     * Calculates zero points which map the minimums of the statistic to 0 with the asymmetric scales
+     */
+    InferenceEngine::Blob::Ptr calculateZeroPoint(size_t channels,
+                                                  NetworkNodeStatsPtr stats,
+                                                  int maxInt) const;
 
     /**
      * Select the latet layer in the fusion and returns its statistic
@@ -124,6 +157,7 @@ private:
 
     CNNNetwork network_;
     std::map<std::string, NetworkNodeStatsPtr> internalNodesStats_;
+    std::set<std::string> asymmetricOutputs_;
     int maxSign_;
     int maxUnsign_;
 };
@@ -159,7 +193,8 @@ public:
     }
 private:
     /** Helper function for filling of scaleshift weights for normalization of activation */
-    static void fillInScaleShift(ScaleShiftLayer* scshLayer, size_t c, float* weightsN, float* weightsD);
+    static void fillInScaleShift(ScaleShiftLayer* scshLayer, size_t c, float* weightsN, float* weightsD,
+                                 float* shifts = nullptr);
 
 public:
     /** main function for calling of quantization */
@@ -183,6 +218,12 @@ protected:
      */
     static void QuantizeConvolutionOrFullyConnected(CNNLayer::Ptr convolution, CNNStatisticHelper& statHelper);
 
+    /**
+     * Quantizes signed data to U8 with zero points if all its consumers are int8 convolutions without padding.
+     * The zero points are compensated in the biases of the consumers, the 0 used for padding would not be
+     */
+    static void DefinesAsymmetricData(CNNNetwork& net, CNNStatisticHelper& statHelper);
+
     /**  Adds ScaleShifts everywhere */
     static void AddScaleShifts(CNNNetwork& net, CNNStatisticHelper& statHelper);
 
@@ -247,6 +288,12 @@ public:
      * Returns true for a "relu-like" clamp layer i.e. a clamp with minimum = 0
      */
     static bool isReLULikeClamp(CNNLayer::Ptr layer);
+
+    /**
+     * Returns true for a permute layer which keeps the channels axis in place, i.e. the per-channel scales of its
+     * input are valid for its output as well
+     */
+    static bool isChannelPreservingPermute(CNNLayer::Ptr layer);
 };
 
 typedef std::shared_ptr<CNNNetworkInt8Normalizer> CNNNetworkNormalizerPtr;
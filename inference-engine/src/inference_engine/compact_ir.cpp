@@ -0,0 +1,224 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+
+#include "compact_ir.hpp"
+#include "ie_format_parser.h"
+#include "ie_blob_proxy.hpp"
+#include "ie_icnn_network_stats.hpp"
+#include "details/caseless.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+constexpr const char *CompactIR::magic;
+constexpr uint32_t CompactIR::version;
+constexpr size_t CompactIR::blobAlignment;
+constexpr size_t CompactIR::sectionAlignment;
+constexpr int CompactIR::irVersion;
+constexpr const char *CompactIR::extension;
+
+namespace {
+
+class SectionReader {
+public:
+    SectionReader(const uint8_t *data, size_t size) : _data(data), _size(size) {}
+
+    template <typename T>
+    T get() {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    std::string getString() {
+        auto length = get<uint32_t>();
+        return std::string(reinterpret_cast<const char *>(take(length)), length);
+    }
+
+    template <typename T>
+    std::vector<T> getVector() {
+        auto length = get<uint32_t>();
+        std::vector<T> values(length);
+        if (length != 0)
+            std::memcpy(values.data(), take(sizeof(T) * length), sizeof(T) * length);
+        return values;
+    }
+
+    Precision getPrecision() {
+        return Precision(static_cast<Precision::ePrecision>(get<uint8_t>()));
+    }
+
+private:
+    const uint8_t *take(size_t size) {
+        if (_size - _offset < size)
+            THROW_IE_EXCEPTION << "The compact IR topology is truncated at offset " << _offset;
+        const uint8_t *data = _data + _offset;
+        _offset += size;
+        return data;
+    }
+
+    const uint8_t *_data;
+    size_t _size;
+    size_t _offset = 0;
+};
+
+CNNLayer::Ptr createLayer(const LayerParams &prms) {
+    CaselessEq<std::string> cmp;
+    // the activations are written with the type of the activation, so the layer is created by that type
+    if (cmp(prms.type, "ReLU6"))
+        return std::make_shared<ReLU6Layer>(prms);
+    if (cmp(prms.type, "TensorIterator"))
+        THROW_IE_EXCEPTION << "TensorIterator layer " << prms.name << " is not supported by the compact IR";
+    return FormatParser::CreateLayer(prms);
+}
+
+}  // namespace
+
+CNNNetworkImplPtr CompactIR::read(const TBlob<uint8_t>::Ptr &content) {
+    const uint8_t *file = content->cbuffer().as<const uint8_t *>();
+    size_t fileSize = content->byteSize();
+    if (!isCompactIR(file, fileSize))
+        THROW_IE_EXCEPTION << "The file is not a compact IR";
+
+    CompactIRHeader header;
+    std::memcpy(&header, file, sizeof(header));
+    if (header.version != version)
+        THROW_IE_EXCEPTION << "Unsupported compact IR version: " << header.version;
+    if (header.topologyOffset > fileSize || fileSize - header.topologyOffset < header.topologySize ||
+        header.weightsOffset > fileSize || fileSize - header.weightsOffset < header.weightsSize)
+        THROW_IE_EXCEPTION << "The compact IR sections exceed the file size";
+
+    SectionReader topology(file + header.topologyOffset, static_cast<size_t>(header.topologySize));
+    auto getSegment = [&](Precision precision) {
+        WeightSegment segment;
+        segment.precision = precision;
+        auto offset = topology.get<uint64_t>();
+        segment.size = static_cast<size_t>(topology.get<uint64_t>());
+        if (offset > header.weightsSize || header.weightsSize - offset < segment.size)
+            THROW_IE_EXCEPTION << "The compact IR blob exceeds the weights section";
+        segment.start = static_cast<size_t>(header.weightsOffset + offset);
+        return segment;
+    };
+
+    CNNNetworkImplPtr network(new CNNNetworkImpl());
+    network->setName(topology.getString());
+    network->setPrecision(topology.getPrecision());
+
+    std::vector<DataPtr> data(topology.get<uint32_t>());
+    for (auto &d : data) {
+        std::string name = topology.getString();
+        Precision precision = topology.getPrecision();
+        auto layout = static_cast<Layout>(topology.get<uint8_t>());
+        auto dims = topology.getVector<uint64_t>();
+        d = std::make_shared<Data>(name, TensorDesc(precision, SizeVector(dims.begin(), dims.end()), layout));
+    }
+    auto dataAt = [&](uint32_t index) -> const DataPtr& {
+        if (index >= data.size())
+            THROW_IE_EXCEPTION << "The compact IR refers to the missing data " << index;
+        return data[index];
+    };
+
+    auto layersCount = topology.get<uint32_t>();
+    for (uint32_t l = 0; l < layersCount; l++) {
+        LayerParams prms;
+        prms.name = topology.getString();
+        prms.type = topology.getString();
+        prms.precision = topology.getPrecision();
+        CNNLayer::Ptr layer = createLayer(prms);
+
+        for (auto paramsCount = topology.get<uint32_t>(); paramsCount > 0; paramsCount--) {
+            std::string key = topology.getString();
+            layer->params[key] = topology.getString();
+        }
+        for (auto index : topology.getVector<uint32_t>()) {
+            const DataPtr &in = dataAt(index);
+            layer->insData.push_back(in);
+            in->getInputTo()[layer->name] = layer;
+        }
+        for (auto index : topology.getVector<uint32_t>()) {
+            const DataPtr &out = dataAt(index);
+            if (out->getCreatorLayer().lock())
+                THROW_IE_EXCEPTION << "two layers set to the same output [" << out->getName() << "]";
+            out->getCreatorLayer() = layer;
+            layer->outData.push_back(out);
+            network->getData(out->getName()) = out;
+        }
+        layer->validateLayer();
+
+        auto *pWL = dynamic_cast<WeightableLayer *>(layer.get());
+        for (auto blobsCount = topology.get<uint32_t>(); blobsCount > 0; blobsCount--) {
+            std::string blobName = topology.getString();
+            Precision precision = topology.getPrecision();
+            WeightSegment segment = getSegment(precision);
+
+            Blob::Ptr blob;
+            if (precision == Precision::BIN) {
+                blob.reset(new TBlobProxy<uint8_t>(Precision::BIN, Layout::C, content, segment.start, {segment.size}));
+            } else {
+                blob = FormatParser::GetBlobFromSegment(content, segment);
+            }
+            layer->blobs[blobName] = blob;
+            if (pWL != nullptr && blobName == "weights")
+                pWL->_weights = blob;
+            if (pWL != nullptr && blobName == "biases")
+                pWL->_biases = blob;
+        }
+        network->addLayer(layer);
+    }
+
+    for (auto inputsCount = topology.get<uint32_t>(); inputsCount > 0; inputsCount--) {
+        InputInfo::Ptr info(new InputInfo());
+        info->setInputData(dataAt(topology.get<uint32_t>()));
+        info->setInputPrecision(topology.getPrecision());
+
+        PreProcessInfo &pp = info->getPreProcess();
+        pp.setResizeAlgorithm(static_cast<ResizeAlgorithm>(topology.get<uint8_t>()));
+        auto variant = static_cast<MeanVariant>(topology.get<uint8_t>());
+        auto channelsCount = topology.get<uint32_t>();
+        if (channelsCount != 0)
+            pp.init(channelsCount);
+        for (uint32_t c = 0; c < channelsCount; c++) {
+            const PreProcessChannel::Ptr &channel = pp[c];
+            channel->stdScale = topology.get<float>();
+            channel->meanValue = topology.get<float>();
+            Precision meanPrecision = topology.getPrecision();
+            WeightSegment segment = getSegment(meanPrecision);
+            if (segment.size != 0) {
+                auto dims = info->getDims();
+                channel->meanData = FormatParser::GetBlobFromSegment(content, segment);
+                channel->meanData->Reshape({ dims[0], dims[1] }, Layout::HW);
+            }
+        }
+        pp.setVariant(variant);
+        network->setInputInfo(info);
+    }
+
+    network->resolveOutput();
+    for (auto outputsCount = topology.get<uint32_t>(); outputsCount > 0; outputsCount--) {
+        const DataPtr &out = dataAt(topology.get<uint32_t>());
+        network->addOutput(out->getName());
+        out->setPrecision(topology.getPrecision());
+    }
+
+    std::map<std::string, NetworkNodeStatsPtr> nodesStats;
+    for (auto statsCount = topology.get<uint32_t>(); statsCount > 0; statsCount--) {
+        NetworkNodeStatsPtr nodeStats(new NetworkNodeStats());
+        nodesStats[topology.getString()] = nodeStats;
+        nodeStats->_minOutputs = topology.getVector<float>();
+        nodeStats->_maxOutputs = topology.getVector<float>();
+    }
+    ICNNNetworkStats *pstats = nullptr;
+    if (network->getStats(&pstats, nullptr) == OK && pstats) {
+        pstats->setNodesStats(nodesStats);
+    }
+
+    if (network->allLayers().empty())
+        THROW_IE_EXCEPTION << "Incorrect model! Network doesn't contain layers.";
+    return network;
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "ie_api.h"
+#include "ie_blob.h"
+#include "cnn_network_impl.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief The compact IR is a single binary file that holds the topology and the weights of a network.
+ *
+ * The file starts with a CompactIRHeader, followed by the topology section and the weights section:
+ *  - the topology is a sequence of little endian records: the strings are a uint32_t length followed by the
+ *    characters, the vectors are a uint32_t length followed by the elements, the precisions and the layouts are
+ *    stored as their enum values, so no text is parsed except the layer parameters, which are kept as strings;
+ *  - the weights section starts at a page aligned offset of the file and every blob in it is aligned to
+ *    CompactIR::blobAlignment bytes, so the file can be mapped as is and the layer blobs refer to the mapping.
+ *
+ * The topology is written in the topological order of the layers:
+ *  - network: name, precision;
+ *  - data: count, then for each data its name, precision, layout and dims;
+ *  - layers: count, then for each layer its name, type, precision, the parameters, the indices of the input and
+ *    output data and the blobs as name, precision, offset relative to the weights section and size in bytes;
+ *  - inputs: count, then for each input the data index, the input precision, the resize algorithm, the mean
+ *    variant and the channels as scale, mean value, mean image offset and size;
+ *  - outputs: count, then for each output the data index and the precision;
+ *  - statistics: count, then for each layer its name, the minimums and the maximums.
+ */
+struct CompactIRHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t topologyOffset;
+    uint64_t topologySize;
+    uint64_t weightsOffset;
+    uint64_t weightsSize;
+};
+
+struct CompactIR {
+    static constexpr const char *magic = "IE-CIR\0";
+    static constexpr uint32_t version = 1;
+    static constexpr size_t blobAlignment = 64;
+    static constexpr size_t sectionAlignment = 4096;
+    /**
+     * @brief The version of the XML IR the topology is equivalent to
+     */
+    static constexpr int irVersion = 3;
+    /**
+     * @brief The file extension NetworkSerializer writes the compact IR for
+     */
+    static constexpr const char *extension = ".cir";
+
+    static bool isCompactIR(const void *data, size_t size) {
+        return size >= sizeof(CompactIRHeader) && std::memcmp(data, magic, sizeof(CompactIRHeader::magic)) == 0;
+    }
+
+    /**
+     * @brief Creates the network from the compact IR file content, the blobs of the layers refer to the content
+     * @param content The whole file, it is kept alive by the blobs of the network
+     */
+    static CNNNetworkImplPtr read(const TBlob<uint8_t>::Ptr &content);
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
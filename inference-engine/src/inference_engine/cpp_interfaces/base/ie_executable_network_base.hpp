@@ -62,6 +62,10 @@ public:
         TO_STATUS(_impl->GetExecGraphInfo(graphPtr));
     }
 
+    StatusCode GetMetrics(std::map<std::string, InferenceEngineMetricInfo> &metrics, ResponseDesc *resp) noexcept override {
+        TO_STATUS(metrics = _impl->GetMetrics());
+    }
+
     StatusCode  QueryState(IMemoryState::Ptr & pState, size_t idx
         , ResponseDesc *resp) noexcept override {
         try {
@@ -7,6 +7,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 #include "ie_iinfer_request.hpp"
 #include "cpp_interfaces/exception2status.hpp"
 #include "ie_profiling.hpp"
@@ -41,6 +42,11 @@ public:
         TO_STATUS(_impl->SetBlob(name, data));
     }
 
+    StatusCode SetRoiBlobs(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois,
+                           ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetRoiBlobs(name, frame, rois));
+    }
+
     StatusCode GetBlob(const char *name, Blob::Ptr &data, ResponseDesc *resp) noexcept override {
         TO_STATUS(_impl->GetBlob(name, data));
     }
@@ -75,6 +81,10 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode SetPriority(int priority, int64_t millis_deadline, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetPriority(priority, millis_deadline));
+    }
+
 protected:
     ~InferRequestBase() = default;
 };
@@ -2,13 +2,28 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include "ie_parallel.hpp"
 #include "cpp_interfaces/ie_executor_manager.hpp"
 #include "cpp_interfaces/ie_task_executor.hpp"
+#include "cpp_interfaces/ie_thread_pool_task_executor.hpp"
+
+#if IE_THREAD == IE_THREAD_TBB
+#define TBB_PREVIEW_GLOBAL_CONTROL 1
+#include "tbb/global_control.h"
+#endif
 
 namespace InferenceEngine {
 
+#if IE_THREAD == IE_THREAD_TBB
+namespace {
+// the limit of the TBB scheduler holds while the object is alive
+std::unique_ptr<tbb::global_control> tbbThreadsLimit;
+}  // namespace
+#endif
+
 ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     auto foundEntry = executors.find(id);
     if (foundEntry == executors.end()) {
@@ -20,12 +35,41 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
 }
 
 // for tests purposes
+ITaskExecutor::Ptr ExecutorManagerImpl::getThreadPoolExecutor(std::string id, size_t threadsNum) {
+    auto foundEntry = threadPoolExecutors.find(id);
+    if (foundEntry == threadPoolExecutors.end()) {
+        if (threadsLimit > 0)
+            threadsNum = threadsNum > 0 ? std::min(threadsNum, threadsLimit) : threadsLimit;
+        auto newExec = std::make_shared<ThreadPoolTaskExecutor>(id, threadsNum);
+        threadPoolExecutors[id] = newExec;
+        return newExec;
+    }
+    return foundEntry->second;
+}
+
+void ExecutorManagerImpl::setThreadsLimit(size_t threadsNum) {
+    threadsLimit = threadsNum;
+#if IE_THREAD == IE_THREAD_TBB
+    tbbThreadsLimit.reset();
+    if (threadsNum > 0)
+        tbbThreadsLimit.reset(new tbb::global_control(tbb::global_control::max_allowed_parallelism, threadsNum));
+#elif IE_THREAD == IE_THREAD_OMP
+    // the threads which set their own number of the threads take the limit into account by getThreadsLimit
+    parallel_set_num_threads(threadsNum > 0 ? static_cast<int>(threadsNum) : omp_get_num_procs());
+#endif
+}
+
+size_t ExecutorManagerImpl::getThreadsLimit() const {
+    return threadsLimit;
+}
+
 size_t ExecutorManagerImpl::getExecutorsNumber() {
-    return executors.size();
+    return executors.size() + threadPoolExecutors.size();
 }
 
 void ExecutorManagerImpl::clear() {
     executors.clear();
+    threadPoolExecutors.clear();
 }
 
 ExecutorManager *ExecutorManager::_instance = nullptr;
@@ -34,6 +78,18 @@ ITaskExecutor::Ptr ExecutorManager::getExecutor(std::string id) {
     return _impl.getExecutor(id);
 }
 
+ITaskExecutor::Ptr ExecutorManager::getThreadPoolExecutor(std::string id, size_t threadsNum) {
+    return _impl.getThreadPoolExecutor(id, threadsNum);
+}
+
+void ExecutorManager::setThreadsLimit(size_t threadsNum) {
+    _impl.setThreadsLimit(threadsNum);
+}
+
+size_t ExecutorManager::getThreadsLimit() const {
+    return _impl.getThreadsLimit();
+}
+
 size_t ExecutorManager::getExecutorsNumber() {
     return _impl.getExecutorsNumber();
 }
@@ -21,6 +21,12 @@ class ExecutorManagerImpl {
 public:
     ITaskExecutor::Ptr getExecutor(std::string id);
 
+    ITaskExecutor::Ptr getThreadPoolExecutor(std::string id, size_t threadsNum);
+
+    void setThreadsLimit(size_t threadsNum);
+
+    size_t getThreadsLimit() const;
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -28,6 +34,8 @@ public:
 
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
+    std::unordered_map<std::string, ITaskExecutor::Ptr> threadPoolExecutors;
+    size_t threadsLimit = 0;
 };
 
 /**
@@ -57,6 +65,26 @@ public:
      */
     ITaskExecutor::Ptr getExecutor(std::string id);
 
+    /**
+     * @brief Returns the executor which runs the tasks on a shared pool of threads, e.g. the completion callbacks
+     * of many requests. The tasks are not serialized, unlike with the executor returned by getExecutor
+     * @param id unique identificator of the pool
+     * @param threadsNum number of the threads, used only when the pool is created, 0 means the number of hardware threads
+     */
+    ITaskExecutor::Ptr getThreadPoolExecutor(std::string id, size_t threadsNum = 0);
+
+    /**
+     * @brief Caps the threads of the parallel runtime of the process (TBB or OpenMP) shared by the plugins, the
+     * pre-processing and the extensions, and the threads of the pools created after the call
+     * @param threadsNum the maximal number of the threads, 0 removes the limit
+     */
+    void setThreadsLimit(size_t threadsNum);
+
+    /**
+     * @brief Returns the limit set by setThreadsLimit, 0 if the number of the threads is not limited
+     */
+    size_t getThreadsLimit() const;
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -0,0 +1,159 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ie_metrics.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+/* The shard of the calling thread: the threads take the shards round-robin in the order of their first record */
+size_t currentShard() noexcept {
+    static std::atomic<size_t> nextShard(0);
+    static thread_local size_t shard = nextShard.fetch_add(1, std::memory_order_relaxed) % METRIC_SHARDS_NUM;
+    return shard;
+}
+
+thread_local int threadStream = 0;
+thread_local LoadPhaseReport *threadLoadReport = nullptr;
+
+const char *stageNames[MetricsRegistry::STAGES_NUM] = {"QueueWait", "Preprocessing", "Infer", "Callback"};
+const char *counterNames[MetricsRegistry::COUNTERS_NUM] = {"Requests", "FailedRequests", "ExpiredRequests"};
+
+}  // namespace
+
+MetricCounter::MetricCounter() {
+    for (auto &shard : _shards)
+        shard.value = 0;
+}
+
+void MetricCounter::increment() noexcept {
+    _shards[currentShard()].value.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t MetricCounter::value() const {
+    uint64_t value = 0;
+    for (const auto &shard : _shards)
+        value += shard.value.load(std::memory_order_relaxed);
+    return value;
+}
+
+MetricHistogram::MetricHistogram() {
+    for (auto &shard : _shards) {
+        shard.count = 0;
+        shard.sum = 0;
+        for (auto &bucket : shard.buckets)
+            bucket = 0;
+    }
+}
+
+size_t MetricHistogram::bucketOf(uint64_t micros) noexcept {
+    size_t bucket = 0;
+    while (micros != 0 && bucket < BUCKETS_NUM - 1) {
+        micros >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void MetricHistogram::record(uint64_t micros) noexcept {
+    Shard &shard = _shards[currentShard()];
+    shard.count.fetch_add(1, std::memory_order_relaxed);
+    shard.sum.fetch_add(micros, std::memory_order_relaxed);
+    shard.buckets[bucketOf(micros)].fetch_add(1, std::memory_order_relaxed);
+}
+
+InferenceEngineMetricInfo MetricHistogram::snapshot() const {
+    // the shards are read one by one, so a sample recorded meanwhile may be counted in the buckets but not in count
+    InferenceEngineMetricInfo info;
+    info.type = InferenceEngineMetricInfo::HISTOGRAM;
+    info.buckets.assign(BUCKETS_NUM, 0);
+    for (const auto &shard : _shards) {
+        info.count += shard.count.load(std::memory_order_relaxed);
+        info.sum_uSec += shard.sum.load(std::memory_order_relaxed);
+        for (size_t b = 0; b < BUCKETS_NUM; b++)
+            info.buckets[b] += shard.buckets[b].load(std::memory_order_relaxed);
+    }
+    return info;
+}
+
+MetricsRegistry::MetricsRegistry(size_t streams) {
+    for (size_t i = 0; i < std::max<size_t>(streams, 1) * STAGES_NUM; i++)
+        _stages.emplace_back(new MetricHistogram());
+}
+
+void MetricsRegistry::record(Stage stage, int stream, uint64_t micros) noexcept {
+    // the threads of a foreign executor may be bound to more streams than the network has
+    const size_t s = stream > 0 ? static_cast<size_t>(stream) % streams() : 0;
+    _stages[s * STAGES_NUM + stage]->record(micros);
+}
+
+void MetricsRegistry::increment(Counter counter) noexcept {
+    _counters[counter].increment();
+}
+
+std::map<std::string, InferenceEngineMetricInfo> MetricsRegistry::snapshot() const {
+    std::map<std::string, InferenceEngineMetricInfo> metrics;
+    for (size_t c = 0; c < COUNTERS_NUM; c++) {
+        InferenceEngineMetricInfo info;
+        info.type = InferenceEngineMetricInfo::COUNTER;
+        info.count = _counters[c].value();
+        metrics[counterNames[c]] = info;
+    }
+    for (size_t stage = 0; stage < STAGES_NUM; stage++) {
+        InferenceEngineMetricInfo total;
+        total.type = InferenceEngineMetricInfo::HISTOGRAM;
+        total.buckets.assign(MetricHistogram::BUCKETS_NUM, 0);
+        for (size_t s = 0; s < streams(); s++) {
+            InferenceEngineMetricInfo info = _stages[s * STAGES_NUM + stage]->snapshot();
+            total.count += info.count;
+            total.sum_uSec += info.sum_uSec;
+            for (size_t b = 0; b < info.buckets.size(); b++)
+                total.buckets[b] += info.buckets[b];
+            if (streams() > 1)
+                metrics[std::string(stageNames[stage]) + ".stream" + std::to_string(s)] = info;
+        }
+        metrics[stageNames[stage]] = total;
+    }
+    return metrics;
+}
+
+void MetricsRegistry::setCurrentStream(int stream) noexcept {
+    threadStream = stream;
+}
+
+int MetricsRegistry::currentStream() noexcept {
+    return threadStream;
+}
+
+void LoadPhaseReport::record(const std::string &phase, uint64_t micros) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto &histogram = _phases[phase];
+    if (!histogram)
+        histogram.reset(new MetricHistogram());
+    histogram->record(micros);
+}
+
+std::map<std::string, InferenceEngineMetricInfo> LoadPhaseReport::snapshot() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::map<std::string, InferenceEngineMetricInfo> metrics;
+    for (const auto &phase : _phases)
+        metrics["Load." + phase.first] = phase.second->snapshot();
+    return metrics;
+}
+
+void LoadPhaseReport::setCurrent(LoadPhaseReport *report) noexcept {
+    threadLoadReport = report;
+}
+
+LoadPhaseReport *LoadPhaseReport::current() noexcept {
+    return threadLoadReport;
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,236 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ie_api.h"
+#include "ie_common.h"
+
+namespace InferenceEngine {
+
+enum : size_t {
+    // number of the shards of the metrics, the threads are spread over them round-robin
+    METRIC_SHARDS_NUM = 8
+};
+
+/**
+ * @brief Monotonic counter updated without locks: every thread increments the relaxed atomic of its own shard
+ * (cache line), the readers sum the shards, so they never block the writers
+ */
+class INFERENCE_ENGINE_API_CLASS(MetricCounter) {
+public:
+    MetricCounter();
+
+    void increment() noexcept;
+
+    uint64_t value() const;
+
+private:
+    struct Shard {
+        std::atomic<uint64_t> value;
+        // keeps the shards of the different threads in the different cache lines
+        char padding[64];
+    };
+
+    Shard _shards[METRIC_SHARDS_NUM];
+};
+
+/**
+ * @brief Latency histogram with the power of two buckets (see InferenceEngineMetricInfo::buckets), sharded
+ * per thread like MetricCounter
+ */
+class INFERENCE_ENGINE_API_CLASS(MetricHistogram) {
+public:
+    enum : size_t {
+        BUCKETS_NUM = 32
+    };
+
+    MetricHistogram();
+
+    void record(uint64_t micros) noexcept;
+
+    InferenceEngineMetricInfo snapshot() const;
+
+    /**
+     * @brief Index of the bucket of the sample: 0 below 1 microsecond, floor(log2(micros)) + 1 above, clamped
+     */
+    static size_t bucketOf(uint64_t micros) noexcept;
+
+private:
+    struct Shard {
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> sum;
+        std::atomic<uint64_t> buckets[BUCKETS_NUM];
+        char padding[64];
+    };
+
+    Shard _shards[METRIC_SHARDS_NUM];
+};
+
+/**
+ * @brief Always-on metrics of an executable network: the request counters and the latency histograms of the stages
+ * of the infer requests, per stream. Recording is lock-free and takes a few relaxed atomic increments.
+ */
+class INFERENCE_ENGINE_API_CLASS(MetricsRegistry) {
+public:
+    typedef std::shared_ptr<MetricsRegistry> Ptr;
+
+    enum Stage {
+        // from the start of the async request till its inference begins in the executor
+        QUEUE_WAIT,
+        // the input preprocessing (resize, layout and precision conversion) done by the plugin
+        PREPROCESSING,
+        // the whole synchronous inference of the request, including the preprocessing
+        INFER,
+        // the completion callback of the async request
+        COMPLETION_CALLBACK,
+        STAGES_NUM
+    };
+
+    enum Counter {
+        REQUESTS,
+        FAILED_REQUESTS,
+        // the async requests completed with an error because their deadline expired in the queue
+        EXPIRED_REQUESTS,
+        COUNTERS_NUM
+    };
+
+    /**
+     * @brief Scoped timer recording the lifetime of the object to the stage, does nothing for a null registry
+     */
+    class Scope {
+    public:
+        Scope(MetricsRegistry *registry, Stage stage, int stream = currentStream())
+                : _registry(registry), _stage(stage), _stream(stream) {
+            if (_registry) _start = std::chrono::steady_clock::now();
+        }
+
+        ~Scope() {
+            if (_registry) _registry->record(_stage, _stream, _start);
+        }
+
+    private:
+        MetricsRegistry *_registry;
+        Stage _stage;
+        int _stream;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    /**
+     * @param streams - number of the streams of the executable network, the stages are kept per stream
+     */
+    explicit MetricsRegistry(size_t streams = 1);
+
+    size_t streams() const {
+        return _stages.size() / STAGES_NUM;
+    }
+
+    void record(Stage stage, int stream, uint64_t micros) noexcept;
+
+    void record(Stage stage, int stream, std::chrono::steady_clock::time_point start) noexcept {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        record(stage, stream, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    }
+
+    void increment(Counter counter) noexcept;
+
+    /**
+     * @brief Gets the current values of all the metrics, the per-stream histograms are reported for several streams
+     */
+    std::map<std::string, InferenceEngineMetricInfo> snapshot() const;
+
+    /**
+     * @brief Binds the calling thread to the stream, the stages it runs are attributed to that stream
+     */
+    static void setCurrentStream(int stream) noexcept;
+
+    /**
+     * @brief Stream of the calling thread, 0 if the thread is not bound to a stream
+     */
+    static int currentStream() noexcept;
+
+private:
+    std::vector<std::unique_ptr<MetricHistogram>> _stages;  // STAGES_NUM histograms per stream
+    MetricCounter _counters[COUNTERS_NUM];
+};
+
+/**
+ * @brief Timings of the phases of the load of a network, reported by the metrics as "Load.<phase>" histograms: the
+ * samples of a phase run several times (per stream or per weights blob) are accumulated. The phases may be nested,
+ * the "Load.Total" is the whole LoadNetwork of the plugin.
+ * The report of the load in progress is bound to the loading thread, so the code deep in the plugin records its
+ * phases with LoadPhaseScope without passing the report around.
+ */
+class INFERENCE_ENGINE_API_CLASS(LoadPhaseReport) {
+public:
+    typedef std::shared_ptr<LoadPhaseReport> Ptr;
+
+    /**
+     * @brief Binds the calling thread to the report for the lifetime of the object, the previous binding is restored
+     */
+    class Binding {
+    public:
+        explicit Binding(LoadPhaseReport *report) : _previous(current()) {
+            setCurrent(report);
+        }
+
+        ~Binding() {
+            setCurrent(_previous);
+        }
+
+    private:
+        LoadPhaseReport *_previous;
+    };
+
+    void record(const std::string &phase, uint64_t micros);
+
+    std::map<std::string, InferenceEngineMetricInfo> snapshot() const;
+
+    static void setCurrent(LoadPhaseReport *report) noexcept;
+
+    /**
+     * @brief Report of the load the calling thread takes part in, nullptr outside of a load
+     */
+    static LoadPhaseReport *current() noexcept;
+
+private:
+    mutable std::mutex _mutex;
+    std::map<std::string, std::unique_ptr<MetricHistogram>> _phases;
+};
+
+/**
+ * @brief Scoped timer recording the lifetime of the object to a phase of the load, does nothing outside of a load
+ */
+class LoadPhaseScope {
+public:
+    explicit LoadPhaseScope(const char *phase, LoadPhaseReport *report = LoadPhaseReport::current())
+            : _report(report), _phase(phase) {
+        if (_report) _start = std::chrono::steady_clock::now();
+    }
+
+    ~LoadPhaseScope() {
+        if (!_report) return;
+        auto elapsed = std::chrono::steady_clock::now() - _start;
+        // the timer is not expected to throw from the destructor, the phase is lost on a failure
+        try {
+            _report->record(_phase, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+        } catch (...) {
+        }
+    }
+
+private:
+    LoadPhaseReport *_report;
+    const char *_phase;
+    std::chrono::steady_clock::time_point _start;
+};
+
+}  // namespace InferenceEngine
@@ -114,4 +114,21 @@ bool Task::isOnWait() {
     return _isOnWait;
 }
 
+void Task::setPriority(int priority) {
+    _priority = priority;
+}
+
+int Task::getPriority() const {
+    return _priority;
+}
+
+void Task::setDeadline(int64_t millis_deadline) {
+    _deadline = millis_deadline > 0 ? std::chrono::steady_clock::now() + std::chrono::milliseconds(millis_deadline)
+                                    : std::chrono::steady_clock::time_point::max();
+}
+
+bool Task::isExpired() const {
+    return _deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() > _deadline;
+}
+
 }  // namespace InferenceEngine
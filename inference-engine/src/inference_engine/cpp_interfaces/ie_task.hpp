@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <vector>
 #include <mutex>
 #include <memory>
@@ -81,6 +82,24 @@ public:
 
     bool isOnWait();
 
+    /**
+     * @brief Sets the priority of the task in the queues of the executors, the higher the sooner
+     */
+    void setPriority(int priority);
+
+    int getPriority() const;
+
+    /**
+     * @brief Sets the deadline of the task, 0 for no deadline
+     * @param millis_deadline the deadline in milliseconds from now
+     */
+    void setDeadline(int64_t millis_deadline);
+
+    /**
+     * @return true if the deadline of the task has passed
+     */
+    bool isExpired() const;
+
 protected:
     void setStatus(Status status);
 
@@ -92,6 +111,9 @@ protected:
     std::condition_variable _isTaskDoneCondVar;
 
     bool _isOnWait = false;
+
+    int _priority = 0;
+    std::chrono::steady_clock::time_point _deadline = std::chrono::steady_clock::time_point::max();
 };
 
 }  // namespace InferenceEngine
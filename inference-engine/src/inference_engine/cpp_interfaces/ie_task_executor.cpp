@@ -2,13 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <memory>
 #include <mutex>
 #include <condition_variable>
 #include <thread>
-#include <queue>
+#include <utility>
 #include <ie_profiling.hpp>
 #include "details/ie_exception.hpp"
 #include "ie_task.hpp"
@@ -16,26 +17,34 @@
 
 namespace InferenceEngine {
 
-TaskExecutor::TaskExecutor(std::string name) : _isStopped(false), _name(name) {
+TaskExecutor::TaskExecutor(std::string name, int64_t spinMicros)
+        : _pendingTasks(0), _spinMicros(spinMicros), _isStopped(false), _name(name) {
     _thread = std::make_shared<std::thread>([&] {
         anotateSetThreadName(("TaskExecutor thread for " + _name).c_str());
         while (!_isStopped) {
             bool isQueueEmpty;
             Task::Ptr currentTask;
+            // the new task is picked up without the wakeup if it comes while the thread spins
+            spinWait(_spinMicros, [&] { return _pendingTasks > 0; });
             {  // waiting for the new task or for stop signal
                 std::unique_lock<std::mutex> lock(_queueMutex);
-                _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
-                isQueueEmpty = _taskQueue.empty();
-                if (!isQueueEmpty) currentTask = _taskQueue.front();
+                _queueCondVar.wait(lock, [&]() { return _taskQueueHead != _taskQueue.size() || _isStopped; });
+                isQueueEmpty = _taskQueueHead == _taskQueue.size();
+                if (!isQueueEmpty) {
+                    // the running task leaves the queue, so the tasks of a higher priority are put ahead of the waiting ones only
+                    currentTask = std::move(_taskQueue[_taskQueueHead++]);
+                    _pendingTasks--;
+                }
             }
             if (_isStopped && isQueueEmpty)
                 break;
             if (!isQueueEmpty) {
                 currentTask->runNoThrowNoBusyCheck();
                 std::unique_lock<std::mutex> lock(_queueMutex);
-                _taskQueue.pop();
-                isQueueEmpty = _taskQueue.empty();
+                isQueueEmpty = _taskQueueHead == _taskQueue.size();
                 if (isQueueEmpty) {
+                    _taskQueue.clear();
+                    _taskQueueHead = 0;
                     // notify dtor, that all tasks were completed
                     _queueCondVar.notify_all();
                 }
@@ -47,8 +56,8 @@ TaskExecutor::TaskExecutor(std::string name) : _isStopped(false), _name(name) {
 TaskExecutor::~TaskExecutor() {
     {
         std::unique_lock<std::mutex> lock(_queueMutex);
-        if (!_taskQueue.empty()) {
-            _queueCondVar.wait(lock, [this]() { return _taskQueue.empty(); });
+        if (_taskQueueHead != _taskQueue.size()) {
+            _queueCondVar.wait(lock, [this]() { return _taskQueueHead == _taskQueue.size(); });
         }
         _isStopped = true;
         _queueCondVar.notify_all();
@@ -62,7 +71,18 @@ TaskExecutor::~TaskExecutor() {
 bool TaskExecutor::startTask(Task::Ptr task) {
     if (!task->occupy()) return false;
     std::unique_lock<std::mutex> lock(_queueMutex);
-    _taskQueue.push(task);
+    if (_taskQueueHead != 0 && _taskQueue.size() == _taskQueue.capacity()) {
+        // the executed tasks are dropped instead of growing the storage
+        _taskQueue.erase(_taskQueue.begin(), _taskQueue.begin() + _taskQueueHead);
+        _taskQueueHead = 0;
+    }
+    // the waiting tasks are kept ordered by priority, the task goes after all the tasks of the same or higher one
+    auto position = std::upper_bound(_taskQueue.begin() + _taskQueueHead, _taskQueue.end(), task,
+                                     [](const Task::Ptr &lhs, const Task::Ptr &rhs) {
+                                         return lhs->getPriority() > rhs->getPriority();
+                                     });
+    _taskQueue.insert(position, task);
+    _pendingTasks++;
     _queueCondVar.notify_all();
     return true;
 }
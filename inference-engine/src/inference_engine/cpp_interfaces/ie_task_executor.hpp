@@ -4,13 +4,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <memory>
 #include <mutex>
 #include <condition_variable>
 #include <thread>
-#include <queue>
 #include "ie_api.h"
 #include "details/ie_exception.hpp"
 #include "cpp_interfaces/ie_task_synchronizer.hpp"
@@ -18,19 +19,60 @@
 #include "cpp_interfaces/exception2status.hpp"
 #include "cpp_interfaces/ie_itask_executor.hpp"
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
 namespace InferenceEngine {
 
+/**
+ * @brief Hints the core that the thread spins, so the sibling hyper-thread and the power are not wasted on it
+ */
+inline void cpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+
+/**
+ * @brief Spins until the predicate is true or the time is over, the waiter keeps the core instead of the OS wakeup
+ * @param micros - the longest time of the spinning in microseconds, the predicate is checked once for 0
+ * @return the last value of the predicate
+ */
+template <typename Predicate>
+bool spinWait(int64_t micros, Predicate predicate) {
+    if (predicate())
+        return true;
+    if (micros <= 0)
+        return false;
+    const auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(micros);
+    do {
+        for (int i = 0; i < 16; i++)
+            cpuRelax();
+        if (predicate())
+            return true;
+    } while (std::chrono::steady_clock::now() < until);
+    return false;
+}
+
 class INFERENCE_ENGINE_API_CLASS(TaskExecutor) : public ITaskExecutor {
 public:
     typedef std::shared_ptr<TaskExecutor> Ptr;
 
-    TaskExecutor(std::string name = "Default");
+    /**
+     * @param name - name of the executor
+     * @param spinMicros - the time the idle thread spins for a new task before it blocks, 0 to block at once
+     */
+    TaskExecutor(std::string name = "Default", int64_t spinMicros = 0);
 
     ~TaskExecutor();
 
     /**
      * @brief Add task for execution and notify working thread about new task to start.
-     * @note can be called from multiple threads - tasks will be added to the queue and executed one-by-one in FIFO mode.
+     * @note can be called from multiple threads - tasks will be added to the queue and executed one-by-one in FIFO mode
+     * among the tasks of the same priority, a task of a higher priority goes ahead of the waiting ones.
      * @param task - shared pointer to the task to start
      *  @return true if succeed to add task, otherwise - false
      */
@@ -40,7 +82,13 @@ private:
     std::shared_ptr<std::thread> _thread;
     std::mutex _queueMutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task::Ptr> _taskQueue;
+    // the queue of the tasks from _taskQueueHead, the storage is kept while the queue is emptied and filled again,
+    // so the tasks are queued without memory allocations once the queue has grown to its working size
+    std::vector<Task::Ptr> _taskQueue;
+    size_t _taskQueueHead = 0;
+    // the queued tasks, read by the spinning thread without the lock
+    std::atomic<size_t> _pendingTasks;
+    int64_t _spinMicros;
     bool _isStopped;
     std::string _name;
 };
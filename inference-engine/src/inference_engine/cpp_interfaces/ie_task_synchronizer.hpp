@@ -9,7 +9,6 @@
 #include <mutex>
 #include <condition_variable>
 #include <thread>
-#include <queue>
 #include "details/ie_exception.hpp"
 
 namespace InferenceEngine {
@@ -20,7 +19,9 @@ class TaskSynchronizer {
 public:
     typedef std::shared_ptr<TaskSynchronizer> Ptr;
 
-    TaskSynchronizer() : _taskCount(0) {}
+    TaskSynchronizer() : _taskCount(0) {
+        _taskQueue.reserve(MAX_NUMBER_OF_TASKS_IN_QUEUE);
+    }
 
     virtual void lock() {
         auto taskID = _addTaskToQueue();
@@ -32,7 +33,7 @@ public:
         if (!_taskQueue.empty()) {
             {
                 std::lock_guard<std::mutex> lock(_queueMutex);
-                _taskQueue.pop();
+                _taskQueue.erase(_taskQueue.begin());
             }
             _taskCondVar.notify_all();
         }
@@ -44,7 +45,8 @@ public:
 
 private:
     unsigned int _taskCount;
-    std::queue<unsigned int> _taskQueue;
+    // the queue is short, so it's kept in a vector which doesn't allocate the memory once it has grown
+    std::vector<unsigned int> _taskQueue;
     std::mutex _queueMutex;
     std::mutex _taskMutex;
     std::condition_variable _taskCondVar;
@@ -60,7 +62,7 @@ protected:
         if (!_taskQueue.empty() && _taskQueue.size() >= MAX_NUMBER_OF_TASKS_IN_QUEUE) {
             THROW_IE_EXCEPTION << "Failed to add more than " << MAX_NUMBER_OF_TASKS_IN_QUEUE << " tasks to queue";
         }
-        _taskQueue.push(taskID);
+        _taskQueue.push_back(taskID);
         return taskID;
     }
 
@@ -0,0 +1,145 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+#include <ie_profiling.hpp>
+#include "cpp_interfaces/ie_thread_pool_task_executor.hpp"
+
+namespace InferenceEngine {
+
+constexpr size_t ThreadPoolTaskExecutor::queueSize;
+
+ThreadPoolTaskExecutor::ThreadPoolTaskExecutor(std::string name, size_t threadsNum, size_t spinCount)
+        : _queue(queueSize), _pushPos(0), _popPos(0), _spinning(0), _sleeping(0), _isStopped(false),
+          _name(name), _spinCount(spinCount) {
+    for (size_t i = 0; i < queueSize; i++) {
+        _queue[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    if (threadsNum == 0) {
+        threadsNum = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (size_t i = 0; i < threadsNum; i++) {
+        _threads.emplace_back([this] {
+            anotateSetThreadName(("ThreadPoolTaskExecutor thread for " + _name).c_str());
+            run();
+        });
+    }
+}
+
+ThreadPoolTaskExecutor::~ThreadPoolTaskExecutor() {
+    // the threads finish the queued tasks before they stop
+    {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _isStopped = true;
+    }
+    _sleepCondVar.notify_all();
+    for (auto &&thread : _threads) {
+        if (thread.joinable()) thread.join();
+    }
+}
+
+size_t ThreadPoolTaskExecutor::getThreadsNum() const {
+    return _threads.size();
+}
+
+bool ThreadPoolTaskExecutor::startTask(Task::Ptr task) {
+    if (!task->occupy()) return false;
+    while (!tryPush(task)) {
+        // the queue is full, the threads are busy with the tasks, so it's not worth to spin here
+        std::this_thread::yield();
+    }
+    // orders the push before the check of the idle threads, the threads do the same in the opposite direction
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_spinning == 0 && _sleeping != 0) {
+        wakeUpIfNeeded();
+    }
+    return true;
+}
+
+// the bounded MPMC queue by Dmitry Vyukov: every cell has a sequence number, which tells whether it's free to push
+// at the given position or holds the value for the given position
+bool ThreadPoolTaskExecutor::tryPush(Task::Ptr &task) {
+    size_t pos = _pushPos.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell &cell = _queue[pos % queueSize];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.task = std::move(task);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = _pushPos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool ThreadPoolTaskExecutor::tryPop(Task::Ptr &task) {
+    size_t pos = _popPos.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell &cell = _queue[pos % queueSize];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+        if (diff == 0) {
+            if (_popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                task = std::move(cell.task);
+                cell.task = nullptr;
+                cell.sequence.store(pos + queueSize, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = _popPos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool ThreadPoolTaskExecutor::isEmpty() const {
+    return _pushPos.load() == _popPos.load();
+}
+
+void ThreadPoolTaskExecutor::wakeUpIfNeeded() {
+    std::lock_guard<std::mutex> lock(_sleepMutex);
+    _sleepCondVar.notify_one();
+}
+
+void ThreadPoolTaskExecutor::run() {
+    for (;;) {
+        Task::Ptr task;
+        _spinning++;
+        for (size_t i = 0; i <= _spinCount && !tryPop(task); i++) {
+            std::this_thread::yield();
+        }
+        _spinning--;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (!task) {
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            _sleeping++;
+            // the counter is incremented before the check, so a task pushed meanwhile either wakes this thread or is seen
+            _sleepCondVar.wait(lock, [this] { return _isStopped || !isEmpty(); });
+            _sleeping--;
+            if (_isStopped && isEmpty()) break;
+            continue;
+        }
+
+        // the rest of the tasks is picked up by the next thread, so a burst of the tasks wakes the threads one by one
+        if (_sleeping != 0 && !isEmpty()) {
+            wakeUpIfNeeded();
+        }
+        task->runNoThrowNoBusyCheck();
+    }
+}
+
+}  // namespace InferenceEngine
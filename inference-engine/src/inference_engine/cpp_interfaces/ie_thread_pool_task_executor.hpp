@@ -0,0 +1,82 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ie_api.h"
+#include "cpp_interfaces/ie_task.hpp"
+#include "cpp_interfaces/ie_itask_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class ThreadPoolTaskExecutor
+ * @brief Runs the tasks on a pool of threads. The tasks are kept in a bounded lock-free queue, the idle threads spin
+ * for a while before they sleep, and a woken thread wakes up the next one if there are more tasks in the queue.
+ * @note Unlike TaskExecutor, the tasks are started in FIFO order, but may run concurrently and finish in any order.
+ */
+class INFERENCE_ENGINE_API_CLASS(ThreadPoolTaskExecutor) : public ITaskExecutor {
+public:
+    typedef std::shared_ptr<ThreadPoolTaskExecutor> Ptr;
+
+    /**
+     * @param name - the name of the threads
+     * @param threadsNum - number of the threads, 0 means the number of the hardware threads
+     * @param spinCount - number of the attempts to get a task before an idle thread sleeps
+     */
+    explicit ThreadPoolTaskExecutor(std::string name = "Default", size_t threadsNum = 0, size_t spinCount = 1000);
+
+    ~ThreadPoolTaskExecutor();
+
+    /**
+     * @brief Adds the task to the queue and wakes up a sleeping thread if there is no one spinning
+     * @note can be called from multiple threads
+     * @param task - shared pointer to the task to start
+     * @return true if succeed to add task, otherwise - false
+     */
+    bool startTask(Task::Ptr task) override;
+
+    size_t getThreadsNum() const;
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Task::Ptr task;
+    };
+
+    bool tryPush(Task::Ptr &task);
+
+    bool tryPop(Task::Ptr &task);
+
+    bool isEmpty() const;
+
+    void wakeUpIfNeeded();
+
+    void run();
+
+    static constexpr size_t queueSize = 1024;
+
+    std::vector<Cell> _queue;
+    std::atomic<size_t> _pushPos;
+    std::atomic<size_t> _popPos;
+
+    std::atomic<size_t> _spinning;
+    std::atomic<size_t> _sleeping;
+    std::mutex _sleepMutex;
+    std::condition_variable _sleepCondVar;
+    std::atomic<bool> _isStopped;
+
+    std::vector<std::thread> _threads;
+    std::string _name;
+    size_t _spinCount;
+};
+
+}  // namespace InferenceEngine
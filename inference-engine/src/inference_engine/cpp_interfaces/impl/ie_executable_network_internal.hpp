@@ -9,6 +9,7 @@
 #include <map>
 #include <string>
 #include <ie_plugin_ptr.hpp>
+#include "cpp_interfaces/ie_metrics.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
@@ -72,12 +73,30 @@ public:
         return {};
     }
 
+    std::map<std::string, InferenceEngineMetricInfo> GetMetrics() override {
+        auto metrics = _metrics->snapshot();
+        if (_loadPhases) {
+            auto loadPhases = _loadPhases->snapshot();
+            metrics.insert(loadPhases.begin(), loadPhases.end());
+        }
+        return metrics;
+    }
+
+    /**
+     * @brief Sets the timings of the load of the network, reported by GetMetrics
+     */
+    void setLoadPhaseReport(LoadPhaseReport::Ptr report) {
+        _loadPhases = report;
+    }
 
 protected:
     InferenceEngine::InputsDataMap _networkInputs;
     InferenceEngine::OutputsDataMap _networkOutputs;
 
     InferencePluginInternalPtr _plugin;
+    // shared with the infer requests, the plugins with several streams replace it by the per-stream one
+    MetricsRegistry::Ptr _metrics = std::make_shared<MetricsRegistry>();
+    LoadPhaseReport::Ptr _loadPhases;
 };
 
 }  // namespace InferenceEngine
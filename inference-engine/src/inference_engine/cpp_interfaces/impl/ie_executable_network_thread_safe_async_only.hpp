@@ -28,6 +28,7 @@ public:
     void CreateInferRequest(IInferRequest::Ptr &asyncRequest) override {
         auto asyncRequestImpl = this->CreateAsyncInferRequestImpl(_networkInputs, _networkOutputs);
         asyncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+        asyncRequestImpl->setMetricsRegistry(_metrics);
         asyncRequest.reset(new InferRequestBase<AsyncInferRequestInternal>(asyncRequestImpl),
                            [](IInferRequest *p) { p->Release(); });
         asyncRequestImpl->SetPublicInterfacePtr(asyncRequest);
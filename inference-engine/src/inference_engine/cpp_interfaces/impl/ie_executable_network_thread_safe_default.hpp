@@ -40,6 +40,7 @@ public:
     void CreateInferRequest(IInferRequest::Ptr &asyncRequest) override {
         auto syncRequestImpl = this->CreateInferRequestImpl(_networkInputs, _networkOutputs);
         syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+        syncRequestImpl->setMetricsRegistry(_metrics);
         auto asyncTreadSafeImpl = std::make_shared<AsyncInferRequestThreadSafeDefault>(
                 syncRequestImpl, _taskExecutor, _taskSynchronizer, _callbackExecutor);
         asyncRequest.reset(new InferRequestBase<AsyncInferRequestThreadSafeDefault>(asyncTreadSafeImpl),
@@ -0,0 +1,122 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "blob_factory.hpp"
+#include "cpp_interfaces/exception2status.hpp"
+#include "cpp_interfaces/impl/ie_infer_async_request_internal.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief The request inferred by the requests of the wrapped networks, e.g. by a device request of MULTI or as a part
+ * of the batch of the auto-batching. The executable network takes the started request with scheduleImpl, copies its
+ * blobs to and from a wrapped request and calls complete once it is inferred.
+ */
+class AsyncInferRequestForwardingInternal : public AsyncInferRequestInternal {
+public:
+    typedef std::shared_ptr<AsyncInferRequestForwardingInternal> Ptr;
+
+    AsyncInferRequestForwardingInternal(InputsDataMap networkInputs, OutputsDataMap networkOutputs)
+            : AsyncInferRequestInternal(networkInputs, networkOutputs) {
+        for (auto &&input : _networkInputs) {
+            _inputs[input.first] = make_blob_with_precision(input.second->getTensorDesc());
+            _inputs[input.first]->allocate();
+        }
+        for (auto &&output : _networkOutputs) {
+            _outputs[output.first] = make_blob_with_precision(output.second->getTensorDesc());
+            _outputs[output.first]->allocate();
+        }
+    }
+
+    ~AsyncInferRequestForwardingInternal() override {
+        // the network refers to the request and its blobs till it's inferred
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done.wait(lock, [this] { return !_isBusy; });
+    }
+
+    void InferImpl() override {
+        StartAsyncImpl();
+        auto status = Wait(IInferRequest::WaitMode::RESULT_READY);
+        if (status != OK) {
+            THROW_IE_EXCEPTION << "Inference of the wrapped request failed with the status " << status;
+        }
+    }
+
+    void StartAsyncImpl() override {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_isBusy) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+            _isBusy = true;
+            _isStarted = true;
+            _status = RESULT_NOT_READY;
+        }
+        scheduleImpl();
+    }
+
+    StatusCode Wait(int64_t millis_timeout) override {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_isStarted) return INFER_NOT_STARTED;
+        if (millis_timeout == IInferRequest::WaitMode::RESULT_READY) {
+            _done.wait(lock, [this] { return !_isBusy; });
+        } else if (millis_timeout > 0) {
+            _done.wait_for(lock, std::chrono::milliseconds(millis_timeout), [this] { return !_isBusy; });
+        }
+        return _isBusy ? RESULT_NOT_READY : _status;
+    }
+
+    /**
+     * @brief The wrapped requests are shared by the requests, so none of their counters belongs to this one
+     */
+    void GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    const BlobMap &getInputs() const {
+        return _inputs;
+    }
+
+    const BlobMap &getOutputs() const {
+        return _outputs;
+    }
+
+    /**
+     * @brief Called by the network when the wrapped request has inferred this one
+     */
+    void complete(StatusCode status) {
+        // the callback can start the request again, so the request is released before it
+        auto callback = _callback;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isBusy = false;
+            _status = status;
+            _done.notify_all();
+        }
+        if (callback) {
+            callback(_publicInterface.lock(), status);
+        }
+    }
+
+protected:
+    /**
+     * @brief Gives the started request to the executable network, it returns immediately
+     */
+    virtual void scheduleImpl() = 0;
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _done;
+    bool _isStarted = false;
+    bool _isBusy = false;
+    StatusCode _status = INFER_NOT_STARTED;
+};
+
+}  // namespace InferenceEngine
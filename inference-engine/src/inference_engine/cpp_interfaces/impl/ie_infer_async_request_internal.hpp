@@ -36,6 +36,13 @@ public:
         _userData = data;
     }
 
+    /**
+     * @brief The requests started by StartAsyncImpl are not queued by default, so there is nothing to prioritize
+     */
+    void SetPriority(int priority, int64_t millis_deadline) override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
     /**
      * @brief Set weak pointer to the corresponding public interface: IInferRequest. This allow to pass it to
      * IInferRequest::CompletionCallback
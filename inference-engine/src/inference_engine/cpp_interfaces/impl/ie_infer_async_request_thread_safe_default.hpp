@@ -4,16 +4,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <map>
 #include <list>
 #include <string>
+#include <vector>
 #include <mutex>
 #include <exception>
 #include <cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp>
 #include <cpp_interfaces/ie_task_with_stages.hpp>
 #include <cpp_interfaces/ie_task_executor.hpp>
 #include <cpp_interfaces/exception2status.hpp>
+#include <cpp_interfaces/ie_metrics.hpp>
 #include "ie_infer_async_request_thread_safe_internal.hpp"
 
 namespace InferenceEngine {
@@ -141,6 +145,9 @@ public:
     }
 
     virtual void startAsyncTask() {
+        _startTime = std::chrono::steady_clock::now();
+        _currentTask->setPriority(_priority);
+        _currentTask->setDeadline(_millisDeadline);
         if (!_requestExecutor->startTask(_currentTask)) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
     }
 
@@ -169,9 +176,18 @@ public:
     virtual StagedTask::Ptr createAsyncRequestTask() {
         return std::make_shared<StagedTask>([this]() {
             auto asyncTaskCopy = _asyncTask;
+            MetricsRegistry *metrics = _syncRequest->getMetricsRegistry().get();
             try {
                 switch (asyncTaskCopy->getStage()) {
                     case 2: {
+                        // the callback is run by another executor, so it is attributed to the stream of the inference
+                        _metricsStream = _syncRequest->getMetricsStream();
+                        if (metrics) metrics->record(MetricsRegistry::QUEUE_WAIT, _metricsStream, _startTime);
+                        // the request waited in the queue for too long, so its result is not needed anymore
+                        if (asyncTaskCopy->isExpired()) {
+                            if (metrics) metrics->increment(MetricsRegistry::EXPIRED_REQUESTS);
+                            THROW_IE_EXCEPTION << "The deadline of the infer request has expired before the inference";
+                        }
                         _syncRequest->Infer();
                         asyncTaskCopy->stageDone();
                         if (_callbackManager.isCallbackEnabled()) {
@@ -184,6 +200,8 @@ public:
                     case 1: {
                         setIsRequestBusy(false);
                         asyncTaskCopy->stageDone();
+                        MetricsRegistry::Scope scope(_callbackManager.isCallbackEnabled() ? metrics : nullptr,
+                                                     MetricsRegistry::COMPLETION_CALLBACK, _metricsStream);
                         _callbackManager.runCallback();
                     }
                         break;
@@ -207,6 +225,21 @@ public:
         if (millis_timeout == IInferRequest::WaitMode::STATUS_ONLY) {
             status = taskCopy->getStatus();
         } else {
+            if (_waitSpinMicros > 0) {
+                // polls the request first, the short inferences complete without the wakeup of the waiting thread
+                const int64_t spinMicros = millis_timeout < 0 ? _waitSpinMicros
+                                                          : std::min(_waitSpinMicros, millis_timeout * 1000);
+                const auto spinStart = std::chrono::steady_clock::now();
+                spinWait(spinMicros, [&] {
+                    auto sts = taskCopy->getStatus();
+                    return sts == Task::TS_DONE || sts == Task::TS_ERROR || sts == Task::TS_INITIAL;
+                });
+                if (millis_timeout > 0) {
+                    auto spun = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - spinStart).count();
+                    millis_timeout = std::max<int64_t>(0, millis_timeout - spun);
+                }
+            }
             status = taskCopy->wait(millis_timeout);
             setIsRequestBusy(false);
         }
@@ -231,6 +264,10 @@ public:
         _syncRequest->SetBlob(name, data);
     }
 
+    void SetRoiBlobs_ThreadUnsafe(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois) override {
+        _syncRequest->SetRoiBlobs(name, frame, rois);
+    }
+
     void GetBlob_ThreadUnsafe(const char *name, Blob::Ptr &data) override {
         _syncRequest->GetBlob(name, data);
     }
@@ -248,6 +285,14 @@ public:
         _userData = data;
     }
 
+    /**
+     * @brief Sets the time Wait polls the request before it blocks, 0 (default) to block at once
+     * @param micros - the time of the polling in microseconds
+     */
+    void setWaitSpin(int64_t micros) {
+        _waitSpinMicros = std::max<int64_t>(0, micros);
+    }
+
     void SetPointerToPublicInterface(InferenceEngine::IInferRequest::Ptr ptr) {
         _callbackManager.set_publicInterface(ptr);
     }
@@ -256,6 +301,12 @@ public:
         _syncRequest->SetBatch(batch);
     }
 
+    void SetPriority_ThreadUnsafe(int priority, int64_t millis_deadline) override {
+        if (millis_deadline < 0) THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "The deadline can't be negative";
+        _priority = priority;
+        _millisDeadline = millis_deadline;
+    }
+
 protected:
     ITaskExecutor::Ptr _requestExecutor;
     TaskSynchronizer::Ptr _requestSynchronizer;
@@ -266,6 +317,11 @@ protected:
     std::list<StagedTask::Ptr> _listAsyncTasks;
     void *_userData;
     CallbackManager _callbackManager;
+    int _priority = 0;
+    int64_t _millisDeadline = 0;
+    std::chrono::steady_clock::time_point _startTime;
+    int _metricsStream = 0;
+    int64_t _waitSpinMicros = 0;
 };
 
 }  // namespace InferenceEngine
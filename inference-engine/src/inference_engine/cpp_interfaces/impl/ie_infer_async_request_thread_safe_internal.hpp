@@ -7,6 +7,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 #include <cpp_interfaces/ie_task.hpp>
 #include "cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
@@ -86,6 +87,11 @@ public:
         SetBlob_ThreadUnsafe(name, data);
     }
 
+    void SetRoiBlobs(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetRoiBlobs_ThreadUnsafe(name, frame, rois);
+    }
+
     void GetBlob(const char *name, Blob::Ptr &data) override {
         if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
         GetBlob_ThreadUnsafe(name, data);
@@ -96,6 +102,11 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    void SetPriority(int priority, int64_t millis_deadline) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetPriority_ThreadUnsafe(priority, millis_deadline);
+    }
+
     /**
      * @brief methods with _ThreadUnsafe prefix are to implement in plugins
      * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
@@ -115,9 +126,13 @@ public:
 
     virtual void SetBlob_ThreadUnsafe(const char *name, const Blob::Ptr &data) = 0;
 
+    virtual void SetRoiBlobs_ThreadUnsafe(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois) = 0;
+
     virtual void GetBlob_ThreadUnsafe(const char *name, Blob::Ptr &data) = 0;
 
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    virtual void SetPriority_ThreadUnsafe(int priority, int64_t millis_deadline) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -8,13 +8,16 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 #include <blob_factory.hpp>
 #include <ie_input_info.hpp>
 #include <ie_icnn_network.hpp>
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "debug.h"
 #include "cpp_interfaces/exception2status.hpp"
+#include "cpp_interfaces/ie_metrics.hpp"
 #include "ie_preprocess_data.hpp"
+#include "blob_transform.hpp"
 #include "ie_memcpy.h"
 
 namespace InferenceEngine {
@@ -75,8 +78,15 @@ public:
      * @brief Default common implementation for all plugins with checking input and output blobs before inference
      */
     void Infer() override {
-        checkBlobs();
-        InferImpl();
+        MetricsRegistry::Scope scope(_metrics.get(), MetricsRegistry::INFER, getMetricsStream());
+        if (_metrics) _metrics->increment(MetricsRegistry::REQUESTS);
+        try {
+            checkBlobs();
+            InferImpl();
+        } catch (...) {
+            if (_metrics) _metrics->increment(MetricsRegistry::FAILED_REQUESTS);
+            throw;
+        }
     };
 
     /**
@@ -96,7 +106,7 @@ public:
         DataPtr foundOutput;
         size_t dataSize = data->size();
         if (findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
-            if (foundInput->getInputPrecision() != data->precision()) {
+            if (foundInput->getInputPrecision() != data->precision() && !isConvertedByPreprocessing(foundInput, data)) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                    << "Failed to set Blob with precision not corresponding to user input precision";
             }
@@ -106,12 +116,25 @@ public:
                 // Stores the given blob as ROI blob. It will be used to fill in network input during pre-processing.
                 _preProcData[name].setRoiBlob(data);
             } else {
-                size_t inputSize = details::product(foundInput->getDims());
+                size_t inputSize = details::product(foundInput->getTensorDesc().getDims());
                 if (dataSize != inputSize) {
                     THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
                                        << dataSize << "!=" << inputSize << ").";
                 }
-                _inputs[name] = data;
+                const TensorDesc &inputDesc = foundInput->getTensorDesc();
+                Layout layout = data->getTensorDesc().getLayout();
+                if (layout != inputDesc.getLayout() && layout != Layout::ANY && inputDesc.getLayout() != Layout::ANY &&
+                    data->getTensorDesc().getDims() == inputDesc.getDims()) {
+                    // The blob is copied to the network layout during pre-processing
+                    if (_preProcData.find(name) == _preProcData.end()) {
+                        _inputs[name] = make_blob_with_precision(inputDesc);
+                        _inputs[name]->allocate();
+                    }
+                    _preProcData[name].setRoiBlob(data);
+                } else {
+                    _preProcData.erase(name);
+                    _inputs[name] = data;
+                }
             }
         } else {
             size_t outputSize = details::product(foundOutput->getDims());
@@ -127,6 +150,49 @@ public:
         }
     }
 
+    /**
+     * @brief Given optional implementation of setting ROIs of one frame to avoid need for it to be implemented by plugin
+     * @param name - a name of input blob.
+     * @param frame - a reference to the frame blob with the batch size 1, the precision and the number of channels
+     * must correspond to the network input.
+     * @param rois - ROIs inside of the frame resized to the consecutive batches of the input, no more than its batch.
+     */
+    void SetRoiBlobs(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois) override {
+        if (!frame)
+            THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Failed to set empty frame blob with name: \'" << name << "\'";
+        if (frame->buffer() == nullptr)
+            THROW_IE_EXCEPTION << "Input data was not allocated. Input name: \'" << name << "\'";
+        if (name == nullptr) {
+            THROW_IE_EXCEPTION << NOT_FOUND_str + "Failed to set frame blob with empty name";
+        }
+        InputInfo::Ptr foundInput;
+        DataPtr foundOutput;
+        if (!findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set ROIs to output with name: \'" << name << "\'";
+        }
+        if (foundInput->getInputPrecision() != frame->precision() && !isConvertedByPreprocessing(foundInput, frame)) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
+                               << "Failed to set Blob with precision not corresponding to user input precision";
+        }
+        if (foundInput->getPreProcess().getResizeAlgorithm() == ResizeAlgorithm::NO_RESIZE) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "ROIs are set to input with name: \'" << name
+                               << "\' without resize algorithm set";
+        }
+        const auto &inputDims = foundInput->getTensorDesc().getDims();
+        const auto &frameDims = frame->getTensorDesc().getDims();
+        if (inputDims.size() != 4 || frameDims.size() != 4 || frameDims[1] != inputDims[1]) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Network expected 4D input tensor with shape "
+                               << details::dumpVec(inputDims) << " but provided frame has shape "
+                               << details::dumpVec(frameDims) << ".";
+        }
+        if (rois.size() > inputDims[0]) {
+            THROW_IE_EXCEPTION << "Number of ROIs is greater than the network batch size ("
+                               << rois.size() << ">" << inputDims[0] << ").";
+        }
+        // The ROIs are resized to the batches of the network input during pre-processing.
+        _preProcData[name].setRoiBlobs(frame, rois);
+    }
+
     /**
      * @brief Given optional implementation of getting blob to avoid need for it to be implemented by plugin
      * @param name - a name of input or output blob.
@@ -143,11 +209,11 @@ public:
                 data = it->second.getRoiBlob();
             } else {
                 data = _inputs[name];
-                checkBlob(data, name, true, foundInput->getDims());
+                checkBlob(data, name, true, foundInput->getTensorDesc().getDims());
             }
         } else {
             data = _outputs[name];
-            checkBlob(data, name, false, foundOutput->getDims());
+            checkBlob(data, name, false, foundOutput->getTensorDesc().getDims());
         }
     }
 
@@ -155,6 +221,23 @@ public:
         _exeNetwork = exeNetwork;
     }
 
+    /**
+     * @brief Sets the metrics of the executable network the inferences of the request are recorded to
+     * @param stream - the stream the request is bound to, -1 for the stream of the thread running the inference
+     */
+    void setMetricsRegistry(const MetricsRegistry::Ptr &metrics, int stream = -1) {
+        _metrics = metrics;
+        _metricsStream = stream;
+    }
+
+    const MetricsRegistry::Ptr &getMetricsRegistry() const {
+        return _metrics;
+    }
+
+    int getMetricsStream() const {
+        return _metricsStream < 0 ? MetricsRegistry::currentStream() : _metricsStream;
+    }
+
     void checkBlobs() const {
         for (auto const &input : _inputs) {
             checkBlob(input.second, input.first, true);
@@ -172,19 +255,44 @@ public:
      * @brief Checks and executes input data pre-processing if needed.
      */
     void execDataPreprocessing(InferenceEngine::BlobMap& inputs, bool serial = false) {
+        if (_preProcData.empty())
+            return;
+        MetricsRegistry::Scope scope(_metrics.get(), MetricsRegistry::PREPROCESSING, getMetricsStream());
         for (auto &input : inputs) {
             // If there is a pre-process entry for an input then it must be pre-processed
             // using preconfigured resize algorithm.
             auto it = _preProcData.find(input.first);
-            if (it != _preProcData.end()) {
-                _preProcData[input.first].execute(input.second,
-                                                  _networkInputs[input.first]->getPreProcess().getResizeAlgorithm(),
-                                                  serial,
-                                                  m_curBatch);
+            if (it == _preProcData.end())
+                continue;
+            if (_networkInputs[input.first]->getPreProcess().getResizeAlgorithm() == ResizeAlgorithm::NO_RESIZE) {
+                // only the layout of the user blob differs from the network one
+                blob_copy(it->second.getRoiBlob(), input.second);
+            } else if (it->second.getRoiBlob()->precision() != input.second->precision()) {
+                // the U8 ROI blob is converted and normalized together with the resize
+                it->second.execute(input.second, _networkInputs[input.first]->getPreProcess(), serial, m_curBatch);
+            } else {
+                it->second.execute(input.second,
+                                   _networkInputs[input.first]->getPreProcess().getResizeAlgorithm(),
+                                   serial,
+                                   m_curBatch);
             }
         }
     }
 
+    /**
+     * @brief Checks whether the mean values of the input were already applied by execDataPreprocessing, the
+     * plugin must not apply them to the input blob again then.
+     * @param name - a name of input blob.
+     */
+    bool isNormalizedByPreprocessing(const std::string &name) const {
+        auto it = _preProcData.find(name);
+        auto input = _networkInputs.find(name);
+        if (it == _preProcData.end() || input == _networkInputs.end() || !it->second.getRoiBlob())
+            return false;
+        return isConvertedByPreprocessing(input->second, it->second.getRoiBlob()) &&
+               input->second->getPreProcess().getMeanVariant() == MEAN_VALUE;
+    }
+
 protected:
     InferenceEngine::InputsDataMap _networkInputs;
     InferenceEngine::OutputsDataMap _networkOutputs;
@@ -193,6 +301,19 @@ protected:
     ExecutableNetworkInternalPtr _exeNetwork;
     std::map<std::string, PreProcessData> _preProcData;  // pre-process data per input
     int m_curBatch;  // current batch value used in dynamic batching
+    MetricsRegistry::Ptr _metrics;  // nullptr until the executable network sets it, nothing is recorded then
+    int _metricsStream = -1;
+    bool _convertInPreprocessing = false;  // set by the plugins that check isNormalizedByPreprocessing
+
+protected:
+    /**
+     * @brief Checks whether the blob of another precision is converted to the input by the resize of the
+     * pre-processing, that is an U8 blob set to a FP32 input of the plugin which applies no means twice
+     */
+    bool isConvertedByPreprocessing(const InputInfo::Ptr &input, const Blob::Ptr &data) const {
+        return _convertInPreprocessing && input->getPreProcess().getResizeAlgorithm() != ResizeAlgorithm::NO_RESIZE &&
+               input->getInputPrecision() == Precision::FP32 && data->precision() == Precision::U8;
+    }
 
 protected:
     /**
@@ -211,12 +332,12 @@ protected:
         }
         auto foundInputPair = std::find_if(std::begin(_networkInputs),
                                            std::end(_networkInputs),
-                                           [&](const std::pair<std::string, InputInfo::Ptr> &pair) {
+                                           [&](const InputsDataMap::value_type &pair) {
                                                return pair.first == name;
                                            });
         auto foundOutputPair = std::find_if(std::begin(_networkOutputs),
                                             std::end(_networkOutputs),
-                                            [&](const std::pair<std::string, DataPtr> &pair) {
+                                            [&](const OutputsDataMap::value_type &pair) {
                                                 return pair.first == name;
                                             });
         if (foundOutputPair == std::end(_networkOutputs) && (foundInputPair == std::end(_networkInputs))) {
@@ -232,45 +353,43 @@ protected:
     }
 
     void checkBlob(const Blob::Ptr &blob, const std::string &name, bool isInput, const SizeVector& refDims = {}) const {
-        std::string bType = isInput ? "Input" : "Output";
-        std::string sType = isInput ? "input" : "output";
-        std::string strNotAllocated(bType + " data was not allocated.");
-        std::string strNotMatched("The " + sType + " blob size is not equal to the network " + sType + " size");
+        // the messages are built only on failure, the check runs on every inference
+        auto notAllocated = [isInput]() { return std::string(isInput ? "Input" : "Output") + " data was not allocated."; };
 
-        if (!blob) THROW_IE_EXCEPTION << strNotAllocated;
+        if (!blob) THROW_IE_EXCEPTION << notAllocated();
         size_t refSize;
         if (refDims.empty()) {
-            SizeVector dims;
             if (isInput) {
                 auto foundInputPair = std::find_if(std::begin(_networkInputs),
                                                    std::end(_networkInputs),
-                                                   [&](const std::pair<std::string, InputInfo::Ptr>& pair) {
+                                                   [&](const InputsDataMap::value_type& pair) {
                                                        return pair.first == name;
                                                    });
                 if (foundInputPair == std::end(_networkInputs)) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input with name: \'" << name << "\'";
                 }
-                dims = foundInputPair->second->getDims();
+                refSize = details::product(foundInputPair->second->getTensorDesc().getDims());
             } else {
                 auto foundOutputPair = std::find_if(std::begin(_networkOutputs),
                                                     std::end(_networkOutputs),
-                                                    [&](const std::pair<std::string, DataPtr>& pair) {
+                                                    [&](const OutputsDataMap::value_type& pair) {
                                                         return pair.first == name;
                                                     });
                 if (foundOutputPair == std::end(_networkOutputs)) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find output with name: \'" << name << "\'";
                 }
-                dims = foundOutputPair->second->getDims();
+                refSize = details::product(foundOutputPair->second->getTensorDesc().getDims());
             }
-            refSize = details::product(dims);
         } else {
             refSize = details::product(refDims);
         }
 
         if (refSize != blob->size()) {
-            THROW_IE_EXCEPTION << strNotMatched + ": got " << blob->size() << " expecting " << refSize;
+            std::string sType = isInput ? "input" : "output";
+            THROW_IE_EXCEPTION << "The " + sType + " blob size is not equal to the network " + sType + " size"
+                               << ": got " << blob->size() << " expecting " << refSize;
         }
-        if (blob->buffer() == nullptr) THROW_IE_EXCEPTION << strNotAllocated;
+        if (blob->buffer() == nullptr) THROW_IE_EXCEPTION << notAllocated();
     }
 };
 
@@ -9,12 +9,21 @@
 
 #pragma once
 
+#include <cstdio>
 #include <memory>
 #include <map>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <typeinfo>
 #include <blob_factory.hpp>
+#include <ie_plugin_config.hpp>
+#include "file_utils.h"
+#include "ie_network_cache.hpp"
 #include "graph_transformer.h"
+#include "net_pass.h"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "cpp_interfaces/ie_executor_manager.hpp"
 #include "cpp_interfaces/base/ie_executable_network_base.hpp"
 #include "cpp_interfaces/impl/ie_executable_network_internal.hpp"
 #include "ie_memcpy.h"
@@ -49,7 +58,8 @@ public:
         if (sts != OK) THROW_IE_EXCEPTION << resp.msg;
     }
     /**
-     * @brief most plugins successfully consume unreshapable networks - lets do it in base class
+     * @brief most plugins successfully consume unreshapable networks - lets do it in base class,
+     * the duplicated layers and the layers not contributing to the outputs are removed as well
      * WARNING: this functions modifies layers in input network and might affect application, that uses it
      */
     virtual ICNNNetwork&  RemoveConstLayers(ICNNNetwork &network) {
@@ -58,6 +68,9 @@ public:
             // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
             ConstTransformer transformator(implNetwork);
             transformator.fullTrim();
+            // the folded constants often become equal, so the duplicated branches are merged after the folding
+            NetPass::MergeDuplicatedLayers(network);
+            NetPass::RemoveDeadLayers(network);
         }
         return network;
     }
@@ -78,6 +91,41 @@ public:
     void LoadNetwork(IExecutableNetwork::Ptr &executableNetwork,
                      ICNNNetwork &network,
                      const std::map<std::string, std::string> &config) override {
+        auto threadsLimit = config.find(PluginConfigParams::KEY_PROCESS_THREADS_LIMIT);
+        if (threadsLimit != config.end()) {
+            int limit = -1;
+            try {
+                limit = std::stoi(threadsLimit->second);
+            } catch (const std::exception&) {}
+            if (limit < 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_PROCESS_THREADS_LIMIT
+                                   << ". Expected only non negative numbers (#threads)";
+            }
+            ExecutorManager::getInstance()->setThreadsLimit(static_cast<size_t>(limit));
+
+            std::map<std::string, std::string> loadConfig = config;
+            loadConfig.erase(PluginConfigParams::KEY_PROCESS_THREADS_LIMIT);
+            LoadNetwork(executableNetwork, network, loadConfig);
+            return;
+        }
+
+        auto cacheDir = config.find(PluginConfigParams::KEY_CACHE_DIR);
+        if (cacheDir != config.end()) {
+            std::map<std::string, std::string> loadConfig = config;
+            loadConfig.erase(PluginConfigParams::KEY_CACHE_DIR);
+            if (cacheDir->second.empty()) {
+                LoadNetwork(executableNetwork, network, loadConfig);
+            } else {
+                LoadNetworkCached(executableNetwork, network, loadConfig, cacheDir->second);
+            }
+            return;
+        }
+
+        // the phases of the load are recorded by the plugin code running in this thread
+        auto loadPhases = std::make_shared<LoadPhaseReport>();
+        LoadPhaseReport::Binding loadBinding(loadPhases.get());
+        std::unique_ptr<LoadPhaseScope> totalLoad(new LoadPhaseScope("Total"));
+
         InputsDataMap networkInputs;
         OutputsDataMap networkOutputs;
         network.getInputsInfo(networkInputs);
@@ -115,9 +163,16 @@ public:
             }
             _networkOutputs[it.first] = newData;
         }
-        auto impl = LoadExeNetworkImpl(RemoveConstLayers(network), config);
+        ICNNNetwork *cleanedNetwork = nullptr;
+        {
+            LoadPhaseScope removal("ConstLayersRemoval");
+            cleanedNetwork = &RemoveConstLayers(network);
+        }
+        auto impl = LoadExeNetworkImpl(*cleanedNetwork, config);
         impl->setNetworkInputs(_networkInputs);
         impl->setNetworkOutputs(_networkOutputs);
+        totalLoad.reset();
+        impl->setLoadPhaseReport(loadPhases);
         // skip setting shared ptr to avoid curricular dependency: ExecutableNetworkBase -> IExecutableNetworkInternal -> InferencePluginInternal
         if (!_isDeprecatedLoad) {
             impl->SetPointerToPluginInternal(shared_from_this());
@@ -211,6 +266,43 @@ public:
 
 
 protected:
+    /**
+     * @brief Imports the network compiled before from the cache directory, or compiles and exports it there.
+     * The cache is best effort: the network is compiled as usual if it cannot be hashed, imported or exported.
+     */
+    void LoadNetworkCached(IExecutableNetwork::Ptr &executableNetwork,
+                           ICNNNetwork &network,
+                           const std::map<std::string, std::string> &config,
+                           const std::string &cacheDir) {
+        std::string blobPath;
+        try {
+            blobPath = compiledNetworkCachePath(cacheDir, network, typeid(*this).name(), config);
+        } catch (const details::InferenceEngineException &) {
+            LoadNetwork(executableNetwork, network, config);
+            return;
+        }
+
+        if (FileUtils::fileExist(blobPath)) {
+            try {
+                executableNetwork = ImportNetwork(blobPath, config);
+                if (executableNetwork) return;
+            } catch (const details::InferenceEngineException &) {
+                // a file of another version of the plugin, it is replaced below
+            }
+        }
+
+        LoadNetwork(executableNetwork, network, config);
+
+        // the processes sharing the directory never see a partially written file
+        std::stringstream tmpPath;
+        tmpPath << blobPath << "." << std::this_thread::get_id() << "." << this << ".tmp";
+        ResponseDesc resp;
+        if (executableNetwork->Export(tmpPath.str(), &resp) != OK ||
+            std::rename(tmpPath.str().c_str(), blobPath.c_str()) != 0) {
+            std::remove(tmpPath.str().c_str());
+        }
+    }
+
     IExecutableNetwork::Ptr _loadedNetwork;
     std::string _firstInput;
     std::string _firstOutput;
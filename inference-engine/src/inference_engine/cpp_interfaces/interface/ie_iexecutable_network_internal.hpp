@@ -67,6 +67,11 @@ public:
     virtual void GetExecGraphInfo(ICNNNetwork::Ptr &graphPtr) = 0;
 
     virtual std::vector<IMemoryStateInternal::Ptr> QueryState() = 0;
+
+    /**
+     * @brief Gets the snapshot of the request counters and of the latency histograms of the executable network
+     */
+    virtual std::map<std::string, InferenceEngineMetricInfo> GetMetrics() = 0;
 };
 
 }  // namespace InferenceEngine
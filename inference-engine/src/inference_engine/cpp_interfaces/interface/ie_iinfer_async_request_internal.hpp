@@ -56,6 +56,13 @@ public:
      * * @return Enumeration of the resulted action: OK (0) for success.
      */
     virtual void SetCompletionCallback(IInferRequest::CompletionCallback callback) = 0;
+
+    /**
+     * @brief Set the scheduling priority and the deadline of the following asynchronous inference calls
+     * @param priority - the priority of the request, the higher the sooner
+     * @param millis_deadline - the deadline in milliseconds from the start of an inference, 0 for no deadline
+     */
+    virtual void SetPriority(int priority, int64_t millis_deadline) = 0;
 };
 
 }  // namespace InferenceEngine
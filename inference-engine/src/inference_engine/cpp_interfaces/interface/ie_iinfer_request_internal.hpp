@@ -7,6 +7,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 #include <ie_common.h>
 #include <ie_blob.h>
 
@@ -42,6 +43,15 @@ public:
      */
     virtual void SetBlob(const char *name, const Blob::Ptr &data) = 0;
 
+    /**
+     * @brief Set ROIs of one frame to be resized and placed to the consecutive batches of the input
+     * @note: Memory allocation doesn't happen
+     * @param name - a name of input blob.
+     * @param frame - a reference to the frame blob with the batch size 1.
+     * @param rois - ROIs inside of the frame, the ROI i is placed to the batch i.
+     */
+    virtual void SetRoiBlobs(const char *name, const Blob::Ptr &frame, const std::vector<ROI> &rois) = 0;
+
     /**
      * @brief Get input/output data to infer
      * @note: Memory allocation doesn't happen
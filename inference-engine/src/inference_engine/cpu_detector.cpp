@@ -4,28 +4,123 @@
 
 #include "cpu_detector.hpp"
 
-#ifdef ENABLE_MKL_DNN
-#define XBYAK_NO_OP_NAMES
-#define XBYAK_UNDEF_JNL
-#include <xbyak_util.h>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define IE_CPU_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
 #endif
 
 namespace InferenceEngine {
 
-#ifdef ENABLE_MKL_DNN
-static Xbyak::util::Cpu cpu;
+namespace {
+
+struct CpuFeatures {
+    bool sse42 = false;
+    bool avx2 = false;
+    bool f16c = false;
+    bool avx512_core = false;
+    bool avx512_core_vnni = false;
+    bool bfloat16 = false;
+
+    CpuFeatures() {
+#ifdef IE_CPU_X86
+        uint32_t leaf1[4] = {};
+        uint32_t leaf7[4] = {};
+        uint32_t leaf7_1[4] = {};
+
+        uint32_t max_leaf = cpuid(0, 0, leaf1);
+        if (max_leaf < 1)
+            return;
+        cpuid(1, 0, leaf1);
+        uint32_t max_leaf7 = 0;
+        if (max_leaf >= 7) {
+            max_leaf7 = cpuid(7, 0, leaf7);
+            if (max_leaf7 >= 1)
+                cpuid(7, 1, leaf7_1);
+        }
+
+        const uint32_t ecx1 = leaf1[2];
+        const uint32_t ebx7 = leaf7[1];
+        const uint32_t ecx7 = leaf7[2];
+
+        // the wide registers are usable only when the OS saves them on the context switch
+        const bool osxsave = (ecx1 >> 27) & 1;
+        const uint64_t xcr0 = osxsave ? xgetbv() : 0;
+        const bool os_ymm = (xcr0 & 0x6) == 0x6;
+        const bool os_zmm = (xcr0 & 0xe6) == 0xe6;
+
+        const bool avx = os_ymm && ((ecx1 >> 28) & 1);
+
+        sse42 = (ecx1 >> 20) & 1;
+        avx2 = avx && ((ebx7 >> 5) & 1);
+        f16c = avx && ((ecx1 >> 29) & 1);
+        avx512_core = os_zmm && ((ebx7 >> 16) & 1) && ((ebx7 >> 17) & 1) && ((ebx7 >> 30) & 1);
+        avx512_core_vnni = avx512_core && ((ecx7 >> 11) & 1);
+        bfloat16 = avx512_core && ((leaf7_1[0] >> 5) & 1);
 #endif
+    }
 
-bool with_cpu_x86_sse42() {
-#ifdef ENABLE_MKL_DNN
-    return cpu.has(Xbyak::util::Cpu::tSSE42);
+#ifdef IE_CPU_X86
+    // returns eax, the maximal leaf or subleaf for the leaves 0 and 7
+    static uint32_t cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#ifdef _MSC_VER
+        int info[4];
+        __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (int i = 0; i < 4; i++)
+            regs[i] = static_cast<uint32_t>(info[i]);
 #else
-  #if defined(HAVE_SSE)
-      return true;
-  #else
-      return false;
-  #endif
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+        return regs[0];
+    }
+
+    static uint64_t xgetbv() {
+#ifdef _MSC_VER
+        return _xgetbv(0);
+#else
+        uint32_t eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+    }
 #endif
+};
+
+const CpuFeatures& cpu() {
+    static const CpuFeatures features;
+    return features;
+}
+
+}  // namespace
+
+bool with_cpu_x86_sse42() {
+    return cpu().sse42;
+}
+
+bool with_cpu_x86_avx2() {
+    return cpu().avx2;
+}
+
+bool with_cpu_x86_f16c() {
+    return cpu().f16c;
+}
+
+bool with_cpu_x86_avx512_core() {
+    return cpu().avx512_core;
+}
+
+bool with_cpu_x86_avx512_core_vnni() {
+    return cpu().avx512_core_vnni;
+}
+
+bool with_cpu_x86_bfloat16() {
+    return cpu().bfloat16;
 }
 
 }  // namespace InferenceEngine
@@ -13,4 +13,29 @@ namespace InferenceEngine {
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_sse42();
 
+/**
+ * @brief Check if CPU is x86 with AVX2
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx2();
+
+/**
+ * @brief Check if CPU is x86 with F16C (the FP16 conversions)
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_f16c();
+
+/**
+ * @brief Check if CPU is x86 with AVX-512 F, BW and DQ
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core();
+
+/**
+ * @brief Check if CPU is x86 with AVX-512 core and VNNI (the INT8 dot products)
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core_vnni();
+
+/**
+ * @brief Check if CPU is x86 with AVX-512 core and the BF16 instructions
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_bfloat16();
+
 }  // namespace InferenceEngine
@@ -0,0 +1,90 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "blob_transform_avx2.hpp"
+
+#include <immintrin.h>
+
+namespace InferenceEngine {
+
+static inline void transpose_8x8(__m256 &r0, __m256 &r1, __m256 &r2, __m256 &r3,
+                                 __m256 &r4, __m256 &r5, __m256 &r6, __m256 &r7) {
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+    __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+    __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+    __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+    __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    r0 = _mm256_permute2f128_ps(s0, s4, 0x20);
+    r1 = _mm256_permute2f128_ps(s1, s5, 0x20);
+    r2 = _mm256_permute2f128_ps(s2, s6, 0x20);
+    r3 = _mm256_permute2f128_ps(s3, s7, 0x20);
+    r4 = _mm256_permute2f128_ps(s0, s4, 0x31);
+    r5 = _mm256_permute2f128_ps(s1, s5, 0x31);
+    r6 = _mm256_permute2f128_ps(s2, s6, 0x31);
+    r7 = _mm256_permute2f128_ps(s3, s7, 0x31);
+}
+
+void blob_transpose_32_avx2(const uint32_t *src,
+                                 uint32_t *dst,
+                                   size_t  src_stride,
+                                   size_t  dst_stride,
+                                   size_t  rows,
+                                   size_t  cols) {
+    // the elements are moved as floats, the bits are not changed by the shuffles
+    const float *s = reinterpret_cast<const float*>(src);
+    float *d = reinterpret_cast<float*>(dst);
+
+    size_t r = 0;
+    for (; r + 8 <= rows; r += 8) {
+        size_t c = 0;
+        for (; c + 8 <= cols; c += 8) {
+            const float *sp = s + r * src_stride + c;
+            __m256 r0 = _mm256_loadu_ps(sp);
+            __m256 r1 = _mm256_loadu_ps(sp + src_stride);
+            __m256 r2 = _mm256_loadu_ps(sp + 2 * src_stride);
+            __m256 r3 = _mm256_loadu_ps(sp + 3 * src_stride);
+            __m256 r4 = _mm256_loadu_ps(sp + 4 * src_stride);
+            __m256 r5 = _mm256_loadu_ps(sp + 5 * src_stride);
+            __m256 r6 = _mm256_loadu_ps(sp + 6 * src_stride);
+            __m256 r7 = _mm256_loadu_ps(sp + 7 * src_stride);
+
+            transpose_8x8(r0, r1, r2, r3, r4, r5, r6, r7);
+
+            float *dp = d + c * dst_stride + r;
+            _mm256_storeu_ps(dp, r0);
+            _mm256_storeu_ps(dp + dst_stride, r1);
+            _mm256_storeu_ps(dp + 2 * dst_stride, r2);
+            _mm256_storeu_ps(dp + 3 * dst_stride, r3);
+            _mm256_storeu_ps(dp + 4 * dst_stride, r4);
+            _mm256_storeu_ps(dp + 5 * dst_stride, r5);
+            _mm256_storeu_ps(dp + 6 * dst_stride, r6);
+            _mm256_storeu_ps(dp + 7 * dst_stride, r7);
+        }
+        for (; c < cols; c++) {
+            for (size_t i = r; i < r + 8; i++) {
+                dst[c * dst_stride + i] = src[i * src_stride + c];
+            }
+        }
+    }
+    for (; r < rows; r++) {
+        for (size_t c = 0; c < cols; c++) {
+            dst[c * dst_stride + r] = src[r * src_stride + c];
+        }
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,26 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// Blob-copy primitives manually vectored for AVX2 (w/o threads)
+//
+//------------------------------------------------------------------------
+
+// Transposes the rows x cols matrix of the 32 bit elements, src[r * src_stride + c] to dst[c * dst_stride + r]
+void blob_transpose_32_avx2(const uint32_t *src,
+                                 uint32_t *dst,
+                                   size_t  src_stride,
+                                   size_t  dst_stride,
+                                   size_t  rows,
+                                   size_t  cols);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,887 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+#include "ie_preprocess_gapi_kernels_avx2.hpp"
+
+#include <immintrin.h>
+
+#include <cstring>
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+namespace avx {
+
+//----------------------------------------------------------------------
+
+static inline __m128i pack_u8(const __m256i& a) {
+    return _mm_packus_epi16(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1));
+}
+
+static inline __m256i pack_u16(const __m256i& a, const __m256i& b) {
+    return _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8);
+}
+
+// The pair of pixels sx0, sx0 + 1 of the channel c is read with a single 32 bit gather from
+// the byte 3 - chanNum before the first of them, so the load never passes the end of the row
+// and the pixels are the bytes 3 - chanNum and 3 of the loaded value
+template<int chanNum>
+static inline void gather_pairs(const uint8_t tmp[], const short mapsx[], const __m256i& offset,
+                                __m256i& p0, __m256i& p1) {
+    __m256i sx = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mapsx)));
+    __m256i index = _mm256_add_epi32(_mm256_mullo_epi32(sx, _mm256_set1_epi32(chanNum)), offset);
+    __m256i v = _mm256_i32gather_epi32(reinterpret_cast<const int*>(tmp), index, 1);
+    p0 = _mm256_and_si256(_mm256_srli_epi32(v, 8 * (3 - chanNum)), _mm256_set1_epi32(0xFF));
+    p1 = _mm256_srli_epi32(v, 24);
+}
+
+template<int chanNum>
+static void calcRowLinear_8UC_impl(std::array<std::array<uint8_t*, 4>, chanNum> &dst,
+                                   const uint8_t *src0[],
+                                   const uint8_t *src1[],
+                                   const short    alpha[],
+                                   const short    mapsx[],
+                                   const short    beta[],
+                                         uint8_t  tmp[],
+                                   const Size    &inSz,
+                                   const Size    &outSz,
+                                         int      lpi) {
+    const int length = inSz.width * chanNum;
+    GAPI_DbgAssert(length >= 16 && outSz.width >= 16);
+
+    for (int l = 0; l < lpi; l++) {
+        // vertical pass: tmp = src0*beta + src1*(1 - beta)
+        const __m256i b0 = _mm256_set1_epi16(beta[l]);
+        for (int w = 0; w < length; ) {
+            for (; w <= length - 16; w += 16) {
+                __m256i s0 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src0[l][w])));
+                __m256i s1 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src1[l][w])));
+                __m256i r = _mm256_add_epi16(_mm256_mulhrs_epi16(_mm256_sub_epi16(s0, s1), b0), s1);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&tmp[w]), pack_u8(r));
+            }
+
+            if (w < length) {
+                w = length - 16;
+            }
+        }
+
+        // horizontal pass: dst = tmp[sx0]*alpha + tmp[sx0 + 1]*(1 - alpha)
+        for (int c = 0; c < chanNum; c++) {
+            const __m256i offset = _mm256_set1_epi32(c - (3 - chanNum));
+            for (int x = 0; x < outSz.width; ) {
+                for (; x <= outSz.width - 16; x += 16) {
+                    __m256i p0lo, p1lo, p0hi, p1hi;
+                    gather_pairs<chanNum>(tmp, &mapsx[x],     offset, p0lo, p1lo);
+                    gather_pairs<chanNum>(tmp, &mapsx[x + 8], offset, p0hi, p1hi);
+
+                    __m256i s0 = pack_u16(p0lo, p0hi);
+                    __m256i s1 = pack_u16(p1lo, p1hi);
+                    __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&alpha[x]));
+                    __m256i r = _mm256_add_epi16(_mm256_mulhrs_epi16(_mm256_sub_epi16(s0, s1), a0), s1);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[c][l][x]), pack_u8(r));
+                }
+
+                if (x < outSz.width) {
+                    x = outSz.width - 16;
+                }
+            }
+        }
+    }
+}
+
+void calcRowLinear_8U(uint8_t *dst[],
+                const uint8_t *src0[],
+                const uint8_t *src1[],
+                const short    alpha[],
+                const short    mapsx[],
+                const short    beta[],
+                      uint8_t  tmp[],
+                const Size   & inSz,
+                const Size   & outSz,
+                      int      lpi) {
+    std::array<std::array<uint8_t*, 4>, 1> dst1;
+    for (int l = 0; l < lpi; l++) {
+        dst1[0][l] = dst[l];
+    }
+    calcRowLinear_8UC_impl<1>(dst1, src0, src1, alpha, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+void calcRowLinear_8UC3(std::array<std::array<uint8_t*, 4>, 3> &dst,
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size    &inSz,
+                  const Size    &outSz,
+                        int      lpi) {
+    calcRowLinear_8UC_impl<3>(dst, src0, src1, alpha, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+void calcRowLinear_32F(float *dst[],
+                 const float *src0[],
+                 const float *src1[],
+                 const float  alpha[],
+                 const int    mapsx[],
+                 const float  beta[],
+                 const Size & inSz,
+                 const Size & outSz,
+                       int    lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (!xRatioEq1 && !yRatioEq1) {
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+            __m256 b0 = _mm256_set1_ps(beta0);
+
+            int x = 0;
+            for (; x <= outSz.width - 8; x += 8) {
+                __m256  a0 = _mm256_loadu_ps(&alpha[x]);
+                __m256i sx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mapsx[x]));
+
+                __m256 s00 = _mm256_i32gather_ps(src0[l],     sx, 4);
+                __m256 s01 = _mm256_i32gather_ps(src0[l] + 1, sx, 4);
+                __m256 res0 = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(s00, s01), a0), s01);
+
+                __m256 s10 = _mm256_i32gather_ps(src1[l],     sx, 4);
+                __m256 s11 = _mm256_i32gather_ps(src1[l] + 1, sx, 4);
+                __m256 res1 = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(s10, s11), a0), s11);
+
+                __m256 d = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(res0, res1), b0), res1);
+                _mm256_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                float res0 = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+                float res1 = src1[l][sx0]*alpha0 + src1[l][sx1]*alpha1;
+                dst[l][x] = beta0*res0 + beta1*res1;
+            }
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+
+        for (int l = 0; l < lpi; l++) {
+            int x = 0;
+            for (; x <= outSz.width - 8; x += 8) {
+                __m256  a0 = _mm256_loadu_ps(&alpha[x]);
+                __m256i sx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mapsx[x]));
+
+                __m256 s00 = _mm256_i32gather_ps(src0[l],     sx, 4);
+                __m256 s01 = _mm256_i32gather_ps(src0[l] + 1, sx, 4);
+                __m256 d = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(s00, s01), a0), s01);
+                _mm256_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                dst[l][x] = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+            }
+        }
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        int length = inSz.width;  // == outSz.width
+
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+            __m256 b0 = _mm256_set1_ps(beta0);
+
+            int x = 0;
+            for (; x <= length - 8; x += 8) {
+                __m256 s0 = _mm256_loadu_ps(&src0[l][x]);
+                __m256 s1 = _mm256_loadu_ps(&src1[l][x]);
+                __m256 d = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(s0, s1), b0), s1);
+                _mm256_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < length; x++) {
+                dst[l][x] = beta0*src0[l][x] + beta1*src1[l][x];
+            }
+        }
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        int length = inSz.width;  // == outSz.width
+        for (int l = 0; l < lpi; l++) {
+            memcpy(dst[l], src0[l], length * sizeof(float));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+// vertical pass, the 1st and the last rows
+static inline void downy_first(const uint8_t src0[], const uint8_t src1[], int inWidth,
+                               Q0_16 alpha0, Q0_16 alpha1, Q8_8 vbuf[]) {
+    int w = 0;
+    __m256i a0 = _mm256_set1_epi16(static_cast<short>(alpha0));
+    __m256i a1 = _mm256_set1_epi16(static_cast<short>(alpha1));
+    for (; w <= inWidth - 16; w += 16) {
+        __m256i s0 = _mm256_slli_epi16(
+            _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src0[w]))), 8);
+        __m256i s1 = _mm256_slli_epi16(
+            _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src1[w]))), 8);
+        __m256i r = _mm256_add_epi16(_mm256_mulhi_epu16(s0, a0), _mm256_mulhi_epu16(s1, a1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&vbuf[w]), r);
+    }
+
+    for (; w < inWidth; w++) {
+        vbuf[w] = mulas(alpha0, src0[w]) + mulas(alpha1, src1[w]);
+    }
+}
+
+static inline void downy_first(const float src0[], const float src1[], int inWidth,
+                               float alpha0, float alpha1, float vbuf[]) {
+    int w = 0;
+    __m256 a0 = _mm256_set1_ps(alpha0);
+    __m256 a1 = _mm256_set1_ps(alpha1);
+    for (; w <= inWidth - 8; w += 8) {
+        __m256 r = _mm256_add_ps(_mm256_mul_ps(a0, _mm256_loadu_ps(&src0[w])),
+                                 _mm256_mul_ps(a1, _mm256_loadu_ps(&src1[w])));
+        _mm256_storeu_ps(&vbuf[w], r);
+    }
+
+    for (; w < inWidth; w++) {
+        vbuf[w] = mulas(alpha0, src0[w]) + mulas(alpha1, src1[w]);
+    }
+}
+
+// vertical pass, the inner rows
+static inline void downy_inner(const uint8_t src[], int inWidth, Q0_16 yalpha, Q8_8 vbuf[]) {
+    int w = 0;
+    __m256i a = _mm256_set1_epi16(static_cast<short>(yalpha));
+    for (; w <= inWidth - 16; w += 16) {
+        __m256i s = _mm256_slli_epi16(
+            _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[w]))), 8);
+        __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&vbuf[w]));
+        r = _mm256_add_epi16(r, _mm256_mulhi_epu16(s, a));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&vbuf[w]), r);
+    }
+
+    for (; w < inWidth; w++) {
+        vbuf[w] += mulas(yalpha, src[w]);
+    }
+}
+
+static inline void downy_inner(const float src[], int inWidth, float yalpha, float vbuf[]) {
+    int w = 0;
+    __m256 a = _mm256_set1_ps(yalpha);
+    for (; w <= inWidth - 8; w += 8) {
+        __m256 r = _mm256_add_ps(_mm256_loadu_ps(&vbuf[w]), _mm256_mul_ps(a, _mm256_loadu_ps(&src[w])));
+        _mm256_storeu_ps(&vbuf[w], r);
+    }
+
+    for (; w < inWidth; w++) {
+        vbuf[w] += mulas(yalpha, src[w]);
+    }
+}
+
+template<typename T, typename A, typename I, typename W>
+static inline void downy(const T *src[], int inWidth, const MapperUnit<A, I>& ymap, A yalpha,
+                         W vbuf[]) {
+    int y_1st = ymap.index0;
+    int ylast = ymap.index1 - 1;
+
+    // yratio > 1, so at least 2 rows
+    GAPI_DbgAssert(y_1st < ylast);
+
+    downy_first(src[0], src[ylast - y_1st], inWidth, ymap.alpha0, ymap.alpha1, vbuf);
+
+    for (int i = 1; i < ylast - y_1st; i++) {
+        downy_inner(src[i], inWidth, yalpha, vbuf);
+    }
+}
+
+// horizontal pass
+template<typename T, typename A, typename I, typename W>
+static inline void downx(T dst[], int outWidth, int xmaxdf, const I xindex[], const A xalpha[],
+                         const W vbuf[]) {
+    for (int x = 0; x < outWidth; x++) {
+        int      index =  xindex[x];
+        const A *alpha = &xalpha[x * xmaxdf];
+
+        W sum = 0;
+        for (int i = 0; i < xmaxdf; i++) {
+            sum += mulaw(alpha[i], vbuf[index + i]);
+        }
+
+        dst[x] = convert_cast<T>(sum);
+    }
+}
+
+template<typename T, typename A, typename I, typename W>
+static void calcRowArea_impl(T dst[], const T *src[], const Size& inSz, const Size& outSz,
+    A yalpha, const MapperUnit<A, I>& ymap, int xmaxdf, const I xindex[], const A xalpha[],
+    W vbuf[]) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (!yRatioEq1 && !xRatioEq1) {
+        downy(src, inSz.width, ymap, yalpha, vbuf);
+        downx(dst, outSz.width, xmaxdf, xindex, xalpha, vbuf);
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        downy(src, inSz.width, ymap, yalpha, vbuf);
+        for (int x = 0; x < outSz.width; x++) {
+            dst[x] = convert_cast<T>(vbuf[x]);
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+        for (int w = 0; w < inSz.width; w++) {
+            vbuf[w] = convert_cast<W>(src[0][w]);
+        }
+        downx(dst, outSz.width, xmaxdf, xindex, xalpha, vbuf);
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        memcpy(dst, src[0], outSz.width * sizeof(T));
+    }
+}
+
+void calcRowArea_8U(uchar dst[], const uchar *src[], const Size& inSz, const Size& outSz,
+    Q0_16 yalpha, const MapperUnit8U &ymap, int xmaxdf, const short xindex[], const Q0_16 xalpha[],
+    Q8_8 vbuf[]) {
+    calcRowArea_impl(dst, src, inSz, outSz, yalpha, ymap, xmaxdf, xindex, xalpha, vbuf);
+}
+
+void calcRowArea_32F(float dst[], const float *src[], const Size& inSz, const Size& outSz,
+    float yalpha, const MapperUnit32F& ymap, int xmaxdf, const int xindex[], const float xalpha[],
+    float vbuf[]) {
+    calcRowArea_impl(dst, src, inSz, outSz, yalpha, ymap, xmaxdf, xindex, xalpha, vbuf);
+}
+
+//------------------------------------------------------------------------------
+
+void mergeRow_8UC2(const uint8_t in0[],
+                   const uint8_t in1[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in0[l]));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in1[l]));
+        __m256i lo = _mm256_unpacklo_epi8(a, b);
+        __m256i hi = _mm256_unpackhi_epi8(a, b);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[2*l]),      _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[2*l + 32]), _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[2*l + 0] = in0[l];
+        out[2*l + 1] = in1[l];
+    }
+}
+
+void mergeRow_8UC3(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                         uint8_t out[],
+                             int length) {
+    // every 128 bit lane interleaves 16 pixels to three 16 byte blocks of the output,
+    // the block j takes the bytes of the channel k shuffled with mask[j][k]
+    const __m256i m00 = _mm256_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5,
+                                         0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5);
+    const __m256i m01 = _mm256_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1,
+                                         -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1);
+    const __m256i m02 = _mm256_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1,
+                                         -1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1);
+    const __m256i m10 = _mm256_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1,
+                                         -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1);
+    const __m256i m11 = _mm256_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10,
+                                         5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10);
+    const __m256i m12 = _mm256_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1,
+                                         -1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1);
+    const __m256i m20 = _mm256_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1,
+                                         -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1);
+    const __m256i m21 = _mm256_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1,
+                                         -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1);
+    const __m256i m22 = _mm256_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15,
+                                         10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15);
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in0[l]));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in1[l]));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in2[l]));
+
+        __m256i blk0 = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, m00), _mm256_shuffle_epi8(b, m01)),
+                                       _mm256_shuffle_epi8(c, m02));
+        __m256i blk1 = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, m10), _mm256_shuffle_epi8(b, m11)),
+                                       _mm256_shuffle_epi8(c, m12));
+        __m256i blk2 = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, m20), _mm256_shuffle_epi8(b, m21)),
+                                       _mm256_shuffle_epi8(c, m22));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[3*l]),      _mm256_permute2x128_si256(blk0, blk1, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[3*l + 32]), _mm256_permute2x128_si256(blk2, blk0, 0x30));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[3*l + 64]), _mm256_permute2x128_si256(blk1, blk2, 0x31));
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_8UC4(const uint8_t in0[],
+                   const uint8_t in1[],
+                   const uint8_t in2[],
+                   const uint8_t in3[],
+                         uint8_t out[],
+                             int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in0[l]));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in1[l]));
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in2[l]));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in3[l]));
+
+        __m256i ablo = _mm256_unpacklo_epi8(a, b);
+        __m256i abhi = _mm256_unpackhi_epi8(a, b);
+        __m256i cdlo = _mm256_unpacklo_epi8(c, d);
+        __m256i cdhi = _mm256_unpackhi_epi8(c, d);
+
+        __m256i q0 = _mm256_unpacklo_epi16(ablo, cdlo);  // pixels 0..3, 16..19
+        __m256i q1 = _mm256_unpackhi_epi16(ablo, cdlo);  // pixels 4..7, 20..23
+        __m256i q2 = _mm256_unpacklo_epi16(abhi, cdhi);  // pixels 8..11, 24..27
+        __m256i q3 = _mm256_unpackhi_epi16(abhi, cdhi);  // pixels 12..15, 28..31
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[4*l]),      _mm256_permute2x128_si256(q0, q1, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[4*l + 32]), _mm256_permute2x128_si256(q2, q3, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[4*l + 64]), _mm256_permute2x128_si256(q0, q1, 0x31));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out[4*l + 96]), _mm256_permute2x128_si256(q2, q3, 0x31));
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[4*l + 0] = in0[l];
+        out[4*l + 1] = in1[l];
+        out[4*l + 2] = in2[l];
+        out[4*l + 3] = in3[l];
+    }
+}
+
+void mergeRow_32FC2(const float in0[],
+                    const float in1[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        __m256 a = _mm256_loadu_ps(&in0[l]);
+        __m256 b = _mm256_loadu_ps(&in1[l]);
+        __m256 lo = _mm256_unpacklo_ps(a, b);
+        __m256 hi = _mm256_unpackhi_ps(a, b);
+        _mm256_storeu_ps(&out[2*l],     _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(&out[2*l + 8], _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[2*l + 0] = in0[l];
+        out[2*l + 1] = in1[l];
+    }
+}
+
+void mergeRow_32FC3(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                          float out[],
+                            int length) {
+    // the output vector j takes the elements of the channel k permuted with index[j][k]
+    // at the positions of the blend masks
+    const __m256i i00 = _mm256_setr_epi32(0, 0, 0, 1, 0, 0, 2, 0);
+    const __m256i i01 = _mm256_setr_epi32(0, 0, 0, 0, 1, 0, 0, 2);
+    const __m256i i02 = _mm256_setr_epi32(0, 0, 0, 0, 0, 1, 0, 0);
+    const __m256i i10 = _mm256_setr_epi32(0, 3, 0, 0, 4, 0, 0, 5);
+    const __m256i i11 = _mm256_setr_epi32(0, 0, 3, 0, 0, 4, 0, 0);
+    const __m256i i12 = _mm256_setr_epi32(2, 0, 0, 3, 0, 0, 4, 0);
+    const __m256i i20 = _mm256_setr_epi32(0, 0, 6, 0, 0, 7, 0, 0);
+    const __m256i i21 = _mm256_setr_epi32(5, 0, 0, 6, 0, 0, 7, 0);
+    const __m256i i22 = _mm256_setr_epi32(0, 5, 0, 0, 6, 0, 0, 7);
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        __m256 a = _mm256_loadu_ps(&in0[l]);
+        __m256 b = _mm256_loadu_ps(&in1[l]);
+        __m256 c = _mm256_loadu_ps(&in2[l]);
+
+        __m256 o0 = _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(a, i00),
+                                                    _mm256_permutevar8x32_ps(b, i01), 0x92),
+                                    _mm256_permutevar8x32_ps(c, i02), 0x24);
+        __m256 o1 = _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(a, i10),
+                                                    _mm256_permutevar8x32_ps(b, i11), 0x24),
+                                    _mm256_permutevar8x32_ps(c, i12), 0x49);
+        __m256 o2 = _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(a, i20),
+                                                    _mm256_permutevar8x32_ps(b, i21), 0x49),
+                                    _mm256_permutevar8x32_ps(c, i22), 0x92);
+
+        _mm256_storeu_ps(&out[3*l],      o0);
+        _mm256_storeu_ps(&out[3*l + 8],  o1);
+        _mm256_storeu_ps(&out[3*l + 16], o2);
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_32FC4(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                    const float in3[],
+                          float out[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        __m256 a = _mm256_loadu_ps(&in0[l]);
+        __m256 b = _mm256_loadu_ps(&in1[l]);
+        __m256 c = _mm256_loadu_ps(&in2[l]);
+        __m256 d = _mm256_loadu_ps(&in3[l]);
+
+        __m256 ablo = _mm256_unpacklo_ps(a, b);
+        __m256 abhi = _mm256_unpackhi_ps(a, b);
+        __m256 cdlo = _mm256_unpacklo_ps(c, d);
+        __m256 cdhi = _mm256_unpackhi_ps(c, d);
+
+        __m256 q0 = _mm256_shuffle_ps(ablo, cdlo, 0x44);  // pixels 0, 4
+        __m256 q1 = _mm256_shuffle_ps(ablo, cdlo, 0xEE);  // pixels 1, 5
+        __m256 q2 = _mm256_shuffle_ps(abhi, cdhi, 0x44);  // pixels 2, 6
+        __m256 q3 = _mm256_shuffle_ps(abhi, cdhi, 0xEE);  // pixels 3, 7
+
+        _mm256_storeu_ps(&out[4*l],      _mm256_permute2f128_ps(q0, q1, 0x20));
+        _mm256_storeu_ps(&out[4*l + 8],  _mm256_permute2f128_ps(q2, q3, 0x20));
+        _mm256_storeu_ps(&out[4*l + 16], _mm256_permute2f128_ps(q0, q1, 0x31));
+        _mm256_storeu_ps(&out[4*l + 24], _mm256_permute2f128_ps(q2, q3, 0x31));
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[4*l + 0] = in0[l];
+        out[4*l + 1] = in1[l];
+        out[4*l + 2] = in2[l];
+        out[4*l + 3] = in3[l];
+    }
+}
+
+void splitRow_8UC2(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                             int length) {
+    const __m256i deinterleave = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+                                                  0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        __m256i i0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[2*l]));
+        __m256i i1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[2*l + 32]));
+
+        // the even bytes to the low 64 bits of each 128 bit lane, then the lanes are ordered
+        __m256i t0 = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(i0, deinterleave), 0xD8);
+        __m256i t1 = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(i1, deinterleave), 0xD8);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out0[l]), _mm256_permute2x128_si256(t0, t1, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out1[l]), _mm256_permute2x128_si256(t0, t1, 0x31));
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[2*l + 0];
+        out1[l] = in[2*l + 1];
+    }
+}
+
+void splitRow_8UC3(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                             int length) {
+    // every 128 bit lane deinterleaves three 16 byte blocks of 16 pixels,
+    // the channel k takes the bytes of the block j shuffled with mask[k][j]
+    const __m256i s00 = _mm256_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                         0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i s01 = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1,
+                                         -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1);
+    const __m256i s02 = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13,
+                                         -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13);
+    const __m256i s10 = _mm256_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                         1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i s11 = _mm256_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1,
+                                         -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1);
+    const __m256i s12 = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14,
+                                         -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14);
+    const __m256i s20 = _mm256_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                         2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i s21 = _mm256_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1,
+                                         -1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1);
+    const __m256i s22 = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15,
+                                         -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15);
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        __m256i i0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[3*l]));
+        __m256i i1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[3*l + 32]));
+        __m256i i2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[3*l + 64]));
+
+        // the block j of the pixels 0..15 to the low lane, of the pixels 16..31 to the high lane
+        __m256i blk0 = _mm256_permute2x128_si256(i0, i1, 0x30);
+        __m256i blk1 = _mm256_permute2x128_si256(i0, i2, 0x21);
+        __m256i blk2 = _mm256_permute2x128_si256(i1, i2, 0x30);
+
+        __m256i a = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(blk0, s00), _mm256_shuffle_epi8(blk1, s01)),
+                                    _mm256_shuffle_epi8(blk2, s02));
+        __m256i b = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(blk0, s10), _mm256_shuffle_epi8(blk1, s11)),
+                                    _mm256_shuffle_epi8(blk2, s12));
+        __m256i c = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(blk0, s20), _mm256_shuffle_epi8(blk1, s21)),
+                                    _mm256_shuffle_epi8(blk2, s22));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out0[l]), a);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out1[l]), b);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out2[l]), c);
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_8UC4(const uint8_t in[],
+                         uint8_t out0[],
+                         uint8_t out1[],
+                         uint8_t out2[],
+                         uint8_t out3[],
+                             int length) {
+    const __m256i deinterleave = _mm256_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+                                                  0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 32; l += 32) {
+        __m256i t[4];
+        for (int i = 0; i < 4; i++) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&in[4*l + 32*i]));
+            // 8 bytes of every channel for the pixels 8i..8i+7
+            t[i] = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, deinterleave), order);
+        }
+
+        __m256i ac01 = _mm256_unpacklo_epi64(t[0], t[1]);
+        __m256i bd01 = _mm256_unpackhi_epi64(t[0], t[1]);
+        __m256i ac23 = _mm256_unpacklo_epi64(t[2], t[3]);
+        __m256i bd23 = _mm256_unpackhi_epi64(t[2], t[3]);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out0[l]), _mm256_permute2x128_si256(ac01, ac23, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out1[l]), _mm256_permute2x128_si256(bd01, bd23, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out2[l]), _mm256_permute2x128_si256(ac01, ac23, 0x31));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&out3[l]), _mm256_permute2x128_si256(bd01, bd23, 0x31));
+    }
+
+    if (l < length && length >= 32) {
+        l = length - 32;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[4*l + 0];
+        out1[l] = in[4*l + 1];
+        out2[l] = in[4*l + 2];
+        out3[l] = in[4*l + 3];
+    }
+}
+
+void splitRow_32FC2(const float in[],
+                          float out0[],
+                          float out1[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        __m256 i0 = _mm256_loadu_ps(&in[2*l]);
+        __m256 i1 = _mm256_loadu_ps(&in[2*l + 8]);
+
+        __m256 a = _mm256_shuffle_ps(i0, i1, 0x88);  // pixels 0, 1, 4, 5, 2, 3, 6, 7
+        __m256 b = _mm256_shuffle_ps(i0, i1, 0xDD);
+
+        _mm256_storeu_ps(&out0[l], _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(a), 0xD8)));
+        _mm256_storeu_ps(&out1[l], _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(b), 0xD8)));
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[2*l + 0];
+        out1[l] = in[2*l + 1];
+    }
+}
+
+void splitRow_32FC3(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                            int length) {
+    // the channel k takes the elements of the input vector j permuted with index[k][j]
+    // at the positions of the blend masks
+    const __m256i i00 = _mm256_setr_epi32(0, 3, 6, 0, 0, 0, 0, 0);
+    const __m256i i01 = _mm256_setr_epi32(0, 0, 0, 1, 4, 7, 0, 0);
+    const __m256i i02 = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 2, 5);
+    const __m256i i10 = _mm256_setr_epi32(1, 4, 7, 0, 0, 0, 0, 0);
+    const __m256i i11 = _mm256_setr_epi32(0, 0, 0, 2, 5, 0, 0, 0);
+    const __m256i i12 = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 3, 6);
+    const __m256i i20 = _mm256_setr_epi32(2, 5, 0, 0, 0, 0, 0, 0);
+    const __m256i i21 = _mm256_setr_epi32(0, 0, 0, 3, 6, 0, 0, 0);
+    const __m256i i22 = _mm256_setr_epi32(0, 0, 0, 0, 0, 1, 4, 7);
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        __m256 v0 = _mm256_loadu_ps(&in[3*l]);
+        __m256 v1 = _mm256_loadu_ps(&in[3*l + 8]);
+        __m256 v2 = _mm256_loadu_ps(&in[3*l + 16]);
+
+        __m256 a = _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(v0, i00),
+                                                   _mm256_permutevar8x32_ps(v1, i01), 0x38),
+                                   _mm256_permutevar8x32_ps(v2, i02), 0xC0);
+        __m256 b = _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(v0, i10),
+                                                   _mm256_permutevar8x32_ps(v1, i11), 0x18),
+                                   _mm256_permutevar8x32_ps(v2, i12), 0xE0);
+        __m256 c = _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(v0, i20),
+                                                   _mm256_permutevar8x32_ps(v1, i21), 0x1C),
+                                   _mm256_permutevar8x32_ps(v2, i22), 0xE0);
+
+        _mm256_storeu_ps(&out0[l], a);
+        _mm256_storeu_ps(&out1[l], b);
+        _mm256_storeu_ps(&out2[l], c);
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_32FC4(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                          float out3[],
+                            int length) {
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 8; l += 8) {
+        __m256 v0 = _mm256_loadu_ps(&in[4*l]);
+        __m256 v1 = _mm256_loadu_ps(&in[4*l + 8]);
+        __m256 v2 = _mm256_loadu_ps(&in[4*l + 16]);
+        __m256 v3 = _mm256_loadu_ps(&in[4*l + 24]);
+
+        __m256 r0 = _mm256_permute2f128_ps(v0, v2, 0x20);  // pixels 0, 4
+        __m256 r1 = _mm256_permute2f128_ps(v0, v2, 0x31);  // pixels 1, 5
+        __m256 r2 = _mm256_permute2f128_ps(v1, v3, 0x20);  // pixels 2, 6
+        __m256 r3 = _mm256_permute2f128_ps(v1, v3, 0x31);  // pixels 3, 7
+
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+        _mm256_storeu_ps(&out0[l], _mm256_shuffle_ps(t0, t2, 0x44));
+        _mm256_storeu_ps(&out1[l], _mm256_shuffle_ps(t0, t2, 0xEE));
+        _mm256_storeu_ps(&out2[l], _mm256_shuffle_ps(t1, t3, 0x44));
+        _mm256_storeu_ps(&out3[l], _mm256_shuffle_ps(t1, t3, 0xEE));
+    }
+
+    if (l < length && length >= 8) {
+        l = length - 8;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[4*l + 0];
+        out1[l] = in[4*l + 1];
+        out2[l] = in[4*l + 2];
+        out3[l] = in[4*l + 3];
+    }
+}
+
+}  // namespace avx
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
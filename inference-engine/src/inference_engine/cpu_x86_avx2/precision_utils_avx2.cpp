@@ -0,0 +1,80 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils.h"
+#include "precision_utils_avx2.hpp"
+
+#include <immintrin.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx {
+
+void f16tof32Arrays(float *dst, const short *src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 x = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(x, vscale), vbias));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f16tof32(src[i]) * scale + bias;
+    }
+}
+
+// The hardware conversion rounds to the nearest even and produces the denormals and the infinities,
+// so the scalar algorithm is repeated instead: round half up, flush to 0 or to the minimal normal, saturate
+static inline __m128i f32tof16(__m256 x) {
+    const __m256i exp_mask = _mm256_set1_epi32(0x7F800000);
+    const __m256 min16 = _mm256_castsi256_ps(_mm256_set1_epi32((127 - 14) << 23));
+    const __m256 max16 = _mm256_castsi256_ps(_mm256_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    __m256i u = _mm256_castps_si256(x);
+    __m256i s = _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(0x8000));
+    __m256i a = _mm256_and_si256(u, _mm256_set1_epi32(0x7FFFFFFF));
+    __m256i e = _mm256_and_si256(a, exp_mask);
+
+    // NAN (with the quiet bit) and INF
+    __m256i naninf = _mm256_cmpeq_epi32(e, exp_mask);
+    __m256i nan = _mm256_cmpgt_epi32(a, exp_mask);
+    __m256i special = _mm256_or_si256(_mm256_or_si256(s, _mm256_srli_epi32(a, 23 - 10)),
+                                      _mm256_and_si256(nan, _mm256_set1_epi32(0x0200)));
+
+    // add the half of f16 ULP and rebias the exponent
+    __m256 half_ulp = _mm256_mul_ps(_mm256_castsi256_ps(e), _mm256_castsi256_ps(_mm256_set1_epi32((127 - 11) << 23)));
+    __m256 f = _mm256_add_ps(_mm256_castsi256_ps(a), half_ulp);
+    __m256i r = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(f), _mm256_set1_epi32((127 - 15) << 23)), 23 - 10);
+
+    r = _mm256_blendv_epi8(r, _mm256_set1_epi32(((15 + 15) << 10) | 0x3FF),
+                           _mm256_castps_si256(_mm256_cmp_ps(f, max16, _CMP_GE_OQ)));
+    r = _mm256_blendv_epi8(r, _mm256_set1_epi32(1 << 10),
+                           _mm256_castps_si256(_mm256_cmp_ps(f, min16, _CMP_LT_OQ)));
+    r = _mm256_blendv_epi8(r, _mm256_setzero_si256(),
+                           _mm256_castps_si256(_mm256_cmp_ps(f, _mm256_mul_ps(min16, _mm256_set1_ps(0.5f)), _CMP_LT_OQ)));
+    r = _mm256_blendv_epi8(_mm256_or_si256(r, s), special, naninf);
+
+    // truncated to 16 bits as the scalar result, the NAN keeps the low bits of the exponent shifted out of f16
+    r = _mm256_and_si256(r, _mm256_set1_epi32(0xFFFF));
+    return _mm_packus_epi32(_mm256_castsi256_si128(r), _mm256_extracti128_si256(r, 1));
+}
+
+void f32tof16Arrays(short *dst, const float *src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m256 x = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), vscale), vbias);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), f32tof16(x));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace avx
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
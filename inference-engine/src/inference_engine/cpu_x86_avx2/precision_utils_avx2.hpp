@@ -0,0 +1,21 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx {
+
+// Require F16C in addition to AVX2
+void f16tof32Arrays(float *dst, const short *src, size_t nelem, float scale, float bias);
+
+// Bit exact to the scalar f32tof16, so the denormals are flushed and the overflows saturated
+void f32tof16Arrays(short *dst, const float *src, size_t nelem, float scale, float bias);
+
+}  // namespace avx
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
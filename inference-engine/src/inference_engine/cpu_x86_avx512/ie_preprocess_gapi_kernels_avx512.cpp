@@ -0,0 +1,579 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_preprocess_gapi_kernels.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
+#include "ie_preprocess_gapi_kernels_avx512.hpp"
+
+#include <immintrin.h>
+
+#include <cstring>
+
+namespace InferenceEngine {
+namespace gapi {
+namespace kernels {
+namespace avx512 {
+
+//----------------------------------------------------------------------
+
+// The pair of pixels sx0, sx0 + 1 of the channel c is read with a single 32 bit gather from
+// the byte 3 - chanNum before the first of them, so the load never passes the end of the row
+// and the pixels are the bytes 3 - chanNum and 3 of the loaded value
+template<int chanNum>
+static inline void gather_pairs(const uint8_t tmp[], const short mapsx[], const __m512i& offset,
+                                __m512i& p0, __m512i& p1) {
+    __m512i sx = _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(mapsx)));
+    __m512i index = _mm512_add_epi32(_mm512_mullo_epi32(sx, _mm512_set1_epi32(chanNum)), offset);
+    __m512i v = _mm512_i32gather_epi32(index, tmp, 1);
+    p0 = _mm512_and_si512(_mm512_srli_epi32(v, 8 * (3 - chanNum)), _mm512_set1_epi32(0xFF));
+    p1 = _mm512_srli_epi32(v, 24);
+}
+
+template<int chanNum>
+static void calcRowLinear_8UC_impl(std::array<std::array<uint8_t*, 4>, chanNum> &dst,
+                                   const uint8_t *src0[],
+                                   const uint8_t *src1[],
+                                   const short    alpha[],
+                                   const short    mapsx[],
+                                   const short    beta[],
+                                         uint8_t  tmp[],
+                                   const Size    &inSz,
+                                   const Size    &outSz,
+                                         int      lpi) {
+    const int length = inSz.width * chanNum;
+    GAPI_DbgAssert(length >= 32 && outSz.width >= 16);
+
+    // rounding of the Q15 product, equal to the one of mulhrs
+    const __m512i half = _mm512_set1_epi32(1 << 14);
+
+    for (int l = 0; l < lpi; l++) {
+        // vertical pass: tmp = src0*beta + src1*(1 - beta)
+        const __m512i b0 = _mm512_set1_epi16(beta[l]);
+        for (int w = 0; w < length; ) {
+            for (; w <= length - 32; w += 32) {
+                __m512i s0 = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src0[l][w])));
+                __m512i s1 = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src1[l][w])));
+                __m512i r = _mm512_add_epi16(_mm512_mulhrs_epi16(_mm512_sub_epi16(s0, s1), b0), s1);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&tmp[w]), _mm512_cvtepi16_epi8(r));
+            }
+
+            if (w < length) {
+                w = length - 32;
+            }
+        }
+
+        // horizontal pass: dst = tmp[sx0]*alpha + tmp[sx0 + 1]*(1 - alpha)
+        for (int c = 0; c < chanNum; c++) {
+            const __m512i offset = _mm512_set1_epi32(c - (3 - chanNum));
+            for (int x = 0; x < outSz.width; ) {
+                for (; x <= outSz.width - 16; x += 16) {
+                    __m512i p0, p1;
+                    gather_pairs<chanNum>(tmp, &mapsx[x], offset, p0, p1);
+
+                    __m512i a0 = _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&alpha[x])));
+                    __m512i r = _mm512_mullo_epi32(_mm512_sub_epi32(p0, p1), a0);
+                    r = _mm512_add_epi32(_mm512_srai_epi32(_mm512_add_epi32(r, half), 15), p1);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[c][l][x]), _mm512_cvtepi32_epi8(r));
+                }
+
+                if (x < outSz.width) {
+                    x = outSz.width - 16;
+                }
+            }
+        }
+    }
+}
+
+void calcRowLinear_8U(uint8_t *dst[],
+                const uint8_t *src0[],
+                const uint8_t *src1[],
+                const short    alpha[],
+                const short    mapsx[],
+                const short    beta[],
+                      uint8_t  tmp[],
+                const Size   & inSz,
+                const Size   & outSz,
+                      int      lpi) {
+    std::array<std::array<uint8_t*, 4>, 1> dst1;
+    for (int l = 0; l < lpi; l++) {
+        dst1[0][l] = dst[l];
+    }
+    calcRowLinear_8UC_impl<1>(dst1, src0, src1, alpha, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+void calcRowLinear_8UC3(std::array<std::array<uint8_t*, 4>, 3> &dst,
+                  const uint8_t *src0[],
+                  const uint8_t *src1[],
+                  const short    alpha[],
+                  const short    mapsx[],
+                  const short    beta[],
+                        uint8_t  tmp[],
+                  const Size    &inSz,
+                  const Size    &outSz,
+                        int      lpi) {
+    calcRowLinear_8UC_impl<3>(dst, src0, src1, alpha, mapsx, beta, tmp, inSz, outSz, lpi);
+}
+
+void calcRowLinear_32F(float *dst[],
+                 const float *src0[],
+                 const float *src1[],
+                 const float  alpha[],
+                 const int    mapsx[],
+                 const float  beta[],
+                 const Size & inSz,
+                 const Size & outSz,
+                       int    lpi) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (!xRatioEq1 && !yRatioEq1) {
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+            __m512 b0 = _mm512_set1_ps(beta0);
+
+            int x = 0;
+            for (; x <= outSz.width - 16; x += 16) {
+                __m512  a0 = _mm512_loadu_ps(&alpha[x]);
+                __m512i sx = _mm512_loadu_si512(&mapsx[x]);
+
+                __m512 s00 = _mm512_i32gather_ps(sx, src0[l],     4);
+                __m512 s01 = _mm512_i32gather_ps(sx, src0[l] + 1, 4);
+                __m512 res0 = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(s00, s01), a0), s01);
+
+                __m512 s10 = _mm512_i32gather_ps(sx, src1[l],     4);
+                __m512 s11 = _mm512_i32gather_ps(sx, src1[l] + 1, 4);
+                __m512 res1 = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(s10, s11), a0), s11);
+
+                __m512 d = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(res0, res1), b0), res1);
+                _mm512_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                float res0 = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+                float res1 = src1[l][sx0]*alpha0 + src1[l][sx1]*alpha1;
+                dst[l][x] = beta0*res0 + beta1*res1;
+            }
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+
+        for (int l = 0; l < lpi; l++) {
+            int x = 0;
+            for (; x <= outSz.width - 16; x += 16) {
+                __m512  a0 = _mm512_loadu_ps(&alpha[x]);
+                __m512i sx = _mm512_loadu_si512(&mapsx[x]);
+
+                __m512 s00 = _mm512_i32gather_ps(sx, src0[l],     4);
+                __m512 s01 = _mm512_i32gather_ps(sx, src0[l] + 1, 4);
+                __m512 d = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(s00, s01), a0), s01);
+                _mm512_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < outSz.width; x++) {
+                float alpha0 = alpha[x];
+                float alpha1 = 1 - alpha0;
+                int   sx0 = mapsx[x];
+                int   sx1 = sx0 + 1;
+                dst[l][x] = src0[l][sx0]*alpha0 + src0[l][sx1]*alpha1;
+            }
+        }
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        int length = inSz.width;  // == outSz.width
+
+        for (int l = 0; l < lpi; l++) {
+            float beta0 = beta[l];
+            float beta1 = 1 - beta0;
+            __m512 b0 = _mm512_set1_ps(beta0);
+
+            int x = 0;
+            for (; x <= length - 16; x += 16) {
+                __m512 s0 = _mm512_loadu_ps(&src0[l][x]);
+                __m512 s1 = _mm512_loadu_ps(&src1[l][x]);
+                __m512 d = _mm512_add_ps(_mm512_mul_ps(_mm512_sub_ps(s0, s1), b0), s1);
+                _mm512_storeu_ps(&dst[l][x], d);
+            }
+
+            for (; x < length; x++) {
+                dst[l][x] = beta0*src0[l][x] + beta1*src1[l][x];
+            }
+        }
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        int length = inSz.width;  // == outSz.width
+        for (int l = 0; l < lpi; l++) {
+            memcpy(dst[l], src0[l], length * sizeof(float));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+// vertical pass, the 1st and the last rows
+static inline void downy_first(const uint8_t src0[], const uint8_t src1[], int inWidth,
+                               Q0_16 alpha0, Q0_16 alpha1, Q8_8 vbuf[]) {
+    int w = 0;
+    __m512i a0 = _mm512_set1_epi16(static_cast<short>(alpha0));
+    __m512i a1 = _mm512_set1_epi16(static_cast<short>(alpha1));
+    for (; w <= inWidth - 32; w += 32) {
+        __m512i s0 = _mm512_slli_epi16(
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src0[w]))), 8);
+        __m512i s1 = _mm512_slli_epi16(
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src1[w]))), 8);
+        __m512i r = _mm512_add_epi16(_mm512_mulhi_epu16(s0, a0), _mm512_mulhi_epu16(s1, a1));
+        _mm512_storeu_si512(&vbuf[w], r);
+    }
+
+    for (; w < inWidth; w++) {
+        vbuf[w] = mulas(alpha0, src0[w]) + mulas(alpha1, src1[w]);
+    }
+}
+
+static inline void downy_first(const float src0[], const float src1[], int inWidth,
+                               float alpha0, float alpha1, float vbuf[]) {
+    int w = 0;
+    __m512 a0 = _mm512_set1_ps(alpha0);
+    __m512 a1 = _mm512_set1_ps(alpha1);
+    for (; w <= inWidth - 16; w += 16) {
+        __m512 r = _mm512_add_ps(_mm512_mul_ps(a0, _mm512_loadu_ps(&src0[w])),
+                                 _mm512_mul_ps(a1, _mm512_loadu_ps(&src1[w])));
+        _mm512_storeu_ps(&vbuf[w], r);
+    }
+
+    for (; w < inWidth; w++) {
+        vbuf[w] = mulas(alpha0, src0[w]) + mulas(alpha1, src1[w]);
+    }
+}
+
+// vertical pass, the inner rows
+static inline void downy_inner(const uint8_t src[], int inWidth, Q0_16 yalpha, Q8_8 vbuf[]) {
+    int w = 0;
+    __m512i a = _mm512_set1_epi16(static_cast<short>(yalpha));
+    for (; w <= inWidth - 32; w += 32) {
+        __m512i s = _mm512_slli_epi16(
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[w]))), 8);
+        __m512i r = _mm512_add_epi16(_mm512_loadu_si512(&vbuf[w]), _mm512_mulhi_epu16(s, a));
+        _mm512_storeu_si512(&vbuf[w], r);
+    }
+
+    for (; w < inWidth; w++) {
+        vbuf[w] += mulas(yalpha, src[w]);
+    }
+}
+
+static inline void downy_inner(const float src[], int inWidth, float yalpha, float vbuf[]) {
+    int w = 0;
+    __m512 a = _mm512_set1_ps(yalpha);
+    for (; w <= inWidth - 16; w += 16) {
+        __m512 r = _mm512_add_ps(_mm512_loadu_ps(&vbuf[w]), _mm512_mul_ps(a, _mm512_loadu_ps(&src[w])));
+        _mm512_storeu_ps(&vbuf[w], r);
+    }
+
+    for (; w < inWidth; w++) {
+        vbuf[w] += mulas(yalpha, src[w]);
+    }
+}
+
+template<typename T, typename A, typename I, typename W>
+static inline void downy(const T *src[], int inWidth, const MapperUnit<A, I>& ymap, A yalpha,
+                         W vbuf[]) {
+    int y_1st = ymap.index0;
+    int ylast = ymap.index1 - 1;
+
+    // yratio > 1, so at least 2 rows
+    GAPI_DbgAssert(y_1st < ylast);
+
+    downy_first(src[0], src[ylast - y_1st], inWidth, ymap.alpha0, ymap.alpha1, vbuf);
+
+    for (int i = 1; i < ylast - y_1st; i++) {
+        downy_inner(src[i], inWidth, yalpha, vbuf);
+    }
+}
+
+// horizontal pass
+template<typename T, typename A, typename I, typename W>
+static inline void downx(T dst[], int outWidth, int xmaxdf, const I xindex[], const A xalpha[],
+                         const W vbuf[]) {
+    for (int x = 0; x < outWidth; x++) {
+        int      index =  xindex[x];
+        const A *alpha = &xalpha[x * xmaxdf];
+
+        W sum = 0;
+        for (int i = 0; i < xmaxdf; i++) {
+            sum += mulaw(alpha[i], vbuf[index + i]);
+        }
+
+        dst[x] = convert_cast<T>(sum);
+    }
+}
+
+template<typename T, typename A, typename I, typename W>
+static void calcRowArea_impl(T dst[], const T *src[], const Size& inSz, const Size& outSz,
+    A yalpha, const MapperUnit<A, I>& ymap, int xmaxdf, const I xindex[], const A xalpha[],
+    W vbuf[]) {
+    bool xRatioEq1 = inSz.width  == outSz.width;
+    bool yRatioEq1 = inSz.height == outSz.height;
+
+    if (!yRatioEq1 && !xRatioEq1) {
+        downy(src, inSz.width, ymap, yalpha, vbuf);
+        downx(dst, outSz.width, xmaxdf, xindex, xalpha, vbuf);
+
+    } else if (!yRatioEq1) {
+        GAPI_DbgAssert(xRatioEq1);
+        downy(src, inSz.width, ymap, yalpha, vbuf);
+        for (int x = 0; x < outSz.width; x++) {
+            dst[x] = convert_cast<T>(vbuf[x]);
+        }
+
+    } else if (!xRatioEq1) {
+        GAPI_DbgAssert(yRatioEq1);
+        for (int w = 0; w < inSz.width; w++) {
+            vbuf[w] = convert_cast<W>(src[0][w]);
+        }
+        downx(dst, outSz.width, xmaxdf, xindex, xalpha, vbuf);
+
+    } else {
+        GAPI_DbgAssert(xRatioEq1 && yRatioEq1);
+        memcpy(dst, src[0], outSz.width * sizeof(T));
+    }
+}
+
+void calcRowArea_8U(uchar dst[], const uchar *src[], const Size& inSz, const Size& outSz,
+    Q0_16 yalpha, const MapperUnit8U &ymap, int xmaxdf, const short xindex[], const Q0_16 xalpha[],
+    Q8_8 vbuf[]) {
+    calcRowArea_impl(dst, src, inSz, outSz, yalpha, ymap, xmaxdf, xindex, xalpha, vbuf);
+}
+
+void calcRowArea_32F(float dst[], const float *src[], const Size& inSz, const Size& outSz,
+    float yalpha, const MapperUnit32F& ymap, int xmaxdf, const int xindex[], const float xalpha[],
+    float vbuf[]) {
+    calcRowArea_impl(dst, src, inSz, outSz, yalpha, ymap, xmaxdf, xindex, xalpha, vbuf);
+}
+
+//------------------------------------------------------------------------------
+
+// The interleaving is done with the two source permutes, the permute index i takes the element
+// i of the 1st source vector and the element i - 16 of the 2nd one
+
+void mergeRow_32FC2(const float in0[],
+                    const float in1[],
+                          float out[],
+                            int length) {
+    const __m512i lo = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i hi = _mm512_add_epi32(lo, _mm512_set1_epi32(8));
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        __m512 a = _mm512_loadu_ps(&in0[l]);
+        __m512 b = _mm512_loadu_ps(&in1[l]);
+        _mm512_storeu_ps(&out[2*l],      _mm512_permutex2var_ps(a, lo, b));
+        _mm512_storeu_ps(&out[2*l + 16], _mm512_permutex2var_ps(a, hi, b));
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[2*l + 0] = in0[l];
+        out[2*l + 1] = in1[l];
+    }
+}
+
+void mergeRow_32FC3(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                          float out[],
+                            int length) {
+    // the output vector j takes the 1st and the 2nd channels with ab[j],
+    // then the 3rd channel is inserted with c[j]
+    const __m512i ab0 = _mm512_setr_epi32(0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5);
+    const __m512i ab1 = _mm512_setr_epi32(21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26);
+    const __m512i ab2 = _mm512_setr_epi32(0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0);
+    const __m512i c0  = _mm512_setr_epi32(0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15);
+    const __m512i c1  = _mm512_setr_epi32(0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15);
+    const __m512i c2  = _mm512_setr_epi32(26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31);
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        __m512 a = _mm512_loadu_ps(&in0[l]);
+        __m512 b = _mm512_loadu_ps(&in1[l]);
+        __m512 c = _mm512_loadu_ps(&in2[l]);
+        _mm512_storeu_ps(&out[3*l],      _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, ab0, b), c0, c));
+        _mm512_storeu_ps(&out[3*l + 16], _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, ab1, b), c1, c));
+        _mm512_storeu_ps(&out[3*l + 32], _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, ab2, b), c2, c));
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[3*l + 0] = in0[l];
+        out[3*l + 1] = in1[l];
+        out[3*l + 2] = in2[l];
+    }
+}
+
+void mergeRow_32FC4(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                    const float in3[],
+                          float out[],
+                            int length) {
+    // the output vector j takes the pixels 4j..4j+3, the 1st and the 2nd channels with ab + 4j,
+    // the 3rd and the 4th channels with cd + 4j, then both halves are combined with the order
+    const __m512i ab = _mm512_setr_epi32(0, 16, 0, 0, 1, 17, 0, 0, 2, 18, 0, 0, 3, 19, 0, 0);
+    const __m512i cd = _mm512_setr_epi32(0, 0, 0, 16, 0, 0, 1, 17, 0, 0, 2, 18, 0, 0, 3, 19);
+    const __m512i order = _mm512_setr_epi32(0, 1, 18, 19, 4, 5, 22, 23, 8, 9, 26, 27, 12, 13, 30, 31);
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        __m512 a = _mm512_loadu_ps(&in0[l]);
+        __m512 b = _mm512_loadu_ps(&in1[l]);
+        __m512 c = _mm512_loadu_ps(&in2[l]);
+        __m512 d = _mm512_loadu_ps(&in3[l]);
+        for (int j = 0; j < 4; j++) {
+            __m512i shift = _mm512_set1_epi32(4*j);
+            __m512 t0 = _mm512_permutex2var_ps(a, _mm512_add_epi32(ab, shift), b);
+            __m512 t1 = _mm512_permutex2var_ps(c, _mm512_add_epi32(cd, shift), d);
+            _mm512_storeu_ps(&out[4*l + 16*j], _mm512_permutex2var_ps(t0, order, t1));
+        }
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out[4*l + 0] = in0[l];
+        out[4*l + 1] = in1[l];
+        out[4*l + 2] = in2[l];
+        out[4*l + 3] = in3[l];
+    }
+}
+
+void splitRow_32FC2(const float in[],
+                          float out0[],
+                          float out1[],
+                            int length) {
+    const __m512i even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+    const __m512i odd  = _mm512_add_epi32(even, _mm512_set1_epi32(1));
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        __m512 i0 = _mm512_loadu_ps(&in[2*l]);
+        __m512 i1 = _mm512_loadu_ps(&in[2*l + 16]);
+        _mm512_storeu_ps(&out0[l], _mm512_permutex2var_ps(i0, even, i1));
+        _mm512_storeu_ps(&out1[l], _mm512_permutex2var_ps(i0, odd,  i1));
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[2*l + 0];
+        out1[l] = in[2*l + 1];
+    }
+}
+
+void splitRow_32FC3(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                            int length) {
+    // the channel k takes its elements of the 1st and the 2nd input vectors with i01[k],
+    // then the ones of the 3rd input vector with i2[k]
+    const __m512i i010 = _mm512_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0);
+    const __m512i i011 = _mm512_setr_epi32(1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0);
+    const __m512i i012 = _mm512_setr_epi32(2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0);
+    const __m512i i20  = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29);
+    const __m512i i21  = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30);
+    const __m512i i22  = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31);
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        __m512 v0 = _mm512_loadu_ps(&in[3*l]);
+        __m512 v1 = _mm512_loadu_ps(&in[3*l + 16]);
+        __m512 v2 = _mm512_loadu_ps(&in[3*l + 32]);
+        _mm512_storeu_ps(&out0[l], _mm512_permutex2var_ps(_mm512_permutex2var_ps(v0, i010, v1), i20, v2));
+        _mm512_storeu_ps(&out1[l], _mm512_permutex2var_ps(_mm512_permutex2var_ps(v0, i011, v1), i21, v2));
+        _mm512_storeu_ps(&out2[l], _mm512_permutex2var_ps(_mm512_permutex2var_ps(v0, i012, v1), i22, v2));
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[3*l + 0];
+        out1[l] = in[3*l + 1];
+        out2[l] = in[3*l + 2];
+    }
+}
+
+void splitRow_32FC4(const float in[],
+                          float out0[],
+                          float out1[],
+                          float out2[],
+                          float out3[],
+                            int length) {
+    // the channel k takes its elements of the input vectors 0, 1 with i01 + k,
+    // of the input vectors 2, 3 with i23 + k, then both halves are combined with the order
+    const __m512i i01 = _mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m512i i23 = _mm512_setr_epi32(0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 12, 16, 20, 24, 28);
+    const __m512i order = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 24, 25, 26, 27, 28, 29, 30, 31);
+    float *out[4] = {out0, out1, out2, out3};
+    int l = 0;
+
+    cycle:
+    for (; l <= length - 16; l += 16) {
+        __m512 v0 = _mm512_loadu_ps(&in[4*l]);
+        __m512 v1 = _mm512_loadu_ps(&in[4*l + 16]);
+        __m512 v2 = _mm512_loadu_ps(&in[4*l + 32]);
+        __m512 v3 = _mm512_loadu_ps(&in[4*l + 48]);
+        for (int k = 0; k < 4; k++) {
+            __m512i shift = _mm512_set1_epi32(k);
+            __m512 t0 = _mm512_permutex2var_ps(v0, _mm512_add_epi32(i01, shift), v1);
+            __m512 t1 = _mm512_permutex2var_ps(v2, _mm512_add_epi32(i23, shift), v3);
+            _mm512_storeu_ps(&out[k][l], _mm512_permutex2var_ps(t0, order, t1));
+        }
+    }
+
+    if (l < length && length >= 16) {
+        l = length - 16;
+        goto cycle;
+    }
+
+    for (; l < length; l++) {
+        out0[l] = in[4*l + 0];
+        out1[l] = in[4*l + 1];
+        out2[l] = in[4*l + 2];
+        out3[l] = in[4*l + 3];
+    }
+}
+
+}  // namespace avx512
+}  // namespace kernels
+}  // namespace gapi
+}  // namespace InferenceEngine
@@ -0,0 +1,75 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils.h"
+#include "precision_utils_avx512.hpp"
+
+#include <immintrin.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx512 {
+
+void f16tof32Arrays(float *dst, const short *src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m512 x = _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+        _mm512_storeu_ps(dst + i, _mm512_add_ps(_mm512_mul_ps(x, vscale), vbias));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = f16tof32(src[i]) * scale + bias;
+    }
+}
+
+// Repeats the scalar algorithm rather than the hardware conversion, see the AVX2 version
+static inline __m256i f32tof16(__m512 x) {
+    const __m512i exp_mask = _mm512_set1_epi32(0x7F800000);
+    const __m512 min16 = _mm512_castsi512_ps(_mm512_set1_epi32((127 - 14) << 23));
+    const __m512 max16 = _mm512_castsi512_ps(_mm512_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    __m512i u = _mm512_castps_si512(x);
+    __m512i s = _mm512_and_si512(_mm512_srli_epi32(u, 16), _mm512_set1_epi32(0x8000));
+    __m512i a = _mm512_and_si512(u, _mm512_set1_epi32(0x7FFFFFFF));
+    __m512i e = _mm512_and_si512(a, exp_mask);
+
+    // NAN (with the quiet bit) and INF
+    __mmask16 naninf = _mm512_cmpeq_epi32_mask(e, exp_mask);
+    __mmask16 nan = _mm512_cmpgt_epi32_mask(a, exp_mask);
+    __m512i special = _mm512_or_si512(s, _mm512_srli_epi32(a, 23 - 10));
+    special = _mm512_mask_or_epi32(special, nan, special, _mm512_set1_epi32(0x0200));
+
+    // add the half of f16 ULP and rebias the exponent
+    __m512 half_ulp = _mm512_mul_ps(_mm512_castsi512_ps(e), _mm512_castsi512_ps(_mm512_set1_epi32((127 - 11) << 23)));
+    __m512 f = _mm512_add_ps(_mm512_castsi512_ps(a), half_ulp);
+    __m512i r = _mm512_srli_epi32(_mm512_sub_epi32(_mm512_castps_si512(f), _mm512_set1_epi32((127 - 15) << 23)), 23 - 10);
+
+    r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(f, max16, _CMP_GE_OQ), r, _mm512_set1_epi32(((15 + 15) << 10) | 0x3FF));
+    r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(f, min16, _CMP_LT_OQ), r, _mm512_set1_epi32(1 << 10));
+    r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(f, _mm512_mul_ps(min16, _mm512_set1_ps(0.5f)), _CMP_LT_OQ),
+                                r, _mm512_setzero_si512());
+    r = _mm512_mask_blend_epi32(naninf, _mm512_or_si512(r, s), special);
+
+    return _mm512_cvtepi32_epi16(r);
+}
+
+void f32tof16Arrays(short *dst, const float *src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vbias = _mm512_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m512 x = _mm512_add_ps(_mm512_mul_ps(_mm512_loadu_ps(src + i), vscale), vbias);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), f32tof16(x));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace avx512
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,20 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+namespace avx512 {
+
+void f16tof32Arrays(float *dst, const short *src, size_t nelem, float scale, float bias);
+
+// Bit exact to the scalar f32tof16, so the denormals are flushed and the overflows saturated
+void f32tof16Arrays(short *dst, const float *src, size_t nelem, float scale, float bias);
+
+}  // namespace avx512
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
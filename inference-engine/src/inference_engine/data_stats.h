@@ -6,9 +6,11 @@
 
 #include <float.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "ie_api.h"
+#include "ie_parallel.hpp"
 
 class INFERENCE_ENGINE_API_CLASS(DataStats) {
   public:
@@ -23,11 +25,41 @@ class INFERENCE_ENGINE_API_CLASS(DataStats) {
 
     template<typename T>
     static T GetAbsMax(T min, T max);
+
+  private:
+    // the blocks are reduced in parallel, the lanes of a block are independent, so the compiler vectorizes them
+    static constexpr size_t blockSize = 64 * 1024;
+    static constexpr size_t lanes = 16;
+
+    template<typename T>
+    static void BlockMinMax(const T* data, size_t count, T& min, T& max);
+
+    template<typename T>
+    static double BlockSum(const T* data, size_t count);
 };
 
 template<typename T>
-void DataStats::GetDataMinMax(const T* data, size_t count, T& min, T& max) {
-    for (size_t i = 0; i < count; i++) {
+void DataStats::BlockMinMax(const T* data, size_t count, T& min, T& max) {
+    size_t i = 0;
+    if (count >= lanes) {
+        T laneMin[lanes], laneMax[lanes];
+        for (size_t k = 0; k < lanes; k++)
+            laneMin[k] = laneMax[k] = data[k];
+        for (i = lanes; i + lanes <= count; i += lanes) {
+            for (size_t k = 0; k < lanes; k++) {
+                T val = data[i + k];
+                laneMin[k] = val < laneMin[k] ? val : laneMin[k];
+                laneMax[k] = val > laneMax[k] ? val : laneMax[k];
+            }
+        }
+        for (size_t k = 0; k < lanes; k++) {
+            if (min > laneMin[k])
+                min = laneMin[k];
+            if (max < laneMax[k])
+                max = laneMax[k];
+        }
+    }
+    for (; i < count; i++) {
         T val = data[i];
 
         if (min > val) {
@@ -40,6 +72,27 @@ void DataStats::GetDataMinMax(const T* data, size_t count, T& min, T& max) {
     }
 }
 
+template<typename T>
+void DataStats::GetDataMinMax(const T* data, size_t count, T& min, T& max) {
+    const size_t blocks = (count + blockSize - 1) / blockSize;
+    if (blocks <= 1) {
+        BlockMinMax(data, count, min, max);
+        return;
+    }
+
+    std::vector<T> blockMin(blocks, min), blockMax(blocks, max);
+    InferenceEngine::parallel_for(blocks, [&](size_t b) {
+        const size_t begin = b * blockSize;
+        BlockMinMax(data + begin, std::min(count - begin, static_cast<size_t>(blockSize)), blockMin[b], blockMax[b]);
+    });
+    for (size_t b = 0; b < blocks; b++) {
+        if (min > blockMin[b])
+            min = blockMin[b];
+        if (max < blockMax[b])
+            max = blockMax[b];
+    }
+}
+
 template<typename T>
 void DataStats::GetDataAbsMax(const T* data, size_t count, T& max) {
     T min = FLT_MAX;
@@ -55,14 +108,35 @@ template void DataStats::GetDataMinMax<uint8_t>(const uint8_t* data, size_t coun
 template void DataStats::GetDataAbsMax<float>(const float* data, size_t count, float& max);
 
 template<typename T>
-void DataStats::GetDataAverage(const T* data, size_t count, T& ave) {
-    ave = 0;
-
-    for (size_t i = 0; i < count; i++) {
-        ave += data[i];
+double DataStats::BlockSum(const T* data, size_t count) {
+    double laneSum[lanes] = {};
+    size_t i = 0;
+    for (; i + lanes <= count; i += lanes) {
+        for (size_t k = 0; k < lanes; k++)
+            laneSum[k] += data[i + k];
     }
+    double sum = 0;
+    for (size_t k = 0; k < lanes; k++)
+        sum += laneSum[k];
+    for (; i < count; i++)
+        sum += data[i];
+    return sum;
+}
 
-    ave /= count;
+template<typename T>
+void DataStats::GetDataAverage(const T* data, size_t count, T& ave) {
+    // the sum is kept in double, so the order of the parallel blocks does not change it noticeably
+    const size_t blocks = (count + blockSize - 1) / blockSize;
+    std::vector<double> blockSum(blocks, 0.0);
+    InferenceEngine::parallel_for(blocks, [&](size_t b) {
+        const size_t begin = b * blockSize;
+        blockSum[b] = BlockSum(data + begin, std::min(count - begin, static_cast<size_t>(blockSize)));
+    });
+
+    double sum = 0;
+    for (size_t b = 0; b < blocks; b++)
+        sum += blockSum[b];
+    ave = static_cast<T>(sum / count);
 }
 
 template void DataStats::GetDataAverage<float>(const float* data, size_t count, float& ave);
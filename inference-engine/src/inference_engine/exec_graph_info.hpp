@@ -31,4 +31,29 @@ static const char PRECISION[] = "precision";
  * @brief A general key for CNNLayer::params map. Used to get value of execution time of the executable primitive.
  */
 static const char PERF_COUNTER[] = "execTimeMcs";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the way the executable primitive runs: "executed"
+ *        on every inference, "constant" once on load, or "skipped" when it was optimized out and does no work.
+ */
+static const char EXECUTION_MODE[] = "executionMode";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get "true" if an input or an output of the executable
+ *        primitive shares the memory with its neighbour in-place, "false" otherwise.
+ */
+static const char IN_PLACE[] = "inPlace";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the memory regions of the outputs of the executable
+ *        primitive separated by a comma: "workspace" placed by the memory solver, "scratch" shared with the other
+ *        graphs, or "external" for the memory allocated on its own (constants, user blobs).
+ */
+static const char OUTPUT_MEMORY_REGIONS[] = "outputMemoryRegions";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the byte offsets of the outputs in their memory
+ *        regions separated by a comma, "-" for the external memory.
+ */
+static const char OUTPUT_MEMORY_OFFSETS[] = "outputMemoryOffsets";
+/**
+ * @brief A general key for CNNLayer::params map. Used to get the byte sizes of the outputs separated by a comma.
+ */
+static const char OUTPUT_MEMORY_SIZES[] = "outputMemorySizes";
 }  // namespace ExecGraphInfoSerialization
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include <vector>
 #include <string>
 #include <queue>
+#include <deque>
+#include <map>
 #include <set>
 #include <algorithm>
 #include <list>
@@ -27,6 +29,8 @@ namespace details {
 
 /**
  * @brief implementation of DFS with visiting checking to avoid multientry
+ * The traversal keeps its own stack, so the depth of the graph (e.g. of the unrolled sequences) is not limited by
+ * the call stack; the layers are visited in the same order as by the recursive definition
  * @param visited - set to store visited layers
  * @param layer - current layer to start DFS from
  * @param visit - user callback on visited node
@@ -42,27 +46,56 @@ inline bool DFS(std::unordered_map<CNNLayer *, bool> &visited,
         return true;
     }
 
-    if (visitBefore) visit(layer);
-    visited[layer.get()] = false;
-    for (auto &od : layer->outData) {
-        for (auto nl : od->getInputTo()) {
-            auto i = visited.find(nl.second.get());
-            if (i != visited.end()) {
-                /**
-                 * cycle detected we entered still not completed node
-                 */
-                if (!i->second) {
-                    return false;
-                }
-                continue;
-            }
-            if (!DFS(visited, nl.second, visit, visitBefore)) {
+    struct Frame {
+        InferenceEngine::CNNLayerPtr layer;
+        // the completion mark of the layer, the references to the elements of the map survive the rehashing
+        bool *completed;
+        size_t outData;
+        std::map<std::string, CNNLayerPtr>::iterator next;
+    };
+    std::vector<Frame> stack;
+
+    auto enter = [&](const InferenceEngine::CNNLayerPtr &next, bool *completed) {
+        if (visitBefore) visit(next);
+        Frame frame{next, completed, 0, {}};
+        if (!next->outData.empty())
+            frame.next = next->outData[0]->getInputTo().begin();
+        stack.push_back(frame);
+    };
+
+    auto &mark = visited[layer.get()];
+    mark = false;
+    enter(layer, &mark);
+    while (!stack.empty()) {
+        Frame &top = stack.back();
+        auto &outData = top.layer->outData;
+        if (top.outData < outData.size() && top.next == outData[top.outData]->getInputTo().end()) {
+            if (++top.outData < outData.size())
+                top.next = outData[top.outData]->getInputTo().begin();
+            continue;
+        }
+        if (top.outData >= outData.size()) {
+            InferenceEngine::CNNLayerPtr done = top.layer;
+            bool *completed = top.completed;
+            stack.pop_back();
+            if (!visitBefore) visit(done);
+            *completed = true;
+            continue;
+        }
+
+        InferenceEngine::CNNLayerPtr child = (top.next++)->second;
+        auto entry = visited.emplace(child.get(), false);
+        if (!entry.second) {
+            /**
+             * cycle detected we entered still not completed node
+             */
+            if (!entry.first->second) {
                 return false;
             }
+            continue;
         }
+        enter(child, &entry.first->second);
     }
-    if (!visitBefore) visit(layer);
-    visited[layer.get()] = true;
     return true;
 }
 
@@ -132,8 +165,8 @@ inline void UnorderedDFS(std::unordered_set<CNNLayer *> &visited,
  */
 template<class T>
 inline void BFS(InferenceEngine::CNNLayerPtr layer, const T &visit, int maxDepth) {
-    std::set<InferenceEngine::CNNLayer*> visited;
-    std::list<InferenceEngine::CNNLayerPtr> nextLayers;
+    std::unordered_set<InferenceEngine::CNNLayer*> visited;
+    std::deque<InferenceEngine::CNNLayerPtr> nextLayers;
     nextLayers.push_back(layer);
 
     int layersOnLevel = 1;
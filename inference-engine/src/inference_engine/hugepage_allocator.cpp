@@ -0,0 +1,103 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hugepage_allocator.hpp"
+#include "page_aligned_allocator.hpp"
+
+#include <cstdint>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <sys/mman.h>
+#endif
+
+constexpr size_t HugePageAllocator::hugePageSize;
+
+#ifdef _WIN32
+static void * mapHugePages(size_t length) {
+    // the large pages need the SeLockMemoryPrivilege, the regular commit is taken without it
+    const size_t largePage = GetLargePageMinimum();
+    if (largePage != 0 && length % largePage == 0) {
+        void * ptr = VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        if (ptr != nullptr)
+            return ptr;
+    }
+    return VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+static void unmapHugePages(void * ptr, size_t) {
+    VirtualFree(ptr, 0, MEM_RELEASE);
+}
+#else
+static void * mapHugePages(size_t length) {
+#ifdef MAP_HUGETLB
+    void * ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr != MAP_FAILED)
+        return ptr;
+#endif
+    // no reserved huge pages: the mapping is aligned by hand, so the kernel can back it by the transparent ones
+    const size_t reserved = length + HugePageAllocator::hugePageSize;
+    void * base = mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return nullptr;
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(base);
+    const uintptr_t aligned = (begin + HugePageAllocator::hugePageSize - 1) / HugePageAllocator::hugePageSize *
+                              HugePageAllocator::hugePageSize;
+    if (aligned != begin)
+        munmap(base, aligned - begin);
+    const size_t tail = reserved - (aligned - begin) - length;
+    if (tail != 0)
+        munmap(reinterpret_cast<void*>(aligned + length), tail);
+#ifdef MADV_HUGEPAGE
+    madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<void*>(aligned);
+}
+
+static void unmapHugePages(void * ptr, size_t length) {
+    munmap(ptr, length);
+}
+#endif
+
+void * HugePageAllocator::alloc(size_t size) noexcept {
+    if (size == 0)
+        return nullptr;
+    if (size < hugePageSize / 2)
+        return PageAlignedAllocator().alloc(size);
+
+    const size_t length = (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+    void * ptr = mapHugePages(length);
+    if (ptr == nullptr)
+        return nullptr;
+    try {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _mappings.emplace(ptr, length);
+    } catch (...) {
+        unmapHugePages(ptr, length);
+        return nullptr;
+    }
+    return ptr;
+}
+
+bool HugePageAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+    size_t length = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _mappings.find(handle);
+        if (it != _mappings.end()) {
+            length = it->second;
+            _mappings.erase(it);
+        }
+    }
+    if (length == 0)
+        return PageAlignedAllocator().free(handle);
+    unmapHugePages(handle, length);
+    return true;
+}
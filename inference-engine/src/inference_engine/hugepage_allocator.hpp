@@ -0,0 +1,40 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include "ie_api.h"
+#include "ie_allocator.hpp"
+
+/**
+ * @brief Backs the large buffers by the 2 MB pages, so the activations of the large networks take a few TLB entries
+ * and page faults instead of the thousands of the 4 KB pages. The reserved huge pages are used when the system has
+ * them, otherwise the transparent huge pages are requested for the 2 MB aligned mapping. The buffers smaller than
+ * the half of the huge page are allocated at the page boundary.
+ */
+class INFERENCE_ENGINE_API_CLASS(HugePageAllocator) : public InferenceEngine::IAllocator {
+public:
+    static constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    void * alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+private:
+    std::mutex _mutex;
+    // the length of every mapping, the small buffers are not there
+    std::unordered_map<void*, size_t> _mappings;
+};
@@ -13,6 +13,9 @@
 #include <ie_cnn_net_reader_impl.h>
 #include "ie_format_parser.h"
 #include <file_utils.h>
+#include "mmap_allocator.hpp"
+#include "compact_ir.hpp"
+#include "xml_stream_reader.hpp"
 #include <ie_plugin.hpp>
 #include "xml_parse_utils.h"
 
@@ -20,6 +23,24 @@ using namespace std;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+TBlob<uint8_t>::Ptr MapFile(const char* filepath, size_t fileSize) {
+    // The file is mapped rather than read: the blobs of a layer are paged in on their first access,
+    // and the pages are file backed, so they are not duplicated in the process memory and can be evicted once
+    // the plugin has made its own copy of the weights
+    std::shared_ptr<IAllocator> mmapAllocator = details::shared_from_irelease(new MmapAllocator(filepath));
+    TBlob<uint8_t>::Ptr content(new TBlob<uint8_t>(TensorDesc(Precision::U8, {fileSize}, C), mmapAllocator));
+    content->allocate();
+
+    if (content->buffer().as<void *>() == nullptr) {
+        content.reset(new TBlob<uint8_t>(Precision::U8, C, {fileSize}));
+        content->allocate();
+        FileUtils::readAllFile(filepath, content->buffer(), fileSize);
+    }
+    return content;
+}
+}  // namespace
+
 std::string CNNNetReaderImpl::NameFromFilePath(const char* filepath) {
     string modelName = filepath;
     auto slashPos = modelName.rfind('/');
@@ -37,6 +58,9 @@ CNNNetReaderImpl::CNNNetReaderImpl(const FormatParserCreator::Ptr& _creator)
         : parseSuccess(false), _version(0), parserCreator(_creator) {}
 
 StatusCode CNNNetReaderImpl::SetWeights(const TBlob<uint8_t>::Ptr& weights, ResponseDesc* desc)  noexcept {
+    if (_compact) {
+        return DescriptionBuffer(desc) << "the weights of a compact IR are read together with the network";
+    }
     if (!_parser) {
         return DescriptionBuffer(desc) << "network must be read first";
     }
@@ -59,6 +83,17 @@ StatusCode CNNNetReaderImpl::ReadNetwork(const void* model, size_t size, Respons
         return DescriptionBuffer(NETWORK_NOT_READ, resp) << "Network has been read already, use new reader instance to read new network.";
     }
 
+    if (CompactIR::isCompactIR(model, size)) {
+        TBlob<uint8_t>::Ptr content(new TBlob<uint8_t>(Precision::U8, C, {size}));
+        content->allocate();
+        memcpy(content->buffer(), model, size);
+        StatusCode ret = ReadCompactNetwork(content);
+        if (ret != OK) {
+            return DescriptionBuffer(resp) << "Error reading network: " << description;
+        }
+        return OK;
+    }
+
     pugi::xml_document xmlDoc;
     pugi::xml_parse_result res = xmlDoc.load_buffer(model, size);
     if (res.status != pugi::status_ok) {
@@ -82,12 +117,9 @@ StatusCode CNNNetReaderImpl::ReadWeights(const char* filepath, ResponseDesc* res
         return DescriptionBuffer(resp) << "network is empty";
     }
 
-    size_t ulFileSize = static_cast<size_t>(fileSize);
-
-    TBlob<uint8_t>::Ptr weightsPtr(new TBlob<uint8_t>(Precision::U8, C, {ulFileSize}));
-    weightsPtr->allocate();
+    TBlob<uint8_t>::Ptr weightsPtr;
     try {
-        FileUtils::readAllFile(filepath, weightsPtr->buffer(), ulFileSize);
+        weightsPtr = MapFile(filepath, static_cast<size_t>(fileSize));
     }
     catch (const InferenceEngineException& iee) {
         return DescriptionBuffer(resp) << iee.what();
@@ -101,6 +133,39 @@ StatusCode CNNNetReaderImpl::ReadNetwork(const char* filepath, ResponseDesc* res
         return DescriptionBuffer(NETWORK_NOT_READ, resp) << "Network has been read already, use new reader instance to read new network.";
     }
 
+    {
+        char magic[sizeof(CompactIRHeader)] = {};
+        std::ifstream file(filepath, std::ios::binary);
+        file.read(magic, sizeof(magic));
+        if (file && CompactIR::isCompactIR(magic, sizeof(magic))) {
+            file.close();
+            StatusCode ret = OK;
+            try {
+                ret = ReadCompactNetwork(MapFile(filepath, static_cast<size_t>(FileUtils::fileSize(filepath))));
+            }
+            catch (const InferenceEngineException& iee) {
+                return DescriptionBuffer(resp) << iee.what();
+            }
+            if (ret != OK) {
+                return DescriptionBuffer(resp) << "Error reading network: " << description;
+            }
+            return OK;
+        }
+    }
+
+    // the IR is parsed element by element, the DOM of the whole file is only built when the root element
+    // cannot be read, to report the error with its line, or for the IR versions which are not parsed so
+    {
+        XmlStreamReader stream(filepath, {"layers", "edges"});
+        if (stream.open()) {
+            StatusCode ret = ReadNetwork(stream);
+            if (ret == OK)
+                return OK;
+            if (ret != NOT_IMPLEMENTED)
+                return DescriptionBuffer(resp) << "Error reading network: " << description;
+        }
+    }
+
     pugi::xml_document xmlDoc;
     pugi::xml_parse_result res = xmlDoc.load_file(filepath);
     if (res.status != pugi::status_ok) {
@@ -168,6 +233,73 @@ StatusCode CNNNetReaderImpl::ReadNetwork(pugi::xml_document& xmlDoc) {
     return OK;
 }
 
+StatusCode CNNNetReaderImpl::ReadNetwork(XmlStreamReader& stream) {
+    description.clear();
+
+    try {
+        pugi::xml_node root = stream.root();
+
+        _version = GetFileVersion(root);
+        if (_version < 1) THROW_IE_EXCEPTION << "deprecated IR version: " << _version;
+        if (_version > 5) THROW_IE_EXCEPTION << "cannot parse future versions: " << _version;
+        _parser = parserCreator->create(_version);
+        network = _parser->ParseStream(stream);
+        if (!network)
+            return NOT_IMPLEMENTED;
+        name = network->getName();
+        network->validate(_version);
+        parseSuccess = true;
+    } catch (const std::string& err) {
+        description = err;
+        parseSuccess = false;
+        return GENERAL_ERROR;
+    } catch (const InferenceEngineException& e) {
+        description = e.what();
+        parseSuccess = false;
+        return GENERAL_ERROR;
+    } catch (const std::exception& e) {
+        description = e.what();
+        parseSuccess = false;
+        return GENERAL_ERROR;
+    } catch (...) {
+        description = "Unknown exception thrown";
+        parseSuccess = false;
+        return UNEXPECTED;
+    }
+
+    return OK;
+}
+
+StatusCode CNNNetReaderImpl::ReadCompactNetwork(const TBlob<uint8_t>::Ptr& content) {
+    description.clear();
+
+    try {
+        _version = CompactIR::irVersion;
+        network = CompactIR::read(content);
+        name = network->getName();
+        network->validate(_version);
+        _compact = true;
+        parseSuccess = true;
+    } catch (const InferenceEngineException& e) {
+        network.reset();
+        description = e.what();
+        parseSuccess = false;
+        return GENERAL_ERROR;
+    } catch (const std::exception& e) {
+        network.reset();
+        description = e.what();
+        parseSuccess = false;
+        return GENERAL_ERROR;
+    } catch (...) {
+        network.reset();
+        description = "Unknown exception thrown";
+        parseSuccess = false;
+        return UNEXPECTED;
+    }
+
+    return OK;
+}
+
 std::shared_ptr<IFormatParser> V2FormatParserCreator::create(int version) {
     return std::make_shared<FormatParser>(version);
 }
@@ -19,6 +19,8 @@ class xml_document;
 
 namespace InferenceEngine {
 namespace details {
+class XmlStreamReader;
+
 
 struct FormatParserCreator {
     using Ptr = std::shared_ptr<FormatParserCreator>;
@@ -79,11 +81,23 @@ private:
 
     StatusCode ReadNetwork(pugi::xml_document &xmlDoc);
 
+    /**
+     * @brief Reads the network element by element
+     * @return NOT_IMPLEMENTED if the parser of the IR version cannot read it so, then the IR is read as a whole
+     */
+    StatusCode ReadNetwork(XmlStreamReader &stream);
+
+    /**
+     * @brief Reads the network and its weights from the compact IR file content
+     */
+    StatusCode ReadCompactNetwork(const TBlob<uint8_t>::Ptr &content);
+
     std::string description;
     std::string name;
     InferenceEngine::details::CNNNetworkImplPtr network;
     bool parseSuccess;
     int _version;
+    bool _compact = false;
     FormatParserCreator::Ptr parserCreator;
 };
 }  // namespace details
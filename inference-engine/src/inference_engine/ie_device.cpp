@@ -57,6 +57,9 @@ FindPluginResponse InferenceEngine::findPlugin(const FindPluginRequest& req) {
         case TargetDevice::eHETERO:
             pluginVec.push_back("HeteroPlugin");
             break;
+        case TargetDevice::eMULTI:
+            pluginVec.push_back("MultiDevicePlugin");
+            break;
         case TargetDevice::eKMB:
 #ifdef ENABLE_KMB
             pluginVec.push_back("kmbPlugin");
@@ -4,6 +4,8 @@
 
 #include <set>
 #include <unordered_set>
+#include <exception>
+#include <memory>
 #include "ie_format_parser.h"
 #include "ie_layer_parsers.h"
 #include "xml_parse_utils.h"
@@ -12,6 +14,8 @@
 #include <fstream>
 #include <sstream>
 #include "ie_icnn_network_stats.hpp"
+#include "xml_stream_reader.hpp"
+#include "ie_parallel.hpp"
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -127,6 +131,19 @@ InferenceEngine::CNNLayer::Ptr FormatParser::CreateLayer(pugi::xml_node& node,
     return genericCreator.CreateLayer(node, layerParsePrms);
 }
 
+CNNLayer::Ptr BaseCreator::CreateLayer(const LayerParams& prms) {
+    THROW_IE_EXCEPTION << "Layer " << prms.name << " of type " << prms.type << " cannot be created without its XML node";
+}
+
+InferenceEngine::CNNLayer::Ptr FormatParser::CreateLayer(const LayerParams& prms) {
+    for (auto &creator : getCreators()) {
+        if (!creator->shouldCreate(prms.type))
+            continue;
+        return creator->CreateLayer(prms);
+    }
+    return std::make_shared<GenericLayer>(prms);
+}
+
 void FormatParser::SetLayerInput(CNNNetworkImpl& network, const std::string& dataId,
                                    CNNLayerPtr& targetLayer, int inputPort) {
     DataPtr& dataPtr = _portsToData[dataId];
@@ -166,78 +183,151 @@ void FormatParser::SetLayerInput(CNNNetworkImpl& network, const std::string& dat
 }
 
 FormatParser::FormatParser(int version): _version(version) {
-    BaseCreator::version_ = version;
+    // the parsers of the TensorIterator bodies are created while the layers are created in parallel,
+    // with the version of the network, so it is only written by the parser of the network
+    if (BaseCreator::version_ != version)
+        BaseCreator::version_ = version;
 }
 
 CNNNetworkImplPtr FormatParser::Parse(pugi::xml_node& root) {
+    ParseBegin(root);
+
+    // parse the graph layers
+    auto allLayersNode = root.child("layers");
+    std::vector<pugi::xml_node> nodes;
+    for (auto node = allLayersNode.child("layer"); !node.empty(); node = node.next_sibling("layer")) {
+        nodes.push_back(node);
+    }
+    ParseLayers(nodes);
+
+    return ParseEnd(root);
+}
+
+CNNNetworkImplPtr FormatParser::ParseStream(XmlStreamReader& stream) {
+    // the input of the version 1 is described by the root, so it is parsed as a whole
+    if (_version == 1)
+        return nullptr;
+
+    // the layers are parsed as they are read, while the rest of the IR is small and kept to be parsed at the end
+    pugi::xml_document rest;
+    pugi::xml_node root = rest.append_copy(stream.root());
+    pugi::xml_node edges = root.append_child("edges");
+    ParseBegin(root);
+
+    // the layers are parsed in batches, so they are created in parallel while only a batch is kept in memory
+    const size_t batchSize = 256;
+    std::vector<std::unique_ptr<pugi::xml_document>> batch;
+    std::vector<pugi::xml_node> nodes;
+    auto parseBatch = [&]() {
+        ParseLayers(nodes);
+        nodes.clear();
+        batch.clear();
+    };
+
+    std::unique_ptr<pugi::xml_document> element(new pugi::xml_document());
+    std::string section;
+    while (stream.next(*element, section)) {
+        pugi::xml_node node = element->document_element();
+        if (section == "layers") {
+            if (equal(node.name(), "layer")) {
+                nodes.push_back(node);
+                batch.push_back(std::move(element));
+                element.reset(new pugi::xml_document());
+                if (nodes.size() == batchSize)
+                    parseBatch();
+            }
+        } else if (section == "edges") {
+            edges.append_copy(node);
+        } else if (!equal(node.name(), "edges")) {
+            root.append_copy(node);
+        }
+    }
+    parseBatch();
+
+    return ParseEnd(root);
+}
+
+void FormatParser::ParseBegin(pugi::xml_node& root) {
     _network.reset(new CNNNetworkImpl());
     _network->setName(GetStrAttr(root, "name", ""));
     _defPrecision = Precision::FromStr(GetStrAttr(root, "precision", "UNSPECIFIED"));
     _network->setPrecision(_defPrecision);
     // parse the input Data
-    DataPtr inputData;
     if (_version == 1) {
-        inputData = ParseInputData(root);
-        _portsToData[inputData->getName()] = inputData;  // hack as this input does not have ports ids
+        _inputData = ParseInputData(root);
+        _portsToData[_inputData->getName()] = _inputData;  // hack as this input does not have ports ids
         InputInfo::Ptr info(new InputInfo());
-        info->setInputData(inputData);
+        info->setInputData(_inputData);
         _network->setInputInfo(info);
     }
+    _identifyNetworkPrecision = _defPrecision == Precision::UNSPECIFIED;
+}
 
-    // parse the graph layers
-    auto allLayersNode = root.child("layers");
-    std::vector< CNNLayer::Ptr> inputLayers;
-    int nodeCnt = 0;
-    std::map<int, CNNLayer::Ptr> layerById;
-    bool identifyNetworkPrecision = _defPrecision == Precision::UNSPECIFIED;
-    for (auto node = allLayersNode.child("layer"); !node.empty(); node = node.next_sibling("layer")) {
-        LayerParseParameters lprms;
-        ParseGenericParams(node, lprms);
+void FormatParser::ParseLayers(std::vector<pugi::xml_node>& nodes) {
+    // the layers are created independently, only their connection to the network is done serially
+    std::vector<LayerParseParameters> prms(nodes.size());
+    std::vector<CNNLayer::Ptr> layers(nodes.size());
+    std::vector<std::exception_ptr> errors(nodes.size());
+    parallel_for(nodes.size(), [&](size_t i) {
+        try {
+            ParseGenericParams(nodes[i], prms[i]);
+            layers[i] = CreateLayer(nodes[i], prms[i]);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
 
-        CNNLayer::Ptr layer = CreateLayer(node, lprms);
-        if (!layer) THROW_IE_EXCEPTION << "Don't know how to create Layer type: " << lprms.prms.type;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (errors[i])
+            std::rethrow_exception(errors[i]);
+        AddLayer(nodes[i], prms[i], layers[i]);
+    }
+}
 
-        layersParseInfo[layer->name] = lprms;
-        _network->addLayer(layer);
-        layerById[lprms.layerId] = layer;
+void FormatParser::AddLayer(pugi::xml_node& node, const LayerParseParameters& lprms, const CNNLayer::Ptr& layer) {
+    if (!layer) THROW_IE_EXCEPTION << "Don't know how to create Layer type: " << lprms.prms.type;
 
-        if (equal(layer->type, "input")) {
-            inputLayers.push_back(layer);
-        }
+    layersParseInfo[layer->name] = lprms;
+    _network->addLayer(layer);
+    _layerById[lprms.layerId] = layer;
 
-        if (identifyNetworkPrecision) {
-            if (!_network->getPrecision()) {
-                _network->setPrecision(lprms.prms.precision);
-            }
-            if (_network->getPrecision() != lprms.prms.precision) {
-                _network->setPrecision(Precision::MIXED);
-                identifyNetworkPrecision = false;
-            }
+    if (equal(layer->type, "input")) {
+        _inputLayers.push_back(layer);
+    }
+
+    if (_identifyNetworkPrecision) {
+        if (!_network->getPrecision()) {
+            _network->setPrecision(lprms.prms.precision);
         }
+        if (_network->getPrecision() != lprms.prms.precision) {
+            _network->setPrecision(Precision::MIXED);
+            _identifyNetworkPrecision = false;
+        }
+    }
 
-        for (int i = 0; i < lprms.outputPorts.size(); i++) {
-            const auto &outPort = lprms.outputPorts[i];
-            const auto outId = gen_id(lprms.layerId, outPort.portId);
-            const std::string outName = lprms.outputPorts.size() == 1
-                    ? lprms.prms.name
-                    : lprms.prms.name + "." + std::to_string(i);
-            DataPtr& ptr = _network->getData(outName.c_str());
-            if (!ptr) {
-                ptr.reset(new Data(outName, outPort.dims, outPort.precision, TensorDesc::getLayoutByDims(outPort.dims)));
-                ptr->setDims(outPort.dims);
-            }
-            _portsToData[outId] = ptr;
+    for (int i = 0; i < lprms.outputPorts.size(); i++) {
+        const auto &outPort = lprms.outputPorts[i];
+        const auto outId = gen_id(lprms.layerId, outPort.portId);
+        const std::string outName = lprms.outputPorts.size() == 1
+                ? lprms.prms.name
+                : lprms.prms.name + "." + std::to_string(i);
+        DataPtr& ptr = _network->getData(outName.c_str());
+        if (!ptr) {
+            ptr.reset(new Data(outName, outPort.dims, outPort.precision, TensorDesc::getLayoutByDims(outPort.dims)));
+            ptr->setDims(outPort.dims);
+        }
+        _portsToData[outId] = ptr;
 
-            if (ptr->getCreatorLayer().lock())
-                THROW_IE_EXCEPTION << "two layers set to the same output [" << outName << "], conflict at offset "
-                                   << node.offset_debug();
+        if (ptr->getCreatorLayer().lock())
+            THROW_IE_EXCEPTION << "two layers set to the same output [" << outName << "], conflict at offset "
+                               << node.offset_debug();
 
-            ptr->getCreatorLayer() = layer;
-            layer->outData.push_back(ptr);
-        }
-        nodeCnt++;
+        ptr->getCreatorLayer() = layer;
+        layer->outData.push_back(ptr);
     }
+}
 
+CNNNetworkImplPtr FormatParser::ParseEnd(pugi::xml_node& root) {
     // connect the edges
     pugi::xml_node edges = root.child("edges");
 
@@ -248,7 +338,7 @@ CNNNetworkImplPtr FormatParser::Parse(pugi::xml_node& root) {
         int toPort = GetIntAttr(_ec, "to-port");
 
         const auto dataId = gen_id(fromLayer, fromPort);
-        auto targetLayer = layerById[toLayer];
+        auto targetLayer = _layerById[toLayer];
         if (!targetLayer)
             THROW_IE_EXCEPTION << "Layer ID " << toLayer << " was not found while connecting edge at offset "
                                << _ec.offset_debug();
@@ -259,14 +349,14 @@ CNNNetworkImplPtr FormatParser::Parse(pugi::xml_node& root) {
     if (_version == 1) {
         // a hacK: set input to the first layer that is not connected...
         bool inputWasSet = false;
-        for (auto& kvp : layerById) {
+        for (auto& kvp : _layerById) {
             CNNLayer::Ptr& layer = kvp.second;
             const LayerParseParameters& parseInfo = layersParseInfo[layer->name];
             size_t inSize = layer->insData.size();
             if (inSize != 0) continue;
             if (parseInfo.inputPorts.size() == 0)
                 THROW_IE_EXCEPTION << "Layer " << layer->name << " does not have any input";
-            SetLayerInput(*_network, inputData->getName(), layer, parseInfo.inputPorts[0].portId);
+            SetLayerInput(*_network, _inputData->getName(), layer, parseInfo.inputPorts[0].portId);
             inputWasSet = true;
 
             // Modification of default input precision which should be used for input blob
@@ -276,10 +366,10 @@ CNNNetworkImplPtr FormatParser::Parse(pugi::xml_node& root) {
             inputPrecision = layer->precision == Precision::Q78 ? Precision::I16 :
                 layer->precision == Precision::FP16 ? Precision::FP32 : static_cast<Precision::ePrecision>(layer->precision);
 
-            auto inputLayer = std::make_shared<GenericLayer>(LayerParams({inputData->getName(), "input",  inputPrecision}));
-            inputLayer->outData.push_back(inputData);
+            auto inputLayer = std::make_shared<GenericLayer>(LayerParams({_inputData->getName(), "input",  inputPrecision}));
+            inputLayer->outData.push_back(_inputData);
             _network->addLayer(inputLayer);
-            inputData->creatorLayer = inputLayer;
+            _inputData->creatorLayer = inputLayer;
 
             InputsDataMap inputs;
             _network->getInputsInfo(inputs);
@@ -289,7 +379,7 @@ CNNNetworkImplPtr FormatParser::Parse(pugi::xml_node& root) {
             inputs.begin()->second->setInputPrecision(inputPrecision);
 
             // And we need to leave original input precision unmodified for proper handling in plugin
-            inputData->setPrecision(layer->precision);
+            _inputData->setPrecision(layer->precision);
             break;
         }
         if (!inputWasSet) THROW_IE_EXCEPTION << "network does not have any input layer";
@@ -309,7 +399,7 @@ CNNNetworkImplPtr FormatParser::Parse(pugi::xml_node& root) {
         };
 
         // Keep all data from InputLayers
-        for (auto inLayer : inputLayers) {
+        for (auto inLayer : _inputLayers) {
             if (inLayer->outData.size() != 1)
                 THROW_IE_EXCEPTION << "Input layer must have 1 output. "
                                       "See documentation for details.";
@@ -366,8 +456,10 @@ CNNNetworkImplPtr FormatParser::Parse(pugi::xml_node& root) {
         THROW_IE_EXCEPTION << "Incorrect model! Network doesn't contain input layers.";
 
     // check all input ports are occupied
+    std::vector<CNNLayer::Ptr> layers;
     for (const auto& kvp : _network->allLayers()) {
         const CNNLayer::Ptr& layer = kvp.second;
+        layers.push_back(layer);
         const LayerParseParameters& parseInfo = layersParseInfo[layer->name];
         size_t inSize = layer->insData.size();
         if (inSize != parseInfo.inputPorts.size())
@@ -379,7 +471,19 @@ CNNNetworkImplPtr FormatParser::Parse(pugi::xml_node& root) {
                                    << parseInfo.inputPorts[i].portId << " is not connected to any data";
             }
         }
-        layer->validateLayer();
+    }
+    // the layers only read their input data while they are validated, so they are validated in parallel
+    std::vector<std::exception_ptr> errors(layers.size());
+    parallel_for(layers.size(), [&](size_t i) {
+        try {
+            layers[i]->validateLayer();
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
     }
     // parse mean image
     ParsePreProcess(root);
@@ -425,7 +529,7 @@ inline Blob::Ptr GetTypedBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, con
     return binBlob;
 }
 
-Blob::Ptr FormatParser::GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment& segment) const {
+Blob::Ptr FormatParser::GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment& segment) {
     if (segment.precision == Precision::FP32) {
         return GetTypedBlobFromSegment<float>(weights, segment);
     } else if (segment.precision == Precision::I32) {
@@ -670,7 +774,7 @@ void FormatParser::ParsePreProcess(pugi::xml_node& root) {
     }
 }
 
-const std::vector<std::shared_ptr<BaseCreator> >& FormatParser::getCreators() const {
+const std::vector<std::shared_ptr<BaseCreator> >& FormatParser::getCreators() {
     // there should be unique_ptr but it cant be used with initializer lists
     static std::vector<std::shared_ptr<BaseCreator> > creators = {
         std::make_shared<LayerCreator<PowerLayer>>("Power"),
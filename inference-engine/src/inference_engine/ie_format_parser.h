@@ -61,6 +61,11 @@ public:
 
     virtual CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& layerParsePrms) = 0;
 
+    /**
+     * @brief Creates the layer from the parameters only, for the layers whose parameters are all in the params map
+     */
+    virtual CNNLayer::Ptr CreateLayer(const LayerParams& prms);
+
     bool shouldCreate(const std::string& nodeType) const {
         InferenceEngine::details::CaselessEq<std::string> comparator;
         return comparator(nodeType, type_);
@@ -72,8 +77,14 @@ public:
     explicit FormatParser(int version);
 
     CNNNetworkImplPtr Parse(pugi::xml_node& root) override;
-
-    Blob::Ptr GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment & weight_segment) const;
+    CNNNetworkImplPtr ParseStream(XmlStreamReader& stream) override;
+
+    static Blob::Ptr GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment & weight_segment);
+    /**
+     * @brief Creates the layer of the type given in the parameters without an XML node, the parameters of the layer
+     * are expected to be set to its params map before CNNLayer::validateLayer() is called
+     */
+    static CNNLayer::Ptr CreateLayer(const LayerParams& prms);
     void SetWeights(const TBlob<uint8_t>::Ptr& weights) override;
     void ParseDims(SizeVector& dims, const pugi::xml_node &node) const;
     const DataPtr& GetDataBy(int layer_id, int port_id) const;
@@ -87,10 +98,20 @@ private:
     std::map<std::string, DataPtr> _portsToData;
 
     CNNNetworkImplPtr _network;
+    DataPtr _inputData;
+    std::vector<CNNLayer::Ptr> _inputLayers;
+    std::map<int, CNNLayer::Ptr> _layerById;
+    bool _identifyNetworkPrecision = false;
     std::map<std::string, std::vector<WeightSegment>> _preProcessSegments;
-    const std::vector<std::shared_ptr<BaseCreator> > &getCreators() const;
+    static const std::vector<std::shared_ptr<BaseCreator> > &getCreators();
     void ParsePort(LayerParseParameters::LayerPortData& port, pugi::xml_node &node) const;
     void ParseGenericParams(pugi::xml_node& node, LayerParseParameters& layerParsePrms) const;
+
+    // the network is parsed in three steps, so the layers can be parsed in batches without the DOM of the others
+    void ParseBegin(pugi::xml_node& root);
+    void ParseLayers(std::vector<pugi::xml_node>& nodes);
+    void AddLayer(pugi::xml_node& node, const LayerParseParameters& lprms, const CNNLayer::Ptr& layer);
+    CNNNetworkImplPtr ParseEnd(pugi::xml_node& root);
     CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& prms) const;
 
     void SetLayerInput(CNNNetworkImpl& network, const std::string& data, CNNLayerPtr& targetLayer, int inputPort);
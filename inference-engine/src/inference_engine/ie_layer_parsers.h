@@ -37,21 +37,24 @@ public:
     CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& layerParsePrms) override {
         auto res = std::make_shared<LT>(layerParsePrms.prms);
 
+        // the creators are shared by the parsers, so the layers can be created in parallel without any state here
+        std::vector<std::string> layerChild;
+
         if (std::is_same<LT, FullyConnectedLayer>::value) {
-            layerChild[res->name] = {"fc", "fc_data", "data"};
+            layerChild = {"fc", "fc_data", "data"};
         } else if (std::is_same<LT, NormLayer>::value) {
-            layerChild[res->name] = {"lrn", "norm", "norm_data", "data"};
+            layerChild = {"lrn", "norm", "norm_data", "data"};
         } else if (std::is_same<LT, CropLayer>::value) {
-            layerChild[res->name] = {"crop", "crop-data", "data"};
+            layerChild = {"crop", "crop-data", "data"};
         } else if (std::is_same<LT, BatchNormalizationLayer>::value) {
-            layerChild[res->name] = {"batch_norm", "batch_norm_data", "data"};
+            layerChild = {"batch_norm", "batch_norm_data", "data"};
         } else if ((std::is_same<LT, EltwiseLayer>::value)) {
-            layerChild[res->name] = {"elementwise", "elementwise_data", "data"};
+            layerChild = {"elementwise", "elementwise_data", "data"};
         } else {
-            layerChild[res->name] = {"data", tolower(res->type) + "_data", tolower(res->type)};
+            layerChild = {"data", tolower(res->type) + "_data", tolower(res->type)};
         }
 
-        pugi::xml_node dn = GetChild(node, layerChild[res->name], false);
+        pugi::xml_node dn = GetChild(node, layerChild, false);
 
         if (!dn.empty()) {
             if (dn.child("crop").empty()) {
@@ -84,18 +87,23 @@ public:
         return res;
     }
 
-    std::map <std::string, std::vector<std::string>> layerChild;
+    CNNLayer::Ptr CreateLayer(const LayerParams& prms) override {
+        return std::make_shared<LT>(prms);
+    }
+
 };
 
 class ActivationLayerCreator : public BaseCreator {
  public:
     explicit ActivationLayerCreator(const std::string& type) : BaseCreator(type) {}
+    using BaseCreator::CreateLayer;
     CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& layerParsePrms) override;
 };
 
 class TILayerCreator : public BaseCreator {
 public:
     explicit TILayerCreator(const std::string& type) : BaseCreator(type) {}
+    using BaseCreator::CreateLayer;
     CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& layerParsePrms) override;
 };
 }  // namespace details
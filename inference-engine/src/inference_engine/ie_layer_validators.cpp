@@ -156,25 +156,23 @@ void checkNumOfInput(const std::vector<SizeVector>& inShapes, const vector<int>&
 }
 
 LayerValidators* LayerValidators::getInstance() {
-    if (!_instance) {
-        _instance = new LayerValidators();
-    }
-    return _instance;
+    // the layers are validated in parallel, so the instance is created by the thread safe static initialization
+    static LayerValidators* instance = new LayerValidators();
+    return instance;
 }
 
 LayerValidator::Ptr LayerValidators::getValidator(const std::string& type) {
-    if (_validators.find(type) == _validators.end()) {
+    auto validator = _validators.find(type);
+    if (validator == _validators.end()) {
         return std::make_shared<GeneralValidator>(type);
     }
-    return _validators[type];
+    return validator->second;
 }
 
 void LayerValidators::addImpl(const std::string& type, const LayerValidator::Ptr& validator) {
     _validators[type] = validator;
 }
 
-LayerValidators* LayerValidators::_instance = nullptr;
-
 GeneralValidator::GeneralValidator(const std::string& _type) : LayerValidator(_type) {}
 
 void FullyConnectedValidator::parseParams(CNNLayer* layer) {
@@ -1102,8 +1100,8 @@ void GemmValidator::checkShapes(const CNNLayer* layer, const vector<SizeVector>&
             THROW_IE_EXCEPTION << "Gemm input2 x dimension must be equal to input1 x dimension ("
                                << dims2[xAxis] << " vs " << dims1[xAxis] << ")";
 
-        if (dims2[yAxis] != dims0[yAxis])
-            THROW_IE_EXCEPTION << "Gemm input2 y dimension must be equal to input0 y dimension ("
+        if (dims2[yAxis] != dims0[yAxis] && dims2[yAxis] != 1)
+            THROW_IE_EXCEPTION << "Gemm input2 y dimension must be equal to input0 y dimension or 1 ("
                                << dims2[yAxis] << " vs " << dims0[yAxis] << ")";
     }
 }
@@ -1194,6 +1192,10 @@ void GatherValidator::parseParams(CNNLayer* layer) {
 
 void GatherValidator::checkParams(const CNNLayer* layer) {
     LayerValidator::checkParams(layer);
+
+    std::string reduction = layer->GetParamAsString("reduction", "");
+    if (!reduction.empty() && reduction != "sum" && reduction != "mean")
+        THROW_IE_EXCEPTION << layer->name << " Incorrect reduction type " << reduction << " of Gather layer";
 }
 
 void GatherValidator::checkShapes(const CNNLayer* layer, const vector<SizeVector>& inShapes) const {
@@ -1212,6 +1214,9 @@ void GatherValidator::checkShapes(const CNNLayer* layer, const vector<SizeVector
     else if (casted->axis < 0 && (static_cast<int>(inShapes[0].size()) + casted->axis) < 0)
         THROW_IE_EXCEPTION << layer->name << " Incorrect input dictionary dimensions " << inShapes[0].size()
                            << " and axis number " << casted->axis;
+
+    if (!casted->GetParamAsString("reduction", "").empty() && inShapes[1].empty())
+        THROW_IE_EXCEPTION << layer->name << " Reduction of Gather needs the bags in the last indices dimension";
 }
 
 StridedSliceValidator::StridedSliceValidator(const std::string& _type) : LayerValidator(_type) {}
@@ -1780,9 +1785,11 @@ void RNNSequenceValidator<CELL>::checkShapes(const CNNLayer* layer, const vector
     SizeVector expected_state_shape {N, S};
 
     if (inShapes.size() > 1) {  // has an initial state blobs
-        if (inShapes.size() != 1 + NS)
-            THROW_IE_EXCEPTION << "Wrong number of input tensors. Expected 1 (data) or "
-                               << 1 + NS << " (data and states)";
+        if (inShapes.size() != 1 + NS && inShapes.size() != 2 + NS)
+            THROW_IE_EXCEPTION << "Wrong number of input tensors. Expected 1 (data), "
+                               << 1 + NS << " (data and states) or " << 2 + NS << " (data, states and lengths)";
+        if (inShapes.size() == 2 + NS && inShapes.back() != SizeVector {N})
+            THROW_IE_EXCEPTION << "Wrong shape of sequence lengths tensor.";
         if (inShapes[1] != expected_state_shape)
             THROW_IE_EXCEPTION << "Wrong shape of first initial state tensors.";
 //                             << " Expected " << expected_state_shape << " but provided " << inShapes[1];
@@ -81,7 +81,6 @@ private:
     LayerValidators() = default;
 
 private:
-    static LayerValidators* _instance;
     InferenceEngine::details::caseless_unordered_map<std::string, LayerValidator::Ptr> _validators;
 };
 
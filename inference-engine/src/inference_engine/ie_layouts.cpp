@@ -279,7 +279,7 @@ BlockingDesc::BlockingDesc(const SizeVector& dims, Layout layout): offsetPadding
         case Layout::NDHWC:
             checkDims(dims.size(), 5);
             l_order = {0, 2, 3, 4, 1};
-            l_dims = dims;
+            l_dims = {dims[0], dims[2], dims[3], dims[4], dims[1]};
             break;
         case Layout::CHW:
             checkDims(dims.size(), 3);
@@ -289,7 +289,7 @@ BlockingDesc::BlockingDesc(const SizeVector& dims, Layout layout): offsetPadding
         case Layout::CN:
             checkDims(dims.size(), 2);
             l_order = {1, 0};
-            l_dims = {dims[1], dims[2]};
+            l_dims = {dims[1], dims[0]};
             break;
         case Layout::NC:
         case Layout::HW:
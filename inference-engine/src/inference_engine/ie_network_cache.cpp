@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_network_cache.hpp"
+#include "file_utils.h"
+#include "network_serializer.h"
+
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+namespace InferenceEngine {
+
+namespace {
+
+/**
+ * 64-bit FNV-1a of everything written to the stream, the serialized IR is hashed without keeping it in memory
+ */
+class HashBuffer : public std::streambuf {
+public:
+    uint64_t hash = 14695981039346656037ULL;
+
+protected:
+    int_type overflow(int_type c) override {
+        if (c != traits_type::eof()) {
+            const char ch = traits_type::to_char_type(c);
+            xsputn(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char *s, std::streamsize n) override {
+        for (std::streamsize i = 0; i < n; i++) {
+            hash ^= static_cast<unsigned char>(s[i]);
+            hash *= 1099511628211ULL;
+        }
+        return n;
+    }
+};
+
+}  // namespace
+
+std::string compiledNetworkCachePath(const std::string &cacheDir, const ICNNNetwork &network,
+                                     const std::string &device, const std::map<std::string, std::string> &config) {
+    HashBuffer buffer;
+    std::ostream stream(&buffer);
+
+    details::NetworkSerializer::serialize(stream, &stream, network);
+
+    // the serialized IR does not keep the settings of the application
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    for (const auto &input : inputs) {
+        stream << input.first << ':' << input.second->getPrecision().name() << ':' << input.second->getLayout();
+        const PreProcessInfo &preProcess = input.second->getPreProcess();
+        stream << ':' << preProcess.getResizeAlgorithm() << ':' << preProcess.getMeanVariant() << ';';
+    }
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    for (const auto &output : outputs)
+        stream << output.first << ':' << output.second->getPrecision().name() << ':' << output.second->getLayout() << ';';
+
+    stream << device << ';';
+    for (const auto &item : config)
+        stream << item.first << '=' << item.second << ';';
+    stream.flush();
+
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << buffer.hash << ".blob";
+    return FileUtils::makePath(cacheDir, name.str());
+}
+
+}  // namespace InferenceEngine
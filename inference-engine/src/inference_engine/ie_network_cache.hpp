@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief The header provides the naming of the compiled networks in the cache directory
+ * @file ie_network_cache.hpp
+ */
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "ie_api.h"
+#include "ie_icnn_network.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Returns the file of the compiled network in the cache directory (see PluginConfigParams::KEY_CACHE_DIR).
+ * The name is the hash of the IR (the topology and the weights), the precisions, layouts and pre-processing of the
+ * inputs and outputs, the device and the load config, so any change of them leads to another file.
+ * @param cacheDir The cache directory
+ * @param network The network as passed to the load
+ * @param device The identity of the plugin compiling the network
+ * @param config The load config without the cache directory
+ */
+INFERENCE_ENGINE_API_CPP(std::string) compiledNetworkCachePath(const std::string &cacheDir, const ICNNNetwork &network,
+                                                               const std::string &device,
+                                                               const std::map<std::string, std::string> &config);
+
+}  // namespace InferenceEngine
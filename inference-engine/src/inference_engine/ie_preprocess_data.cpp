@@ -3,6 +3,7 @@
 //
 
 #include "cpu_detector.hpp"
+#include "blob_factory.hpp"
 #include "blob_transform.hpp"
 #include "ie_preprocess_data.hpp"
 #ifdef HAVE_SSE
@@ -746,14 +747,73 @@ using namespace Resize;
 
 void PreProcessData::setRoiBlob(const Blob::Ptr &blob) {
     _roiBlob = blob;
+    _batchRois.clear();
+}
+
+void PreProcessData::setRoiBlobs(const Blob::Ptr &frame, const std::vector<ROI> &rois) {
+    if (frame->getTensorDesc().getDims().size() != 4 || frame->getTensorDesc().getDims()[0] != 1) {
+        THROW_IE_EXCEPTION << "ROIs can be set for a 4D frame blob with the batch size 1 only";
+    }
+    if (rois.empty()) {
+        THROW_IE_EXCEPTION << "ROIs of the frame are not set";
+    }
+
+    std::vector<Blob::Ptr> batchRois;
+    for (const auto &roi : rois) {
+        batchRois.push_back(make_shared_blob(frame, roi));
+    }
+    _roiBlob = frame;
+    _batchRois = std::move(batchRois);
 }
 
 Blob::Ptr PreProcessData::getRoiBlob() const {
     return _roiBlob;
 }
 
+namespace {
+
+template <typename T>
+void convertNormalize(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
+                      const std::vector<std::pair<float, float>> &normalization) {
+    const auto &inDesc = inBlob->getTensorDesc();
+    const auto &outDesc = outBlob->getTensorDesc();
+    const auto &dims = outDesc.getDims();
+    const auto *src = inBlob->cbuffer().as<const T *>();
+    auto *dst = outBlob->buffer().as<float *>();
+
+    for (size_t n = 0; n < dims[0]; n++) {
+        for (size_t c = 0; c < dims[1]; c++) {
+            const float mean = normalization.empty() ? 0.f : normalization[c].first;
+            const float scale = normalization.empty() ? 1.f : normalization[c].second;
+            for (size_t h = 0; h < dims[2]; h++) {
+                for (size_t w = 0; w < dims[3]; w++) {
+                    const SizeVector index = {n, c, h, w};
+                    dst[outDesc.offset(index)] = (static_cast<float>(src[inDesc.offset(index)]) - mean) * scale;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
 void PreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm, bool serial,
         int batchSize) {
+    run(outBlob, algorithm, serial, batchSize, {});
+}
+
+void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo &info, bool serial, int batchSize) {
+    std::vector<std::pair<float, float>> normalization;
+    if (info.getMeanVariant() == MEAN_VALUE && outBlob->getTensorDesc().getPrecision() == Precision::FP32) {
+        for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+            normalization.emplace_back(info[c]->meanValue, 1.f / info[c]->stdScale);
+        }
+    }
+    run(outBlob, info.getResizeAlgorithm(), serial, batchSize, normalization);
+}
+
+void PreProcessData::run(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm, bool serial, int batchSize,
+        const std::vector<std::pair<float, float>> &normalization) {
     IE_PROFILING_AUTO_SCOPE_TASK(perf_preprocessing)
 
     if (algorithm == NO_RESIZE) {
@@ -769,6 +829,11 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorith
                            << batchSize;
     }
 
+    if (!_batchRois.empty()) {
+        runRois(outBlob, algorithm, serial, batchSize, normalization);
+        return;
+    }
+
     if (batchSize < 0) {
         // if batch_size is unspecified, process the whole input blob
         batchSize = static_cast<int>(_roiBlob->getTensorDesc().getDims()[0]);
@@ -777,7 +842,7 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorith
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
-    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, serial, batchSize)) {
+    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, serial, batchSize, normalization)) {
         return;
     }
 
@@ -786,29 +851,73 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorith
                                 "Use default pre-processing instead to process batches.";
     }
 
+    resizeBlob(_roiBlob, outBlob, algorithm, normalization);
+}
+
+void PreProcessData::runRois(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm, bool serial, int batchSize,
+        const std::vector<std::pair<float, float>> &normalization) {
+    std::vector<Blob::Ptr> rois = _batchRois;
+    if (batchSize > 0 && static_cast<size_t>(batchSize) < rois.size()) {
+        // with the dynamic batch the ROIs after the current batch are skipped
+        rois.resize(batchSize);
+    }
+
+    if (!_preproc) {
+        _preproc.reset(new PreprocEngine);
+    }
+    if (_preproc->preprocessRoisWithGAPI(rois, outBlob, algorithm, serial, normalization)) {
+        return;
+    }
+
+    // the ROIs are resized one by one to the blobs sharing the memory of the batches
+    const auto &outDesc = outBlob->getTensorDesc();
+    const auto &outDims = outDesc.getDims();
+    if (rois.size() > outDims[0]) {
+        THROW_IE_EXCEPTION << "Provided number of ROIs is invalid: " << rois.size()
+                           << ", the network expects up to " << outDims[0];
+    }
+    if (outDesc.getLayout() != NCHW && outDesc.getLayout() != NHWC) {
+        THROW_IE_EXCEPTION << "Preprocess support NCHW/NHWC only";
+    }
+    const size_t batchOffset = outDims[1] * outDims[2] * outDims[3] * outBlob->element_size();
+    const TensorDesc batchDesc(outDesc.getPrecision(), {1, outDims[1], outDims[2], outDims[3]}, outDesc.getLayout());
+    for (size_t i = 0; i < rois.size(); i++) {
+        auto *batch = outBlob->buffer().as<uint8_t *>() + i * batchOffset;
+        Blob::Ptr batchBlob = make_blob_with_precision(batchDesc, batch);
+        resizeBlob(rois[i], batchBlob, algorithm, normalization);
+    }
+}
+
+void PreProcessData::resizeBlob(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
+        const std::vector<std::pair<float, float>> &normalization) {
     Blob::Ptr res_in, res_out;
-    if (_roiBlob->getTensorDesc().getLayout() == NHWC) {
-        if (!_tmp1 || _tmp1->size() != _roiBlob->size()) {
-            if (_roiBlob->getTensorDesc().getPrecision() == Precision::FP32) {
-                _tmp1 = make_shared_blob<float>(Precision::FP32, NCHW, _roiBlob->dims());
+    if (inBlob->getTensorDesc().getLayout() == NHWC) {
+        // the ROIs of a frame may have the same size but different dimensions
+        if (!_tmp1 || _tmp1->getTensorDesc().getDims() != inBlob->getTensorDesc().getDims() ||
+            _tmp1->getTensorDesc().getPrecision() != inBlob->getTensorDesc().getPrecision()) {
+            if (inBlob->getTensorDesc().getPrecision() == Precision::FP32) {
+                _tmp1 = make_shared_blob<float>(Precision::FP32, NCHW, inBlob->dims());
             } else {
-                _tmp1 = make_shared_blob<uint8_t>(Precision::U8, NCHW, _roiBlob->dims());
+                _tmp1 = make_shared_blob<uint8_t>(Precision::U8, NCHW, inBlob->dims());
             }
             _tmp1->allocate();
         }
 
         {
             IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_before)
-            blob_copy(_roiBlob, _tmp1);
+            blob_copy(inBlob, _tmp1);
         }
         res_in = _tmp1;
     } else {
-        res_in = _roiBlob;
+        res_in = inBlob;
     }
 
-    if (outBlob->getTensorDesc().getLayout() == NHWC) {
-        if (!_tmp2 || _tmp2->size() != outBlob->size()) {
-            if (outBlob->getTensorDesc().getPrecision() == Precision::FP32) {
+    // the resize keeps the precision, so the conversion and the normalization are a separate pass here
+    const Precision inPrecision = inBlob->getTensorDesc().getPrecision();
+    const bool convert = inPrecision != outBlob->getTensorDesc().getPrecision() || !normalization.empty();
+    if (outBlob->getTensorDesc().getLayout() == NHWC || convert) {
+        if (!_tmp2 || _tmp2->size() != outBlob->size() || _tmp2->getTensorDesc().getPrecision() != inPrecision) {
+            if (inPrecision == Precision::FP32) {
                 _tmp2 = make_shared_blob<float>(Precision::FP32, NCHW, outBlob->dims());
             } else {
                 _tmp2 = make_shared_blob<uint8_t>(Precision::U8, NCHW, outBlob->dims());
@@ -825,7 +934,16 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorith
         resize(res_in, res_out, algorithm);
     }
 
-    if (res_out == _tmp2) {
+    if (convert) {
+        IE_PROFILING_AUTO_SCOPE_TASK(perf_normalize)
+        if (outBlob->getTensorDesc().getPrecision() != Precision::FP32)
+            THROW_IE_EXCEPTION << "Input pre-processing converts and normalizes to FP32 only";
+        if (inPrecision == Precision::FP32) {
+            convertNormalize<float>(_tmp2, outBlob, normalization);
+        } else {
+            convertNormalize<uint8_t>(_tmp2, outBlob, normalization);
+        }
+    } else if (res_out == _tmp2) {
         IE_PROFILING_AUTO_SCOPE_TASK(perf_reorder_after)
         blob_copy(_tmp2, outBlob);
     }
@@ -7,6 +7,8 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "ie_blob.h"
 #include "ie_input_info.hpp"
@@ -24,6 +26,10 @@ class INFERENCE_ENGINE_API_CLASS(PreProcessData) {
      * @brief ROI blob.
      */
     Blob::Ptr _roiBlob = nullptr;
+    /**
+     * @brief ROI blobs of the frame set with setRoiBlobs, the ROI i is placed to the batch i.
+     */
+    std::vector<Blob::Ptr> _batchRois;
     Blob::Ptr _tmp1 = nullptr;
     Blob::Ptr _tmp2 = nullptr;
 
@@ -36,8 +42,18 @@ class INFERENCE_ENGINE_API_CLASS(PreProcessData) {
     InferenceEngine::ProfilingTask perf_resize {"Resize"};
     InferenceEngine::ProfilingTask perf_reorder_before {"Reorder before"};
     InferenceEngine::ProfilingTask perf_reorder_after {"Reorder after"};
+    InferenceEngine::ProfilingTask perf_normalize {"Normalize"};
     InferenceEngine::ProfilingTask perf_preprocessing {"Preprocessing"};
 
+    void run(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm, bool serial, int batchSize,
+             const std::vector<std::pair<float, float>> &normalization);
+
+    void runRois(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm, bool serial, int batchSize,
+                 const std::vector<std::pair<float, float>> &normalization);
+
+    void resizeBlob(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
+                    const std::vector<std::pair<float, float>> &normalization);
+
 public:
     /**
      * @brief Sets ROI blob to be resized and placed to the default input blob during pre-processing.
@@ -46,7 +62,16 @@ public:
     void setRoiBlob(const Blob::Ptr &blob);
 
     /**
-     * @brief Gets pointer to the ROI blob used for a given input.
+     * @brief Sets ROIs of one frame to be resized and placed to the consecutive batches of the default input blob
+     * during pre-processing, the ROI i is placed to the batch i. The ROIs share the memory of the frame and they are
+     * resized in parallel in one call, the batches after the last ROI are left intact.
+     * @param frame blob of the frame with the batch size 1.
+     * @param rois ROIs inside of the frame.
+     */
+    void setRoiBlobs(const Blob::Ptr &frame, const std::vector<ROI> &rois);
+
+    /**
+     * @brief Gets pointer to the ROI blob used for a given input, the frame if the ROIs are set with setRoiBlobs.
      * @return Blob pointer.
      */
     Blob::Ptr getRoiBlob() const;
@@ -61,6 +86,17 @@ public:
     void execute(Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm, bool serial,
                  int batchSize = -1);
 
+    /**
+     * @brief Executes input pre-processing with the resize algorithm of the given pre-process info. When the output
+     * blob is FP32, an U8 ROI blob is converted and the MEAN_VALUE mean and scale of the channels are applied in the
+     * same pass as the resize, so the caller must not apply them to the output blob again.
+     * @param outBlob pre-processed output blob to be used for inference.
+     * @param info pre-process info of the input.
+     * @param serial disable OpenMP threading if the value set to true.
+     * @param batchSize batch size for pre-processing.
+     */
+    void execute(Blob::Ptr &outBlob, const PreProcessInfo &info, bool serial, int batchSize = -1);
+
     static void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst);
 };
 
@@ -123,24 +123,51 @@ std::vector<cv::GMat> to_vec(std::tuple<Ts...> &&gmats) {
     return to_vec_impl(std::move(gmats), typename cv::detail::MkSeq<sizeof...(Ts)>::type());
 }
 
+// The conversion and the normalization are fused into the graph after the resize, so the planes are resized in
+// the input precision and every output line is written once
+std::vector<cv::GMat> normalize(const std::vector<cv::GMat> &planes,
+                                int in_precision,
+                                int out_precision,
+                                const PreprocEngine::Normalization &normalization) {
+    if (in_precision == out_precision && normalization.empty()) {
+        return planes;
+    }
+    if (!normalization.empty() && normalization.size() != planes.size()) {
+        THROW_IE_EXCEPTION << "Normalization is given for " << normalization.size()
+                           << " channels, but the blob has " << planes.size() << " channels";
+    }
+
+    std::vector<cv::GMat> result;
+    for (size_t i = 0; i < planes.size(); i++) {
+        const float mean  = normalization.empty() ? 0.f : normalization[i].first;
+        const float scale = normalization.empty() ? 1.f : normalization[i].second;
+        result.emplace_back(gapi::ConvertNormalizePlane::on(planes[i], mean, scale));
+    }
+    return result;
+}
+
 cv::GComputation buildGraph(const G::Desc &in_desc,
                             const G::Desc &out_desc,
                             InferenceEngine::Layout in_layout,
                             InferenceEngine::Layout out_layout,
                             InferenceEngine::ResizeAlgorithm algorithm,
-                            int precision) {
+                            int precision,
+                            int out_precision,
+                            const PreprocEngine::Normalization &normalization) {
     if ((in_layout == NHWC) && (in_desc.d.C == 3) && (precision == CV_8U) && (algorithm == RESIZE_BILINEAR)) {
         const auto input_sz = cv::gapi::own::Size(in_desc.d.W, in_desc.d.H);
         const auto scale_sz = cv::gapi::own::Size(out_desc.d.W, out_desc.d.H);
         std::vector<cv::GMat> inputs(1);
         std::vector<cv::GMat> outputs;
 
+        auto planes = normalize(to_vec(gapi::ScalePlanes::on(inputs[0], precision, input_sz, scale_sz,
+                                                             cv::INTER_LINEAR)),
+                                precision, out_precision, normalization);
         if (out_layout == NHWC) {
             outputs.resize(1);
-            auto planes = to_vec(gapi::ScalePlanes::on(inputs[0], precision, input_sz, scale_sz, cv::INTER_LINEAR));
             outputs[0] = gapi::Merge3::on(planes[0], planes[1], planes[2]);
         } else {
-            outputs = to_vec(gapi::ScalePlanes::on(inputs[0], precision, input_sz, scale_sz, cv::INTER_LINEAR));
+            outputs = planes;
         }
         return cv::GComputation(inputs, outputs);
     }
@@ -184,6 +211,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                                      precision,
                                      input_sz, scale_sz, interp_type);
     std::transform(planes.begin(), planes.end(), std::back_inserter(out_planes), scale_fcn);
+    out_planes = normalize(out_planes, precision, out_precision, normalization);
 
     // Convert to expected layout, if required
     std::vector<cv::GMat> outputs;  // 1 element if NHWC, C elements if NCHW
@@ -200,33 +228,112 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
     return cv::GComputation(inputs, outputs);
 }
+
+bool gapiDisabled() {
+    static const bool NO_GAPI = [](const char *str) -> bool {
+        std::string var(str ? str : "");
+        return var == "N" || var == "NO" || var == "OFF" || var == "0";
+    } (std::getenv("USE_GAPI"));
+    return NO_GAPI;
+}
+
+void validateBlobs(const Blob::Ptr &inBlob, const Blob::Ptr &outBlob,
+                   const PreprocEngine::Normalization &normalization) {
+    const auto &in_desc_ie = inBlob->getTensorDesc();
+    const auto &out_desc_ie = outBlob->getTensorDesc();
+    auto supports_layout = [](Layout l) { return l == Layout::NCHW || l == Layout::NHWC; };
+    if (!supports_layout(inBlob->layout()) || !supports_layout(outBlob->layout())
+        || in_desc_ie.getDims().size() != 4 || out_desc_ie.getDims().size() != 4) {
+        THROW_IE_EXCEPTION << "Preprocess support NCHW/NHWC only";
+    }
+
+    // the precision is kept, except an U8 input can be converted to FP32 output
+    const auto in_prec = in_desc_ie.getPrecision(), out_prec = out_desc_ie.getPrecision();
+    if (in_prec != out_prec && !(in_prec == Precision::U8 && out_prec == Precision::FP32)) {
+        THROW_IE_EXCEPTION << "Preprocess converts U8 to FP32 only, but " << in_prec.name() << " to " << out_prec.name()
+                           << " is requested";
+    }
+    if (!normalization.empty() && out_prec != Precision::FP32) {
+        THROW_IE_EXCEPTION << "Preprocess normalization requires FP32 output";
+    }
+}
 }  // anonymous namespace
 
-InferenceEngine::PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+// the number of the least recently used compiled graphs kept by the cache
+static const size_t CACHED_GRAPHS = 16;
+
+// the least number of the output rows computed by a thread of the preprocessing of a single blob
+static const int MIN_STRIPE_ROWS = 16;
+
+std::mutex InferenceEngine::PreprocEngine::_cacheMutex;
+std::list<InferenceEngine::PreprocEngine::CachedGraph> InferenceEngine::PreprocEngine::_cache;
 
-InferenceEngine::PreprocEngine::Update InferenceEngine::PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+InferenceEngine::PreprocEngine::PreprocEngine()
+    : _lastComp(parallel_get_max_threads()), _roiCalls(parallel_get_max_threads()),
+      _roiComp(parallel_get_max_threads()) {}
+
+InferenceEngine::PreprocEngine::~PreprocEngine() {
+    putCached();
+}
+
+bool InferenceEngine::PreprocEngine::takeCached(const CallDesc &call, int slices) {
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+    // the compiled objects are not shared, an engine takes the entry out of the cache while using it
+    auto it = std::find_if(_cache.begin(), _cache.end(), [&](const CachedGraph &cached) {
+        return cached.slices == slices && cached.call == call;
+    });
+    if (it == _cache.end())
+        return false;
+
+    _lastCall = cv::util::make_optional(std::move(it->call));
+    _lastComp = std::move(it->compiled);
+    _lastComp.resize(std::max<size_t>(_lastComp.size(), parallel_get_max_threads()));
+    _lastSlices = slices;
+    _cache.erase(it);
+    return true;
+}
+
+void InferenceEngine::PreprocEngine::putCached() {
+    if (!_lastCall || _lastSlices == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+    _cache.push_front(CachedGraph{ std::move(*_lastCall), _lastSlices, std::move(_lastComp) });
+    if (_cache.size() > CACHED_GRAPHS)
+        _cache.pop_back();
+
+    _lastCall.reset();
+    _lastComp = std::vector<cv::GCompiled>(parallel_get_max_threads());
+    _lastSlices = 0;
+}
+
+InferenceEngine::PreprocEngine::Update InferenceEngine::PreprocEngine::needUpdate(const Opt<CallDesc> &lastCall,
+                                                                                 const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
     // 0. This is the first call ever
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
+    // 3a. normalization has changed (its values are graph parameters)
     // 4. dimensions have changed from downscale to upscale or
     // vice-versa if interpolation is AREA.
-    if (!_lastCall) {
+    if (!lastCall) {
         return Update::REBUILD;
     }
 
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    Normalization last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = *lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    Normalization new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -242,7 +349,7 @@ InferenceEngine::PreprocEngine::Update InferenceEngine::PreprocEngine::needUpdat
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -276,22 +383,14 @@ InferenceEngine::PreprocEngine::Update InferenceEngine::PreprocEngine::needUpdat
 }
 
 bool InferenceEngine::PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm &algorithm, bool omp_serial, int batch_size) {
-    static const bool NO_GAPI = [](const char *str) -> bool {
-        std::string var(str ? str : "");
-        return var == "N" || var == "NO" || var == "OFF" || var == "0";
-    } (std::getenv("USE_GAPI"));
-
-    if (NO_GAPI)
+        const ResizeAlgorithm &algorithm, bool omp_serial, int batch_size, const Normalization &normalization) {
+    if (gapiDisabled())
         return false;
 
+    validateBlobs(inBlob, outBlob, normalization);
+
     const auto &in_desc_ie = inBlob->getTensorDesc();
     const auto &out_desc_ie = outBlob->getTensorDesc();
-    auto supports_layout = [](Layout l) { return l == Layout::NCHW || l == Layout::NHWC; };
-    if (!supports_layout(inBlob->layout()) || !supports_layout(outBlob->layout())
-        || in_desc_ie.getDims().size() != 4 || out_desc_ie.getDims().size() != 4) {
-        THROW_IE_EXCEPTION << "Preprocess support NCHW/NHWC only";
-    }
 
     const G::Desc
         in_desc = G::decompose(inBlob),
@@ -317,11 +416,39 @@ bool InferenceEngine::PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob:
                                   BlobDesc{ out_desc_ie.getPrecision(),
                                             outBlob->layout(),
                                             out_desc_ie.getDims() },
-                                  algorithm };
-    const Update update = needUpdate(thisCall);
+                                  algorithm,
+                                  normalization };
+    // The output rows are split into a stripe per thread, Fluid reads the halo rows of the resize around the
+    // stripes itself. The stripes are kept high enough for the halo to stay a small part of their work, so the
+    // small outputs run on fewer threads
+    const int max_slices = std::max(1, std::min(parallel_get_max_threads(), out_desc.d.H / MIN_STRIPE_ROWS));
+    const int thread_num =
+            #if IE_THREAD == IE_THREAD_OMP
+                omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+            #endif
+                max_slices;
+
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    // the number of slices parallel_nt_static splits the graph into
+    #if IE_THREAD == IE_THREAD_SEQ
+    const int slices = 1;
+    #else
+    const int slices = thread_num;
+    #endif
+
+    // when the call changes, the current graphs go to the cache and the graphs compiled for
+    // the new call are taken from it, the new graph is compiled (not reshaped) on a miss to keep the cached one
+    Update update = needUpdate(_lastCall, thisCall);
+    if (Update::NOTHING != update) {
+        putCached();
+        update = takeCached(thisCall, slices) ? Update::NOTHING : Update::REBUILD;
+    }
 
     Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
+        _lastSlices = 0;
         _lastCall = cv::util::make_optional(std::move(thisCall));
 
         if (Update::REBUILD == update) {
@@ -332,21 +459,14 @@ bool InferenceEngine::PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob:
                                                                   inBlob->layout(),
                                                                   outBlob->layout(),
                                                                   algorithm,
-                                                                  get_cv_depth(in_desc_ie)));
+                                                                  get_cv_depth(in_desc_ie),
+                                                                  get_cv_depth(out_desc_ie),
+                                                                  normalization));
         }
     }
     auto batched_input_plane_mats  = bind_to_blob(inBlob, batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    const int thread_num =
-            #if IE_THREAD == IE_THREAD_OMP
-                omp_serial ? 1 :    // disable threading for OpenMP if was asked for
-            #endif
-                0;                  // use all available threads
-
-    // to suppress unused warnings
-    (void)(omp_serial);
-
     // Split the whole graph into `total_slices` slices, where
     // `total_slices` is provided by the parallel runtime and assumed
     // to be number of threads used.  However it is not guaranteed
@@ -410,6 +530,93 @@ bool InferenceEngine::PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob:
             compiled(std::move(call_ins), std::move(call_outs));
         }
     });
+    // the graphs are cached only once all the slices are compiled
+    _lastSlices = slices;
+
+    return true;
+}
+
+bool InferenceEngine::PreprocEngine::preprocessRoisWithGAPI(const std::vector<Blob::Ptr> &rois, Blob::Ptr &outBlob,
+        const ResizeAlgorithm &algorithm, bool omp_serial, const Normalization &normalization) {
+    if (gapiDisabled())
+        return false;
+
+    for (const auto &roi : rois) {
+        validateBlobs(roi, outBlob, normalization);
+        if (roi->getTensorDesc().getDims()[0] != 1) {
+            THROW_IE_EXCEPTION << "ROI blob batch size is invalid: " << roi->getTensorDesc().getDims()[0] << " != 1";
+        }
+    }
+
+    const auto &out_desc_ie = outBlob->getTensorDesc();
+    const G::Desc out_desc = G::decompose(outBlob);
+    if (rois.empty() || static_cast<int>(rois.size()) > out_desc.d.N) {
+        THROW_IE_EXCEPTION << "Provided number of ROIs is invalid: " << rois.size()
+                           << ", the network expects up to " << out_desc.d.N;
+    }
+
+    auto batched_output_plane_mats = bind_to_blob(outBlob, static_cast<int>(rois.size()));
+
+    const int thread_num =
+            #if IE_THREAD == IE_THREAD_OMP
+                omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+            #endif
+                0;                  // use all available threads
+
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    // Every slice resizes the whole ROIs i, i + total_slices, ..., so the graph is compiled
+    // for the full output and only reshaped when the size of the next ROI of the slice changes
+    parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
+        IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_tile);
+
+        auto& lastCall = _roiCalls[slice_n];
+        auto& compiled = _roiComp[slice_n];
+        for (size_t i = slice_n; i < rois.size(); i += total_slices) {
+            Blob::Ptr roi = rois[i];
+            const auto &in_desc_ie = roi->getTensorDesc();
+            const G::Desc in_desc = G::decompose(roi);
+
+            CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
+                                                    roi->layout(),
+                                                    in_desc_ie.getDims() },
+                                          BlobDesc{ out_desc_ie.getPrecision(),
+                                                    outBlob->layout(),
+                                                    out_desc_ie.getDims() },
+                                          algorithm,
+                                          normalization };
+            const Update update = needUpdate(lastCall, thisCall);
+
+            const auto input_plane_mats = bind_to_blob(roi, 1)[0];
+            if (Update::REBUILD == update) {
+                IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
+                auto computation = buildGraph(in_desc,
+                                              out_desc,
+                                              roi->layout(),
+                                              outBlob->layout(),
+                                              algorithm,
+                                              get_cv_depth(in_desc_ie),
+                                              get_cv_depth(out_desc_ie),
+                                              normalization);
+                compiled = computation.compile(descr_of(input_plane_mats), cv::compile_args(gapi::preprocKernels()));
+            } else if (Update::RESHAPE == update) {
+                IE_PROFILING_AUTO_SCOPE_TASK(_perf_graph_compiling);
+                compiled.reshape(descr_of(input_plane_mats), cv::compile_args(gapi::preprocKernels()));
+            }
+            if (Update::NOTHING != update) {
+                lastCall = cv::util::make_optional(std::move(thisCall));
+            }
+
+            cv::GRunArgs call_ins;
+            cv::GRunArgsP call_outs;
+            for (const auto & m : input_plane_mats) { call_ins.emplace_back(m);}
+            for (auto & m : batched_output_plane_mats[i]) { call_outs.emplace_back(&m);}
+
+            IE_PROFILING_AUTO_SCOPE_TASK(_perf_exec_graph);
+            compiled(std::move(call_ins), std::move(call_outs));
+        }
+    });
 
     return true;
 }
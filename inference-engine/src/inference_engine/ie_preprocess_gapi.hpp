@@ -7,7 +7,10 @@
 #include "ie_blob.h"
 #include "ie_input_info.hpp"
 
+#include <list>
+#include <mutex>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/util/optional.hpp>
@@ -19,12 +22,38 @@
 namespace InferenceEngine {
 
 class PreprocEngine {
+public:
+    /**
+     * @brief The per channel (mean, scale) pairs applied as (x - mean) * scale after the resize,
+     * when empty and the output is FP32 an U8 input is only converted
+     */
+    using Normalization = std::vector<std::pair<float, float>>;
+
+private:
     using BlobDesc = std::tuple<Precision, Layout, SizeVector>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, Normalization>;
     template<typename T> using Opt = cv::util::optional<T>;
 
     Opt<CallDesc> _lastCall;
     std::vector<cv::GCompiled> _lastComp;
+    int _lastSlices = 0;
+
+    // the graphs compiled for the calls the engines switched away from, shared by the engines of all the
+    // requests, so the sources alternating a few input sizes don't compile the graph on every change
+    struct CachedGraph {
+        CallDesc call;
+        int slices;
+        std::vector<cv::GCompiled> compiled;
+    };
+    static std::mutex _cacheMutex;
+    static std::list<CachedGraph> _cache;
+
+    bool takeCached(const CallDesc &call, int slices);
+    void putCached();
+
+    // the graphs of the batched ROIs are compiled per thread, every one for the last ROI it resized
+    std::vector<Opt<CallDesc>> _roiCalls;
+    std::vector<cv::GCompiled> _roiComp;
 
     ProfilingTask _perf_graph_building {"Preproc Graph Building"};
     ProfilingTask _perf_exec_tile  {"Preproc Calc Tile"};
@@ -32,12 +61,21 @@ class PreprocEngine {
     ProfilingTask _perf_graph_compiling {"Preproc Graph compiling"};
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const Opt<CallDesc> &lastCall, const CallDesc &newCall);
 
 public:
     PreprocEngine();
+    ~PreprocEngine();
     bool preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        bool omp_serial, int batch_size = -1);
+        bool omp_serial, int batch_size = -1, const Normalization &normalization = {});
+
+    /**
+     * @brief Resizes the ROI blobs of one frame to the consecutive batch slots of the output blob, the ROI i is
+     * placed to the batch i. The ROIs are distributed among the threads, so the rows of the frame shared by the
+     * ROIs are read while they are cached.
+     */
+    bool preprocessRoisWithGAPI(const std::vector<Blob::Ptr> &rois, Blob::Ptr &outBlob,
+        const ResizeAlgorithm &algorithm, bool omp_serial, const Normalization &normalization = {});
 };
 
 }  // namespace InferenceEngine
@@ -10,6 +10,12 @@
 #if MANUAL_SIMD
   #include "cpu_detector.hpp"
   #include "ie_preprocess_gapi_kernels_sse42.hpp"
+  #ifdef HAVE_AVX2
+    #include "ie_preprocess_gapi_kernels_avx2.hpp"
+  #endif
+  #ifdef HAVE_AVX512
+    #include "ie_preprocess_gapi_kernels_avx512.hpp"
+  #endif
 #endif
 
 #include <opencv2/gapi/opencv_includes.hpp>
@@ -29,6 +35,78 @@ namespace kernels {
 template<typename T, int chs> static
 void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int length) {
 #if MANUAL_SIMD
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        // the 8U rows are processed with the AVX2 kernels
+        if (std::is_same<T, float>::value && chs == 2) {
+            avx512::mergeRow_32FC2(reinterpret_cast<const float*>(ins[0]),
+                                   reinterpret_cast<const float*>(ins[1]),
+                                   reinterpret_cast<float*>(out), length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx512::mergeRow_32FC3(reinterpret_cast<const float*>(ins[0]),
+                                   reinterpret_cast<const float*>(ins[1]),
+                                   reinterpret_cast<const float*>(ins[2]),
+                                   reinterpret_cast<float*>(out), length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 4) {
+            avx512::mergeRow_32FC4(reinterpret_cast<const float*>(ins[0]),
+                                   reinterpret_cast<const float*>(ins[1]),
+                                   reinterpret_cast<const float*>(ins[2]),
+                                   reinterpret_cast<const float*>(ins[3]),
+                                   reinterpret_cast<float*>(out), length);
+            return;
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value && chs == 2) {
+            avx::mergeRow_8UC2(ins[0], ins[1], out, length);
+            return;
+        }
+
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx::mergeRow_8UC3(ins[0], ins[1], ins[2], out, length);
+            return;
+        }
+
+        if (std::is_same<T, uint8_t>::value && chs == 4) {
+            avx::mergeRow_8UC4(ins[0], ins[1], ins[2], ins[3], out, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 2) {
+            avx::mergeRow_32FC2(reinterpret_cast<const float*>(ins[0]),
+                                reinterpret_cast<const float*>(ins[1]),
+                                reinterpret_cast<float*>(out), length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx::mergeRow_32FC3(reinterpret_cast<const float*>(ins[0]),
+                                reinterpret_cast<const float*>(ins[1]),
+                                reinterpret_cast<const float*>(ins[2]),
+                                reinterpret_cast<float*>(out), length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 4) {
+            avx::mergeRow_32FC4(reinterpret_cast<const float*>(ins[0]),
+                                reinterpret_cast<const float*>(ins[1]),
+                                reinterpret_cast<const float*>(ins[2]),
+                                reinterpret_cast<const float*>(ins[3]),
+                                reinterpret_cast<float*>(out), length);
+            return;
+        }
+    }
+#endif
+
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value && chs == 2) {
             mergeRow_8UC2(ins[0], ins[1], out, length);
@@ -87,6 +165,84 @@ void mergeRow(const std::array<const uint8_t*, chs>& ins, uint8_t* out, int leng
 template<typename T, int chs> static
 void splitRow(const uint8_t* in, std::array<uint8_t*, chs>& outs, int length) {
 #if MANUAL_SIMD
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        // the 8U rows are processed with the AVX2 kernels
+        if (std::is_same<T, float>::value && chs == 2) {
+            avx512::splitRow_32FC2(reinterpret_cast<const float*>(in),
+                                   reinterpret_cast<float*>(outs[0]),
+                                   reinterpret_cast<float*>(outs[1]),
+                                   length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx512::splitRow_32FC3(reinterpret_cast<const float*>(in),
+                                   reinterpret_cast<float*>(outs[0]),
+                                   reinterpret_cast<float*>(outs[1]),
+                                   reinterpret_cast<float*>(outs[2]),
+                                   length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 4) {
+            avx512::splitRow_32FC4(reinterpret_cast<const float*>(in),
+                                   reinterpret_cast<float*>(outs[0]),
+                                   reinterpret_cast<float*>(outs[1]),
+                                   reinterpret_cast<float*>(outs[2]),
+                                   reinterpret_cast<float*>(outs[3]),
+                                   length);
+            return;
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value && chs == 2) {
+            avx::splitRow_8UC2(in, outs[0], outs[1], length);
+            return;
+        }
+
+        if (std::is_same<T, uint8_t>::value && chs == 3) {
+            avx::splitRow_8UC3(in, outs[0], outs[1], outs[2], length);
+            return;
+        }
+
+        if (std::is_same<T, uint8_t>::value && chs == 4) {
+            avx::splitRow_8UC4(in, outs[0], outs[1], outs[2], outs[3], length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 2) {
+            avx::splitRow_32FC2(reinterpret_cast<const float*>(in),
+                                reinterpret_cast<float*>(outs[0]),
+                                reinterpret_cast<float*>(outs[1]),
+                                length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 3) {
+            avx::splitRow_32FC3(reinterpret_cast<const float*>(in),
+                                reinterpret_cast<float*>(outs[0]),
+                                reinterpret_cast<float*>(outs[1]),
+                                reinterpret_cast<float*>(outs[2]),
+                                length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value && chs == 4) {
+            avx::splitRow_32FC4(reinterpret_cast<const float*>(in),
+                                reinterpret_cast<float*>(outs[0]),
+                                reinterpret_cast<float*>(outs[1]),
+                                reinterpret_cast<float*>(outs[2]),
+                                reinterpret_cast<float*>(outs[3]),
+                                length);
+            return;
+        }
+    }
+#endif
+
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value && chs == 2) {
             splitRow_8UC2(in, outs[0], outs[1], length);
@@ -316,6 +472,24 @@ GAPI_FLUID_KERNEL(FChanToPlane, ChanToPlane, false) {
     }
 };
 
+template<typename T> static
+void convertNormalizeRow(const uint8_t* in, float mean, float scale, float* out, int length) {
+    auto inT = reinterpret_cast<const T*>(in);
+    for (int x = 0; x < length; x++) {
+        out[x] = (static_cast<float>(inT[x]) - mean) * scale;
+    }
+}
+
+GAPI_FLUID_KERNEL(FConvertNormalizePlane, ConvertNormalizePlane, false) {
+    static const int Window = 1;
+    static void run(const cv::gapi::fluid::View& in, float mean, float scale,
+                    cv::gapi::fluid::Buffer& out) {
+        const auto rowFunc = (in.meta().depth == CV_8U) ? &convertNormalizeRow<uint8_t>
+                                                        : &convertNormalizeRow<float>;
+        rowFunc(in.InLineB(0), mean, scale, out.OutLine<float>(), in.length());
+    }
+};
+
 //----------------------------------------------------------------------
 
 G_TYPED_KERNEL(ScalePlane8u, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_8u") {
@@ -562,6 +736,64 @@ static void calcRowLinear(const cv::gapi::fluid::View  & in,
     }
 
 #if MANUAL_SIMD
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (std::is_same<T, uint8_t>::value) {
+            if (inSz.width >= 32 && outSz.width >= 16) {
+                avx512::calcRowLinear_8U(reinterpret_cast<uint8_t**>(dst),
+                                         reinterpret_cast<const uint8_t**>(src0),
+                                         reinterpret_cast<const uint8_t**>(src1),
+                                         reinterpret_cast<const short*>(alpha),
+                                         reinterpret_cast<const short*>(mapsx),
+                                         reinterpret_cast<const short*>(beta),
+                                         reinterpret_cast<uint8_t*>(tmp),
+                                         inSz, outSz, lpi);
+                return;
+            }
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx512::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                      reinterpret_cast<const float**>(src0),
+                                      reinterpret_cast<const float**>(src1),
+                                      reinterpret_cast<const float*>(alpha),
+                                      reinterpret_cast<const int*>(mapsx),
+                                      reinterpret_cast<const float*>(beta),
+                                      inSz, outSz, lpi);
+            return;
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            if (inSz.width >= 16 && outSz.width >= 16) {
+                avx::calcRowLinear_8U(reinterpret_cast<uint8_t**>(dst),
+                                      reinterpret_cast<const uint8_t**>(src0),
+                                      reinterpret_cast<const uint8_t**>(src1),
+                                      reinterpret_cast<const short*>(alpha),
+                                      reinterpret_cast<const short*>(mapsx),
+                                      reinterpret_cast<const short*>(beta),
+                                      reinterpret_cast<uint8_t*>(tmp),
+                                      inSz, outSz, lpi);
+                return;
+            }
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx::calcRowLinear_32F(reinterpret_cast<float**>(dst),
+                                   reinterpret_cast<const float**>(src0),
+                                   reinterpret_cast<const float**>(src1),
+                                   reinterpret_cast<const float*>(alpha),
+                                   reinterpret_cast<const int*>(mapsx),
+                                   reinterpret_cast<const float*>(beta),
+                                   inSz, outSz, lpi);
+            return;
+        }
+    }
+#endif
+
     if (with_cpu_x86_sse42()) {
         if (std::is_same<T, uint8_t>::value) {
             if (inSz.width >= 16 && outSz.width >= 8) {
@@ -652,6 +884,38 @@ static void calcRowLinearC3(const cv::gapi::fluid::View  & in,
     }
 
 #if MANUAL_SIMD
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        if (inSz.width * 3 >= 32 && outSz.width >= 16) {
+            avx512::calcRowLinear_8UC3(dst,
+                                       reinterpret_cast<const uint8_t**>(src0),
+                                       reinterpret_cast<const uint8_t**>(src1),
+                                       reinterpret_cast<const short*>(alpha),
+                                       reinterpret_cast<const short*>(mapsx),
+                                       reinterpret_cast<const short*>(beta),
+                                       reinterpret_cast<uint8_t*>(tmp),
+                                       inSz, outSz, lpi);
+            return;
+        }
+    }
+#endif
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (inSz.width * 3 >= 16 && outSz.width >= 16) {
+            avx::calcRowLinear_8UC3(dst,
+                                    reinterpret_cast<const uint8_t**>(src0),
+                                    reinterpret_cast<const uint8_t**>(src1),
+                                    reinterpret_cast<const short*>(alpha),
+                                    reinterpret_cast<const short*>(mapsx),
+                                    reinterpret_cast<const short*>(beta),
+                                    reinterpret_cast<uint8_t*>(tmp),
+                                    inSz, outSz, lpi);
+            return;
+        }
+    }
+#endif
+
     if (with_cpu_x86_sse42()) {
         if (inSz.width >= 16 && outSz.width >= 8) {
             calcRowLinear_8UC3(dst,
@@ -998,6 +1262,66 @@ static void calcAreaRow(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer
         auto dst = out.OutLine<T>(l);
 
 #if MANUAL_SIMD
+#ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512_core()) {
+            if (std::is_same<T, uchar>::value) {
+                avx512::calcRowArea_8U(reinterpret_cast<uchar*>(dst),
+                                       reinterpret_cast<const uchar**>(src),
+                                       inSz, outSz,
+                                       static_cast<Q0_16>(ymapper.alpha),
+                                       reinterpret_cast<const avx512::MapperUnit8U&>(ymap),
+                                       xmaxdf[0],
+                                       reinterpret_cast<const short*>(xindex),
+                                       reinterpret_cast<const Q0_16*>(xalpha),
+                                       reinterpret_cast<Q8_8*>(vbuf));
+                continue;  // next l = 0, ..., lpi-1
+            }
+
+            if (std::is_same<T, float>::value) {
+                avx512::calcRowArea_32F(reinterpret_cast<float*>(dst),
+                                        reinterpret_cast<const float**>(src),
+                                        inSz, outSz,
+                                        static_cast<float>(ymapper.alpha),
+                                        reinterpret_cast<const avx512::MapperUnit32F&>(ymap),
+                                        xmaxdf[0],
+                                        reinterpret_cast<const int*>(xindex),
+                                        reinterpret_cast<const float*>(xalpha),
+                                        reinterpret_cast<float*>(vbuf));
+                continue;
+            }
+        }
+#endif
+
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            if (std::is_same<T, uchar>::value) {
+                avx::calcRowArea_8U(reinterpret_cast<uchar*>(dst),
+                                    reinterpret_cast<const uchar**>(src),
+                                    inSz, outSz,
+                                    static_cast<Q0_16>(ymapper.alpha),
+                                    reinterpret_cast<const avx::MapperUnit8U&>(ymap),
+                                    xmaxdf[0],
+                                    reinterpret_cast<const short*>(xindex),
+                                    reinterpret_cast<const Q0_16*>(xalpha),
+                                    reinterpret_cast<Q8_8*>(vbuf));
+                continue;  // next l = 0, ..., lpi-1
+            }
+
+            if (std::is_same<T, float>::value) {
+                avx::calcRowArea_32F(reinterpret_cast<float*>(dst),
+                                     reinterpret_cast<const float**>(src),
+                                     inSz, outSz,
+                                     static_cast<float>(ymapper.alpha),
+                                     reinterpret_cast<const avx::MapperUnit32F&>(ymap),
+                                     xmaxdf[0],
+                                     reinterpret_cast<const int*>(xindex),
+                                     reinterpret_cast<const float*>(xalpha),
+                                     reinterpret_cast<float*>(vbuf));
+                continue;
+            }
+        }
+#endif
+
         if (with_cpu_x86_sse42()) {
             if (std::is_same<T, uchar>::value) {
                 calcRowArea_8U(reinterpret_cast<uchar*>(dst),
@@ -1522,6 +1846,7 @@ using namespace kernels;
 cv::gapi::GKernelPackage preprocKernels() {
     return cv::gapi::kernels
         < FChanToPlane
+        , FConvertNormalizePlane
         , FScalePlanes
         , FScalePlane
         , FScalePlane32f
@@ -87,6 +87,13 @@ namespace gapi {
         }
     };
 
+    G_TYPED_KERNEL(ConvertNormalizePlane, <cv::GMat(cv::GMat, float, float)>, "com.intel.ie.convert_normalize_plane") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc &in, float /*mean*/, float /*scale*/) {
+            GAPI_Assert(in.chan == 1);
+            return in.withType(CV_32F, 1);
+        }
+    };
+
     cv::gapi::GKernelPackage preprocKernels();
 
 }  // namespace gapi
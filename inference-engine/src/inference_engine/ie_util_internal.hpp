@@ -100,7 +100,9 @@ cloneNet(const std::vector<InferenceEngine::CNNLayerPtr>& layers,
 /**
  * Clones the whole network. All layers and data objects will be cloned
  *
- * Blobs inside layers are reused
+ * Blobs inside layers are reused: the clone refers the weights of the source, so cloning costs the topology only.
+ * The blobs are copy-on-write by convention: a transformation of the clone (e.g. a precision conversion) puts
+ * a new blob into the layer instead of writing the shared one in place
  * */
 INFERENCE_ENGINE_API_CPP(InferenceEngine::details::CNNNetworkImplPtr)
 cloneNet(const InferenceEngine::ICNNNetwork &network);
@@ -7,6 +7,7 @@
 #include "details/ie_exception.hpp"
 
 #include <algorithm>
+#include <queue>
 #include <vector>
 #include <map>
 
@@ -40,21 +41,60 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
     _time_duration = ts_f - rm_ts_f;
 }
 
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
-    if (box_new.id+box_new.size > box_old.id &&
-        box_old.id+box_old.size > box_new.id) {
-        // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
-        return true;
-    } else {
-        return false;
+namespace {
+
+/**
+ * Segment tree over the time slots. A box is stored in the nodes covering its live time, so the boxes alive
+ * at any slot of a time range are found without scanning the slots one by one. The nodes without boxes
+ * in the subtree are skipped.
+ */
+class LiveBoxes {
+public:
+    explicit LiveBoxes(int duration) : _duration(std::max(duration, 1)),
+            _boxes(4 * _duration), _subtree_boxes(4 * _duration, 0) {}
+
+    void insert(const MemorySolver::Box *box) {
+        insert(1, 0, _duration - 1, box);
     }
-}
+
+    /** Calls f for each box alive at some slot of [start, finish], the box may be passed several times */
+    template <typename F>
+    void forEach(int start, int finish, const F &f) const {
+        forEach(1, 0, _duration - 1, start, finish, f);
+    }
+
+private:
+    int _duration;
+    std::vector<std::vector<const MemorySolver::Box*>> _boxes;
+    std::vector<int> _subtree_boxes;
+
+    void insert(int node, int lo, int hi, const MemorySolver::Box *box) {
+        if (box->finish < lo || hi < box->start) return;
+        _subtree_boxes[node]++;
+        if (box->start <= lo && hi <= box->finish) {
+            _boxes[node].push_back(box);
+            return;
+        }
+        const int mid = (lo + hi) / 2;
+        insert(2 * node, lo, mid, box);
+        insert(2 * node + 1, mid + 1, hi, box);
+    }
+
+    template <typename F>
+    void forEach(int node, int lo, int hi, int start, int finish, const F &f) const {
+        if (_subtree_boxes[node] == 0 || finish < lo || hi < start) return;
+        for (auto *box : _boxes[node]) f(box);
+        if (lo == hi) return;
+        const int mid = (lo + hi) / 2;
+        forEach(2 * node, lo, mid, start, finish, f);
+        forEach(2 * node + 1, mid + 1, hi, start, finish, f);
+    }
+};
+
+}  // namespace
 
 int64_t MemorySolver::solve() {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-    std::vector<std::vector<const Box*>> time_slots(_time_duration);
-    for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
     // Sort be box size. First is biggest
     // Comment this line to check other order of box putting
@@ -63,25 +103,36 @@ int64_t MemorySolver::solve() {
 
     int64_t _min_required = 0;
 
-    for (Box& box : _boxes) {
-        // start from bottom and will lift it up if intersect with other present
-        int64_t id = box.id;
-        box.id = 0;  // id will be used as a temp offset storage
-        bool popped_up;
-        do {
-            popped_up = false;
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                for (auto *box_in_slot : time_slots[i_slot]) {
-                    // intersect with already stored boxes for all covered time slots
-                    // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
-                }
+    LiveBoxes live_boxes(_time_duration);
+    std::vector<const Box*> neighbours;
+    neighbours.reserve(_top_depth);
+    std::vector<size_t> seen_by(_boxes.size(), _boxes.size());
+
+    for (size_t i = 0; i < _boxes.size(); i++) {
+        Box &box = _boxes[i];
+        // the already stored boxes which intersect with the new one in time
+        neighbours.clear();
+        live_boxes.forEach(box.start, box.finish, [&](const Box *neighbour) {
+            const size_t n = neighbour - _boxes.data();
+            if (seen_by[n] != i) {
+                seen_by[n] = i;
+                neighbours.push_back(neighbour);
             }
-        } while (popped_up);
+        });
 
-        // add current box to covered time slot
-        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-            time_slots[i_slot].push_back(&box);
+        // start from bottom and take the lowest gap between the neighbours
+        // id will be used as a temp offset storage
+        std::sort(neighbours.begin(), neighbours.end(), [](const Box *l, const Box *r)
+            { return l->id < r->id; });
+        int64_t offset = 0;
+        for (auto *neighbour : neighbours) {
+            if (neighbour->id >= offset + box.size) break;
+            offset = std::max(offset, neighbour->id + neighbour->size);
+        }
+
+        const int64_t id = box.id;
+        box.id = offset;
+        live_boxes.insert(&box);
 
         // store the max top bound for each box
         _min_required = std::max(_min_required, box.id + box.size);
@@ -91,6 +142,106 @@ int64_t MemorySolver::solve() {
     return _min_required;
 }
 
+int64_t MemorySolver::solveCacheAware(int64_t cacheSize, int64_t alignment, int64_t pageSize) {
+    if (alignment <= 0) THROW_IE_EXCEPTION << "Alignment should be positive";
+
+    std::vector<Box> boxes = _boxes;
+    std::sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r) -> bool
+        { return l.start < r.start || (l.start == r.start && l.size > r.size); });
+
+    auto align_up = [](int64_t offset, int64_t align) { return (offset + align - 1) / align * align; };
+    auto overlap = [](int64_t off1, int64_t size1, int64_t off2, int64_t size2) {
+        return std::max<int64_t>(0, std::min(off1 + size1, off2 + size2) - std::max(off1, off2));
+    };
+
+    // the offsets of the placed boxes, the alive ones are taken from the segment tree as in solve()
+    std::vector<int64_t> offsets(boxes.size());
+    LiveBoxes live_boxes(_time_duration);
+    std::vector<const Box*> alive;
+    std::vector<size_t> seen_by(boxes.size(), boxes.size());
+
+    // the boxes are placed by their start, so a box is released once for all the following ones; the released
+    // boxes are kept by their finish, the equal ones by the reversed placement order
+    auto later_release = [&](size_t l, size_t r) {
+        return boxes[l].finish > boxes[r].finish || (boxes[l].finish == boxes[r].finish && l < r);
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(later_release)> pending(later_release);
+    std::vector<size_t> released;
+
+    _offsets.clear();
+    _hot_reuse = 0;
+    int64_t _min_required = 0;
+
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const Box &box = boxes[i];
+        const int64_t align = (pageSize > 0 && box.size >= pageSize) ? std::max(pageSize, alignment) : alignment;
+
+        while (!pending.empty() && boxes[pending.top()].finish < box.start) {
+            released.push_back(pending.top());
+            pending.pop();
+        }
+
+        alive.clear();
+        live_boxes.forEach(box.start, box.finish, [&](const Box *p) {
+            const size_t n = p - boxes.data();
+            if (seen_by[n] != i) {
+                seen_by[n] = i;
+                alive.push_back(p);
+            }
+        });
+        auto offset_of = [&](const Box *p) { return offsets[p - boxes.data()]; };
+
+        // the data of the most recently released boxes is still in the cache
+        std::vector<const Box*> hot;
+        for (int64_t cached = 0; hot.size() < released.size() && cached < cacheSize; cached += hot.back()->size)
+            hot.push_back(&boxes[released[released.size() - 1 - hot.size()]]);
+
+        auto fits = [&](int64_t offset) {
+            for (auto *p : alive)
+                if (overlap(offset, box.size, offset_of(p), p->size) > 0) return false;
+            return true;
+        };
+
+        // the lowest free place, as a fallback: the lowest gap between the alive boxes sorted by offset
+        std::sort(alive.begin(), alive.end(), [&](const Box *l, const Box *r) { return offset_of(l) < offset_of(r); });
+        int64_t best = 0;
+        for (auto *p : alive) {
+            if (offset_of(p) >= best + box.size) break;
+            if (overlap(best, box.size, offset_of(p), p->size) > 0)
+                best = align_up(offset_of(p) + p->size, align);
+        }
+
+        auto hotness = [&](int64_t offset) {
+            int64_t res = 0;
+            for (auto *h : hot) res += overlap(offset, box.size, offset_of(h), h->size);
+            return res;
+        };
+        int64_t best_hotness = hotness(best);
+        for (auto *h : hot) {
+            const int64_t offset = align_up(offset_of(h), align);
+            if (!fits(offset)) continue;
+            const int64_t h_hotness = hotness(offset);
+            if (h_hotness > best_hotness || (h_hotness == best_hotness && offset < best)) {
+                best = offset;
+                best_hotness = h_hotness;
+            }
+        }
+
+        offsets[i] = best;
+        live_boxes.insert(&box);
+        pending.push(i);
+        _hot_reuse += best_hotness;
+        _min_required = std::max(_min_required, best + box.size);
+        _offsets[box.id] = best;
+    }
+
+    return _min_required;
+}
+
+int64_t MemorySolver::hotReuse() const {
+    return _hot_reuse;
+}
+
 int64_t MemorySolver::maxDepth() {
     if (_depth == -1) calcDepth();
     return _depth;
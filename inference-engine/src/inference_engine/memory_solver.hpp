@@ -71,6 +71,21 @@ public:
      */
     int64_t solve();
 
+    /**
+     * @brief Solve memory location with respect to the cache.
+     *
+     * The boxes are placed in the execution order. A box prefers the place of the boxes released most
+     * recently, their data is supposed to be still in the cache of @p cacheSize, so the producer writes into
+     * the hot lines. Otherwise the lowest free place is used like in solve().
+     * Could be called instead of solve() only, the instance keeps the result of the last call.
+     *
+     * @param cacheSize Size of the cache. In the same units as the box size
+     * @param alignment Alignment of the box offsets, e.g. cache line size
+     * @param pageSize Alignment of the box offsets for the boxes not smaller than the page, 0 means no paging
+     * @return Size of common memory blob required for storing all
+     */
+    int64_t solveCacheAware(int64_t cacheSize, int64_t alignment = 1, int64_t pageSize = 0);
+
     /** Provides calculated offset for specified box id */
     int64_t getOffset(int id) const;
 
@@ -78,12 +93,15 @@ public:
     int64_t maxDepth();
     /** Additional info. Max num of boxes required for any time stamp. */
     int64_t maxTopDepth();
+    /** Additional info. Sum of box sizes placed over the hot data by solveCacheAware(). */
+    int64_t hotReuse() const;
 
 private:
     std::vector<Box> _boxes;
     std::map<int64_t, int64_t> _offsets;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
+    int64_t _hot_reuse = 0;
     int _time_duration = -1;
 
     void calcDepth();
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_allocator.hpp"
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#ifdef _WIN32
+void * MmapAllocator::alloc(size_t size) noexcept {
+    if (size == 0 || _mapping != nullptr)
+        return nullptr;
+
+    HANDLE file = CreateFileA(_filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || static_cast<unsigned long long>(fileSize.QuadPart) < size) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    void * data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+    if (data == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    _file = file;
+    _mapping = mapping;
+    _size = size;
+    return data;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+
+    UnmapViewOfFile(handle);
+    CloseHandle(_mapping);
+    CloseHandle(_file);
+    _mapping = nullptr;
+    _file = nullptr;
+    _size = 0;
+    return true;
+}
+#else
+void * MmapAllocator::alloc(size_t size) noexcept {
+    if (size == 0 || _size != 0)
+        return nullptr;
+
+    int fd = open(_filePath.c_str(), O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat sb = {};
+    if (fstat(fd, &sb) != 0 || static_cast<size_t>(sb.st_size) < size) {
+        close(fd);
+        return nullptr;
+    }
+
+    void * data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // the mapping keeps its own reference to the file
+    close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    // start reading the file in the background while the network is parsed and compiled
+    posix_madvise(data, size, POSIX_MADV_WILLNEED);
+
+    _size = size;
+    return data;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+
+    munmap(handle, _size);
+    _size = 0;
+    return true;
+}
+#endif
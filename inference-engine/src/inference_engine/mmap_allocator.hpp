@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include "ie_allocator.hpp"
+
+/**
+ * @brief Maps a whole file instead of allocating the memory. The mapping is private, so the writes to the memory
+ * are not propagated to the file, and the pages are read on the first access and stay file backed.
+ */
+class MmapAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit MmapAllocator(const std::string &filePath) : _filePath(filePath) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    /**
+     * @brief Maps the first size bytes of the file
+     * @return The address of the mapping or nullptr if the file cannot be mapped
+     */
+    void * alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+private:
+    std::string _filePath;
+    size_t _size = 0;
+#ifdef _WIN32
+    void * _file = nullptr;
+    void * _mapping = nullptr;
+#endif
+};
@@ -7,8 +7,11 @@
 #include "ie_memcpy.h"
 #include "details/ie_cnn_network_tools.h"
 #include "graph_tools.hpp"
+#include "cnn_network_impl.hpp"
 
+#include <cstring>
 #include <string>
+#include <sstream>
 #include <utility>
 #include <algorithm>
 #include <memory>
@@ -1183,6 +1186,84 @@ static bool unrollSeq(CNNLayerPtr cur, ICNNNetwork &net) {
     return true;
 }
 
+/************************************************************/
+/****  Graph cleanup  ***************************************/
+/************************************************************/
+
+/**
+ * Layers never merged or removed: the inputs are distinct by definition, the memory layers keep the state
+ */
+static bool isPinnedLayer(const CNNLayerPtr &layer) {
+    return one_of(layer->type, "Input", "Memory");
+}
+
+/**
+ * The part of the layer description that has to be equal for duplicated layers, the blobs are compared separately
+ */
+static std::string duplicationKey(const CNNLayerPtr &layer) {
+    std::stringstream key;
+    key << layer->type << '\n' << layer->precision.name() << '\n' << layer->affinity << '\n';
+    for (const auto &param : layer->params)
+        key << param.first << '=' << param.second << '\n';
+    for (const auto &in : layer->insData)
+        key << in.lock().get() << ' ';
+    key << '\n';
+    for (const auto &out : layer->outData) {
+        key << out->getPrecision().name() << ':' << out->getLayout() << ':';
+        for (auto dim : out->getTensorDesc().getDims())
+            key << dim << ',';
+        key << ' ';
+    }
+    for (const auto &blob : layer->blobs)
+        key << blob.first << ':' << (blob.second ? blob.second->byteSize() : 0) << ' ';
+    return key.str();
+}
+
+static bool equalBlobs(const CNNLayerPtr &a, const CNNLayerPtr &b) {
+    for (const auto &blob : a->blobs) {
+        const auto &other = b->blobs.at(blob.first);
+        if (blob.second == other)
+            continue;
+        if (!blob.second || !other || blob.second->precision() != other->precision())
+            return false;
+        if (std::memcmp(blob.second->cbuffer().as<const void *>(), other->cbuffer().as<const void *>(),
+                        blob.second->byteSize()) != 0)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Detaches the layer from the data it consumes and removes it with its outputs from the network
+ */
+static void removeLayerWithOutputs(details::CNNNetworkImpl &net, const CNNLayerPtr &layer) {
+    for (const auto &in : layer->insData) {
+        auto data = in.lock();
+        if (data) data->getInputTo().erase(layer->name);
+    }
+    for (const auto &out : layer->outData)
+        net.removeData(out->getName());
+    net.removeLayer(layer->name);
+}
+
+/**
+ * Moves the consumers of the outputs of the duplicate to the same outputs of the master and removes the duplicate
+ */
+static void mergeLayers(details::CNNNetworkImpl &net, const CNNLayerPtr &master, const CNNLayerPtr &duplicate) {
+    for (size_t i = 0; i < duplicate->outData.size(); i++) {
+        DataPtr from = duplicate->outData[i];
+        DataPtr to = master->outData[i];
+        for (const auto &consumer : from->getInputTo()) {
+            for (auto &in : consumer.second->insData) {
+                if (in.lock() == from) in = to;
+            }
+            to->getInputTo()[consumer.first] = consumer.second;
+        }
+        from->getInputTo().clear();
+    }
+    removeLayerWithOutputs(net, duplicate);
+}
+
 /************************************************************/
 /****  Converter API  ***************************************/
 /************************************************************/
@@ -1237,6 +1318,80 @@ bool UnrollRNN_if(ICNNNetwork &net, const std::function<bool(const RNNCellBase&)
     return res;
 }
 
+bool MergeDuplicatedLayers(ICNNNetwork &net) {
+    auto impl = dynamic_cast<details::CNNNetworkImpl *>(&net);
+    if (!impl) return false;
+
+    OutputsDataMap outputs;
+    net.getOutputsInfo(outputs);
+    auto isOutput = [&](const CNNLayerPtr &layer) {
+        for (const auto &out : layer->outData)
+            if (outputs.find(out->getName()) != outputs.end()) return true;
+        return false;
+    };
+
+    // in the topological order the inputs of a layer are already merged, so the duplicated branches collapse
+    // layer by layer starting from their common inputs
+    std::unordered_map<std::string, std::vector<CNNLayerPtr>> candidates;
+    bool merged = false;
+    for (const auto &layer : details::CNNNetSortTopologically(net)) {
+        // the body of the tensor iterator is not described by its parameters
+        if (isPinnedLayer(layer) || layer->type == "TensorIterator" || (layer->insData.empty() && layer->blobs.empty()))
+            continue;
+        auto &same = candidates[duplicationKey(layer)];
+        auto master = std::find_if(same.begin(), same.end(), [&](const CNNLayerPtr &other) {
+            return equalBlobs(other, layer);
+        });
+        // the output of the network keeps its name, so only the layers producing the internal data are merged
+        if (master == same.end() || isOutput(layer)) {
+            same.push_back(layer);
+            continue;
+        }
+        mergeLayers(*impl, *master, layer);
+        merged = true;
+    }
+    return merged;
+}
+
+bool RemoveDeadLayers(ICNNNetwork &net) {
+    auto impl = dynamic_cast<details::CNNNetworkImpl *>(&net);
+    if (!impl) return false;
+
+    OutputsDataMap outputs;
+    net.getOutputsInfo(outputs);
+    std::vector<CNNLayerPtr> alive;
+    for (const auto &output : outputs) {
+        auto creator = output.second->getCreatorLayer().lock();
+        if (creator) alive.push_back(creator);
+    }
+    auto sorted = details::CNNNetSortTopologically(net);
+    for (const auto &layer : sorted) {
+        if (isPinnedLayer(layer)) alive.push_back(layer);
+    }
+
+    std::unordered_set<CNNLayer *> visited;
+    while (!alive.empty()) {
+        CNNLayerPtr layer = alive.back();
+        alive.pop_back();
+        if (!visited.insert(layer.get()).second)
+            continue;
+        for (const auto &in : layer->insData) {
+            auto data = in.lock();
+            auto creator = data ? data->getCreatorLayer().lock() : nullptr;
+            if (creator) alive.push_back(creator);
+        }
+    }
+
+    bool removed = false;
+    for (const auto &layer : sorted) {
+        if (visited.find(layer.get()) != visited.end())
+            continue;
+        removeLayerWithOutputs(*impl, layer);
+        removed = true;
+    }
+    return removed;
+}
+
 }  // namespace NetPass
 }  // namespace InferenceEngine
 
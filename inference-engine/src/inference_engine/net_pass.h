@@ -41,5 +41,26 @@ INFERENCE_ENGINE_API_CPP(bool) UnrollTI(ICNNNetwork &net);
 INFERENCE_ENGINE_API_CPP(bool) UnrollRNN_if(ICNNNetwork &net,
         std::function<bool(const RNNCellBase&)> pred);
 
+/**
+ * Merge the layers of the same type and parameters that take the same inputs (common subexpression elimination)
+ *
+ * The consumers of the duplicated layer are moved to the first of the equal layers, the layers producing
+ * the network outputs are kept. Valid for CNNNetworkImpl only.
+ *
+ * @param net network to modify
+ * @return true if any layer was merged
+ */
+INFERENCE_ENGINE_API_CPP(bool) MergeDuplicatedLayers(ICNNNetwork &net);
+
+/**
+ * Remove the layers which don't contribute to any network output (dead branch elimination)
+ *
+ * The input and memory layers are always kept. Valid for CNNNetworkImpl only.
+ *
+ * @param net network to modify
+ * @return true if any layer was removed
+ */
+INFERENCE_ENGINE_API_CPP(bool) RemoveDeadLayers(ICNNNetwork &net);
+
 }  // namespace NetPass
 }  // namespace InferenceEngine
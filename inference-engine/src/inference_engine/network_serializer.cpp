@@ -3,19 +3,27 @@
 //
 
 #include <fstream>
+#include <sstream>
 #include <map>
 #include <vector>
 #include <string>
+#include <algorithm>
 
 #include "details/ie_cnn_network_tools.h"
 #include "details/caseless.hpp"
 #include "network_serializer.h"
+#include "compact_ir.hpp"
 #include "exec_graph_info.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine;
 using namespace details;
 
+namespace {
+// the buffers of the output files, so the small writes of the layers do not reach the file system one by one
+const size_t fileBufferSize = 4 * 1024 * 1024;
+}  // namespace
+
 template<typename T> std::string arrayToIRProperty(const T& property) {
     std::string sProperty;
     for (size_t i = 0; i < property.size(); i++) {
@@ -39,6 +47,42 @@ void NetworkSerializer::serialize(
     const std::string &xmlPath,
     const std::string &binPath,
     const InferenceEngine::ICNNNetwork& network) {
+    // the buffers are set before the files are opened and outlive the streams
+    std::vector<char> binBuffer(binPath.empty() ? 0 : fileBufferSize);
+    std::vector<char> xmlBuffer(fileBufferSize);
+    std::ofstream ofsBin;
+    if (!binPath.empty()) {
+        ofsBin.rdbuf()->pubsetbuf(binBuffer.data(), binBuffer.size());
+        ofsBin.open(binPath, std::ofstream::out | std::ofstream::binary);
+        if (!ofsBin) {
+            THROW_IE_EXCEPTION << "File '" << binPath << "' is not opened as out file stream";
+        }
+    }
+    std::ofstream ofsXml;
+    ofsXml.rdbuf()->pubsetbuf(xmlBuffer.data(), xmlBuffer.size());
+    ofsXml.open(xmlPath, std::ofstream::out);
+    if (!ofsXml) {
+        THROW_IE_EXCEPTION << "File '" << xmlPath << "' is not opened as out file stream";
+    }
+
+    serialize(ofsXml, binPath.empty() ? nullptr : &ofsBin, network);
+
+    if (!binPath.empty()) {
+        ofsBin.close();
+        if (!ofsBin.good()) {
+            THROW_IE_EXCEPTION << "Error during '" << binPath << "' closing";
+        }
+    }
+    ofsXml.close();
+    if (!ofsXml.good()) {
+        THROW_IE_EXCEPTION << "file '" << xmlPath << "' was not serialized";
+    }
+}
+
+void NetworkSerializer::serialize(
+    std::ostream &xmlStream,
+    std::ostream *binStream,
+    const InferenceEngine::ICNNNetwork& network) {
     const std::vector<CNNLayerPtr> ordered = CNNNetSortTopologically(network);
 
     // A flag for serializing executable graph information (not complete IR)
@@ -55,14 +99,7 @@ void NetworkSerializer::serialize(
         }
     }
 
-    bool dumpWeights = !execGraphInfoSerialization & !binPath.empty();
-    std::ofstream ofsBin;
-    if (dumpWeights) {
-        ofsBin.open(binPath, std::ofstream::out | std::ofstream::binary);
-        if (!ofsBin) {
-            THROW_IE_EXCEPTION << "File '" << binPath << "' is not opened as out file stream";
-        }
-    }
+    bool dumpWeights = !execGraphInfoSerialization && binStream != nullptr;
 
     pugi::xml_document doc;
     pugi::xml_node netXml = doc.append_child("net");
@@ -83,6 +120,8 @@ void NetworkSerializer::serialize(
 
     const std::string dataName = "data";
     size_t dataOffset = 0;
+    // a blob shared by several layers is written once, all of them refer to its offset
+    std::map<std::pair<const char *, size_t>, size_t> writtenBlobs;
     for (size_t i = 0; i < ordered.size(); ++i) {
         const CNNLayerPtr node = ordered[i];
 
@@ -138,26 +177,23 @@ void NetworkSerializer::serialize(
                 const char *dataPtr = dataIt.second->buffer().as<char*>();
 
                 size_t dataSize = dataIt.second->byteSize();
+                auto written = writtenBlobs.find({dataPtr, dataSize});
                 pugi::xml_node data = blobsNode.append_child(dataIt.first.c_str());
-                data.append_attribute("offset").set_value(dataOffset);
+                data.append_attribute("offset").set_value(written != writtenBlobs.end() ? written->second : dataOffset);
                 data.append_attribute("size").set_value(dataSize);
+                if (written != writtenBlobs.end())
+                    continue;
 
+                writtenBlobs[{dataPtr, dataSize}] = dataOffset;
                 dataOffset += dataSize;
-                ofsBin.write(dataPtr, dataSize);
-                if (!ofsBin.good()) {
-                    THROW_IE_EXCEPTION << "Error during '" << binPath << "' writing";
+                binStream->write(dataPtr, dataSize);
+                if (!binStream->good()) {
+                    THROW_IE_EXCEPTION << "Error during weights writing";
                 }
             }
         }
     }
 
-    if (dumpWeights) {
-        ofsBin.close();
-        if (!ofsBin.good()) {
-            THROW_IE_EXCEPTION << "Error during '" << binPath << "' closing";
-        }
-    }
-
     pugi::xml_node edges = netXml.append_child("edges");
 
     for (const auto &ord : ordered) {
@@ -204,8 +240,247 @@ void NetworkSerializer::serialize(
         updateStatisticsInfo(network, netXml);
     }
 
-    if (!doc.save_file(xmlPath.c_str())) {
-        THROW_IE_EXCEPTION << "file '" << xmlPath << "' was not serialized";
+    doc.save(xmlStream);
+    if (!xmlStream.good()) {
+        THROW_IE_EXCEPTION << "Network was not serialized";
+    }
+}
+
+namespace {
+
+class SectionWriter {
+public:
+    template <typename T>
+    void put(const T &value) {
+        _data.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    void putString(const std::string &value) {
+        put(static_cast<uint32_t>(value.size()));
+        _data.append(value);
+    }
+
+    template <typename T, typename V>
+    void putVector(const std::vector<V> &values) {
+        put(static_cast<uint32_t>(values.size()));
+        for (const auto &value : values)
+            put(static_cast<T>(value));
+    }
+
+    void putPrecision(const Precision &precision) {
+        put(static_cast<uint8_t>(static_cast<Precision::ePrecision>(precision)));
+    }
+
+    const std::string &data() const {
+        return _data;
+    }
+
+private:
+    std::string _data;
+};
+
+/**
+ * Collects the blobs for the weights section, a blob shared by several layers is written once
+ */
+class WeightsSection {
+public:
+    uint64_t add(const Blob::Ptr &blob) {
+        const char *data = blob->cbuffer().as<const char *>();
+        auto written = _offsets.find(data);
+        if (written != _offsets.end())
+            return written->second;
+
+        _size = alignUp(_size, CompactIR::blobAlignment);
+        _blobs.emplace_back(_size, blob);
+        _offsets[data] = _size;
+        _size += blob->byteSize();
+        return _blobs.back().first;
+    }
+
+    uint64_t size() const {
+        return _size;
+    }
+
+    /**
+     * @brief Writes the blobs at their offsets, the stream is expected to be at the beginning of the section
+     */
+    void write(std::ostream &stream) const {
+        uint64_t written = 0;
+        for (const auto &blob : _blobs) {
+            pad(stream, blob.first - written);
+            stream.write(blob.second->cbuffer().as<const char *>(), blob.second->byteSize());
+            written = blob.first + blob.second->byteSize();
+        }
+    }
+
+    static uint64_t alignUp(uint64_t value, uint64_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    static void pad(std::ostream &stream, uint64_t count) {
+        const char zeros[CompactIR::blobAlignment] = {};
+        for (; count > sizeof(zeros); count -= sizeof(zeros))
+            stream.write(zeros, sizeof(zeros));
+        stream.write(zeros, static_cast<std::streamsize>(count));
+    }
+
+private:
+    std::vector<std::pair<uint64_t, Blob::Ptr>> _blobs;
+    std::map<const char *, uint64_t> _offsets;
+    uint64_t _size = 0;
+};
+
+}  // namespace
+
+void NetworkSerializer::serializeCompact(const std::string &path, const InferenceEngine::ICNNNetwork& network) {
+    std::ofstream ofs(path, std::ofstream::out | std::ofstream::binary);
+    if (!ofs) {
+        THROW_IE_EXCEPTION << "File '" << path << "' is not opened as out file stream";
+    }
+    serializeCompact(ofs, network);
+    ofs.close();
+    if (!ofs.good()) {
+        THROW_IE_EXCEPTION << "file '" << path << "' was not serialized";
+    }
+}
+
+void NetworkSerializer::serializeCompact(std::ostream &stream, const InferenceEngine::ICNNNetwork& network) {
+    const std::vector<CNNLayerPtr> ordered = CNNNetSortTopologically(network);
+
+    SectionWriter topology;
+    WeightsSection weights;
+    auto putSegment = [&](const Blob::Ptr &blob) {
+        topology.putPrecision(blob->getTensorDesc().getPrecision());
+        topology.put<uint64_t>(weights.add(blob));
+        topology.put<uint64_t>(blob->byteSize());
+    };
+
+    topology.putString(network.getName());
+    topology.putPrecision(network.getPrecision());
+
+    // the data are numbered in the order of their creator layers, so all are known before the layers are written
+    std::vector<DataPtr> data;
+    std::map<Data *, uint32_t> dataIndex;
+    auto indexOf = [&](const DataPtr &d) {
+        auto found = dataIndex.find(d.get());
+        if (found != dataIndex.end())
+            return found->second;
+        auto index = static_cast<uint32_t>(data.size());
+        dataIndex[d.get()] = index;
+        data.push_back(d);
+        return index;
+    };
+    for (const auto &layer : ordered) {
+        for (const auto &in : layer->insData) {
+            auto d = in.lock();
+            if (!d) {
+                THROW_IE_EXCEPTION << "Layer " << layer->name << " has an input which is not connected to any data";
+            }
+            indexOf(d);
+        }
+        for (const auto &out : layer->outData)
+            indexOf(out);
+    }
+    const size_t dataCount = data.size();
+    topology.put(static_cast<uint32_t>(dataCount));
+    for (const auto &d : data) {
+        const TensorDesc &desc = d->getTensorDesc();
+        topology.putString(d->getName());
+        topology.putPrecision(d->getPrecision());
+        topology.put(static_cast<uint8_t>(desc.getLayout()));
+        topology.putVector<uint64_t>(desc.getDims());
+    }
+
+    topology.put(static_cast<uint32_t>(ordered.size()));
+    for (const auto &layer : ordered) {
+        updateStdLayerParams(layer);
+
+        topology.putString(layer->name);
+        topology.putString(layer->type);
+        topology.putPrecision(layer->precision);
+        topology.put(static_cast<uint32_t>(layer->params.size()));
+        for (const auto &param : layer->params) {
+            topology.putString(param.first);
+            topology.putString(param.second);
+        }
+
+        std::vector<uint32_t> ins, outs;
+        for (const auto &in : layer->insData)
+            ins.push_back(indexOf(in.lock()));
+        for (const auto &out : layer->outData)
+            outs.push_back(indexOf(out));
+        topology.putVector<uint32_t>(ins);
+        topology.putVector<uint32_t>(outs);
+
+        topology.put(static_cast<uint32_t>(layer->blobs.size()));
+        for (const auto &blob : layer->blobs) {
+            topology.putString(blob.first);
+            putSegment(blob.second);
+        }
+    }
+
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    topology.put(static_cast<uint32_t>(inputs.size()));
+    for (const auto &input : inputs) {
+        const PreProcessInfo &pp = input.second->getPreProcess();
+        topology.put(indexOf(input.second->getInputData()));
+        topology.putPrecision(input.second->getInputPrecision());
+        topology.put(static_cast<uint8_t>(pp.getResizeAlgorithm()));
+        topology.put(static_cast<uint8_t>(pp.getMeanVariant()));
+        topology.put(static_cast<uint32_t>(pp.getNumberOfChannels()));
+        for (size_t c = 0; c < pp.getNumberOfChannels(); c++) {
+            const PreProcessChannel::Ptr &channel = pp[c];
+            topology.put(channel->stdScale);
+            topology.put(channel->meanValue);
+            if (channel->meanData) {
+                putSegment(channel->meanData);
+            } else {
+                topology.putPrecision(Precision::UNSPECIFIED);
+                topology.put<uint64_t>(0);
+                topology.put<uint64_t>(0);
+            }
+        }
+    }
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    topology.put(static_cast<uint32_t>(outputs.size()));
+    for (const auto &output : outputs) {
+        topology.put(indexOf(output.second));
+        topology.putPrecision(output.second->getPrecision());
+    }
+
+    NetworkStatsMap statsMap;
+    ICNNNetworkStats *netNodesStats = nullptr;
+    if (network.getStats(&netNodesStats, nullptr) == OK && netNodesStats) {
+        statsMap = netNodesStats->getNodesStats();
+    }
+    topology.put(static_cast<uint32_t>(statsMap.size()));
+    for (const auto &stats : statsMap) {
+        topology.putString(stats.first);
+        topology.putVector<float>(stats.second->_minOutputs);
+        topology.putVector<float>(stats.second->_maxOutputs);
+    }
+
+    if (data.size() != dataCount) {
+        THROW_IE_EXCEPTION << "The inputs or the outputs of the network refer to the data which are not in the network";
+    }
+
+    CompactIRHeader header = {};
+    std::memcpy(header.magic, CompactIR::magic, sizeof(header.magic));
+    header.version = CompactIR::version;
+    header.topologyOffset = sizeof(header);
+    header.topologySize = topology.data().size();
+    header.weightsOffset = WeightsSection::alignUp(header.topologyOffset + header.topologySize, CompactIR::sectionAlignment);
+    header.weightsSize = weights.size();
+
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    stream.write(topology.data().data(), topology.data().size());
+    WeightsSection::pad(stream, header.weightsOffset - header.topologyOffset - header.topologySize);
+    weights.write(stream);
+    if (!stream.good()) {
+        THROW_IE_EXCEPTION << "Network was not serialized";
     }
 }
 
@@ -5,7 +5,11 @@
 #pragma once
 
 #include <string>
+#include <ostream>
 
+#include "ie_api.h"
+#include "ie_icnn_network.hpp"
+#include "ie_layers.h"
 #include "xml_parse_utils.h"
 
 namespace InferenceEngine {
@@ -14,9 +18,18 @@ namespace details {
 /**
 * Class for serialization of model been presented as ICNNNetwork to the disk
 */
-class NetworkSerializer {
+class INFERENCE_ENGINE_API_CLASS(NetworkSerializer) {
 public:
     static void serialize(const std::string &xmlPath, const std::string &binPath, const InferenceEngine::ICNNNetwork& network);
+    /**
+     * @brief Serializes the network to the streams, the weights are not dumped if binStream is nullptr
+     */
+    static void serialize(std::ostream &xmlStream, std::ostream *binStream, const InferenceEngine::ICNNNetwork& network);
+    /**
+     * @brief Serializes the network to a single compact IR file, see CompactIR for the format
+     */
+    static void serializeCompact(const std::string &path, const InferenceEngine::ICNNNetwork& network);
+    static void serializeCompact(std::ostream &stream, const InferenceEngine::ICNNNetwork& network);
 
 private:
     static void updateStdLayerParams(const InferenceEngine::CNNLayer::Ptr &layer);
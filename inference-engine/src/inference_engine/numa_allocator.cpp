@@ -0,0 +1,98 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_allocator.hpp"
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+#ifdef _WIN32
+int NumaAllocator::currentNode() noexcept {
+    UCHAR node = 0;
+    if (!GetNumaProcessorNode(static_cast<UCHAR>(GetCurrentProcessorNumber()), &node) || node == 0xFF)
+        return 0;
+    return node;
+}
+
+static void * mapOnNode(size_t length, int node) {
+    return VirtualAllocExNuma(GetCurrentProcess(), nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE,
+                              static_cast<DWORD>(node));
+}
+
+static void unmapFromNode(void * ptr, size_t) {
+    VirtualFree(ptr, 0, MEM_RELEASE);
+}
+#else
+int NumaAllocator::currentNode() noexcept {
+#ifdef SYS_getcpu
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+        return static_cast<int>(node);
+#endif
+    return 0;
+}
+
+static void * mapOnNode(size_t length, int node) {
+    void * ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+#ifdef SYS_mbind
+    // MPOL_BIND of linux/mempolicy.h, libnuma is not needed for the one call
+    const int bindPolicy = 2;
+    const size_t maskBits = 8 * sizeof(unsigned long);
+    unsigned long mask[16] = {};
+    if (node >= 0 && static_cast<size_t>(node) < maskBits * 16) {
+        mask[node / maskBits] = 1UL << (node % maskBits);
+        // the pages are not touched yet, a failure leaves them to the default policy
+        syscall(SYS_mbind, ptr, length, bindPolicy, mask, maskBits * 16 + 1, 0);
+    }
+#endif
+    return ptr;
+}
+
+static void unmapFromNode(void * ptr, size_t length) {
+    munmap(ptr, length);
+}
+#endif
+
+void * NumaAllocator::alloc(size_t size) noexcept {
+    if (size == 0)
+        return nullptr;
+    const int node = _node >= 0 ? _node : currentNode();
+    void * ptr = mapOnNode(size, node);
+    if (ptr == nullptr)
+        return nullptr;
+    try {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _mappings.emplace(ptr, size);
+    } catch (...) {
+        unmapFromNode(ptr, size);
+        return nullptr;
+    }
+    return ptr;
+}
+
+bool NumaAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+    size_t length = 0;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _mappings.find(handle);
+        if (it == _mappings.end())
+            return false;
+        length = it->second;
+        _mappings.erase(it);
+    }
+    unmapFromNode(handle, length);
+    return true;
+}
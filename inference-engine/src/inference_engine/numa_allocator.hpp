@@ -0,0 +1,44 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include "ie_api.h"
+#include "ie_allocator.hpp"
+
+/**
+ * @brief Binds the pages of the buffers to a NUMA node, so a blob filled by one thread stays local to the streams
+ * of the node that read it. The node of the allocating thread is taken when no node is given. The buffers are
+ * allocated by the regular pages when the system has no NUMA support.
+ */
+class INFERENCE_ENGINE_API_CLASS(NumaAllocator) : public InferenceEngine::IAllocator {
+public:
+    explicit NumaAllocator(int node = -1) : _node(node) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    void * alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+    /**
+     * @return The node of the CPU the calling thread runs on, 0 when it is not known
+     */
+    static int currentNode() noexcept;
+
+private:
+    int _node;
+    std::mutex _mutex;
+    std::unordered_map<void*, size_t> _mappings;
+};
@@ -0,0 +1,56 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include "ie_allocator.hpp"
+
+#ifdef _WIN32
+# include <malloc.h>
+#endif
+
+/**
+ * @brief Allocates the memory at the page boundary. Such buffers can be shared with the devices that work on
+ * the host memory, e.g. an integrated GPU, without copying the data.
+ */
+class PageAlignedAllocator : public InferenceEngine::IAllocator {
+public:
+    static constexpr size_t pageSize = 4096;
+
+    static bool isAligned(const void * ptr) noexcept {
+        return reinterpret_cast<uintptr_t>(ptr) % pageSize == 0;
+    }
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    void * alloc(size_t size) noexcept override {
+#ifdef _WIN32
+        return _aligned_malloc(size, pageSize);
+#else
+        void * handle = nullptr;
+        if (posix_memalign(&handle, pageSize, size) != 0)
+            return nullptr;
+        return handle;
+#endif
+    }
+
+    bool free(void* handle) noexcept override {
+#ifdef _WIN32
+        _aligned_free(handle);
+#else
+        std::free(handle);
+#endif
+        return true;
+    }
+};
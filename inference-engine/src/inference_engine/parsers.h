@@ -13,11 +13,21 @@ class xml_node;
 
 namespace InferenceEngine {
 namespace details {
+class XmlStreamReader;
+
 struct IFormatParser {
     virtual ~IFormatParser() {}
 
     virtual CNNNetworkImplPtr Parse(pugi::xml_node &root) = 0;
 
+    /**
+     * @brief Parses the network element by element, so the DOM of the whole IR is never kept in memory
+     * @return nullptr if the parser does not support it, then the IR is parsed as a whole by Parse()
+     */
+    virtual CNNNetworkImplPtr ParseStream(XmlStreamReader &/*stream*/) {
+        return nullptr;
+    }
+
     virtual void SetWeights(const TBlob<uint8_t>::Ptr &weights) = 0;
 };
 }  // namespace details
@@ -0,0 +1,85 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pool_allocator.hpp"
+#include "page_aligned_allocator.hpp"
+
+constexpr size_t MemoryPool::defaultCacheLimit;
+
+MemoryPool::MemoryPool(size_t cacheLimit) : _cacheLimit(cacheLimit) {}
+
+MemoryPool::~MemoryPool() {
+    PageAlignedAllocator system;
+    for (auto &sizeClass : _free) {
+        for (void * ptr : sizeClass.second)
+            system.free(ptr);
+    }
+}
+
+size_t MemoryPool::sizeClass(size_t size) noexcept {
+    if (size <= PageAlignedAllocator::pageSize)
+        return PageAlignedAllocator::pageSize;
+    size_t power = PageAlignedAllocator::pageSize;
+    while (power <= size / 2)
+        power *= 2;
+    // size is in [power, 2 * power), the class is rounded up to a quarter of power
+    const size_t step = power / 4;
+    return (size + step - 1) / step * step;
+}
+
+void * MemoryPool::take(size_t size) noexcept {
+    if (size == 0)
+        return nullptr;
+    const size_t bytes = sizeClass(size);
+    try {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _free.find(bytes);
+        void * ptr = nullptr;
+        if (it != _free.end() && !it->second.empty()) {
+            ptr = it->second.back();
+            it->second.pop_back();
+            _cached -= bytes;
+        } else {
+            ptr = PageAlignedAllocator().alloc(bytes);
+            if (ptr == nullptr)
+                return nullptr;
+        }
+        _used.emplace(ptr, bytes);
+        return ptr;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+bool MemoryPool::give(void * ptr) noexcept {
+    if (ptr == nullptr)
+        return true;
+    try {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _used.find(ptr);
+        if (it == _used.end())
+            return false;
+        const size_t bytes = it->second;
+        _used.erase(it);
+        if (_cached + bytes > _cacheLimit) {
+            PageAlignedAllocator().free(ptr);
+        } else {
+            _free[bytes].push_back(ptr);
+            _cached += bytes;
+        }
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+size_t MemoryPool::cachedBytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _cached;
+}
+
+std::shared_ptr<MemoryPool> MemoryPool::global() {
+    static std::shared_ptr<MemoryPool> pool = std::make_shared<MemoryPool>();
+    return pool;
+}
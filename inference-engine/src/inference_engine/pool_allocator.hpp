@@ -0,0 +1,80 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "ie_api.h"
+#include "ie_allocator.hpp"
+
+/**
+ * @brief Keeps the released buffers in the size classes and gives them to the next allocations of the same class,
+ * so the re-created blobs do not take the fresh pages and their faults. The buffers are page aligned.
+ */
+class INFERENCE_ENGINE_API_CLASS(MemoryPool) {
+public:
+    /**
+     * @param cacheLimit The maximum number of bytes kept in the released buffers, the buffers above it are freed
+     */
+    explicit MemoryPool(size_t cacheLimit = defaultCacheLimit);
+    ~MemoryPool();
+
+    void * take(size_t size) noexcept;
+    bool give(void * ptr) noexcept;
+
+    size_t cachedBytes() const;
+
+    /**
+     * @brief The classes are the multiples of the quarters of the powers of two, so at most 25% is wasted
+     */
+    static size_t sizeClass(size_t size) noexcept;
+
+    /**
+     * @brief The pool shared by the allocators of all the blobs of the process
+     */
+    static std::shared_ptr<MemoryPool> global();
+
+    static constexpr size_t defaultCacheLimit = 256 * 1024 * 1024;
+
+private:
+    mutable std::mutex _mutex;
+    size_t _cacheLimit;
+    size_t _cached = 0;
+    std::unordered_map<void*, size_t> _used;
+    std::map<size_t, std::vector<void*>> _free;
+};
+
+/**
+ * @brief Allocates the blob memory from a pool, the global one by default
+ */
+class PoolAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit PoolAllocator(std::shared_ptr<MemoryPool> pool = MemoryPool::global()) : _pool(std::move(pool)) {}
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    void * alloc(size_t size) noexcept override {
+        return _pool->take(size);
+    }
+
+    bool free(void* handle) noexcept override {
+        return _pool->give(handle);
+    }
+
+private:
+    std::shared_ptr<MemoryPool> _pool;
+};
@@ -4,23 +4,89 @@
 
 #include "precision_utils.h"
 #include <stdint.h>
+#include <algorithm>
 #include <details/ie_exception.hpp>
 #include <ie_blob.h>
 #include "inference_engine.hpp"
+#include "ie_parallel.hpp"
+
+#if defined(HAVE_SSE)
+  #include "cpu_detector.hpp"
+  #ifdef HAVE_AVX2
+    #include "precision_utils_avx2.hpp"
+  #endif
+  #ifdef HAVE_AVX512
+    #include "precision_utils_avx512.hpp"
+  #endif
+#endif
 
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
+// the arrays of the large blobs and weights are converted by the parallel blocks of this many elements
+static const size_t CONVERSION_BLOCK = 64 * 1024;
+
+template <typename F>
+static void convertBlocks(size_t nelem, const F &convert) {
+    if (nelem < 2 * CONVERSION_BLOCK) {
+        convert(0, nelem);
+        return;
+    }
+    const size_t blocks = (nelem + CONVERSION_BLOCK - 1) / CONVERSION_BLOCK;
+    parallel_for(blocks, [&](size_t b) {
+        const size_t begin = b * CONVERSION_BLOCK;
+        convert(begin, std::min(CONVERSION_BLOCK, nelem - begin));
+    });
+}
+
+static void f16tof32Block(float *dst, const short *src, size_t nelem, float scale, float bias) {
+#if defined(HAVE_SSE)
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        avx512::f16tof32Arrays(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2() && with_cpu_x86_f16c()) {
+        avx::f16tof32Arrays(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif
+#endif
+    for (size_t i = 0; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f16tof32(src[i]) * scale + bias;
+    }
+}
+
+static void f32tof16Block(short *dst, const float *src, size_t nelem, float scale, float bias) {
+#if defined(HAVE_SSE)
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        avx512::f32tof16Arrays(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::f32tof16Arrays(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif
+#endif
+    for (size_t i = 0; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    }
+}
+
 INFERENCE_ENGINE_API_CPP(void) f16tof32Arrays(float *dst,
                                               const short *src,
                                               size_t nelem,
                                               float scale,
                                               float bias) {
-    const ie_fp16 *_src = reinterpret_cast<const ie_fp16 *>(src);
-
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
-    }
+    convertBlocks(nelem, [&](size_t begin, size_t count) {
+        f16tof32Block(dst + begin, src + begin, count, scale, bias);
+    });
 }
 
 INFERENCE_ENGINE_API_CPP(void) f32tof16Arrays(short *dst,
@@ -28,9 +94,9 @@ INFERENCE_ENGINE_API_CPP(void) f32tof16Arrays(short *dst,
                                               size_t nelem,
                                               float scale,
                                               float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
-    }
+    convertBlocks(nelem, [&](size_t begin, size_t count) {
+        f32tof16Block(dst + begin, src + begin, count, scale, bias);
+    });
 }
 
 // Function to convert F32 into F16
@@ -50,6 +50,11 @@
 #include "ie_rnn_cell_shape_infer.hpp"
 #include "ie_quantize_shape_infer.hpp"
 #include "ie_bin_conv_shape_infer.hpp"
+#include "ie_detectron_detection_output_shape_infer.hpp"
+#include "ie_detectron_generate_proposals_shape_infer.hpp"
+#include "ie_detectron_prior_grid_generator_shape_infer.hpp"
+#include "ie_detectron_roifeatureextractor_shape_infer.hpp"
+#include "ie_detectron_topk_rois_shape_infer.hpp"
 #include <algorithm>
 #include <memory>
 #include <string>
@@ -178,6 +183,12 @@ REG_SHAPE_INFER_FOR_TYPE(ExpandShapeProp, Expand);
 REG_SHAPE_INFER_FOR_TYPE(ShapeShapeProp, Shape);
 REG_SHAPE_INFER_FOR_TYPE(QuantizeShapeProp, Quantize);
 REG_SHAPE_INFER_FOR_TYPE(BinConvShapeProp, BinaryConvolution);
+REG_SHAPE_INFER_FOR_TYPE(ExperimentalDetectronDetectionOutputShapeProp, ExperimentalDetectronDetectionOutput);
+REG_SHAPE_INFER_FOR_TYPE(ExperimentalDetectronGenerateProposalsSingleImageShapeProp,
+                         ExperimentalDetectronGenerateProposalsSingleImage);
+REG_SHAPE_INFER_FOR_TYPE(ExperimentalDetectronPriorGridGeneratorShapeProp, ExperimentalDetectronPriorGridGenerator);
+REG_SHAPE_INFER_FOR_TYPE(ExperimentalDetectronROIFeatureExtractorShapeProp, ExperimentalDetectronROIFeatureExtractor);
+REG_SHAPE_INFER_FOR_TYPE(ExperimentalDetectronTopKROIsShapeProp, ExperimentalDetectronTopKROIs);
 
 }  // namespace ShapeInfer
 }  // namespace InferenceEngine
@@ -0,0 +1,43 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_built_in_impl.hpp"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace ShapeInfer {
+
+/**
+ *@brief Implementation of Shape inference for ExperimentalDetectronDetectionOutput layer
+ */
+class ExperimentalDetectronDetectionOutputShapeProp : public BuiltInShapeInferImpl {
+public:
+    explicit ExperimentalDetectronDetectionOutputShapeProp(const std::string& type) : BuiltInShapeInferImpl(type) {}
+
+    void inferShapesImpl(const std::vector<Blob::CPtr>& inBlobs,
+                         const std::map<std::string, std::string>& params,
+                         const std::map<std::string, Blob::Ptr>& blobs,
+                         std::vector<SizeVector>& outShapes) override {
+        LayerParams lp{};
+        CNNLayer cnnLayer(lp);
+        cnnLayer.params = params;
+        cnnLayer.type = _type;
+        validate(&cnnLayer, inBlobs, params, blobs);
+
+        const size_t rois_num = static_cast<size_t>(cnnLayer.GetParamAsUInt("max_detections_per_image"));
+        // boxes, classes, scores and batch indices
+        outShapes.push_back({rois_num, 4});
+        outShapes.push_back({rois_num});
+        outShapes.push_back({rois_num});
+        outShapes.push_back({rois_num});
+    }
+};
+
+}  // namespace ShapeInfer
+}  // namespace InferenceEngine
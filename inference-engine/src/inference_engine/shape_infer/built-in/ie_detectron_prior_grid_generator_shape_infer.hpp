@@ -0,0 +1,50 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_built_in_impl.hpp"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace ShapeInfer {
+
+/**
+ *@brief Implementation of Shape inference for ExperimentalDetectronPriorGridGenerator layer
+ */
+class ExperimentalDetectronPriorGridGeneratorShapeProp : public BuiltInShapeInferImpl {
+public:
+    explicit ExperimentalDetectronPriorGridGeneratorShapeProp(const std::string& type) : BuiltInShapeInferImpl(type) {}
+
+    void inferShapesImpl(const std::vector<Blob::CPtr>& inBlobs,
+                         const std::map<std::string, std::string>& params,
+                         const std::map<std::string, Blob::Ptr>& blobs,
+                         std::vector<SizeVector>& outShapes) override {
+        LayerParams lp{};
+        CNNLayer cnnLayer(lp);
+        cnnLayer.params = params;
+        cnnLayer.type = _type;
+        validate(&cnnLayer, inBlobs, params, blobs);
+
+        if (inShapes.size() < 2 || inShapes[1].size() != 4)
+            THROW_IE_EXCEPTION << "The feature map of " << _type << " must be 4D";
+        const size_t priors_num = inShapes[0][0];
+        // the grid is given by the layer or follows the feature map
+        size_t grid_h = cnnLayer.GetParamAsUInt("h", 0);
+        size_t grid_w = cnnLayer.GetParamAsUInt("w", 0);
+        if (grid_h == 0) grid_h = inShapes[1][2];
+        if (grid_w == 0) grid_w = inShapes[1][3];
+
+        if (cnnLayer.GetParamAsBool("flatten", true))
+            outShapes.push_back({grid_h * grid_w * priors_num, 4});
+        else
+            outShapes.push_back({grid_h, grid_w, priors_num, 4});
+    }
+};
+
+}  // namespace ShapeInfer
+}  // namespace InferenceEngine
@@ -0,0 +1,45 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_built_in_impl.hpp"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace ShapeInfer {
+
+/**
+ *@brief Implementation of Shape inference for ExperimentalDetectronROIFeatureExtractor layer
+ */
+class ExperimentalDetectronROIFeatureExtractorShapeProp : public BuiltInShapeInferImpl {
+public:
+    explicit ExperimentalDetectronROIFeatureExtractorShapeProp(const std::string& type) : BuiltInShapeInferImpl(type) {}
+
+    void inferShapesImpl(const std::vector<Blob::CPtr>& inBlobs,
+                         const std::map<std::string, std::string>& params,
+                         const std::map<std::string, Blob::Ptr>& blobs,
+                         std::vector<SizeVector>& outShapes) override {
+        LayerParams lp{};
+        CNNLayer cnnLayer(lp);
+        cnnLayer.params = params;
+        cnnLayer.type = _type;
+        validate(&cnnLayer, inBlobs, params, blobs);
+
+        if (inShapes.size() < 2 || inShapes[1].size() != 4)
+            THROW_IE_EXCEPTION << "The feature maps of " << _type << " must be 4D";
+        const size_t rois_num = inShapes[0][0];
+        const size_t channels_num = inShapes[1][1];
+        const size_t output_size = static_cast<size_t>(cnnLayer.GetParamAsUInt("output_size"));
+        // the features and the rois
+        outShapes.push_back({rois_num, channels_num, output_size, output_size});
+        outShapes.push_back({rois_num, 4});
+    }
+};
+
+}  // namespace ShapeInfer
+}  // namespace InferenceEngine
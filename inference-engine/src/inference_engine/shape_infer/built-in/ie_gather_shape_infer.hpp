@@ -34,16 +34,21 @@ public:
         if (axis < 0)
             axis += inShapes[0].size();
 
+        //  The reduction of the embedding bag collapses the last dimension of the indices
+        SizeVector idxShape = inShapes[1];
+        if (!gatherLayer.GetParamAsString("reduction", "").empty())
+            idxShape.pop_back();
+
         outShapes.resize(1);
-        outShapes[0].resize(inShapes[0].size() + inShapes[1].size() - 1);
+        outShapes[0].resize(inShapes[0].size() + idxShape.size() - 1);
         for (int i = 0; i < axis; i++)
             outShapes[0][i] = inShapes[0][i];
 
-        for (size_t i = 0; i < inShapes[1].size(); i++)
-            outShapes[0][i + axis] = inShapes[1][i];
+        for (size_t i = 0; i < idxShape.size(); i++)
+            outShapes[0][i + axis] = idxShape[i];
 
         for (size_t i = axis + 1; i < inShapes[0].size(); i++)
-            outShapes[0][i + inShapes[1].size() - 1] = inShapes[0][i];
+            outShapes[0][i + idxShape.size() - 1] = inShapes[0][i];
     }
 };
 
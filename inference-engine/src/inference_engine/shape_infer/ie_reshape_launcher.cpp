@@ -91,6 +91,9 @@ void ReshapeLauncher::reshape(const std::set<ReshapeLauncher::Ptr>& launchers) {
         sts = _reshapeImpl->inferShapes(_iController->getShapes(true), _layer->params, _layer->blobs, outShapes,
                                         &resp);
     }
+    // the trailing outputs of some layers are optional, the network has only the used ones
+    if (sts == OK && outShapes.size() > _layer->outData.size())
+        outShapes.resize(_layer->outData.size());
     _oController->setShapes(outShapes);
     if (sts != OK)
         THROW_IE_EXCEPTION <<
@@ -53,6 +53,7 @@ Reshaper::Reshaper(std::vector<DataPtr> insDatas, const LauncherCreator::Ptr& la
     for (auto const& currentLayer : _allSortedLayers) {
         auto createdLauncher = launcherCreator->createNotInputLauncher(currentLayer.get(), _extensions);
         _launchers.insert(createdLauncher);
+        _launchersByName[currentLayer->name] = createdLauncher;
     }
 }
 
@@ -81,6 +82,7 @@ Reshaper::Reshaper(ICNNNetwork& network, const LauncherCreator::Ptr& launcherCre
             createdLauncher = launcherCreator->createInputLauncher(currentLayer.get(), _extensions);
         }
         _launchers.insert(createdLauncher);
+        _launchersByName[currentLayer->name] = createdLauncher;
     }
 }
 
@@ -129,37 +131,93 @@ void Reshaper::AddExtension(const IShapeInferExtensionPtr& extension) {
         }
         for (const auto& launcher : launchersToInsert) {
             _launchers.insert(launcher);
+            _launchersByName[launcher->getLayer()->name] = launcher;
         }
     }
     _extensions.push_back(extension);
+    // the new launchers don't keep the shapes of the previous run
+    _appliedInputShapes.clear();
 }
 
 ReshapeLauncher::Ptr Reshaper::getLauncherByLayerName(const std::string& layerName) const {
-    auto foundLauncher = std::find_if(_launchers.begin(), _launchers.end(),
-                                      [&layerName](const ReshapeLauncher::Ptr& launcher) {
-                                          return launcher->getLayerName() == layerName;
-                                      });
-    if (foundLauncher == _launchers.end())
+    auto foundLauncher = _launchersByName.find(layerName);
+    if (foundLauncher == _launchersByName.end())
         THROW_IE_EXCEPTION << "Failed to reshape layer ('" << layerName << "'): can't find the corresponding launcher";
-    return *foundLauncher;
+    return foundLauncher->second;
+}
+
+std::set<std::string> Reshaper::getDirtyLayers(const std::map<std::string, SizeVector>& inputShapes) const {
+    std::set<std::string> dirtyLayers;
+    if (_appliedInputShapes.empty()) {
+        for (auto const& layer : _allSortedLayers) {
+            dirtyLayers.insert(layer->name);
+        }
+        return dirtyLayers;
+    }
+
+    for (auto const& input : _inputLayers) {
+        for (auto const& outData : input->outData) {
+            const std::string& dataName = outData->name;
+            auto applied = _appliedInputShapes.find(dataName);
+            auto requested = inputShapes.find(dataName);
+            // the shape is changed by the request or the data is changed out of the reshaper, e.g. by setBatchSize
+            bool changed = applied == _appliedInputShapes.end() ||
+                           applied->second != outData->getTensorDesc().getDims() ||
+                           (requested != inputShapes.end() ? requested->second != applied->second
+                                                           : _requestedInputs.count(dataName) != 0);
+            if (changed) {
+                dirtyLayers.insert(input->name);
+                break;
+            }
+        }
+    }
+    if (dirtyLayers.empty())
+        return dirtyLayers;
+
+    // the layers are sorted, so the producers of the layer inputs are already checked
+    for (auto const& layer : _allSortedLayers) {
+        if (dirtyLayers.count(layer->name))
+            continue;
+        for (auto const& insData : layer->insData) {
+            auto data = insData.lock();
+            auto creator = data ? data->creatorLayer.lock() : nullptr;
+            if (creator && dirtyLayers.count(creator->name)) {
+                dirtyLayers.insert(layer->name);
+                break;
+            }
+        }
+    }
+    return dirtyLayers;
 }
 
 StatusCode Reshaper::run(const std::map<std::string, SizeVector>& inputShapes, ResponseDesc* resp) {
     if (network) {
         return networkShapeInfer(inputShapes, resp);
     }
-    // Reset all shapes from previous run
-    for (const auto& launcher : _launchers) {
-        launcher->reset();
+    bool incremental = !_appliedInputShapes.empty();
+    auto dirtyLayers = getDirtyLayers(inputShapes);
+    if (incremental && dirtyLayers.empty())
+        return OK;
+    // the launchers are not consistent with the network until the changes are applied
+    _appliedInputShapes.clear();
+    _requestedInputs.clear();
+
+    // Reset all shapes from previous run, the clean layers keep the shapes they propagate to the dirty ones
+    if (!incremental) {
+        for (const auto& launcher : _launchers) {
+            launcher->reset();
+        }
     }
 
     // Set new input shapes
     for (auto const& input : _inputLayers) {
         std::string layerName = input->name;
+        if (!dirtyLayers.count(layerName))
+            continue;
+        auto foundLauncher = getLauncherByLayerName(layerName);
         for (auto const& outData : input->outData) {
             std::string dataName = outData->name;
             auto foundShapeIt = inputShapes.find(dataName);
-            auto foundLauncher = getLauncherByLayerName(layerName);
             if (foundShapeIt != inputShapes.end()) {
                 foundLauncher->setShapeByName(foundShapeIt->second, dataName);
             } else {
@@ -170,6 +228,8 @@ StatusCode Reshaper::run(const std::map<std::string, SizeVector>& inputShapes, R
 
     // do reshape
     for (auto& layer : _allSortedLayers) {
+        if (!dirtyLayers.count(layer->name))
+            continue;
         auto foundLauncher = getLauncherByLayerName(layer->name);
         foundLauncher->reshape(_launchers);
         foundLauncher->constInfer(_launchers);
@@ -177,13 +237,26 @@ StatusCode Reshaper::run(const std::map<std::string, SizeVector>& inputShapes, R
 
     // apply changes
     for (auto& layer : _allSortedLayers) {
+        if (!dirtyLayers.count(layer->name))
+            continue;
         auto foundLauncher = getLauncherByLayerName(layer->name);
         foundLauncher->applyChanges(layer.get());
     }
+
+    for (auto const& input : _inputLayers) {
+        for (auto const& outData : input->outData) {
+            _appliedInputShapes[outData->name] = outData->getTensorDesc().getDims();
+            if (inputShapes.count(outData->name))
+                _requestedInputs.insert(outData->name);
+        }
+    }
     return OK;
 }
 
 StatusCode Reshaper::runNoApply(const std::map<std::string, SizeVector>& inputShapes, ResponseDesc* resp) {
+    _appliedInputShapes.clear();
+    _requestedInputs.clear();
+
     // Reset all shapes from previous run
     for (const auto& launcher : _launchers) {
         launcher->reset();
@@ -77,7 +77,9 @@ public:
 
     /**
      * @brief Launches shape inference for the given ICNNNetworkAdds and input shapes.
-     * Throws if shape infer failed without corruption of original shapes
+     * Throws if shape infer failed without corruption of original shapes.
+     * The shapes are inferred again only for the layers that depend on the inputs changed since the previous run,
+     * the run is skipped if no input is changed.
      * @param inputShapes - Map of input names (data) to their input shapes.
      */
     StatusCode run(const std::map<std::string, SizeVector>& inputShapes, ResponseDesc* resp = nullptr);
@@ -103,12 +105,23 @@ public:
 private:
     ReshapeLauncher::Ptr getLauncherByLayerName(const std::string& layerName) const;
 
+    /**
+     * @brief Collects the layers which shapes have to be inferred again for the given input shapes: all the layers
+     * if the previous run is not applied, otherwise the layers which depend on the changed inputs only.
+     */
+    std::set<std::string> getDirtyLayers(const std::map<std::string, SizeVector>& inputShapes) const;
+
     StatusCode networkShapeInfer(const std::map<std::string, SizeVector>& inputShapes, ResponseDesc* resp);
 
     static InferenceEngine::details::caseless_set<std::string> getTypeNamesFromExtension(const IShapeInferExtensionPtr& extension);
 
     std::vector<IShapeInferExtensionPtr> _extensions;
     std::set<ReshapeLauncher::Ptr> _launchers;
+    std::map<std::string, ReshapeLauncher::Ptr> _launchersByName;
+    // the shapes of the input data applied by the previous run, empty if the state of the launchers is unknown
+    std::map<std::string, SizeVector> _appliedInputShapes;
+    // the input data which shapes are requested by the previous run, the rest ones are taken from the IR
+    std::set<std::string> _requestedInputs;
     std::vector<CNNLayerPtr> _allSortedLayers{};
     std::set<CNNLayerPtr> _inputLayers{};
     InferenceEngine::details::caseless_set<std::string> _allTypes;
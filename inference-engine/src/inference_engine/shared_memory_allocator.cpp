@@ -0,0 +1,110 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_memory_allocator.hpp"
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#ifdef _WIN32
+SharedMemoryAllocator::SharedMemoryAllocator(const std::string &name) : _name("Local\\" + name) {}
+
+void * SharedMemoryAllocator::alloc(size_t size) noexcept {
+    if (size == 0 || _mapping != nullptr)
+        return nullptr;
+
+    const unsigned long long size64 = size;
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), _name.c_str());
+    if (mapping == nullptr)
+        return nullptr;
+
+    void * data = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (data == nullptr) {
+        // the existing region is smaller than the requested size
+        CloseHandle(mapping);
+        return nullptr;
+    }
+
+    _mapping = mapping;
+    _size = size;
+    return data;
+}
+
+bool SharedMemoryAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+
+    // the region is removed with its last handle
+    UnmapViewOfFile(handle);
+    CloseHandle(_mapping);
+    _mapping = nullptr;
+    _size = 0;
+    return true;
+}
+#else
+SharedMemoryAllocator::SharedMemoryAllocator(const std::string &name)
+        : _name(!name.empty() && name[0] == '/' ? name : "/" + name) {}
+
+void * SharedMemoryAllocator::alloc(size_t size) noexcept {
+    if (size == 0 || _size != 0)
+        return nullptr;
+
+    bool created = true;
+    int fd = shm_open(_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        created = false;
+        fd = shm_open(_name.c_str(), O_RDWR, 0600);
+    }
+    if (fd < 0)
+        return nullptr;
+
+    auto fail = [&]() -> void * {
+        close(fd);
+        if (created)
+            shm_unlink(_name.c_str());
+        return nullptr;
+    };
+
+    if (created) {
+        if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+            return fail();
+    } else {
+        struct stat sb = {};
+        if (fstat(fd, &sb) != 0 || static_cast<size_t>(sb.st_size) < size)
+            return fail();
+    }
+
+    void * data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED)
+        return fail();
+    // the mapping keeps its own reference to the region
+    close(fd);
+
+    _created = created;
+    _size = size;
+    return data;
+}
+
+bool SharedMemoryAllocator::free(void* handle) noexcept {
+    if (handle == nullptr)
+        return true;
+
+    munmap(handle, _size);
+    if (_created)
+        shm_unlink(_name.c_str());
+    _created = false;
+    _size = 0;
+    return true;
+}
+#endif
@@ -0,0 +1,47 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include "ie_api.h"
+#include "ie_allocator.hpp"
+
+/**
+ * @brief Maps a named shared memory region instead of allocating the memory, so the blobs of the processes that use
+ * the same name have the same data. The first allocator of the name creates the region of the requested size, the
+ * others map it as is and fail if it is smaller. The region is removed by the allocator that created it when the
+ * memory is freed, the processes that mapped it keep their mappings.
+ */
+class INFERENCE_ENGINE_API_CLASS(SharedMemoryAllocator) : public InferenceEngine::IAllocator {
+public:
+    explicit SharedMemoryAllocator(const std::string &name);
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * a) noexcept override {}
+
+    /**
+     * @brief Creates or opens the region and maps its first size bytes
+     * @return The address of the mapping or nullptr if the region cannot be mapped
+     */
+    void * alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+private:
+    std::string _name;
+    size_t _size = 0;
+#ifdef _WIN32
+    void * _mapping = nullptr;
+#else
+    bool _created = false;
+#endif
+};
@@ -3,6 +3,13 @@
 //
 
 #include "system_alllocator.hpp"
+#include "pool_allocator.hpp"
+#include "hugepage_allocator.hpp"
+#include "numa_allocator.hpp"
+#include "shared_memory_allocator.hpp"
+#include "ie_plugin_config.hpp"
+
+#include <cstring>
 
 INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateDefaultAllocator() noexcept {
     try {
@@ -10,4 +17,32 @@ INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateDefaultAllocator() noexc
     }catch (...) {
         return nullptr;
     }
-}
\ No newline at end of file
+}
+
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateAllocator(const char *kind) noexcept {
+    using namespace InferenceEngine::PluginConfigParams;
+    if (kind == nullptr)
+        return nullptr;
+    try {
+        if (std::strcmp(kind, ALLOCATOR_SYSTEM) == 0)
+            return new SystemMemoryAllocator();
+        if (std::strcmp(kind, ALLOCATOR_POOL) == 0)
+            return new PoolAllocator();
+        if (std::strcmp(kind, ALLOCATOR_HUGEPAGES) == 0)
+            return new HugePageAllocator();
+        if (std::strcmp(kind, ALLOCATOR_NUMA) == 0)
+            return new NumaAllocator(NumaAllocator::currentNode());
+    } catch (...) {
+    }
+    return nullptr;
+}
+
+INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateSharedMemoryAllocator(const char *name) noexcept {
+    if (name == nullptr || *name == '\0')
+        return nullptr;
+    try {
+        return new SharedMemoryAllocator(name);
+    } catch (...) {
+    }
+    return nullptr;
+}
@@ -0,0 +1,183 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <string>
+#include <set>
+
+#include "xml_stream_reader.hpp"
+#include "details/ie_exception.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+constexpr size_t bufferSize = 1 << 20;
+}  // namespace
+
+XmlStreamReader::XmlStreamReader(const std::string &filePath, const std::set<std::string> &sections)
+        : _file(filePath, std::ios::binary), _sections(sections) {}
+
+bool XmlStreamReader::fill() {
+    if (!_file)
+        return false;
+    _bufferOffset += _size;
+    _buffer.resize(bufferSize);
+    _file.read(_buffer.data(), _buffer.size());
+    _size = static_cast<size_t>(_file.gcount());
+    _pos = 0;
+    return _size != 0;
+}
+
+int XmlStreamReader::peek() {
+    if (_pos == _size && !fill())
+        return -1;
+    return static_cast<unsigned char>(_buffer[_pos]);
+}
+
+int XmlStreamReader::get() {
+    int c = peek();
+    if (c >= 0)
+        _pos++;
+    return c;
+}
+
+void XmlStreamReader::readUntil(std::string &out, const char *terminator) {
+    const size_t length = std::strlen(terminator);
+    while (out.size() < length || out.compare(out.size() - length, length, terminator) != 0) {
+        int c = get();
+        if (c < 0)
+            THROW_IE_EXCEPTION << "Unexpected end of the XML file, '" << terminator << "' is expected";
+        out += static_cast<char>(c);
+    }
+}
+
+XmlStreamReader::Token XmlStreamReader::readToken(std::string &out) {
+    int c = get();
+    if (c < 0)
+        return Token::End;
+
+    out += static_cast<char>(c);
+    if (c != '<') {
+        for (c = peek(); c >= 0 && c != '<'; c = peek())
+            out += static_cast<char>(get());
+        return Token::Text;
+    }
+
+    c = get();
+    if (c < 0)
+        THROW_IE_EXCEPTION << "Unexpected end of the XML file after '<'";
+    out += static_cast<char>(c);
+
+    if (c == '/') {
+        readUntil(out, ">");
+        return Token::EndTag;
+    }
+    if (c == '?') {
+        readUntil(out, "?>");
+        return Token::Other;
+    }
+    if (c == '!') {
+        if (peek() == '-') {
+            readUntil(out, "-->");
+        } else if (peek() == '[') {
+            readUntil(out, "]]>");
+        } else {
+            // a document type declaration, its internal subset is skipped as a whole
+            int brackets = 0;
+            for (c = get(); c >= 0 && (c != '>' || brackets != 0); c = get()) {
+                out += static_cast<char>(c);
+                brackets += c == '[' ? 1 : c == ']' ? -1 : 0;
+            }
+            if (c < 0)
+                THROW_IE_EXCEPTION << "Unexpected end of the XML file in a declaration";
+            out += '>';
+        }
+        return Token::Other;
+    }
+
+    // the '>' characters in the attribute values do not end the tag
+    char quote = 0;
+    for (c = get(); c >= 0; c = get()) {
+        out += static_cast<char>(c);
+        if (quote != 0) {
+            if (c == quote)
+                quote = 0;
+        } else if (c == '"' || c == '\'') {
+            quote = static_cast<char>(c);
+        } else if (c == '>') {
+            return out[out.size() - 2] == '/' ? Token::EmptyTag : Token::StartTag;
+        }
+    }
+    THROW_IE_EXCEPTION << "Unexpected end of the XML file in a tag";
+}
+
+std::string XmlStreamReader::tagName(const std::string &tag) {
+    size_t begin = tag[1] == '/' ? 2 : 1;
+    size_t end = tag.find_first_of(" \t\r\n/>", begin);
+    return tag.substr(begin, end - begin);
+}
+
+bool XmlStreamReader::open() {
+    if (!_file)
+        return false;
+
+    std::string tag;
+    for (;;) {
+        tag.clear();
+        Token token = readToken(tag);
+        if (token == Token::End)
+            return false;
+        if (token != Token::StartTag && token != Token::EmptyTag)
+            continue;
+
+        _closed = token == Token::EmptyTag;
+        if (!_closed)
+            tag += "</" + tagName(tag) + ">";
+        return _root.load_buffer(tag.data(), tag.size()).status == pugi::status_ok;
+    }
+}
+
+bool XmlStreamReader::next(pugi::xml_document &element, std::string &section) {
+    std::string text;
+    while (!_closed) {
+        text.clear();
+        uint64_t start = _bufferOffset + _pos;
+        Token token = readToken(text);
+
+        if (token == Token::End)
+            THROW_IE_EXCEPTION << "Unexpected end of the XML file, the root element is not closed";
+        if (token == Token::Text || token == Token::Other)
+            continue;
+        if (token == Token::EndTag) {
+            if (_openSections.empty()) {
+                _closed = true;
+            } else {
+                _openSections.pop_back();
+            }
+            continue;
+        }
+
+        std::string name = tagName(text);
+        if (token == Token::StartTag && _openSections.empty() && _sections.count(name)) {
+            _openSections.push_back(name);
+            continue;
+        }
+
+        // the element is read with all its children
+        for (int depth = token == Token::StartTag ? 1 : 0; depth > 0;) {
+            token = readToken(text);
+            if (token == Token::End)
+                THROW_IE_EXCEPTION << "Unexpected end of the XML file, the element " << name << " is not closed";
+            depth += token == Token::StartTag ? 1 : token == Token::EndTag ? -1 : 0;
+        }
+
+        pugi::xml_parse_result res = element.load_buffer(text.data(), text.size());
+        if (res.status != pugi::status_ok)
+            THROW_IE_EXCEPTION << res.description() << " at offset " << start + res.offset;
+        section = _openSections.empty() ? std::string() : _openSections.back();
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <set>
+
+#include "ie_api.h"
+#include "pugixml.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Reads an XML file element by element, so only the element being parsed is kept in memory instead of the
+ * DOM of the whole file. The children of the root element are returned one by one, and so are the children of the
+ * sections given to the constructor, e.g. the layers and the edges of an IR.
+ */
+class INFERENCE_ENGINE_API_CLASS(XmlStreamReader) {
+public:
+    XmlStreamReader(const std::string &filePath, const std::set<std::string> &sections);
+
+    /**
+     * @brief Reads the file up to the root element
+     * @return false if the file cannot be opened or it has no root element
+     */
+    bool open();
+
+    /**
+     * @brief The root element with its attributes only
+     */
+    pugi::xml_node root() const {
+        return _root.document_element();
+    }
+
+    /**
+     * @brief Reads the next element, it is parsed to the element document as a whole
+     * @param section The name of the section the element is a child of, empty for the children of the root
+     * @return false at the end of the root element
+     */
+    bool next(pugi::xml_document &element, std::string &section);
+
+private:
+    enum class Token { End, Text, StartTag, EmptyTag, EndTag, Other };
+
+    Token readToken(std::string &out);
+    void readUntil(std::string &out, const char *terminator);
+    int get();
+    int peek();
+    bool fill();
+
+    static std::string tagName(const std::string &tag);
+
+    std::ifstream _file;
+    std::vector<char> _buffer;
+    size_t _pos = 0;
+    size_t _size = 0;
+    // the offset in the file of the beginning of the buffer
+    uint64_t _bufferOffset = 0;
+
+    pugi::xml_document _root;
+    bool _closed = false;
+    std::set<std::string> _sections;
+    std::vector<std::string> _openSections;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
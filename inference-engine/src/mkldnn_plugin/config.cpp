@@ -52,6 +52,7 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS
                                    << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) {
+            autoThroughputStreams = val == PluginConfigParams::CPU_THROUGHPUT_AUTO;
             if (val == PluginConfigParams::CPU_THROUGHPUT_NUMA) {
                 throughputStreams = MKLDNNPlugin::cpu::getNumberOfCPUSockets();
             } else if (val == PluginConfigParams::CPU_THROUGHPUT_AUTO) {
@@ -87,6 +88,63 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             }
             if (val_i > 0)
                 threadsNum = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_DYN_SHAPES_CACHE_SIZE) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYN_SHAPES_CACHE_SIZE
+                                   << ". Expected only non-negative numbers (#shapes)";
+            }
+            dynShapesCacheSize = std::max(val_i, 0);
+        } else if (key == PluginConfigParams::KEY_CPU_KERNEL_CACHE_CAPACITY) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_KERNEL_CACHE_CAPACITY
+                                   << ". Expected only non-negative numbers (#kernels)";
+            }
+            kernelCacheCapacity = std::max(val_i, 0);
+        } else if (key == PluginConfigParams::KEY_CPU_TRACE_FILE) {
+            // empty string means that tracing is switched off
+            traceFile = val;
+        } else if (key == PluginConfigParams::KEY_CPU_TRACE_BUFFER_SIZE) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_TRACE_BUFFER_SIZE
+                                   << ". Expected only positive numbers (#events)";
+            }
+            if (val_i <= 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_TRACE_BUFFER_SIZE
+                                   << ". Expected only positive numbers (#events)";
+            traceBufferSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_CALLBACK_THREADS) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_CALLBACK_THREADS
+                                   << ". Expected only non-negative numbers (#threads)";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_CALLBACK_THREADS
+                                   << ". Expected only non-negative numbers (#threads)";
+            callbackThreads = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_SPIN_WAIT_TIME) {
+            int val_i;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPIN_WAIT_TIME
+                                   << ". Expected only non-negative numbers (#microseconds)";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPIN_WAIT_TIME
+                                   << ". Expected only non-negative numbers (#microseconds)";
+            spinWaitMicros = val_i;
         } else if (key.compare(PluginConfigParams::KEY_DYN_BATCH_ENABLED) == 0) {
             if (val.compare(PluginConfigParams::YES) == 0)
                 enableDynamicBatch = true;
@@ -95,6 +153,54 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_INTER_LAYER_PARALLELISM) {
+            if (val == PluginConfigParams::YES) interLayerParallelism = true;
+            else if (val == PluginConfigParams::NO) interLayerParallelism = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_INTER_LAYER_PARALLELISM
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_DEPTH_FIRST) {
+            if (val == PluginConfigParams::YES) depthFirst = true;
+            else if (val == PluginConfigParams::NO) depthFirst = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DEPTH_FIRST
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
+            if (val == PluginConfigParams::YES) enforceBF16 = true;
+            else if (val == PluginConfigParams::NO) enforceBF16 = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_RNN_PERSISTENT_STATE) {
+            if (val == PluginConfigParams::YES) rnnPersistentState = true;
+            else if (val == PluginConfigParams::NO) rnnPersistentState = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_RNN_PERSISTENT_STATE
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_INT8_WEIGHTS_COMPRESSION) {
+            if (val == PluginConfigParams::YES) int8WeightsCompression = true;
+            else if (val == PluginConfigParams::NO) int8WeightsCompression = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_INT8_WEIGHTS_COMPRESSION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_BLOB_ALLOCATOR) {
+            if (val == PluginConfigParams::ALLOCATOR_SYSTEM || val == PluginConfigParams::ALLOCATOR_POOL ||
+                val == PluginConfigParams::ALLOCATOR_HUGEPAGES || val == PluginConfigParams::ALLOCATOR_NUMA)
+                blobAllocator = val;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_BLOB_ALLOCATOR
+                                   << ". Expected only ALLOCATOR_SYSTEM/ALLOCATOR_POOL/ALLOCATOR_HUGEPAGES/ALLOCATOR_NUMA";
+        } else if (key == PluginConfigParams::KEY_CPU_SCRATCH_ARENA) {
+            scratchArena = val;
+        } else if (key == PluginConfigParams::KEY_TUNING_MODE) {
+            if (val == PluginConfigParams::TUNING_DISABLED) tuningMode = TuningMode::Disabled;
+            else if (val == PluginConfigParams::TUNING_CREATE) tuningMode = TuningMode::Create;
+            else if (val == PluginConfigParams::TUNING_USE_EXISTING) tuningMode = TuningMode::UseExisting;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_TUNING_MODE
+                                   << ". Expected only TUNING_CREATE/TUNING_USE_EXISTING/TUNING_DISABLED";
+        } else if (key == PluginConfigParams::KEY_TUNING_FILE) {
+            tuningFile = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -102,8 +208,19 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
     }
-    if (exclusiveAsyncRequests)  // Exclusive request feature disables the streams
+    if (exclusiveAsyncRequests) {  // Exclusive request feature disables the streams
         throughputStreams = 1;
+        autoThroughputStreams = false;
+    }
+}
+
+std::shared_ptr<IAllocator> Config::createBlobAllocator() const {
+    if (blobAllocator.empty() || blobAllocator == PluginConfigParams::ALLOCATOR_SYSTEM)
+        return nullptr;
+    IAllocator *allocator = CreateAllocator(blobAllocator.c_str());
+    if (allocator == nullptr)
+        THROW_IE_EXCEPTION << "Cannot create the " << blobAllocator << " allocator";
+    return details::shared_from_irelease(allocator);
 }
 
 }  // namespace MKLDNNPlugin
@@ -6,6 +6,8 @@
 
 #include <string>
 #include <map>
+#include <memory>
+#include "ie_allocator.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -14,12 +16,41 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool interLayerParallelism = false;
+    bool depthFirst = false;
+    bool enforceBF16 = false;
+    bool rnnPersistentState = false;
+    bool int8WeightsCompression = false;
     std::string dumpToDot = "";
+    std::string traceFile = "";
+    std::string blobAllocator = "";
+    // the intermediate edges of the graphs with the same name share the memory (MKLDNNScratchArena)
+    std::string scratchArena = "";
     int batchLimit = 0;
     int throughputStreams = 1;
+    // CPU_THROUGHPUT_AUTO: the streams are chosen for the network at the load, throughputStreams is the fallback
+    bool autoThroughputStreams = false;
     int threadsNum = 0;
+    int dynShapesCacheSize = 0;
+    int kernelCacheCapacity = 256;
+    int traceBufferSize = 65536;
+    int callbackThreads = 0;
+    int spinWaitMicros = 0;
+    // the implementations of the nodes are timed at the load (Create) or read from the tuningFile (UseExisting)
+    enum class TuningMode {
+        Disabled,
+        Create,
+        UseExisting
+    };
+    TuningMode tuningMode = TuningMode::Disabled;
+    std::string tuningFile = "";
 
     void readProperties(const std::map<std::string, std::string> &config);
+
+    /**
+     * @return The allocator of the blobs and of the graph memory, nullptr for the default one
+     */
+    std::shared_ptr<InferenceEngine::IAllocator> createBlobAllocator() const;
 };
 
 }  // namespace MKLDNNPlugin
@@ -71,6 +71,44 @@ public:
         }
     }
 
+    /**
+     * @brief Converts the integral input to FP32 and subtracts the mean in one pass, the planar layout of the
+     * input is changed to the layout of the output on the fly, so no intermediate FP32 copy of the input is made
+     */
+    template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
+    void Convert(const MKLDNNDims &inputDims, const T *input, InferenceEngine::Layout inLayout,
+                 float *output, InferenceEngine::Layout outLayout, int batch) {
+        IE_ASSERT(input != nullptr && output != nullptr);
+
+        if (inputDims.ndims() != 4) {
+            THROW_IE_EXCEPTION << "Expecting input as 4 dimension blob with format NxCxHxW.";
+        }
+
+        if ((inLayout != InferenceEngine::NCHW && inLayout != InferenceEngine::NHWC) ||
+                (outLayout != InferenceEngine::NCHW && outLayout != InferenceEngine::NHWC)) {
+            THROW_IE_EXCEPTION << "Expecting input layout NCHW or NHWC.";
+        }
+
+        const size_t C = inputDims[1], H = inputDims[2], W = inputDims[3];
+        const float *meanBufferValues = nullptr;
+        if (meanBuffer && meanBuffer->size())
+            meanBufferValues = meanBuffer->readOnly();
+        const size_t cStride[2] = {H * W, 1}, wStride[2] = {1, C};
+        const size_t in = inLayout == InferenceEngine::NHWC, out = outLayout == InferenceEngine::NHWC;
+
+        InferenceEngine::parallel_for3d(batch, C, H, [&](int mb, int c, int h) {
+            // the mean image is planar, the mean values are per channel
+            const size_t plane = (c * H + h) * W;
+            const size_t inRow = mb * C * H * W + c * cStride[in] + h * W * wStride[in];
+            const size_t outRow = mb * C * H * W + c * cStride[out] + h * W * wStride[out];
+            const float mean = meanValues.empty() ? 0.0f : meanValues[c];
+            for (size_t w = 0; w < W; w++) {
+                output[outRow + w * wStride[out]] = static_cast<float>(input[inRow + w * wStride[in]]) -
+                        (meanBufferValues ? meanBufferValues[plane + w] : mean);
+            }
+        });
+    }
+
 private:
     std::vector<float> meanValues;
 
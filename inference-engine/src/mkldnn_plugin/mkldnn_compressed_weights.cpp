@@ -0,0 +1,83 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_compressed_weights.h"
+#include "mkldnn_plugin.h"
+#include "mkldnn_streams.h"
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <string>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+constexpr size_t MKLDNNCompressedWeights::minBytes;
+
+MKLDNNCompressedWeights::Ptr MKLDNNCompressedWeights::get(const std::string &nodeName, const Blob::Ptr &weights,
+                                                          const Blob::Ptr &biases, size_t rows) {
+    if (!weights || weights->precision() != Precision::FP32 || rows == 0 || weights->size() % rows != 0 ||
+        (biases && (biases->precision() != Precision::FP32 || biases->size() != rows)))
+        return nullptr;
+
+    static std::mutex cacheMutex;
+    static std::map<std::string, std::weak_ptr<MKLDNNCompressedWeights>> cache;
+
+    // the same key as the dense weights: the streams pinned to different NUMA nodes get their own copy
+    const int numaNode = MultiWorkerTaskExecutor::ptrContext.numaNode;
+    const uint64_t hash = Engine::GetWeightsSharing().GetHashFunc().hash(weights->cbuffer().as<const unsigned char *>(),
+                                                                        weights->byteSize());
+    std::string key = nodeName + "_" + std::to_string(weights->byteSize()) + "_" + std::to_string(hash);
+    if (numaNode >= 0)
+        key += "_numa" + std::to_string(numaNode);
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    Ptr compressed = cache[key].lock();
+    if (!compressed) {
+        compressed.reset(new MKLDNNCompressedWeights(weights->cbuffer().as<const float *>(),
+                                                     biases ? biases->cbuffer().as<const float *>() : nullptr,
+                                                     rows, weights->size() / rows));
+        cache[key] = compressed;
+    }
+    return compressed;
+}
+
+MKLDNNCompressedWeights::MKLDNNCompressedWeights(const float *weights, const float *biasesData, size_t rows, size_t cols)
+        : rows(rows), cols(cols), values(rows * cols), scales(rows) {
+    std::vector<float> errors(rows, 0.f);
+    parallel_for(rows, [&](size_t r) {
+        const float *row = weights + r * cols;
+        float absMax = 0.f;
+        for (size_t c = 0; c < cols; c++)
+            absMax = std::max(absMax, std::fabs(row[c]));
+        // the symmetric quantization keeps the zero weights exact
+        const float scale = absMax / 127.f;
+        scales[r] = scale;
+        for (size_t c = 0; c < cols; c++) {
+            const float q = scale == 0.f ? 0.f : std::max(-127.f, std::min(127.f, std::round(row[c] / scale)));
+            values[r * cols + c] = static_cast<int8_t>(q);
+            errors[r] = std::max(errors[r], std::fabs(q * scale - row[c]));
+        }
+    });
+    maxError = rows ? *std::max_element(errors.begin(), errors.end()) : 0.f;
+    if (biasesData)
+        biases.assign(biasesData, biasesData + rows);
+}
+
+void MKLDNNCompressedWeights::multiplyRows(const float *src, float *dst, size_t batch) const {
+    parallel_for(rows, [&](size_t r) {
+        const int8_t *row = values.data() + r * cols;
+        const float bias = biases.empty() ? 0.f : biases[r];
+        // the row is read from the memory once, the next batches find it in L1
+        for (size_t n = 0; n < batch; n++) {
+            const float *srcRow = src + n * cols;
+            float sum = 0.f;
+            for (size_t c = 0; c < cols; c++)
+                sum += static_cast<float>(row[c]) * srcRow[c];
+            dst[n * rows + r] = sum * scales[r] + bias;
+        }
+    });
+}
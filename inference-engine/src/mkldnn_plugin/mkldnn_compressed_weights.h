@@ -0,0 +1,61 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The FP32 weights of a fully connected layer stored as INT8 with a scale per output channel
+ * (Config::int8WeightsCompression). The weights are dequantized while they are multiplied, the activations and
+ * the accumulation stay FP32, so no calibration is needed. The weights take 4 times less memory bandwidth, which
+ * bounds the large layers at the low batches.
+ * The nodes keep the dense primitive unless the compressed multiplication is faster on their shapes.
+ */
+class MKLDNNCompressedWeights {
+public:
+    typedef std::shared_ptr<MKLDNNCompressedWeights> Ptr;
+
+    /**
+     * @brief The size of the FP32 weights below which they stay in the caches and the dense primitive is kept
+     */
+    static constexpr size_t minBytes = 4 * 1024 * 1024;
+
+    /**
+     * @brief Returns the compressed weights (rows are the output channels) and biases (may be null) of the node,
+     * shared by the graphs of the process (the streams) like the dense weights, or nullptr for the unsupported blobs
+     */
+    static Ptr get(const std::string &nodeName, const InferenceEngine::Blob::Ptr &weights,
+                   const InferenceEngine::Blob::Ptr &biases, size_t rows);
+
+    /**
+     * @brief dst[n][r] = scale[r] * sum(Q[r][c] * src[n][c]) + b[r], the fully connected layer
+     */
+    void multiplyRows(const float *src, float *dst, size_t batch) const;
+
+    /**
+     * @brief The largest difference between the dequantized and the original weights
+     */
+    float getMaxError() const {
+        return maxError;
+    }
+
+private:
+    MKLDNNCompressedWeights(const float *weights, const float *biases, size_t rows, size_t cols);
+
+    size_t rows;
+    size_t cols;
+    std::vector<int8_t> values;
+    std::vector<float> scales;
+    std::vector<float> biases;
+    float maxError = 0.f;
+};
+
+}  // namespace MKLDNNPlugin
@@ -41,3 +41,20 @@ InferenceEngine::ILayerImplFactory* MKLDNNExtensionManager::CreateExtensionFacto
 
 
 
+
+std::string MKLDNNExtensionManager::GetExtensionDescription(const InferenceEngine::CNNLayerPtr &layer) {
+    if (!layer)
+        THROW_IE_EXCEPTION << "Cannot get cnn layer!";
+    for (auto& ext : _extensions) {
+        ResponseDesc responseDesc;
+        ILayerImplFactory* factory = nullptr;
+        if (ext->getFactoryFor(factory, layer.get(), &responseDesc) != OK || factory == nullptr)
+            continue;
+        delete factory;
+
+        const Version* version = nullptr;
+        ext->GetVersion(version);
+        return version && version->description ? version->description : "";
+    }
+    return "";
+}
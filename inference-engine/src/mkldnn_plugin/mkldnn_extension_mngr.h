@@ -7,6 +7,7 @@
 #include <map>
 #include <vector>
 #include <memory>
+#include <string>
 #include <ie_iextension.h>
 
 namespace MKLDNNPlugin {
@@ -16,6 +17,8 @@ public:
     using Ptr = std::shared_ptr<MKLDNNExtensionManager>;
     MKLDNNExtensionManager() = default;
     InferenceEngine::ILayerImplFactory* CreateExtensionFactory(const InferenceEngine::CNNLayerPtr& Layer);
+    // The description of the first extension that supports the layer, empty if there is none
+    std::string GetExtensionDescription(const InferenceEngine::CNNLayerPtr& layer);
     void AddExtension(InferenceEngine::IExtensionPtr extension);
 
 private:
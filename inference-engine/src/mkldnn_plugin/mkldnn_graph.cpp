@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <functional>
 #include <string>
 #include <map>
 #include <vector>
@@ -20,6 +21,9 @@
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_depthwise_node.h>
 #include <nodes/mkldnn_conv_node.h>
+#include <nodes/mkldnn_fullyconnected_node.h>
+#include <nodes/mkldnn_rnn.h>
+#include <nodes/mkldnn_memory_node.hpp>
 
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
@@ -29,7 +33,10 @@
 #include "ie_algorithm.hpp"
 #include "memory_solver.hpp"
 #include "mkldnn_infer_request.h"
+#include "mkldnn_memory_state.h"
 #include "mkldnn_async_infer_request.h"
+#include "mkldnn_model_serial.h"
+#include "mkldnn_tuning.h"
 #include <blob_factory.hpp>
 #include <ie_util_internal.hpp>
 #include <net_pass.h>
@@ -79,11 +86,107 @@ void MKLDNNGraph::CreateGraph(const ICNNNetwork &network, const MKLDNNExtensionM
     if (IsReady())
         ForgetGraphData();
 
-    Replicate(network, extMgr);
+    if (config.dynShapesCacheSize > 0) {
+        shapesNetwork = cloneNet(network);
+        shapesExtensionManager = extMgr;
+    }
+
+    {
+        LoadPhaseScope phase("Replicate");
+        Replicate(network, extMgr);
+    }
+    InitGraph();
+    status = Ready;
+}
+
+void MKLDNNGraph::CreateGraph(const InferenceEngine::TensorIterator::Body &body,
+                              const MKLDNNExtensionManager::Ptr& extMgr) {
+    if (IsReady())
+        ForgetGraphData();
+
+    Replicate(body, extMgr);
     InitGraph();
     status = Ready;
 }
 
+MKLDNNGraph* MKLDNNGraph::getGraphForShapes(const InferenceEngine::BlobMap &inputs) {
+    if (!shapesNetwork)
+        return this;
+
+    bool loadedShapes = true;
+    std::string key;
+    ICNNNetwork::InputShapes shapes;
+    for (const auto &input : inputs) {
+        auto node = inputNodes.find(input.first);
+        if (node == inputNodes.end())
+            continue;
+
+        const SizeVector &dims = input.second->getTensorDesc().getDims();
+        const SizeVector limits = node->second->getChildEdgeAt(0)->getDims().ToSizeVector();
+        if (dims.size() != limits.size())
+            THROW_IE_EXCEPTION << "Input " << input.first << " rank " << dims.size()
+                               << " differs from the network input rank " << limits.size();
+        for (size_t i = 0; i < dims.size(); i++) {
+            // the batch and the channels are fixed, the spatial dims are bounded
+            if ((i < 2 && dims[i] != limits[i]) || dims[i] > limits[i])
+                THROW_IE_EXCEPTION << "Input " << input.first << " dim " << i << " equal to " << dims[i]
+                                   << " is not supported, the network was loaded with " << limits[i];
+        }
+
+        loadedShapes &= dims == limits;
+        shapes[input.first] = dims;
+        key += input.first + ":";
+        for (auto dim : dims) key += std::to_string(dim) + ",";
+        key += ";";
+    }
+    if (loadedShapes)
+        return this;
+
+    for (auto it = shapeGraphs.begin(); it != shapeGraphs.end(); it++) {
+        if (it->first == key) {
+            shapeGraphs.splice(shapeGraphs.begin(), shapeGraphs, it);
+            return shapeGraphs.front().second.get();
+        }
+    }
+
+    auto network = cloneNet(*shapesNetwork);
+    ResponseDesc resp;
+    if (network->reshape(shapes, &resp) != StatusCode::OK)
+        THROW_IE_EXCEPTION << "Cannot reshape the network for the new input dims: " << resp.msg;
+
+    Config shapeConfig = config;
+    shapeConfig.dynShapesCacheSize = 0;
+    MKLDNNGraph::Ptr graph = std::make_shared<MKLDNNGraph>();
+    graph->setConfig(shapeConfig);
+    graph->setTrace(trace, streamId);
+    // the weights of the graph are shared with the graphs of the other shapes, since their dims are not changed
+    graph->CreateGraph(*network, shapesExtensionManager);
+
+    shapeGraphs.emplace_front(key, graph);
+    if (shapeGraphs.size() > static_cast<size_t>(config.dynShapesCacheSize))
+        shapeGraphs.pop_back();
+    return graph.get();
+}
+
+void MKLDNNGraph::reshapeOutputBlobs(InferenceEngine::BlobMap &outputs, InferenceEngine::OutputsDataMap &networkOutputs,
+                                     RequestBlobs &requestBlobs) {
+    for (auto &node : outputNodes) {
+        std::string name = node->getName().substr(4);
+        auto output = outputs.find(name);
+        auto networkOutput = networkOutputs.find(name);
+        if (output == outputs.end() || networkOutput == networkOutputs.end())
+            continue;
+
+        SizeVector dims = node->getParentEdgeAt(0)->getDims().ToSizeVector();
+        const TensorDesc &desc = output->second->getTensorDesc();
+        if (desc.getDims() == dims)
+            continue;
+
+        networkOutput->second->reshape(dims, desc.getLayout());
+        output->second = requestBlobs.outputFor(name, output->second, dims);
+    }
+}
+
 void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr) {
     InputsDataMap inputs;
     network.getInputsInfo(inputs);
@@ -157,6 +260,23 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
         layer2node[layer] = node;
     }
 
+    // the memory layers of the same id are the two ends of one state, the nodes are paired per graph, so the graphs of
+    // the streams keep their own states
+    std::map<std::string, MKLDNNMemoryInputNode *> memoryInputs;
+    for (auto &node : graphNodes) {
+        auto memoryInput = dynamic_cast<MKLDNNMemoryInputNode *>(node.get());
+        if (memoryInput && node->getType() == MemoryInput)
+            memoryInputs[memoryInput->getId()] = memoryInput;
+    }
+    for (auto &node : graphNodes) {
+        auto memoryOutput = dynamic_cast<MKLDNNMemoryOutputNode *>(node.get());
+        if (!memoryOutput || node->getType() != MemoryOutput)
+            continue;
+        auto memoryInput = memoryInputs.find(memoryOutput->getId());
+        if (memoryInput != memoryInputs.end())
+            memoryOutput->setInputNode(memoryInput->second);
+    }
+
     // Replicate input nodes
     for (const auto& input : inputs) {
         auto inputLayer = input.second->getInputData()->getCreatorLayer().lock();
@@ -173,26 +293,150 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
     }
 }
 
+void MKLDNNGraph::Replicate(const InferenceEngine::TensorIterator::Body &body,
+                            const MKLDNNExtensionManager::Ptr& extMgr) {
+    // the body inputs have no creator layers, the nodes are referred by the data
+    std::unordered_map<Data*, std::pair<MKLDNNNodePtr, int>> data2node;
+
+    for (const auto &input : body.inputs) {
+        if (input->getInputTo().empty())
+            continue;
+
+        CNNLayerPtr layer(new CNNLayer({input->getName(), "Input", input->getPrecision()}));
+        layer->outData.push_back(input);
+
+        const MKLDNNNodePtr node(MKLDNNNode::CreateNode(layer, getEngine(), extMgr));
+        graphNodes.push_back(node);
+        inputNodes[input->getName()] = node;
+        data2node[input.get()] = {node, 0};
+    }
+
+    // Replicate All Nodes in topological order, the layers without inputs (like constants) are reachable only
+    // through the layers they are consumed by, so they are started from the holder data
+    std::vector<DataPtr> heads = body.inputs;
+    for (const auto &input : body.inputs) {
+        for (const auto &consumer : input->getInputTo()) {
+            for (const auto &layer : CNNNetGetAllInputLayers(consumer.second.get())) {
+                DataPtr holder(new Data(layer->name + ":input_holder", layer->precision));
+                holder->inputTo[layer->name] = layer;
+                heads.push_back(holder);
+            }
+        }
+    }
+    std::vector<CNNLayerPtr> sorted;
+    CNNNetForestDFS(heads, [&](CNNLayerPtr layer) { sorted.push_back(layer); }, false);
+    std::reverse(sorted.begin(), sorted.end());
+
+    for (const auto &layer : sorted) {
+        const MKLDNNNodePtr node(MKLDNNNode::CreateNode(layer, getEngine(), extMgr));
+        graphNodes.push_back(node);
+
+        for (int port = 0; port < layer->insData.size(); port++) {
+            auto parent = data2node.find(layer->insData[port].lock().get());
+            if (parent == data2node.end())
+                THROW_IE_EXCEPTION << "TensorIterator body layer " << layer->name << " has unknown input " << port;
+
+            MKLDNNEdgePtr edge(new MKLDNNEdge(parent->second.first, node, parent->second.second, port));
+            node->addEdge(edge);
+            graphEdges.push_back(edge);
+        }
+        for (int port = 0; port < layer->outData.size(); port++)
+            data2node[layer->outData[port].get()] = {node, port};
+    }
+
+    auto addOutput = [&](const DataPtr &data, const std::string &name) {
+        auto parent = data2node.find(data.get());
+        if (parent == data2node.end())
+            THROW_IE_EXCEPTION << "TensorIterator body output " << data->getName() << " is not produced by the body";
+
+        CNNLayerPtr layer(new CNNLayer({name, "Output", data->getPrecision()}));
+        layer->insData.push_back(data);
+
+        const MKLDNNNodePtr node(MKLDNNNode::CreateNode(layer, getEngine(), extMgr));
+        MKLDNNEdgePtr edge(new MKLDNNEdge(parent->second.first, node, parent->second.second, 0));
+        node->addEdge(edge);
+        graphEdges.push_back(edge);
+        graphNodes.push_back(node);
+        return node;
+    };
+
+    std::unordered_set<Data*> outputs;
+    for (const auto &output : body.outputs) {
+        if (outputs.insert(output.get()).second)
+            outputNodes.push_back(addOutput(output, "out_" + output->getName()));
+    }
+    // the unused results of the body layers are still written somewhere
+    for (const auto &layer : sorted) {
+        for (const auto &data : layer->outData) {
+            if (data->getInputTo().empty() && outputs.find(data.get()) == outputs.end())
+                addOutput(data, "stub_" + data->getName());
+        }
+    }
+}
+
 void MKLDNNGraph::InitGraph() {
     SortTopologically();
     MKLDNNGraphOptimizer optimizer;
-    optimizer.ApplyCommonGraphOptimizations(*this);
+    {
+        LoadPhaseScope phase("GraphOptimizations");
+        optimizer.ApplyCommonGraphOptimizations(*this);
+    }
     SortTopologically();
 
-    InitNodes();
+    if (config.rnnPersistentState) {
+        for (auto &node : graphNodes) {
+            if (node->getType() == RNNSeq)
+                std::dynamic_pointer_cast<MKLDNNRNN>(node)->setPersistentState();
+        }
+    }
 
-    for (auto &node : graphNodes) {
-        node->initOptimalPrimitiveDescriptor();
+    if (config.int8WeightsCompression) {
+        for (auto &node : graphNodes) {
+            auto fc = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+            if (fc)
+                fc->setInt8WeightsCompression();
+        }
     }
-    InitEdges();
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    {
+        LoadPhaseScope phase("PrimitiveDescriptors");
+        InitNodes();
+
+        for (auto &node : graphNodes) {
+            node->initOptimalPrimitiveDescriptor();
+        }
+    }
+    {
+        LoadPhaseScope phase("Edges");
+        InitEdges();
+    }
+
+    {
+        LoadPhaseScope phase("GraphOptimizations");
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    }
 
     SortTopologically();
 
-    Allocate();
+    InitExecLevels();
 
-    CreatePrimitives();
+    {
+        LoadPhaseScope phase("MemoryAllocation");
+        Allocate();
+        InitMemoryPairs();
+    }
+
+    {
+        // includes the reorders of the weights to the layouts of the primitives (WeightsReorders)
+        LoadPhaseScope phase("PrimitivesCreation");
+        CreatePrimitives();
+    }
+
+    if (config.depthFirst) {
+        LoadPhaseScope phase("TiledChains");
+        InitTiledChains();
+    }
+    InitExecPlan();
 
     // Do it before cleanup. Because it will lose original layers information
     for (auto &graphNode : graphNodes) {
@@ -214,6 +458,8 @@ void MKLDNNGraph::InitGraph() {
     if (!config.dumpToDot.empty())
         dumpToDotFile(config.dumpToDot + "_init.dot");
 
+    InitTraceLabels();
+
     for (auto &graphNode : graphNodes) {
         graphNode->cleanup();
     }
@@ -236,10 +482,27 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
 
+    LoadPhaseScope phase("ConstantFolding");
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+    // A branch which feeds only the layers computing on the shapes of their inputs (PriorBox and alike declare all
+    // the inputs constant) is constant too, but its data is not known on load and nobody reads it, so it is skipped.
+    std::unordered_set<MKLDNNNode *> shapeOnlyNodes;
     for (auto &graphNode : graphNodes) {
         if (!graphNode->isConstant())
             continue;
+
+        bool knownInputs = true;
+        for (size_t i = 0; i < graphNode->getParentEdges().size(); i++) {
+            auto parent = graphNode->getParentEdgeAt(i)->getParent();
+            knownInputs = knownInputs && parent->isConstant() && !shapeOnlyNodes.count(parent.get());
+        }
+        const auto &inConfs = graphNode->getSelectedPrimitiveDescriptor()->getConfig().inConfs;
+        const bool readsShapesOnly = !inConfs.empty() &&
+                std::all_of(inConfs.begin(), inConfs.end(), [](const DataConfig &conf) { return conf.constant; });
+        if (!knownInputs && !readsShapesOnly) {
+            shapeOnlyNodes.insert(graphNode.get());
+            continue;
+        }
         graphNode->execute(stream);
     }
 }
@@ -256,9 +519,252 @@ void MKLDNNGraph::InitNodes() {
         node->initSupportedPrimitiveDescriptors();
     }
 
+    if (config.tuningMode != Config::TuningMode::Disabled && !config.tuningFile.empty())
+        TuneNodes();
+
     for (auto &node : graphNodes) {
         node->selectOptimalPrimitiveDescriptor();
     }
+
+    MinimizeReorders();
+}
+
+void MKLDNNGraph::TuneNodes() {
+    auto cache = MKLDNNTuningCache::get(config.tuningFile);
+    for (auto &node : graphNodes) {
+        switch (node->getType()) {
+            case Convolution:
+            case Convolution_Sum:
+            case Convolution_Activation:
+            case Convolution_Depthwise:
+            case Convolution_Sum_Activation:
+            case Deconvolution:
+            case FullyConnected:
+            case FullyConnected_Activation:
+                break;
+            default:
+                continue;
+        }
+        // the priorities the user gives to the layer win
+        if (!node->cnnLayer || node->cnnLayer->params.find("PrimitivesPriority") != node->cnnLayer->params.end())
+            continue;
+
+        std::string key = node->getTuningKey();
+        std::string impl;
+        if (!cache->find(key, impl) && config.tuningMode == Config::TuningMode::Create) {
+            impl = node->timeImplementations();
+            if (!impl.empty())
+                cache->set(key, impl);
+        }
+        if (!impl.empty())
+            node->implPriorities.insert(node->implPriorities.begin(), parse_impl_name(impl));
+    }
+    if (config.tuningMode == Config::TuningMode::Create)
+        cache->save();
+}
+
+namespace {
+
+/* The primitive descriptors a node may switch to without changing its implementation */
+struct LayoutCandidates {
+    std::vector<int> indices;
+    std::vector<LayerConfig> configs;
+    size_t current = 0;
+};
+
+/* Cost of the reorder the edge needs between the configs of its ends: the elements of the tensor, 0 if they match */
+size_t reorderCost(const MKLDNNEdgePtr &edge, const LayerConfig &parentConf, const LayerConfig &childConf) {
+    int inNum = edge->getInputNum();
+    int outNum = edge->getOutputNum();
+    if (parentConf.outConfs.empty() || outNum < 0 || outNum >= childConf.inConfs.size())
+        return 0;
+    // the same fallback the greedy selection uses
+    if (inNum < 0 || inNum >= parentConf.outConfs.size())
+        inNum = 0;
+    const TensorDesc &parentDesc = parentConf.outConfs[inNum].desc;
+    if (MKLDNNExtensionUtils::initTensorsAreEqual(childConf.inConfs[outNum].desc, parentDesc))
+        return 0;
+    size_t elements = 1;
+    for (auto dim : parentDesc.getDims())
+        elements *= dim;
+    return std::max<size_t>(elements, 1);
+}
+
+class LayoutSelector {
+public:
+    explicit LayoutSelector(const std::vector<MKLDNNNodePtr> &nodes): nodes(nodes) {
+        for (auto &node : nodes) {
+            const PrimitiveDescInfo *selected = node->getSelectedPrimitiveDescriptor();
+            if (selected == nullptr)
+                continue;
+            LayoutCandidates &candidates = choices[node.get()];
+            const auto &supported = node->getSupportedPrimitiveDescriptors();
+            // Concat and Split choose their in-place configs looking at the neighbours, so they are kept as is
+            bool fixed = node->getType() == Concatenation || node->getType() == Split;
+            for (size_t i = 0; i < supported.size(); i++) {
+                bool isSelected = &supported[i] == selected;
+                bool sameImpl = supported[i].getImplementationType() == selected->getImplementationType();
+                if (!isSelected && (fixed || !sameImpl ||
+                        supported[i].getConfig().inConfs.size() > node->getParentEdges().size()))
+                    continue;
+                if (isSelected)
+                    candidates.current = candidates.indices.size();
+                candidates.indices.push_back(static_cast<int>(i));
+                candidates.configs.push_back(supported[i].getConfig());
+            }
+        }
+    }
+
+    void run() {
+        for (auto &chain : findChains())
+            selectOnChain(chain);
+
+        // the chains are joined and forked by the nodes that are improved one by one until nothing changes
+        const int maxSweeps = 8;
+        for (int sweep = 0; sweep < maxSweeps; sweep++) {
+            bool changed = false;
+            for (auto &node : nodes)
+                changed |= selectLocally(node.get());
+            if (!changed)
+                break;
+        }
+
+        for (auto &node : nodes) {
+            auto it = choices.find(node.get());
+            if (it != choices.end() && it->second.indices.size() > 1)
+                node->selectPrimitiveDescriptorByIndex(it->second.indices[it->second.current]);
+        }
+    }
+
+private:
+    const std::vector<MKLDNNNodePtr> &nodes;
+    std::unordered_map<MKLDNNNode *, LayoutCandidates> choices;
+
+    bool isFree(MKLDNNNode *node) const {
+        auto it = choices.find(node);
+        return it != choices.end() && it->second.indices.size() > 1;
+    }
+
+    const LayerConfig *currentConfig(MKLDNNNode *node) const {
+        auto it = choices.find(node);
+        return it == choices.end() ? nullptr : &it->second.configs[it->second.current];
+    }
+
+    /* Reorder cost of the edges of the node configured with the config, besides the skipped ones */
+    size_t nodeCost(MKLDNNNode *node, const LayerConfig &config,
+                    const MKLDNNEdgePtr &skipParent = nullptr, const MKLDNNEdgePtr &skipChild = nullptr) const {
+        size_t cost = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            const LayerConfig *parentConf = currentConfig(edge->getParent().get());
+            if (edge != skipParent && parentConf != nullptr)
+                cost += reorderCost(edge, *parentConf, config);
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto edge = node->getChildEdgeAt(i);
+            const LayerConfig *childConf = currentConfig(edge->getChild().get());
+            if (edge != skipChild && childConf != nullptr)
+                cost += reorderCost(edge, config, *childConf);
+        }
+        return cost;
+    }
+
+    bool selectLocally(MKLDNNNode *node) {
+        if (!isFree(node))
+            return false;
+        LayoutCandidates &candidates = choices[node];
+        size_t best = candidates.current;
+        size_t bestCost = nodeCost(node, candidates.configs[best]);
+        for (size_t c = 0; c < candidates.configs.size() && bestCost > 0; c++) {
+            size_t cost = nodeCost(node, candidates.configs[c]);
+            if (cost < bestCost) {
+                best = c;
+                bestCost = cost;
+            }
+        }
+        bool changed = best != candidates.current;
+        candidates.current = best;
+        return changed;
+    }
+
+    /* The edge linking the node to the next one in a chain: the only child edge, going to a node with one parent */
+    MKLDNNEdgePtr chainEdge(MKLDNNNode *node) const {
+        if (node->getChildEdges().size() != 1)
+            return nullptr;
+        auto edge = node->getChildEdgeAt(0);
+        auto child = edge->getChild().get();
+        return child->getParentEdges().size() == 1 && isFree(child) ? edge : nullptr;
+    }
+
+    /* Maximal chains of at least two free nodes */
+    std::vector<std::vector<MKLDNNNode *>> findChains() const {
+        std::vector<std::vector<MKLDNNNode *>> chains;
+        for (auto &node : nodes) {
+            if (!isFree(node.get()))
+                continue;
+            // the chains start at the nodes not continuing a chain of their parent
+            if (node->getParentEdges().size() == 1) {
+                auto parent = node->getParentEdgeAt(0)->getParent().get();
+                if (isFree(parent) && chainEdge(parent))
+                    continue;
+            }
+            std::vector<MKLDNNNode *> chain = {node.get()};
+            for (auto edge = chainEdge(node.get()); edge; edge = chainEdge(chain.back()))
+                chain.push_back(edge->getChild().get());
+            if (chain.size() > 1)
+                chains.push_back(chain);
+        }
+        return chains;
+    }
+
+    /* Dynamic programming over the chain with its neighbours fixed, it never gets worse than the current choice */
+    void selectOnChain(const std::vector<MKLDNNNode *> &chain) {
+        std::vector<std::vector<size_t>> cost(chain.size()), from(chain.size());
+        std::vector<MKLDNNEdgePtr> links(chain.size());
+        for (size_t i = 0; i + 1 < chain.size(); i++)
+            links[i] = chainEdge(chain[i]);
+
+        for (size_t i = 0; i < chain.size(); i++) {
+            const LayoutCandidates &candidates = choices[chain[i]];
+            cost[i].resize(candidates.configs.size());
+            from[i].resize(candidates.configs.size(), 0);
+            for (size_t c = 0; c < candidates.configs.size(); c++) {
+                size_t own = nodeCost(chain[i], candidates.configs[c], i > 0 ? links[i - 1] : nullptr, links[i]);
+                if (i == 0) {
+                    cost[i][c] = own;
+                    continue;
+                }
+                const LayoutCandidates &prev = choices[chain[i - 1]];
+                size_t best = std::numeric_limits<size_t>::max();
+                for (size_t p = 0; p < prev.configs.size(); p++) {
+                    size_t total = cost[i - 1][p] + reorderCost(links[i - 1], prev.configs[p], candidates.configs[c]);
+                    // ties keep the greedy choice
+                    if (total < best || (total == best && p == prev.current)) {
+                        best = total;
+                        from[i][c] = p;
+                    }
+                }
+                cost[i][c] = best + own;
+            }
+        }
+
+        const LayoutCandidates &last = choices[chain.back()];
+        size_t selected = last.current;
+        for (size_t c = 0; c < last.configs.size(); c++) {
+            if (cost.back()[c] < cost.back()[selected])
+                selected = c;
+        }
+        for (size_t i = chain.size(); i-- > 0;) {
+            choices[chain[i]].current = selected;
+            selected = from[i][selected];
+        }
+    }
+};
+
+}  // namespace
+
+void MKLDNNGraph::MinimizeReorders() {
+    LayoutSelector(graphNodes).run();
 }
 
 void MKLDNNGraph::InitEdges() {
@@ -325,6 +831,74 @@ void MKLDNNGraph::InitEdges() {
     }
 }
 
+static inline bool changesInputInPlace(const MKLDNNNodePtr &node, int port) {
+    const auto &config = node->getSelectedPrimitiveDescriptor()->getConfig();
+    if (port < config.inConfs.size() && config.inConfs[port].inPlace >= 0)
+        return true;
+    for (const auto &conf : config.outConfs) {
+        if (conf.inPlace == port)
+            return true;
+    }
+    return false;
+}
+
+void MKLDNNGraph::InitExecLevels() {
+    execLevels.clear();
+    for (auto &node : graphNodes) node->execLevel = -1;
+
+#if IE_THREAD == IE_THREAD_TBB && defined(MKLDNN_ENABLE_CONCURRENT_EXEC)
+    if (!config.interLayerParallelism)
+        return;
+
+    // The level of a node follows the levels of its parents. A node which writes into the input memory
+    // in-place has to wait for the other consumers of that memory also. The last constraint may point
+    // backward in the topological order, so the levels are refined until they are stable.
+    bool changed = true;
+    for (size_t pass = 0; changed && pass <= graphNodes.size(); pass++) {
+        changed = false;
+        for (auto &node : graphNodes) {
+            int level = 0;
+            for (size_t i = 0; i < node->getParentEdges().size() && !node->isConstant(); i++) {
+                auto edge = node->getParentEdgeAt(i);
+                level = std::max(level, edge->getParent()->execLevel + 1);
+                if (!changesInputInPlace(node, edge->getOutputNum()))
+                    continue;
+                for (auto &peer : edge->getParent()->getChildEdgesAtPort(edge->getInputNum())) {
+                    if (peer != edge)
+                        level = std::max(level, peer->getChild()->execLevel + 1);
+                }
+            }
+            if (level != node->execLevel) {
+                node->execLevel = level;
+                changed = true;
+            }
+        }
+    }
+
+    if (changed) {
+        // the in-place constraints are cyclic, the topological order is the only safe one
+        for (auto &node : graphNodes) node->execLevel = -1;
+        return;
+    }
+
+    int levels = 0;
+    for (auto &node : graphNodes) levels = std::max(levels, node->execLevel + 1);
+    // the state is written after all its readers are done
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryOutput) node->execLevel = levels;
+    }
+
+    execLevels.resize(levels + 1);
+    for (auto &node : graphNodes) {
+        if (!node->isConstant())
+            execLevels[node->execLevel].push_back(node);
+    }
+    execLevels.erase(std::remove_if(execLevels.begin(), execLevels.end(),
+                                    [](const std::vector<MKLDNNNodePtr> &level) { return level.empty(); }),
+                     execLevels.end());
+#endif
+}
+
 static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
@@ -400,12 +974,15 @@ void MKLDNNGraph::AllocateWithReuse() {
     const int64_t alignment = 32;  // 32 bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
+    // the inputs, outputs and constants live between the inferences, so they never go to the scratch arena
+    std::vector<bool> persistent(edge_clasters.size());
     for (int i = 0; i < edge_clasters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            // the nodes of one level run concurrently, so their memory lifetime is measured in levels
+            int e_start = execLevels.empty() ? edge->getParent()->execIndex : edge->getParent()->execLevel;
+            int e_finish = execLevels.empty() ? edge->getChild()->execIndex : edge->getChild()->execLevel;
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -432,29 +1009,82 @@ void MKLDNNGraph::AllocateWithReuse() {
             // WA. MemoryOutput will keep data in that edge
             // So need to make it immortal..
             isConst |= edge->getParent()->getType() == MemoryInput;
+            // the produced state becomes the state of the next inference
+            isConst |= edge->getChild()->getType() == MemoryOutput;
         }
 
         if (isInput  | isConst) box.start = 0;
         if (isOutput | isConst) box.finish = -1;
 
         box.size = div_up(box.size, alignment);
+        persistent[i] = isInput | isOutput | isConst;
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    // the scratch edges are placed separately, their memory is shared with the other graphs of the arena
+    scratchArena.reset();
+    scratchBase = nullptr;
+    scratchSize = 0;
+    std::vector<MemorySolver::Box> scratchBoxes;
+    if (!config.scratchArena.empty()) {
+        std::vector<MemorySolver::Box> privateBoxes;
+        for (int i = 0; i < boxes.size(); i++)
+            (persistent[i] ? privateBoxes : scratchBoxes).push_back(boxes[i]);
+        boxes.swap(privateBoxes);
+    }
+
+    const int64_t cache_line = 64, page = 4096;
+    const int64_t cache_size = mkldnn_get_cache_size(2, true);
+    auto solve = [&](const std::vector<MemorySolver::Box> &solverBoxes, std::unique_ptr<MemorySolver> &solver) {
+        std::unique_ptr<MemorySolver> minSolver(new MemorySolver(solverBoxes));
+        size_t total_size = static_cast<size_t>(minSolver->solve()) * alignment;
+
+        // The cache aware placement lets a producer write into the lines which are still in L2,
+        // it is taken unless it costs more than the cache itself on top of the minimal footprint.
+        std::unique_ptr<MemorySolver> cacheSolver(new MemorySolver(solverBoxes));
+        size_t cache_total_size = static_cast<size_t>(cacheSolver->solveCacheAware(
+                cache_size / alignment, cache_line / alignment, page / alignment)) * alignment;
+
+        if (cache_total_size <= total_size + cache_size) {
+            solver = std::move(cacheSolver);
+            return cache_total_size;
+        }
+        solver = std::move(minSolver);
+        return total_size;
+    };
+
+    std::unique_ptr<MemorySolver> memSolver, scratchSolver;
+    size_t total_size = solve(boxes, memSolver);
+    if (!scratchBoxes.empty()) {
+        scratchSize = solve(scratchBoxes, scratchSolver);
+        // the graphs of one stream run one by one, the streams of a network run concurrently
+        scratchArena = MKLDNNScratchArena::get(config.scratchArena + "_" + std::to_string(streamId),
+                                               config.createBlobAllocator());
+        scratchArena->reserve(scratchSize);
+        scratchBase = scratchArena->data();
+    }
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    TensorDesc workspaceDesc(Precision::I8, {total_size}, Layout::C);
+    auto workspaceAllocator = config.createBlobAllocator();
+    if (workspaceAllocator) {
+        workspaceBlob = make_shared_blob<int8_t>(workspaceDesc, workspaceAllocator);
+        workspaceBlob->allocate();
+        memWorkspace->Create(MKLDNNMemoryDesc(workspaceDesc), workspaceBlob->buffer());
+    } else {
+        workspaceBlob.reset();
+        memWorkspace->Create(MKLDNNMemoryDesc(workspaceDesc));
+    }
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
+                const bool scratch = scratchArena && !persistent[i];
+                int64_t offset = (scratch ? scratchSolver : memSolver)->getOffset(i);
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                edge->allocate((scratch ? reinterpret_cast<int8_t*>(scratchBase) : workspace_ptr) + offset * alignment);  // alignment in byte
                 count++;
             }
         }
@@ -478,13 +1108,51 @@ void MKLDNNGraph::Allocate() {
     for (auto& edge : graphEdges) edge->validate();
 }
 
+void MKLDNNGraph::InitMemoryPairs() {
+    // the edges on the whole buffer of the edge, false if the buffer is shared partially (a view or a graph input or
+    // output which the request can repoint)
+    auto edgesOnBuffer = [&](const MKLDNNEdgePtr &edge, std::vector<MKLDNNEdgePtr> &edges) -> bool {
+        const auto *base = static_cast<const uint8_t *>(edge->getMemory().GetPrimitive().get_data_handle());
+        const size_t size = edge->getMemory().GetSize();
+        for (auto &other : graphEdges) {
+            const auto *ptr = static_cast<const uint8_t *>(other->getMemory().GetPrimitive().get_data_handle());
+            const size_t otherSize = other->getMemory().GetSize();
+            if (ptr + otherSize <= base || base + size <= ptr)
+                continue;
+            if (ptr != base || otherSize != size || other->getParent()->getType() == Input ||
+                    other->getChild()->getType() == Output)
+                return false;
+            edges.push_back(other);
+        }
+        return true;
+    };
+
+    for (auto &node : graphNodes) {
+        auto memoryOutput = std::dynamic_pointer_cast<MKLDNNMemoryOutputNode>(node);
+        if (!memoryOutput || node->getType() != MemoryOutput || !memoryOutput->getInputNode())
+            continue;
+
+        auto producedEdge = node->getParentEdgeAt(0);
+        auto stateEdge = memoryOutput->getChildEdgeAt(0);
+        // the state of the first inference is zero
+        stateEdge->getMemoryPtr()->FillZero();
+
+        if (producedEdge->getDesc() != stateEdge->getDesc() ||
+                producedEdge->getMemory().GetData() == stateEdge->getMemory().GetData())
+            continue;
+        std::vector<MKLDNNEdgePtr> produced, state;
+        if (edgesOnBuffer(producedEdge, produced) && edgesOnBuffer(stateEdge, state))
+            memoryOutput->setPingPongEdges(produced, state);
+    }
+}
+
 void MKLDNNGraph::CreatePrimitives() {
     for (auto& node : graphNodes) {
         node->createPrimitive();
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool normalized) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
@@ -494,8 +1162,26 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
 
+        auto l = in->getTensorDesc().getLayout();
+        auto prec = in->getTensorDesc().getPrecision();
+        auto meanImage = normalized ? _meanImages.end() : _meanImages.find(name);
+        if (meanImage != _meanImages.end() && (prec == Precision::U8 || prec == Precision::I16)) {
+            // the integral input is converted, the mean is subtracted and the layout is changed in one pass
+            const MKLDNNMemory &mem = input->second->getChildEdgeAt(0)->getMemory();
+            if (mem.GetDataType() != memory::f32 || (l != NCHW && l != NHWC) ||
+                    (mem.GetFormat() != memory::nchw && mem.GetFormat() != memory::nhwc))
+                THROW_IE_EXCEPTION << "Mean image of type " << prec.name() << " is unsupported for the layout of input " << name;
+            const Layout memLayout = mem.GetFormat() == memory::nhwc ? NHWC : NCHW;
+            const int batch = std::min<int>(outDims[0], static_cast<int>(in->getTensorDesc().getDims()[0]));
+            float *dst = reinterpret_cast<float *>(inter_data_ptr);
+            if (prec == Precision::U8)
+                meanImage->second.Convert(outDims, in->cbuffer().as<const uint8_t *>(), l, dst, memLayout, batch);
+            else
+                meanImage->second.Convert(outDims, in->cbuffer().as<const int16_t *>(), l, dst, memLayout, batch);
+            return;
+        }
+
         if (ext_data_ptr != inter_data_ptr) {
-            auto l = in->getTensorDesc().getLayout();
             if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
                 l = NCHW;
 
@@ -504,10 +1190,9 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
                     MKLDNNMemory::Convert(l), ext_data_ptr, in->byteSize(), false);
         }
 
-        // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
-            if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
-                _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
+        if (meanImage != _meanImages.end()) {
+            if (prec == InferenceEngine::Precision::FP32) {
+                meanImage->second.Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
                 THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
             }
@@ -565,26 +1250,148 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
     }
 }
 
+void MKLDNNGraph::InitTiledChains() {
+    tiledChains.clear();
+    // a tile passes the primitives split among the threads, so its working set stays within their L2
+    const size_t cacheBudget = static_cast<size_t>(mkldnn_get_cache_size(2, true)) * parallel_get_max_threads() / 2;
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto chain = MKLDNNTiledChain::create(graphNodes[i], cacheBudget);
+        if (!chain)
+            continue;
+        tiledChains[graphNodes[i]->execIndex] = chain;
+        i += chain->getNodes().size() - 1;
+    }
+}
+
+void MKLDNNGraph::InitExecPlan() {
+    execPlan.clear();
+    nodesBatchLim = 0;
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        MKLDNNNode *node = graphNodes[i].get();
+        auto chain = tiledChains.find(static_cast<int>(i));
+        if (chain != tiledChains.end()) {
+            // all the nodes of a chain are kept, they are executed one by one with the dynamic batch
+            const size_t chainSize = chain->second->getNodes().size();
+            execPlan.push_back({node, chain->second.get(), chainSize - 1});
+            for (size_t j = 1; j < chainSize; j++)
+                execPlan.push_back({graphNodes[i + j].get(), nullptr, 0});
+            i += chainSize - 1;
+            continue;
+        }
+        if (!node->isConstant() && node->isExecutable())
+            execPlan.push_back({node, nullptr, 0});
+    }
+}
+
+void MKLDNNGraph::InitTraceLabels() {
+    if (!trace)
+        return;
+
+    inferTraceLabel = trace->addLabel("Infer", "Graph", "");
+    traceLabels.resize(graphNodes.size(), -1);
+    for (auto &node : graphNodes) {
+        std::string name = node->getName();
+        for (auto &fusedNode : node->getFusedWith())
+            name += "+" + fusedNode->getName();
+        traceLabels[node->execIndex] = trace->addLabel(name, node->typeStr, node->getPrimitiveDescriptorType());
+    }
+}
+
+void MKLDNNGraph::RebindScratchArena() {
+    uint8_t *newBase = scratchArena->data();
+    // the edges sharing the memory are repointed once
+    std::map<mkldnn_primitive_t, std::pair<std::shared_ptr<mkldnn::memory>, uint8_t*>> scratchMemory;
+    for (auto &edge : graphEdges) {
+        auto prim = edge->getMemory().GetPrimitivePtr();
+        auto *ptr = static_cast<uint8_t *>(prim->get_data_handle());
+        if (ptr >= scratchBase && ptr < scratchBase + scratchSize)
+            scratchMemory[prim->get()] = {prim, ptr};
+    }
+    for (auto &memory : scratchMemory)
+        memory.second.first->set_data_handle(newBase + (memory.second.second - scratchBase));
+    scratchBase = newBase;
+}
+
 void MKLDNNGraph::Infer(int batch) {
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+    // another graph of the arena has grown it since the last inference
+    if (scratchArena && scratchArena->data() != scratchBase)
+        RebindScratchArena();
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+    // the limit is only set when it changes, the nodes keep what they derive for the limits seen before
+    if (batch > 0 && batch != nodesBatchLim) {
+        for (auto &node : graphNodes)
+            node->setDynamicBatchLim(batch);
+        nodesBatchLim = batch;
+    }
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+#ifndef BLOB_DUMP_PATH
+    // the plain run of the plan, the nodes are measured (and annotated for ITT) with the performance counters
+    if (!config.collectPerfCounters && !trace && (execLevels.empty() || !tiledChains.empty())) {
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        for (size_t i = 0; i < execPlan.size(); i++) {
+            const ExecStep &step = execPlan[i];
+            if (step.chain && batch <= 0) {
+                step.chain->execute(stream);
+                i += step.chainSteps;
+            } else {
+                step.node->execute(stream);
+            }
+        }
+        return;
+    }
+#endif
+
+    MKLDNNTrace::Scope inferScope(trace.get(), inferTraceLabel, streamId);
+
+    auto infer = [&](MKLDNNNode *node, mkldnn::stream &stream) {
+        PERF(node);
+        const int traceLabel = trace ? traceLabels[node->execIndex] : -1;
+        MKLDNNTrace::Scope nodeScope(trace.get(), traceLabel, streamId);
+
+        ENABLE_DUMP(do_before(DUMP_DIR, node));
+        {
+            IE_PROFILING_AUTO_SCOPE_TASK(node->profilingTask)
+            node->execute(stream);
+        }
+        ENABLE_DUMP(do_after(DUMP_DIR, node));
+    };
 
-        if (!graphNodes[i]->isConstant()) {
-            IE_PROFILING_AUTO_SCOPE_TASK(graphNodes[i]->profilingTask)
-            graphNodes[i]->execute(stream);
+#if IE_THREAD == IE_THREAD_TBB
+    if (!execLevels.empty() && tiledChains.empty()) {
+        for (auto &level : execLevels) {
+            if (level.size() == 1) {
+                mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+                infer(level[0].get(), stream);
+                continue;
+            }
+            // the nested parallel regions of the nodes share the threads of the current arena
+            tbb::parallel_for(size_t(0), level.size(), [&](size_t i) {
+                mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+                infer(level[i].get(), stream);
+            });
         }
+        return;
+    }
+#endif
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+    for (size_t i = 0; i < execPlan.size(); i++) {
+        const ExecStep &step = execPlan[i];
+        // the primitives of the tiles are created for the whole batch
+        if (step.chain && batch <= 0) {
+            PERF(step.node);
+            const int traceLabel = trace ? traceLabels[step.node->execIndex] : -1;
+            MKLDNNTrace::Scope nodeScope(trace.get(), traceLabel, streamId);
+            step.chain->execute(stream);
+            i += step.chainSteps;
+            continue;
+        }
+        infer(step.node, stream);
     }
 }
 
@@ -708,6 +1515,11 @@ void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
 
+void MKLDNNGraph::setTrace(const MKLDNNTrace::Ptr &trace, int streamId) {
+    this->trace = trace;
+    this->streamId = streamId;
+}
+
 void MKLDNNGraph::setProperty(const std::map<std::string, std::string>& properties) {
     config.readProperties(properties);
 }
@@ -732,6 +1544,30 @@ void MKLDNNGraph::getOutputBlobs(InferenceEngine::BlobMap &resp) {
     }
 }
 
+constexpr size_t MKLDNNGraph::preferredAlignment;
+
+InferenceEngine::TensorDesc MKLDNNGraph::getPreferredDesc(const std::string& name) {
+    auto input = inputNodes.find(name);
+    if (input != inputNodes.end())
+        return input->second->getChildEdgeAt(0)->getBlob()->getTensorDesc();
+
+    for (auto &output : outputNodes) {
+        if (output->getName() == "out_" + name)
+            return output->getParentEdgeAt(0)->getBlob()->getTensorDesc();
+    }
+    THROW_IE_EXCEPTION << "Cannot find input/output blob: " << name;
+}
+
+bool MKLDNNGraph::isZeroCopyCompatible(const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
+    const InferenceEngine::TensorDesc &desc = blob->getTensorDesc();
+    InferenceEngine::TensorDesc preferred = getPreferredDesc(name);
+    if (desc.getPrecision() != preferred.getPrecision() || desc.getBlockingDesc() != preferred.getBlockingDesc())
+        return false;
+
+    auto ptr = reinterpret_cast<uintptr_t>(blob->cbuffer().as<const void *>());
+    return ptr != 0 && ptr % desc.getPrecision().size() == 0;
+}
+
 void MKLDNNGraph::DropNode(const MKLDNNNodePtr &node) {
     auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
         auto& edges = graph.GetEdges();
@@ -930,14 +1766,99 @@ InferenceEngine::InferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
     if (graphs.size() > 1)  // streams uses special requests that are not connected to graphs
-        return std::make_shared<MKLDNNGraphlessInferRequest>(networkInputs, networkOutputs);
+        return std::make_shared<MKLDNNGraphlessInferRequest>(networkInputs, networkOutputs, config.dynShapesCacheSize > 0,
+                                                             config.createBlobAllocator());
     else
         return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs);
 }
 
+static bool hasBodyCellsToUnroll(const ICNNNetwork &network, const std::function<bool(const RNNCellBase&)> &pred) {
+    for (const auto &layer : CNNNetSortTopologically(network)) {
+        auto ti = std::dynamic_pointer_cast<InferenceEngine::TensorIterator>(layer);
+        if (!ti)
+            continue;
+
+        bool found = false;
+        std::unordered_set<CNNLayer *> visited;
+        for (const auto &input : ti->body.inputs) {
+            for (const auto &consumer : input->getInputTo()) {
+                details::UnorderedDFS(visited, consumer.second, [&](CNNLayerPtr bodyLayer) {
+                    auto rnn = std::dynamic_pointer_cast<RNNCellBase>(bodyLayer);
+                    found |= rnn && pred(*rnn);
+                }, true);
+            }
+        }
+        if (found)
+            return true;
+    }
+    return false;
+}
+
+// The per channel mean values of an input consumed by a single unpadded convolution are folded into the biases of
+// the convolution, conv(x - mean) = conv(x) - conv(mean), so the input is converted by the reorder of the convolution
+// without the separate subtraction pass (and U8 inputs are not converted to FP32 on the host)
+static void foldInputMeanValues(ICNNNetwork &network) {
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    for (const auto &input : inputs) {
+        PreProcessInfo &pp = input.second->getPreProcess();
+        const size_t channels = pp.getNumberOfChannels();
+        if (channels == 0 || pp.getMeanVariant() != MEAN_VALUE)
+            continue;
+        bool unitScales = true;
+        for (size_t c = 0; c < channels; c++)
+            unitScales &= pp[c]->stdScale == 1.0f;
+        if (!unitScales)
+            continue;
+
+        DataPtr data = input.second->getInputData();
+        if (data->getTensorDesc().getDims().size() != 4 || data->getInputTo().size() != 1)
+            continue;
+        auto conv = std::dynamic_pointer_cast<ConvolutionLayer>(data->getInputTo().begin()->second);
+        if (!conv || conv->insData.size() != 1 || conv->_group != 1 || conv->precision != Precision::FP32 ||
+                !conv->_weights || conv->_weights->precision() != Precision::FP32 ||
+                !(conv->_auto_pad.empty() || conv->_auto_pad == "valid"))
+            continue;
+        bool padded = false;
+        for (size_t i = 0; i < conv->_padding.size(); i++)
+            padded |= conv->_padding[i] != 0;
+        for (size_t i = 0; i < conv->_pads_end.size(); i++)
+            padded |= conv->_pads_end[i] != 0;
+        const size_t outChannels = conv->_out_depth;
+        if (padded || outChannels == 0 || conv->_weights->size() % (outChannels * channels) != 0 ||
+                (conv->_biases && (conv->_biases->precision() != Precision::FP32 || conv->_biases->size() != outChannels)))
+            continue;
+
+        // the weights may be shared with the original network, so the biases are replaced rather than modified
+        const size_t kernelSize = conv->_weights->size() / (outChannels * channels);
+        const float *weights = conv->_weights->cbuffer().as<const float *>();
+        auto biases = make_shared_blob<float>(TensorDesc(Precision::FP32, {outChannels}, Layout::C));
+        biases->allocate();
+        float *dst = biases->data();
+        for (size_t o = 0; o < outChannels; o++) {
+            float shift = 0.0f;
+            for (size_t c = 0; c < channels; c++) {
+                const float *w = weights + (o * channels + c) * kernelSize;
+                float sum = 0.0f;
+                for (size_t k = 0; k < kernelSize; k++)
+                    sum += w[k];
+                shift += sum * pp[c]->meanValue;
+            }
+            dst[o] = (conv->_biases ? conv->_biases->cbuffer().as<const float *>()[o] : 0.0f) - shift;
+        }
+        conv->_biases = biases;
+        conv->blobs["biases"] = biases;
+
+        pp.init(0);
+    }
+}
+
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
-                                     const MKLDNNExtensionManager::Ptr& extMgr) : extensionManager(extMgr) {
+                                     const MKLDNNExtensionManager::Ptr& extMgr) : extensionManager(extMgr), config(cfg) {
+    // the graphs of the streams are created in the stream threads, they record their phases to the same report
+    LoadPhaseReport *loadPhases = LoadPhaseReport::current();
+    std::unique_ptr<LoadPhaseScope> transformations(new LoadPhaseScope("NetworkTransformations", loadPhases));
     ICNNNetworkStats* pstats = nullptr;
     StatusCode s = network.getStats(&pstats, nullptr);
     // we are cloning network if we have statistics and we can transform network.
@@ -948,8 +1869,8 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         cnnorm.NormalizeNetwork(*clonedNetwork, *pstats);
     }
 
-    bool ti_proc_ok = !NetPass::CombineRNNSeq(*clonedNetwork) ? NetPass::UnrollTI(*clonedNetwork) : true;
-    ti_proc_ok &= NetPass::UnrollRNN_if(*clonedNetwork, [] (RNNCellBase rnn) -> bool {
+    // the cells not supported by the RNN primitive are unrolled into the primitives of their gates
+    auto unrollCell = [] (const RNNCellBase &rnn) -> bool {
         if (rnn.clip != 0.0f)
             return true;
         if ((rnn.cellType == RNNCellBase::GRU || rnn.cellType == RNNCellBase::GRU_LBR) &&
@@ -959,11 +1880,19 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                 rnn.activations != std::vector<std::string> {"sigmoid", "tanh", "tanh"})
             return true;
         return false;
-    });
+    };
+    // the TensorIterators which are not converted to the RNN sequences are executed by the TensorIterator node,
+    // except for the bodies with such cells, since they can be unrolled only in the network
+    bool ti_proc_ok = true;
+    if (!NetPass::CombineRNNSeq(*clonedNetwork) && hasBodyCellsToUnroll(*clonedNetwork, unrollCell))
+        ti_proc_ok = NetPass::UnrollTI(*clonedNetwork);
+    ti_proc_ok &= NetPass::UnrollRNN_if(*clonedNetwork, unrollCell);
     if (!ti_proc_ok)
         THROW_IE_EXCEPTION << "Plugin doesn't support Tensor Iterator in pure form. "
                               "None TI optimization pattern has been applied successfully";
 
+    foldInputMeanValues(*clonedNetwork);
+    transformations.reset();
 
     if (cfg.batchLimit > 1) {
         // check topology for applicability
@@ -976,45 +1905,127 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     // general #threads logic
     const int env_threads = parallel_get_env_threads();
     // for streams need all (logical) cores, while single-stream case just physical cores (better for servers), as usual
-    const int hw_cores = cfg.throughputStreams > 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
-    const int threads = cfg.threadsNum ? cfg.threadsNum : (env_threads ? env_threads : hw_cores);
-    const int threads_per_stream = std::max(1, threads/cfg.throughputStreams);
+    const bool bStreams = config.throughputStreams > 1 || config.autoThroughputStreams;
+    const int hw_cores = bStreams ? parallel_get_max_threads() : getNumberOfCPUCores();
+    int threads = config.threadsNum ? config.threadsNum : (env_threads ? env_threads : hw_cores);
+    // the process-wide limit is shared with the other plugins and networks
+    const int threads_limit = static_cast<int>(ExecutorManager::getInstance()->getThreadsLimit());
+    if (threads_limit > 0)
+        threads = std::min(threads, threads_limit);
+    if (config.autoThroughputStreams) {
+        // the choice is kept in the config, so the exported network is imported with the same streams
+        config.throughputStreams = get_auto_streams_config(*clonedNetwork, threads).streams;
+        config.autoThroughputStreams = false;
+        if (config.throughputStreams == 1 && threads == hw_cores)
+            threads = getNumberOfCPUCores();
+    }
+    const int threads_per_stream = std::max(1, threads/config.throughputStreams);
+    threadsPerStream = threads_per_stream;
+    // the pinned streams of a hybrid CPU are placed by the core types, with the thread counts of their cores
+    std::vector<std::vector<int>> streams_cpus;
+    if (bPinningRequested)
+        streams_cpus = get_hybrid_streams_cpus(config.throughputStreams, threads_per_stream, get_core_types());
+    if (!streams_cpus.empty())
+        threadsPerStream = streams_cpus[0].size();
+    // the pinned streams spread over several NUMA nodes keep a copy of the weights per node
+    const int numa_nodes = bPinningRequested ? get_num_numa_nodes() : 1;
+    const bool bNumaReplication = config.throughputStreams > 1 && numa_nodes > 1;
+
+    if (!config.traceFile.empty())
+        trace = std::make_shared<MKLDNNTrace>(config.traceBufferSize);
+
+    if (config.callbackThreads > 0) {
+        // slow callbacks of one request don't delay the callbacks of the others
+        _callbackExecutor = ExecutorManager::getInstance()->getThreadPoolExecutor("CPU callbacks", config.callbackThreads);
+    }
 
     // graph(s) initialization in taskExecutor threads (streams), in parallel (in case of streams)
     std::vector<Task::Ptr> tasks;
 
-    for (int n = 0; n < cfg.throughputStreams; n++) {
+    for (int n = 0; n < config.throughputStreams; n++) {
         MKLDNNGraph::Ptr _graph = std::make_shared<MKLDNNGraph>();
         graphs.push_back(_graph);
-        auto task = std::make_shared<InferenceEngine::Task>([=, &cfg, &network]() {
-            _graph->CreateArena(threads_per_stream);
+        auto task = std::make_shared<InferenceEngine::Task>([=, &network]() {
+            LoadPhaseReport::Binding loadBinding(loadPhases);
+            const std::vector<int> cpus = streams_cpus.empty() ? std::vector<int>() : streams_cpus[n];
+            const int stream_threads = cpus.empty() ? threads_per_stream : static_cast<int>(cpus.size());
+            _graph->CreateArena(stream_threads);
 
             if (bPinningRequested) {
-                _graph->CreateObserver(n, threads_per_stream);
+                _graph->CreateObserver(n, stream_threads, 1, cpus);
             }
 
-            _graph->setConfig(cfg);
-            _graph->CreateGraph(*clonedNetwork, extensionManager);
-            if (cfg.throughputStreams > 1)  // for streams, each worker thread has it's own graph
-                MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext.ptrGraph = _graph;
+            _graph->setConfig(config);
+            _graph->setTrace(trace, n);
+            // the graph is created by the (pinned) stream threads, so the memory of the weights and the intermediate
+            // buffers is first touched (hence placed) on the NUMA node of the stream; the weights are then shared
+            // between the streams of the same node only
+            MultiWorkerTaskContext& context = MKLDNNPlugin::MultiWorkerTaskExecutor::ptrContext;
+            auto create = [&] {
+                context.numaNode = bNumaReplication ? get_current_numa_node() : -1;
+                _graph->CreateGraph(*clonedNetwork, extensionManager);
+            };
+#if IE_THREAD == IE_THREAD_TBB
+            // the thread gets pinned when entering the arena
+            auto_scope_observing observer(_graph->ptrObserver);
+            _graph->ptrArena->execute(create);
+#else
+            // CreateObserver has already pinned this thread with the first thread of the stream
+            create();
+#endif
+            if (config.throughputStreams > 1)  // for streams, each worker thread has it's own graph
+                context.ptrGraph = _graph;
         });
         tasks.push_back(task);
     }
 
-    if (cfg.throughputStreams > 1) {
+    if (config.throughputStreams > 1) {
         // special executor with as many threads as requested #streams, each with it's own initialization task
-        _taskExecutor = std::make_shared<MultiWorkerTaskExecutor>(tasks);
+        // the pinned streams are spread over the NUMA nodes, so the idle streams prefer stealing from the same node
+        _taskExecutor = std::make_shared<MultiWorkerTaskExecutor>(tasks, "CPU streams", numa_nodes,
+                                                                  config.spinWaitMicros);
+        _metrics = std::make_shared<MetricsRegistry>(config.throughputStreams);
     } else {
-        if (cfg.exclusiveAsyncRequests) {
+        if (config.exclusiveAsyncRequests) {
             // special case when all InferRequests are muxed into a single queue
             ExecutorManager *executorManager = ExecutorManager::getInstance();
             _taskExecutor = executorManager->getExecutor(TargetDeviceInfo::name(TargetDevice::eCPU));
+        } else if (config.spinWaitMicros > 0) {
+            _taskExecutor = std::make_shared<TaskExecutor>("CPU", config.spinWaitMicros);
         }
         _taskExecutor->startTask(tasks[0]);
         Task::Status sts = tasks[0]->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
     }
     for (auto t : tasks)
         t->checkException();
+    transformedNetwork = clonedNetwork;
+}
+
+std::map<std::string, InferenceEngineMetricInfo> MKLDNNExecNetwork::GetMetrics() {
+    auto metrics = ExecutableNetworkThreadSafeDefault::GetMetrics();
+    // the streams the network runs with, including the ones chosen by the CPU_THROUGHPUT_AUTO
+    InferenceEngineMetricInfo streams;
+    streams.count = graphs.size();
+    metrics["Streams"] = streams;
+    InferenceEngineMetricInfo threads;
+    threads.count = threadsPerStream;
+    metrics["ThreadsPerStream"] = threads;
+    InferenceEngineMetricInfo chains;
+    chains.count = graphs.empty() ? 0 : graphs[0]->tiledChains.size();
+    metrics["DepthFirstChains"] = chains;
+    return metrics;
+}
+
+void MKLDNNExecNetwork::writeTrace() const {
+    if (!trace)
+        return;
+    // called from the destructor, so the trace is lost rather than the exception is thrown
+    try {
+        std::ofstream os(config.traceFile);
+        if (os.is_open())
+            trace->exportChromeTrace(os);
+    } catch (...) {
+    }
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -1025,8 +2036,10 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    syncRequestImpl->setMetricsRegistry(_metrics);
     auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor,
                                                                       _taskSynchronizer, _callbackExecutor);
+    asyncRequestImpl->setWaitSpin(config.spinWaitMicros);
     asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncRequestImpl),
                        [](IInferRequest *p) { p->Release(); });
 
@@ -1042,4 +2055,69 @@ void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &
 
 void MKLDNNExecNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) {
     graphPtr = graphs[0]->dump();
+}
+
+std::vector<IMemoryStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
+    std::vector<IMemoryStateInternal::Ptr> states;
+    if (graphs.empty())
+        return states;
+
+    for (auto &node : graphs[0]->GetNodes()) {
+        auto rnn = std::dynamic_pointer_cast<MKLDNNRNN>(node);
+        if (!rnn || !rnn->hasPersistentState())
+            continue;
+
+        // the same node of the graphs of all the streams
+        std::vector<std::shared_ptr<MKLDNNRNN>> nodes;
+        for (auto &graph : graphs) {
+            for (auto &streamNode : graph->GetNodes()) {
+                if (streamNode->getName() == node->getName())
+                    nodes.push_back(std::dynamic_pointer_cast<MKLDNNRNN>(streamNode));
+            }
+        }
+        states.push_back(std::make_shared<MKLDNNRNNMemoryState>(node->getName(), nodes));
+    }
+
+    for (auto &node : graphs[0]->GetNodes()) {
+        auto memoryInput = std::dynamic_pointer_cast<MKLDNNMemoryInputNode>(node);
+        if (!memoryInput || node->getType() != MemoryInput)
+            continue;
+
+        std::vector<MKLDNNNodePtr> nodes;
+        for (auto &graph : graphs) {
+            for (auto &streamNode : graph->GetNodes()) {
+                if (streamNode->getName() == node->getName())
+                    nodes.push_back(streamNode);
+            }
+        }
+        // the state is named by the id of the Memory layers
+        states.push_back(std::make_shared<MKLDNNMemoryNodeState>(memoryInput->getId(), nodes));
+    }
+    return states;
+}
+
+void MKLDNNExecNetwork::Export(const std::string &modelFileName) {
+    auto network = cloneNet(*transformedNetwork);
+
+    // the implementations selected by the graph are pinned, so the imported graph makes the same choice
+    for (auto &node : graphs[0]->GetNodes()) {
+        const std::string implType = node->getPrimitiveDescriptorType();
+        if (implType == "unknown" || implType == "undef")
+            continue;
+        CNNLayerPtr layer;
+        if (network->getLayerByName(node->getName().c_str(), layer, nullptr) != StatusCode::OK || !layer)
+            continue;
+        if (layer->params.find("PrimitivesPriority") == layer->params.end())
+            layer->params["PrimitivesPriority"] = "cpu:" + implType;
+    }
+
+    // the statistics are already applied by the INT8 normalization
+    ICNNNetworkStats* pstats = nullptr;
+    if (network->getStats(&pstats, nullptr) == StatusCode::OK && pstats)
+        pstats->setNodesStats({});
+
+    std::ofstream os(modelFileName, std::ios::out | std::ios::binary);
+    if (!os.is_open())
+        THROW_IE_EXCEPTION << "Cannot open file " << modelFileName << " for the export";
+    MKLDNNModelSerial::Export(os, *network, config, _networkInputs, _networkOutputs);
 }
\ No newline at end of file
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <map>
+#include <list>
 #include <string>
+#include <utility>
 #include <vector>
 #include <memory>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
@@ -20,6 +22,10 @@
 #include "mkldnn_edge.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_streams.h"
+#include "mkldnn_trace.h"
+#include "mkldnn_tiled_chain.h"
+#include "mkldnn_request_blobs.h"
+#include "mkldnn_scratch_arena.h"
 
 namespace MKLDNNPlugin {
 
@@ -43,23 +49,68 @@ public:
     }
 
     void setConfig(const Config &cfg);
+    void setTrace(const MKLDNNTrace::Ptr &trace, int streamId);
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty();
 
     void getInputBlobs(InferenceEngine::BlobMap &in_map);
     void getOutputBlobs(InferenceEngine::BlobMap &out_map);
 
+    /**
+     * @brief The alignment of the graph memory, the user buffers aligned the same way are processed faster by the
+     * primitives which read the inputs or write the outputs directly
+     */
+    static constexpr size_t preferredAlignment = 64;
+
+    /**
+     * @brief Provides the desc of the user blob which the memory of the input or output can be bound to instead of
+     * copying the data in PushInputData and PullOutputData
+     */
+    InferenceEngine::TensorDesc getPreferredDesc(const std::string& name);
+
+    /**
+     * @brief Checks that the blob has the precision and the blocking desc of the input or output memory and the
+     * element aligned buffer, so the memory can be bound to the blob
+     */
+    bool isZeroCopyCompatible(const std::string& name, const InferenceEngine::Blob::Ptr& blob);
+
     void CreateGraph(const InferenceEngine::ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
 
+    /**
+     * @brief Creates the graph of the TensorIterator body, the body inputs are the Input nodes named by their data
+     * and the body outputs are the "out_" Output nodes, the same as for the network
+     */
+    void CreateGraph(const InferenceEngine::TensorIterator::Body &body, const MKLDNNExtensionManager::Ptr& extMgr);
+
     bool hasMeanImageFor(const std::string& name) {
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * @brief Copies the input blob to the graph input, the mean image of the input is skipped when the blob was
+     * already normalized by the pre-processing
+     */
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool normalized = false);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(int batch = -1);
 
+    /**
+     * @brief Provides the graph for the dims of the input blobs.
+     * The graphs of the input shapes other than the loaded one are created from the reshaped network on the first
+     * request and kept in the LRU cache of Config::dynShapesCacheSize graphs. Only the spatial dims may differ,
+     * they are bounded by the dims the network was loaded with.
+     * @return this graph or the graph from the cache, which is owned by this graph
+     */
+    MKLDNNGraph* getGraphForShapes(const InferenceEngine::BlobMap &inputs);
+
+    /**
+     * @brief Replaces the output blobs which dims differ from the graph outputs by the ones of the request blobs
+     * and updates the dims of the corresponding network outputs, so the blobs pass the checks of the infer request
+     */
+    void reshapeOutputBlobs(InferenceEngine::BlobMap &outputs, InferenceEngine::OutputsDataMap &networkOutputs,
+                            RequestBlobs &requestBlobs);
+
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
     }
@@ -72,6 +123,10 @@ public:
         return outputNodes;
     }
 
+    std::map<std::string, MKLDNNNodePtr>& GetInputNodes() {
+        return inputNodes;
+    }
+
     mkldnn::engine getEngine() const {
         return eng;
     }
@@ -90,22 +145,32 @@ public:
         #endif
     }
 
-    void CreateObserver(int _stream_id, int _threads_per_stream, int _pinning_step = 1) {
+    /* cpus are the CPUs the stream is placed on by the core types, the streams are pinned round-robin without them */
+    void CreateObserver(int _stream_id, int _threads_per_stream, int _pinning_step = 1,
+                        const std::vector<int>& cpus = {}) {
         #if IE_THREAD == IE_THREAD_TBB
         ptrObserver
                 = std::unique_ptr<tbb::task_scheduler_observer>(
-                new pinning_observer(*ptrArena.get(), _stream_id, _threads_per_stream, _pinning_step));
+                new pinning_observer(*ptrArena.get(), _stream_id, _threads_per_stream, _pinning_step, cpus));
         #else
         cpu_set_t *process_mask = nullptr;
         int ncpus = 0;
         get_process_mask(ncpus, process_mask);
             #if IE_THREAD == IE_THREAD_OMP
-            #pragma omp parallel for
-                    for (int thread_index = 0; thread_index < _threads_per_stream; thread_index++) {
-                        pin_thread_to_vacant_core(_stream_id * _threads_per_stream + thread_index, 1, ncpus, process_mask);
+            // every thread of the team pins itself by its number, so the calling (master) thread takes the first slot
+            #pragma omp parallel num_threads(_threads_per_stream)
+                    {
+                        const int thread_index = omp_get_thread_num();
+                        if (!cpus.empty())
+                            pin_current_thread_to_cpu(cpus[thread_index % cpus.size()]);
+                        else
+                            pin_thread_to_vacant_core(_stream_id * _threads_per_stream + thread_index, 1, ncpus, process_mask);
                     }
             #elif IE_THREAD == IE_THREAD_SEQ
-            pin_thread_to_vacant_core(_stream_id * _threads_per_stream, 1, ncpus, process_mask);
+            if (!cpus.empty())
+                pin_current_thread_to_cpu(cpus[0]);
+            else
+                pin_thread_to_vacant_core(_stream_id * _threads_per_stream, 1, ncpus, process_mask);
             #endif
         CPU_FREE(process_mask);
         #endif
@@ -125,20 +190,60 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        execLevels.clear();
+        tiledChains.clear();
+        execPlan.clear();
+        nodesBatchLim = 0;
         _meanImages.clear();
+        shapesNetwork.reset();
+        shapesExtensionManager.reset();
+        shapeGraphs.clear();
+        traceLabels.clear();
     }
     Status status;
     Config config;
 
     MKLDNNMemoryPtr memWorkspace;
+    // owns the workspace memory when it comes from the configured allocator
+    InferenceEngine::Blob::Ptr workspaceBlob;
+    // the intermediate edges are placed in [scratchBase, scratchBase + scratchSize) of the arena (Config::scratchArena)
+    MKLDNNScratchArena::Ptr scratchArena;
+    uint8_t *scratchBase = nullptr;
+    size_t scratchSize = 0;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
+    // non-constant nodes grouped by execLevel, empty if the graph is executed sequentially
+    std::vector<std::vector<MKLDNNNodePtr>> execLevels;
+    // the chains executed depth-first (Config::depthFirst), indexed by the execIndex of the first node of a chain
+    std::map<int, MKLDNNTiledChain::Ptr> tiledChains;
+
+    // a step of the sequential execution: a node, or the tiled chain starting at it and its chainSteps next steps
+    struct ExecStep {
+        MKLDNNNode *node;
+        MKLDNNTiledChain *chain;
+        size_t chainSteps;
+    };
+    // the nodes doing work in the execution order, without the constant and the in-place ones (InitExecPlan)
+    std::vector<ExecStep> execPlan;
+    // the dynamic batch limit last set to the nodes
+    int nodesBatchLim = 0;
 
     std::map<std::string, MeanImage> _meanImages;
 
+    // the graphs of the other input shapes are created from that network, the most recently used is the first
+    InferenceEngine::ICNNNetwork::Ptr shapesNetwork;
+    MKLDNNExtensionManager::Ptr shapesExtensionManager;
+    std::list<std::pair<std::string, MKLDNNGraph::Ptr>> shapeGraphs;
+
+    // the spans of the inferences and of the nodes (indexed by execIndex) are recorded if the tracing is enabled
+    MKLDNNTrace::Ptr trace;
+    int streamId = 0;
+    int inferTraceLabel = -1;
+    std::vector<int> traceLabels;
+
     #if IE_THREAD == IE_THREAD_TBB
     std::unique_ptr<tbb::task_arena> ptrArena;
     std::unique_ptr<tbb::task_scheduler_observer> ptrObserver;
@@ -146,18 +251,48 @@ protected:
     mkldnn::engine eng;
 
     void Replicate(const ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
+    void Replicate(const InferenceEngine::TensorIterator::Body &body, const MKLDNNExtensionManager::Ptr& extMgr);
     void InitGraph();
     void InitNodes();
+    /**
+     * @brief Puts the implementations of the tuning file (Config::tuningMode) first in the priorities of the
+     * convolutions, deconvolutions and fully connected nodes, timing the nodes missing from the file in CREATE mode
+     */
+    void TuneNodes();
+    /**
+     * @brief Refines the greedy choice of the primitive descriptors of the nodes to minimize the total size of the
+     * reorders over the graph: dynamic programming on the chains, then local improvements of the forks and joins.
+     * Only the descriptors of the already selected implementation type are considered.
+     */
+    void MinimizeReorders();
     void InitEdges();
+    void InitExecLevels();
     void Allocate();
     void AllocateWithReuse();
+    /**
+     * @brief Repoints the scratch edges to the arena moved by the growth for another graph
+     */
+    void RebindScratchArena();
+    /**
+     * @brief Lets the memory layers swap the buffers of the produced state and of the current state after every
+     * inference, if both buffers are whole and of the same layout, otherwise the new state is copied
+     */
+    void InitMemoryPairs();
     void CreatePrimitives();
+    /**
+     * @brief Finds the chains of the spatially local nodes whose intermediate tensors outgrow the caches of
+     * the threads and plans their depth-first execution by the tiles of rows
+     */
+    void InitTiledChains();
+    void InitExecPlan();
+    void InitTraceLabels();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
+    friend class MKLDNNExecNetwork;
     friend std::shared_ptr<InferenceEngine::ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph);
 
 private:
@@ -183,6 +318,7 @@ public:
                       const MKLDNNExtensionManager::Ptr& extMgr);
 
     ~MKLDNNExecNetwork() {
+        writeTrace();
         graphs.clear();
         extensionManager.reset();
     }
@@ -191,11 +327,30 @@ public:
 
     void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
 
+    /**
+     * @brief The states of the RNN sequences if they are kept between the inferences (Config::rnnPersistentState)
+     */
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
+
+    void Export(const std::string &modelFileName) override;
+
+    /**
+     * @brief The metrics of the requests and the load, with the "Streams" and "ThreadsPerStream" the network runs with
+     */
+    std::map<std::string, InferenceEngine::InferenceEngineMetricInfo> GetMetrics() override;
+
 protected:
     std::vector<MKLDNNGraph::Ptr> graphs;
     MKLDNNExtensionManager::Ptr extensionManager;
+    // the network after the front-end transformations, it is kept for the export
+    InferenceEngine::ICNNNetwork::Ptr transformedNetwork;
+    Config config;
+    // shared by the graphs of all the streams, nullptr if the tracing is disabled
+    MKLDNNTrace::Ptr trace;
+    int threadsPerStream = 1;
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
+    void writeTrace() const;
 };
 
 }  // namespace MKLDNNPlugin
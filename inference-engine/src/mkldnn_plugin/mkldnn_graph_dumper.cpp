@@ -28,12 +28,20 @@ using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
-static void copy_node_metadata(const MKLDNNNodePtr &, CNNLayer::Ptr &);
+// the memory the edges of the graph are placed in, the outputs of a node are reported relative to it
+struct MemoryRegions {
+    const uint8_t *workspace = nullptr;
+    size_t workspaceSize = 0;
+    const uint8_t *scratch = nullptr;
+    size_t scratchSize = 0;
+};
+
+static void copy_node_metadata(const MemoryRegions &, const MKLDNNNodePtr &, CNNLayer::Ptr &);
 static void drawer_callback(const InferenceEngine::CNNLayerPtr, ordered_properties &, ordered_properties &);
 
-CNNLayer::Ptr convert_node(const MKLDNNNodePtr &node) {
+CNNLayer::Ptr convert_node(const MemoryRegions &regions, const MKLDNNNodePtr &node) {
     CNNLayer::Ptr layer(new CNNLayer({"name", "type", Precision::FP32}));
-    copy_node_metadata(node, layer);
+    copy_node_metadata(regions, node, layer);
 
     auto &cfg = node->getSelectedPrimitiveDescriptor()->getConfig();
     layer->insData.resize(cfg.inConfs.size());
@@ -49,9 +57,17 @@ std::shared_ptr<ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph) {
     net->setName("runtime_cpu_graph");
     std::map<MKLDNNNodePtr, CNNLayerPtr> node2layer;
 
+    MemoryRegions regions;
+    if (graph.memWorkspace) {
+        regions.workspace = static_cast<const uint8_t *>(graph.memWorkspace->GetData());
+        regions.workspaceSize = graph.memWorkspace->GetSize();
+    }
+    regions.scratch = graph.scratchBase;
+    regions.scratchSize = graph.scratchSize;
+
     // Copy all nodes to network
     for (auto &node : graph.graphNodes) {
-        auto layer = convert_node(node);
+        auto layer = convert_node(regions, node);
         node2layer[node] = layer;
         net->addLayer(layer);
     }
@@ -145,7 +161,7 @@ static std::map<Type, std::string> type_n2l {
 static const char BLUE[]  = "#D8D9F1";
 static const char GREEN[] = "#D9EAD3";
 
-void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
+void copy_node_metadata(const MemoryRegions &memory, const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
     layer->type = type_n2l[node->getType()];
     layer->name = node->getName();  // Is ID
 
@@ -178,6 +194,47 @@ void copy_node_metadata(const MKLDNNNodePtr &node, CNNLayer::Ptr &layer) {
     } else {
         layer->params[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
+
+    // Execution
+    std::string mode = "executed";
+    if (node->isConstant())
+        mode = "constant";
+    else if (!node->isExecutable())
+        mode = "skipped";
+    layer->params[ExecGraphInfoSerialization::EXECUTION_MODE] = mode;
+    layer->params[ExecGraphInfoSerialization::IN_PLACE] = node->isInplace() ? "true" : "false";
+
+    // Memory placement of the outputs, the edges of a port share the memory
+    std::string regions, offsets, sizes;
+    for (size_t port = 0; port < desc->getConfig().outConfs.size(); port++) {
+        MKLDNNEdgePtr edge;
+        for (size_t i = 0; i < node->getChildEdges().size() && !edge; i++) {
+            if (node->getChildEdgeAt(i)->getInputNum() == static_cast<int>(port))
+                edge = node->getChildEdgeAt(i);
+        }
+        if (!edge || !edge->getMemoryPtr() || (edge->getStatus() != MKLDNNEdge::Status::Allocated &&
+                                               edge->getStatus() != MKLDNNEdge::Status::Validated))
+            continue;
+
+        const uint8_t *data = static_cast<const uint8_t *>(edge->getMemory().GetData());
+        std::string region = "external", offset = "-";
+        if (memory.workspace && data >= memory.workspace && data < memory.workspace + memory.workspaceSize) {
+            region = "workspace";
+            offset = std::to_string(data - memory.workspace);
+        } else if (memory.scratch && data >= memory.scratch && data < memory.scratch + memory.scratchSize) {
+            region = "scratch";
+            offset = std::to_string(data - memory.scratch);
+        }
+        const char *separator = regions.empty() ? "" : ",";
+        regions += separator + region;
+        offsets += separator + offset;
+        sizes += separator + std::to_string(edge->getMemory().GetSize());
+    }
+    if (!regions.empty()) {
+        layer->params[ExecGraphInfoSerialization::OUTPUT_MEMORY_REGIONS] = regions;
+        layer->params[ExecGraphInfoSerialization::OUTPUT_MEMORY_OFFSETS] = offsets;
+        layer->params[ExecGraphInfoSerialization::OUTPUT_MEMORY_SIZES] = sizes;
+    }
 }
 
 void drawer_callback(const InferenceEngine::CNNLayerPtr layer,
@@ -9,8 +9,10 @@
 #include "nodes/mkldnn_pooling_node.h"
 #include "nodes/mkldnn_eltwise_node.h"
 #include "nodes/mkldnn_depthwise_node.h"
+#include "nodes/mkldnn_power_node.h"
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
+#include "nodes/mkldnn_generic_node.h"
 
 #include <string>
 #include <list>
@@ -28,6 +30,9 @@ using namespace InferenceEngine;
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
 void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
+    FoldSpaceToDepthIntoConvolution(graph);
+    graph.RemoveDroppedNodes();
+
     MergeGroupConvolution(graph);
     graph.RemoveDroppedNodes();
 
@@ -52,12 +57,26 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseFullyConnectedAndActivation(graph);
     graph.RemoveDroppedNodes();
 
+    FuseDeconvolutionAndActivation(graph);
+    graph.RemoveDroppedNodes();
+
     RemoveIdentityOperator(graph);
     graph.RemoveDroppedNodes();
 
+    DropBroadcastingTiles(graph);
+    graph.RemoveDroppedNodes();
+
     FuseConvolutionSumAndConvolutionSumActivation(graph);
     graph.RemoveDroppedNodes();
 
+    FuseElementwiseChains(graph);
+    graph.RemoveDroppedNodes();
+
+    FuseProducerAndQuantize(graph);
+    graph.RemoveDroppedNodes();
+
+    FuseNormalizationAndScaleShift(graph);
+    graph.RemoveDroppedNodes();
 
     graph.RemoveDroppedEdges();
 }
@@ -73,6 +92,90 @@ void MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations(MKLDNNGraph &grap
     graph.RemoveDroppedEdges();
 }
 
+void MKLDNNGraphOptimizer::FoldSpaceToDepthIntoConvolution(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // SpaceToDepth of a single channel image moves the block_size x block_size pixel blocks into the channels,
+    // the channel (by * block_size + bx) at (h, w) is the pixel (h * block_size + by, w * block_size + bx).
+    // The unit stride convolution of such a tensor is the convolution of the image itself with the block_size
+    // stride, the block_size times larger kernel and paddings, and the weights of the channels moved back to the
+    // pixels of the kernel
+    auto isSutableSpaceToDepth = [](MKLDNNNodePtr node) {
+        if (node->getType() != Generic || !node->getCnnLayer() || node->getCnnLayer()->type != "SpaceToDepth")
+            return false;
+        if (node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1 || node->inDims.empty())
+            return false;
+        const MKLDNNDims& inDims = node->inDims[0];
+        return node->getCnnLayer()->precision == Precision::FP32 && inDims.ndims() == 4 && inDims[1] == 1;
+    };
+
+    auto isSutableConvolution = [](MKLDNNNodePtr node, size_t channels) {
+        if (node->getType() != Convolution || node->getParentEdges().size() != 1)
+            return false;
+        auto* conv = dynamic_cast<ConvolutionLayer*>(node->getCnnLayer().get());
+        if (!conv || conv->_group != 1 || conv->_kernel.size() != 2 || conv->precision != Precision::FP32 ||
+                !conv->_weights || conv->_weights->precision() != Precision::FP32 ||
+                conv->_weights->size() != conv->_out_depth * channels * conv->_kernel[X_AXIS] * conv->_kernel[Y_AXIS])
+            return false;
+        for (size_t i = 0; i < conv->_kernel.size(); i++) {
+            if (conv->_stride[i] != 1 || conv->_dilation[i] != 1)
+                return false;
+        }
+        return true;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto spaceToDepth = graphNodes[i];
+        if (!isSutableSpaceToDepth(spaceToDepth)) continue;
+
+        const size_t block = spaceToDepth->getCnnLayer()->GetParamAsUInt("block_size", 1);
+        auto conv = spaceToDepth->getChildEdgeAt(0)->getChild();
+        if (block < 2 || !isSutableConvolution(conv, block * block)) continue;
+
+        auto* convLayer = dynamic_cast<ConvolutionLayer*>(conv->getCnnLayer().get());
+        auto paddings = getPaddings(*convLayer);
+        const size_t OC = convLayer->_out_depth;
+        const size_t KH = convLayer->_kernel[Y_AXIS];
+        const size_t KW = convLayer->_kernel[X_AXIS];
+
+        // the layer is shared with the graphs of the other streams, so the node gets its own copy
+        auto layer = std::make_shared<ConvolutionLayer>(*convLayer);
+        layer->insData[0] = spaceToDepth->getCnnLayer()->insData[0];
+        layer->params.erase("auto_pad");
+        layer->_auto_pad.clear();
+        for (size_t axis : {X_AXIS, Y_AXIS}) {
+            layer->_kernel.insert(axis, convLayer->_kernel[axis] * block);
+            layer->_stride.insert(axis, block);
+            layer->_padding.insert(axis, paddings.begin[axis] * block);
+            if (paddings.end.size())
+                layer->_pads_end.insert(axis, paddings.end[axis] * block);
+        }
+
+        Blob::Ptr weights = make_blob_with_precision(convLayer->_weights->getTensorDesc());
+        weights->allocate();
+        const float *src = convLayer->_weights->cbuffer().as<const float *>();
+        float *dst = weights->buffer().as<float *>();
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t by = 0; by < block; by++) {
+                for (size_t bx = 0; bx < block; bx++) {
+                    for (size_t ky = 0; ky < KH; ky++) {
+                        for (size_t kx = 0; kx < KW; kx++) {
+                            dst[(oc * KH * block + ky * block + by) * KW * block + kx * block + bx] =
+                                    src[((oc * block * block + by * block + bx) * KH + ky) * KW + kx];
+                        }
+                    }
+                }
+            }
+        }
+        layer->_weights = weights;
+        layer->blobs["weights"] = weights;
+
+        conv->cnnLayer = layer;
+        conv->inDims[0] = spaceToDepth->inDims[0];
+        graph.DropNode(spaceToDepth);
+    }
+}
+
 void MKLDNNGraphOptimizer::MergeGroupConvolution(MKLDNNGraph &graph) {
     for (auto node : graph.GetNodes()) {
         // Split with at least 2 Convolutions
@@ -331,19 +434,33 @@ void MKLDNNGraphOptimizer::FuseConvolutionAndDWConvolution(MKLDNNGraph &graph) {
         }
 
         auto* layer = dynamic_cast<ConvolutionLayer*>(childNode->getCnnLayer().get());
+        auto* parentLayer = dynamic_cast<ConvolutionLayer*>(parentNode->getCnnLayer().get());
 
         auto inDims = childNode->inDims[0];
         auto outDims = childNode->outDims[0];
-        int elemSize = MKLDNNExtensionUtils::sizeOfDataType(MKLDNNExtensionUtils::IEPrecisionToDataType(layer->precision));
-
-        int L3_cache_size = mkldnn_get_cache_size(3, false);
-        int dw_conv_input_size = inDims[0] * inDims[1] * inDims[2] * inDims[3] * elemSize;
-        int dw_conv_output_size = outDims[0] * outDims[1]* outDims[2] * outDims[3] * elemSize;
-
+        auto parentInDims = parentNode->inDims[0];
+        size_t elemSize = MKLDNNExtensionUtils::sizeOfDataType(MKLDNNExtensionUtils::IEPrecisionToDataType(layer->precision));
         bool isInt8 = layer->precision == Precision::I8 || layer->precision == Precision::U8;
-        bool isAVX512NotSupported = !mkldnn::impl::cpu::mayiuse(impl::cpu::cpu_isa_t::avx512_common);
+        bool isAVX512Supported = mkldnn::impl::cpu::mayiuse(impl::cpu::cpu_isa_t::avx512_common);
+
+        // The fused kernel computes the rows of the parent output which the depthwise kernel needs into a per-thread
+        // buffer of one channel block, that buffer and the input rows of the parent have to stay in L2.
+        size_t simd_w = isAVX512Supported ? 16 : 8;
+        size_t rows_size = (layer->_kernel[Y_AXIS] * inDims[3] * simd_w +
+                            parentLayer->_kernel[Y_AXIS] * parentInDims[1] * parentInDims[3]) * elemSize;
+        if (rows_size > static_cast<size_t>(mkldnn_get_cache_size(2, true)))
+            return false;
+
+        // the fused kernel saves the traffic of the intermediate tensor, which matters once it falls out of L3
+        size_t L3_cache_size = mkldnn_get_cache_size(3, false);
+        size_t dw_conv_input_size = inDims[0] * inDims[1] * inDims[2] * inDims[3] * elemSize;
+        size_t dw_conv_output_size = outDims[0] * outDims[1]* outDims[2] * outDims[3] * elemSize;
+        bool isMemoryBound = dw_conv_input_size + dw_conv_output_size > L3_cache_size / 2;
 
-        return isInt8 ? isAVX512NotSupported : (dw_conv_input_size + dw_conv_output_size > L3_cache_size / 2);
+        // there is no AVX512 INT8 kernel with the fused depthwise, the AVX2 one is worth it for the large tensors only
+        if (isInt8)
+            return isAVX512Supported ? isMemoryBound : true;
+        return isMemoryBound;
     };
 
     for (int i = 0; i < graphNodes.size(); i++) {
@@ -661,6 +778,254 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndActivation(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseDeconvolutionAndActivation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // the activations run as the in place eltwise primitives on the output of the deconvolution
+    auto isFusingSupported = [&](MKLDNNNodePtr activation) {
+        if (activation->getType() != Activation || !activation->getCnnLayer() ||
+            activation->getCnnLayer()->precision != Precision::FP32)
+            return false;
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(activation.get());
+        return activationNode && activationNode->getAlgorithm() != eltwise_not;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto deconv = graphNodes[i];
+        if (deconv->getType() != Deconvolution)
+            continue;
+
+        while (deconv->getChildEdges().size() == 1) {
+            auto child = deconv->getChildEdgeAt(0)->getChild();
+            if (!isFusingSupported(child))
+                break;
+
+            deconv->fuseWith(child);
+            graph.DropNode(child);
+        }
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseElementwiseChains(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // the number of post-ops mkl-dnn can attach to a primitive
+    const size_t maxPostOps = 8;
+
+    auto isFP32 = [](MKLDNNNodePtr node) {
+        auto layer = node->getCnnLayer();
+        if (!layer || layer->precision != Precision::FP32 || layer->insData.size() != 1 || layer->outData.size() != 1)
+            return false;
+        auto input = layer->insData[0].lock();
+        return input && input->getPrecision() == Precision::FP32 &&
+               layer->outData[0]->getPrecision() == Precision::FP32;
+    };
+
+    auto isChainHead = [&](MKLDNNNodePtr node) {
+        if (node->getType() == Activation)
+            return isFP32(node);
+        if (node->getType() == Depthwise) {
+            auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+            return depthwiseNode && depthwiseNode->getAlgorithm() == depthwise_scale_shift && isFP32(node);
+        }
+        return false;
+    };
+
+    // returns the number of post-ops the node takes in the chain of the head, or 0 if it cannot be fused
+    auto postOpsCount = [&](MKLDNNNodePtr head, MKLDNNNodePtr node) -> size_t {
+        if (node->getParentEdges().size() != 1 || !isFP32(node))
+            return 0;
+
+        if (node->getType() == Activation) {
+            auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+            // logical not has no jit implementation
+            return activationNode && activationNode->getAlgorithm() != eltwise_not ? 1 : 0;
+        }
+        if (node->getType() == Power) {
+            auto* powerNode = dynamic_cast<MKLDNNPowerNode *>(node.get());
+            return powerNode && powerNode->canBeAppendedAsPostOps() ? 2 : 0;
+        }
+        // the weights of the depthwise post-ops are per channel, which only the depthwise kernels know
+        if (node->getType() == Depthwise && head->getType() == Depthwise) {
+            auto* depthwiseLayer = dynamic_cast<WeightableLayer *>(node->getCnnLayer().get());
+            return depthwiseLayer && depthwiseLayer->_weights ? 1 : 0;
+        }
+        return 0;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto head = graphNodes[i];
+        if (!isChainHead(head))
+            continue;
+
+        size_t postOps = 0;
+        while (head->getChildEdges().size() == 1) {
+            auto child = head->getChildEdgeAt(0)->getChild();
+            size_t count = postOpsCount(head, child);
+            if (count == 0 || postOps + count > maxPostOps)
+                break;
+
+            head->fuseWith(child);
+            graph.DropNode(child);
+            postOps += count;
+        }
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseProducerAndQuantize(MKLDNNGraph &graph) {
+    auto removeEdge = [](MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
+        auto& edges = graph.GetEdges();
+        for (auto it = edges.begin(); it != edges.end(); it++) {
+            if ((*it) == edge) {
+                edges.erase(it);
+                return;
+            }
+        }
+    };
+
+    auto& graphNodes = graph.GetNodes();
+
+    // the producers quantize their fp32 output in place after the primitive has been executed
+    auto isSutableParentNode = [&](MKLDNNNodePtr node) {
+        if (!IsOneOf(node->getType(), {Eltwise, Pooling, Concatenation, FullyConnected}))
+            return false;
+        auto layer = node->getCnnLayer();
+        if (!layer || layer->precision != Precision::FP32 || layer->outData.size() != 1 ||
+            layer->outData[0]->getPrecision() != Precision::FP32)
+            return false;
+        return node->getChildEdges().size() == 1;
+    };
+
+    auto isSutableChildNode = [](MKLDNNNodePtr parent, MKLDNNNodePtr node) {
+        if (node->getType() != Quantize || !node->getCnnLayer() || node->getParentEdges().size() != 5)
+            return false;
+        // the producer writes the quantized values to its own output, so it must have the precision of the quantize
+        auto layer = node->getCnnLayer();
+        if (layer->precision != parent->getCnnLayer()->precision || layer->outData.size() != 1 ||
+            layer->outData[0]->getPrecision() != parent->getCnnLayer()->outData[0]->getPrecision())
+            return false;
+        // the binary convolution takes the packed output of the quantize
+        for (auto &childEdge : node->getChildEdges()) {
+            auto edge = childEdge.lock();
+            if (!edge || edge->getChild()->getType() == BinaryConvolution)
+                return false;
+        }
+        return true;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto parent = graphNodes[i];
+        if (!isSutableParentNode(parent)) continue;
+
+        auto child = parent->getChildEdgeAt(0)->getChild();
+        if (!isSutableChildNode(parent, child)) continue;
+
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(child.get());
+        if (!quantizeNode || !quantizeNode->initFusedRanges()) continue;
+
+        parent->fuseWith(child);
+
+        auto parents = child->parentEdges;
+        for (size_t j = 0; j < parents.size(); j++) {
+            auto p_edge = parents[j].lock();
+            if (p_edge->getParent() == parent)
+                continue;
+
+            removeEdge(graph, p_edge);
+        }
+
+        graph.DropNode(child);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseNormalizationAndScaleShift(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSutableParentNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Generic || !node->getCnnLayer())
+            return false;
+        const auto& type = node->getCnnLayer()->type;
+        return (type == "MVN" || type == "Normalize" || type == "GRN") &&
+               node->getCnnLayer()->precision == Precision::FP32 && node->getChildEdges().size() == 1;
+    };
+
+    auto isSutableChildNode = [](MKLDNNNodePtr node, size_t channels) {
+        if (node->getType() != Depthwise || !node->getCnnLayer() || node->getCnnLayer()->type != "ScaleShift")
+            return false;
+
+        auto* scaleShift = dynamic_cast<ScaleShiftLayer*>(node->getCnnLayer().get());
+        return scaleShift && scaleShift->precision == Precision::FP32 && node->getParentEdges().size() == 1 &&
+               scaleShift->_weights && scaleShift->_weights->size() == channels &&
+               (!scaleShift->_biases || scaleShift->_biases->size() == channels);
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto node = graphNodes[i];
+        if (!isSutableParentNode(node)) continue;
+
+        const auto& outDims = node->getCnnLayer()->outData[0]->getTensorDesc().getDims();
+        if (outDims.size() < 2) continue;
+
+        auto child = node->getChildEdgeAt(0)->getChild();
+        if (!isSutableChildNode(child, outDims[1])) continue;
+
+        auto* scaleShift = dynamic_cast<ScaleShiftLayer*>(child->getCnnLayer().get());
+        auto* generic = dynamic_cast<MKLDNNGenericNode*>(node.get());
+        if (!generic) continue;
+
+        auto fusedLayer = generic->fuseScaleShift(scaleShift->_weights, scaleShift->_biases);
+        if (!fusedLayer) continue;
+
+        node->cnnLayer = fusedLayer;
+        graph.DropNode(child);
+    }
+}
+
+void MKLDNNGraphOptimizer::DropBroadcastingTiles(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // a tile of a dimension of 1 that only feeds the eltwises is a broadcast, the eltwise reads such an input with
+    // the zero stride over the dimension instead of the materialized copies
+    auto isBroadcastingTile = [](MKLDNNNodePtr node) {
+        if (node->getType() != Tile || node->getParentEdges().size() != 1 || node->getChildEdges().empty())
+            return false;
+
+        auto* tileLayer = dynamic_cast<TileLayer*>(node->getCnnLayer().get());
+        if (!tileLayer)
+            return false;
+
+        const MKLDNNDims& inDims = node->inDims[0];
+        const MKLDNNDims& outDims = node->outDims[0];
+        const int axis = tileLayer->axis;
+        if (inDims.ndims() > 5 || axis < 0 || axis >= inDims.ndims() || inDims[axis] != 1)
+            return false;
+
+        for (auto &childEdge : node->getChildEdges()) {
+            auto edge = childEdge.lock();
+            if (!edge || edge->getChild()->getType() != Eltwise)
+                return false;
+            const MKLDNNDims& eltwiseDims = edge->getChild()->outDims[0];
+            if (eltwiseDims.ndims() != outDims.ndims() || eltwiseDims[axis] != outDims[axis])
+                return false;
+        }
+        return true;
+    };
+
+    // the tiles over several dimensions are chained, the last one is dropped first
+    for (int i = static_cast<int>(graphNodes.size()) - 1; i >= 0; i--) {
+        auto tile = graphNodes[i];
+        if (!isBroadcastingTile(tile))
+            continue;
+
+        for (auto &childEdge : tile->getChildEdges()) {
+            auto edge = childEdge.lock();
+            edge->getChild()->inDims[edge->getOutputNum()] = tile->inDims[0];
+        }
+        graph.DropNode(tile);
+    }
+}
+
 void MKLDNNGraphOptimizer::RemoveIdentityOperator(MKLDNNGraph &graph) {
     for (MKLDNNNodePtr& node : graph.GetNodes()) {
         bool toDrop = false;
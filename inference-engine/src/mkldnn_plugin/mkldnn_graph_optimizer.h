@@ -19,6 +19,7 @@ public:
 
 private:
     void SLTMTransform(MKLDNNGraph& graph);
+    void FoldSpaceToDepthIntoConvolution(MKLDNNGraph& graph);
     void MergeGroupConvolution(MKLDNNGraph& graph);
     void FuseConvolutionAndActivation(MKLDNNGraph &graph);
     void FuseConvolutionAndDepthwise(MKLDNNGraph &graph);
@@ -27,7 +28,12 @@ private:
     void FuseBatchNormWithScale(MKLDNNGraph& graph);
     void FuseConvolutionSumAndConvolutionSumActivation(MKLDNNGraph &graph);
     void FuseFullyConnectedAndActivation(MKLDNNGraph &graph);
+    void FuseDeconvolutionAndActivation(MKLDNNGraph &graph);
+    void FuseElementwiseChains(MKLDNNGraph &graph);
+    void FuseProducerAndQuantize(MKLDNNGraph &graph);
+    void FuseNormalizationAndScaleShift(MKLDNNGraph &graph);
     void RemoveIdentityOperator(MKLDNNGraph& graph);
+    void DropBroadcastingTiles(MKLDNNGraph& graph);
 
     void RemoveIOScaleShifts(MKLDNNGraph& graph);
     void DropDoubleReorders(MKLDNNGraph& graph);
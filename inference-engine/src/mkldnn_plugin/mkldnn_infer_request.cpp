@@ -14,10 +14,13 @@
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                                      InferenceEngine::OutputsDataMap networkOutputs)
-        : InferRequestInternal(networkInputs, networkOutputs) {}
+        : InferRequestInternal(networkInputs, networkOutputs) {
+    _convertInPreprocessing = true;
+}
 
 
-template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob) {
+template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(MKLDNNGraph *inferGraph, const std::string& inputName,
+                                                                      InferenceEngine::Blob::Ptr& inputBlob) {
     InferenceEngine::TBlob<T> *in_f = dynamic_cast<InferenceEngine::TBlob<T> *>(inputBlob.get());
 
     if (in_f == nullptr) {
@@ -28,7 +31,7 @@ template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std
         THROW_IE_EXCEPTION << "Input data was not allocated.";
     }
 
-    graph->PushInputData(inputName, inputBlob);
+    inferGraph->PushInputData(inputName, inputBlob, isNormalizedByPreprocessing(inputName));
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
@@ -40,85 +43,47 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
 
-        changeDefaultPtr();
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
-        for (auto input : _inputs) {
+        // the graph of the other input dims does not use the external pointers
+        MKLDNNGraph *inferGraph = graph->getGraphForShapes(_inputs);
+        if (inferGraph == graph.get())
+            changeDefaultPtr();
+        inferGraph->reshapeOutputBlobs(_outputs, _networkOutputs, requestBlobs);
+        for (auto &input : _inputs) {
             if (!_networkInputs[input.first]) {
                 THROW_IE_EXCEPTION <<
                                    "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
                                    << input.first;
             }
-            /*if (_networkInputs[input.first]->getInputPrecision() != input.second->precision()) {
-                THROW_IE_EXCEPTION << "Different input precision for input " << input.first
-                                   << " registered in IInferencePlugin::LoadNetwork network and IInferencePlugin::Infer. "
-                                   << _networkInputs[input.first]->getInputPrecision() << " vs "
-                                   << input.second->precision();
-            }*/
-
-
 
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->precision()) {
                 case InferenceEngine::Precision::FP32:
-                    pushInput<float>(input.first, input.second);
+                    pushInput<float>(inferGraph, input.first, input.second);
                     break;
                 case InferenceEngine::Precision::I32:
-                    pushInput<int32_t>(input.first, input.second);
+                    pushInput<int32_t>(inferGraph, input.first, input.second);
                     break;
                 case InferenceEngine::Precision::I8:
-                    pushInput<int8_t>(input.first, input.second);
+                    pushInput<int8_t>(inferGraph, input.first, input.second);
                     break;
-                case InferenceEngine::Precision::U16:
+                case InferenceEngine::Precision::U16: {
                     // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                            InferenceEngine::Precision::FP32,
-                            input.second->getTensorDesc().getLayout(), input.second->dims());
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    pushInput<float>(input.first, iconv);
+                    InferenceEngine::Blob::Ptr iconv = requestBlobs.convertToFloat(input.first, input.second);
+                    pushInput<float>(inferGraph, input.first, iconv);
                     break;
+                }
                 case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                                InferenceEngine::Precision::FP32,
-                                input.second->getTensorDesc().getLayout(), input.second->dims());
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        pushInput<int16_t>(input.first, input.second);
-                    }
+                    // the mean image is subtracted by the graph together with the conversion to FP32
+                    pushInput<int16_t>(inferGraph, input.first, input.second);
                     break;
                 case InferenceEngine::Precision::U8:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                                InferenceEngine::Precision::FP32,
-                                input.second->getTensorDesc().getLayout(), input.second->dims());
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        pushInput<float>(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        pushInput<uint8_t>(input.first, input.second);
-                    }
+                    pushInput<uint8_t>(inferGraph, input.first, input.second);
                     break;
                 default:
                     THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->precision();
             }
         }
-        graph->Infer(m_curBatch);
-        graph->PullOutputData(_outputs);
+        inferGraph->Infer(m_curBatch);
+        inferGraph->PullOutputData(_outputs);
     };
 #if IE_THREAD == IE_THREAD_TBB
     auto_scope_observing observer(graph->ptrObserver);
@@ -140,6 +105,23 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     if (!graph || !graph->IsReady())
         THROW_IE_EXCEPTION << "Graph is not ready!";
 
+    // the blobs are allocated by SetGraph, so the maps of the graph are built only for the unknown names
+    const std::string blobName(name);
+    if (_preProcData.find(blobName) == _preProcData.end()) {
+        auto input = _inputs.find(blobName);
+        if (input != _inputs.end()) {
+            data = input->second;
+            checkBlob(data, blobName, true);
+            return;
+        }
+        auto output = _outputs.find(blobName);
+        if (output != _outputs.end()) {
+            data = output->second;
+            checkBlob(data, blobName, false);
+            return;
+        }
+    }
+
     InferenceEngine::BlobMap blobs;
     graph->getInputBlobs(blobs);
 
@@ -158,7 +140,6 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
         }
 
         InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
-        InferenceEngine::Precision originPrecision = blobs[name]->getTensorDesc().getPrecision();
         if (_networkInputs.find(name) != _networkInputs.end()) {
             InferenceEngine::Layout l = _networkInputs[name]->getLayout();
             InferenceEngine::Precision p = _networkInputs[name]->getPrecision();
@@ -167,10 +148,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             desc = InferenceEngine::TensorDesc(p, dims, l);
         }
 
-        _inputs[name] = make_blob_with_precision(desc);
+        _inputs[name] = make_blob_with_precision(desc, allocator);
         _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+        if (graph->isZeroCopyCompatible(name, _inputs[name]) &&
+                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit &&
+                !graph->getProperty().dynShapesCacheSize) {
             externalPtr[name] = _inputs[name]->buffer();
         }
         data = _inputs[name];
@@ -187,10 +169,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             return;
         }
 
-        _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
+        _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc(), allocator);
         _outputs[name]->allocate();
-        if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (graph->isZeroCopyCompatible(name, _outputs[name]) &&
+                !graph->getProperty().batchLimit &&
+                !graph->getProperty().dynShapesCacheSize) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -223,13 +206,19 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             _preProcData[name].setRoiBlob(data);
         } else {
             size_t inputSize = InferenceEngine::details::product(foundInput->getDims());
-            if (dataSize != inputSize) {
+            if (graph->getProperty().dynShapesCacheSize &&
+                    data->getTensorDesc().getDims() != foundInput->getTensorDesc().getDims()) {
+                // the dims are checked against the loaded ones by the graph on inference
+                foundInput->getInputData()->reshape(data->getTensorDesc().getDims(), foundInput->getLayout());
+            } else if (dataSize != inputSize) {
                 THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
                                    << dataSize << "!=" << inputSize << ").";
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+            // the memory is bound to the blob if the graph reads it as is, otherwise the data is reordered
+            if (graph->isZeroCopyCompatible(name, data) &&
+                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit &&
+                !graph->getProperty().dynShapesCacheSize) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
                 externalPtr.erase(name);
@@ -246,8 +235,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                << "Failed to set Blob with precision not corresponding to user output precision";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (graph->isZeroCopyCompatible(name, data) &&
+                !graph->getProperty().batchLimit &&
+                !graph->getProperty().dynShapesCacheSize) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -333,6 +323,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
 
 void MKLDNNPlugin::MKLDNNInferRequest::SetGraph(const MKLDNNPlugin::MKLDNNGraph::Ptr &graph) {
     this->graph = graph;
+    allocator = graph->getProperty().createBlobAllocator();
 
     InferenceEngine::BlobMap blobs;
     this->graph->getInputBlobs(blobs);
@@ -26,6 +26,7 @@ public:
      * @brief Given optional implementation of setting blob to avoid need for it to be implemented by plugin
      * @param name - a name of input or output blob.
      * @param data - a reference to input or output blob. The type of Blob must correspond to the network input precision and size.
+     * The graph works on the blob memory without copying the data if the blob has the desc of MKLDNNGraph::getPreferredDesc.
      */
     void SetBlob(const char *name, const InferenceEngine::Blob::Ptr &data) override;
 
@@ -41,10 +42,13 @@ public:
     void SetBatch(int batch = -1) override;
 
 private:
-    template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
+    template <typename T> void pushInput(MKLDNNGraph *inferGraph, const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
     void changeDefaultPtr();
     MKLDNNGraph::Ptr graph;
+    std::shared_ptr<InferenceEngine::IAllocator> allocator;
+    // keeps the converted inputs and the outputs of the other dims between the inferences
+    RequestBlobs requestBlobs;
     std::map<std::string, void*> externalPtr;
 };
 }  // namespace MKLDNNPlugin
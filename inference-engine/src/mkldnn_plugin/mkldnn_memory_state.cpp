@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_state.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn;
+
+MKLDNNRNNMemoryState::MKLDNNRNNMemoryState(const std::string &name, const std::vector<std::shared_ptr<MKLDNNRNN>> &nodes)
+        : name(name), nodes(nodes) {
+    if (nodes.empty())
+        THROW_IE_EXCEPTION << "Memory state " << name << " has no RNN layers";
+}
+
+void MKLDNNRNNMemoryState::Reset() {
+    for (auto &node : nodes)
+        node->resetState();
+}
+
+void MKLDNNRNNMemoryState::SetState(Blob::Ptr newState) {
+    if (!newState || newState->getTensorDesc().getPrecision() != Precision::FP32)
+        THROW_IE_EXCEPTION << "Memory state " << name << " expects the FP32 blob";
+    const float *data = newState->cbuffer().as<const float *>() +
+                        newState->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    for (auto &node : nodes)
+        node->setState(data, newState->size());
+}
+
+Blob::CPtr MKLDNNRNNMemoryState::GetLastState() const {
+    const MKLDNNMemory &state = nodes[0]->getState();
+    // the memory is [layers, directions, states, batch, state channels] with one layer and one direction
+    const auto dims = state.GetDims();
+    SizeVector blobDims(dims.begin() + 2, dims.end());
+
+    TBlob<float>::Ptr blob = make_shared_blob<float>(TensorDesc(Precision::FP32, blobDims, Layout::CHW));
+    blob->allocate();
+    memcpy(blob->buffer().as<float *>(), state.GetData(), blob->byteSize());
+    return blob;
+}
+
+MKLDNNMemoryNodeState::MKLDNNMemoryNodeState(const std::string &name, const std::vector<MKLDNNNodePtr> &nodes)
+        : name(name), nodes(nodes) {
+    if (nodes.empty())
+        THROW_IE_EXCEPTION << "Memory state " << name << " has no Memory layers";
+}
+
+void MKLDNNMemoryNodeState::Reset() {
+    for (auto &node : nodes)
+        node->getChildEdgeAt(0)->getMemoryPtr()->FillZero();
+}
+
+void MKLDNNMemoryNodeState::SetState(Blob::Ptr newState) {
+    const MKLDNNMemory &state = nodes[0]->getChildEdgeAt(0)->getMemory();
+    if (!newState || newState->getTensorDesc().getPrecision() != Precision::FP32)
+        THROW_IE_EXCEPTION << "Memory state " << name << " expects the FP32 blob";
+    if (MKLDNNDims(newState->getTensorDesc().getDims()) != MKLDNNDims(state.GetDims()))
+        THROW_IE_EXCEPTION << "Memory state " << name << " expects the blob of the dims of the memory";
+
+    MKLDNNMemory src(nodes[0]->getEngine());
+    src.Create(MKLDNNMemoryDesc(newState->getTensorDesc()), newState->cbuffer());
+    for (auto &node : nodes)
+        node->getChildEdgeAt(0)->getMemory().SetData(src, false);
+}
+
+Blob::CPtr MKLDNNMemoryNodeState::GetLastState() const {
+    const MKLDNNMemory &state = nodes[0]->getChildEdgeAt(0)->getMemory();
+    const auto dims = state.GetDims();
+    SizeVector blobDims(dims.begin(), dims.end());
+
+    TBlob<float>::Ptr blob = make_shared_blob<float>(
+            TensorDesc(Precision::FP32, blobDims, MKLDNNMemory::GetPlainLayout(dims)));
+    blob->allocate();
+    MKLDNNMemory dst(nodes[0]->getEngine());
+    dst.Create(dims, memory::f32, MKLDNNMemory::GetPlainFormat(dims), blob->buffer());
+    dst.SetData(state, false);
+    return blob;
+}
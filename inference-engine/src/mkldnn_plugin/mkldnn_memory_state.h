@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+#include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include "nodes/mkldnn_rnn.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The state of the RNN sequence kept by the plugin between the inferences (Config::rnnPersistentState).
+ * Every stream has its own graph and so the own state of the sequence: the reset and the new state are applied to all
+ * the streams, the last state is the state of the first stream.
+ * The state blob is of [states, batch, state channels] dims, the hidden state is the first.
+ */
+class MKLDNNRNNMemoryState : public InferenceEngine::IMemoryStateInternal {
+public:
+    MKLDNNRNNMemoryState(const std::string &name, const std::vector<std::shared_ptr<MKLDNNRNN>> &nodes);
+
+    std::string GetName() const override {
+        return name;
+    }
+
+    void Reset() override;
+    void SetState(InferenceEngine::Blob::Ptr newState) override;
+    InferenceEngine::Blob::CPtr GetLastState() const override;
+
+private:
+    std::string name;
+    std::vector<std::shared_ptr<MKLDNNRNN>> nodes;
+};
+
+/**
+ * @brief The state of the Memory layers of one id, that is the memory read by the MemoryInput node and written by
+ * the paired MemoryOutput node of the graph. As for the RNN state, the reset and the new state are applied to the
+ * graphs of all the streams and the last state is the state of the first stream. The state blob is of the dims of
+ * the memory in the plain layout.
+ */
+class MKLDNNMemoryNodeState : public InferenceEngine::IMemoryStateInternal {
+public:
+    MKLDNNMemoryNodeState(const std::string &name, const std::vector<MKLDNNNodePtr> &nodes);
+
+    std::string GetName() const override {
+        return name;
+    }
+
+    void Reset() override;
+    void SetState(InferenceEngine::Blob::Ptr newState) override;
+    InferenceEngine::Blob::CPtr GetLastState() const override;
+
+private:
+    std::string name;
+    // the MemoryInput nodes, the memory of their child edge is the current state since the buffers are swapped
+    std::vector<MKLDNNNodePtr> nodes;
+};
+
+}  // namespace MKLDNNPlugin
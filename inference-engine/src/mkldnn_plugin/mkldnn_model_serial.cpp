@@ -0,0 +1,220 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <map>
+#include <details/ie_exception.hpp>
+#include <ie_plugin_config.hpp>
+#include <network_serializer.h>
+#include "mkldnn_model_serial.h"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+const char mkldnn_header_magic[4] = {'M', 'K', 'D', 'N'};
+// the weights section starts at the aligned offset, so the file can be mapped into memory
+const uint64_t weights_alignment = 64;
+
+template <class T>
+inline void writeBits(const T & obj, std::ostream & os) {
+    os.write(reinterpret_cast<const char *>(&obj), sizeof(T));
+}
+
+inline void checkStream(const std::istream & is) {
+    if (!is)
+        THROW_IE_EXCEPTION << "Imported network is corrupted";
+}
+
+template <class T>
+inline void readBits(T & obj, std::istream & is) {
+    is.read(reinterpret_cast<char *>(&obj), sizeof(T));
+    checkStream(is);
+}
+
+inline void writeString(const std::string & str, std::ostream & os) {
+    writeBits(static_cast<uint64_t>(str.size()), os);
+    os.write(str.data(), str.size());
+}
+
+inline std::string readString(std::istream & is) {
+    uint64_t size = 0ull;
+    readBits(size, is);
+    std::string str(size, '\0');
+    is.read(&str[0], size);
+    checkStream(is);
+    return str;
+}
+
+std::map<std::string, std::string> configToProperties(const Config &config) {
+    auto yesNo = [](bool value) { return value ? PluginConfigParams::YES : PluginConfigParams::NO; };
+    return {
+        {PluginConfigParams::KEY_CPU_BIND_THREAD, yesNo(config.useThreadBinding)},
+        {PluginConfigParams::KEY_PERF_COUNT, yesNo(config.collectPerfCounters)},
+        {PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, yesNo(config.exclusiveAsyncRequests)},
+        {PluginConfigParams::KEY_DYN_BATCH_ENABLED, yesNo(config.enableDynamicBatch)},
+        {PluginConfigParams::KEY_CPU_INTER_LAYER_PARALLELISM, yesNo(config.interLayerParallelism)},
+        {PluginConfigParams::KEY_CPU_DEPTH_FIRST, yesNo(config.depthFirst)},
+        {PluginConfigParams::KEY_ENFORCE_BF16, yesNo(config.enforceBF16)},
+        {PluginConfigParams::KEY_CPU_INT8_WEIGHTS_COMPRESSION, yesNo(config.int8WeightsCompression)},
+        {PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(config.batchLimit)},
+        {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(config.throughputStreams)},
+        {PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(config.threadsNum)},
+        {PluginConfigParams::KEY_CPU_DYN_SHAPES_CACHE_SIZE, std::to_string(config.dynShapesCacheSize)},
+        {PluginConfigParams::KEY_TUNING_MODE, config.tuningMode == Config::TuningMode::Create ? PluginConfigParams::TUNING_CREATE :
+                                              config.tuningMode == Config::TuningMode::UseExisting ?
+                                              PluginConfigParams::TUNING_USE_EXISTING : PluginConfigParams::TUNING_DISABLED},
+        {PluginConfigParams::KEY_TUNING_FILE, config.tuningFile},
+        {PluginConfigParams::KEY_CPU_SCRATCH_ARENA, config.scratchArena},
+        {PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, config.dumpToDot}
+    };
+}
+
+}  // namespace
+
+void MKLDNNModelSerial::Export(std::ostream &os,
+                               const ICNNNetwork &network,
+                               const Config &config,
+                               const InputsDataMap &inputs,
+                               const OutputsDataMap &outputs) {
+    std::ostringstream xml;
+    std::ostringstream bin;
+    details::NetworkSerializer::serialize(xml, &bin, network);
+
+    os.write(mkldnn_header_magic, sizeof(mkldnn_header_magic));
+    writeBits(static_cast<uint16_t>(MKLDNN_HEADER_MAJOR), os);
+    writeBits(static_cast<uint32_t>(MKLDNN_HEADER_MINOR), os);
+
+    auto properties = configToProperties(config);
+    writeBits(static_cast<uint64_t>(properties.size()), os);
+    for (const auto &property : properties) {
+        writeString(property.first, os);
+        writeString(property.second, os);
+    }
+
+    writeBits(static_cast<uint64_t>(inputs.size()), os);
+    for (const auto &input : inputs) {
+        writeString(input.first, os);
+        writeString(input.second->getPrecision().name(), os);
+        writeBits(static_cast<uint8_t>(input.second->getLayout()), os);
+        writeBits(static_cast<int32_t>(input.second->getPreProcess().getResizeAlgorithm()), os);
+    }
+
+    writeBits(static_cast<uint64_t>(outputs.size()), os);
+    for (const auto &output : outputs) {
+        writeString(output.first, os);
+        writeString(output.second->getPrecision().name(), os);
+        writeBits(static_cast<uint8_t>(output.second->getLayout()), os);
+    }
+
+    writeString(xml.str(), os);
+
+    const std::string weights = bin.str();
+    writeBits(static_cast<uint64_t>(weights.size()), os);
+    const uint64_t position = static_cast<uint64_t>(os.tellp()) + sizeof(uint64_t);
+    const uint64_t padding = (weights_alignment - position % weights_alignment) % weights_alignment;
+    writeBits(padding, os);
+    os.write(std::string(padding, '\0').data(), padding);
+    os.write(weights.data(), weights.size());
+
+    if (!os.good()) {
+        THROW_IE_EXCEPTION << "Error during the executable network export";
+    }
+}
+
+void MKLDNNModelSerial::Import(std::istream &is,
+                               CNNNetReader &reader,
+                               std::map<std::string, std::string> &config) {
+    char magic[sizeof(mkldnn_header_magic)];
+    is.read(magic, sizeof(magic));
+    checkStream(is);
+    if (!std::equal(magic, magic + sizeof(magic), mkldnn_header_magic)) {
+        THROW_IE_EXCEPTION << "Imported file unsupported: magic number should be MKDN";
+    }
+    uint16_t major = 0u;
+    uint32_t minor = 0u;
+    readBits(major, is);
+    readBits(minor, is);
+    if (major != MKLDNN_HEADER_MAJOR) {
+        THROW_IE_EXCEPTION << "Imported file unsupported: major version should be " << MKLDNN_HEADER_MAJOR
+                           << ", but was " << major;
+    }
+
+    uint64_t count = 0ull;
+    readBits(count, is);
+    for (uint64_t i = 0; i < count; i++) {
+        std::string key = readString(is);
+        config[key] = readString(is);
+    }
+
+    struct PortInfo {
+        Precision precision;
+        Layout layout;
+        ResizeAlgorithm resize;
+    };
+    std::map<std::string, PortInfo> inputsInfo, outputsInfo;
+
+    readBits(count, is);
+    for (uint64_t i = 0; i < count; i++) {
+        PortInfo info;
+        std::string name = readString(is);
+        info.precision = Precision::FromStr(readString(is));
+        uint8_t layout = 0u;
+        int32_t resize = 0;
+        readBits(layout, is);
+        readBits(resize, is);
+        info.layout = static_cast<Layout>(layout);
+        info.resize = static_cast<ResizeAlgorithm>(resize);
+        inputsInfo[name] = info;
+    }
+
+    readBits(count, is);
+    for (uint64_t i = 0; i < count; i++) {
+        PortInfo info;
+        std::string name = readString(is);
+        info.precision = Precision::FromStr(readString(is));
+        uint8_t layout = 0u;
+        readBits(layout, is);
+        info.layout = static_cast<Layout>(layout);
+        outputsInfo[name] = info;
+    }
+
+    const std::string xml = readString(is);
+    reader.ReadNetwork(xml.data(), xml.size());
+
+    uint64_t weightsSize = 0ull, padding = 0ull;
+    readBits(weightsSize, is);
+    readBits(padding, is);
+    is.seekg(padding, std::ios_base::cur);
+    checkStream(is);
+    TBlob<uint8_t>::Ptr weights = make_shared_blob<uint8_t>(
+            TensorDesc(Precision::U8, {static_cast<size_t>(weightsSize)}, Layout::C));
+    weights->allocate();
+    is.read(weights->buffer().as<char*>(), weightsSize);
+    checkStream(is);
+    reader.SetWeights(weights);
+
+    CNNNetwork network = reader.getNetwork();
+    InputsDataMap inputs = network.getInputsInfo();
+    for (const auto &info : inputsInfo) {
+        auto input = inputs.find(info.first);
+        if (input == inputs.end())
+            THROW_IE_EXCEPTION << "Imported file is corrupted: cannot find input " << info.first;
+        input->second->setPrecision(info.second.precision);
+        input->second->setLayout(info.second.layout);
+        input->second->getPreProcess().setResizeAlgorithm(info.second.resize);
+    }
+    OutputsDataMap outputs = network.getOutputsInfo();
+    for (const auto &info : outputsInfo) {
+        auto output = outputs.find(info.first);
+        if (output == outputs.end())
+            THROW_IE_EXCEPTION << "Imported file is corrupted: cannot find output " << info.first;
+        output->second->setPrecision(info.second.precision);
+        output->second->setLayout(info.second.layout);
+    }
+}
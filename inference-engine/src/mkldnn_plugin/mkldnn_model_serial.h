@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <map>
+#include <string>
+#include <cpp/ie_cnn_net_reader.h>
+#include "config.h"
+
+/**
+ * version history
+ * 1.0 - transformed network in IR form with the pinned primitives, config and inputs/outputs info
+ */
+
+#define MKLDNN_HEADER_MAJOR 1
+#define MKLDNN_HEADER_MINOR 0
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Serialization of the CPU executable network.
+ * The model consists of the network after the plugin front-end transformations (INT8 normalization, TensorIterator
+ * and RNN unrolling) with the CPU implementation selected by the graph pinned via "PrimitivesPriority" of every layer,
+ * the configuration and the inputs/outputs info the network was loaded with.
+ * The weights are stored aligned as the last section of the file.
+ */
+class MKLDNNModelSerial {
+public:
+    static void Export(std::ostream &os,
+                       const InferenceEngine::ICNNNetwork &network,
+                       const Config &config,
+                       const InferenceEngine::InputsDataMap &inputs,
+                       const InferenceEngine::OutputsDataMap &outputs);
+
+    /**
+     * @brief Reads the model into the reader and fills the config it was exported with
+     */
+    static void Import(std::istream &is,
+                       InferenceEngine::CNNNetReader &reader,
+                       std::map<std::string, std::string> &config);
+};
+
+}  // namespace MKLDNNPlugin
@@ -10,7 +10,10 @@
 #include <string>
 #include <limits>
 #include <cstdint>
+#include <chrono>
+#include <sstream>
 #include <unordered_map>
+#include <cpp_interfaces/ie_metrics.hpp>
 
 #include <nodes/mkldnn_batchnorm_node.h>
 #include <nodes/mkldnn_concat_node.h>
@@ -38,9 +41,11 @@
 #include <nodes/mkldnn_rnn.h>
 #include <nodes/mkldnn_quantize_node.h>
 #include <nodes/mkldnn_bin_conv_node.h>
+#include <nodes/mkldnn_tensoriterator_node.h>
 #include <mkldnn_types.h>
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_plugin.h"
+#include "mkldnn_tuning.h"
 #include "ie_memcpy.h"
 
 using namespace mkldnn;
@@ -77,6 +82,7 @@ MKLDNNNode::Register<MKLDNNBinaryConvolutionNode> MKLDNNBinaryConvolutionNode::r
 MKLDNNNode::Register<MKLDNNMemoryInputNode> MKLDNNMemoryInputNode::reg;
 MKLDNNNode::Register<MKLDNNMemoryOutputNode> MKLDNNMemoryOutputNode::reg;
 MKLDNNNode::Register<MKLDNNRNN> MKLDNNRNN::reg;
+MKLDNNNode::Register<MKLDNNTensorIteratorNode> MKLDNNTensorIteratorNode::reg;
 
 MKLDNNNode::MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng)
         : cnnLayer(layer), name(layer->name), typeStr(layer->type), type(TypeFromName(layer->type)), engine(eng),
@@ -400,9 +406,18 @@ void MKLDNNNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    // the implementations are enumerated with the attributes the primitive is created with, so the selected one
+    // supports the fused post-ops
+    std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
+
     for (auto& desc : descs) {
         try {
-            std::shared_ptr<primitive_desc_iterator> itpd = std::make_shared<primitive_desc_iterator>(desc.createPrimitiveDescriptorIterator(engine));
+            std::shared_ptr<primitive_desc_iterator> itpd;
+            if (attr == nullptr) {
+                itpd = std::make_shared<primitive_desc_iterator>(desc.createPrimitiveDescriptorIterator(engine));
+            } else {
+                itpd = std::make_shared<primitive_desc_iterator>(desc.createPrimitiveDescriptorIterator(engine, *(attr.get())));
+            }
             do {
                 InferenceEngine::LayerConfig config;
                 config.dynBatchSupport = true;
@@ -557,6 +572,13 @@ InferenceEngine::Blob::Ptr MKLDNNNode::createInternalBlob(InferenceEngine::SizeV
         }
     };
 
+    // the weights of the network are shared by all the networks loaded from it and are never written, so they are
+    // referred in place while nothing has to be merged, padded or converted; the layer keeps them alive for the node
+    if (blb->precision() == Precision::FP32 && getMergeWith().empty() &&
+            blb->size() == static_cast<size_t>(MKLDNNDims(dims).size())) {
+        return InferenceEngine::make_shared_blob<float>(desc, blb->buffer().as<float *>(), blb->size());
+    }
+
     if (blb->precision() == Precision::BIN) {
         InferenceEngine::TBlob<int8_t>::Ptr internalBlob = InferenceEngine::make_shared_blob<int8_t>(desc);
 
@@ -597,16 +619,27 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
     for (auto &it : internalBlobDesc)
         intDescs.push_back(it(itpd, 0));
 
+    // the weights are shared between all graphs, but the streams pinned to different NUMA nodes get their own copy
+    const int numaNode = MultiWorkerTaskExecutor::ptrContext.numaNode;
+    const std::string numaSuffix = numaNode >= 0 ? "_numa" + std::to_string(numaNode) : "";
+
     internalBlobMemory.clear();
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
 
         const uint64_t data_hash =  Engine::GetWeightsSharing().GetHashFunc().hash(internalBlob->buffer(), internalBlob->byteSize());
-        const std::string string_hash = name + "_" + std::to_string(i)
+        // the key also identifies the target layout, so only the graphs that selected the same primitive share the memory
+        std::string string_hash = name + "_" + std::to_string(i)
                                      + "_" + std::to_string(internalBlob->byteSize())
-                                     + "_" + std::to_string(data_hash);
+                                     + "_" + std::to_string(data_hash)
+                                     + "_" + std::to_string(intDescs[i].getFormat())
+                                     + "_" + std::to_string(intDescs[i].getDataType());
+        for (auto dim : intDescs[i].getDims().ToSizeVector())
+            string_hash += "x" + std::to_string(dim);
+        string_hash += numaSuffix;
         MKLDNNMemoryPtr ptr =
                 Engine::GetWeightsSharing().findOrCreate(string_hash, [&] () {
+                    LoadPhaseScope phase("WeightsReorders");
                     MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
                     _ptr->Create(intDescs[i]);
                     MKLDNNMemory memory(engine);
@@ -770,6 +803,8 @@ std::string MKLDNNNode::typeToStr(Type type) {
             return "RNNSeq";
         case RNNCell:
             return "RNNCell";
+        case TensorIterator:
+            return "TensorIterator";
 
         default:
             return "Unknown";
@@ -810,6 +845,111 @@ const std::vector<impl_desc_type>& MKLDNNNode::getPrimitivesPriority() {
     return implPriorities;
 }
 
+std::string MKLDNNNode::getTuningKey() const {
+    std::ostringstream key;
+    key << MKLDNNTuningCache::isaName() << ";" << cnnLayer->type << ";" << cnnLayer->precision.name();
+    auto addDims = [&](const InferenceEngine::DataPtr &data) {
+        key << ";" << data->getPrecision().name();
+        for (auto dim : data->getTensorDesc().getDims())
+            key << "x" << dim;
+    };
+    for (auto &input : cnnLayer->insData)
+        addDims(input.lock());
+    for (auto &output : cnnLayer->outData)
+        addDims(output);
+    // the params are ordered by the name, the names of the layers are not a part of the key
+    for (auto &param : cnnLayer->params) {
+        if (param.first != "PrimitivesPriority")
+            key << ";" << param.first << "=" << param.second;
+    }
+    return key.str();
+}
+
+namespace {
+
+// the time of the primitive of the descriptor on the zero data in microseconds, the best of a few runs
+double timePrimitive(const mkldnn::memory::primitive_desc &pd) {
+    const_mkldnn_primitive_desc_t c_pd = pd.get();
+    const int inputs = mkldnn_primitive_desc_query_s32(c_pd, mkldnn_query_num_of_inputs_s32, 0);
+    const int outputs = mkldnn_primitive_desc_query_s32(c_pd, mkldnn_query_num_of_outputs_s32, 0);
+
+    std::vector<mkldnn::memory> memories;
+    auto createMemory = [&](mkldnn_query_t what, int index) {
+        mkldnn_primitive_desc_t memory_pd;
+        error::wrap_c_api(mkldnn_primitive_desc_clone(&memory_pd, mkldnn_primitive_desc_query_pd(c_pd, what, index)),
+                          "could not clone a memory primitive descriptor");
+        mkldnn::memory::primitive_desc memory_desc;
+        memory_desc.reset(memory_pd);
+        memories.emplace_back(memory_desc);
+        std::fill_n(static_cast<char *>(memories.back().get_data_handle()), memory_desc.get_size(), 0);
+    };
+    for (int i = 0; i < inputs; i++)
+        createMemory(mkldnn_query_input_pd, i);
+    for (int i = 0; i < outputs; i++)
+        createMemory(mkldnn_query_output_pd, i);
+
+    std::vector<mkldnn_primitive_at_t> c_inputs;
+    std::vector<const_mkldnn_primitive_t> c_outputs;
+    for (int i = 0; i < inputs; i++)
+        c_inputs.push_back(mkldnn_primitive_at(memories[i].get(), 0));
+    for (int i = 0; i < outputs; i++)
+        c_outputs.push_back(memories[inputs + i].get());
+
+    mkldnn_primitive_t c_prim;
+    error::wrap_c_api(mkldnn_primitive_create(&c_prim, c_pd, c_inputs.data(), c_outputs.data()),
+                      "could not create a primitive");
+    primitive prim;
+    prim.reset(c_prim);
+
+    // the first run warms the caches and the pages up
+    stream(stream::kind::eager).submit({prim}).wait();
+    double best = std::numeric_limits<double>::max();
+    double total = 0;
+    for (int run = 0; run < 10 && (run < 3 || total < 50000); run++) {
+        auto start = std::chrono::steady_clock::now();
+        stream(stream::kind::eager).submit({prim}).wait();
+        double time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        best = std::min(best, time);
+        total += time;
+    }
+    return best;
+}
+
+}  // namespace
+
+std::string MKLDNNNode::timeImplementations() const {
+    std::map<impl_desc_type, double> times;
+    std::string fastest;
+    double fastestTime = std::numeric_limits<double>::max();
+    for (auto &desc : descs) {
+        try {
+            primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(engine);
+            do {
+                std::string impl = itpd.get_impl_info_str();
+                impl_desc_type type = parse_impl_name(impl);
+                if (times.find(type) != times.end())
+                    continue;
+                try {
+                    times[type] = timePrimitive(itpd.fetch());
+                } catch (std::exception& e) {
+                    // the implementation is not timed and is not preferred
+                    times[type] = std::numeric_limits<double>::max();
+                    continue;
+                }
+                if (times[type] < fastestTime) {
+                    fastestTime = times[type];
+                    fastest = impl;
+                }
+            } while (itpd.next());
+        } catch (std::exception& e) {
+            // it throw exception in case of no implementation found
+            continue;
+        }
+    }
+    // a single implementation does not need a choice
+    return times.size() > 1 ? fastest : std::string();
+}
+
 bool MKLDNNNode::isUninitTensorDesc(const InferenceEngine::TensorDesc& desc) const {
     if (desc.getLayout() == InferenceEngine::Layout::ANY)
         return true;
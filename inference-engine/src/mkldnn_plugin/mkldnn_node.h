@@ -64,7 +64,8 @@ enum Type {
     RNNCell,
     RNNSeq,
     Quantize,
-    BinaryConvolution
+    BinaryConvolution,
+    TensorIterator
 };
 
 static Type TypeFromName(const std::string type) {
@@ -118,6 +119,7 @@ static Type TypeFromName(const std::string type) {
             { "RNNSequence", RNNSeq },
             { "Quantize", Quantize },
             { "BinaryConvolution", BinaryConvolution },
+            { "TensorIterator", TensorIterator },
             { "MemoryInput", MemoryInput},  // for construction from name ctor, arbitrary name is used
             { "Memory", MemoryOutput },  // for construction from layer ctor
     };
@@ -262,6 +264,52 @@ public:
 
     void resolveNotAllocatedEdges();
     virtual void execute(mkldnn::stream strm);
+
+    /**
+     * @brief false if execute does nothing in the selected configuration (the in-place nodes), the graph skips them
+     */
+    virtual bool isExecutable() const {
+        return true;
+    }
+
+    /**
+     * @brief The input rows an output row of a spatially local node reads: the output row i reads the input rows
+     * from i * stride - padTop to i * stride - padTop + extent - 1, outside of the input they are zero padded
+     */
+    struct RowWindow {
+        ptrdiff_t extent = 1;
+        ptrdiff_t stride = 1;
+        ptrdiff_t padTop = 0;
+    };
+
+    /**
+     * @brief Returns true and the window of the node if it may be executed by the tiles of rows
+     * (see MKLDNNTiledChain). The created primitive has to be single-input and single-output.
+     */
+    virtual bool getRowWindow(RowWindow &window) {
+        return false;
+    }
+
+    /**
+     * @brief Creates the primitive with the same weights and post-ops as the node which computes the rows of dst
+     * (of the same layout as the output) from the rows of src padded by padTop and padBottom zero rows
+     */
+    virtual std::shared_ptr<mkldnn::primitive> createRowsPrimitive(const mkldnn::memory &src, const mkldnn::memory &dst,
+                                                                   ptrdiff_t padTop, ptrdiff_t padBottom) {
+        THROW_IE_EXCEPTION << "Node " << getName() << " can't be executed by the tiles of rows.";
+    }
+
+    /**
+     * @brief The key of the shapes, precisions and parameters of the node in the tuning file (see MKLDNNTuningCache)
+     */
+    std::string getTuningKey() const;
+
+    /**
+     * @brief Times the first primitive descriptor of every implementation type the descriptors of the node give,
+     * without the fused post-ops, and returns the implementation name of the fastest one or an empty string
+     */
+    std::string timeImplementations() const;
+
     virtual void initSupportedPrimitiveDescriptors();
     virtual void createPrimitive() = 0;
 
@@ -422,6 +470,8 @@ private:
     const std::string typeStr;
     Type type;
     int execIndex = -1;
+    // the wavefront of the concurrent execution, the nodes of one level do not depend on each other
+    int execLevel = -1;
 
     std::string typeToStr(Type type);
 
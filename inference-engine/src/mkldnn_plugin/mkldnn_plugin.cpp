@@ -4,8 +4,14 @@
 
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_model_serial.h"
 #include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include <cpu_detector.hpp>
+#include <mkldnn.h>
 #include <memory>
+#include <fstream>
+#include <string>
+#include <map>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -48,12 +54,42 @@ Engine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network, const std::map
         conf.batchLimit = network.getBatchSize();
     }
 
+    if (conf.enforceBF16) {
+        // the MKL-DNN of the plugin has no bf16 data type, the primitives of every layer are FP32 or INT8
+        if (!with_cpu_x86_bfloat16())
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BF16 inference needs a CPU with AVX512_BF16";
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "BF16 inference needs the BF16 primitives of MKL-DNN, "
+                           << "the MKL-DNN of the plugin has none";
+    }
+
     return std::make_shared<MKLDNNExecNetwork>(network, conf, extensionManager);
 }
 
+IExecutableNetwork::Ptr Engine::ImportNetwork(const std::string &modelFileName,
+                                              const std::map<std::string, std::string> &config) {
+    std::ifstream is(modelFileName, std::ios::in | std::ios::binary);
+    if (!is.is_open())
+        THROW_IE_EXCEPTION << "Cannot open file " << modelFileName << " for the import";
+
+    CNNNetReader reader;
+    std::map<std::string, std::string> importConfig;
+    MKLDNNModelSerial::Import(is, reader, importConfig);
+    // the import config overrides the one the network was exported with
+    for (const auto &it : config)
+        importConfig[it.first] = it.second;
+
+    IExecutableNetwork::Ptr executableNetwork;
+    CNNNetwork network = reader.getNetwork();
+    LoadNetwork(executableNetwork, network, importConfig);
+    return executableNetwork;
+}
+
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
+    // the kernels are shared by all the networks, so the capacity is set for the process
+    if (mkldnn_set_jit_kernel_cache_capacity(engConfig.kernelCacheCapacity) != mkldnn_success)
+        THROW_IE_EXCEPTION << "Cannot set the capacity of the kernel cache";
 
     // Pass config to already loaded network
     // TODO: Clarify the behavior of SetConfig method. Should it pass data to already loaded networks?
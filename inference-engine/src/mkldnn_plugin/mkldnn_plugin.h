@@ -9,6 +9,7 @@
 #include <map>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <functional>
 #include <cpp_interfaces/impl/ie_plugin_internal.hpp>
 
@@ -38,24 +39,40 @@ protected:
     uint64_t table[kTableSize];
 };
 
+/* Process-wide storage of the constant (reordered) weights shared between the graphs, e.g. the per-stream copies of
+ * one executable network. The memory is refcounted by the graphs that use it and must not be modified once created. */
 class MKLDNNWeightsSharing {
 public:
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
                              std::function<MKLDNNMemoryPtr(void)> create) {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(name_hash);
+        std::shared_ptr<MemoryInfo> record;
+        {
+            std::unique_lock<std::mutex> lock(guard);
+            auto& found = sharedWeights[name_hash];
+            if (!found)
+                found = std::make_shared<MemoryInfo>();
+            record = found;
+        }
 
-        MKLDNNMemoryPtr ptr;
-        if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
+        // creation (i.e. reorder) of the different weights by the concurrently initialized streams is not serialized,
+        // while the streams asking for the same weights wait for the first one to create them
+        std::unique_lock<std::mutex> lock(record->guard);
+        MKLDNNMemoryPtr ptr = record->sharedMemory.lock();
+        if (!ptr) {
             ptr = create();
-            sharedWeights[name_hash] = ptr;
+            record->sharedMemory = ptr;
         }
         return ptr;
     }
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
-    std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
+    struct MemoryInfo {
+        std::mutex guard;
+        std::weak_ptr<MKLDNNMemory> sharedMemory;
+    };
+
+    std::unordered_map<std::string, std::shared_ptr<MemoryInfo>> sharedWeights;
     std::mutex guard;
     static const SimpleDataHash simpleCRC;
 };
@@ -83,6 +100,9 @@ public:
     void QueryNetwork(const InferenceEngine::ICNNNetwork& network,
                       const std::map<std::string, std::string>& config, InferenceEngine::QueryNetworkResult& res) const override;
 
+    InferenceEngine::IExecutableNetwork::Ptr ImportNetwork(const std::string &modelFileName,
+                                                           const std::map<std::string, std::string> &config) override;
+
     static MKLDNNWeightsSharing& GetWeightsSharing() { return weightsSharing; }
 
 private:
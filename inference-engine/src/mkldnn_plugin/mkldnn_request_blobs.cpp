@@ -0,0 +1,78 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_request_blobs.h"
+#include <inference_engine.hpp>
+#include <blob_factory.hpp>
+#include <algorithm>
+
+using namespace InferenceEngine;
+
+static const size_t maxOutputViews = 16;
+
+namespace MKLDNNPlugin {
+
+Blob::Ptr RequestBlobs::convertToFloat(const std::string &name, const Blob::Ptr &input) {
+    const TensorDesc &desc = input->getTensorDesc();
+    Blob::Ptr &converted = convertedInputs[name];
+    if (!converted || converted->getTensorDesc().getDims() != desc.getDims() ||
+            converted->getTensorDesc().getLayout() != desc.getLayout()) {
+        converted = make_shared_blob<float>(TensorDesc(Precision::FP32, desc.getDims(), desc.getLayout()));
+        converted->allocate();
+    }
+
+    float *dst = converted->buffer().as<float *>();
+    switch (input->precision()) {
+        case Precision::U16:
+            copyToFloat<uint16_t>(dst, input.get());
+            break;
+        case Precision::I16:
+            copyToFloat<int16_t>(dst, input.get());
+            break;
+        case Precision::U8:
+            copyToFloat<uint8_t>(dst, input.get());
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported input precision " << input->precision() << " for the conversion to FP32";
+    }
+    return converted;
+}
+
+Blob::Ptr RequestBlobs::outputFor(const std::string &name, const Blob::Ptr &output, const SizeVector &dims) {
+    std::vector<Blob::Ptr> &views = outputViews[name];
+    Blob::Ptr &storage = outputStorage[name];
+    // a blob set by the user replaces the memory of the loaded dims
+    if (!storage || (output != storage && std::find(views.begin(), views.end(), output) == views.end())) {
+        storage = output;
+        views.clear();
+    }
+
+    const TensorDesc &desc = storage->getTensorDesc();
+    if (desc.getDims() == dims)
+        return storage;
+    for (auto &view : views) {
+        if (view->getTensorDesc().getDims() == dims)
+            return view;
+    }
+
+    // the dims of the inputs are not bounded by the graphs cache, so are the outputs made for them
+    if (views.size() >= maxOutputViews)
+        views.erase(views.begin() + (views.front() == output ? 1 : 0));
+
+    TensorDesc viewDesc(desc.getPrecision(), dims, desc.getLayout());
+    Blob::Ptr view;
+    size_t size = 1;
+    for (auto dim : dims)
+        size *= dim;
+    if (desc.getLayout() != Layout::ANY && desc.getLayout() != Layout::BLOCKED && size <= storage->size()) {
+        view = make_blob_with_precision(viewDesc, storage->buffer());
+    } else {
+        view = make_blob_with_precision(viewDesc);
+        view->allocate();
+    }
+    views.push_back(view);
+    return view;
+}
+
+}  // namespace MKLDNNPlugin
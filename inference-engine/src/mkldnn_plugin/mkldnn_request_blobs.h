@@ -0,0 +1,41 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <ie_blob.h>
+#include <ie_common.h>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The blobs an infer request keeps between the inferences, so the steady state does not allocate:
+ * the FP32 copies of the inputs the graph does not take as is, and the output blobs of all the output dims
+ * seen by the request. The outputs of the dims other than the loaded ones are the views of the memory of
+ * the loaded output when it is large enough.
+ */
+class RequestBlobs {
+public:
+    /**
+     * @brief Copies the input to the FP32 blob kept for it, the blob is re-created only for the other dims or layout
+     */
+    InferenceEngine::Blob::Ptr convertToFloat(const std::string &name, const InferenceEngine::Blob::Ptr &input);
+
+    /**
+     * @brief Gives the output blob of the given dims, output is the blob the request holds now
+     */
+    InferenceEngine::Blob::Ptr outputFor(const std::string &name, const InferenceEngine::Blob::Ptr &output,
+                                         const InferenceEngine::SizeVector &dims);
+
+private:
+    InferenceEngine::BlobMap convertedInputs;
+    // the outputs of the loaded dims and the other outputs made for them
+    InferenceEngine::BlobMap outputStorage;
+    std::map<std::string, std::vector<InferenceEngine::Blob::Ptr>> outputViews;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_scratch_arena.h"
+#include <ie_common.h>
+#include <details/ie_irelease.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNScratchArena::Ptr MKLDNNScratchArena::get(const std::string &name, const std::shared_ptr<IAllocator> &allocator) {
+    static std::mutex arenasMutex;
+    static std::map<std::string, std::weak_ptr<MKLDNNScratchArena>> arenas;
+
+    std::lock_guard<std::mutex> lock(arenasMutex);
+    Ptr arena = arenas[name].lock();
+    if (!arena) {
+        arena.reset(new MKLDNNScratchArena(allocator));
+        arenas[name] = arena;
+    }
+    return arena;
+}
+
+MKLDNNScratchArena::MKLDNNScratchArena(const std::shared_ptr<IAllocator> &allocator)
+        : allocator(allocator ? allocator : details::shared_from_irelease(CreateDefaultAllocator())) {}
+
+MKLDNNScratchArena::~MKLDNNScratchArena() {
+    release();
+}
+
+void MKLDNNScratchArena::reserve(size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (size <= capacity)
+        return;
+
+    // the data is scratch, so the old memory is released before the new one is taken
+    release();
+    handle = allocator->alloc(size + alignment);
+    if (handle == nullptr)
+        THROW_IE_EXCEPTION << "Cannot allocate the scratch arena of " << size << " bytes";
+    auto address = reinterpret_cast<uintptr_t>(allocator->lock(handle));
+    ptr = reinterpret_cast<uint8_t *>((address + alignment - 1) / alignment * alignment);
+    capacity = size;
+}
+
+void MKLDNNScratchArena::release() {
+    if (handle == nullptr)
+        return;
+    allocator->unlock(handle);
+    allocator->free(handle);
+    handle = nullptr;
+    ptr = nullptr;
+    capacity = 0;
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_allocator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The memory of the intermediate edges shared by the graphs loaded with the same Config::scratchArena name.
+ * The graphs do not run at the same time, so their intermediate data overlap and the arena is as big as the largest
+ * graph needs. The arena may move when it grows, the graphs placed before repoint their edges at the next inference.
+ */
+class MKLDNNScratchArena {
+public:
+    typedef std::shared_ptr<MKLDNNScratchArena> Ptr;
+
+    /**
+     * @brief Returns the arena of the name, shared while any graph refers it. The allocator (nullptr for the
+     * default one) is used by the first graph creating the arena
+     */
+    static Ptr get(const std::string &name, const std::shared_ptr<InferenceEngine::IAllocator> &allocator);
+
+    ~MKLDNNScratchArena();
+
+    /**
+     * @brief Grows the arena to the size at least, the data of the arena is not kept
+     */
+    void reserve(size_t size);
+
+    uint8_t *data() const {
+        return ptr;
+    }
+
+    size_t size() const {
+        return capacity;
+    }
+
+private:
+    explicit MKLDNNScratchArena(const std::shared_ptr<InferenceEngine::IAllocator> &allocator);
+    void release();
+
+    static constexpr size_t alignment = 4096;
+
+    std::shared_ptr<InferenceEngine::IAllocator> allocator;
+    std::mutex mutex;
+    void *handle = nullptr;
+    uint8_t *ptr = nullptr;
+    size_t capacity = 0;
+};
+
+}  // namespace MKLDNNPlugin
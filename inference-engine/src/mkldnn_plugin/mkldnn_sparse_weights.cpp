@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_sparse_weights.h"
+#include "mkldnn_plugin.h"
+#include "mkldnn_streams.h"
+#include <ie_parallel.hpp>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNSparseWeights::Ptr MKLDNNSparseWeights::get(const std::string &nodeName, const Blob::Ptr &weights,
+                                                  const Blob::Ptr &biases, size_t rows) {
+    if (!weights || weights->precision() != Precision::FP32 || rows == 0 || weights->size() % rows != 0 ||
+        (biases && (biases->precision() != Precision::FP32 || biases->size() != rows)))
+        return nullptr;
+
+    const float *data = weights->cbuffer().as<const float *>();
+    const size_t zeros = std::count(data, data + weights->size(), 0.f);
+    if (zeros < minSparsity * weights->size())
+        return nullptr;
+
+    static std::mutex cacheMutex;
+    static std::map<std::string, std::weak_ptr<MKLDNNSparseWeights>> cache;
+
+    // the same key as the dense weights: the streams pinned to different NUMA nodes get their own copy
+    const int numaNode = MultiWorkerTaskExecutor::ptrContext.numaNode;
+    const uint64_t hash = Engine::GetWeightsSharing().GetHashFunc().hash(weights->cbuffer().as<const unsigned char *>(),
+                                                                        weights->byteSize());
+    std::string key = nodeName + "_" + std::to_string(weights->byteSize()) + "_" + std::to_string(hash);
+    if (numaNode >= 0)
+        key += "_numa" + std::to_string(numaNode);
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    Ptr sparse = cache[key].lock();
+    if (!sparse) {
+        sparse.reset(new MKLDNNSparseWeights(data, biases ? biases->cbuffer().as<const float *>() : nullptr,
+                                             rows, weights->size() / rows));
+        cache[key] = sparse;
+    }
+    return sparse;
+}
+
+MKLDNNSparseWeights::MKLDNNSparseWeights(const float *weights, const float *biasesData, size_t rows, size_t cols)
+        : rows(rows), cols(cols) {
+    rowBegins.reserve(rows + 1);
+    rowBegins.push_back(0);
+    for (size_t r = 0; r < rows; r++) {
+        for (size_t c = 0; c < cols; c++) {
+            float value = weights[r * cols + c];
+            if (value != 0.f) {
+                columns.push_back(static_cast<int>(c));
+                values.push_back(value);
+            }
+        }
+        rowBegins.push_back(values.size());
+    }
+    if (biasesData)
+        biases.assign(biasesData, biasesData + rows);
+}
+
+bool MKLDNNSparseWeights::isFaster(const std::function<void()> &sparse, const std::function<void()> &dense) {
+    auto bestTime = [](const std::function<void()> &run) {
+        // the first run warms the caches and the pages up
+        run();
+        double best = std::numeric_limits<double>::max();
+        for (int i = 0; i < 3; i++) {
+            auto start = std::chrono::steady_clock::now();
+            run();
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    };
+    return bestTime(sparse) < bestTime(dense);
+}
+
+void MKLDNNSparseWeights::multiplyRows(const float *src, float *dst, size_t batch) const {
+    parallel_for(rows, [&](size_t r) {
+        const float bias = biases.empty() ? 0.f : biases[r];
+        for (size_t n = 0; n < batch; n++) {
+            const float *srcRow = src + n * cols;
+            float sum = bias;
+            for (size_t k = rowBegins[r]; k < rowBegins[r + 1]; k++)
+                sum += values[k] * srcRow[columns[k]];
+            dst[n * rows + r] = sum;
+        }
+    });
+}
+
+void MKLDNNSparseWeights::multiplyPlanes(const float *src, float *dst, size_t batch, size_t planeSize) const {
+    parallel_for2d(batch, rows, [&](size_t n, size_t r) {
+        float *dstPlane = dst + (n * rows + r) * planeSize;
+        std::fill(dstPlane, dstPlane + planeSize, biases.empty() ? 0.f : biases[r]);
+        for (size_t k = rowBegins[r]; k < rowBegins[r + 1]; k++) {
+            const float *srcPlane = src + (n * cols + columns[k]) * planeSize;
+            const float value = values[k];
+            for (size_t p = 0; p < planeSize; p++)
+                dstPlane[p] += value * srcPlane[p];
+        }
+    });
+}
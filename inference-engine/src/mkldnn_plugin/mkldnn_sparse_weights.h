@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The FP32 weights of a pruned fully connected layer or 1x1 convolution in the compressed sparse rows:
+ * the nonzero values of every output channel with their input channels. The products with the zeros are skipped,
+ * so the work and the memory of the weights decrease with the share of the zeros.
+ * The nodes keep the dense primitive unless the sparse multiplication is faster on their shapes (see isFaster).
+ */
+class MKLDNNSparseWeights {
+public:
+    typedef std::shared_ptr<MKLDNNSparseWeights> Ptr;
+
+    /**
+     * @brief The share of the zero weights below which the dense primitive is kept without timing
+     */
+    static constexpr float minSparsity = 0.5f;
+
+    /**
+     * @brief Returns the compressed weights (rows are the output channels) and biases (may be null) of the node,
+     * shared by the graphs of the process (the streams) like the dense weights, or nullptr if they are too dense
+     */
+    static Ptr get(const std::string &nodeName, const InferenceEngine::Blob::Ptr &weights,
+                   const InferenceEngine::Blob::Ptr &biases, size_t rows);
+
+    /**
+     * @brief Compares the best times of the sparse and the dense execution of the node
+     */
+    static bool isFaster(const std::function<void()> &sparse, const std::function<void()> &dense);
+
+    /**
+     * @brief dst[n][r] = sum(W[r][c] * src[n][c]) + b[r], the fully connected layer
+     */
+    void multiplyRows(const float *src, float *dst, size_t batch) const;
+
+    /**
+     * @brief dst[n][r][p] = sum(W[r][c] * src[n][c][p]) + b[r] for the planes of the size, the 1x1 convolution in nchw
+     */
+    void multiplyPlanes(const float *src, float *dst, size_t batch, size_t planeSize) const;
+
+    float getSparsity() const {
+        return 1.f - static_cast<float>(values.size()) / static_cast<float>(rows * cols);
+    }
+
+private:
+    MKLDNNSparseWeights(const float *weights, const float *biases, size_t rows, size_t cols);
+
+    size_t rows;
+    size_t cols;
+    // the nonzero weights of the row r are [rowBegins[r], rowBegins[r + 1])
+    std::vector<size_t> rowBegins;
+    std::vector<int> columns;
+    std::vector<float> values;
+    std::vector<float> biases;
+};
+
+}  // namespace MKLDNNPlugin
@@ -9,10 +9,19 @@
 #include <chrono>
 #include <climits>
 #include <memory>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
+#if !(defined(__APPLE__) || defined(_WIN32))
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
 
 #include "mkldnn_graph.h"
 #include "ie_parallel.hpp"
 #include "mkldnn_streams.h"
+#include <details/ie_cnn_network_tools.h>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -89,6 +98,76 @@ bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const
     CPU_FREE(target_mask);
     return res;
 }
+/* Read the list of the sysfs in the "0-1,3" format, empty if the file is not available */
+static std::vector<int> read_sysfs_list(const std::string& path) {
+    std::ifstream file(path);
+    std::string ranges;
+    std::vector<int> ids;
+    if (!file.is_open() || !std::getline(file, ranges))
+        return ids;
+    std::stringstream ss(ranges);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty())
+            continue;
+        const size_t dash = range.find('-');
+        const int first = std::stoi(range.substr(0, dash));
+        const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int id = first; id <= last; id++)
+            ids.push_back(id);
+    }
+    return ids;
+}
+int get_num_numa_nodes() {
+    return std::max<int>(1, read_sysfs_list("/sys/devices/system/node/online").size());
+}
+int get_current_numa_node() {
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+        return 0;
+    return static_cast<int>(node);
+}
+bool pin_current_thread_to_cpu(int cpu) {
+    if (cpu < 0)
+        return false;
+    cpu_set_t *target_mask = CPU_ALLOC(cpu + 1);
+    if (!target_mask)
+        return false;
+    const size_t size = CPU_ALLOC_SIZE(cpu + 1);
+    CPU_ZERO_S(size, target_mask);
+    CPU_SET_S(cpu, size, target_mask);
+    bool res = 0 == sched_setaffinity(0, size, target_mask);
+    CPU_FREE(target_mask);
+    return res;
+}
+CoreTypes get_core_types() {
+    CoreTypes cores;
+    // the hybrid CPUs expose a PMU per core type, each listing the logical CPUs of its cores
+    cores.performance = read_sysfs_list("/sys/devices/cpu_core/cpus");
+    cores.efficiency = read_sysfs_list("/sys/devices/cpu_atom/cpus");
+
+    int ncpus = 0;
+    cpu_set_t *mask = nullptr;
+    if (get_process_mask(ncpus, mask)) {
+        const size_t size = CPU_ALLOC_SIZE(ncpus);
+        auto notAllowed = [&](int cpu) { return cpu >= ncpus || !CPU_ISSET_S(cpu, size, mask); };
+        for (auto cpus : {&cores.performance, &cores.efficiency})
+            cpus->erase(std::remove_if(cpus->begin(), cpus->end(), notAllowed), cpus->end());
+        CPU_FREE(mask);
+    }
+    if (!cores.isHybrid())
+        return CoreTypes();
+
+    for (int cpu : cores.performance) {
+        const std::vector<int> siblings = read_sysfs_list("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                                                          "/topology/thread_siblings_list");
+        if (siblings.empty() || siblings[0] == cpu)
+            cores.performancePrimary.push_back(cpu);
+    }
+    if (cores.performancePrimary.empty())
+        cores.performancePrimary = cores.performance;
+    return cores;
+}
 #else   // no threads pinning/binding on Win/MacOS
 bool get_process_mask(int& ncpus, cpu_set_t*& mask) {
     ncpus = 0;
@@ -101,51 +180,180 @@ bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const
 bool pin_current_thread_by_mask(int ncores, const cpu_set_t* proc_mask) {
     return false;
 }
+int get_num_numa_nodes() {
+    return 1;
+}
+int get_current_numa_node() {
+    return 0;
+}
+bool pin_current_thread_to_cpu(int cpu) {
+    return false;
+}
+CoreTypes get_core_types() {
+    return CoreTypes();
+}
 #endif  // !(defined(__APPLE__) || defined(_WIN32))
 
-MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task::Ptr>& init_tasks, std::string name) :
-        _isStopped(false), _name(name), _initCount(0) {
-    for (auto t : init_tasks) {
-        _threads.push_back(std::thread([&, t] {
+std::vector<std::vector<int>> get_hybrid_streams_cpus(int streams, int threads_per_stream, const CoreTypes &cores) {
+    std::vector<std::vector<int>> placement;
+    if (!cores.isHybrid() || streams < 1)
+        return placement;
+    // the consecutive CPUs of the list go to the same stream, so the hyper-threads of a core stay together
+    auto split = [&](const std::vector<int> &cpus, int count) {
+        const size_t perStream = std::max<size_t>(1, cpus.size() / count);
+        for (int s = 0; s < count; s++) {
+            std::vector<int> own;
+            for (size_t t = 0; t < perStream; t++)
+                own.push_back(cpus[(s * perStream + t) % cpus.size()]);
+            placement.push_back(own);
+        }
+    };
+
+    if (streams == 1) {
+        const size_t threads = std::min<size_t>(std::max(1, threads_per_stream), cores.performancePrimary.size());
+        placement.emplace_back(cores.performancePrimary.begin(), cores.performancePrimary.begin() + threads);
+        return placement;
+    }
+    const int performanceStreams = std::min(streams - 1,
+            std::max(1, static_cast<int>(cores.performance.size()) / std::max(1, threads_per_stream)));
+    split(cores.performance, performanceStreams);
+    split(cores.efficiency, streams - performanceStreams);
+    return placement;
+}
+
+StreamsConfig get_auto_streams_config(const ICNNNetwork &network, int threads) {
+    // the work of a layer per thread that pays for the fork-join of the thread, some tens of microseconds of a core
+    const double macsPerThread = 1 << 20;
+    // the MACs per byte of the weights and the activations below which the layers wait for the memory
+    const double memoryBoundIntensity = 4.0;
+
+    auto product = [](const SizeVector &dims) {
+        double size = 1.0;
+        for (auto dim : dims)
+            size *= dim;
+        return size;
+    };
+
+    double macs = 0.0, weightsBytes = 0.0, activationsBytes = 0.0;
+    size_t computeLayers = 0;
+    for (const auto &layer : CNNNetSortTopologically(network)) {
+        for (const auto &out : layer->outData)
+            activationsBytes += product(out->getTensorDesc().getDims()) * out->getPrecision().size();
+        if (layer->insData.empty() || layer->outData.empty())
+            continue;
+        auto input = layer->insData[0].lock();
+        if (!input)
+            continue;
+        const SizeVector &inDims = input->getTensorDesc().getDims();
+        const SizeVector &outDims = layer->outData[0]->getTensorDesc().getDims();
+        if (inDims.size() < 2 || outDims.size() < 2)
+            continue;
+
+        double layerMacs = 0.0;
+        if (auto conv = dynamic_cast<ConvolutionLayer *>(layer.get())) {
+            double kernel = 1.0;
+            for (size_t i = 0; i < conv->_kernel.size(); i++)
+                kernel *= conv->_kernel[i];
+            const double group = std::max(1u, conv->_group);
+            // every input point of the deconvolution is spread over the kernel of the output channels
+            if (dynamic_cast<DeconvolutionLayer *>(layer.get()))
+                layerMacs = product(inDims) * kernel * outDims[1] / group;
+            else
+                layerMacs = product(outDims) * kernel * inDims[1] / group;
+        } else if (dynamic_cast<FullyConnectedLayer *>(layer.get())) {
+            layerMacs = product(outDims) * product(inDims) / inDims[0];
+        } else if (auto gemm = dynamic_cast<GemmLayer *>(layer.get())) {
+            layerMacs = product(outDims) * inDims[gemm->transpose_a ? inDims.size() - 2 : inDims.size() - 1];
+        }
+        if (layerMacs <= 0.0)
+            continue;
+
+        macs += layerMacs;
+        computeLayers++;
+        for (const auto &blob : layer->blobs)
+            weightsBytes += blob.second->byteSize();
+    }
+
+    threads = std::max(1, threads);
+    if (computeLayers == 0)
+        return {1, threads};
+
+    const int wantedThreads = static_cast<int>(std::ceil(macs / computeLayers / macsPerThread));
+    int streams = std::max(1, threads / std::min(std::max(1, wantedThreads), threads));
+
+    // the weights are shared by the streams, but each of them passes its own activations through the caches, so
+    // the streams of a memory bound network are limited to the ones whose activations fit the L3 together
+    const double intensity = macs / (weightsBytes + activationsBytes);
+    const double l3 = mkldnn_get_cache_size(3, false);
+    if (intensity < memoryBoundIntensity && activationsBytes <= l3 && streams * activationsBytes > l3)
+        streams = std::max(1, static_cast<int>(l3 / activationsBytes));
+
+    return {streams, std::max(1, threads / streams)};
+}
+
+MultiWorkerTaskExecutor::MultiWorkerTaskExecutor(const std::vector<Task::Ptr>& init_tasks, std::string name,
+                                                 int numa_nodes, int64_t spin_micros) :
+        _pendingTasks(0), _sleepingWorkers(0), _nextQueue(0), _isStopped(false), _name(name), _initCount(0),
+        _spinMicros(spin_micros) {
+    const size_t workers = init_tasks.size();
+    const size_t nodes = std::min(workers, static_cast<size_t>(std::max(1, numa_nodes)));
+    // the streams are pinned contiguously, so the workers are split into the equal consecutive groups per NUMA node
+    auto node_of = [&](size_t worker) { return worker * nodes / workers; };
+    for (size_t w = 0; w < workers; w++) {
+        _queues.emplace_back(new WorkerQueue());
+        std::vector<size_t> order;
+        for (size_t i = 0; i < workers; i++) {
+            const size_t victim = (w + i) % workers;
+            if (node_of(victim) == node_of(w))
+                order.push_back(victim);
+        }
+        for (size_t i = 0; i < workers; i++) {
+            const size_t victim = (w + i) % workers;
+            if (node_of(victim) != node_of(w))
+                order.push_back(victim);
+        }
+        _stealOrder.push_back(order);
+    }
+
+    for (size_t w = 0; w < workers; w++) {
+        Task::Ptr t = init_tasks[w];
+        _threads.push_back(std::thread([&, t, w] {
+            // the worker is the stream its requests are attributed to in the metrics of the network
+            MetricsRegistry::setCurrentStream(static_cast<int>(w));
             // initialization (no contention, every worker thread is doing it's own task)
             t->runNoThrowNoBusyCheck();
             _initCount++;
 
             while (!_isStopped) {
-                bool isQueueEmpty;
-                Task::Ptr currentTask = nullptr;
-                {  // waiting for the new task or for stop signal
-                    std::unique_lock<std::mutex> lock(_queueMutex);
-                    _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
-                    isQueueEmpty = _taskQueue.empty();
-                    if (!isQueueEmpty) {
-                        currentTask = _taskQueue.front();
-                        _taskQueue.pop();
-                        isQueueEmpty = _taskQueue.empty();
-                    }
-                }
-                if (currentTask)
+                Task::Ptr currentTask = popTask(w);
+                if (currentTask) {
                     currentTask->runNoThrowNoBusyCheck();
-                if (_isStopped)
-                    break;
-                if (isQueueEmpty)  // notify dtor, that all tasks were completed
-                    _queueCondVar.notify_all();
+                    continue;
+                }
+                // nothing to execute or steal, spinning for a while in the low-latency mode,
+                // then waiting for the new task or for stop signal
+                if (spinWait(_spinMicros, [&]() { return _pendingTasks > 0 || _isStopped; }))
+                    continue;
+                std::unique_lock<std::mutex> lock(_sleepMutex);
+                _sleepingWorkers++;
+                _sleepCondVar.wait(lock, [&]() { return _pendingTasks > 0 || _isStopped; });
+                _sleepingWorkers--;
             }
         }));
     }
-    while (_initCount != init_tasks.size()) {
+    while (_initCount != workers) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 }
 
 MultiWorkerTaskExecutor::~MultiWorkerTaskExecutor() {
     {
-        std::unique_lock<std::mutex> lock(_queueMutex);
-        if (!_taskQueue.empty()) {
-            _queueCondVar.wait(lock, [this]() { return _taskQueue.empty(); });
+        std::unique_lock<std::mutex> lock(_sleepMutex);
+        if (_pendingTasks > 0) {
+            _drainCondVar.wait(lock, [this]() { return _pendingTasks == 0; });
         }
         _isStopped = true;
-        _queueCondVar.notify_all();
+        _sleepCondVar.notify_all();
     }
     for (auto& thread : _threads) {
         if (thread.joinable()) {
@@ -154,17 +362,66 @@ MultiWorkerTaskExecutor::~MultiWorkerTaskExecutor() {
     }
 }
 
+Task::Ptr MultiWorkerTaskExecutor::popTask(size_t worker_id) {
+    if (_pendingTasks == 0)
+        return nullptr;
+    const std::vector<size_t>& order = _stealOrder[worker_id];
+    for (size_t i = 0; i < order.size(); i++) {
+        WorkerQueue& queue = *_queues[order[i]];
+        Task::Ptr task;
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty())
+                continue;
+            // the owner takes the oldest task, while the thieves take from the tail to keep the contention low,
+            // unless the head is of a higher priority and shouldn't wait for the owner
+            if (i == 0 || queue.tasks.front()->getPriority() > queue.tasks.back()->getPriority()) {
+                task = queue.tasks.front();
+                queue.tasks.pop_front();
+            } else {
+                task = queue.tasks.back();
+                queue.tasks.pop_back();
+            }
+        }
+        if (--_pendingTasks == 0) {
+            // notify dtor, that all tasks were taken
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _drainCondVar.notify_all();
+        }
+        return task;
+    }
+    return nullptr;
+}
+
 bool MultiWorkerTaskExecutor::startTask(Task::Ptr task) {
     if (!task->occupy()) return false;
-    std::unique_lock<std::mutex> lock(_queueMutex);
-    _taskQueue.push(task);
-    _queueCondVar.notify_one();
+    WorkerQueue& queue = *_queues[_nextQueue++ % _queues.size()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        // the queue is kept ordered by priority, the task goes after all the tasks of the same or higher one
+        auto position = std::upper_bound(queue.tasks.begin(), queue.tasks.end(), task,
+                                         [](const Task::Ptr &lhs, const Task::Ptr &rhs) {
+                                             return lhs->getPriority() > rhs->getPriority();
+                                         });
+        queue.tasks.insert(position, task);
+    }
+    _pendingTasks++;
+    // the sleeping workers are checked after publishing the task, so that a worker going to sleep either sees
+    // the task or gets notified
+    if (_sleepingWorkers > 0) {
+        std::lock_guard<std::mutex> lock(_sleepMutex);
+        _sleepCondVar.notify_one();
+    }
     return true;
 }
 
 MKLDNNPlugin::MKLDNNGraphlessInferRequest::MKLDNNGraphlessInferRequest(InferenceEngine::InputsDataMap networkInputs,
-                                                                       InferenceEngine::OutputsDataMap networkOutputs)
-        : InferRequestInternal(networkInputs, networkOutputs), m_curBatch(-1) {
+                                                                       InferenceEngine::OutputsDataMap networkOutputs,
+                                                                       bool dynamicShapes,
+                                                                       std::shared_ptr<InferenceEngine::IAllocator> allocator)
+        : InferRequestInternal(networkInputs, networkOutputs), m_curBatch(-1), m_dynamicShapes(dynamicShapes),
+          m_allocator(std::move(allocator)) {
+    _convertInPreprocessing = true;
     // Allocate all input blobs
     for (const auto& it : networkInputs) {
         InferenceEngine::Blob::Ptr blob;
@@ -196,72 +453,37 @@ void MKLDNNPlugin::MKLDNNGraphlessInferRequest::InferImpl() {
         // execute input pre-processing.
         execDataPreprocessing(_inputs);
 
-        // need to retain converted blobs until infer finish
-        std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
-        for (auto input : _inputs) {
+        MKLDNNGraph *inferGraph = graph->getGraphForShapes(_inputs);
+        inferGraph->reshapeOutputBlobs(_outputs, _networkOutputs, m_requestBlobs);
+
+        for (auto &input : _inputs) {
             if (!_networkInputs[input.first]) {
                 THROW_IE_EXCEPTION <<
                                    "input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name "
                                    << input.first;
             }
-            InferenceEngine::Blob::Ptr iconv;
-            InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->precision()) {
                 case InferenceEngine::Precision::FP32:
-                    graph->PushInputData(input.first, input.second);
+                    inferGraph->PushInputData(input.first, input.second, isNormalizedByPreprocessing(input.first));
                     break;
                 case InferenceEngine::Precision::U16:
                     // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                            InferenceEngine::Precision::FP32,
-                            input.second->getTensorDesc().getLayout(), input.second->dims());
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
-                    graph->PushInputData(input.first, iconv);
+                    inferGraph->PushInputData(input.first, m_requestBlobs.convertToFloat(input.first, input.second));
                     break;
                 case InferenceEngine::Precision::I16:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                                InferenceEngine::Precision::FP32,
-                                input.second->getTensorDesc().getLayout(), input.second->dims());
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
-                        graph->PushInputData(input.first, iconv);
-                    } else {
-                        // Instead we can send I16 directly
-                        graph->PushInputData(input.first, input.second);
-                    }
-                    break;
                 case InferenceEngine::Precision::U8:
-                    if (graph->hasMeanImageFor(input.first)) {
-                        // If a mean image exists, we convert the blob and send FP32
-                        iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                                InferenceEngine::Precision::FP32,
-                                input.second->getTensorDesc().getLayout(), input.second->dims());
-                        convertedInputs.push_back(iconv);
-                        iconv->allocate();
-                        in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                        InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
-                        graph->PushInputData(input.first, iconv);
-                    } else {
-                        // Instead we can send I8 directly
-                        graph->PushInputData(input.first, input.second);
-                    }
+                    // the mean image is subtracted by the graph together with the conversion to FP32
+                    inferGraph->PushInputData(input.first, input.second);
                     break;
                 default:
                     THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->precision();
             }
         }
-        graph->Infer(m_curBatch);
-        graph->PullOutputData(_outputs);
+        inferGraph->Infer(m_curBatch);
+        inferGraph->PullOutputData(_outputs);
         if (graph->getProperty().collectPerfCounters) {
             m_perfMap.clear();
-            graph->GetPerfData(m_perfMap);
+            inferGraph->GetPerfData(m_perfMap);
         }
     };
 #if IE_THREAD == IE_THREAD_TBB
@@ -296,7 +518,7 @@ void MKLDNNPlugin::MKLDNNGraphlessInferRequest::GetBlob(const char *name, Infere
         InferenceEngine::SizeVector dims = _networkInputs[name]->getTensorDesc().getDims();
 
         InferenceEngine::TensorDesc desc = InferenceEngine::TensorDesc(p, dims, l);
-        _inputs[name] = data = make_blob_with_precision(desc);
+        _inputs[name] = data = make_blob_with_precision(desc, m_allocator);
         _inputs[name]->allocate();
         checkBlob(data, name, true);
         return;
@@ -312,7 +534,7 @@ void MKLDNNPlugin::MKLDNNGraphlessInferRequest::GetBlob(const char *name, Infere
         InferenceEngine::SizeVector dims = _networkOutputs[name]->getTensorDesc().getDims();
 
         InferenceEngine::TensorDesc desc = InferenceEngine::TensorDesc(p, dims, l);
-        _outputs[name] = data = make_blob_with_precision(desc);
+        _outputs[name] = data = make_blob_with_precision(desc, m_allocator);
         _outputs[name]->allocate();
         checkBlob(data, name, false);
         return;
@@ -344,7 +566,10 @@ void MKLDNNPlugin::MKLDNNGraphlessInferRequest::SetBlob(const char *name, const
             _preProcData[name].setRoiBlob(data);
         } else {
             size_t inputSize = InferenceEngine::details::product(foundInput->getDims());
-            if (dataSize != inputSize) {
+            if (m_dynamicShapes && data->getTensorDesc().getDims() != foundInput->getTensorDesc().getDims()) {
+                // the dims are checked against the loaded ones by the graph on inference
+                foundInput->getInputData()->reshape(data->getTensorDesc().getDims(), foundInput->getLayout());
+            } else if (dataSize != inputSize) {
                 THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
                                    << dataSize << "!=" << inputSize << ").";
             }
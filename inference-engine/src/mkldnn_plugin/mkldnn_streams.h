@@ -8,13 +8,17 @@
 #include <vector>
 #include <atomic>
 #include <map>
-#include <queue>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 #include <memory>
 #include <climits>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 #include <cpp_interfaces/ie_task_executor.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn/omp_manager.h"
+#include "mkldnn_request_blobs.h"
 
 /* CPU "streams" implement a feature that allows multiple Infer Requests to be efficiently run simultaneously.
  * To avoid potential oversubscription the CPU execution resources are divided accordingly.
@@ -27,9 +31,10 @@
  * application logic, helping to saturate the CPU by multiple requests instead.
  * Implementation-wise, the "streams" constitute the following:
  *  - Pure "graph-less" Infer Requests that are not connected to the specific MKLDNNGraph (which is regular/legacy approach)
- *  - Just like regular requests, the graph-less go to the common (per ExecutableNetwork) queue
+ *  - Just like regular requests, the graph-less go to the (per ExecutableNetwork) executor
  *  - But unlike conventional case, there are multiple threads that grab the requests (see MultiWorkerTaskExecutor)
- *  - So every stream is in fact is independent "worker" thread that monitors the queue.
+ *  - So every stream is in fact is independent "worker" thread that monitors its own queue and steals the requests
+ *    from the queues of other streams (preferably from the same NUMA node) when its own queue runs dry.
  *  - Every worker thread (stream) has it's own copy of the graph (which handles intermediate data required for execution)
  *  - While the Infer Requests just keep only input/output data
 */
@@ -43,6 +48,8 @@ class pinning_observer;
  * This includes graph (which handles the intermediate data) and arena/observer for the TBB */
 struct MultiWorkerTaskContext {
     std::shared_ptr<MKLDNNGraph> ptrGraph;
+    /* NUMA node the (pinned) stream is bound to, -1 when the stream is not bound to a specific node */
+    int numaNode = -1;
 };
 
 #if defined(__APPLE__) || defined(_WIN32)
@@ -59,6 +66,41 @@ bool pin_current_thread_by_mask(int ncores, const cpu_set_t* proc_mask);
 /* Pin thread to a spare core in the round-robin scheme, while respecting the given process mask.
  * The function can also handle the hyper-threading (by populating the physical cores first) */
 bool pin_thread_to_vacant_core(int thr_idx, int hyperthreads, int ncores, const cpu_set_t* proc_mask);
+/* Get the number of online NUMA nodes (1 if the information is not available) */
+int get_num_numa_nodes();
+/* Get the NUMA node the current thread runs on (0 if the information is not available) */
+int get_current_numa_node();
+/* Pin current thread to the given logical CPU */
+bool pin_current_thread_to_cpu(int cpu);
+
+/* The logical CPUs of the performance and the efficiency cores the process may run on */
+struct CoreTypes {
+    std::vector<int> performance;
+    /* the first hyper-thread of every physical performance core */
+    std::vector<int> performancePrimary;
+    std::vector<int> efficiency;
+
+    bool isHybrid() const { return !performance.empty() && !efficiency.empty(); }
+};
+/* Detects the types of the cores of a hybrid CPU by the sysfs of its per core type PMUs,
+ * all the lists are empty when the CPU is not hybrid or the information is not available */
+CoreTypes get_core_types();
+/* Places the streams on the cores of a hybrid CPU, returns the logical CPUs of every stream (or nothing for
+ * a homogeneous CPU). The single stream of the latency mode gets the physical performance cores only, since every
+ * parallel region would wait for its slowest threads on the efficiency cores. With more streams the first ones
+ * take the performance cores by threads_per_stream, at least one stream is left for the efficiency cores, and the
+ * cores of each type are split evenly over its streams, so the thread counts differ per core type */
+std::vector<std::vector<int>> get_hybrid_streams_cpus(int streams, int threads_per_stream, const CoreTypes &cores);
+
+/* The streams and the threads per stream of an executable network */
+struct StreamsConfig {
+    int streams;
+    int threadsPerStream;
+};
+/* Picks the streams for the threads by the work of the compute layers of the network (CPU_THROUGHPUT_AUTO):
+ * the layers too light to be split over many threads get more streams of fewer threads, while a memory bound
+ * network keeps the activations of all its streams within the L3 */
+StreamsConfig get_auto_streams_config(const InferenceEngine::ICNNNetwork &network, int threads);
 
 #if IE_THREAD == IE_THREAD_TBB
 /* Simple observer that handles pinning threads to the cores, it serves as a callback for threads entering the arena. */
@@ -67,17 +109,25 @@ class pinning_observer: public tbb::task_scheduler_observer {
     int ncpus;
     int stream_id, threads_per_stream;
     const int pinning_step;
+    /* the CPUs of the stream placed by the core types, the round-robin pinning is used without them */
+    const std::vector<int> cpus;
 
 public:
-    pinning_observer(tbb::task_arena& _arena, int _stream_id, int _threads_per_stream, int _pinning_step = 1) :
+    pinning_observer(tbb::task_arena& _arena, int _stream_id, int _threads_per_stream, int _pinning_step = 1,
+                     std::vector<int> _cpus = {}) :
             tbb::task_scheduler_observer(_arena),
-            stream_id(_stream_id), threads_per_stream(_threads_per_stream), pinning_step(_pinning_step) {
+            stream_id(_stream_id), threads_per_stream(_threads_per_stream), pinning_step(_pinning_step),
+            cpus(std::move(_cpus)) {
         get_process_mask(ncpus, mask);
     }
 
     void on_scheduler_entry(bool) override {
         if (!mask) return;
         int thread_idx = tbb::task_arena::current_thread_index();
+        if (!cpus.empty()) {
+            pin_current_thread_to_cpu(cpus[thread_idx % cpus.size()]);
+            return;
+        }
         int thr_idx = stream_id * threads_per_stream + thread_idx;
         // pin thread to the vacant slot
         pin_thread_to_vacant_core(thr_idx, pinning_step, ncpus, mask);
@@ -111,18 +161,29 @@ protected:
 };
 #endif  // IE_THREAD == IE_THREAD_TBB
 
-/* Class wrapping multiple worker threads that monitors the same queue with Infer Requests. */
+/* Class wrapping multiple worker threads, each monitoring its own queue with Infer Requests.
+ * The requests are distributed over the queues in the round-robin fashion, and an idle worker steals the requests
+ * from the tail of the other queues, visiting the workers of the same NUMA node first. */
 class MultiWorkerTaskExecutor : public ITaskExecutor {
 public:
     typedef std::shared_ptr<MultiWorkerTaskExecutor> Ptr;
 
-    explicit MultiWorkerTaskExecutor(const std::vector<Task::Ptr>&, std::string name = "Default");
+    /**
+    * @param init_tasks - initialization tasks, one per worker thread
+    * @param name - name of the executor
+    * @param numa_nodes - number of NUMA nodes the workers are (contiguously) spread over, used to prefer local stealing
+    * @param spin_micros - the time an idle worker spins for a new task before it goes to sleep, 0 to sleep at once
+    */
+    explicit MultiWorkerTaskExecutor(const std::vector<Task::Ptr>& init_tasks, std::string name = "Default",
+                                     int numa_nodes = 1, int64_t spin_micros = 0);
 
     ~MultiWorkerTaskExecutor();
 
     /**
     * @brief Adds task for execution and notifies one of the working threads about the new task.
-    * @note can be called from multiple threads - tasks will be added to the queue and executed one-by-one in FIFO mode.
+    * @note can be called from multiple threads - tasks are spread over the per-worker queues and are executed
+    * in FIFO order within a queue among the tasks of the same priority, a task of a higher priority goes ahead of
+    * the waiting ones, while idle workers steal from the queues of the busy ones.
     * @param task - shared pointer to the task
     *  @return true if succeed to add task, otherwise - false
     */
@@ -131,21 +192,43 @@ public:
     static thread_local MultiWorkerTaskContext ptrContext;
 
 private:
+    /* Per-worker queue, the lock is contended only by the owner, the producers and occasional thieves */
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task::Ptr> tasks;
+    };
+
+    /* Takes a task from the own queue of the worker or steals it from the others, returns nullptr if nothing found */
+    Task::Ptr popTask(size_t worker_id);
+
     std::vector<std::thread> _threads;
-    std::mutex _queueMutex;
-    std::condition_variable _queueCondVar;
-    std::queue<Task::Ptr> _taskQueue;
+    std::vector<std::unique_ptr<WorkerQueue>> _queues;
+    /* Per-worker order of queues to visit: own queue, then the same NUMA node, then the rest */
+    std::vector<std::vector<size_t>> _stealOrder;
+    std::mutex _sleepMutex;
+    std::condition_variable _sleepCondVar;
+    std::condition_variable _drainCondVar;
+    std::atomic<int> _pendingTasks;
+    std::atomic<int> _sleepingWorkers;
+    std::atomic<unsigned int> _nextQueue;
     std::atomic<bool> _isStopped;
     std::string _name;
     std::atomic<int> _initCount;
+    int64_t _spinMicros;
 };
 
 /* Pure Infer Requests - just input and output data. */
 class MKLDNNGraphlessInferRequest : public InferenceEngine::InferRequestInternal {
 public:
     typedef std::shared_ptr<MKLDNNGraphlessInferRequest> Ptr;
+    /**
+     * @param dynamicShapes - the input blobs may have the dims other than the network inputs, see Config::dynShapesCacheSize
+     * @param allocator - the allocator of the input and output blobs, nullptr for the default one
+     */
     explicit MKLDNNGraphlessInferRequest(InferenceEngine::InputsDataMap networkInputs,
-                                         InferenceEngine::OutputsDataMap networkOutputs);
+                                         InferenceEngine::OutputsDataMap networkOutputs,
+                                         bool dynamicShapes = false,
+                                         std::shared_ptr<InferenceEngine::IAllocator> allocator = nullptr);
 
     void InferImpl() override;
 
@@ -170,6 +253,9 @@ public:
 
 private:
     int m_curBatch;
+    bool m_dynamicShapes;
+    std::shared_ptr<InferenceEngine::IAllocator> m_allocator;
+    RequestBlobs m_requestBlobs;
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> m_perfMap;
 };
 
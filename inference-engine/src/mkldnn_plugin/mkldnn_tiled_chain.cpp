@@ -0,0 +1,254 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tiled_chain.h"
+#include "mkldnn_edge.h"
+#include "mkldnn_extension_utils.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// the layouts whose rows of a channel block are contiguous, so a tile of rows is a view of the tensor
+bool isRowsLayout(const MKLDNNMemory &memory) {
+    memory::desc desc = memory.GetDescriptor();
+    if (desc.data.ndims != 4)
+        return false;
+    switch (desc.data.format) {
+        case mkldnn_nchw:
+        case mkldnn_nhwc:
+        case mkldnn_nChw8c:
+        case mkldnn_nChw16c:
+            return true;
+        default:
+            return false;
+    }
+}
+
+memory::desc rowsDesc(const MKLDNNMemory &memory, ptrdiff_t rows) {
+    memory::desc desc = memory.GetDescriptor();
+    memory::dims dims(desc.data.dims, desc.data.dims + desc.data.ndims);
+    dims[2] = static_cast<int>(rows);
+    return memory::desc(dims, memory::data_type(desc.data.data_type), memory::format(desc.data.format));
+}
+
+size_t rowSize(const MKLDNNMemory &memory) {
+    memory::desc desc = memory.GetDescriptor();
+    return static_cast<size_t>(desc.data.layout_desc.blocking.strides[0][2]) *
+           MKLDNNExtensionUtils::sizeOfDataType(memory::data_type(desc.data.data_type));
+}
+
+// the rows of the input the rows [begin, end) of the output read, with the zero padded ones
+void inputRows(const MKLDNNNode::RowWindow &window, ptrdiff_t begin, ptrdiff_t end,
+               ptrdiff_t &inBegin, ptrdiff_t &inEnd) {
+    inBegin = begin * window.stride - window.padTop;
+    inEnd = (end - 1) * window.stride - window.padTop + window.extent;
+}
+
+}  // namespace
+
+MKLDNNTiledChain::Ptr MKLDNNTiledChain::create(const MKLDNNNodePtr &head, size_t cacheBudget) {
+    std::vector<MKLDNNNodePtr> chain;
+    std::vector<MKLDNNNode::RowWindow> windows;
+
+    MKLDNNNodePtr node = head;
+    while (node && !node->isConstant() && node->getParentEdges().size() == 1 && node->getChildEdges().size() >= 1) {
+        MKLDNNNode::RowWindow window;
+        if (!node->getRowWindow(window) ||
+            !isRowsLayout(node->getParentEdgeAt(0)->getMemory()) ||
+            !isRowsLayout(node->getChildEdgeAt(0)->getMemory()))
+            break;
+        chain.push_back(node);
+        windows.push_back(window);
+
+        // the intermediate tensors are not computed, so nobody else may read them
+        if (node->getChildEdges().size() != 1)
+            break;
+        node = node->getChildEdgeAt(0)->getChild();
+    }
+    if (chain.size() < 2)
+        return nullptr;
+
+    // the rows of every level (0 is the chain input) and the bytes of a row
+    std::vector<ptrdiff_t> heights;
+    std::vector<size_t> rowBytes;
+    auto addLevel = [&](const MKLDNNMemory &memory) {
+        ptrdiff_t height = memory.GetDescriptor().data.dims[2];
+        heights.push_back(height);
+        rowBytes.push_back(memory.GetSize() / std::max<ptrdiff_t>(1, height));
+    };
+    addLevel(chain[0]->getParentEdgeAt(0)->getMemory());
+    for (auto &member : chain)
+        addLevel(member->getChildEdgeAt(0)->getMemory());
+
+    const size_t levels = heights.size();
+    auto footprint = [&](ptrdiff_t rows, ptrdiff_t &inputRowsCount) {
+        size_t bytes = 0;
+        for (size_t i = levels - 1; ; i--) {
+            bytes += rows * rowBytes[i];
+            if (i == 0)
+                break;
+            rows = std::min(heights[i - 1], (rows - 1) * windows[i - 1].stride + windows[i - 1].extent);
+        }
+        inputRowsCount = rows;
+        return bytes;
+    };
+
+    const ptrdiff_t outHeight = heights.back();
+    ptrdiff_t inRows = 0;
+    if (footprint(outHeight, inRows) <= cacheBudget)
+        return nullptr;
+
+    ptrdiff_t scale = 1;
+    for (auto &window : windows)
+        scale *= window.stride;
+
+    ptrdiff_t tileRows = outHeight;
+    while (tileRows > 1 && footprint(tileRows, inRows) > cacheBudget)
+        tileRows--;
+    // the halos are computed twice, the tiles may outgrow the budget rather than compute the chain input twice
+    while (tileRows < outHeight) {
+        footprint(tileRows, inRows);
+        if (inRows <= 2 * tileRows * scale)
+            break;
+        tileRows++;
+    }
+    if (tileRows >= outHeight)
+        return nullptr;
+
+    Ptr tiled(new MKLDNNTiledChain());
+    tiled->nodes = chain;
+    try {
+        tiled->init(windows, tileRows);
+    } catch (std::exception &e) {
+        // some primitive does not accept the shape of a tile
+        return nullptr;
+    }
+    return tiled;
+}
+
+void MKLDNNTiledChain::init(const std::vector<MKLDNNNode::RowWindow> &windows, ptrdiff_t tileRows) {
+    src = nodes.front()->getParentEdgeAt(0)->getMemoryPtr();
+    dst = nodes.back()->getChildEdgeAt(0)->getMemoryPtr();
+    srcRowSize = rowSize(*src);
+    dstRowSize = rowSize(*dst);
+
+    std::vector<const MKLDNNMemory *> levels;
+    levels.push_back(src.get());
+    for (auto &node : nodes)
+        levels.push_back(&node->getChildEdgeAt(0)->getMemory());
+
+    std::vector<ptrdiff_t> heights;
+    for (auto level : levels)
+        heights.push_back(level->GetDescriptor().data.dims[2]);
+
+    // the rows [begin, end) of every level and the paddings of every node for each tile
+    struct Rows {
+        ptrdiff_t begin, end, padTop, padBottom;
+    };
+    std::vector<std::vector<Rows>> plans;
+    std::vector<ptrdiff_t> maxRows(levels.size(), 0);
+    for (ptrdiff_t row = 0; row < heights.back(); row += tileRows) {
+        std::vector<Rows> plan(levels.size());
+        plan.back() = {row, std::min(row + tileRows, heights.back()), 0, 0};
+        for (size_t i = levels.size() - 1; i > 0; i--) {
+            ptrdiff_t begin, end;
+            inputRows(windows[i - 1], plan[i].begin, plan[i].end, begin, end);
+            plan[i - 1].begin = std::max<ptrdiff_t>(0, begin);
+            plan[i - 1].end = std::min(heights[i - 1], end);
+            plan[i].padTop = plan[i - 1].begin - begin;
+            plan[i].padBottom = end - plan[i - 1].end;
+        }
+        for (size_t i = 0; i < levels.size(); i++)
+            maxRows[i] = std::max(maxRows[i], plan[i].end - plan[i].begin);
+        plans.push_back(plan);
+    }
+
+    for (size_t i = 0; i < levels.size(); i++) {
+        MKLDNNMemoryPtr buffer(new MKLDNNMemory(nodes.front()->getEngine()));
+        buffer->Create(rowsDesc(*levels[i], maxRows[i]));
+        buffers.push_back(buffer);
+    }
+    levelMemories.resize(levels.size());
+
+    // the tiles inside of the tensor have the same height and no paddings, so they share the primitives
+    std::vector<std::map<std::tuple<ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t>, primitive>> primitives(nodes.size());
+    for (auto &plan : plans) {
+        std::vector<primitive> sequence;
+        ptrdiff_t inRows = plan.front().end - plan.front().begin;
+        ptrdiff_t outRows = plan.back().end - plan.back().begin;
+        sequence.push_back(getSrcView(inRows).reorder);
+        for (size_t i = 0; i < nodes.size(); i++) {
+            ptrdiff_t rowsIn = plan[i].end - plan[i].begin;
+            ptrdiff_t rowsOut = plan[i + 1].end - plan[i + 1].begin;
+            auto key = std::make_tuple(rowsIn, rowsOut, plan[i + 1].padTop, plan[i + 1].padBottom);
+            auto it = primitives[i].find(key);
+            if (it == primitives[i].end()) {
+                auto prim = nodes[i]->createRowsPrimitive(getLevelMemory(i, rowsIn), getLevelMemory(i + 1, rowsOut),
+                                                          plan[i + 1].padTop, plan[i + 1].padBottom);
+                it = primitives[i].emplace(key, *prim).first;
+            }
+            sequence.push_back(it->second);
+        }
+        sequence.push_back(getDstView(outRows).reorder);
+
+        tiles.push_back({plan.front().begin, plan.back().begin,
+                         getSrcView(inRows).memory, getDstView(outRows).memory, sequence});
+    }
+}
+
+memory MKLDNNTiledChain::getLevelMemory(size_t level, ptrdiff_t rows) {
+    auto it = levelMemories[level].find(rows);
+    if (it == levelMemories[level].end()) {
+        memory::primitive_desc desc(rowsDesc(*buffers[level], rows), nodes.front()->getEngine());
+        it = levelMemories[level].emplace(rows, memory(desc, buffers[level]->GetData())).first;
+    }
+    return it->second;
+}
+
+const MKLDNNTiledChain::View &MKLDNNTiledChain::getSrcView(ptrdiff_t rows) {
+    auto it = srcViews.find(rows);
+    if (it == srcViews.end()) {
+        memory::desc desc = src->GetDescriptor();
+        memory::dims dims(desc.data.dims, desc.data.dims + desc.data.ndims);
+        dims[2] = static_cast<int>(rows);
+        // the view keeps the strides of the whole tensor, the first row is chosen by the data handle
+        view::primitive_desc viewDesc(src->GetPrimitive().get_primitive_desc(), dims, {0, 0, 0, 0});
+        memory rowsMemory(viewDesc.dst_primitive_desc(), src->GetData());
+        memory tileMemory = getLevelMemory(0, rows);
+        it = srcViews.emplace(rows, View{rowsMemory, mkldnn::reorder(rowsMemory, tileMemory)}).first;
+    }
+    return it->second;
+}
+
+const MKLDNNTiledChain::View &MKLDNNTiledChain::getDstView(ptrdiff_t rows) {
+    auto it = dstViews.find(rows);
+    if (it == dstViews.end()) {
+        memory::desc desc = dst->GetDescriptor();
+        memory::dims dims(desc.data.dims, desc.data.dims + desc.data.ndims);
+        dims[2] = static_cast<int>(rows);
+        view::primitive_desc viewDesc(dst->GetPrimitive().get_primitive_desc(), dims, {0, 0, 0, 0});
+        memory rowsMemory(viewDesc.dst_primitive_desc(), dst->GetData());
+        memory tileMemory = getLevelMemory(buffers.size() - 1, rows);
+        it = dstViews.emplace(rows, View{rowsMemory, mkldnn::reorder(tileMemory, rowsMemory)}).first;
+    }
+    return it->second;
+}
+
+void MKLDNNTiledChain::execute(mkldnn::stream strm) {
+    // the input and output memories may be replaced by the blobs of the request between the inferences
+    auto srcData = static_cast<uint8_t *>(src->GetData());
+    auto dstData = static_cast<uint8_t *>(dst->GetData());
+    for (auto &tile : tiles) {
+        tile.input.set_data_handle(srcData + tile.inputRow * srcRowSize);
+        tile.output.set_data_handle(dstData + tile.outputRow * dstRowSize);
+        strm.submit(tile.primitives);
+    }
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+#include "mkldnn_node.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief A chain of the spatially local nodes (convolutions, poolings, activations) executed depth-first: the output
+ * is computed by the tiles of rows, and every tile passes the whole chain before the next one starts. The rows of the
+ * chain input a tile needs (with the halos of the windows) are copied into a small buffer, the intermediate tensors of
+ * the tile live in such buffers only, so they stay in the cache instead of going to the memory at full size.
+ * The rows of the halos are computed by both neighbouring tiles.
+ */
+class MKLDNNTiledChain {
+public:
+    typedef std::shared_ptr<MKLDNNTiledChain> Ptr;
+
+    /**
+     * @brief Returns the longest chain beginning at the node whose working set exceeds the cache budget (in bytes),
+     * split to the tiles of the working set within the budget, or nullptr if there is no such chain.
+     * The primitives of the nodes have to be created.
+     */
+    static Ptr create(const MKLDNNNodePtr &head, size_t cacheBudget);
+
+    const std::vector<MKLDNNNodePtr> &getNodes() const {
+        return nodes;
+    }
+
+    size_t getTilesCount() const {
+        return tiles.size();
+    }
+
+    void execute(mkldnn::stream strm);
+
+private:
+    struct Tile {
+        // the first rows of the chain input and output in the whole tensors
+        ptrdiff_t inputRow;
+        ptrdiff_t outputRow;
+        mkldnn::memory input;
+        mkldnn::memory output;
+        std::vector<mkldnn::primitive> primitives;
+    };
+
+    MKLDNNTiledChain() = default;
+
+    void init(const std::vector<MKLDNNNode::RowWindow> &windows, ptrdiff_t tileRows);
+    // the memories of the tile buffer of the level (0 is the chain input) of the height
+    mkldnn::memory getLevelMemory(size_t level, ptrdiff_t rows);
+
+    // the rows of the whole tensor (at the offset set before the execution) and the reorder copying them
+    struct View {
+        mkldnn::memory memory;
+        mkldnn::primitive reorder;
+    };
+    const View &getSrcView(ptrdiff_t rows);
+    const View &getDstView(ptrdiff_t rows);
+
+    std::vector<MKLDNNNodePtr> nodes;
+    // the memories of the chain input and output
+    MKLDNNMemoryPtr src;
+    MKLDNNMemoryPtr dst;
+    // the offsets of a row in bytes in the chain input and output
+    size_t srcRowSize = 0;
+    size_t dstRowSize = 0;
+    // the tile buffers of the chain input, of the output of every node and their views of the tiles heights
+    std::vector<MKLDNNMemoryPtr> buffers;
+    std::vector<std::map<ptrdiff_t, mkldnn::memory>> levelMemories;
+    std::map<ptrdiff_t, View> srcViews;
+    std::map<ptrdiff_t, View> dstViews;
+    std::vector<Tile> tiles;
+};
+
+}  // namespace MKLDNNPlugin
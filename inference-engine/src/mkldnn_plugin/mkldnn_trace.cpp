@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_trace.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <set>
+#include <details/ie_exception.hpp>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// the small sequential ids of the threads are easier to read in the trace viewer than the native ones
+int currentThreadId() {
+    static std::atomic<int> threadsCount(0);
+    thread_local int id = threadsCount++;
+    return id;
+}
+
+void writeEscaped(const std::string &str, std::ostream &os) {
+    os << '"';
+    for (char c : str) {
+        switch (c) {
+            case '"': os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n"; break;
+            case '\t': os << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                       << std::dec << std::setfill(' ');
+                } else {
+                    os << c;
+                }
+        }
+    }
+    os << '"';
+}
+
+}  // namespace
+
+MKLDNNTrace::MKLDNNTrace(size_t capacity)
+        : capacity(capacity), events(new Event[capacity]), head(0), epoch(std::chrono::steady_clock::now()) {
+    if (capacity == 0)
+        THROW_IE_EXCEPTION << "The trace buffer cannot be empty";
+    for (size_t i = 0; i < capacity; i++)
+        events[i].seq.store(0, std::memory_order_relaxed);
+}
+
+int MKLDNNTrace::addLabel(const std::string &name, const std::string &category, const std::string &impl) {
+    std::lock_guard<std::mutex> lock(labelsMutex);
+    labels.push_back({name, category, impl});
+    return static_cast<int>(labels.size() - 1);
+}
+
+void MKLDNNTrace::record(int label, int stream, uint64_t start, uint64_t finish) {
+    const uint64_t pos = head.fetch_add(1, std::memory_order_relaxed);
+    Event &event = events[pos % capacity];
+
+    event.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.label.store(label, std::memory_order_relaxed);
+    event.stream.store(stream, std::memory_order_relaxed);
+    event.thread.store(currentThreadId(), std::memory_order_relaxed);
+    event.start.store(start, std::memory_order_relaxed);
+    event.finish.store(finish, std::memory_order_relaxed);
+    event.seq.store(pos + 1, std::memory_order_release);
+}
+
+size_t MKLDNNTrace::size() const {
+    return static_cast<size_t>(std::min<uint64_t>(head.load(std::memory_order_acquire), capacity));
+}
+
+void MKLDNNTrace::exportChromeTrace(std::ostream &os) const {
+    std::lock_guard<std::mutex> lock(labelsMutex);
+
+    const uint64_t last = head.load(std::memory_order_acquire);
+    const uint64_t first = last > capacity ? last - capacity : 0;
+
+    auto writeTime = [&](uint64_t ns) {
+        os << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000 << std::setfill(' ');
+    };
+
+    std::set<int> streams;
+    bool comma = false;
+    os << "{\"traceEvents\":[";
+    for (uint64_t pos = first; pos < last; pos++) {
+        const Event &event = events[pos % capacity];
+        if (event.seq.load(std::memory_order_acquire) != pos + 1)
+            continue;
+        const int label = event.label.load(std::memory_order_relaxed);
+        const int stream = event.stream.load(std::memory_order_relaxed);
+        const int thread = event.thread.load(std::memory_order_relaxed);
+        const uint64_t start = event.start.load(std::memory_order_relaxed);
+        const uint64_t finish = event.finish.load(std::memory_order_relaxed);
+        // the slot is overwritten while it is read
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (event.seq.load(std::memory_order_relaxed) != pos + 1)
+            continue;
+        if (label < 0 || static_cast<size_t>(label) >= labels.size())
+            continue;
+
+        const Label &info = labels[label];
+        if (comma) os << ",";
+        comma = true;
+        os << "\n{\"name\":";
+        writeEscaped(info.name, os);
+        os << ",\"cat\":";
+        writeEscaped(info.category, os);
+        os << ",\"ph\":\"X\",\"ts\":";
+        writeTime(start);
+        os << ",\"dur\":";
+        writeTime(finish > start ? finish - start : 0);
+        os << ",\"pid\":" << stream << ",\"tid\":" << thread << ",\"args\":{\"impl\":";
+        writeEscaped(info.impl, os);
+        os << "}}";
+        streams.insert(stream);
+    }
+    for (int stream : streams) {
+        if (comma) os << ",";
+        comma = true;
+        os << "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << stream
+           << ",\"args\":{\"name\":\"CPU stream " << stream << "\"}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
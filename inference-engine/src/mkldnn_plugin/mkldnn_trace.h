@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Execution trace of the CPU graphs.
+ * The spans (the node executions and the whole inferences) of all the streams are recorded into the fixed-size ring
+ * buffer, so the trace keeps the most recent events only. The recording is lock-free: the writer reserves the slot
+ * by the atomic increment and publishes it by the sequence number of the slot, the slots overwritten or not yet
+ * published at the time of the export are skipped.
+ * The names are registered once per node when the graph is created, so the recording does not copy any strings.
+ */
+class MKLDNNTrace {
+public:
+    typedef std::shared_ptr<MKLDNNTrace> Ptr;
+
+    explicit MKLDNNTrace(size_t capacity);
+
+    /**
+     * @brief Registers the name, the category (the layer type) and the implementation type of the span
+     * @return The label id passed to the record()
+     */
+    int addLabel(const std::string &name, const std::string &category, const std::string &impl);
+
+    /**
+     * @brief Nanoseconds since the trace creation
+     */
+    uint64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+    }
+
+    void record(int label, int stream, uint64_t start, uint64_t finish);
+
+    /**
+     * @brief The number of the events kept in the buffer
+     */
+    size_t size() const;
+
+    /**
+     * @brief Writes the kept events in the Chrome trace event format (chrome://tracing, Perfetto),
+     * the streams are shown as the processes
+     */
+    void exportChromeTrace(std::ostream &os) const;
+
+    class Scope {
+        MKLDNNTrace *trace;
+        int label, stream;
+        uint64_t start;
+
+    public:
+        Scope(MKLDNNTrace *trace, int label, int stream)
+                : trace(trace), label(label), stream(stream), start(trace ? trace->now() : 0) {}
+
+        ~Scope() { if (trace) trace->record(label, stream, start, trace->now()); }
+    };
+
+private:
+    struct Event {
+        // 0 while the slot is written, otherwise the position of the event in the trace + 1
+        std::atomic<uint64_t> seq;
+        std::atomic<int> label;
+        std::atomic<int> stream;
+        std::atomic<int> thread;
+        std::atomic<uint64_t> start;
+        std::atomic<uint64_t> finish;
+    };
+
+    struct Label {
+        std::string name;
+        std::string category;
+        std::string impl;
+    };
+
+    const size_t capacity;
+    std::unique_ptr<Event[]> events;
+    std::atomic<uint64_t> head;
+    const std::chrono::steady_clock::time_point epoch;
+
+    mutable std::mutex labelsMutex;
+    std::deque<Label> labels;
+};
+
+}  // namespace MKLDNNPlugin
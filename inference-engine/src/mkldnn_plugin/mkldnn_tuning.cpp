@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tuning.h"
+#include <ie_common.h>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "cpu_isa_traits.hpp"
+
+using namespace MKLDNNPlugin;
+
+MKLDNNTuningCache::Ptr MKLDNNTuningCache::get(const std::string &fileName) {
+    static std::mutex cachesMutex;
+    static std::map<std::string, std::weak_ptr<MKLDNNTuningCache>> caches;
+
+    std::lock_guard<std::mutex> lock(cachesMutex);
+    Ptr cache = caches[fileName].lock();
+    if (!cache) {
+        cache.reset(new MKLDNNTuningCache(fileName));
+        caches[fileName] = cache;
+    }
+    return cache;
+}
+
+std::string MKLDNNTuningCache::isaName() {
+    using namespace mkldnn::impl::cpu;
+    if (mayiuse(avx512_core_vnni))
+        return "avx512_core_vnni";
+    if (mayiuse(avx512_core))
+        return "avx512_core";
+    if (mayiuse(avx512_common))
+        return "avx512_common";
+    if (mayiuse(avx2))
+        return "avx2";
+    if (mayiuse(sse42))
+        return "sse42";
+    return "any";
+}
+
+MKLDNNTuningCache::MKLDNNTuningCache(const std::string &fileName): fileName(fileName) {
+    // the file does not exist before the first tuning
+    std::ifstream file(fileName);
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t tab = line.rfind('\t');
+        if (tab == std::string::npos || tab == 0 || tab + 1 == line.size())
+            continue;
+        entries[line.substr(0, tab)] = line.substr(tab + 1);
+    }
+}
+
+bool MKLDNNTuningCache::find(const std::string &key, std::string &impl) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto entry = entries.find(key);
+    if (entry == entries.end())
+        return false;
+    impl = entry->second;
+    return true;
+}
+
+void MKLDNNTuningCache::set(const std::string &key, const std::string &impl) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &entry = entries[key];
+    changed |= entry != impl;
+    entry = impl;
+}
+
+void MKLDNNTuningCache::save() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!changed)
+        return;
+
+    std::ofstream file(fileName, std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+        THROW_IE_EXCEPTION << "Cannot write the tuning file " << fileName;
+    for (auto &entry : entries)
+        file << entry.first << '\t' << entry.second << '\n';
+    changed = false;
+}
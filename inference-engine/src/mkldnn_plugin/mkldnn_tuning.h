@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief The implementations of the nodes chosen by timing them at the load (Config::tuningMode). The tuning file
+ * keeps a line per node: the key of the shape (see MKLDNNNode::getTuningKey) and the name of the implementation,
+ * separated by a tab. The keys begin with the ISA of the machine, so one file serves the machines of different ISA.
+ */
+class MKLDNNTuningCache {
+public:
+    typedef std::shared_ptr<MKLDNNTuningCache> Ptr;
+
+    /**
+     * @brief The cache of the file, shared by all the graphs of the process (the streams and the networks)
+     */
+    static Ptr get(const std::string &fileName);
+
+    /**
+     * @brief The name of the ISA the implementations are timed for
+     */
+    static std::string isaName();
+
+    bool find(const std::string &key, std::string &impl);
+    void set(const std::string &key, const std::string &impl);
+
+    /**
+     * @brief Writes the file if there are new implementations
+     */
+    void save();
+
+private:
+    explicit MKLDNNTuningCache(const std::string &fileName);
+
+    std::mutex mutex;
+    std::string fileName;
+    std::map<std::string, std::string> entries;
+    bool changed = false;
+};
+
+}  // namespace MKLDNNPlugin
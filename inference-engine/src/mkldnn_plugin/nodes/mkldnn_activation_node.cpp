@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_activation_node.h"
+#include "mkldnn_power_node.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <algorithm>
@@ -117,16 +118,65 @@ void MKLDNNActivationNode::createPrimitive() {
     if (prim)
         return;
 
-    auto prim_desc = createPrimitiveDescriptor<eltwise_forward::primitive_desc, eltwise_forward::desc>();
+    std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
+    auto prim_desc = attr ? createPrimitiveDescriptor<eltwise_forward::primitive_desc, eltwise_forward::desc>(*attr)
+                          : createPrimitiveDescriptor<eltwise_forward::primitive_desc, eltwise_forward::desc>();
 
     prim.reset(new eltwise_forward(prim_desc, getParentEdgeAt(0)->getMemory().GetPrimitive(),
                                 getChildEdgeAt(0)->getMemory().GetPrimitive()));
 }
 
+bool MKLDNNActivationNode::getRowWindow(RowWindow &window) {
+    // the output row is computed from the same input row
+    if (!prim || inDims.empty() || inDims[0].ndims() != 4)
+        return false;
+    window = RowWindow();
+    return true;
+}
+
+std::shared_ptr<mkldnn::primitive> MKLDNNActivationNode::createRowsPrimitive(const mkldnn::memory &src,
+                                                                             const mkldnn::memory &dst,
+                                                                             ptrdiff_t padTop, ptrdiff_t padBottom) {
+    eltwise_forward::desc desc(prop_kind::forward_scoring, getAlgorithm(), src.get_primitive_desc().desc(),
+                               getAlpha(), getBeta());
+    std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
+    auto prim_desc = attr ? eltwise_forward::primitive_desc(desc, *attr, getEngine())
+                          : eltwise_forward::primitive_desc(desc, getEngine());
+    return std::make_shared<eltwise_forward>(prim_desc, src, dst);
+}
+
 bool MKLDNNActivationNode::created() const {
     return getType() == Activation;
 }
 
+std::shared_ptr<mkldnn::primitive_attr> MKLDNNActivationNode::initPrimitiveAttr() const {
+    if (fusedWith.empty())
+        return nullptr;
+
+    // the fused chain of the elementwise nodes is computed by the same kernel
+    mkldnn::post_ops ops;
+    for (auto &node : fusedWith) {
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            ops.append_eltwise(1.0, activationNode->getAlgorithm(), activationNode->getAlpha(),
+                               activationNode->getBeta());
+            continue;
+        }
+
+        auto* powerNode = dynamic_cast<MKLDNNPowerNode *>(node.get());
+        if (powerNode) {
+            powerNode->appendPostOps(ops);
+            continue;
+        }
+
+        THROW_IE_EXCEPTION << "Node " << getName() << " cannot be fused with " << node->getName();
+    }
+
+    auto attr = std::make_shared<mkldnn::primitive_attr>();
+    attr->set_post_ops(ops);
+    return attr;
+}
+
 void MKLDNNActivationNode::initValues() {
     GenericLayer* activationLayer = getCnnLayer().get();
     if (activationLayer == nullptr)
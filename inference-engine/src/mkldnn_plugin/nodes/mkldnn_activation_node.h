@@ -24,6 +24,9 @@ public:
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void createPrimitive() override;
     bool created() const override;
+    bool getRowWindow(RowWindow &window) override;
+    std::shared_ptr<mkldnn::primitive> createRowsPrimitive(const mkldnn::memory &src, const mkldnn::memory &dst,
+                                                           ptrdiff_t padTop, ptrdiff_t padBottom) override;
 
     mkldnn::algorithm getAlgorithm() {
         if (!initialized)
@@ -46,6 +49,9 @@ public:
     MKLDNNMemoryDesc getSrcMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
     MKLDNNMemoryDesc getDstMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
 
+protected:
+    std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr() const override;
+
 private:
     void initValues();
     static Register<MKLDNNActivationNode> reg;
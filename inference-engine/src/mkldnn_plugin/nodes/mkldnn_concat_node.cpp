@@ -3,8 +3,10 @@
 //
 
 #include "mkldnn_concat_node.h"
+#include "mkldnn_quantize_node.h"
 
 #include <map>
+#include <algorithm>
 #include <utility>
 #include <vector>
 #include <mkldnn_extension_utils.h>
@@ -110,7 +112,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    if (axis != 1 || hasEltwise)
+    if (hasEltwise || (!fusedWith.empty() && !canQuantizeInPlace()))
         return;
 
     auto numOfDim = static_cast<size_t>(dstDims.ndims());
@@ -123,7 +125,31 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
     }
 
     if (this->getCnnLayer()->precision == Precision::I8) {
-        if (numOfDim == 4) {
+        if (numOfDim == 4 && isInPlaceOrder({0, 2, 3, 1})) {
+            // the inputs are written to the parts of the output, the strides of the output are set to them by
+            // initOptimalPrimitiveDescriptor
+            order = {0, 2, 3, 1};
+            SizeVector strides(numOfDim, std::numeric_limits<size_t>::max());
+            auto nhwcBlkDims = [](SizeVector dims) {
+                return SizeVector{dims[0], dims[2], dims[3], dims[1]};
+            };
+
+            config.outConfs[0].desc = TensorDesc(this->getCnnLayer()->outData[0]->getPrecision(),
+                                                 dstDims.ToSizeVector(),
+                                                 {nhwcBlkDims(dstDims.ToSizeVector()), order, offset, offsets, strides});
+            for (size_t i = 0; i < getParentEdges().size(); i++) {
+                auto parentEdge = getParentEdgeAt(i);
+                config.inConfs[i].inPlace = 0;
+                config.inConfs[i].desc = TensorDesc(iIEPrecision, parentEdge->getDims().ToSizeVector(),
+                                                    {nhwcBlkDims(parentEdge->getDims().ToSizeVector()), order, offset,
+                                                     offsets, strides});
+            }
+
+            supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+            order = {0, 1, 2, 3};
+        }
+
+        if (numOfDim == 4 && axis == 1) {
             // Here we assume NHWC layout (channels are the last)
 
             order = {0, 2, 3, 1};
@@ -156,7 +182,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
         }
-    } else {
+    } else if (isInPlaceOrder(order)) {
         SizeVector strides(numOfDim);
         strides[numOfDim - 1] = 1;
         for (size_t i = 2; i <= numOfDim; i++) {
@@ -180,7 +206,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 
-        if (numOfDim == 4lu || numOfDim == 5lu) {
+        if ((numOfDim == 4lu || numOfDim == 5lu) && axis == 1) {
             size_t blkDimsLen = numOfDim + 1;
             order.resize(blkDimsLen);
             for (size_t i = 0; i < numOfDim; i++) {
@@ -293,7 +319,7 @@ void MKLDNNConcatNode::selectOptimalPrimitiveDescriptor() {
                 canOptimize = false;
         }
     }
-    if (hasUnknown && axis == 1) {
+    if (hasUnknown) {
         if (canSelectPrimitive.size() == 1) {
             selectPrimitiveDescriptorByIndex(static_cast<int>(canSelectPrimitive[0]));
             return;
@@ -388,6 +414,19 @@ bool MKLDNNConcatNode::created() const {
     return getType() == Concatenation;
 }
 
+bool MKLDNNConcatNode::canQuantizeInPlace() {
+    // the fused quantize is applied on the output after the inputs have been written to it, so the parts of the
+    // output may only be the outputs of the producers rewriting them on every inference for the concat alone
+    const std::vector<Type> views = {Input, Reshape, Split, Concatenation, Crop};
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto parent = getParentEdgeAt(i)->getParent();
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() ||
+            std::find(views.begin(), views.end(), parent->getType()) != views.end())
+            return false;
+    }
+    return true;
+}
+
 bool MKLDNNConcatNode::isOptimized() const {
     return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].inPlace >= 0;
 }
@@ -444,6 +483,19 @@ size_t MKLDNNConcatNode::inverseOrder(const SizeVector& order, size_t axis) {
     return -1;
 }
 
+bool MKLDNNConcatNode::isInPlaceOrder(const SizeVector& order) const {
+    // an input is a dense part of every image of the output when only the batch is outer to the axis in the memory,
+    // the dims of size 1 do not matter
+    const auto& dims = getChildEdgeAt(0)->getDims();
+    if (order.empty() || order[0] != 0 || axis == 0)
+        return false;
+    for (size_t i = 1; i < order.size() && order[i] != axis; i++) {
+        if (dims[order[i]] != 1)
+            return false;
+    }
+    return true;
+}
+
 void MKLDNNConcatNode::initOptimalPrimitiveDescriptor() {
     if (!isOptimized()) {
         MKLDNNNode::initOptimalPrimitiveDescriptor();
@@ -497,8 +549,7 @@ void MKLDNNConcatNode::initOptimalPrimitiveDescriptor() {
             // This is more general and works for any "direct" Layout (such as nchw or nhwc), but it doesn't work for nchw8c
             size_t realAxis = inverseOrder(config.inConfs[0].desc.getBlockingDesc().getOrder(), axis);
             for (size_t j = realAxis; j < config.inConfs[i].desc.getBlockingDesc().getBlockDims().size(); j++) {
-                size_t jj = config.inConfs[0].desc.getBlockingDesc().getOrder()[j];
-                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[jj];
+                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[j];
             }
         } else {
             // This works for nchw and nchw8c/nchw16c
@@ -512,11 +563,12 @@ void MKLDNNConcatNode::initOptimalPrimitiveDescriptor() {
 }
 
 void MKLDNNConcatNode::execute(mkldnn::stream strm) {
+    const MKLDNNMemory& dst_memory = getChildEdgeAt(0)->getMemory();
     if (isOptimized()) {
+        MKLDNNQuantizeNode::applyFused(fusedWith, dst_memory, batchToProcess());
         return;
     }
 
-    const MKLDNNMemory& dst_memory = getChildEdgeAt(0)->getMemory();
     const mkldnn::memory::data_type data_type = dst_memory.GetDataType();
 
     const bool isInt8 = (data_type == mkldnn_s8 || data_type == mkldnn_u8);
@@ -552,4 +604,6 @@ void MKLDNNConcatNode::execute(mkldnn::stream strm) {
     } else {
         MKLDNNNode::execute(strm);
     }
+
+    MKLDNNQuantizeNode::applyFused(fusedWith, dst_memory, batchToProcess());
 }
@@ -22,6 +22,10 @@ public:
     void selectOptimalPrimitiveDescriptor() override;
     bool created() const override;
     void execute(mkldnn::stream strm) override;
+    bool isExecutable() const override {
+        // the in-place concat only applies the fused quantize
+        return !isOptimized() || !fusedWith.empty();
+    }
 
     bool isOptimized() const;
 
@@ -30,6 +34,8 @@ private:
     size_t axis = 0;
 
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
+    bool isInPlaceOrder(const InferenceEngine::SizeVector& order) const;
+    bool canQuantizeInPlace();
 };
 
 }  // namespace MKLDNNPlugin
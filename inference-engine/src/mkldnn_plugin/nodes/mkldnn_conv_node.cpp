@@ -48,6 +48,11 @@ MKLDNNConvolutionNode::MKLDNNConvolutionNode(const InferenceEngine::CNNLayerPtr&
         if (ois != layer->blobs.end()) {
             // If we can find an oi-scale, then the next layer has to be an INT8.
             oScale = ois->second;
+            // an asymmetric u8 output carries the zero points of the next layer
+            auto oish = layer->blobs.find("oi-shift");
+            if (oish != layer->blobs.end()) {
+                oShift = oish->second;
+            }
         }
     }
 }
@@ -404,6 +409,37 @@ void MKLDNNConvolutionNode::setPostOps(mkldnn::primitive_attr &attr, bool initWe
         }
     }
 
+    if (oShift != nullptr) {
+        // the zero points are added to the output after the output scales
+        if (initWeights) {
+            MKLDNNDims oShiftDims({static_cast<ptrdiff_t>(rnd_up(biasesDims[0], 16))});
+            std::vector<float> oScaleDataVector(oShiftDims[0], 1.f);
+            std::vector<float> oShiftDataVector(oShiftDims[0], 0.f);
+            float *oShiftData = static_cast<float *>(oShift->buffer());
+            for (size_t c = 0; c < oShift->size(); c++) {
+                oShiftDataVector[c] = oShiftData[c];
+            }
+
+            PostOpsIntBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+            PostOpsIntBlobMemory[blob_idx]->Create(oShiftDims, memory::data_type::f32, memory::format::x);
+            PostOpsIntBlobMemory[blob_idx]->SetData(memory::data_type::f32, memory::x, &oScaleDataVector[0],
+                                                    oScaleDataVector.size() * MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
+
+            PostOpsIntBlobMemory.push_back(MKLDNNMemoryPtr(new MKLDNNMemory(getEngine())));
+            PostOpsIntBlobMemory[blob_idx + 1]->Create(oShiftDims, memory::data_type::f32, memory::format::x);
+            PostOpsIntBlobMemory[blob_idx + 1]->SetData(memory::data_type::f32, memory::x, &oShiftDataVector[0],
+                                                        oShiftDataVector.size() * MKLDNNExtensionUtils::sizeOfDataType(memory::data_type::f32));
+
+            ops.append_depthwise(depthwise_scale_shift,
+                                 (const float *)PostOpsIntBlobMemory[blob_idx]->GetData(),
+                                 (const float *)PostOpsIntBlobMemory[blob_idx + 1]->GetData());
+
+            blob_idx += 2;
+        } else {
+            ops.append_depthwise(depthwise_scale_shift, nullptr, nullptr);
+        }
+    }
+
     attr.set_post_ops(ops);
 }
 
@@ -460,7 +496,7 @@ void MKLDNNConvolutionNode::initSupportedPrimitiveDescriptors() {
 
 
 void MKLDNNConvolutionNode::createPrimitive() {
-    if (prim)
+    if (prim || sparseWeights)
         return;
 
     mkldnn::primitive_attr attr;
@@ -469,6 +505,7 @@ void MKLDNNConvolutionNode::createPrimitive() {
 
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
+    primAttr = attr;
 
     if (internalBlobMemory.size() > 1) {
         prim.reset(new convolution_forward(prim_desc,
@@ -482,6 +519,114 @@ void MKLDNNConvolutionNode::createPrimitive() {
                                            internalBlobMemory[0]->GetPrimitive(),
                                            getChildEdgeAt(0)->getMemory().GetPrimitive()));
     }
+
+    initSparseWeights();
+}
+
+void MKLDNNConvolutionNode::initSparseWeights() {
+    // the sum, the activations and the depthwise convolutions are the post-ops of the dense primitive
+    if (getType() != Convolution || !fusedWith.empty() || isGrouped || isMerged || wScale)
+        return;
+    if (weightDims.size() != 4 || weightDims[2] != 1 || weightDims[3] != 1)
+        return;
+    for (size_t i = 0; i < stride.size(); i++) {
+        if (stride[i] != 1 || paddingL[i] != 0 || paddingR[i] != 0)
+            return;
+    }
+    // the 1x1 convolution is a product of the weights and the planes of the input
+    const MKLDNNMemory &src = getParentEdgeAt(0)->getMemory();
+    const MKLDNNMemory &dst = getChildEdgeAt(0)->getMemory();
+    if (src.GetDataType() != memory::f32 || dst.GetDataType() != memory::f32 ||
+        src.GetFormat() != memory::nchw || dst.GetFormat() != memory::nchw)
+        return;
+
+    auto sparse = MKLDNNSparseWeights::get(getName(), internalBlobs[0],
+                                           internalBlobs.size() > 1 ? internalBlobs[1] : nullptr, weightDims[0]);
+    if (!sparse)
+        return;
+
+    auto dims = src.GetDims();
+    const size_t batch = static_cast<size_t>(dims[0]);
+    const size_t planeSize = static_cast<size_t>(dims[2]) * static_cast<size_t>(dims[3]);
+    mkldnn::primitive densePrim = *prim;
+    bool faster = MKLDNNSparseWeights::isFaster(
+            [&] {
+                sparse->multiplyPlanes(static_cast<const float *>(src.GetData()), static_cast<float *>(dst.GetData()),
+                                       batch, planeSize);
+            },
+            [&] { stream(stream::kind::eager).submit({densePrim}).wait(); });
+    if (!faster)
+        return;
+
+    // the reordered dense weights are released with the primitive
+    sparseWeights = sparse;
+    prim.reset(nullptr);
+    internalBlobMemory.clear();
+}
+
+void MKLDNNConvolutionNode::execute(mkldnn::stream strm) {
+    if (sparseWeights) {
+        auto dims = getParentEdgeAt(0)->getMemory().GetDims();
+        sparseWeights->multiplyPlanes(static_cast<const float *>(getParentEdgeAt(0)->getMemory().GetData()),
+                                      static_cast<float *>(getChildEdgeAt(0)->getMemory().GetData()),
+                                      static_cast<size_t>(batchToProcess()),
+                                      static_cast<size_t>(dims[2]) * static_cast<size_t>(dims[3]));
+        return;
+    }
+    MKLDNNNode::execute(strm);
+}
+
+bool MKLDNNConvolutionNode::getRowWindow(RowWindow &window) {
+    // the sum reads the second input and the fused depthwise convolution changes the rows of the output
+    if (getType() != Convolution && getType() != Convolution_Activation)
+        return false;
+    for (auto &node : fusedWith) {
+        if (dynamic_cast<MKLDNNConvolutionNode *>(node.get()))
+            return false;
+    }
+    if (!prim || inDims.empty() || inDims[0].ndims() != 4 || internalBlobMemory.empty())
+        return false;
+
+    // the rows are the first spatial axis
+    window.extent = (static_cast<ptrdiff_t>(weightDims[weightDims.size() - 2]) - 1) * (dilation[0] + 1) + 1;
+    window.stride = stride[0];
+    window.padTop = paddingL[0];
+    return true;
+}
+
+std::shared_ptr<mkldnn::primitive> MKLDNNConvolutionNode::createRowsPrimitive(const mkldnn::memory &src,
+                                                                              const mkldnn::memory &dst,
+                                                                              ptrdiff_t padTop, ptrdiff_t padBottom) {
+    std::vector<ptrdiff_t> padL = paddingL;
+    std::vector<ptrdiff_t> padR = paddingR;
+    padL[0] = padTop;
+    padR[0] = padBottom;
+
+    memory::desc src_desc = src.get_primitive_desc().desc();
+    memory::desc dst_desc = dst.get_primitive_desc().desc();
+    memory::desc wgh_desc = internalBlobMemory[0]->GetDescriptor();
+
+    // the weights are already in the layout of the selected algorithm, the other one is rejected by MKLDNN
+    for (auto alg : {algorithm::convolution_winograd, algorithm::convolution_direct}) {
+        try {
+            std::shared_ptr<convolution_forward::desc> desc;
+            if (internalBlobMemory.size() > 1) {
+                desc.reset(new convolution_forward::desc(prop_kind::forward_scoring, alg, src_desc, wgh_desc,
+                                                         internalBlobMemory[1]->GetDescriptor(), dst_desc,
+                                                         stride, dilation, padL, padR, padding_kind::zero));
+                convolution_forward::primitive_desc prim_desc(*desc, primAttr, getEngine());
+                return std::make_shared<convolution_forward>(prim_desc, src, internalBlobMemory[0]->GetPrimitive(),
+                                                             internalBlobMemory[1]->GetPrimitive(), dst);
+            }
+            desc.reset(new convolution_forward::desc(prop_kind::forward_scoring, alg, src_desc, wgh_desc, dst_desc,
+                                                     stride, dilation, padL, padR, padding_kind::zero));
+            convolution_forward::primitive_desc prim_desc(*desc, primAttr, getEngine());
+            return std::make_shared<convolution_forward>(prim_desc, src, internalBlobMemory[0]->GetPrimitive(), dst);
+        } catch (std::exception& e) {
+            continue;
+        }
+    }
+    THROW_IE_EXCEPTION << "Primitive of the rows was not created for node " << getName() << ".";
 }
 
 bool MKLDNNConvolutionNode::created() const {
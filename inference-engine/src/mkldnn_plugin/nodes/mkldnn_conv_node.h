@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <mkldnn_sparse_weights.h>
 #include <memory>
 #include <string>
 #include <vector>
@@ -22,15 +23,21 @@ public:
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void initDescriptor(const InferenceEngine::LayerConfig& config) override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     void initSupportedPrimitiveDescriptors() override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
     }
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights);
+    bool getRowWindow(RowWindow &window) override;
+    std::shared_ptr<mkldnn::primitive> createRowsPrimitive(const mkldnn::memory &src, const mkldnn::memory &dst,
+                                                           ptrdiff_t padTop, ptrdiff_t padBottom) override;
 
 protected:
     void addScaleToPrimitiveAttr(mkldnn::primitive_attr attr) const;
+    // replaces the dense primitive of the 1x1 convolution by the sparse weights if they are faster
+    void initSparseWeights();
 
 private:
     static Register<MKLDNNConvolutionNode> reg;
@@ -55,7 +62,10 @@ private:
     std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
 
     InferenceEngine::ConvolutionLayer* convLayer;
-    InferenceEngine::Blob::Ptr wScale, oScale;
+    InferenceEngine::Blob::Ptr wScale, oScale, oShift;
+    // the post-ops and the scales the primitive is created with, shared by the primitives of the tiles
+    mkldnn::primitive_attr primAttr;
+    MKLDNNSparseWeights::Ptr sparseWeights;
 };
 
 }  // namespace MKLDNNPlugin
@@ -6,6 +6,7 @@
 #include <ie_layers.h>
 #include <string>
 #include <algorithm>
+#include <limits>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
@@ -84,6 +85,31 @@ void MKLDNNCropNode::initSupportedPrimitiveDescriptors() {
     config.outConfs[0].constant = false;
     config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, fmt);
 
+    // the output is a view of the dense planar input, it has the strides of the input and the offset of the cropped
+    // part, set by initOptimalPrimitiveDescriptor; a consumer that requires a dense input gets a reorder instead of
+    // the copy of the crop
+    bool hasOutputChild = false;
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        if (getChildEdgeAt(i)->getChild()->getType() == Output)
+            hasOutputChild = true;
+    }
+    if (offsets[0] == 0 && !hasOutputChild) {
+        SizeVector srcDims = inDims.ToSizeVector();
+        SizeVector dstDims = getChildEdgeAt(0)->getDims().ToSizeVector();
+        SizeVector order = {0, 1, 2, 3};
+        SizeVector strides(srcDims.size(), 1);
+        for (size_t i = srcDims.size() - 1; i > 0; i--)
+            strides[i - 1] = strides[i] * srcDims[i];
+        size_t offset = std::numeric_limits<size_t>::max();
+        SizeVector offsetsToData(srcDims.size(), 0);
+
+        InferenceEngine::LayerConfig viewConfig = config;
+        viewConfig.inConfs[0].desc = TensorDesc(Precision::FP32, srcDims, {srcDims, order, offset, offsetsToData, strides});
+        viewConfig.outConfs[0].inPlace = 0;
+        viewConfig.outConfs[0].desc = TensorDesc(Precision::FP32, dstDims, {dstDims, order, offset, offsetsToData, strides});
+        supportedPrimitiveDescriptors.emplace_back(viewConfig, impl_desc_type::unknown);
+    }
+
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 
     if (channelAxis >= 0 && dims[channelAxis] % 8 == 0) {
@@ -100,6 +126,38 @@ void MKLDNNCropNode::initSupportedPrimitiveDescriptors() {
     }
 }
 
+bool MKLDNNCropNode::isOptimized() const {
+    return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].inPlace >= 0;
+}
+
+void MKLDNNCropNode::initOptimalPrimitiveDescriptor() {
+    if (!isOptimized()) {
+        MKLDNNNode::initOptimalPrimitiveDescriptor();
+        return;
+    }
+
+    auto config = getSelectedPrimitiveDescriptor()->getConfig();
+    if (isInitConfig(config))
+        return;
+
+    for (size_t i = 0; i < config.inConfs.size(); i++)
+        config.inConfs[i].desc = getConfiguredInputDesc(config, i);
+
+    const auto& srcBlocking = config.inConfs[0].desc.getBlockingDesc();
+    size_t offset = srcBlocking.getOffsetPadding();
+    for (size_t i = 0; i < offsets.size(); i++)
+        offset += offsets[i] * srcBlocking.getStrides()[i];
+
+    config.outConfs[0].desc = TensorDesc(config.outConfs[0].desc.getPrecision(), config.outConfs[0].desc.getDims(), {
+                                                 config.outConfs[0].desc.getBlockingDesc().getBlockDims(),
+                                                 config.outConfs[0].desc.getBlockingDesc().getOrder(),
+                                                 offset,
+                                                 srcBlocking.getOffsetPaddingToData(),
+                                                 srcBlocking.getStrides()
+                                         });
+    initDescriptor(config);
+}
+
 void MKLDNNCropNode::createPrimitive() {
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
@@ -112,6 +170,9 @@ void MKLDNNCropNode::createPrimitive() {
 }
 
 void MKLDNNCropNode::execute(mkldnn::stream strm) {
+    if (isOptimized())
+        return;
+
     auto& parentMem = getParentEdgeAt(0)->getMemory();
 
     int m_block_size = 1;
@@ -18,12 +18,18 @@ public:
 
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
+    void initOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
     }
+    bool isExecutable() const override {
+        return !isOptimized();
+    }
+
+    bool isOptimized() const;
 
 private:
     static Register<MKLDNNCropNode> reg;
@@ -3,9 +3,11 @@
 //
 
 #include "mkldnn_deconv_node.h"
+#include "mkldnn_activation_node.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <mkldnn.hpp>
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <mkldnn_types.h>
@@ -112,53 +114,109 @@ void MKLDNNDeconvolutionNode::getSupportedDescriptors() {
 void MKLDNNDeconvolutionNode::execute(mkldnn::stream strm) {
     if (prim) {
         strm.submit({*prim});
+    } else if (!dwWeights.empty()) {
+        executeDepthwise();
     }
-    if (withBiases) {
-        const auto *bias = biases->buffer().as<const float*>();
-        auto biasSize = biases->size();
-
-        auto dst = getChildEdgeAt(0)->getBlob();
-
-        float *output = dst->buffer().as<float *>() + dst->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        auto dims_size = dst->getTensorDesc().getDims().size();
-        auto layout = dst->layout();
-
-        const size_t N = dst->getTensorDesc().getDims()[0];
-        size_t C = dst->getTensorDesc().getBlockingDesc().getBlockDims()[1] / groupNum;
-        if (C < 1) C = 1;
-        const size_t D = dims_size > 4 ? dst->getTensorDesc().getDims()[dims_size - 3] : 1lu;
-        const size_t H = dst->getTensorDesc().getDims()[dims_size - 2];
-        const size_t W = dst->getTensorDesc().getDims()[dims_size - 1];
-        size_t blkC = 1lu;
-        if (layout == BLOCKED && dst->getTensorDesc().getBlockingDesc().getBlockDims().size() > 5) {
-            blkC = dst->getTensorDesc().getBlockingDesc().getBlockDims().size() > 5 ?
-                   dst->getTensorDesc().getBlockingDesc().getBlockDims()[5] :
-                   1lu;
-        } else if (layout == BLOCKED && dst->getTensorDesc().getBlockingDesc().getBlockDims().size() > 4) {
-            blkC = dst->getTensorDesc().getBlockingDesc().getBlockDims()[4];
+    if (withBiases)
+        addBiases();
+    if (!activations.empty())
+        strm.submit(activations);
+}
+
+void MKLDNNDeconvolutionNode::addBiases() {
+    const auto *bias = biases->buffer().as<const float*>();
+    const size_t biasSize = biases->size();
+
+    const MKLDNNMemory& dstMemory = getChildEdgeAt(0)->getMemory();
+    const auto& blocking = dstMemory.GetDescriptor().data.layout_desc.blocking;
+    auto *dst = reinterpret_cast<float *>(dstMemory.GetData()) + blocking.offset_padding;
+    auto dims = dstMemory.GetDims();
+
+    const size_t C = std::min(static_cast<size_t>(dims[1]), biasSize);
+    size_t S = 1;
+    for (size_t i = 2; i < dims.size(); i++)
+        S *= static_cast<size_t>(dims[i]);
+
+    const size_t block = static_cast<size_t>(blocking.block_dims[1]);
+    const size_t strideN = static_cast<size_t>(blocking.strides[0][0]);
+    const size_t strideC = static_cast<size_t>(blocking.strides[0][1]);
+    const size_t strideBlock = static_cast<size_t>(blocking.strides[1][1]);
+    const size_t strideS = static_cast<size_t>(blocking.strides[0][dims.size() - 1]);
+
+    // the channels of a block are contiguous, so the biases of a block are added along the pixels at once
+    parallel_for2d(batchToProcess(), div_up(C, block), [&](size_t n, size_t cb) {
+        const size_t channels = std::min(block, C - cb * block);
+        const float *b = bias + cb * block;
+        float *o = dst + n * strideN + cb * strideC;
+        for (size_t s = 0; s < S; s++) {
+            float *p = o + s * strideS;
+            for (size_t c = 0; c < channels; c++)
+                p[c * strideBlock] += b[c];
         }
+    });
+}
+
+void MKLDNNDeconvolutionNode::executeDepthwise() {
+    const MKLDNNMemory& srcMemory = getParentEdgeAt(0)->getMemory();
+    const MKLDNNMemory& dstMemory = getChildEdgeAt(0)->getMemory();
+    const auto& srcBlocking = srcMemory.GetDescriptor().data.layout_desc.blocking;
+    const auto& dstBlocking = dstMemory.GetDescriptor().data.layout_desc.blocking;
+    const auto *src = reinterpret_cast<const float *>(srcMemory.GetData()) + srcBlocking.offset_padding;
+    auto *dst = reinterpret_cast<float *>(dstMemory.GetData()) + dstBlocking.offset_padding;
+
+    auto srcDims = srcMemory.GetDims();
+    auto dstDims = dstMemory.GetDims();
+    const int C = dstDims[1];
+    const int IH = srcDims[2], IW = srcDims[3];
+    const int OH = dstDims[2], OW = dstDims[3];
+    const int KH = weightsDims[3], KW = weightsDims[4];
+    const int SH = stride[0], SW = stride[1];
+    const int DH = dilation[0] + 1, DW = dilation[1] + 1;
+    const int PT = paddingL[0], PL = paddingL[1];
+    const size_t block = dwBlock;
+
+    auto strides = [](const mkldnn_blocking_desc_t& blocking) {
+        return std::vector<size_t>{static_cast<size_t>(blocking.strides[0][0]),
+                                   static_cast<size_t>(blocking.strides[0][1]),
+                                   static_cast<size_t>(blocking.strides[0][2]),
+                                   static_cast<size_t>(blocking.strides[0][3]),
+                                   static_cast<size_t>(blocking.strides[1][1])};
+    };
+    const auto srcStrides = strides(srcBlocking);
+    const auto dstStrides = strides(dstBlocking);
+
+    // the output pixel gathers only the input pixels that land on it, so no zeros are inserted between the inputs
+    // and a stride 2 kernel reads a quarter of the weights per pixel
+    parallel_for3d(batchToProcess(), div_up(C, block), OH, [&](int n, size_t cb, int oh) {
+        const size_t channels = std::min(block, C - cb * block);
+        const float *srcBlock = src + n * srcStrides[0] + cb * srcStrides[1];
+        float *dstRow = dst + n * dstStrides[0] + cb * dstStrides[1] + oh * dstStrides[2];
+        const float *weightsBlock = &dwWeights[cb * KH * KW * block];
 
-        auto strides = dst->getTensorDesc().getBlockingDesc().getStrides();
-        int output_size = strides[0] * N - dst->getTensorDesc().getBlockingDesc().getOffsetPadding();
-
-        parallel_for5d(N, C, D, H, W, [&](size_t n, size_t c, size_t d, size_t h, size_t w) {
-            for (size_t g = 0; g < groupNum; g++) {
-                const size_t off = n * strides[0]
-                                 + (g * C + c) * strides[1]
-                                 + d * strides[dims_size - 3]
-                                 + h * strides[dims_size - 2]
-                                 + w * strides[dims_size - 1];
-                if (off >= output_size) continue;
-                auto o = &output[off];
-                int gcb = g * C * blkC + c * blkC;
-                for (int bc = 0; bc < blkC; ++bc) {
-                    int index = gcb + bc;
-                    if (index < biasSize)
-                        o[bc] += bias[index];
+        for (int ow = 0; ow < OW; ow++) {
+            float acc[16] = {};
+            for (int kh = 0; kh < KH; kh++) {
+                const int th = oh + PT - kh * DH;
+                if (th < 0 || th % SH != 0 || th / SH >= IH)
+                    continue;
+                const float *srcRow = srcBlock + (th / SH) * srcStrides[2];
+
+                for (int kw = 0; kw < KW; kw++) {
+                    const int tw = ow + PL - kw * DW;
+                    if (tw < 0 || tw % SW != 0 || tw / SW >= IW)
+                        continue;
+                    const float *in = srcRow + (tw / SW) * srcStrides[3];
+                    const float *w = weightsBlock + (kh * KW + kw) * block;
+                    for (size_t c = 0; c < channels; c++)
+                        acc[c] += in[c * srcStrides[4]] * w[c];
                 }
             }
-        });
-    }
+
+            float *out = dstRow + ow * dstStrides[3];
+            for (size_t c = 0; c < channels; c++)
+                out[c * dstStrides[4]] = acc[c];
+        }
+    });
 }
 
 bool MKLDNNDeconvolutionNode::created() const {
@@ -166,16 +224,50 @@ bool MKLDNNDeconvolutionNode::created() const {
 }
 
 void MKLDNNDeconvolutionNode::createPrimitive() {
-    if (prim)
+    if (prim || !dwWeights.empty())
         return;
 
-    auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
-            convolution_backward_data::desc, convolution_forward::primitive_desc>();
+    const PrimitiveDescInfo *selected_pd = getSelectedPrimitiveDescriptor();
+    if (selected_pd == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set for node " << getName() << ".";
+
+    const MKLDNNMemory& dstMemory = getChildEdgeAt(0)->getMemory();
+    const size_t block = static_cast<size_t>(dstMemory.GetDescriptor().data.layout_desc.blocking.block_dims[1]);
+    // mkl-dnn has no jit depthwise kernel for the planar layouts and for the dilated or unevenly padded
+    // deconvolutions, its reference kernel is replaced with the direct one
+    bool useDirectDW = isDW && getChildEdgeAt(0)->getDims().ndims() == 4 && block <= 16 &&
+            (selected_pd->getImplementationType() & impl_desc_type::jit) != impl_desc_type::jit;
+
+    if (useDirectDW) {
+        const int C = getChildEdgeAt(0)->getDims()[1];
+        const int K = weightsDims[3] * weightsDims[4];
+        const auto *weights = internalBlobs[0]->buffer().as<const float *>();
 
-    prim.reset(new convolution_backward_data(prim_desc,
-            getParentEdgeAt(0)->getMemory().GetPrimitive(),
-            internalBlobMemory[0]->GetPrimitive(),
-            getChildEdgeAt(0)->getMemory().GetPrimitive()));
+        dwBlock = block;
+        dwWeights.resize(div_up(C, block) * K * block, 0.0f);
+        for (int c = 0; c < C; c++)
+            for (int k = 0; k < K; k++)
+                dwWeights[((c / block) * K + k) * block + c % block] = weights[c * K + k];
+    } else {
+        auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
+                convolution_backward_data::desc, convolution_forward::primitive_desc>();
+
+        prim.reset(new convolution_backward_data(prim_desc,
+                getParentEdgeAt(0)->getMemory().GetPrimitive(),
+                internalBlobMemory[0]->GetPrimitive(),
+                getChildEdgeAt(0)->getMemory().GetPrimitive()));
+    }
+
+    for (auto &node : fusedWith) {
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (!activationNode)
+            continue;
+
+        eltwise_forward::desc desc(prop_kind::forward_scoring, activationNode->getAlgorithm(),
+                                   dstMemory.GetDescriptor(), activationNode->getAlpha(), activationNode->getBeta());
+        eltwise_forward::primitive_desc prim_desc(desc, getEngine());
+        activations.push_back(eltwise_forward(prim_desc, dstMemory.GetPrimitive(), dstMemory.GetPrimitive()));
+    }
 }
 
 void MKLDNNDeconvolutionNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
@@ -31,6 +31,9 @@ public:
     MKLDNNMemoryDesc getDstMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
 
 private:
+    void addBiases();
+    void executeDepthwise();
+
     bool withBiases;
     bool withGroups;
     bool isDW;
@@ -44,6 +47,12 @@ private:
     InferenceEngine::Blob::Ptr biases;
     std::vector<std::shared_ptr<mkldnn::convolution_forward::desc>> descs_fwd;
     std::vector<std::shared_ptr<mkldnn::convolution_backward_data::desc>> descs_bwd;
+
+    // the fused activations run in place on the output
+    std::vector<mkldnn::primitive> activations;
+    // the depthwise weights of the direct kernel, [channel block][kh][kw][channel]
+    std::vector<float> dwWeights;
+    size_t dwBlock = 1;
 };
 
 }  // namespace MKLDNNPlugin
@@ -3,6 +3,8 @@
 //
 
 #include "mkldnn_depthwise_node.h"
+#include "mkldnn_activation_node.h"
+#include "mkldnn_power_node.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <string>
@@ -58,12 +60,106 @@ void MKLDNNDepthwiseNode::getSupportedDescriptors() {
         internalBlobs.push_back(createInternalBlob(weightDims, false));
     }
 
+    // broadcast is applied to the internal blobs, because the weights memory created from them is shared between graphs
+    if (isBroadcast()) {
+        float* weights = internalBlobs[0]->buffer().as<float*>();
+        for (size_t i = 1; i < internalBlobs[0]->size() && realWeightSize != internalBlobs[0]->size(); i++)
+            weights[i] = weights[0];
+
+        if (isWithBiases()) {
+            float* biases = internalBlobs[1]->buffer().as<float*>();
+            for (size_t i = 1; i < internalBlobs[1]->size() && realBiasSize != internalBlobs[1]->size(); i++)
+                biases[i] = biases[0];
+        }
+    }
+
+    createPostOpsBlobs();
+
     for (auto format : getAvailableFormatsForDims(parentOutDims)) {
         MKLDNNMemoryDesc in_candidate{parentOutDims, inputDataType, format};
         createDescriptor({in_candidate}, {});
     }
 }
 
+void MKLDNNDepthwiseNode::createPostOpsBlobs() {
+    auto channels = getParentEdgeAt(0)->getDims()[1];
+    MKLDNNDims depthwiseDims({static_cast<ptrdiff_t>(rnd_up(channels, 16))});
+
+    auto createBlobMemory = [&](const InferenceEngine::Blob::Ptr &blob, bool broadcast) {
+        MKLDNNMemoryPtr blobMemory(new MKLDNNMemory(getEngine()));
+        blobMemory->Create(depthwiseDims, memory::data_type::f32, memory::format::x);
+        // the missing biases stay zero
+        if (blob) {
+            if (!broadcast && blob->size() != static_cast<size_t>(channels))
+                THROW_IE_EXCEPTION << "Cannot fuse layer " << getName() << ": Incorrect weights of the fused layer!";
+            auto *src = blob->buffer().as<float *>();
+            auto *dst = static_cast<float *>(blobMemory->GetData());
+            for (size_t c = 0; c < static_cast<size_t>(channels); c++)
+                dst[c] = broadcast ? src[0] : src[c];
+        }
+        PostOpsIntBlobMemory.push_back(blobMemory);
+    };
+
+    for (auto &node : fusedWith) {
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (!depthwiseNode)
+            continue;
+
+        auto* depthwiseLayer = dynamic_cast<WeightableLayer*>(depthwiseNode->getCnnLayer().get());
+        if (depthwiseLayer == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get weightable layer for node " << depthwiseNode->getName() << ".";
+
+        createBlobMemory(depthwiseLayer->_weights, depthwiseNode->isBroadcast());
+        if (depthwiseNode->getAlgorithm() == depthwise_scale_shift)
+            createBlobMemory(depthwiseLayer->_biases, depthwiseNode->isBroadcast());
+    }
+}
+
+std::shared_ptr<mkldnn::primitive_attr> MKLDNNDepthwiseNode::initPrimitiveAttr() const {
+    if (fusedWith.empty())
+        return nullptr;
+
+    // the fused chain of the elementwise nodes is computed by the same kernel
+    int blob_idx = 0;
+    mkldnn::post_ops ops;
+    for (auto &node : fusedWith) {
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            ops.append_eltwise(1.0, activationNode->getAlgorithm(), activationNode->getAlpha(),
+                               activationNode->getBeta());
+            continue;
+        }
+
+        auto* powerNode = dynamic_cast<MKLDNNPowerNode *>(node.get());
+        if (powerNode) {
+            powerNode->appendPostOps(ops);
+            continue;
+        }
+
+        auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode *>(node.get());
+        if (depthwiseNode) {
+            if (depthwiseNode->getAlgorithm() == depthwise_scale_shift) {
+                ops.append_depthwise(depthwise_scale_shift,
+                                     static_cast<const float *>(PostOpsIntBlobMemory[blob_idx]->GetData()),
+                                     static_cast<const float *>(PostOpsIntBlobMemory[blob_idx + 1]->GetData()));
+                blob_idx += 2;
+            } else {
+                ops.append_depthwise(depthwiseNode->getAlgorithm(),
+                                     static_cast<const float *>(PostOpsIntBlobMemory[blob_idx]->GetData()),
+                                     nullptr);
+                blob_idx += 1;
+            }
+            continue;
+        }
+
+        THROW_IE_EXCEPTION << "Node " << getName() << " cannot be fused with " << node->getName();
+    }
+
+    auto attr = std::make_shared<mkldnn::primitive_attr>();
+    attr->set_post_ops(ops);
+    return attr;
+}
+
 void MKLDNNDepthwiseNode::createPrimitive() {
     if (prim)
         return;
@@ -77,23 +173,11 @@ void MKLDNNDepthwiseNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
 
-    auto prim_desc = createPrimitiveDescriptor<depthwise_forward::primitive_desc, depthwise_forward::desc>();
+    std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
+    auto prim_desc = attr ? createPrimitiveDescriptor<depthwise_forward::primitive_desc, depthwise_forward::desc>(*attr)
+                          : createPrimitiveDescriptor<depthwise_forward::primitive_desc, depthwise_forward::desc>();
 
-    if (isBroadcast()) {
-        float broadcastValue = static_cast<float*>(internalBlobMemory[0]->GetData())[0];
-        size_t blbSize = internalBlobMemory[0]->GetPrimitiveDescriptor().desc().data.dims[0];
-        for (int i = 1; i < blbSize && realWeightSize != blbSize; i++) {
-            static_cast<float*>(internalBlobMemory[0]->GetData())[i] = broadcastValue;
-        }
-
-        if (isWithBiases()) {
-            blbSize = internalBlobMemory[1]->GetPrimitiveDescriptor().desc().data.dims[0];
-            broadcastValue = static_cast<float*>(internalBlobMemory[1]->GetData())[0];
-            for (int i = 1; i < blbSize && realBiasSize != blbSize; i++) {
-                static_cast<float*>(internalBlobMemory[1]->GetData())[i] = broadcastValue;
-            }
-        }
-    } else {
+    if (!isBroadcast()) {
         size_t blbSize = internalBlobMemory[0]->GetPrimitiveDescriptor().desc().data.dims[0];
         if (realWeightSize != blbSize)
             THROW_IE_EXCEPTION << "Cannot create layer " << getName() << ": Incorrect weights!";
@@ -42,8 +42,12 @@ public:
         return broadcast;
     }
 
+protected:
+    std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr() const override;
+
 private:
     void initValues();
+    void createPostOpsBlobs();
     bool initialized = false;
 
     static Register<MKLDNNDepthwiseNode> reg;
@@ -53,6 +57,9 @@ private:
     size_t realBiasSize = 0;
     bool withBiases;
     bool broadcast;
+
+    // weights and biases of the fused depthwise nodes, padded to the channel block
+    std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
 };
 
 }  // namespace MKLDNNPlugin
@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_eltwise_node.h"
+#include "mkldnn_quantize_node.h"
 #include <ie_layers.h>
 #include <string>
 #include <vector>
@@ -128,6 +129,10 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
     };
 
     for (const auto& format : getAvailableFormatsForDims(getChildEdgeAt(0)->getDims())) {
+        // the broadcasting kernels address the inputs by the strides of the dense planar layout
+        if (broadcast && format != MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims()))
+            continue;
+
         mkldnn::memory::data_type inputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(getCnnLayer()->precision);
         mkldnn::memory::data_type outputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(getCnnLayer()->precision);
         supportedPrimitiveDescriptors.push_back(initDesc(inputDT, outputDT, format));
@@ -1980,6 +1985,7 @@ void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
                 ref_eltwise<uint8_t, uint8_t>(0, 1);
             else
                 THROW_IE_EXCEPTION << "If Eltwise node has more than 2 inputs, only FP32, I32, I8, U8 are supported";
+            MKLDNNQuantizeNode::applyFused(fusedWith, getChildEdgeAt(0)->getMemory(), batchToProcess());
             return;
         }
 
@@ -2009,6 +2015,8 @@ void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
             ref_eltwise<int32_t, int32_t>(0, 1);
         }
     }
+
+    MKLDNNQuantizeNode::applyFused(fusedWith, getChildEdgeAt(0)->getMemory(), batchToProcess());
 }
 
 bool MKLDNNEltwiseNode::created() const {
@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_fullyconnected_node.h"
+#include "mkldnn_quantize_node.h"
 #include "mkldnn_activation_node.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
@@ -122,7 +123,7 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
 }
 
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || sparseWeights || compressedWeights)
         return;
 
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
@@ -147,6 +148,89 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
                                              internalBlobMemory[0]->GetPrimitive(),
                                              getChildEdgeAt(0)->getMemory().GetPrimitive()));
     }
+
+    initSparseWeights();
+    if (!sparseWeights && int8WeightsCompression)
+        initCompressedWeights();
+}
+
+bool MKLDNNFullyConnectedNode::canMultiplyRows() const {
+    // the activations are the post-ops of the dense primitive, the rows multiplication has no epilogue
+    if (getType() != FullyConnected || !fusedWith.empty() || wScale)
+        return false;
+    const MKLDNNMemory &src = getParentEdgeAt(0)->getMemory();
+    const MKLDNNMemory &dst = getChildEdgeAt(0)->getMemory();
+    // the columns of the weights follow the plain layouts of the input only
+    auto srcFormat = src.GetFormat();
+    return src.GetDataType() == memory::f32 && dst.GetDataType() == memory::f32 && dst.GetFormat() == memory::nc &&
+           (srcFormat == memory::nc || srcFormat == memory::nchw || srcFormat == memory::ncdhw);
+}
+
+void MKLDNNFullyConnectedNode::initSparseWeights() {
+    if (!canMultiplyRows())
+        return;
+    const MKLDNNMemory &src = getParentEdgeAt(0)->getMemory();
+    const MKLDNNMemory &dst = getChildEdgeAt(0)->getMemory();
+
+    auto sparse = MKLDNNSparseWeights::get(getName(), internalBlobs[0],
+                                           internalBlobs.size() > 1 ? internalBlobs[1] : nullptr, weightsDims[0]);
+    if (!sparse)
+        return;
+
+    const size_t batch = static_cast<size_t>(src.GetDims()[0]);
+    mkldnn::primitive densePrim = *prim;
+    bool faster = MKLDNNSparseWeights::isFaster(
+            [&] { sparse->multiplyRows(static_cast<const float *>(src.GetData()), static_cast<float *>(dst.GetData()), batch); },
+            [&] { stream(stream::kind::eager).submit({densePrim}).wait(); });
+    if (!faster)
+        return;
+
+    // the reordered dense weights are released with the primitive
+    sparseWeights = sparse;
+    prim.reset(nullptr);
+    internalBlobMemory.clear();
+}
+
+void MKLDNNFullyConnectedNode::initCompressedWeights() {
+    if (!canMultiplyRows() || internalBlobs[0]->byteSize() < MKLDNNCompressedWeights::minBytes)
+        return;
+    const MKLDNNMemory &src = getParentEdgeAt(0)->getMemory();
+    const MKLDNNMemory &dst = getChildEdgeAt(0)->getMemory();
+
+    auto compressed = MKLDNNCompressedWeights::get(getName(), internalBlobs[0],
+                                                   internalBlobs.size() > 1 ? internalBlobs[1] : nullptr, weightsDims[0]);
+    if (!compressed)
+        return;
+
+    const size_t batch = static_cast<size_t>(src.GetDims()[0]);
+    mkldnn::primitive densePrim = *prim;
+    bool faster = MKLDNNSparseWeights::isFaster(
+            [&] { compressed->multiplyRows(static_cast<const float *>(src.GetData()), static_cast<float *>(dst.GetData()), batch); },
+            [&] { stream(stream::kind::eager).submit({densePrim}).wait(); });
+    if (!faster)
+        return;
+
+    compressedWeights = compressed;
+    prim.reset(nullptr);
+    internalBlobMemory.clear();
+}
+
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (compressedWeights) {
+        compressedWeights->multiplyRows(static_cast<const float *>(getParentEdgeAt(0)->getMemory().GetData()),
+                                        static_cast<float *>(getChildEdgeAt(0)->getMemory().GetData()),
+                                        static_cast<size_t>(batchToProcess()));
+        return;
+    }
+    if (sparseWeights) {
+        // the memories may be replaced by the blobs of the request between the inferences
+        sparseWeights->multiplyRows(static_cast<const float *>(getParentEdgeAt(0)->getMemory().GetData()),
+                                    static_cast<float *>(getChildEdgeAt(0)->getMemory().GetData()),
+                                    static_cast<size_t>(batchToProcess()));
+        return;
+    }
+    MKLDNNNode::execute(strm);
+    MKLDNNQuantizeNode::applyFused(fusedWith, getChildEdgeAt(0)->getMemory(), batchToProcess());
 }
 
 bool MKLDNNFullyConnectedNode::created() const {
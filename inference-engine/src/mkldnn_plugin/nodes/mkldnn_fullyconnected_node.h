@@ -6,6 +6,8 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <mkldnn_compressed_weights.h>
+#include <mkldnn_sparse_weights.h>
 #include <memory>
 #include <string>
 #include <vector>
@@ -19,11 +21,19 @@ public:
 
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
     }
 
+    /**
+     * @brief Allows the INT8 weights with the FP32 compute if they are faster than the dense primitive
+     */
+    void setInt8WeightsCompression() {
+        int8WeightsCompression = true;
+    }
+
     const std::vector<impl_desc_type>& getPrimitivesPriority() override;
     void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
@@ -36,6 +46,16 @@ private:
     InferenceEngine::SizeVector weightsDims;
     InferenceEngine::SizeVector biasesDims;
     mkldnn::memory::format weightsFormatForSrcFormat(mkldnn::memory::format sourceFormat);
+    // the plain FP32 input and output without the fused operations of the dense primitive
+    bool canMultiplyRows() const;
+    // replaces the dense primitive by the sparse weights if they are faster
+    void initSparseWeights();
+    // replaces the dense primitive by the INT8 weights if they are faster
+    void initCompressedWeights();
+
+    MKLDNNSparseWeights::Ptr sparseWeights;
+    MKLDNNCompressedWeights::Ptr compressedWeights;
+    bool int8WeightsCompression = false;
 
     InferenceEngine::Blob::Ptr wScale, oScale;
 };
@@ -11,6 +11,7 @@
 #include <cmath>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -66,8 +67,10 @@ void MKLDNNGemmNode::getSupportedDescriptors() {
         if (inDims2.ndims() != outDims.ndims())
             THROW_IE_EXCEPTION << "Invalid dims count for layer " << getName();
 
-        if (inDims2[yAxis] != outDims[yAxis] || inDims2[xAxis] != outDims[xAxis])
+        // the third input is either a matrix or a row broadcast over the rows of the output
+        if ((inDims2[yAxis] != outDims[yAxis] && inDims2[yAxis] != 1) || inDims2[xAxis] != outDims[xAxis])
             THROW_IE_EXCEPTION << "Spatial input and output dimensions are incorrect for layer " << getName();
+        isRowBroadcast = inDims2[yAxis] != outDims[yAxis];
     }
 
     for (int dim_idx = nDims - 3; dim_idx >= 0; dim_idx--) {
@@ -181,45 +184,51 @@ void MKLDNNGemmNode::execute(mkldnn::stream strm) {
     int ldb = transposeB ? K : N;
     int ldc = N;
 
-    const float *src2_ptr;
+    const int batches = MB1 * MB2;
+    auto batchOffset = [&](int b, const std::vector<int>& offsets) {
+        return (b / MB2) * offsets[1] + (b % MB2) * offsets[0];
+    };
+
+    float gemmBeta = 0.f;
     if (isThreeInputs) {
         auto& srcMemory2 = getParentEdgeAt(2)->getMemory();
-        src2_ptr = reinterpret_cast<const float *>(srcMemory2.GetData()) +
+        const float *src2_ptr = reinterpret_cast<const float *>(srcMemory2.GetData()) +
                                 srcMemory2.GetDescriptor().data.layout_desc.blocking.offset_padding;
-    } else {
-        src2_ptr = dst_ptr;
-    }
-
-    if (!isThreeInputs) {
-        beta = 0.f;
-    }
-
-    for (int b1 = 0; b1 < MB1; b1++) {
-        const float *a_ptr = src0_ptr;
-        const float *b_ptr = src1_ptr;
-        const float *c_ptr = src2_ptr;
-        float *d_ptr = dst_ptr;
-
-        for (int b2 = 0; b2 < MB2; b2++) {
-            if (isThreeInputs) {
+        // the sgemm accumulates to the output, so the third input is put to it first and scaled by beta with the product
+        parallel_for(batches, [&](int b) {
+            const float *c_ptr = src2_ptr + batchOffset(b, cOffsets);
+            float *d_ptr = dst_ptr + b * M * N;
+            if (isRowBroadcast) {
+                for (int m = 0; m < M; m++)
+                    memcpy(d_ptr + m * N, c_ptr, N * sizeof(float));
+            } else {
                 memcpy(d_ptr, c_ptr, M * N * sizeof(float));
-                c_ptr += cOffsets[0];
             }
+        });
+        gemmBeta = beta;
+    }
 
-            mkldnn_sgemm(&transb, &transa, &N, &M, &K, &alpha, b_ptr, &ldb, a_ptr, &lda, &beta, d_ptr, &ldc);
-
-            a_ptr += aOffsets[0];
-            b_ptr += bOffsets[0];
-            d_ptr += M * N;
-        }
+    // the matrices of the batch that share the second input and lie one after another are multiplied as a single one
+    const bool sharedB = (MB2 == 1 || bOffsets[0] == 0) && (MB1 == 1 || bOffsets[1] == 0);
+    const bool denseA = (MB2 == 1 || aOffsets[0] == M * K) && (MB1 == 1 || aOffsets[1] == MB2 * M * K);
+    if (batches > 1 && sharedB && denseA && !transposeA) {
+        const int batchM = batches * M;
+        mkldnn_sgemm(&transb, &transa, &N, &batchM, &K, &alpha, src1_ptr, &ldb, src0_ptr, &lda, &gemmBeta, dst_ptr, &ldc);
+        return;
+    }
 
-        src0_ptr += aOffsets[1];
-        src1_ptr += bOffsets[1];
-        dst_ptr += MB2 * M * N;
+    auto gemm = [&](int b) {
+        mkldnn_sgemm(&transb, &transa, &N, &M, &K, &alpha, src1_ptr + batchOffset(b, bOffsets), &ldb,
+                     src0_ptr + batchOffset(b, aOffsets), &lda, &gemmBeta, dst_ptr + b * M * N, &ldc);
+    };
 
-        if (isThreeInputs) {
-            src2_ptr += cOffsets[1];
-        }
+    // a small multiplication does not load all the cores, so many of them are run in parallel, each on a single thread
+    const size_t gemmSize = static_cast<size_t>(M) * N * K;
+    if (batches > 1 && (batches >= parallel_get_max_threads() || gemmSize <= smallGemmSize)) {
+        parallel_for(batches, gemm);
+    } else {
+        for (int b = 0; b < batches; b++)
+            gemm(b);
     }
 }
 
@@ -34,6 +34,10 @@ private:
     int yAxis;
 
     bool isThreeInputs;
+    bool isRowBroadcast = false;
+
+    // the multiplications of this size and less are parallelized over the batch
+    static const size_t smallGemmSize = 128 * 128 * 64;
 
     std::vector<int> aOffsets;
     std::vector<int> bOffsets;
@@ -60,6 +60,15 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
 
 void MKLDNNGenericNode::createPrimitive() {
     if (extFactory) {
+        // the implementation is selected by initDescriptor, the edges are allocated before the primitives
+        execImpl = impls.empty() ? nullptr : dynamic_cast<InferenceEngine::ILayerExecImpl *>(impls[0].get());
+        batchBlobs.clear();
+        blobs = nullptr;
+        if (execImpl != nullptr) {
+            blobs = &batchBlobs[dynBatchLim];
+            blobsBatchLim = dynBatchLim;
+            prepareBlobs(*blobs);
+        }
         return;
     }
     if (getSelectedPrimitiveDescriptor() == nullptr)
@@ -84,8 +93,10 @@ bool MKLDNNGenericNode::created(const MKLDNNExtensionManager::Ptr &extMgr) {
         // it will destroyed before extensibility primitives
         extFactory.reset(extMgr->CreateExtensionFactory(getCnnLayer()));
 
-        if (extFactory)
+        if (extFactory) {
+            extensionManager = extMgr;
             setType(Generic);
+        }
     }
     return created();
 }
@@ -95,13 +106,55 @@ void MKLDNNGenericNode::cleanup() {
     extFactory.reset();
 }
 
-void MKLDNNGenericNode::execLayer() {
+InferenceEngine::CNNLayerPtr MKLDNNGenericNode::fuseScaleShift(const InferenceEngine::Blob::Ptr& weights,
+                                                              const InferenceEngine::Blob::Ptr& biases) {
+    if (!extensionManager || !extFactory || !impls.empty())
+        return nullptr;
+    // a replacement extension of the same type would silently drop the blobs it does not know about
+    if (extensionManager->GetExtensionDescription(getCnnLayer()) != "ie-cpu-ext")
+        return nullptr;
+
+    // the layer is shared with the graphs of the other streams, so the node gets its own copy
+    auto layer = std::make_shared<InferenceEngine::CNNLayer>(*getCnnLayer());
+    layer->blobs["fused_weights"] = weights;
+    if (biases)
+        layer->blobs["fused_biases"] = biases;
+
+    InferenceEngine::ILayerImplFactory::Ptr factory(extensionManager->CreateExtensionFactory(layer));
+    if (!factory)
+        return nullptr;
+
+    extFactory = factory;
+    return layer;
+}
+
+bool MKLDNNGenericNode::blobsAreActual(const LayerBlobs &blobs) const {
+    if (blobs.data.size() != getParentEdges().size() + getChildEdges().size())
+        return false;
+    size_t k = 0;
+    for (size_t i = 0; i < getParentEdges().size(); i++, k++) {
+        if (blobs.data[k] != getParentEdges()[i].lock()->getMemory().GetData())
+            return false;
+    }
+    for (size_t i = 0; i < getChildEdges().size(); i++, k++) {
+        if (blobs.data[k] != getChildEdges()[i].lock()->getMemory().GetData())
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNGenericNode::prepareBlobs(LayerBlobs &blobs) {
     bool isDynBatch = dynBatchLim > 0;
-    std::vector<InferenceEngine::Blob::Ptr> inputs;
     std::vector<InferenceEngine::TensorDesc> inputDescs;
     std::vector<InferenceEngine::TensorDesc> outputDescs;
+    auto &inputs = blobs.inputs;
+    auto &outputs = blobs.outputs;
+    inputs.clear();
+    outputs.clear();
+    blobs.data.clear();
     for (size_t i = 0; i < getParentEdges().size(); i++) {
         inputs.push_back(getParentEdgeAt(i)->getBlob());
+        blobs.data.push_back(getParentEdgeAt(i)->getMemory().GetData());
         if (isDynBatch && dynBatchLim >= inputs[inputs.size() - 1]->getTensorDesc().getDims()[0]) {
             isDynBatch = false;
         } else {
@@ -124,7 +177,6 @@ void MKLDNNGenericNode::execLayer() {
             inputs[i] = make_blob_with_precision(td, getParentEdgeAt(i)->getMemory().GetData());
         }
     }
-    std::vector<InferenceEngine::Blob::Ptr> outputs;
     for (size_t i = 0; i < getChildEdges().size(); i++) {
         if (isDynBatch) {
             size_t idx = i >= outputDescs.size() ? 0 : i;
@@ -134,14 +186,24 @@ void MKLDNNGenericNode::execLayer() {
         } else {
             outputs.push_back(getChildEdgeAt(i)->getBlob());
         }
+        blobs.data.push_back(getChildEdgeAt(i)->getMemory().GetData());
     }
-    auto * execImpl = dynamic_cast<InferenceEngine::ILayerExecImpl *>(impls[0].get());
-    if (execImpl != nullptr) {
-        InferenceEngine::ResponseDesc resp;
-        InferenceEngine::StatusCode rc = execImpl->execute(inputs, outputs, &resp);
-        if (rc != InferenceEngine::OK) {
-            THROW_IE_EXCEPTION << resp.msg;
-        }
+}
+
+void MKLDNNGenericNode::execLayer() {
+    if (execImpl == nullptr)
+        return;
+    if (blobs == nullptr || blobsBatchLim != dynBatchLim) {
+        blobs = &batchBlobs[dynBatchLim];
+        blobsBatchLim = dynBatchLim;
+    }
+    if (!blobsAreActual(*blobs))
+        prepareBlobs(*blobs);
+
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::StatusCode rc = execImpl->execute(blobs->inputs, blobs->outputs, &resp);
+    if (rc != InferenceEngine::OK) {
+        THROW_IE_EXCEPTION << resp.msg;
     }
 }
 
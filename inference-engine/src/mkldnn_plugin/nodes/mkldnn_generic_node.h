@@ -7,6 +7,7 @@
 #include <ie_iextension.h>
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <map>
 #include <string>
 #include <vector>
 #include <memory>
@@ -33,12 +34,37 @@ public:
     void execLayer();
     void cleanup() override;
 
+    // Folds a per channel ScaleShift into the layer of the built-in CPU extension: a copy of the layer gets the
+    // "fused_weights" and "fused_biases" blobs and the factory is recreated from it. Returns the copy the node
+    // has to use from now on, or nullptr if the layer cannot take the ScaleShift.
+    InferenceEngine::CNNLayerPtr fuseScaleShift(const InferenceEngine::Blob::Ptr& weights,
+                                                const InferenceEngine::Blob::Ptr& biases);
+
 
 protected:
     InferenceEngine::ILayerImplFactory::Ptr extFactory;
     std::vector<InferenceEngine::ILayerImpl::Ptr> impls;
+    MKLDNNExtensionManager::Ptr extensionManager;
 
 private:
+    struct LayerBlobs {
+        std::vector<InferenceEngine::Blob::Ptr> inputs;
+        std::vector<InferenceEngine::Blob::Ptr> outputs;
+        // the data of the parent edges followed by the data of the child edges the blobs were built for
+        std::vector<void *> data;
+    };
+
+    // Wraps the memory of the edges into the blobs passed to the layer, cut to the dynamic batch limit.
+    // They are rebuilt only when the memory of an edge moves (a user blob, the scratch arena)
+    void prepareBlobs(LayerBlobs &blobs);
+    bool blobsAreActual(const LayerBlobs &blobs) const;
+
+    InferenceEngine::ILayerExecImpl *execImpl = nullptr;
+    // the blobs of the dynamic batch limits seen so far and the ones of the current limit
+    std::map<int, LayerBlobs> batchBlobs;
+    LayerBlobs *blobs = nullptr;
+    int blobsBatchLim = 0;
+
     static Register<MKLDNNGenericNode> reg;
 };
 
@@ -21,6 +21,9 @@ public:
     bool created() const override;
 
     void execute(mkldnn::stream strm) override;
+    bool isExecutable() const override {
+        return constBlob != nullptr;
+    }
     void withMeanImage() {
         isMeanImage = true;
     }
@@ -12,15 +12,7 @@ using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
 MKLDNNMemoryOutputNode::MKLDNNMemoryOutputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng)
-        : MKLDNNNode(layer, eng) , MKLDNNMemoryNode(layer) {
-    if (created()) {
-        MKLDNNMemoryNodeVirtualEdge::registerOutput(this);
-    }
-}
-
-MKLDNNMemoryOutputNode::~MKLDNNMemoryOutputNode() {
-    MKLDNNMemoryNodeVirtualEdge::remove(this);
-}
+        : MKLDNNNode(layer, eng) , MKLDNNMemoryNode(layer) {}
 
 void MKLDNNMemoryOutputNode::getSupportedDescriptors() {}
 
@@ -48,7 +40,27 @@ const MKLDNNEdgePtr MKLDNNMemoryOutputNode::getChildEdgeAt(size_t idx) const {
     return MKLDNNNode::getChildEdgeAt(idx);
 }
 
+void MKLDNNMemoryOutputNode::setPingPongEdges(const std::vector<MKLDNNEdgePtr> &produced,
+                                              const std::vector<MKLDNNEdgePtr> &state) {
+    producedEdges.assign(produced.begin(), produced.end());
+    stateEdges.assign(state.begin(), state.end());
+}
+
 void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
+    if (!producedEdges.empty()) {
+        // the producer writes the next state into the buffer which has been read by this inference.
+        // The edges are all the edges on the two buffers, the in-place ones included, and both the mkl-dnn primitives
+        // and the nodes with their own kernels read the data handle of the edge memory on every execution, so every
+        // consumer of the swapped buffer reads the new handle
+        void *produced = producedEdges[0].lock()->getMemory().GetPrimitive().get_data_handle();
+        void *state = stateEdges[0].lock()->getMemory().GetPrimitive().get_data_handle();
+        for (auto &edge : producedEdges)
+            edge.lock()->getMemory().GetPrimitivePtr()->set_data_handle(state);
+        for (auto &edge : stateEdges)
+            edge.lock()->getMemory().GetPrimitivePtr()->set_data_handle(produced);
+        return;
+    }
+
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
     const float *src_ptr = reinterpret_cast<const float*>(srcMemory.GetData()) +
@@ -71,38 +83,4 @@ std::string MKLDNNMemoryInputNode::idFromCombinedName(std::string name) {
 }
 
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng)
-        : MKLDNNInputNode(layer, eng), MKLDNNMemoryNode(layer) {
-    if (created()) {
-        MKLDNNMemoryNodeVirtualEdge::registerInput(this);
-    }
-}
-
-MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
-    MKLDNNMemoryNodeVirtualEdge::remove(this);
-}
-
-void MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
-    // in case of output already registered
-    auto sibling = MKLDNNMemoryNodeVirtualEdge::getByName(node->getId());
-    if (sibling != nullptr) {
-        auto outputNode = dynamic_cast<MKLDNNMemoryOutputNode*>(sibling);
-        IE_ASSERT(outputNode != nullptr);
-        outputNode->setInputNode(node);
-    } else {
-        getExisted()[node->getId()] = node;
-    }
-    // std::cout <<"[register] " << node << ", size="<< getExisted().size() <<"\n" << std::flush;
-}
-
-void MKLDNNMemoryNodeVirtualEdge::registerOutput(MKLDNNMemoryOutputNode * node) {
-    // in case of output layer
-    auto sibling = MKLDNNMemoryNodeVirtualEdge::getByName(node->getId());
-    if (sibling != nullptr) {
-        auto inputNode = dynamic_cast<MKLDNNMemoryInputNode*>(sibling);
-        IE_ASSERT(inputNode != nullptr);
-        node->setInputNode(inputNode);
-    } else {
-        getExisted()[node->getId()] = node;
-    }
-    // std::cout <<"[register] " << node << ", size="<< getExisted().size() <<"\n" << std::flush;
-}
+        : MKLDNNInputNode(layer, eng), MKLDNNMemoryNode(layer) {}
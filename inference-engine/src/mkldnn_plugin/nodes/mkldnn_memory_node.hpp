@@ -5,12 +5,11 @@
 #pragma once
 
 #include <ie_common.h>
-#include "ie_algorithm.hpp"
 #include "mkldnn_input_node.h"
 #include <mkldnn_node.h>
 #include <string>
 #include <memory>
-#include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -29,43 +28,10 @@ class MKLDNNMemoryNode {
     }
     virtual void setInputNode(MKLDNNNode *) = 0;
 };
-class MKLDNNMemoryOutputNode;
-class MKLDNNMemoryInputNode;
-
-/**
- * @brief
- * TODO: ATTENTION: this is a temporary solution, this connection should be keep in graph
- */
-class MKLDNNMemoryNodeVirtualEdge {
-    using Holder = std::map<std::string, MKLDNNMemoryNode*>;
-    static Holder & getExisted() {
-        static Holder existed;
-        return existed;
-    }
-
-    static MKLDNNMemoryNode * getByName(std::string name) {
-        auto result = getExisted().find(name);
-        if (result != getExisted().end()) {
-            return result->second;
-        }
-        return nullptr;
-    }
-
- public:
-    static void registerOutput(MKLDNNMemoryOutputNode * node);
-    static void registerInput(MKLDNNMemoryInputNode * node);
-    static void remove(MKLDNNMemoryNode * node) {
-        InferenceEngine::details::erase_if(getExisted(), [&](const Holder::value_type & it){
-            return it.second == node;
-        });
-        // std::cout <<"[remove]   " << node << ", size="<< getExisted().size() <<"\n" << std::flush;
-    }
-};
-
 class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
  public:
     MKLDNNMemoryOutputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
-    ~MKLDNNMemoryOutputNode() override;
+    ~MKLDNNMemoryOutputNode() override = default;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
     const MKLDNNEdgePtr getChildEdgeAt(size_t idx) const override;
@@ -78,11 +44,24 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     void setInputNode(MKLDNNNode* node) override {
         inputNode = node;
     }
+    MKLDNNNode* getInputNode() const {
+        return inputNode;
+    }
+
+    /**
+     * @brief Makes the node swap the two buffers of the state instead of copying the new state into the old one:
+     * the edges of the produced state and the edges of the state read by the paired input are repointed to the
+     * buffer of each other after every inference
+     */
+    void setPingPongEdges(const std::vector<MKLDNNEdgePtr> &produced, const std::vector<MKLDNNEdgePtr> &state);
  private:
     /**
-     * @brief keeps reference to input sibling node
+     * @brief keeps reference to input sibling node, the graph pairs the nodes of the same id
      */
     MKLDNNNode* inputNode = nullptr;
+    // the edges on the buffers of the ping-pong, empty if the state is copied
+    std::vector<MKLDNNEdgeWeakPtr> producedEdges;
+    std::vector<MKLDNNEdgeWeakPtr> stateEdges;
     static Register<MKLDNNMemoryOutputNode> reg;
 };
 
@@ -93,7 +72,7 @@ class MKLDNNMemoryInputNode : public MKLDNNInputNode, public MKLDNNMemoryNode {
     static std::string idFromCombinedName(std::string name);
  public:
     MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
-    ~MKLDNNMemoryInputNode() override;
+    ~MKLDNNMemoryInputNode() override = default;
 
     bool created() const override {
         return getType() == MemoryInput;
@@ -5,6 +5,8 @@
 #include "mkldnn_permute_node.h"
 #include <ie_layers.h>
 #include <string>
+#include <algorithm>
+#include <cstring>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
@@ -36,14 +38,12 @@ void MKLDNNPermuteNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    // the permutation only moves the data, so the quantized data keeps its precision
     InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
+    if (precision != InferenceEngine::Precision::I8 && precision != InferenceEngine::Precision::U8)
         precision = InferenceEngine::Precision::FP32;
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
-    precision = getCnnLayer()->outData[0]->getPrecision();
-    if (precision != InferenceEngine::Precision::FP32)
-        precision = InferenceEngine::Precision::FP32;
-    auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+    auto outputDataType = inputDataType;
 
     InferenceEngine::LayerConfig config;
     config.dynBatchSupport = true;
@@ -100,257 +100,149 @@ void MKLDNNPermuteNode::createPrimitive() {
         THROW_IE_EXCEPTION << "Input memory didn't allocate.";
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
-}
-
-static void permute_to_0231(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    // Supports only NCHW to NHWC
-    int block_size = 1;
-    if (!MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat())) {
-        block_size = srcMemPtr->GetDescriptor().data.layout_desc.blocking.block_dims[1];
-    }
-
-    const int C = srcMemPtr->GetDims()[1];
-    const int H = srcMemPtr->GetDims()[2];
-    const int W = srcMemPtr->GetDims()[3];
-
-    // NHWC
-    const int src_stride = H * W * block_size;
-
-    int src_off = 0;
-    int dst_off = 0;
 
-    for (int n = 0; n < MB; n++) {
-        for (int h = 0; h < H; h++) {
-            for (int w = 0; w < W; w++) {
-                src_off = n * C * H * W + (h * W + w) * block_size;
-
-                for (int c = 0; c < C; c += block_size) {
-                    for (int b = 0; b < block_size; b++) {
-                        dst_data[dst_off] = src_data[src_off + b];
-                        dst_off++;
-                    }
-
-                    src_off += src_stride;
-                }
-            }
-        }
-    }
+    // the loops depend on the batch, they are compiled by the first execution
+    loopsBatch = -1;
 }
 
-static void permute_to_0213(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    int block_size = 1;
-    if (!MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat())) {
-        block_size = srcMemPtr->GetDescriptor().data.layout_desc.blocking.block_dims[1];
+void MKLDNNPermuteNode::prepareLoops(int MB) {
+    auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    const auto &blocking = srcMemPtr->GetDescriptor().data.layout_desc.blocking;
+    auto srcDims = srcMemPtr->GetDims();
+    const size_t ndims = srcDims.size();
+    if (order.size() != ndims)
+        THROW_IE_EXCEPTION << "Permute layer " << getName() << " has the order of " << order.size()
+                           << " dims for the input of " << ndims << " dims";
+
+    // the destination is plain: the dense permuted dims of the processed batch
+    SizeVector dims(srcDims.begin(), srcDims.end());
+    dims[0] = static_cast<size_t>(MB);
+    SizeVector dstStrides(ndims);
+    size_t stride = 1;
+    for (size_t i = ndims; i-- > 0;) {
+        dstStrides[order[i]] = stride;
+        stride *= dims[order[i]];
     }
 
-    const int C = srcMemPtr->GetDims()[1];
-    const int H = srcMemPtr->GetDims()[2];
-    const int W = srcMemPtr->GetDims()[3];
-
-    parallel_for3d(MB, C/block_size, H, [&](int n, int c, int h) {
-        for (int w = 0; w < W; w++) {
-            int src_off = n*C*H*W + (c*H*W + h*W + w)*block_size;
-            int dst_off = n*C*H*W + (h*C*W + w + c*W)*block_size;
-            for (int b = 0; b < block_size; b++) {
-                dst_data[dst_off + b] = src_data[src_off + b];
-            }
+    // a blocked dim of the source is iterated as the blocks and the elements in a block
+    std::vector<PermuteLoop> dimLoops;
+    for (size_t d = 0; d < ndims; d++) {
+        const auto block = static_cast<size_t>(blocking.block_dims[d]);
+        if (block > 1) {
+            dimLoops.push_back({dims[d] / block, static_cast<size_t>(blocking.strides[0][d]), dstStrides[d] * block});
+            dimLoops.push_back({block, static_cast<size_t>(blocking.strides[1][d]), dstStrides[d]});
+        } else {
+            dimLoops.push_back({dims[d], static_cast<size_t>(blocking.strides[0][d]), dstStrides[d]});
         }
+    }
+    dimLoops.erase(std::remove_if(dimLoops.begin(), dimLoops.end(), [](const PermuteLoop &loop) {
+        return loop.count == 1;
+    }), dimLoops.end());
+    std::stable_sort(dimLoops.begin(), dimLoops.end(), [](const PermuteLoop &a, const PermuteLoop &b) {
+        return a.dstStride > b.dstStride;
     });
-}
-
-template <size_t scale_H = 0, size_t scale_W = 0>
-static void permute_to_014253(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-
-    const int C  = srcMemPtr->GetDims()[1];
-    const int CH  = scale_H > 0 ? static_cast<int>(scale_H) : srcMemPtr->GetDims()[2];
-    const int CW  = scale_W > 0 ? static_cast<int>(scale_W) : srcMemPtr->GetDims()[3];
-    const int H  = srcMemPtr->GetDims()[4];
-    const int W  = srcMemPtr->GetDims()[5];
-
-    int src_off = 0;
-    int dst_off = 0;
-
-    for (int n = 0; n < MB; n++) {
-        for (int c = 0; c < C; c++) {
-            for (int h = 0; h < H; h++) {
-                for (int ch = 0; ch < CH; ch++) {
-                    for (int w = 0; w < W; w++) {
-                        for (int cw = 0; cw < CW; cw++) {
-                            src_off = n * C * CH * CW * H * W +
-                                      c * CH * CW * H * W +
-                                      ch * CW * H * W +
-                                      cw * H * W +
-                                      h * W +
-                                      w;
 
-                            dst_data[dst_off] = src_data[src_off];
-                            dst_off++;
-                        }
-                    }
-                }
-            }
+    loops.clear();
+    for (const auto &loop : dimLoops) {
+        if (!loops.empty() && loops.back().srcStride == loop.count * loop.srcStride &&
+                loops.back().dstStride == loop.count * loop.dstStride) {
+            loops.back() = {loops.back().count * loop.count, loop.srcStride, loop.dstStride};
+        } else {
+            loops.push_back(loop);
         }
     }
+    if (loops.empty())
+        loops.push_back({1, 1, 1});
+    loopsBatch = MB;
 }
 
-static void permute_to_3012(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-
-    const int C  = srcMemPtr->GetDims()[1];
-    const int H  = srcMemPtr->GetDims()[2];
-    const int W  = srcMemPtr->GetDims()[3];
-
-    int src_off = 0;
-    int dst_off = 0;
-
-    for (int w = 0; w < W; w++) {
-        for (int n = 0; n < MB; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int h = 0; h < H; h++) {
-                     src_off = n * C * H * W +
-                               c * H * W +
-                               h * W +
-                               w;
-
-                     dst_data[dst_off] = src_data[src_off];
-                     dst_off++;
-                }
-            }
+// the transposed tiles of the source fit in L1 along with the lines of the destination they are written to
+static const size_t permuteTile = 16;
+// a large contiguous copy is split to spread it over the threads
+static const size_t permuteChunk = 4096;
+
+template <typename data_t>
+void MKLDNNPermuteNode::permute(const data_t* src_data, data_t* dst_data) const {
+    const size_t innerIdx = loops.size() - 1;
+    const PermuteLoop &inner = loops[innerIdx];
+
+    // the innermost loop writes the destination contiguously, when it does not read the source contiguously it is
+    // transposed by tiles with the loop reading the source with the smallest stride
+    size_t tr = innerIdx;
+    if (inner.srcStride != 1) {
+        for (size_t i = 0; i < innerIdx; i++) {
+            if (tr == innerIdx || loops[i].srcStride < loops[tr].srcStride)
+                tr = i;
         }
     }
-}
-
-static void permute_to_021(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-
-    const int C  = srcMemPtr->GetDims()[1];
-    const int S  = srcMemPtr->GetDims()[2];
-
-    parallel_for2d(MB, S, [&](int n, int s) {
-        int src_off = 0;
-        int dst_off = 0;
-
-        for (int c = 0; c < C; c++) {
-            src_off = n * C * S +
-                      c * S +
-                      s;
-            dst_off = n * S * C +
-                      s * C +
-                      c;
+    const bool transpose = tr != innerIdx;
+    const size_t innerTile = transpose ? permuteTile : permuteChunk;
+    const size_t innerTiles = div_up(inner.count, innerTile);
+    const size_t trTiles = transpose ? div_up(loops[tr].count, permuteTile) : 1;
+    size_t outerCount = 1;
+    for (size_t i = 0; i < innerIdx; i++) {
+        if (i != tr)
+            outerCount *= loops[i].count;
+    }
 
-            dst_data[dst_off] = src_data[src_off];
+    parallel_for(outerCount * trTiles * innerTiles, [&](size_t work) {
+        const size_t i0 = (work % innerTiles) * innerTile;
+        const size_t i1 = std::min(i0 + innerTile, inner.count);
+        work /= innerTiles;
+        const size_t t0 = (work % trTiles) * permuteTile;
+        work /= trTiles;
+
+        size_t srcOff = 0;
+        size_t dstOff = 0;
+        for (size_t i = innerIdx; i-- > 0;) {
+            if (i == tr)
+                continue;
+            const size_t idx = work % loops[i].count;
+            work /= loops[i].count;
+            srcOff += idx * loops[i].srcStride;
+            dstOff += idx * loops[i].dstStride;
         }
-    });
-}
-
-static void permute_to_034152(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
-
-    const int DIM1 = srcMemPtr->GetDims()[1];
-    const int DIM2 = srcMemPtr->GetDims()[2];
-    const int DIM3 = srcMemPtr->GetDims()[3];
-    const int DIM4 = srcMemPtr->GetDims()[4];
-    const int DIM5 = srcMemPtr->GetDims()[5];
-
-    int src_off = 0;
-    int dst_off = 0;
-
-    for (int n = 0; n < MB; n++) {
-        for (int dim3 = 0; dim3 < DIM3; dim3++) {
-            for (int dim4 = 0; dim4 < DIM4; dim4++) {
-                for (int dim1 = 0; dim1 < DIM1; dim1++) {
-                    for (int dim5 = 0; dim5 < DIM5; dim5++) {
-                        for (int dim2 = 0; dim2 < DIM2; dim2++) {
-                            src_off = n * DIM1 * DIM2 * DIM3 * DIM4 * DIM5 +
-                                      dim1 * DIM2 * DIM3 * DIM4 * DIM5 +
-                                      dim2 * DIM3 * DIM4 * DIM5 +
-                                      dim3 * DIM4 * DIM5 +
-                                      dim4 * DIM5 +
-                                      dim5;
-
-                            dst_data[dst_off] = src_data[src_off];
-                            dst_off++;
-                        }
-                    }
-                }
+        const data_t *src = src_data + srcOff;
+        data_t *dst = dst_data + dstOff;
+
+        if (!transpose) {
+            if (inner.srcStride == 1) {
+                memcpy(dst + i0, src + i0, (i1 - i0) * sizeof(data_t));
+            } else {
+                for (size_t i = i0; i < i1; i++)
+                    dst[i] = src[i * inner.srcStride];
             }
+            return;
         }
-    }
-}
 
-std::multimap<InferenceEngine::SizeVector, MKLDNNPermuteNode::PermuteImpl> MKLDNNPermuteNode::OptimizedCases = {
-        {{0, 2, 3, 1}, MKLDNNPermuteNode::PermuteImpl(permute_to_0231, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return true;
-        })},  // NCHW -> NHWC case
-        {{0, 1, 4, 2, 5, 3}, MKLDNNPermuteNode::PermuteImpl(permute_to_014253<2, 2>, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat()) && srcMemPtr->GetDims()[2] == 2 && srcMemPtr->GetDims()[3] == 2;
-        })},  // Dense upsample convolution case (scale = 2)
-        {{0, 1, 4, 2, 5, 3}, MKLDNNPermuteNode::PermuteImpl(permute_to_014253<0, 0>, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat());
-        })},  // Dense upsample convolution case (generic)
-        {{3, 0, 1, 2}, MKLDNNPermuteNode::PermuteImpl(permute_to_3012, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat());
-        })},  // LPR case
-        {{0, 2, 1, 3}, MKLDNNPermuteNode::PermuteImpl(permute_to_0213, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat());
-        })},  // shufflenet
-        {{0, 2, 1}, MKLDNNPermuteNode::PermuteImpl(permute_to_021, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat());
-        })},  // self attention block
-        {{0, 3, 4, 1, 5, 2}, MKLDNNPermuteNode::PermuteImpl(permute_to_034152, [](MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr) {
-            return MKLDNNMemory::IsPlainFormat(srcMemPtr->GetFormat());
-        })},  // learning-to-see-in-the-dark-sony
-};
+        const PermuteLoop &outer = loops[tr];
+        const size_t t1 = std::min(t0 + permuteTile, outer.count);
+        for (size_t i = i0; i < i1; i++) {
+            for (size_t t = t0; t < t1; t++)
+                dst[t * outer.dstStride + i] = src[t * outer.srcStride + i * inner.srcStride];
+        }
+    });
+}
 
 void MKLDNNPermuteNode::execute(mkldnn::stream strm) {
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
-    auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
-    auto dst_data = reinterpret_cast<float *>(dstMemPtr->GetData());
-
-    for (const auto &impl : OptimizedCases) {
-        if (impl.first == order && impl.second.isValidParams(srcMemPtr, dstMemPtr)) {
-            impl.second.execute(batchToProcess(), srcMemPtr, dstMemPtr);
-            return;
-        }
-    }
-
-    auto srcBlob = getParentEdgeAt(0)->getBlob();
-    TensorDesc srcDesc = srcBlob->getTensorDesc();
-
-    SizeVector& dims = srcDesc.getDims();
-    InferenceEngine::SizeVector orderedDims;
-    for (auto ord : order) {
-        orderedDims.push_back(dims[ord]);
-    }
-    TensorDesc dstDesc(InferenceEngine::Precision::FP32, dims, {orderedDims, order});
-
-    int dataSize = srcBlob->size() / srcDesc.getDims()[0] * batchToProcess();
-
-    parallel_for(dataSize, [&](int i) {
-        dst_data[dstDesc.offset(i)] = src_data[srcDesc.offset(i)];
-    });
+    const bool isInt8 = srcMemPtr->GetDataType() == memory::s8 || srcMemPtr->GetDataType() == memory::u8;
+
+    const int MB = batchToProcess();
+    if (loopsBatch != MB)
+        prepareLoops(MB);
+
+    auto src_data = reinterpret_cast<const uint8_t *>(srcMemPtr->GetData());
+    auto dst_data = reinterpret_cast<uint8_t *>(dstMemPtr->GetData());
+    const size_t elementSize = isInt8 ? sizeof(uint8_t) : sizeof(float);
+    src_data += srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding * elementSize;
+    dst_data += dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding * elementSize;
+
+    if (isInt8)
+        permute(src_data, dst_data);
+    else
+        permute(reinterpret_cast<const float *>(src_data), reinterpret_cast<float *>(dst_data));
 }
 
 bool MKLDNNPermuteNode::created() const {
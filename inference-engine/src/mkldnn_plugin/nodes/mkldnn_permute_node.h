@@ -8,8 +8,6 @@
 #include <mkldnn_node.h>
 #include <string>
 #include <vector>
-#include <utility>
-#include <map>
 
 namespace MKLDNNPlugin {
 
@@ -31,16 +29,19 @@ private:
     static Register<MKLDNNPermuteNode> reg;
     InferenceEngine::SizeVector order;
 
-    typedef std::function<void(int MB, MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr)> permuteImpl;
-    typedef std::function<bool(MKLDNNMemoryPtr& srcMemPtr, MKLDNNMemoryPtr& dstMemPtr)> isApplicable;
-    struct PermuteImpl {
-        PermuteImpl(permuteImpl f0, isApplicable f1): execute(std::move(f0)), isValidParams(std::move(f1)) {}
-
-        permuteImpl execute;
-        isApplicable isValidParams;
+    // the permutation compiled for the layouts of the memory: a loop nest with the strides of both sides, the loops
+    // are sorted by the destination stride and the contiguous ones are merged
+    struct PermuteLoop {
+        size_t count;
+        size_t srcStride;
+        size_t dstStride;
     };
+    std::vector<PermuteLoop> loops;
+    int loopsBatch = -1;
 
-    static std::multimap<InferenceEngine::SizeVector, PermuteImpl> OptimizedCases;
+    void prepareLoops(int MB);
+    template <typename data_t>
+    void permute(const data_t* src_data, data_t* dst_data) const;
 };
 
 }  // namespace MKLDNNPlugin
@@ -3,6 +3,7 @@
 //
 
 #include "mkldnn_pooling_node.h"
+#include "mkldnn_quantize_node.h"
 #include "desc_iterator.hpp"
 #include <ie_layers.h>
 #include <mkldnn.hpp>
@@ -83,16 +84,12 @@ void MKLDNNPoolingNode::createPrimitive() {
                                    getChildEdgeAt(0)->getMemory().GetPrimitive()));
 }
 
-bool MKLDNNPoolingNode::created() const {
-    return getType() == Pooling;
+void MKLDNNPoolingNode::execute(mkldnn::stream strm) {
+    MKLDNNNode::execute(strm);
+    MKLDNNQuantizeNode::applyFused(fusedWith, getChildEdgeAt(0)->getMemory(), batchToProcess());
 }
 
-void MKLDNNPoolingNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
-                                         const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
-    MKLDNNMemoryDesc in_candidate(inputDesc[0]);
-    MKLDNNMemoryDesc out_candidate(outputDesc[0]);
-
-    algorithm alg;
+algorithm MKLDNNPoolingNode::getPoolingAlgorithm() const {
     if (type == PoolingLayer::PoolType::AVG) {
         bool not_zero_l = false;
         for (auto lr : paddingL) {
@@ -102,15 +99,53 @@ void MKLDNNPoolingNode::createDescriptor(const std::vector<InferenceEngine::Tens
             }
         }
         if (!exclude_pad && not_zero_l)
-            alg = pooling_avg_include_padding;
-        else
-            alg = pooling_avg_exclude_padding;
+            return pooling_avg_include_padding;
+        return pooling_avg_exclude_padding;
     } else if (type == PoolingLayer::PoolType::MAX) {
-        alg = pooling_max;
-    } else {
-        // TODO: Handle rest of the possible: STOCH, ROI, SPACIAL_PYRAMID
-        THROW_IE_EXCEPTION << "Unsupported pooling type";
+        return pooling_max;
     }
+    // TODO: Handle rest of the possible: STOCH, ROI, SPACIAL_PYRAMID
+    THROW_IE_EXCEPTION << "Unsupported pooling type";
+}
+
+bool MKLDNNPoolingNode::getRowWindow(RowWindow &window) {
+    // the fused quantizations are applied to the whole output, the AVG including the paddings restores the pads
+    if (!fusedWith.empty() || !prim || inDims.empty() || inDims[0].ndims() != 4 ||
+        getPoolingAlgorithm() == pooling_avg_include_padding)
+        return false;
+
+    // the rows are the first spatial axis
+    window.extent = kernel[0];
+    window.stride = stride[0];
+    window.padTop = paddingL[0];
+    return true;
+}
+
+std::shared_ptr<mkldnn::primitive> MKLDNNPoolingNode::createRowsPrimitive(const mkldnn::memory &src,
+                                                                          const mkldnn::memory &dst,
+                                                                          ptrdiff_t padTop, ptrdiff_t padBottom) {
+    std::vector<ptrdiff_t> padL = paddingL;
+    std::vector<ptrdiff_t> padR = paddingR;
+    padL[0] = padTop;
+    padR[0] = padBottom;
+
+    pooling_forward::desc desc(prop_kind::forward_scoring, getPoolingAlgorithm(),
+                               src.get_primitive_desc().desc(), dst.get_primitive_desc().desc(),
+                               stride, kernel, padL, padR, mkldnn::padding_kind::zero);
+    pooling_forward::primitive_desc prim_desc(desc, getEngine());
+    return std::make_shared<pooling_forward>(prim_desc, src, dst);
+}
+
+bool MKLDNNPoolingNode::created() const {
+    return getType() == Pooling;
+}
+
+void MKLDNNPoolingNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
+                                         const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
+    MKLDNNMemoryDesc in_candidate(inputDesc[0]);
+    MKLDNNMemoryDesc out_candidate(outputDesc[0]);
+
+    algorithm alg = getPoolingAlgorithm();
 
     std::shared_ptr<pooling_forward::desc> desc_ptr(
             new pooling_forward::desc(prop_kind::forward_scoring, alg,
@@ -21,12 +21,18 @@ public:
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool getRowWindow(RowWindow &window) override;
+    std::shared_ptr<mkldnn::primitive> createRowsPrimitive(const mkldnn::memory &src, const mkldnn::memory &dst,
+                                                           ptrdiff_t padTop, ptrdiff_t padBottom) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
     }
 
 private:
+    mkldnn::algorithm getPoolingAlgorithm() const;
+
     static Register<MKLDNNPoolingNode> reg;
     InferenceEngine::PoolingLayer::PoolType type;
     bool exclude_pad;
@@ -110,3 +110,20 @@ void MKLDNNPowerNode::execute(mkldnn::stream strm) {
 bool MKLDNNPowerNode::created() const {
     return getType() == Power;
 }
+
+bool MKLDNNPowerNode::canBeAppendedAsPostOps() const {
+    auto * powerLayer = dynamic_cast<PowerLayer*>(getCnnLayer().get());
+    return powerLayer != nullptr && (powerLayer->power == 1.0f || powerLayer->power == 2.0f);
+}
+
+void MKLDNNPowerNode::appendPostOps(mkldnn::post_ops& ops) const {
+    // the fused node is not initialized, so the parameters are taken from the layer
+    auto * powerLayer = dynamic_cast<PowerLayer*>(getCnnLayer().get());
+    if (powerLayer == nullptr || !canBeAppendedAsPostOps())
+        THROW_IE_EXCEPTION << "Power node " << getName() << " cannot be fused as post-ops.";
+
+    if (powerLayer->scale != 1.0f || powerLayer->offset != 0.0f)
+        ops.append_eltwise(1.0, eltwise_linear, powerLayer->scale, powerLayer->offset);
+    if (powerLayer->power == 2.0f)
+        ops.append_eltwise(1.0, eltwise_square, 0.0f, 0.0f);
+}
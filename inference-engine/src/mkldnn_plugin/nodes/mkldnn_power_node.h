@@ -21,6 +21,10 @@ public:
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
+    // the node can be computed by the eltwise post-ops of the previous node if the power is 1 or 2
+    bool canBeAppendedAsPostOps() const;
+    void appendPostOps(mkldnn::post_ops& ops) const;
+
 private:
     static Register<MKLDNNPowerNode> reg;
     float scale;
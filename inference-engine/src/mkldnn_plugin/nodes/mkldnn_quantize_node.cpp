@@ -11,6 +11,8 @@
 #include <mkldnn_extension_utils.h>
 #include <ie_memcpy.h>
 #include "details/caseless.hpp"
+#include "ie_parallel.hpp"
+#include <cmath>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -182,10 +184,7 @@ void MKLDNNQuantizeNode::execute(mkldnn::stream strm) {
         outputHighData += outputHighMemory->GetDescriptor().data.layout_desc.blocking.offset_padding;
         dstData += dstMemory->GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-        size_t N = static_cast<size_t>(batchToProcess());
         size_t C = static_cast<size_t>(srcMemory->GetDims()[1]);
-        size_t H = static_cast<size_t>(srcMemory->GetDims()[2]);
-        size_t W = static_cast<size_t>(srcMemory->GetDims()[3]);
 
         int inputLowAxis = inputLowMemory->GetDims().size() == 1 ? 0 : 1;
         bool isInputLowBroadcasted = inputLowMemory->GetDims()[inputLowAxis] != C;
@@ -199,28 +198,102 @@ void MKLDNNQuantizeNode::execute(mkldnn::stream strm) {
         int outputHighAxis = outputHighMemory->GetDims().size() == 1 ? 0 : 1;
         bool isOutputHighBroadcasted = outputHighMemory->GetDims()[outputHighAxis] != C;
 
-        for (int n = 0; n < N; n++) {
-            for (int h = 0; h < H; h++) {
-                for (int w = 0; w < W; w++) {
-                    for (int c = 0; c < C; c++) {
-                        size_t idx = n * H * W * C + h * W * C + w * C + c;
-
-                        float inputLow = inputLowData[isInputLowBroadcasted ? 0 : c];
-                        float inputHigh = inputHighData[isInputHighBroadcasted ? 0 : c];
-                        float outputLow = outputLowData[isOutputLowBroadcasted ? 0 : c];
-                        float outputHigh = outputHighData[isOutputHighBroadcasted ? 0 : c];
-
-                        if (srcData[idx] <= inputLow)
-                            dstData[idx] = outputLow;
-                        else if (srcData[idx] > inputHigh)
-                            dstData[idx] = outputHigh;
-                        else
-                            dstData[idx] = roundf((srcData[idx] - inputLow) / (inputHigh - inputLow) * (levels - 1)) /
-                                           (levels - 1) * (outputHigh - outputLow) + outputLow;
-                    }
-                }
-            }
+        setChannelRanges(C, inputLowData, inputHighData, outputLowData, outputHighData,
+                         isInputLowBroadcasted, isInputHighBroadcasted, isOutputLowBroadcasted, isOutputHighBroadcasted);
+        quantize(srcData, dstData, *srcMemory, batchToProcess());
+    }
+}
+
+void MKLDNNQuantizeNode::setChannelRanges(size_t channels, const float* inputLowData, const float* inputHighData,
+                                          const float* outputLowData, const float* outputHighData,
+                                          bool isInputLowBroadcasted, bool isInputHighBroadcasted,
+                                          bool isOutputLowBroadcasted, bool isOutputHighBroadcasted) {
+    inputLow.resize(channels);
+    inputHigh.resize(channels);
+    outputLow.resize(channels);
+    outputHigh.resize(channels);
+    for (size_t c = 0; c < channels; c++) {
+        inputLow[c] = inputLowData[isInputLowBroadcasted ? 0 : c];
+        inputHigh[c] = inputHighData[isInputHighBroadcasted ? 0 : c];
+        outputLow[c] = outputLowData[isOutputLowBroadcasted ? 0 : c];
+        outputHigh[c] = outputHighData[isOutputHighBroadcasted ? 0 : c];
+    }
+}
+
+void MKLDNNQuantizeNode::quantize(const float* srcData, float* dstData, const MKLDNNMemory& layout, int MB) const {
+    // the source and the destination have the same layout, the channels may be blocked and the spatial dims are dense
+    const auto& blocking = layout.GetDescriptor().data.layout_desc.blocking;
+    auto dims = layout.GetDims();
+    const size_t C = static_cast<size_t>(dims[1]);
+    size_t S = 1;
+    for (size_t i = 2; i < dims.size(); i++)
+        S *= static_cast<size_t>(dims[i]);
+
+    const size_t block = static_cast<size_t>(blocking.block_dims[1]);
+    const size_t strideN = static_cast<size_t>(blocking.strides[0][0]);
+    const size_t strideC = static_cast<size_t>(blocking.strides[0][1]);
+    const size_t strideBlock = static_cast<size_t>(blocking.strides[1][1]);
+    const size_t strideS = dims.size() > 2 ? static_cast<size_t>(blocking.strides[0][dims.size() - 1]) : 0;
+    const float steps = static_cast<float>(levels - 1);
+
+    parallel_for2d(MB, C, [&](int n, size_t c) {
+        const size_t off = n * strideN + (c / block) * strideC + (c % block) * strideBlock;
+        const float il = inputLow[c];
+        const float ih = inputHigh[c];
+        const float ol = outputLow[c];
+        const float oh = outputHigh[c];
+        const float inputScale = steps / (ih - il);
+        const float outputScale = (oh - ol) / steps;
+
+        for (size_t s = 0; s < S; s++) {
+            const size_t idx = off + s * strideS;
+            const float x = srcData[idx];
+            if (x <= il)
+                dstData[idx] = ol;
+            else if (x > ih)
+                dstData[idx] = oh;
+            else
+                dstData[idx] = roundf((x - il) * inputScale) * outputScale + ol;
         }
+    });
+}
+
+bool MKLDNNQuantizeNode::initFusedRanges() {
+    const size_t C = static_cast<size_t>(getParentEdgeAt(0)->getDims()[1]);
+    std::vector<const float*> data;
+    std::vector<bool> broadcasted;
+    for (size_t i = 1; i < 5; i++) {
+        auto parentEdge = getParentEdgeAt(i);
+        auto parent = parentEdge->getParent();
+        if (parent->getType() != Input || !parent->getCnnLayer())
+            return false;
+        auto it = parent->getCnnLayer()->blobs.find("custom");
+        if (it == parent->getCnnLayer()->blobs.end())
+            return false;
+        auto* blob = dynamic_cast<TBlob<float>*>(it->second.get());
+        if (!blob)
+            return false;
+
+        int axis = parentEdge->getDims().ndims() == 1 ? 0 : 1;
+        bool isBroadcasted = parentEdge->getDims()[axis] != C;
+        if (blob->size() < (isBroadcasted ? 1 : C))
+            return false;
+        data.push_back(blob->buffer().as<const float*>());
+        broadcasted.push_back(isBroadcasted);
+    }
+
+    setChannelRanges(C, data[0], data[1], data[2], data[3], broadcasted[0], broadcasted[1], broadcasted[2], broadcasted[3]);
+    return true;
+}
+
+void MKLDNNQuantizeNode::applyFused(const std::vector<MKLDNNNodePtr>& fusedWith, const MKLDNNMemory& dst, int MB) {
+    for (auto &node : fusedWith) {
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode *>(node.get());
+        if (!quantizeNode)
+            continue;
+
+        auto dstData = reinterpret_cast<float *>(dst.GetData()) + dst.GetDescriptor().data.layout_desc.blocking.offset_padding;
+        quantizeNode->quantize(dstData, dstData, dst, MB);
     }
 }
 
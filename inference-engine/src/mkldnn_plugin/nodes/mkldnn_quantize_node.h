@@ -23,13 +23,32 @@ public:
     bool created() const override;
     void execute(mkldnn::stream strm) override;
 
+    /**
+     * @brief Takes the quantization ranges from the constant inputs, so the node can be fused to the producer of its
+     * data input, the producer quantizes its output by applyFused
+     * @return false if an input range is not a constant
+     */
+    bool initFusedRanges();
+    static void applyFused(const std::vector<MKLDNNNodePtr>& fusedWith, const MKLDNNMemory& dst, int MB);
 
 private:
     static Register<MKLDNNQuantizeNode> reg;
 
+    void setChannelRanges(size_t channels, const float* inputLowData, const float* inputHighData,
+                          const float* outputLowData, const float* outputHighData,
+                          bool isInputLowBroadcasted, bool isInputHighBroadcasted,
+                          bool isOutputLowBroadcasted, bool isOutputHighBroadcasted);
+    void quantize(const float* srcData, float* dstData, const MKLDNNMemory& layout, int MB) const;
+
     bool canStorePacked;
     int levels;
 
+    // per channel
+    std::vector<float> inputLow;
+    std::vector<float> inputHigh;
+    std::vector<float> outputLow;
+    std::vector<float> outputHigh;
+
     std::vector<float> binarizationThresholds;
 };
 
@@ -72,6 +72,8 @@ void MKLDNNReorderNode::createPrimitive() {
 
     createReorderPrimitive(srcMemPtr->GetDescriptor(), srcMemPtr->GetPrimitive().get_data_handle(),
             dstMemPtr->GetDescriptor(), dstMemPtr->GetPrimitive().get_data_handle());
+    batchPrimitives.clear();
+    batchPrimitives[batchToProcess()] = {prim, src_blocked, dst_blocked};
 }
 
 void MKLDNNReorderNode::createReorderPrimitive(mkldnn::memory::desc srcDesc, void* srcPtr, mkldnn::memory::desc dstDesc, void* dstPtr) {
@@ -126,6 +128,15 @@ void MKLDNNReorderNode::execute(mkldnn::stream strm) {
 void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
     dynBatchLim = lim;
     if (prim) {
+        // the data handles are set by execute, so the primitive of a batch can be reused as is
+        auto cached = batchPrimitives.find(batchToProcess());
+        if (cached != batchPrimitives.end()) {
+            prim = cached->second.prim;
+            src_blocked = cached->second.src;
+            dst_blocked = cached->second.dst;
+            return;
+        }
+
         auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
         auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
         memory::desc src_d = srcMemPtr->GetDescriptor();
@@ -140,5 +151,6 @@ void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
         dst_d.data.layout_desc.blocking.padding_dims[0] = batchToProcess();
 
         createReorderPrimitive(src_d, src_data_hdl, dst_d, dst_data_hdl);
+        batchPrimitives[batchToProcess()] = {prim, src_blocked, dst_blocked};
     }
 }
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <map>
 #include <string>
 #include <memory>
 #include <vector>
@@ -51,6 +52,14 @@ private:
     MKLDNNMemoryPtr dst_blocked;
     MKLDNNMemoryPtr src_blocked;
 
+    struct BatchPrimitive {
+        MKLDNNPrimitive prim;
+        MKLDNNMemoryPtr src;
+        MKLDNNMemoryPtr dst;
+    };
+    // the primitives of the batches processed so far, switching back to a batch does not recreate its primitive
+    std::map<int, BatchPrimitive> batchPrimitives;
+
     void createReorderPrimitive(mkldnn::memory::desc srcDesc, void* srcPtr, mkldnn::memory::desc dstDesc, void* dstPtr);
 };
 
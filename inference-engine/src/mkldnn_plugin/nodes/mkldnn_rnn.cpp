@@ -6,8 +6,12 @@
 #include "mkldnn_extension_utils.h"
 #include "desc_iterator.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <string>
 #include <utility>
+#include <vector>
 
 using namespace mkldnn;
 using namespace InferenceEngine;
@@ -191,7 +195,7 @@ void MKLDNNRNN::fillSeqDesc() {
     auto &ins = rnnLayer->insData;
     auto &outs = rnnLayer->outData;
 
-    if (!one_of(ins.size(), 3, 2, 1))
+    if (!one_of(ins.size(), 4, 3, 2, 1))
         THROW_IE_EXCEPTION << "Incorrect number of input ports for layer " << getName();
     if (!one_of(outs.size(), 3, 2, 1))
         THROW_IE_EXCEPTION << "Incorrect number of output ports for layer " << getName();
@@ -221,15 +225,28 @@ void MKLDNNRNN::fillSeqDesc() {
     if (out_data_dims != OD_shape)
         THROW_IE_EXCEPTION << "Incorrect shape of input/output ports for layer " << getName();
 
-    if (ins.size() > 1) {
-        for (int i = 1; i < ins.size(); i++)
+    // the data, the initial states and the lengths of the sequences
+    withSeqLengths = ins.size() == static_cast<size_t>(S + 2);
+    const size_t stateInputs = withSeqLengths ? ins.size() - 1 : ins.size();
+    if (withSeqLengths) {
+        if (getParentEdgeAt(stateInputs)->getDims() != MKLDNNDims {N})
+            THROW_IE_EXCEPTION << "Incorrect shape of sequence lengths port for layer " << getName();
+        if (persistentState)
+            THROW_IE_EXCEPTION << "RNN layer " << getName() << " with sequence lengths cannot keep the state";
+        if (direction != unidirectional_left2right)
+            THROW_IE_EXCEPTION << "RNN layer " << getName()
+                               << " supports the sequence lengths in the forward direction only";
+    }
+
+    if (stateInputs > 1 || persistentState || withSeqLengths) {
+        for (int i = 1; i < stateInputs; i++)
             if (getParentEdgeAt(i)->getDims() != S_shape)
                 THROW_IE_EXCEPTION << "Incorrect shape of state ports for layer " << getName();
 
         in_state_d = {{L, D, S, N, SC}, memory::f32, memory::ldsnc};
     }
 
-    if (outs.size() > 1) {
+    if (outs.size() > 1 || persistentState || withSeqLengths) {
         for (int i = 1; i < outs.size(); i++)
             if (getChildEdgeAt(i)->getDims() != S_shape)
                 THROW_IE_EXCEPTION << "Incorrect shape of state ports for layer " << getName();
@@ -267,8 +284,10 @@ void MKLDNNRNN::fillSeqDesc() {
     else
         in_candidate.push_back(MKLDNNMemoryDesc{{N, T, DC}, memory::f32, memory::ntc});
 
-    for (int i = 1; i < ins.size(); i++)
+    for (int i = 1; i < stateInputs; i++)
         in_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, memory::f32, memory::nc});
+    if (withSeqLengths)
+        in_candidate.emplace_back(MKLDNNMemoryDesc {{N}, memory::f32, memory::x});
 
     std::vector<TensorDesc> out_candidate;
     if (nativeOrder)
@@ -433,7 +452,13 @@ void MKLDNNRNN::createPrimitive() {
     auto src_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
     src_state_mem->Create(in_state_d);
     internalBlobMemory.push_back(src_state_mem);
-    if (in_state_d) {
+    if (persistentState) {
+        // the primitive reads the whole source state before it writes the destination one
+        src_state_mem->FillZero();
+        state = src_state_mem;
+        stateReset = true;
+    }
+    if (in_state_d && getParentEdges().size() > 1) {
         int offset = 0;
         for (int i = 0; i < S; i++) {
             /* create copy/concat primitive */
@@ -451,12 +476,14 @@ void MKLDNNRNN::createPrimitive() {
         }
     }
 
-    auto dst_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    dst_state_mem->Create(out_state_d);
-    internalBlobMemory.push_back(dst_state_mem);
-    if (out_state_d) {
+    auto dst_state_mem = persistentState ? src_state_mem : std::make_shared<MKLDNNMemory>(getEngine());
+    if (!persistentState) {
+        dst_state_mem->Create(out_state_d);
+        internalBlobMemory.push_back(dst_state_mem);
+    }
+    int idx_start = is_cell ? 0 : 1;
+    if (out_state_d && getChildEdges().size() > idx_start) {
         int offset = 0;
-        int idx_start = is_cell ? 0 : 1;
         for (int i = 0; i < S; i++) {
             /* create copy/split primitive */
             auto dst_stat = getChildEdgeAt(idx_start + i)->getMemory().GetPrimitive();
@@ -489,11 +516,40 @@ void MKLDNNRNN::createPrimitive() {
             /* Workspace     */ workspace_mem->GetPrimitive());
 
     prim.reset(p);
+
+    // the segments of the packed sequences share the weights
+    weightsMem = w_data_mem;
+    weightsStateMem = w_state_mem;
+    biasMem = w_bias_mem;
+    workspaceMem = workspace_mem;
 }
 
 void MKLDNNRNN::execute(mkldnn::stream strm) {
-    if (!exec_before.empty())
+    if (withSeqLengths) {
+        const float *data = static_cast<const float *>(getParentEdgeAt(getParentEdges().size() - 1)->getMemory().GetData());
+        std::vector<ptrdiff_t> lengths(N);
+        bool padded = false;
+        for (ptrdiff_t n = 0; n < N; n++) {
+            lengths[n] = std::min<ptrdiff_t>(T, std::max<ptrdiff_t>(0, static_cast<ptrdiff_t>(std::lround(data[n]))));
+            padded |= lengths[n] < T;
+        }
+        if (padded) {
+            executePacked(lengths);
+            return;
+        }
+    }
+
+    if (persistentState) {
+        if (stateReset) {
+            if (!exec_before.empty())
+                strm.submit({exec_before.begin(), exec_before.end()});
+            else
+                state->FillZero();
+            stateReset = false;
+        }
+    } else if (!exec_before.empty()) {
         strm.submit({exec_before.begin(), exec_before.end()});
+    }
 
     if (prim)
         strm.submit({*prim});
@@ -502,4 +558,124 @@ void MKLDNNRNN::execute(mkldnn::stream strm) {
         strm.submit({exec_after.begin(), exec_after.end()});
 }
 
+MKLDNNRNN::PackedSegment &MKLDNNRNN::getPackedSegment(ptrdiff_t steps, ptrdiff_t batch) {
+    auto key = std::make_pair(steps, batch);
+    auto found = packedSegments.find(key);
+    if (found != packedSegments.end())
+        return found->second;
+    // the lengths change between the inferences, the primitives of the old ones are dropped
+    if (packedSegments.size() >= 32)
+        packedSegments.clear();
+
+    MKLDNNMemoryDesc src_d {{steps, batch, DC}, memory::f32, memory::tnc};
+    MKLDNNMemoryDesc dst_d {{steps, batch, SC}, memory::f32, memory::tnc};
+    MKLDNNMemoryDesc state_d {{L, D, S, batch, SC}, memory::f32, memory::ldsnc};
+    rnn_forward::desc desc(forward_scoring, cell_desc, direction, src_d, state_d, w_data_d, w_state_d, w_bias_d,
+                           dst_d, state_d);
+    rnn_forward::primitive_desc pd(desc, getEngine());
+
+    PackedSegment segment;
+    auto create = [&](const MKLDNNMemoryDesc &d) {
+        auto mem = std::make_shared<MKLDNNMemory>(getEngine());
+        mem->Create(d);
+        return mem;
+    };
+    segment.src = create(src_d);
+    segment.srcState = create(state_d);
+    segment.dst = create(dst_d);
+    segment.dstState = create(state_d);
+    segment.prim.reset(new rnn_forward(pd,
+            segment.src->GetPrimitive(), segment.srcState->GetPrimitive(),
+            weightsMem->GetPrimitive(), weightsStateMem->GetPrimitive(), biasMem->GetPrimitive(),
+            segment.dst->GetPrimitive(), segment.dstState->GetPrimitive(), workspaceMem->GetPrimitive()));
+    return packedSegments[key] = segment;
+}
+
+void MKLDNNRNN::executePacked(const std::vector<ptrdiff_t> &lengths) {
+    const float *src = static_cast<const float *>(getParentEdgeAt(0)->getMemory().GetData());
+    float *dst = static_cast<float *>(getChildEdgeAt(0)->getMemory().GetData());
+    auto offset = [&](ptrdiff_t t, ptrdiff_t n, ptrdiff_t C) {
+        return nativeOrder ? (t * N + n) * C : (n * T + t) * C;
+    };
+
+    // the states of the batch [S, N, SC], the sequences of the zero length keep the initial ones
+    std::vector<float> states(S * N * SC, 0.f);
+    for (ptrdiff_t s = 0; s < S && s + 1 < static_cast<ptrdiff_t>(getParentEdges().size()) - 1; s++) {
+        const float *init = static_cast<const float *>(getParentEdgeAt(s + 1)->getMemory().GetData());
+        std::copy(init, init + N * SC, states.begin() + s * N * SC);
+    }
+
+    // the longer sequences go first, so the active ones of every step are the prefix of the order
+    std::vector<ptrdiff_t> order(N);
+    for (ptrdiff_t n = 0; n < N; n++)
+        order[n] = n;
+    std::stable_sort(order.begin(), order.end(), [&](ptrdiff_t a, ptrdiff_t b) { return lengths[a] > lengths[b]; });
+
+    ptrdiff_t active = N, t0 = 0;
+    while (true) {
+        while (active > 0 && lengths[order[active - 1]] <= t0)
+            active--;
+        if (active == 0)
+            break;
+        // the steps until the shortest of the active sequences ends
+        const ptrdiff_t t1 = lengths[order[active - 1]];
+        PackedSegment &segment = getPackedSegment(t1 - t0, active);
+
+        float *segSrc = static_cast<float *>(segment.src->GetData());
+        float *segState = static_cast<float *>(segment.srcState->GetData());
+        for (ptrdiff_t t = 0; t < t1 - t0; t++)
+            for (ptrdiff_t i = 0; i < active; i++)
+                std::copy_n(src + offset(t0 + t, order[i], DC), DC, segSrc + (t * active + i) * DC);
+        for (ptrdiff_t s = 0; s < S; s++)
+            for (ptrdiff_t i = 0; i < active; i++)
+                std::copy_n(states.data() + (s * N + order[i]) * SC, SC, segState + (s * active + i) * SC);
+
+        stream(stream::kind::eager).submit({*segment.prim}).wait();
+
+        const float *segDst = static_cast<const float *>(segment.dst->GetData());
+        const float *segDstState = static_cast<const float *>(segment.dstState->GetData());
+        for (ptrdiff_t t = 0; t < t1 - t0; t++)
+            for (ptrdiff_t i = 0; i < active; i++)
+                std::copy_n(segDst + (t * active + i) * SC, SC, dst + offset(t0 + t, order[i], SC));
+        for (ptrdiff_t s = 0; s < S; s++)
+            for (ptrdiff_t i = 0; i < active; i++)
+                std::copy_n(segDstState + (s * active + i) * SC, SC, states.data() + (s * N + order[i]) * SC);
+        t0 = t1;
+    }
+
+    for (ptrdiff_t n = 0; n < N; n++)
+        for (ptrdiff_t t = lengths[n]; t < T; t++)
+            std::fill_n(dst + offset(t, n, SC), SC, 0.f);
+
+    for (ptrdiff_t s = 0; s < S && s + 1 < static_cast<ptrdiff_t>(getChildEdges().size()); s++) {
+        float *out = static_cast<float *>(getChildEdgeAt(s + 1)->getMemory().GetData());
+        std::copy_n(states.data() + s * N * SC, N * SC, out);
+    }
+}
+
+void MKLDNNRNN::setPersistentState() {
+    if (is_cell)
+        THROW_IE_EXCEPTION << "RNN cell " << getName() << " cannot keep the state between the executions";
+    persistentState = true;
+}
+
+void MKLDNNRNN::resetState() {
+    stateReset = true;
+}
+
+const MKLDNNMemory& MKLDNNRNN::getState() const {
+    if (!state)
+        THROW_IE_EXCEPTION << "RNN layer " << getName() << " does not keep the state";
+    return *state;
+}
+
+void MKLDNNRNN::setState(const float *data, size_t size) {
+    if (!state)
+        THROW_IE_EXCEPTION << "RNN layer " << getName() << " does not keep the state";
+    if (size != static_cast<size_t>(S * N * SC))
+        THROW_IE_EXCEPTION << "RNN layer " << getName() << " state size is not correct. Expected size: " << S * N * SC;
+    memcpy(state->GetData(), data, size * sizeof(float));
+    stateReset = false;
+}
+
 }  // namespace MKLDNNPlugin
@@ -6,8 +6,10 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <map>
 #include <string>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -26,10 +28,42 @@ public:
 
     void execute(mkldnn::stream strm) override;
 
+    /**
+     * @brief Keeps the state of the sequence between the executions, the state computed by the execution is the
+     * initial state of the next one. The initial state inputs are used only by the first execution after the reset.
+     * Has to be set before the descriptors are created, the cells do not support it.
+     */
+    void setPersistentState();
+    bool hasPersistentState() const {
+        return persistentState;
+    }
+
+    /**
+     * @brief The next execution starts from the initial state inputs, or from zeros if the layer has none
+     */
+    void resetState();
+
+    /**
+     * @brief The state of [states, batch, state channels] dims, the hidden state is the first
+     */
+    const MKLDNNMemory& getState() const;
+    void setState(const float *data, size_t size);
+
 private:
     void fillCellDesc();
     void fillSeqDesc();
 
+    /**
+     * @brief The primitive and the memories of the steps in which the same sequences of the batch are active
+     */
+    struct PackedSegment {
+        MKLDNNMemoryPtr src, srcState, dst, dstState;
+        std::shared_ptr<mkldnn::primitive> prim;
+    };
+    PackedSegment &getPackedSegment(ptrdiff_t steps, ptrdiff_t batch);
+    // computes the sequences shorter than T without their padding steps
+    void executePacked(const std::vector<ptrdiff_t> &lengths);
+
 private:
     static Register<MKLDNNRNN> reg;
 
@@ -69,6 +103,18 @@ private:
     // List of in/out reorders if required
     std::vector<mkldnn::reorder> exec_before;
     std::vector<mkldnn::reorder> exec_after;
+
+    bool persistentState = false;
+    // the next execution takes the initial state from the inputs
+    bool stateReset = true;
+    // the source and the destination state of the primitive in the persistent state mode
+    MKLDNNMemoryPtr state;
+
+    // the last input is the lengths of the sequences of the batch
+    bool withSeqLengths = false;
+    MKLDNNMemoryPtr weightsMem, weightsStateMem, biasMem, workspaceMem;
+    // the segments of the recent lengths by the number of the steps and of the active sequences
+    std::map<std::pair<ptrdiff_t, ptrdiff_t>, PackedSegment> packedSegments;
 };
 
 }  // namespace MKLDNNPlugin
@@ -21,8 +21,11 @@ public:
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool isExecutable() const override {
+        return !isOptimized();
+    }
 
-    bool isOptimized();
+    bool isOptimized() const;
     void initOptimalPrimitiveDescriptor() override;
 
     void setDynamicBatchLim(int lim) override;
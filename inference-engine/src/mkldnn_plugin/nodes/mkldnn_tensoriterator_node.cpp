@@ -0,0 +1,379 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tensoriterator_node.h"
+#include "mkldnn_concat_node.h"
+#include <ie_layers.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNTensorIteratorNode::MKLDNNTensorIteratorNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng)
+        : MKLDNNNode(layer, eng) {}
+
+void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
+    auto * tiLayer = dynamic_cast<InferenceEngine::TensorIterator*>(getCnnLayer().get());
+    if (tiLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot convert TensorIterator layer " << getName();
+
+    if (getParentEdges().size() != tiLayer->insData.size())
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    subGraph.CreateGraph(tiLayer->body, extensionManager);
+}
+
+void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto plainDesc = [](const MKLDNNDims &dims, const DataPtr &data) {
+        auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(data->getPrecision());
+        return MKLDNNMemoryDesc(dims, dataType, MKLDNNMemory::GetPlainFormat(dims));
+    };
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < getCnnLayer()->insData.size(); i++) {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = plainDesc(getParentEdgeAt(i)->getDims(), getCnnLayer()->insData[i].lock());
+        config.inConfs.push_back(dataConfig);
+    }
+    for (size_t i = 0; i < getCnnLayer()->outData.size(); i++) {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = plainDesc(MKLDNNDims(getCnnLayer()->outData[i]->getDims()), getCnnLayer()->outData[i]);
+        config.outConfs.push_back(dataConfig);
+    }
+    supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+}
+
+size_t MKLDNNTensorIteratorNode::PortIterator::chunkOffset(int iteration) const {
+    if (axis < 0)
+        return 0;
+    const int index = stride > 0 ? begin + iteration * stride : begin + (iteration + 1) * stride;
+    return static_cast<size_t>(index) * (chunkSize / std::abs(stride));
+}
+
+MKLDNNTensorIteratorNode::PortIterator MKLDNNTensorIteratorNode::makePortIterator(
+        const InferenceEngine::TensorIterator::PortMap &rule, const MKLDNNNodePtr &bodyNode, const MKLDNNDims &extDims,
+        bool isInput) const {
+    const MKLDNNMemory &bodyMemory = isInput ? bodyNode->getChildEdgeAt(0)->getMemory()
+                                             : bodyNode->getParentEdgeAt(0)->getMemory();
+    memory::dims bodyDims = bodyMemory.GetDims();
+    if (bodyMemory.GetFormat() != MKLDNNMemory::GetPlainFormat(bodyDims))
+        THROW_IE_EXCEPTION << "TensorIterator " << getName() << " supports only the plain layouts of the body ports";
+    const size_t elemSize = MKLDNNExtensionUtils::sizeOfDataType(bodyMemory.GetDataType());
+
+    PortIterator port;
+    port.extPort = rule.from;
+    port.bodyNode = bodyNode;
+    port.bindEdges = isInput ? getInputBindEdges(bodyNode) : getOutputBindEdges(bodyNode);
+    port.axis = rule.axis;
+    port.stride = rule.stride;
+    port.begin = 0;
+    port.outer = 1;
+    port.chunkSize = bodyMemory.GetSize();
+    port.rowSize = port.chunkSize;
+
+    memory::dims chunkDims = static_cast<memory::dims>(extDims);
+    if (rule.axis >= 0) {
+        const int size = extDims[rule.axis];
+        port.begin = rule.start >= 0 ? rule.start : size + rule.start + 1;
+        int end = rule.end >= 0 ? rule.end : size + rule.end + 1;
+        // the reverse iteration goes from the end of the range
+        if (rule.stride < 0 && port.begin < end)
+            std::swap(port.begin, end);
+
+        chunkDims[rule.axis] = std::abs(rule.stride);
+        size_t inner = elemSize;
+        for (int i = 0; i < extDims.ndims(); i++) {
+            if (i < rule.axis)
+                port.outer *= extDims[i];
+            else if (i > rule.axis)
+                inner *= extDims[i];
+        }
+        port.chunkSize = inner * std::abs(rule.stride);
+        port.rowSize = inner * size;
+        // the chunk is bound by pointer only if it is contiguous in the tensor
+        if (port.outer != 1)
+            port.bindEdges.clear();
+    }
+    if (chunkDims != bodyDims)
+        THROW_IE_EXCEPTION << "TensorIterator " << getName() << " port " << rule.from
+                           << " dims do not correspond to the body dims";
+    return port;
+}
+
+void MKLDNNTensorIteratorNode::createPrimitive() {
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set for node " << getName() << ".";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto &srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate for node " << getName() << ".";
+    }
+
+    auto * tiLayer = dynamic_cast<InferenceEngine::TensorIterator*>(getCnnLayer().get());
+    const auto &body = tiLayer->body;
+
+    auto &bodyInputs = subGraph.GetInputNodes();
+    auto findInput = [&](int idx) -> MKLDNNNodePtr {
+        auto input = bodyInputs.find(body.inputs[idx]->getName());
+        return input == bodyInputs.end() ? nullptr : input->second;
+    };
+    auto findOutput = [&](int idx) -> MKLDNNNodePtr {
+        for (auto &output : subGraph.GetOutputNodes()) {
+            if (output->getName() == "out_" + body.outputs[idx]->getName())
+                return output;
+        }
+        THROW_IE_EXCEPTION << "TensorIterator " << getName() << " has no body output " << body.outputs[idx]->getName();
+    };
+
+    // the number of iterations is defined by any iterated port, they all have to agree
+    iterations = 0;
+    auto countIterations = [&](const InferenceEngine::TensorIterator::PortMap &rule, const MKLDNNDims &dims) {
+        if (rule.axis < 0)
+            return;
+        if (rule.axis >= dims.ndims() || rule.stride == 0)
+            THROW_IE_EXCEPTION << "TensorIterator " << getName() << " has incorrect iteration rule of port "
+                               << rule.from;
+        const int size = dims[rule.axis];
+        const int begin = rule.start >= 0 ? rule.start : size + rule.start + 1;
+        const int end = rule.end >= 0 ? rule.end : size + rule.end + 1;
+        const int portIterations = std::abs(end - begin) / std::abs(rule.stride);
+        if (iterations != 0 && iterations != portIterations)
+            THROW_IE_EXCEPTION << "TensorIterator " << getName() << " has inconsistent number of iterations";
+        iterations = portIterations;
+    };
+    for (const auto &rule : tiLayer->input_port_map)
+        countIterations(rule, getParentEdgeAt(rule.from)->getDims());
+    for (const auto &rule : tiLayer->output_port_map) {
+        auto edges = getChildEdgesAtPort(rule.from);
+        if (!edges.empty())
+            countIterations(rule, edges[0]->getDims());
+    }
+    if (iterations == 0)
+        iterations = 1;
+
+    inputPorts.clear();
+    outputPorts.clear();
+    backEdges.clear();
+    for (const auto &rule : tiLayer->input_port_map) {
+        auto bodyNode = findInput(rule.to);
+        // the body does not use the input
+        if (bodyNode)
+            inputPorts.push_back(makePortIterator(rule, bodyNode, getParentEdgeAt(rule.from)->getDims(), true));
+    }
+    for (const auto &rule : tiLayer->output_port_map) {
+        auto edges = getChildEdgesAtPort(rule.from);
+        // the output is not used
+        if (edges.empty())
+            continue;
+        if (!edges[0]->getMemoryPtr() || !edges[0]->getMemoryPtr()->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Destination memory didn't allocate for node " << getName() << ".";
+        outputPorts.push_back(makePortIterator(rule, findOutput(rule.to), edges[0]->getDims(), false));
+    }
+
+    for (const auto &rule : tiLayer->back_edges) {
+        BackEdge backEdge;
+        backEdge.from = findOutput(rule.from);
+        backEdge.to = findInput(rule.to);
+        if (!backEdge.to)
+            continue;
+        backEdge.fromBindEdges = getOutputBindEdges(backEdge.from);
+        backEdge.toBindEdges = getInputBindEdges(backEdge.to);
+        for (const auto &port : outputPorts) {
+            if (port.bodyNode == backEdge.from && port.axis >= 0 && !port.bindEdges.empty())
+                backEdge.fromIterated = true;
+        }
+        if (!backEdge.toBindEdges.empty()) {
+            const auto &desc = backEdge.to->getChildEdgeAt(0)->getMemory().GetDescriptor();
+            for (int i = 0; i < 2; i++) {
+                MKLDNNMemoryPtr state(new MKLDNNMemory(getEngine()));
+                state->Create(desc);
+                state->FillZero();
+                backEdge.states.push_back(state);
+            }
+        }
+        backEdges.push_back(backEdge);
+    }
+}
+
+std::vector<MKLDNNEdgePtr> MKLDNNTensorIteratorNode::getInputBindEdges(const MKLDNNNodePtr &input) {
+    std::vector<MKLDNNEdgePtr> edges;
+    for (size_t i = 0; i < input->getChildEdges().size(); i++)
+        edges.push_back(input->getChildEdgeAt(i));
+
+    // the consumers which only read the memory, and the in-place views on it (like Reshape) are followed
+    for (size_t i = 0; i < edges.size(); i++) {
+        auto edge = edges[i];
+        auto child = edge->getChild();
+        if (child->isConstant() || child->getType() == Split)
+            return {};
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return {};
+
+        const int port = edge->getOutputNum();
+        const auto config = child->getSelectedPrimitiveDescriptor()->getConfig();
+        if (port >= config.inConfs.size() || config.inConfs[port].inPlace >= 0)
+            return {};
+        for (size_t j = 0; j < config.outConfs.size(); j++) {
+            if (config.outConfs[j].inPlace != port)
+                continue;
+            for (auto &view : child->getChildEdgesAtPort(j)) {
+                if (view->getMemory().GetData() != edge->getMemory().GetData())
+                    return {};
+                edges.push_back(view);
+            }
+        }
+    }
+    return edges;
+}
+
+std::vector<MKLDNNEdgePtr> MKLDNNTensorIteratorNode::getOutputBindEdges(const MKLDNNNodePtr &output) {
+    std::vector<MKLDNNEdgePtr> edges;
+    auto edge = output->getParentEdgeAt(0);
+    // the producer is followed through the in-place views on its output
+    while (true) {
+        auto parent = edge->getParent();
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->getType() == Input)
+            return {};
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(parent.get());
+        if (concat && concat->isOptimized())
+            return {};
+        edges.push_back(edge);
+
+        const auto config = parent->getSelectedPrimitiveDescriptor()->getConfig();
+        for (auto &in : config.inConfs) {
+            if (in.inPlace >= 0)
+                return {};
+        }
+        const int view = config.outConfs[edge->getInputNum()].inPlace;
+        if (view < 0)
+            return edges;
+
+        auto source = parent->getParentEdgeAt(view);
+        if (source->getMemory().GetData() != edge->getMemory().GetData())
+            return {};
+        edge = source;
+    }
+}
+
+void MKLDNNTensorIteratorNode::bind(const std::vector<MKLDNNEdgePtr> &edges, void *ptr) {
+    for (auto &edge : edges)
+        edge->getMemory().GetPrimitivePtr()->set_data_handle(ptr);
+}
+
+void MKLDNNTensorIteratorNode::copyChunk(const PortIterator &port, uint8_t *tensor, const MKLDNNMemory &body,
+                                         int iteration, bool toBody) {
+    uint8_t *chunk = tensor + port.chunkOffset(iteration);
+    auto *data = static_cast<uint8_t *>(body.GetData());
+    for (size_t i = 0; i < port.outer; i++) {
+        if (toBody)
+            memcpy(data + i * port.chunkSize, chunk + i * port.rowSize, port.chunkSize);
+        else
+            memcpy(chunk + i * port.rowSize, data + i * port.chunkSize, port.chunkSize);
+    }
+}
+
+void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
+    auto isBackEdgeTarget = [&](const MKLDNNNodePtr &node) {
+        for (const auto &backEdge : backEdges) {
+            if (backEdge.to == node)
+                return true;
+        }
+        return false;
+    };
+
+    for (int it = 0; it < iterations; it++) {
+        for (const auto &port : inputPorts) {
+            // the state after the first iteration and the bound constant inputs are provided already
+            if (port.axis < 0 && it > 0 && (isBackEdgeTarget(port.bodyNode) || !port.bindEdges.empty()))
+                continue;
+            auto *tensor = static_cast<uint8_t *>(getParentEdgeAt(port.extPort)->getMemory().GetData());
+            if (!port.bindEdges.empty())
+                bind(port.bindEdges, tensor + port.chunkOffset(it));
+            else
+                copyChunk(port, tensor, port.bodyNode->getChildEdgeAt(0)->getMemory(), it, true);
+        }
+
+        for (auto &backEdge : backEdges) {
+            if (!backEdge.states.empty()) {
+                if (it == 0) {
+                    bool initialized = false;
+                    for (const auto &port : inputPorts)
+                        initialized |= port.bodyNode == backEdge.to;
+                    if (!initialized) {
+                        backEdge.states[1]->FillZero();
+                        bind(backEdge.toBindEdges, backEdge.states[1]->GetData());
+                    }
+                } else {
+                    const MKLDNNMemory &from = backEdge.from->getParentEdgeAt(0)->getMemory();
+                    if (backEdge.fromBindEdges.empty()) {
+                        // the body output memory may be reused during the next iteration
+                        const MKLDNNMemory &state = *backEdge.states[(it - 1) % 2];
+                        memcpy(state.GetData(), from.GetData(), state.GetSize());
+                        bind(backEdge.toBindEdges, state.GetData());
+                    } else {
+                        // the output was written to the state buffer or to the chunk of the iterated output
+                        bind(backEdge.toBindEdges, from.GetData());
+                    }
+                }
+                if (!backEdge.fromBindEdges.empty() && !backEdge.fromIterated)
+                    bind(backEdge.fromBindEdges, backEdge.states[it % 2]->GetData());
+            } else if (it > 0) {
+                const MKLDNNMemory &from = backEdge.from->getParentEdgeAt(0)->getMemory();
+                const MKLDNNMemory &to = backEdge.to->getChildEdgeAt(0)->getMemory();
+                memcpy(to.GetData(), from.GetData(), to.GetSize());
+            }
+        }
+
+        for (const auto &port : outputPorts) {
+            if (port.axis >= 0 && !port.bindEdges.empty()) {
+                auto *tensor = static_cast<uint8_t *>(getChildEdgesAtPort(port.extPort)[0]->getMemory().GetData());
+                bind(port.bindEdges, tensor + port.chunkOffset(it));
+            }
+        }
+
+        subGraph.Infer();
+
+        for (const auto &port : outputPorts) {
+            if (port.axis >= 0 && port.bindEdges.empty()) {
+                auto *tensor = static_cast<uint8_t *>(getChildEdgesAtPort(port.extPort)[0]->getMemory().GetData());
+                copyChunk(port, tensor, port.bodyNode->getParentEdgeAt(0)->getMemory(), it, false);
+            }
+        }
+    }
+
+    // the outputs without the iteration are the values of the last iteration
+    for (const auto &port : outputPorts) {
+        if (port.axis < 0) {
+            auto *tensor = static_cast<uint8_t *>(getChildEdgesAtPort(port.extPort)[0]->getMemory().GetData());
+            copyChunk(port, tensor, port.bodyNode->getParentEdgeAt(0)->getMemory(), 0, false);
+        }
+    }
+}
+
+bool MKLDNNTensorIteratorNode::created() const {
+    return getType() == TensorIterator;
+}
+
+bool MKLDNNTensorIteratorNode::created(const MKLDNNExtensionManager::Ptr& extMgr) {
+    // the body nodes are created with the same extensions
+    extensionManager = extMgr;
+    return created();
+}
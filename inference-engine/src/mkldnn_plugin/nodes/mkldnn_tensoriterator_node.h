@@ -0,0 +1,91 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <mkldnn_graph.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief TensorIterator executed without unrolling: the body is compiled once into its own graph, which is run
+ * once per iteration.
+ * The body inputs and outputs are bound to the chunks of the sequence tensors by replacing the data pointers of
+ * their memory (together with the in-place views on it), and the back edges swap the pair of the node-owned state
+ * buffers. The ports which memory cannot be replaced (the chunk is not contiguous, or the memory is shared in-place
+ * with the other nodes of the body) fall back to the copy.
+ */
+class MKLDNNTensorIteratorNode : public MKLDNNNode {
+public:
+    MKLDNNTensorIteratorNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng);
+    ~MKLDNNTensorIteratorNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool created(const MKLDNNExtensionManager::Ptr& extMgr) override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+private:
+    /**
+     * @brief The rule of the iteration over a TensorIterator port, the chunk of the iteration i is at the offset
+     * (begin + i * stride) along the axis, it is the whole tensor for the ports without the axis
+     */
+    struct PortIterator {
+        int extPort;
+        MKLDNNNodePtr bodyNode;
+        // the body edges which memory is replaced, empty if they are filled by the copy
+        std::vector<MKLDNNEdgePtr> bindEdges;
+        int axis;
+        int stride;
+        int begin;
+        // the chunk is a group of outer rows of the chunkSize bytes with the rowSize bytes pitch in the tensor
+        size_t outer;
+        size_t chunkSize;
+        size_t rowSize;
+        size_t chunkOffset(int iteration) const;
+    };
+
+    struct BackEdge {
+        MKLDNNNodePtr from;
+        MKLDNNNodePtr to;
+        std::vector<MKLDNNEdgePtr> fromBindEdges;
+        std::vector<MKLDNNEdgePtr> toBindEdges;
+        // the pair of the state buffers the output of the iteration is written to and the input of the next one
+        // is read from, empty if the state is copied
+        std::vector<MKLDNNMemoryPtr> states;
+        // the output of the body is also the chunk of the iterated output of the TensorIterator
+        bool fromIterated = false;
+    };
+
+    PortIterator makePortIterator(const InferenceEngine::TensorIterator::PortMap &rule, const MKLDNNNodePtr &bodyNode,
+                                  const MKLDNNDims &extDims, bool isInput) const;
+
+    static std::vector<MKLDNNEdgePtr> getInputBindEdges(const MKLDNNNodePtr &input);
+    static std::vector<MKLDNNEdgePtr> getOutputBindEdges(const MKLDNNNodePtr &output);
+    static void bind(const std::vector<MKLDNNEdgePtr> &edges, void *ptr);
+    static void copyChunk(const PortIterator &port, uint8_t *tensor, const MKLDNNMemory &body, int iteration,
+                          bool toBody);
+
+    static Register<MKLDNNTensorIteratorNode> reg;
+
+    MKLDNNExtensionManager::Ptr extensionManager;
+    MKLDNNGraph subGraph;
+    int iterations = 0;
+
+    std::vector<PortIterator> inputPorts;
+    std::vector<PortIterator> outputPorts;
+    std::vector<BackEdge> backEdges;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,263 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <ie_plugin_dispatcher.hpp>
+#include <ie_plugin_config.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include "multi_device.hpp"
+
+namespace MultiDevicePlugin {
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::MultiDeviceConfigParams;
+
+// one request is inferred by a device, while the next one is being prepared
+static const unsigned int defaultNumRequests = 2;
+
+std::vector<DeviceInformation> ParseDevicePriorities(const std::string &priorities) {
+    std::vector<DeviceInformation> devices;
+    std::string::size_type pos = 0;
+    while (pos < priorities.size()) {
+        auto end = priorities.find(',', pos);
+        if (end == std::string::npos) end = priorities.size();
+        std::string device = priorities.substr(pos, end - pos);
+        pos = end + 1;
+
+        unsigned int numRequests = defaultNumRequests;
+        auto openBracket = device.find('(');
+        if (openBracket != std::string::npos) {
+            auto closeBracket = device.find(')', openBracket);
+            int value = 0;
+            try {
+                value = std::stoi(device.substr(openBracket + 1, closeBracket - openBracket - 1));
+            } catch (const std::exception &) {
+            }
+            if (closeBracket != device.size() - 1 || value <= 0)
+                THROW_IE_EXCEPTION << "Wrong number of requests of the device " << device << " in "
+                                   << KEY_MULTI_DEVICE_PRIORITIES;
+            numRequests = static_cast<unsigned int>(value);
+            device = device.substr(0, openBracket);
+        }
+        if (device.empty())
+            THROW_IE_EXCEPTION << "Empty device name in " << KEY_MULTI_DEVICE_PRIORITIES << ": " << priorities;
+        devices.push_back({device, numRequests});
+    }
+    if (devices.empty())
+        THROW_IE_EXCEPTION << "No devices in " << KEY_MULTI_DEVICE_PRIORITIES;
+    return devices;
+}
+
+MultiDeviceInferRequest::MultiDeviceInferRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs,
+                                                 MultiDeviceExecutableNetwork &network)
+        : AsyncInferRequestForwardingInternal(networkInputs, networkOutputs), _network(network) {}
+
+void MultiDeviceInferRequest::scheduleImpl() {
+    _network.schedule(this);
+}
+
+MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(
+        const std::vector<std::pair<DeviceInformation, ExecutableNetwork>> &networks) {
+    if (networks.empty()) THROW_IE_EXCEPTION << "No devices to load the network on";
+    _devices.resize(networks.size());
+    for (size_t d = 0; d < networks.size(); d++) {
+        auto &device = _devices[d];
+        device._name = networks[d].first.deviceName;
+        device._network = networks[d].second;
+        device._numWorkers = networks[d].first.numRequests;
+        for (unsigned int i = 0; i < networks[d].first.numRequests; i++) {
+            _workers.emplace_back(new WorkerInferRequest());
+            auto worker = _workers.back().get();
+            worker->_inferRequest = device._network.CreateInferRequest();
+            worker->_device = d;
+            worker->_inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                    [this, worker](InferRequest, StatusCode status) { onWorkerDone(worker, status); });
+            device._idleWorkers.push_back(worker);
+        }
+    }
+}
+
+MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
+    // the requests of the application keep the network alive, so only the tails of the callbacks can run here
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idleCondVar.wait(lock, [this] {
+        size_t idle = 0;
+        for (auto &&device : _devices) idle += device._idleWorkers.size();
+        return idle == _workers.size();
+    });
+}
+
+void MultiDeviceExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
+    auto asyncRequestImpl = std::make_shared<MultiDeviceInferRequest>(_networkInputs, _networkOutputs, *this);
+    asyncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    asyncRequestImpl->setMetricsRegistry(_metrics);
+    asyncRequest.reset(new InferRequestBase<AsyncInferRequestInternal>(asyncRequestImpl),
+                       [](IInferRequest *p) { p->Release(); });
+    asyncRequestImpl->SetPublicInterfacePtr(asyncRequest);
+}
+
+MultiDeviceExecutableNetwork::WorkerInferRequest *MultiDeviceExecutableNetwork::popIdleWorker() {
+    Device *best = nullptr;
+    double bestThroughput = 0;
+    for (auto &&device : _devices) {
+        if (device._idleWorkers.empty()) continue;
+        double throughput = device._latencyUSec == 0 ? std::numeric_limits<double>::max()
+                                                     : device._numWorkers / device._latencyUSec;
+        // the devices of the same throughput are taken in the order of priority
+        if (best == nullptr || throughput > bestThroughput) {
+            best = &device;
+            bestThroughput = throughput;
+        }
+    }
+    if (best == nullptr) return nullptr;
+    auto worker = best->_idleWorkers.back();
+    best->_idleWorkers.pop_back();
+    return worker;
+}
+
+void MultiDeviceExecutableNetwork::schedule(MultiDeviceInferRequest *request) {
+    WorkerInferRequest *worker;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        worker = popIdleWorker();
+        if (worker == nullptr) {
+            _pending.push_back(request);
+            return;
+        }
+    }
+    dispatch(worker, request);
+}
+
+void MultiDeviceExecutableNetwork::dispatch(WorkerInferRequest *worker, MultiDeviceInferRequest *request) {
+    while (request != nullptr) {
+        try {
+            // the device request reads and writes the blobs of the request in place
+            for (auto &&input : request->getInputs()) {
+                worker->_inferRequest.SetBlob(input.first, input.second);
+            }
+            for (auto &&output : request->getOutputs()) {
+                worker->_inferRequest.SetBlob(output.first, output.second);
+            }
+            worker->_request = request;
+            worker->_startTime = std::chrono::steady_clock::now();
+            worker->_inferRequest.StartAsync();
+            return;
+        } catch (...) {
+            worker->_request = nullptr;
+            request->complete(GENERAL_ERROR);
+        }
+        // the device request is still idle, so it takes the next waiting request
+        std::lock_guard<std::mutex> lock(_mutex);
+        request = nullptr;
+        if (!_pending.empty()) {
+            request = _pending.front();
+            _pending.pop_front();
+        } else {
+            _devices[worker->_device]._idleWorkers.push_back(worker);
+            _idleCondVar.notify_all();
+        }
+    }
+}
+
+void MultiDeviceExecutableNetwork::onWorkerDone(WorkerInferRequest *worker, StatusCode status) {
+    auto request = worker->_request;
+    worker->_request = nullptr;
+    MultiDeviceInferRequest *next = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto &device = _devices[worker->_device];
+        double latency = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - worker->_startTime).count());
+        device._latencyUSec = device._latencyUSec == 0 ? std::max(latency, 1.0)
+                                                       : 0.9 * device._latencyUSec + 0.1 * latency;
+        if (!_pending.empty()) {
+            next = _pending.front();
+            _pending.pop_front();
+        } else {
+            device._idleWorkers.push_back(worker);
+            _idleCondVar.notify_all();
+        }
+    }
+    // the device is kept busy before the application gets the result
+    if (next != nullptr) {
+        dispatch(worker, next);
+    }
+    if (request != nullptr) {
+        request->complete(status);
+    }
+}
+
+InferencePlugin Engine::getPlugin(const std::string &deviceName) {
+    auto it = _plugins.find(deviceName);
+    if (it != _plugins.end()) return it->second;
+
+    PluginDispatcher dispatcher({""});
+    auto plugin = dispatcher.getPluginByDevice(deviceName);
+    if (deviceName == "CPU") {
+        for (auto &&extension : _extensions) {
+            plugin.AddExtension(extension);
+        }
+    }
+    _plugins[deviceName] = plugin;
+    return plugin;
+}
+
+ExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(ICNNNetwork &network,
+                                                          const std::map<std::string, std::string> &config) {
+    // we must not override the parameter, but need to copy everything from plugin config
+    std::map<std::string, std::string> fullConfig = config;
+    for (auto &&c : _config) {
+        if (fullConfig.find(c.first) == fullConfig.end()) {
+            fullConfig[c.first] = c.second;
+        }
+    }
+    auto priorities = fullConfig.find(KEY_MULTI_DEVICE_PRIORITIES);
+    if (priorities == fullConfig.end()) {
+        THROW_IE_EXCEPTION << KEY_MULTI_DEVICE_PRIORITIES << " key is not set for MULTI device";
+    }
+
+    std::vector<std::pair<DeviceInformation, ExecutableNetwork>> networks;
+    for (auto &&device : ParseDevicePriorities(priorities->second)) {
+        auto plugin = getPlugin(device.deviceName);
+        // preparing local version of configs which are supported by the plugin
+        std::map<std::string, std::string> deviceConfig;
+        for (auto &&c : fullConfig) {
+            if (c.first == KEY_MULTI_DEVICE_PRIORITIES) continue;
+            try {
+                plugin.SetConfig({{c.first, c.second}});
+                deviceConfig.insert(c);
+            } catch (const details::InferenceEngineException &) {
+            }
+        }
+        networks.emplace_back(device, plugin.LoadNetwork(network, deviceConfig));
+    }
+    return std::make_shared<MultiDeviceExecutableNetwork>(networks);
+}
+
+void Engine::SetConfig(const std::map<std::string, std::string> &config) {
+    for (auto &&c : config) {
+        if (c.first == KEY_MULTI_DEVICE_PRIORITIES) {
+            // the value is checked before the network is loaded
+            ParseDevicePriorities(c.second);
+        }
+        _config[c.first] = c.second;
+    }
+}
+
+void Engine::AddExtension(IExtensionPtr extension) {
+    _extensions.push_back(extension);
+    auto cpu = _plugins.find("CPU");
+    if (cpu != _plugins.end()) {
+        cpu->second.AddExtension(extension);
+    }
+}
+
+}  // namespace MultiDevicePlugin
@@ -0,0 +1,130 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cpp/ie_plugin_cpp.hpp>
+#include <cpp_interfaces/impl/ie_plugin_internal.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_internal.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_forwarding_internal.hpp>
+
+namespace MultiDevicePlugin {
+
+/**
+ * @brief The device the network is loaded on and the number of its infer requests
+ */
+struct DeviceInformation {
+    std::string deviceName;
+    unsigned int numRequests;
+};
+
+/**
+ * @brief Parses the value of MULTI_DEVICE_PRIORITIES, e.g. "GPU(4),CPU"
+ */
+std::vector<DeviceInformation> ParseDevicePriorities(const std::string &priorities);
+
+class MultiDeviceExecutableNetwork;
+
+/**
+ * @brief The request of the application, which is inferred by one of the requests of the devices
+ */
+class MultiDeviceInferRequest : public InferenceEngine::AsyncInferRequestForwardingInternal {
+public:
+    typedef std::shared_ptr<MultiDeviceInferRequest> Ptr;
+
+    MultiDeviceInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                            InferenceEngine::OutputsDataMap networkOutputs,
+                            MultiDeviceExecutableNetwork &network);
+
+protected:
+    void scheduleImpl() override;
+
+private:
+    MultiDeviceExecutableNetwork &_network;
+};
+
+/**
+ * @brief The network loaded on several devices at once. Every device has a pool of infer requests, the requests of
+ * the application are given to the idle ones, or wait for the first device request that becomes idle. Among the idle
+ * devices the one with the highest measured throughput is chosen, the devices not measured yet go first, in the order
+ * of priority.
+ */
+class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkInternal,
+                                     public std::enable_shared_from_this<MultiDeviceExecutableNetwork> {
+public:
+    typedef std::shared_ptr<MultiDeviceExecutableNetwork> Ptr;
+
+    explicit MultiDeviceExecutableNetwork(
+            const std::vector<std::pair<DeviceInformation, InferenceEngine::ExecutableNetwork>> &networks);
+
+    ~MultiDeviceExecutableNetwork();
+
+    void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
+
+    /**
+     * @brief Gives the request to an idle device request or queues it till one becomes idle
+     */
+    void schedule(MultiDeviceInferRequest *request);
+
+private:
+    struct WorkerInferRequest {
+        InferenceEngine::InferRequest _inferRequest;
+        MultiDeviceInferRequest *_request = nullptr;
+        size_t _device = 0;
+        std::chrono::steady_clock::time_point _startTime;
+    };
+
+    struct Device {
+        std::string _name;
+        InferenceEngine::ExecutableNetwork _network;
+        std::vector<WorkerInferRequest *> _idleWorkers;
+        // the moving average of the time a device request takes, 0 until the first request is inferred
+        double _latencyUSec = 0;
+        size_t _numWorkers = 0;
+    };
+
+    /* Takes the idle device request of the best device, returns nullptr if every device is busy */
+    WorkerInferRequest *popIdleWorker();
+
+    /* Starts the request on the device request, which is taken from the idle ones and owned by the caller */
+    void dispatch(WorkerInferRequest *worker, MultiDeviceInferRequest *request);
+
+    void onWorkerDone(WorkerInferRequest *worker, InferenceEngine::StatusCode status);
+
+    std::mutex _mutex;
+    std::condition_variable _idleCondVar;
+    std::deque<MultiDeviceInferRequest *> _pending;
+    std::vector<Device> _devices;
+    // declared last to be destroyed first, the destructors of the requests wait for their callbacks
+    std::vector<std::unique_ptr<WorkerInferRequest>> _workers;
+};
+
+class Engine : public InferenceEngine::InferencePluginInternal {
+public:
+    Engine() = default;
+
+    InferenceEngine::ExecutableNetworkInternal::Ptr
+    LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network,
+                       const std::map<std::string, std::string> &config) override;
+
+    void SetConfig(const std::map<std::string, std::string> &config) override;
+
+    void AddExtension(InferenceEngine::IExtensionPtr extension) override;
+
+private:
+    InferenceEngine::InferencePlugin getPlugin(const std::string &deviceName);
+
+    std::map<std::string, InferenceEngine::InferencePlugin> _plugins;
+    std::vector<InferenceEngine::IExtensionPtr> _extensions;
+};
+
+}  // namespace MultiDevicePlugin
@@ -0,0 +1,21 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <cpp_interfaces/base/ie_plugin_base.hpp>
+#include "description_buffer.hpp"
+#include "multi_device.hpp"
+
+using namespace InferenceEngine;
+using namespace MultiDevicePlugin;
+
+INFERENCE_PLUGIN_API(StatusCode) CreatePluginEngine(IInferencePlugin *&plugin, ResponseDesc *resp) noexcept {
+    try {
+        plugin = make_ie_compatible_plugin({{1, 6}, CI_BUILD_NUMBER, "MultiDevicePlugin"}, std::make_shared<Engine>());
+        return OK;
+    }
+    catch (std::exception &ex) {
+        return DescriptionBuffer(GENERAL_ERROR, resp) << ex.what();
+    }
+}
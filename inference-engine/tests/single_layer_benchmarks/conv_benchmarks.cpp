@@ -0,0 +1,61 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "single_layer_benchmark.hpp"
+
+using namespace InferenceEngine;
+
+class ConvolutionBenchmark : public SingleLayerBenchmark,
+                             public ::testing::WithParamInterface<std::tuple<std::string, conv_bench_params>> {
+};
+
+TEST_P(ConvolutionBenchmark, Convolution) {
+    const conv_bench_params p = std::get<1>(GetParam());
+    if (!loadPlugin(std::get<0>(GetParam())))
+        SKIP();
+
+    const std::vector<size_t> out = {p.in[0], p.out_c, p.outH(), p.outW()};
+    std::map<std::string, std::string> params = {
+            {"stride-x", std::to_string(p.stride)},
+            {"stride-y", std::to_string(p.stride)},
+            {"pad-x",    std::to_string(p.pad)},
+            {"pad-y",    std::to_string(p.pad)},
+            {"kernel-x", std::to_string(p.kernel)},
+            {"kernel-y", std::to_string(p.kernel)},
+            {"output",   std::to_string(p.out_c)},
+            {"group",    std::to_string(p.group)}
+    };
+    const size_t weights = p.out_c * p.in[1] / p.group * p.kernel * p.kernel;
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Convolution", p.in, "FP32")
+            .addLayer("Convolution", "FP32", &params, {{p.in}, {out}},
+                      weights * sizeof(float), p.out_c * sizeof(float))
+            .finish();
+
+    const double inSize = p.in[0] * p.in[1] * p.in[2] * p.in[3];
+    const double outSize = out[0] * out[1] * out[2] * out[3];
+    // a multiply-add per the weight of an output channel for every output point
+    LayerWork work = {2. * outSize * (p.in[1] / p.group) * p.kernel * p.kernel,
+                      sizeof(float) * (inSize + outSize + weights + p.out_c)};
+
+    std::ostringstream name;
+    PrintTo(p, &name);
+    run("Convolution " + name.str(), readNetwork(model, (weights + p.out_c) * sizeof(float)), work);
+}
+
+INSTANTIATE_TEST_CASE_P(
+        Benchmark, ConvolutionBenchmark,
+        ::testing::Combine(BENCHMARK_DEVICES, ::testing::Values(
+                // the first layers of the classification networks
+                conv_bench_params{{1, 3, 224, 224}, 64, 7, 2, 3, 1},
+                conv_bench_params{{1, 64, 56, 56}, 64, 3, 1, 1, 1},
+                // the bottlenecks
+                conv_bench_params{{1, 256, 56, 56}, 64, 1, 1, 0, 1},
+                conv_bench_params{{1, 512, 28, 28}, 128, 1, 1, 0, 1},
+                conv_bench_params{{1, 256, 14, 14}, 256, 3, 1, 1, 1},
+                conv_bench_params{{1, 2048, 7, 7}, 512, 1, 1, 0, 1},
+                // depthwise and grouped
+                conv_bench_params{{1, 144, 56, 56}, 144, 3, 1, 1, 144},
+                conv_bench_params{{1, 256, 28, 28}, 256, 3, 1, 1, 32},
+                // batched
+                conv_bench_params{{8, 64, 56, 56}, 64, 3, 1, 1, 1})));
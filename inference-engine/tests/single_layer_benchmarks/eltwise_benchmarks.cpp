@@ -0,0 +1,39 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "single_layer_benchmark.hpp"
+
+using namespace InferenceEngine;
+
+class EltwiseBenchmark : public SingleLayerBenchmark,
+                         public ::testing::WithParamInterface<std::tuple<std::string, std::string, std::vector<size_t>>> {
+};
+
+TEST_P(EltwiseBenchmark, Eltwise) {
+    const std::string operation = std::get<1>(GetParam());
+    const std::vector<size_t> dims = std::get<2>(GetParam());
+    if (!loadPlugin(std::get<0>(GetParam())))
+        SKIP();
+
+    std::map<std::string, std::string> params = {{"operation", operation}};
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Eltwise", dims, "FP32")
+            .addInputLayer("FP32", dims)
+            .addLayer("Eltwise", "FP32", &params, {{dims, dims}, {dims}})
+            .havingEdges().connect(0, 2).connect(1, 2).finish();
+
+    double size = 1.;
+    for (auto dim : dims)
+        size *= dim;
+    // an operation per element, two reads and a write
+    run("Eltwise " + operation + " " + std::to_string(static_cast<size_t>(size)),
+        readNetwork(model, 0), {size, 3. * sizeof(float) * size});
+}
+
+INSTANTIATE_TEST_CASE_P(
+        Benchmark, EltwiseBenchmark,
+        ::testing::Combine(BENCHMARK_DEVICES,
+                           ::testing::Values(std::string("sum"), std::string("prod"), std::string("max")),
+                           ::testing::Values(std::vector<size_t>{1, 64, 56, 56},
+                                             std::vector<size_t>{1, 256, 56, 56},
+                                             std::vector<size_t>{8, 512, 28, 28})));
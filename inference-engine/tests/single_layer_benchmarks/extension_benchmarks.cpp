@@ -0,0 +1,47 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "single_layer_benchmark.hpp"
+
+using namespace InferenceEngine;
+
+struct extension_bench_params {
+    std::string type;
+    std::map<std::string, std::string> params;
+    // the operations per an element of the input
+    double flopsPerElement;
+};
+
+static inline void PrintTo(const extension_bench_params &p, std::ostream *os) {
+    *os << p.type;
+}
+
+class ExtensionBenchmark : public SingleLayerBenchmark,
+                           public ::testing::WithParamInterface<std::tuple<std::string, extension_bench_params>> {
+};
+
+TEST_P(ExtensionBenchmark, Extension) {
+    extension_bench_params p = std::get<1>(GetParam());
+    if (!loadPlugin(std::get<0>(GetParam())))
+        SKIP();
+    // the CPU plugin implements these layers in the extensions library
+    if (device == "CPU" && !addCpuExtensions())
+        SKIP();
+
+    const std::vector<size_t> dims = {1, 256, 56, 56};
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput(p.type, dims, "FP32")
+            .addLayer(p.type, "FP32", &p.params, {{dims}, {dims}})
+            .finish();
+
+    const double size = dims[0] * dims[1] * dims[2] * dims[3];
+    run(p.type, readNetwork(model, 0), {p.flopsPerElement * size, 2. * sizeof(float) * size});
+}
+
+INSTANTIATE_TEST_CASE_P(
+        Benchmark, ExtensionBenchmark,
+        ::testing::Combine(BENCHMARK_DEVICES, ::testing::Values(
+                // the mean and the variance passes and the normalization
+                extension_bench_params{"MVN", {{"across_channels", "0"}, {"normalize_variance", "1"},
+                                               {"eps", "1e-9"}}, 6.},
+                extension_bench_params{"ShuffleChannels", {{"axis", "1"}, {"group", "4"}}, 0.})));
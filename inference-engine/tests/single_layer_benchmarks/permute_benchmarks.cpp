@@ -0,0 +1,45 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "single_layer_benchmark.hpp"
+
+using namespace InferenceEngine;
+
+class PermuteBenchmark : public SingleLayerBenchmark,
+                         public ::testing::WithParamInterface<std::tuple<std::string, std::vector<size_t>, std::vector<size_t>>> {
+};
+
+TEST_P(PermuteBenchmark, Permute) {
+    const std::vector<size_t> dims = std::get<1>(GetParam());
+    const std::vector<size_t> order = std::get<2>(GetParam());
+    if (!loadPlugin(std::get<0>(GetParam())))
+        SKIP();
+
+    std::vector<size_t> out(dims.size());
+    std::string orderStr;
+    for (size_t i = 0; i < order.size(); i++) {
+        out[i] = dims[order[i]];
+        orderStr += (i ? "," : "") + std::to_string(order[i]);
+    }
+    std::map<std::string, std::string> params = {{"order", orderStr}};
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Permute", dims, "FP32")
+            .addLayer("Permute", "FP32", &params, {{dims}, {out}})
+            .finish();
+
+    double size = 1.;
+    for (auto dim : dims)
+        size *= dim;
+    // the reorder moves the data only
+    run("Permute " + orderStr + " " + std::to_string(static_cast<size_t>(size)),
+        readNetwork(model, 0), {0., 2. * sizeof(float) * size});
+}
+
+INSTANTIATE_TEST_CASE_P(
+        Benchmark, PermuteBenchmark,
+        ::testing::Combine(BENCHMARK_DEVICES,
+                           ::testing::Values(std::vector<size_t>{1, 64, 56, 56},
+                                             std::vector<size_t>{8, 256, 28, 28}),
+                           ::testing::Values(std::vector<size_t>{0, 2, 3, 1},
+                                             std::vector<size_t>{0, 3, 1, 2},
+                                             std::vector<size_t>{0, 1, 3, 2})));
@@ -0,0 +1,51 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "single_layer_benchmark.hpp"
+
+using namespace InferenceEngine;
+
+class PreprocessBenchmark : public SingleLayerBenchmark,
+                            public ::testing::WithParamInterface<std::tuple<std::string, std::vector<size_t>>> {
+};
+
+// the U8 interleaved image of the camera is resized to the input of the network by the preprocessing of the request,
+// the network itself is a trivial scale
+TEST_P(PreprocessBenchmark, ResizeBilinear) {
+    const std::vector<size_t> src = std::get<1>(GetParam());
+    if (!loadPlugin(std::get<0>(GetParam())))
+        SKIP();
+
+    const std::vector<size_t> dims = {1, 3, 224, 224};
+    std::map<std::string, std::string> params = {{"power", "1"}, {"scale", "1"}, {"shift", "0"}};
+    std::string model = testing::V2NetBuilder::buildNetworkWithOneInput("Preprocess", dims, "FP32")
+            .addLayer("Power", "FP32", &params, {{dims}, {dims}})
+            .finish();
+
+    CNNNetwork network = readNetwork(model, 0);
+    InputInfo::Ptr input = network.getInputsInfo().begin()->second;
+    input->setPrecision(Precision::U8);
+    input->setLayout(Layout::NHWC);
+    input->getPreProcess().setResizeAlgorithm(RESIZE_BILINEAR);
+
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, src, Layout::NHWC));
+    image->allocate();
+    fillRandom(image);
+
+    const double srcSize = src[0] * src[1] * src[2] * src[3];
+    const double dstSize = dims[0] * dims[1] * dims[2] * dims[3];
+    // the interpolation of a point takes 4 multiply-adds, the image is read once and the tensor is written and read
+    // by the layer
+    std::ostringstream name;
+    name << "ResizeBilinear " << src[3] << "x" << src[2] << " -> " << dims[3] << "x" << dims[2];
+    run(name.str(), network, {8. * dstSize, srcSize + 3. * sizeof(float) * dstSize},
+        {{network.getInputsInfo().begin()->first, image}});
+}
+
+INSTANTIATE_TEST_CASE_P(
+        Benchmark, PreprocessBenchmark,
+        ::testing::Combine(BENCHMARK_DEVICES,
+                           ::testing::Values(std::vector<size_t>{1, 3, 480, 640},
+                                             std::vector<size_t>{1, 3, 1080, 1920},
+                                             std::vector<size_t>{1, 3, 112, 112})));
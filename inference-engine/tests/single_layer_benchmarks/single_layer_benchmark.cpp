@@ -0,0 +1,131 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "single_layer_benchmark.hpp"
+
+#include <inference_engine/precision_utils.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+using namespace InferenceEngine;
+
+void PrintTo(const conv_bench_params &p, std::ostream *os) {
+    *os << "in=" << p.in[0] << "x" << p.in[1] << "x" << p.in[2] << "x" << p.in[3]
+        << " out_c=" << p.out_c << " k=" << p.kernel << " s=" << p.stride << " p=" << p.pad << " g=" << p.group;
+}
+
+double SingleLayerBenchmark::envValue(const std::string &name, double defaultValue) {
+    const char *value = std::getenv(name.c_str());
+    return value ? std::atof(value) : defaultValue;
+}
+
+bool SingleLayerBenchmark::loadPlugin(const std::string &deviceName) {
+    device = deviceName;
+    try {
+        plugin = InferencePlugin(PluginDispatcher({"", "./", "./lib"}).getPluginByDevice(device));
+    } catch (const details::InferenceEngineException &e) {
+        std::cout << device << " plugin is not available: " << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool SingleLayerBenchmark::addCpuExtensions() {
+    try {
+        plugin.AddExtension(make_so_pointer<IExtension>(make_so_name("ie_cpu_extension")));
+    } catch (const details::InferenceEngineException &e) {
+        std::cout << "CPU extensions are not available: " << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void SingleLayerBenchmark::fillRandom(const Blob::Ptr &blob) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    switch (blob->getTensorDesc().getPrecision()) {
+        case Precision::FP32: {
+            auto data = blob->buffer().as<float *>();
+            for (size_t i = 0; i < blob->size(); i++)
+                data[i] = dist(gen);
+            break;
+        }
+        case Precision::FP16: {
+            auto data = blob->buffer().as<ie_fp16 *>();
+            for (size_t i = 0; i < blob->size(); i++)
+                data[i] = PrecisionUtils::f32tof16(dist(gen));
+            break;
+        }
+        default: {
+            auto data = blob->buffer().as<uint8_t *>();
+            for (size_t i = 0; i < blob->byteSize(); i++)
+                data[i] = static_cast<uint8_t>(gen());
+            break;
+        }
+    }
+}
+
+CNNNetwork SingleLayerBenchmark::readNetwork(const std::string &model, size_t weightsSize) {
+    CNNNetReader reader;
+    reader.ReadNetwork(model.data(), model.length());
+
+    TBlob<uint8_t>::Ptr weights(new TBlob<uint8_t>({Precision::U8, {std::max<size_t>(weightsSize, 1)}, Layout::C}));
+    weights->allocate();
+    // the weights are FP32, small values keep the outputs of the deep layers finite
+    float *data = weights->buffer().as<float *>();
+    for (size_t i = 0; i < weightsSize / sizeof(float); i++)
+        data[i] = 0.01f * static_cast<float>(static_cast<int>(i % 21) - 10);
+    reader.SetWeights(weights);
+    return reader.getNetwork();
+}
+
+void SingleLayerBenchmark::run(const std::string &name, CNNNetwork network, const LayerWork &work,
+                               const std::map<std::string, Blob::Ptr> &inputs) {
+    ExecutableNetwork executable = plugin.LoadNetwork(network, {});
+    InferRequest request = executable.CreateInferRequest();
+
+    for (const auto &input : network.getInputsInfo()) {
+        auto blob = inputs.find(input.first);
+        if (blob != inputs.end()) {
+            request.SetBlob(input.first, blob->second);
+        } else {
+            fillRandom(request.GetBlob(input.first));
+        }
+    }
+
+    const int iterations = std::max(1, static_cast<int>(envValue("BENCH_ITERATIONS", 100)));
+    // the first iterations compile the kernels, warm the caches and the pages up
+    for (int i = 0; i < 3; i++)
+        request.Infer();
+
+    std::vector<double> times(iterations);
+    for (auto &time : times) {
+        auto start = std::chrono::steady_clock::now();
+        request.Infer();
+        time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    std::nth_element(times.begin(), times.begin() + iterations / 2, times.end());
+    const double ms = times[iterations / 2];
+
+    const double gflops = work.flops / (ms * 1e6);
+    const double gbs = work.bytes / (ms * 1e6);
+    std::cout << std::fixed << std::setprecision(3)
+              << "[ BENCH    ] " << device << " " << name << ": " << ms << " ms, "
+              << gflops << " GFLOP/s, " << gbs << " GB/s, "
+              << "intensity " << (work.bytes > 0 ? work.flops / work.bytes : 0.) << " FLOP/B";
+
+    const double peakGflops = envValue("BENCH_" + device + "_PEAK_GFLOPS", 0.);
+    const double peakGbs = envValue("BENCH_" + device + "_PEAK_GBS", 0.);
+    if (peakGflops > 0. && peakGbs > 0.) {
+        // the roofline time: the layer is either compute or memory bound
+        const double boundMs = std::max(work.flops / (peakGflops * 1e6), work.bytes / (peakGbs * 1e6));
+        std::cout << ", " << (work.flops / (peakGflops * 1e6) >= work.bytes / (peakGbs * 1e6) ? "compute" : "memory")
+                  << " bound, " << std::setprecision(1) << 100. * boundMs / ms << "% of roofline";
+    }
+    std::cout << std::endl;
+}
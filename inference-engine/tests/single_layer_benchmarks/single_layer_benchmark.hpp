@@ -0,0 +1,89 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <inference_engine.hpp>
+#include <xml_net_builder.hpp>
+#include <tests_common.hpp>
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief The amount of the work of a layer: the roofline of the device bounds the time of the layer
+ * by max(flops / peak GFLOP/s, bytes / peak GB/s)
+ */
+struct LayerWork {
+    double flops;
+    double bytes;
+};
+
+/**
+ * @brief The common part of the single layer benchmarks: the network of one layer is built by the test helpers,
+ * loaded to the device and inferred in a loop. The median time is reported together with the achieved GFLOP/s,
+ * GB/s and the share of the roofline estimate. The peaks of the device are taken from the environment
+ * variables BENCH_<DEVICE>_PEAK_GFLOPS and BENCH_<DEVICE>_PEAK_GBS, the roofline is not printed without them.
+ * The number of the measured iterations is BENCH_ITERATIONS, 100 by default.
+ */
+class SingleLayerBenchmark : public TestsCommon {
+protected:
+    /**
+     * @brief Loads the plugin of the device, the benchmark is skipped when the plugin is not available
+     */
+    bool loadPlugin(const std::string &deviceName);
+
+    /**
+     * @brief Reads the IR with the random weights of the given size
+     */
+    InferenceEngine::CNNNetwork readNetwork(const std::string &model, size_t weightsSize);
+
+    /**
+     * @brief Loads the network to the device of the test, fills the inputs with the random data and measures the
+     * median time of the inference
+     * @param name the name of the case in the report
+     * @param inputs the blobs to set instead of the allocated ones, the rest of the inputs are allocated
+     */
+    void run(const std::string &name, InferenceEngine::CNNNetwork network, const LayerWork &work,
+             const std::map<std::string, InferenceEngine::Blob::Ptr> &inputs = {});
+
+    /**
+     * @brief Loads the CPU extensions library, the test is skipped when it is not available
+     */
+    bool addCpuExtensions();
+
+    static void fillRandom(const InferenceEngine::Blob::Ptr &blob);
+
+    std::string device;
+    InferenceEngine::InferencePlugin plugin;
+
+private:
+    static double envValue(const std::string &name, double defaultValue);
+};
+
+/**
+ * @brief The shape of a convolution case
+ */
+struct conv_bench_params {
+    std::vector<size_t> in;  // NCHW
+    size_t out_c;
+    size_t kernel;
+    size_t stride;
+    size_t pad;
+    size_t group;
+
+    size_t outH() const { return (in[2] + 2 * pad - kernel) / stride + 1; }
+    size_t outW() const { return (in[3] + 2 * pad - kernel) / stride + 1; }
+};
+
+void PrintTo(const conv_bench_params &p, std::ostream *os);
+
+/**
+ * @brief The devices the benchmarks are instantiated for, the unavailable ones are skipped at runtime
+ */
+#define BENCHMARK_DEVICES ::testing::Values(std::string("CPU"), std::string("GPU"))
@@ -925,6 +925,28 @@ TEST_F(NetworkBuilderTest, RemoveLayerAndBuild) {
     ASSERT_THROW(builder.build(), InferenceEngine::details::InferenceEngineException);
 }
 
+TEST_F(NetworkBuilderTest, ReuseIdsAndConnectionsAfterRemove) {
+    Builder::Network netBuilder("chain");
+    idx_t prevId = netBuilder.addLayer(Builder::InputLayer("data").setPort(Port({1, 3, 8, 8})));
+    for (size_t i = 0; i < 4; i++) {
+        idx_t reluId = netBuilder.addLayer({{prevId}}, Builder::ReLULayer("relu"));
+        ASSERT_EQ(i + 1, reluId);
+        ASSERT_EQ(i == 0 ? 1 : 2, netBuilder.getLayerConnections(prevId).size());
+        prevId = reluId;
+    }
+
+    // the removed id is the first free one again, the next one follows the last layer
+    for (const auto& connection : netBuilder.getLayerConnections(2))
+        netBuilder.disconnect(connection);
+    netBuilder.removeLayer(2);
+    ASSERT_EQ(1, netBuilder.getLayerConnections(1).size());
+    ASSERT_EQ(1, netBuilder.getLayerConnections(3).size());
+    ASSERT_EQ(2, netBuilder.addLayer(Builder::ReLULayer("relu")));
+    ASSERT_EQ(5, netBuilder.addLayer(Builder::ReLULayer("relu")));
+    ASSERT_EQ("relu_id5", netBuilder.getLayer(5)->getName());
+    ASSERT_THROW(netBuilder.getLayer(6), InferenceEngine::details::InferenceEngineException);
+}
+
 TEST_F(NetworkBuilderTest, CheckConnectionsData) {
     auto builder = prepateAlexnetBuilder();
 
@@ -3,12 +3,18 @@
 //
 
 #include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 #include <inference_engine/parsers.h>
 #include <inference_engine/ie_cnn_net_reader_impl.h>
 #include <test_model_path.hpp>
 #include <mock_icnn_network.hpp>
 #include <gmock/gmock-more-actions.h>
 #include "cnn_network_impl.hpp"
+#include "network_serializer.h"
+#include "compact_ir.hpp"
 #include "mock_iformat_parser.hpp"
 #include <test_assertions.hpp>
 #include <single_layer_common.hpp>
@@ -2138,3 +2144,349 @@ TEST_F(CNNNetReaderImplTest, canParseScalar) {
     ASSERT_EQ(scalarDesc.getLayout(), SCALAR);
     ASSERT_EQ(scalarDesc.getPrecision(), Precision::FP32);
 }
+
+class CNNNetReaderImplCompactIRTest : public CNNNetReaderImplTest {
+public:
+    void SetUp() override {
+        std::string model = R"V0G0N(
+<net batch="1" name="ConvNet" version="3">
+    <layers>
+        <layer id="0" name="input" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="conv" precision="FP32" type="Convolution">
+            <data dilations="1,1" group="1" kernel="3,3" output="4" pads_begin="1,1" pads_end="1,1" strides="1,1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <blobs>
+                <weights offset="0" size="432"/>
+                <biases offset="432" size="16"/>
+            </blobs>
+        </layer>
+        <layer id="2" name="relu" precision="FP32" type="ReLU">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+    )V0G0N";
+
+        CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+        sts = reader.ReadNetwork(model.data(), model.length(), &resp);
+        ASSERT_EQ(OK, sts) << resp.msg;
+
+        weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {448}, Layout::C));
+        weights->allocate();
+        auto data = weights->buffer().as<float*>();
+        for (size_t i = 0; i < weights->size() / sizeof(float); i++)
+            data[i] = static_cast<float>(i);
+        sts = reader.SetWeights(weights, &resp);
+        ASSERT_EQ(OK, sts) << resp.msg;
+
+        std::ostringstream stream;
+        NetworkSerializer::serializeCompact(stream, *reader.getNetwork(&resp));
+        compact = stream.str();
+    }
+
+    void checkNetwork(ICNNNetwork* network) {
+        ASSERT_NE(nullptr, network);
+        ASSERT_EQ("ConvNet", network->getName());
+
+        CNNLayerPtr layer;
+        sts = network->getLayerByName("conv", layer, &resp);
+        ASSERT_EQ(OK, sts) << resp.msg;
+        auto* conv = dynamic_cast<ConvolutionLayer*>(layer.get());
+        ASSERT_NE(nullptr, conv);
+        ASSERT_EQ(4, conv->_out_depth);
+        ASSERT_EQ(3, conv->_kernel[X_AXIS]);
+        ASSERT_EQ(1, conv->_padding[Y_AXIS]);
+        ASSERT_EQ(vector<size_t>({1, 4, 8, 8}), conv->outData[0]->getTensorDesc().getDims());
+
+        ASSERT_NE(nullptr, conv->_weights);
+        ASSERT_NE(nullptr, conv->_biases);
+        ASSERT_EQ(108, conv->_weights->size());
+        ASSERT_EQ(4, conv->_biases->size());
+        auto expected = weights->buffer().as<float*>();
+        for (size_t i = 0; i < conv->_weights->size(); i++)
+            ASSERT_EQ(expected[i], conv->_weights->cbuffer().as<const float*>()[i]);
+        for (size_t i = 0; i < conv->_biases->size(); i++)
+            ASSERT_EQ(expected[108 + i], conv->_biases->cbuffer().as<const float*>()[i]);
+
+        sts = network->getLayerByName("relu", layer, &resp);
+        ASSERT_EQ(OK, sts) << resp.msg;
+        ASSERT_NE(nullptr, dynamic_cast<ReLULayer*>(layer.get()));
+
+        InputsDataMap inputs;
+        network->getInputsInfo(inputs);
+        ASSERT_EQ(1, inputs.size());
+        ASSERT_EQ("input", inputs.begin()->first);
+        OutputsDataMap outputs;
+        network->getOutputsInfo(outputs);
+        ASSERT_EQ(1, outputs.size());
+        ASSERT_EQ("relu", outputs.begin()->first);
+    }
+
+    TBlob<uint8_t>::Ptr weights;
+    std::string compact;
+};
+
+TEST_F(CNNNetReaderImplCompactIRTest, canReadCompactIRFromMemory) {
+    ASSERT_TRUE(CompactIR::isCompactIR(compact.data(), compact.size()));
+
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    sts = reader.ReadNetwork(compact.data(), compact.size(), &resp);
+    ASSERT_EQ(OK, sts) << resp.msg;
+    checkNetwork(reader.getNetwork(&resp));
+}
+
+TEST_F(CNNNetReaderImplCompactIRTest, canReadCompactIRFromFile) {
+    const std::string fileName = "compact_ir_test.cir";
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(compact.data(), compact.size());
+    }
+
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    sts = reader.ReadNetwork(fileName.c_str(), &resp);
+    std::remove(fileName.c_str());
+    ASSERT_EQ(OK, sts) << resp.msg;
+    checkNetwork(reader.getNetwork(&resp));
+}
+
+TEST_F(CNNNetReaderImplCompactIRTest, weightsOfCompactIRAreAligned) {
+    CompactIRHeader header;
+    std::memcpy(&header, compact.data(), sizeof(header));
+    ASSERT_EQ(0, header.weightsOffset % CompactIR::sectionAlignment);
+    ASSERT_EQ(compact.size(), header.weightsOffset + header.weightsSize);
+
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    sts = reader.ReadNetwork(compact.data(), compact.size(), &resp);
+    ASSERT_EQ(OK, sts) << resp.msg;
+    CNNLayerPtr layer;
+    sts = reader.getNetwork(&resp)->getLayerByName("conv", layer, &resp);
+    ASSERT_EQ(OK, sts) << resp.msg;
+    auto distance = layer->blobs["biases"]->cbuffer().as<const char*>() - layer->blobs["weights"]->cbuffer().as<const char*>();
+    ASSERT_EQ(0, distance % CompactIR::blobAlignment);
+}
+
+TEST_F(CNNNetReaderImplCompactIRTest, cannotSetWeightsToCompactIR) {
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    sts = reader.ReadNetwork(compact.data(), compact.size(), &resp);
+    ASSERT_EQ(OK, sts) << resp.msg;
+    ASSERT_NE(OK, reader.SetWeights(weights, &resp));
+}
+
+TEST_F(CNNNetReaderImplCompactIRTest, cannotReadTruncatedCompactIR) {
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    sts = reader.ReadNetwork(compact.data(), sizeof(CompactIRHeader) + 16, &resp);
+    ASSERT_NE(OK, sts);
+    ASSERT_EQ(nullptr, reader.getNetwork(&resp));
+}
+
+TEST_F(CNNNetReaderImplCompactIRTest, sharedBlobsAreSerializedOnce) {
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    sts = reader.ReadNetwork(compact.data(), compact.size(), &resp);
+    ASSERT_EQ(OK, sts) << resp.msg;
+    auto network = reader.getNetwork(&resp);
+    CNNLayerPtr conv, relu;
+    ASSERT_EQ(OK, network->getLayerByName("conv", conv, &resp)) << resp.msg;
+    ASSERT_EQ(OK, network->getLayerByName("relu", relu, &resp)) << resp.msg;
+    relu->blobs["custom"] = conv->blobs["weights"];
+
+    std::ostringstream xml, bin;
+    NetworkSerializer::serialize(xml, &bin, *network);
+
+    ASSERT_EQ(weights->byteSize(), bin.str().size());
+    const std::string sharedBlob = "offset=\"0\" size=\"" + std::to_string(conv->blobs["weights"]->byteSize()) + "\"";
+    auto first = xml.str().find(sharedBlob);
+    ASSERT_NE(std::string::npos, first);
+    ASSERT_NE(std::string::npos, xml.str().find(sharedBlob, first + 1));
+}
+
+TEST_F(CNNNetReaderImplTest, canReadNetworkFromFileByElements) {
+    std::string model = R"V0G0N(<?xml version="1.0" ?>
+<net batch="1" name="StreamedNet" version="3">
+    <layers>
+        <layer id="0" name="input" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <!-- the layers are parsed as they are read -->
+        <layer id="1" name="pool" precision="FP32" type="Pooling">
+            <data kernel="2,2" pads_begin="0,0" pads_end="0,0" pool-method="max" strides="2,2"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+    <pre-process reference-layer-name="input">
+        <channel id="0"><mean value="1"/></channel>
+        <channel id="1"><mean value="2"/></channel>
+        <channel id="2"><mean value="3"/></channel>
+    </pre-process>
+    <statistics>
+        <layer>
+            <name>pool</name>
+            <min>0.5</min>
+            <max>1.5</max>
+        </layer>
+    </statistics>
+</net>
+)V0G0N";
+    const std::string fileName = "streamed_net_test.xml";
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        file << model;
+    }
+
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    sts = reader.ReadNetwork(fileName.c_str(), &resp);
+    std::remove(fileName.c_str());
+    ASSERT_EQ(OK, sts) << resp.msg;
+    auto network = reader.getNetwork(&resp);
+    ASSERT_NE(nullptr, network);
+    ASSERT_EQ("StreamedNet", network->getName());
+
+    CNNLayerPtr layer;
+    sts = network->getLayerByName("pool", layer, &resp);
+    ASSERT_EQ(OK, sts) << resp.msg;
+    auto* pool = dynamic_cast<PoolingLayer*>(layer.get());
+    ASSERT_NE(nullptr, pool);
+    ASSERT_EQ(2, pool->_kernel[X_AXIS]);
+    ASSERT_EQ("input", layer->insData[0].lock()->getName());
+
+    auto input = network->getInput("input");
+    ASSERT_NE(nullptr, input);
+    const PreProcessInfo& pp = input->getPreProcess();
+    ASSERT_EQ(3, pp.getNumberOfChannels());
+    ASSERT_EQ(MEAN_VALUE, pp.getMeanVariant());
+    ASSERT_EQ(3.0f, pp[2]->meanValue);
+
+    ICNNNetworkStats* stats = nullptr;
+    ASSERT_EQ(OK, network->getStats(&stats, nullptr));
+    ASSERT_EQ(1, stats->getNodesStats().count("pool"));
+}
+
+TEST_F(CNNNetReaderImplTest, reportsErrorOfLayerReadFromFile) {
+    std::string model =
+            "<net name=\"Broken\" version=\"3\"><layers>"
+            "<layer id=\"0\" name=\"input\" type=\"Input\"><output><port id=\"0\"><dim>1</dim></output></layer>"
+            "</layers></net>";
+    const std::string fileName = "broken_net_test.xml";
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        file << model;
+    }
+
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    sts = reader.ReadNetwork(fileName.c_str(), &resp);
+    std::remove(fileName.c_str());
+    ASSERT_NE(OK, sts);
+    ASSERT_NE(std::string::npos, std::string(resp.msg).find("at offset"));
+}
+
+TEST_F(CNNNetReaderImplTest, canReadLongChainOfLayers) {
+    // more layers than a batch of the layers created in parallel
+    const int layersCount = 600;
+    auto port = [](int id) {
+        return "<port id=\"" + std::to_string(id) + "\"><dim>1</dim><dim>8</dim></port>";
+    };
+    std::string model = "<net name=\"Chain\" version=\"3\"><layers>"
+            "<layer id=\"0\" name=\"input\" precision=\"FP32\" type=\"Input\"><output>" + port(0) + "</output></layer>";
+    for (int i = 1; i < layersCount; i++) {
+        model += "<layer id=\"" + std::to_string(i) + "\" name=\"relu" + std::to_string(i) +
+                 "\" precision=\"FP32\" type=\"ReLU\"><input>" + port(0) + "</input><output>" + port(1) + "</output></layer>";
+    }
+    model += "</layers><edges>";
+    for (int i = 1; i < layersCount; i++) {
+        model += "<edge from-layer=\"" + std::to_string(i - 1) + "\" from-port=\"" + (i == 1 ? "0" : "1") +
+                 "\" to-layer=\"" + std::to_string(i) + "\" to-port=\"0\"/>";
+    }
+    model += "</edges></net>";
+
+    const std::string fileName = "chain_net_test.xml";
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        file << model;
+    }
+    CNNNetReaderImpl fileReader(make_shared<V2FormatParserCreator>());
+    sts = fileReader.ReadNetwork(fileName.c_str(), &resp);
+    std::remove(fileName.c_str());
+    ASSERT_EQ(OK, sts) << resp.msg;
+
+    CNNNetReaderImpl memoryReader(make_shared<V2FormatParserCreator>());
+    sts = memoryReader.ReadNetwork(model.data(), model.size(), &resp);
+    ASSERT_EQ(OK, sts) << resp.msg;
+
+    for (auto network : {fileReader.getNetwork(&resp), memoryReader.getNetwork(&resp)}) {
+        ASSERT_EQ(layersCount, network->layerCount());
+        for (int i = 2; i < layersCount; i++) {
+            CNNLayerPtr layer;
+            sts = network->getLayerByName(("relu" + std::to_string(i)).c_str(), layer, &resp);
+            ASSERT_EQ(OK, sts) << resp.msg;
+            ASSERT_NE(nullptr, dynamic_cast<ReLULayer*>(layer.get()));
+            ASSERT_EQ("relu" + std::to_string(i - 1), layer->insData[0].lock()->getName());
+        }
+    }
+}
@@ -0,0 +1,213 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cldnn/cldnn_config.hpp>
+#include <cldnn_engine.h>
+#include <cldnn_graph.h>
+#include <cldnn_model_serial.h>
+
+#include "tests_common.hpp"
+
+using namespace InferenceEngine;
+using namespace CLDNNPlugin;
+
+class CLDNNGraphTests : public TestsCommon {
+protected:
+    std::string model = R"V0G0N(
+<net name="conv_softmax" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="4" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <weights offset="0" size="432"/>
+            <biases offset="432" size="16"/>
+        </layer>
+        <layer name="softmax" type="SoftMax" precision="FP32" id="2">
+            <data axis="1"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</net>
+)V0G0N";
+
+    CNNNetwork readNetwork() {
+        CNNNetReader reader;
+        reader.ReadNetwork(model.data(), model.length());
+        TBlob<uint8_t>::Ptr weights = make_shared_blob<uint8_t>(Precision::U8, C, {448});
+        weights->allocate();
+        fill_data(reinterpret_cast<float *>(weights->buffer().as<uint8_t *>()), weights->size() / sizeof(float));
+        reader.SetWeights(weights);
+        return reader.getNetwork();
+    }
+
+    static bool hasGpu() {
+        return cldnn::engine::engine_count(cldnn::engine_types::ocl) > 0;
+    }
+
+    static ExecutableNetwork loadNetwork(clDNNEngine &engine, CNNNetwork &network,
+                                         const std::map<std::string, std::string> &config) {
+        IExecutableNetwork::Ptr executableNetwork;
+        engine.LoadNetwork(executableNetwork, network, config);
+        return ExecutableNetwork(executableNetwork);
+    }
+
+    Blob::Ptr infer(ExecutableNetwork &executableNetwork, const Blob::Ptr &input) {
+        auto request = executableNetwork.CreateInferRequest();
+        request.SetBlob("data", input);
+        request.Infer();
+        return request.GetBlob("softmax");
+    }
+
+    Blob::Ptr createInput() {
+        Blob::Ptr input = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 3, 8, 8}, NCHW));
+        input->allocate();
+        fill_data(input);
+        return input;
+    }
+};
+
+TEST_F(CLDNNGraphTests, canParseFp16AutoConfig) {
+    CLDNNGraph::Config config;
+    ASSERT_FALSE(config.fp16Auto);
+    ASSERT_NE(config.fp32Layers.end(), config.fp32Layers.find("softmax"));
+
+    config.LoadFromMap({{CLDNNConfigParams::KEY_CLDNN_FP16_AUTO, PluginConfigParams::YES},
+                        {CLDNNConfigParams::KEY_CLDNN_FP32_LAYERS, "Convolution,,Pooling"}});
+    ASSERT_TRUE(config.fp16Auto);
+    ASSERT_EQ(2, config.fp32Layers.size());
+    ASSERT_NE(config.fp32Layers.end(), config.fp32Layers.find("convolution"));
+    ASSERT_NE(config.fp32Layers.end(), config.fp32Layers.find("Pooling"));
+
+    ASSERT_THROW(config.LoadFromMap({{CLDNNConfigParams::KEY_CLDNN_FP16_AUTO, "ON"}}),
+                 details::InferenceEngineException);
+}
+
+TEST_F(CLDNNGraphTests, exportedNetworkKeepsFp16AutoConfig) {
+    CNNNetwork network = readNetwork();
+    CLDNNGraph::Config config;
+    config.LoadFromMap({{CLDNNConfigParams::KEY_CLDNN_FP16_AUTO, PluginConfigParams::YES},
+                        {CLDNNConfigParams::KEY_CLDNN_FP32_LAYERS, "SoftMax"}});
+
+    std::stringstream stream;
+    CLDNNModelSerial::Export(stream, network, config, {}, network.getInputsInfo(), network.getOutputsInfo());
+    CNNNetReader reader;
+    std::map<std::string, std::string> importedConfig;
+    CLDNNGraph::ProgramBinaries binaries;
+    CLDNNModelSerial::Import(stream, reader, importedConfig, binaries);
+
+    ASSERT_EQ(PluginConfigParams::YES, importedConfig[CLDNNConfigParams::KEY_CLDNN_FP16_AUTO]);
+    ASSERT_EQ("SoftMax", importedConfig[CLDNNConfigParams::KEY_CLDNN_FP32_LAYERS]);
+}
+
+TEST_F(CLDNNGraphTests, fp16AutoNetworkGivesCloseFp32Outputs) {
+    if (!hasGpu())
+        SKIP();
+    CNNNetwork network = readNetwork();
+    clDNNEngine engine;
+    auto input = createInput();
+
+    auto fp32Network = loadNetwork(engine, network, {});
+    auto fp16Network = loadNetwork(engine, network, {{CLDNNConfigParams::KEY_CLDNN_FP16_AUTO, PluginConfigParams::YES},
+                                                     {PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}});
+    auto ref = infer(fp32Network, input);
+    auto request = fp16Network.CreateInferRequest();
+    request.SetBlob("data", input);
+    request.Infer();
+    auto output = request.GetBlob("softmax");
+
+    // the output keeps the precision of the network, the SoftMax stays in FP32 after the reorder of the FP16 conv
+    ASSERT_EQ(Precision::FP32, output->getTensorDesc().getPrecision());
+    compare(*output, *ref, 1e-2f);
+    auto perfCounts = request.GetPerformanceCounts();
+    bool hasPrecisionReorder = false;
+    for (auto &&counter : perfCounts)
+        hasPrecisionReorder |= counter.first.find("_cldnn_precision") != std::string::npos;
+    ASSERT_TRUE(hasPrecisionReorder);
+}
+
+TEST_F(CLDNNGraphTests, canParseDeviceIds) {
+    CLDNNGraph::Config config;
+    ASSERT_EQ(std::vector<uint16_t>{0}, config.deviceIds);
+
+    config.LoadFromMap({{PluginConfigParams::KEY_DEVICE_ID, "0,1"}});
+    ASSERT_EQ((std::vector<uint16_t>{0, 1}), config.deviceIds);
+    config.LoadFromMap({{PluginConfigParams::KEY_DEVICE_ID, CLDNNConfigParams::CLDNN_ALL_DEVICES}});
+    ASSERT_TRUE(config.deviceIds.empty());
+
+    for (auto &&ids : {"", "1,x", "0,,1", "0;1"}) {
+        ASSERT_THROW(config.LoadFromMap({{PluginConfigParams::KEY_DEVICE_ID, ids}}), details::InferenceEngineException)
+            << ids;
+    }
+}
+
+TEST_F(CLDNNGraphTests, requestsOfNetworkOnAllDevicesGiveSameOutputs) {
+    if (!hasGpu())
+        SKIP();
+    CNNNetwork network = readNetwork();
+    clDNNEngine engine;
+    auto input = createInput();
+
+    auto singleDeviceNetwork = loadNetwork(engine, network, {});
+    auto ref = infer(singleDeviceNetwork, input);
+
+    // the requests are bound to the streams of all the devices round-robin, so every stream gets two of them
+    const size_t streams = 2;
+    auto allDevicesNetwork = loadNetwork(engine, network,
+                                         {{PluginConfigParams::KEY_DEVICE_ID, CLDNNConfigParams::CLDNN_ALL_DEVICES},
+                                          {CLDNNConfigParams::KEY_CLDNN_THROUGHPUT_STREAMS, std::to_string(streams)}});
+    const size_t requests = 2 * streams * cldnn::engine::engine_count(cldnn::engine_types::ocl);
+    for (size_t i = 0; i < requests; i++) {
+        compare(*infer(allDevicesNetwork, input), *ref);
+    }
+}
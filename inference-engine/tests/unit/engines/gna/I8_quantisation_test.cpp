@@ -127,3 +127,58 @@ TEST_F(I8QuantisationTest, outputAffinePrecisionIs32Bits){
 
     ASSERT_EQ(affineDataPtr->precision, Precision::I32);
 }
+
+TEST_F(I8QuantisationTest, calibratedOutputRangeReducesAffineWeightsScale){
+
+    ModelQuantizer<QuantI8> q;
+
+    CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(Fc2DOutputModel().data(), Fc2DOutputModel().length()));
+
+    auto weights = make_shared_blob<uint8_t >(Precision::U8, C, {440});
+    weights->allocate();
+    fillWeights(weights);
+    net_reader.SetWeights(weights);
+
+    const float outputRange = 1000000.f;
+    auto fcStats = std::make_shared<NetworkNodeStats>(1);
+    fcStats->_minOutputs[0] = -outputRange;
+    fcStats->_maxOutputs[0] = outputRange / 2;
+
+    ICNNNetworkStats* pstats = nullptr;
+    auto & network = static_cast<ICNNNetwork&>(net_reader.getNetwork());
+    ASSERT_EQ(StatusCode::OK, network.getStats(&pstats, nullptr));
+    pstats->setNodesStats({{"FullyConnected", fcStats}});
+
+    auto newNet = q.quantize(network, 1000);
+    CNNLayerPtr fc;
+    ASSERT_EQ(StatusCode::OK, newNet->getLayerByName("FullyConnected", fc, nullptr));
+    auto quant = getInjectedData<QuantizedLayerParams>(fc);
+
+    ASSERT_FLOAT_EQ(quant->_dst_range, outputRange);
+    ASSERT_LE(static_cast<double>(quant->_dst_quant.scale) * outputRange, std::numeric_limits<int32_t>::max());
+    ASSERT_FLOAT_EQ(quant->_dst_quant.scale, quant->_weights_quant.scale * quant->_src_quant.scale);
+}
+
+TEST_F(I8QuantisationTest, calibratedOutputRangeDefinesActivationScale){
+
+    ModelQuantizer<QuantI8> q;
+
+    CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(SigmoidActivationModel().data(), SigmoidActivationModel().length()));
+
+    auto activationStats = std::make_shared<NetworkNodeStats>(1);
+    activationStats->_minOutputs[0] = 0.f;
+    activationStats->_maxOutputs[0] = 1.f;
+
+    ICNNNetworkStats* pstats = nullptr;
+    auto & network = static_cast<ICNNNetwork&>(net_reader.getNetwork());
+    ASSERT_EQ(StatusCode::OK, network.getStats(&pstats, nullptr));
+    pstats->setNodesStats({{"Sig_Activation", activationStats}});
+
+    auto newNet = q.quantize(network, 1000);
+    CNNLayerPtr activation;
+    ASSERT_EQ(StatusCode::OK, newNet->getLayerByName("Sig_Activation", activation, nullptr));
+
+    ASSERT_FLOAT_EQ(getInjectedData<QuantizedLayerParams>(activation)->_dst_quant.scale, MAX_VAL_2B_FEAT);
+}
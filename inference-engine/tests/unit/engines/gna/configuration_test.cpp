@@ -151,4 +151,14 @@ TEST_F(GNAConfigTest, failToCreatePluginWithDifferentInputScaleFactors) {
     assert_that().creating().gna_plugin()
         .withGNAConfig(std::string(GNA_CONFIG_KEY(SCALE_FACTOR))+"_1", 1000)
         .withGNAConfig(std::string(GNA_CONFIG_KEY(SCALE_FACTOR))+"_2", 2000).throws();
-}
\ No newline at end of file
+}
+
+TEST_F(GNAConfigTest, failToCreatePluginWithZeroPwlMaxErrorPercent) {
+    assert_that().creating().gna_plugin()
+        .withGNAConfig(GNA_CONFIG_KEY(PWL_MAX_ERROR_PERCENT), 0).throws();
+}
+
+TEST_F(GNAConfigTest, failToCreatePluginWithIncorrectMultiStreamMode) {
+    assert_that().creating().gna_plugin()
+        .withGNAConfig(GNA_CONFIG_KEY(MULTI_STREAM), "ON").throws();
+}
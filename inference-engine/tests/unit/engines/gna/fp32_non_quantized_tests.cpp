@@ -205,4 +205,19 @@ TEST_F(FP32NonQuantizedTest, ScaleShiftWithBroadcastSupported) {
     assert_that().onInferModel(ScaleShift3DModel()).withWeigthsPattern({1.0f,2.0f,3.0f,4.0f,5.0f,6.0f,7.0f,8.0f})
         .inNotCompactMode().gna().propagate_forward().onCPU()
         .called_with_input_and_expected_output(input_data, expected_result);
-}
\ No newline at end of file
+}
+
+TEST_F(FP32NonQuantizedTest, SoftMaxAtOutputComputedOnHost) {
+    std::vector<float> input_data (10, 1.0);
+    std::vector<float> expected_result (10, 0.1f);
+
+    assert_that().onInferModel(FCWithSoftMaxOutputModel()).withWeigthsPattern({1.0f})
+        .inNotCompactMode().gna().propagate_forward().onCPU()
+        .called_with_input_and_expected_output(input_data, expected_result);
+}
+
+TEST_F(FP32NonQuantizedTest, SoftMaxNotAtOutputNotSupported) {
+    assert_that().onInferModel(SoftMaxBeforeFCModel())
+        .inNotCompactMode().gna().propagate_forward().onCPU().called()
+        .throws();
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <gtest/gtest.h>
+#include "gna_plugin.hpp"
+
+using namespace testing;
+
+class GNA_Convert_test : public ::testing::Test {};
+
+static int16_t referenceQuantize(float value) {
+    value += (value > 0) ? 0.5f : -0.5f;
+    if (value > 32767.0f) {
+        return 32767;
+    } else if (value < -32768.0f) {
+        return -32768;
+    }
+    return static_cast<int16_t>(value);
+}
+
+TEST_F(GNA_Convert_test, ConvertToInt16RoundsHalfAwayFromZeroAndSaturates) {
+    // odd size covers both the vectored part and the tail
+    std::vector<float> src(37);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = (static_cast<float>(i) - 18.0f) * 0.25f;
+    }
+    src[0] = 1e6f;
+    src[1] = -1e6f;
+    const float scale = 2000.0f;
+
+    std::vector<int16_t> dst(src.size());
+    GNAPluginNS::ConvertToInt16(dst.data(), src.data(), 1, static_cast<uint32_t>(src.size()), scale);
+
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(referenceQuantize(src[i] * scale), dst[i]) << "at " << i;
+    }
+    ASSERT_EQ(32767, dst[0]);
+    ASSERT_EQ(-32768, dst[1]);
+}
+
+TEST_F(GNA_Convert_test, ConvertToFloatDividesByScaleFactorInPlace) {
+    std::vector<int32_t> src(29);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<int32_t>(i * 1001) - 14000;
+    }
+    std::vector<int32_t> buffer = src;
+    const float scale = 7.5f;
+
+    GNAPluginNS::ConvertToFloat(reinterpret_cast<float *>(buffer.data()), buffer.data(), 1,
+                                static_cast<uint32_t>(buffer.size()), scale);
+
+    auto result = reinterpret_cast<float *>(buffer.data());
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(static_cast<float>(src[i]) / scale, result[i]) << "at " << i;
+    }
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "gna_device.hpp"
+#include "gna_mock_api.hpp"
+
+using namespace testing;
+using namespace InferenceEngine;
+
+class GNADeviceTest : public ::testing::Test {
+};
+
+TEST_F(GNADeviceTest, latencyHistogramCountsCompletedRequests) {
+    GNACppApi mockApi;
+    EXPECT_CALL(mockApi, GNADeviceOpenSetThreads(_, _)).WillOnce(Return(1));
+    EXPECT_CALL(mockApi, GNAPropagateForward(_, _, _, _, _, _)).Times(2)
+        .WillOnce(DoAll(SetArgPointee<4>(1), Return(GNA_NOERROR)))
+        .WillOnce(DoAll(SetArgPointee<4>(2), Return(GNA_NOERROR)));
+    EXPECT_CALL(mockApi, GNAWait(_, _, _)).Times(2).WillRepeatedly(Return(GNA_NOERROR));
+    EXPECT_CALL(mockApi, GNADeviceClose(_)).WillOnce(Return(GNA_NOERROR));
+
+    GNADeviceHelper device;
+    intel_nnet_type_t nnet = {};
+    auto first = device.propagate(&nnet, nullptr, 0);
+    auto second = device.propagate(&nnet, nullptr, 0);
+    device.wait(second);
+    device.wait(first);
+
+    std::map<std::string, InferenceEngineProfileInfo> perfMap;
+    device.getLatencyCounters(perfMap);
+
+    ASSERT_EQ(GNADeviceHelper::LATENCY_BUCKETS, perfMap.size());
+    unsigned requests = 0;
+    for (auto && counter : perfMap) {
+        requests += counter.second.execution_index;
+    }
+    ASSERT_EQ(2, requests);
+}
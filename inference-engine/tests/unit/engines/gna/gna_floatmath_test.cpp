@@ -0,0 +1,60 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <gtest/gtest.h>
+#include "floatmath.h"
+
+using namespace testing;
+
+class GNA_FloatMath_test : public ::testing::Test {
+ protected:
+    // wider than one block of columns and with odd sizes to cover the tails
+    const int M = 13, N = 300, K = 37;
+    std::vector<float> A, B, C;
+
+    void SetUp() override {
+        A.resize(M * K);
+        B.resize(K * N);
+        C.resize(M * N);
+        for (size_t i = 0; i < A.size(); i++) A[i] = static_cast<float>(i % 17) * 0.125f - 1.0f;
+        for (size_t i = 0; i < B.size(); i++) B[i] = static_cast<float>(i % 23) * 0.0625f - 0.5f;
+        for (size_t i = 0; i < C.size(); i++) C[i] = static_cast<float>(i % 5);
+    }
+
+    float reference(int i, int j, float c) const {
+        for (int k = 0; k < K; k++) {
+            c += A[i * K + k] * B[k * N + j];
+        }
+        return c;
+    }
+};
+
+TEST_F(GNA_FloatMath_test, sgemmAccumulatesIntoOutputAsReference) {
+    std::vector<float> expected(C.size());
+    for (int i = 0; i < M; i++)
+        for (int j = 0; j < N; j++)
+            expected[i * N + j] = reference(i, j, C[i * N + j]);
+
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, C.data(), N);
+
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_EQ(expected[i], C[i]) << "at " << i;
+    }
+}
+
+TEST_F(GNA_FloatMath_test, sgemmSubsetComputesOnlyListedRows) {
+    std::vector<uint32_t> list = {12, 0, 5};
+    std::vector<float> expected(list.size() * N);
+    for (size_t l = 0; l < list.size(); l++)
+        for (int j = 0; j < N; j++)
+            expected[l * N + j] = reference(list[l], j, C[l * N + j]);
+
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N,
+                       1.0, C.data(), N, list.data(), static_cast<MKL_INT>(list.size()));
+
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i], C[i]) << "at " << i;
+    }
+}
@@ -36,7 +36,9 @@
 #include <inference_engine/layer_transform.hpp>
 #include <gna_plugin/quantization/model_quantizer.hpp>
 #include "gna_plugin/quantization/layer_quantizer.hpp"
+#include "gna_plugin/gna_model_serial.hpp"
 #include "gna_matcher.hpp"
+#include <fstream>
 
 using namespace InferenceEngine;
 using namespace GNAPluginNS;
@@ -72,6 +74,21 @@ TEST_F(GNAAOTTests, AffineWith2AffineOutputs_canbe_export_imported) {
         .inNotCompactMode().gna().propagate_forward().called().once();
 }
 
+TEST_F(GNAAOTTests, ExportedGnaMemoryIsPageAlignedInFile) {
+
+    const std::string X = registerFileForRemove("unit_tests.bin");
+
+    export_network(AffineWith2AffineOutputsModel())
+        .inNotCompactMode().as().gna().model().to(X);
+
+    std::ifstream file(X, std::ios_base::binary | std::ios_base::ate);
+    const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(0);
+    auto header = GNAModelSerial::ReadHeader(file);
+
+    ASSERT_GE(fileSize, header.gnaMemSize);
+    ASSERT_EQ(0, (fileSize - header.gnaMemSize) % 4096);
+}
 
 TEST_F(GNAAOTTests, AffineWith2AffineOutputs_canbe_imported_verify_structure) {
 
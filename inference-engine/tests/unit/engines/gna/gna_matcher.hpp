@@ -466,6 +466,9 @@ class GNAQueryStateMatcher : public GNADumpXNNMatcher {
     void isNotEmpty() {
         _env.numberOfStates = GnaPluginTestEnvironment::kAnyNotNull;
     }
+    void hasSize(int numberOfStates) {
+        _env.numberOfStates = numberOfStates;
+    }
 
  protected:
     void match();
@@ -449,4 +449,45 @@ TEST_F(GNAMemoryTest, canUpdateSizeOfPushRequestWithBindRequestWhenAlloc) {
     ASSERT_FLOAT_EQ(pFutureInput[0], 1);
     ASSERT_FLOAT_EQ(pFutureInput[1], 2);
     ASSERT_FLOAT_EQ(pFutureInput[2], 3);
-}
\ No newline at end of file
+}
+
+TEST_F(GNAMemoryTest, canReuseIntermediateBuffersNotAliveAtSameTime) {
+    void *pFirst = nullptr, *pSecond = nullptr, *pThird = nullptr;
+    void *pFirstIn = nullptr, *pSecondIn = nullptr, *pThirdIn = nullptr;
+
+    mem.set_execution_order(0);
+    mem.reserve_intermediate_ptr(&pFirst, 64);
+    mem.set_execution_order(1);
+    mem.bind_ptr(&pFirstIn, &pFirst);
+    mem.reserve_intermediate_ptr(&pSecond, 64);
+    mem.set_execution_order(2);
+    mem.bind_ptr(&pSecondIn, &pSecond);
+    mem.reserve_intermediate_ptr(&pThird, 64);
+    mem.set_execution_order(3);
+    mem.bind_ptr(&pThirdIn, &pThird);
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 128);
+    ASSERT_NE(pFirst, pSecond);
+    ASSERT_NE(pSecond, pThird);
+    ASSERT_EQ(pFirst, pThird);
+    ASSERT_EQ(pFirstIn, pFirst);
+    ASSERT_EQ(pSecondIn, pSecond);
+    ASSERT_EQ(pThirdIn, pThird);
+}
+
+TEST_F(GNAMemoryTest, canPlaceIntermediateBuffersAfterOtherReadWriteData) {
+    float *pValue = nullptr;
+    void *pFirst = nullptr, *pSecond = nullptr;
+
+    mem.push_value(&pValue, 3.f, 4);
+    mem.reserve_intermediate_ptr(&pFirst, 16);
+    mem.reserve_intermediate_ptr(&pSecond, 16);
+    mem.commit();
+
+    // both buffers are used by the same layer
+    ASSERT_EQ(mem.getRWBytes(), 64 + 128);
+    ASSERT_EQ(static_cast<void *>(reinterpret_cast<uint8_t *>(pValue) + 64), std::min(pFirst, pSecond));
+    ASSERT_NE(pFirst, pSecond);
+    ASSERT_FLOAT_EQ(pValue[3], 3.f);
+}
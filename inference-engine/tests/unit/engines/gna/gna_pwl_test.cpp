@@ -241,3 +241,13 @@ TEST_F(PWLAproximationTest, forClampOnUniformAlgoWithSegmentThresholdIsSuccess)
                                 .pwl_quantization_activation(DnnActivationType::kActKaldiLstmClipping)
                                 .pwl_quantization_segments_threshold(3);
 }
+
+TEST_F(PWLAproximationTest, forSigmoidOnRecursiveAlgoWithBiggerErrorBudgetGivesLessSegments) {
+    assert_that().onInferModel(SigmoidActivationModel())
+                                .inNotCompactMode()
+                                .withConfig(PWL_MAX_ERROR_PERCENT, 5)
+                                .propagate_forward()
+                                .called_with()
+                                .pwl_quantization_activation(DnnActivationType::kActSigmoid)
+                                .pwl_quantization_segments_threshold(8);
+}
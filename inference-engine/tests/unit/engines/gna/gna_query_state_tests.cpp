@@ -52,3 +52,11 @@ TEST_F(QueryStateTest, returnEmptyCollectionOfStatesIfNoMemoryInIR) {
 TEST_F(QueryStateTest, returnNonEmptyCollectionOfStatesForMemoryIR) {
     assert_that().afterLoadingModel(affineToMemoryModel()).queryState().isNotEmpty();
 }
+
+TEST_F(QueryStateTest, returnStatePerStreamInMultiStreamMode) {
+    assert_that().onInferModel(affineToMemoryModel(), [](InferenceEngine::CNNNetwork & net) {
+            net.setBatchSize(2);
+        })
+        .withGNAConfig(GNA_CONFIG_KEY(MULTI_STREAM), CONFIG_VALUE(YES))
+        .queryState().hasSize(2);
+}
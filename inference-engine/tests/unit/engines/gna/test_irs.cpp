@@ -3297,4 +3297,110 @@ std::string ScaleShift3DModel() {
     )V0G0N";
 }
 
+std::string FCWithSoftMaxOutputModel() {
+    return R"V0G0N(
+<Net Name="FullyConnected_SoftMax" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="input_1" type="input" id="0" precision="FP32">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="FullyConnected" id="1" type="InnerProduct" precision="FP32">
+            <fc out-size="10" />
+            <biases offset="0" size="40" />
+            <weights offset="40" size="400" />
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="SoftMax" id="2" type="SoftMax" precision="FP32">
+            <data axis="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0" />
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0" />
+    </edges>
+</Net>
+)V0G0N";
+}
+
+std::string SoftMaxBeforeFCModel() {
+    return R"V0G0N(
+<Net Name="SoftMax_FullyConnected" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="input_1" type="input" id="0" precision="FP32">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="SoftMax" id="1" type="SoftMax" precision="FP32">
+            <data axis="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="FullyConnected" id="2" type="InnerProduct" precision="FP32">
+            <fc out-size="10" />
+            <biases offset="0" size="40" />
+            <weights offset="40" size="400" />
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0" />
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0" />
+    </edges>
+</Net>
+)V0G0N";
+}
+
 }  // namespace GNATestIRs
@@ -74,4 +74,6 @@ std::string two_inputs_to_concat();
 std::string affineAfterConvNoPermute();
 std::string affineAfterConvWithPermute();
 std::string ScaleShift3DModel();
+std::string FCWithSoftMaxOutputModel();
+std::string SoftMaxBeforeFCModel();
 }  // namespace GNATestIRs
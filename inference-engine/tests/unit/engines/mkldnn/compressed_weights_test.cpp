@@ -0,0 +1,78 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <blob_factory.hpp>
+#include <cmath>
+#include <vector>
+#include "mkldnn_compressed_weights.h"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class MKLDNNCompressedWeightsTests : public ::testing::Test {
+protected:
+    static Blob::Ptr weights(size_t rows, size_t cols) {
+        Blob::Ptr blob = make_blob_with_precision(TensorDesc(Precision::FP32, {rows, cols}, Layout::NC));
+        blob->allocate();
+        float *data = blob->buffer().as<float *>();
+        for (size_t i = 0; i < blob->size(); i++)
+            data[i] = 0.01f * static_cast<float>(static_cast<int>(i % 37) - 18) * static_cast<float>(i / cols + 1);
+        return blob;
+    }
+};
+
+TEST_F(MKLDNNCompressedWeightsTests, multiplyRowsIsFullyConnectedWithinQuantizationError) {
+    const size_t rows = 12, cols = 64, batch = 3;
+    Blob::Ptr w = weights(rows, cols);
+    Blob::Ptr bias = make_blob_with_precision(TensorDesc(Precision::FP32, {rows}, Layout::C));
+    bias->allocate();
+    for (size_t r = 0; r < rows; r++)
+        bias->buffer().as<float *>()[r] = 0.5f * static_cast<float>(r);
+
+    auto compressed = MKLDNNPlugin::MKLDNNCompressedWeights::get("fc", w, bias, rows);
+    ASSERT_NE(nullptr, compressed);
+    // the same weights of the same node are shared
+    ASSERT_EQ(compressed, MKLDNNPlugin::MKLDNNCompressedWeights::get("fc", w, bias, rows));
+
+    std::vector<float> src(batch * cols), dst(batch * rows);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 5) - 2.f;
+    compressed->multiplyRows(src.data(), dst.data(), batch);
+
+    const float *wd = w->cbuffer().as<const float *>();
+    const float *bd = bias->cbuffer().as<const float *>();
+    const float maxError = compressed->getMaxError();
+    ASSERT_GT(maxError, 0.f);
+    for (size_t n = 0; n < batch; n++) {
+        for (size_t r = 0; r < rows; r++) {
+            float expected = bd[r], absSrc = 0.f;
+            for (size_t c = 0; c < cols; c++) {
+                expected += wd[r * cols + c] * src[n * cols + c];
+                absSrc += std::fabs(src[n * cols + c]);
+            }
+            ASSERT_NEAR(expected, dst[n * rows + r], maxError * absSrc + 1e-4f);
+        }
+    }
+}
+
+TEST_F(MKLDNNCompressedWeightsTests, zeroRowsGiveBiases) {
+    const size_t rows = 2, cols = 8;
+    Blob::Ptr w = make_blob_with_precision(TensorDesc(Precision::FP32, {rows, cols}, Layout::NC));
+    w->allocate();
+    std::fill_n(w->buffer().as<float *>(), w->size(), 0.f);
+    auto compressed = MKLDNNPlugin::MKLDNNCompressedWeights::get("zeros", w, nullptr, rows);
+    ASSERT_NE(nullptr, compressed);
+
+    std::vector<float> src(cols, 1.f), dst(rows, -1.f);
+    compressed->multiplyRows(src.data(), dst.data(), 1);
+    ASSERT_FLOAT_EQ(0.f, dst[0]);
+    ASSERT_FLOAT_EQ(0.f, dst[1]);
+}
+
+TEST_F(MKLDNNCompressedWeightsTests, notFp32WeightsAreNotCompressed) {
+    Blob::Ptr w = make_blob_with_precision(TensorDesc(Precision::I8, {4, 8}, Layout::NC));
+    w->allocate();
+    ASSERT_EQ(nullptr, MKLDNNPlugin::MKLDNNCompressedWeights::get("i8", w, nullptr, 4));
+}
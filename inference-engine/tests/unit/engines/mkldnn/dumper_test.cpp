@@ -109,3 +109,25 @@ TEST(MKLDNNLayersTests, DumpSimpleGraphToDot) {
     ASSERT_EQ(std::count(dot.begin(), dot.end(), ']'), 10);
     ASSERT_EQ(std::count(dot.begin(), dot.end(), '>'), 6); // connection
 }
+
+TEST(MKLDNNLayersTests, DumpSimpleGraphWithMemoryPlacement) {
+    auto net = NetGen().net();
+    MKLDNNGraph graph;
+    MKLDNNExtensionManager::Ptr extMgr;
+    graph.CreateGraph(net, extMgr);
+
+    auto dump_net = dump_graph_as_ie_net(graph);
+    auto layers = details::CNNNetSortTopologically(*dump_net);
+
+    ASSERT_EQ(layers.size(), 4);
+    auto &conv = layers[1]->params;
+    ASSERT_EQ(conv["executionMode"], "executed");
+    ASSERT_EQ(conv["inPlace"], "false");
+    ASSERT_EQ(conv["outputMemoryRegions"], "workspace");
+    ASSERT_NE(conv["outputMemoryOffsets"], "-");
+    ASSERT_EQ(conv["outputMemorySizes"], std::to_string(2*16*16*16*sizeof(float)));
+
+    // the output node has no output memory of its own
+    auto &output = layers[3]->params;
+    ASSERT_EQ(output.find("outputMemoryRegions"), output.end());
+}
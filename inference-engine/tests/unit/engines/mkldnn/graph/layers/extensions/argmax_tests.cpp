@@ -0,0 +1,202 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+#include "ir_gen_helper.hpp"
+
+#include <algorithm>
+#include <functional>
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+using namespace single_layer_tests;
+
+
+struct argmax_test_params {
+    SizeVector in;
+    SizeVector out;
+
+    int has_axis;
+    int axis;
+    int out_max_val;
+    int top_k;
+};
+
+static void ref_argmax(const TBlob<float> &src, TBlob<float> &dst, argmax_test_params p) {
+    const float *src_data = src.readOnly();
+    float *dst_data = dst.data();
+
+    size_t total = 1;
+    for (auto d : p.in)
+        total *= d;
+
+    int dim, axis_dist;
+    if (p.has_axis) {
+        int axis = p.axis < 0 ? p.axis + static_cast<int>(p.in.size()) : p.axis;
+        dim = static_cast<int>(p.in[axis]);
+        axis_dist = 1;
+        for (size_t i = axis + 1; i < p.in.size(); i++)
+            axis_dist *= static_cast<int>(p.in[i]);
+    } else {
+        dim = static_cast<int>(total / p.in[0]);
+        axis_dist = 1;
+    }
+
+    int num = static_cast<int>(total) / dim;
+    std::vector<std::pair<float, int> > src_vector(dim);
+
+    for (int i = 0; i < num; ++i) {
+        for (int j = 0; j < dim; ++j)
+            src_vector[j] = std::make_pair(src_data[(i / axis_dist * dim + j) * axis_dist + i % axis_dist], j);
+
+        std::partial_sort(src_vector.begin(), src_vector.begin() + p.top_k,
+                          src_vector.end(), std::greater<std::pair<float, int> >());
+
+        for (int j = 0; j < p.top_k; ++j) {
+            if (p.out_max_val) {
+                if (p.has_axis) {
+                    dst_data[(i / axis_dist * p.top_k + j) * axis_dist + i % axis_dist] = src_vector[j].first;
+                } else {
+                    dst_data[2 * i * p.top_k + j] = static_cast<float>(src_vector[j].second);
+                    dst_data[2 * i * p.top_k + p.top_k + j] = src_vector[j].first;
+                }
+            } else {
+                dst_data[(i / axis_dist * p.top_k + j) * axis_dist + i % axis_dist] = static_cast<float>(src_vector[j].second);
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtArgMaxTests: public TestsCommon, public WithParamInterface<argmax_test_params> {
+    std::string layers_t = R"V0G0N(
+        <layer name="argmax" id="1" type="ArgMax" precision="FP32">
+            <data _AXIS_ out_max_val="_OMV_" top_k="_TOPK_"/>
+            <input>
+                <port id="1">__SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="2">__DST_DIMS__
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+)V0G0N";
+
+    std::string getModel(argmax_test_params p) {
+        std::string model = layers_t;
+
+        std::string s_dims;
+        for (auto& dim : p.in) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "__SRC_DIMS__", s_dims);
+
+        s_dims = "";
+        for (auto& dim : p.out) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "__DST_DIMS__", s_dims);
+
+        if (p.has_axis)
+            REPLACE_WITH_STR(model, "_AXIS_", "axis=\"" + std::to_string(p.axis) + "\"");
+        else
+            REPLACE_WITH_STR(model, "_AXIS_", "");
+        REPLACE_WITH_NUM(model, "_OMV_", p.out_max_val);
+        REPLACE_WITH_NUM(model, "_TOPK_", p.top_k);
+
+        model = IRTemplateGenerator::getIRTemplate("ArgMax_Only", p.in, "FP32", model, edges_t);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            argmax_test_params p = ::testing::WithParamInterface<argmax_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            Blob::Ptr src = make_shared_blob<float, const SizeVector>(Precision::FP32, NCHW, p.in);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+            // a few equal maximums to check the choice among the ties
+            float *src_data = src->buffer();
+            for (size_t i = 0; i < src->size(); i += 37)
+                src_data[i] = 2.0f;
+
+            auto * srcPtr = dynamic_cast<TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            BlobMap srcs;
+            srcs.insert(std::pair<std::string, Blob::Ptr>("in1", src));
+
+            OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            BlobMap outputBlobs;
+
+            std::pair<std::string, DataPtr> item = *out.begin();
+
+            TBlob<float>::Ptr output;
+            output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_argmax(*srcPtr, dst_ref, p);
+            compare(*output, dst_ref);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtArgMaxTests, TestsArgMax) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsArgMax, MKLDNNCPUExtArgMaxTests,
+        ::testing::Values(
+                argmax_test_params{{2, 21, 7, 13}, {2, 1, 1}, 0, 0, 0, 1},
+                argmax_test_params{{2, 21, 7, 13}, {2, 2, 1}, 0, 0, 1, 1},
+                argmax_test_params{{2, 21, 7, 13}, {2, 2, 5}, 0, 0, 1, 5},
+                argmax_test_params{{2, 21, 7, 13}, {2, 1, 7, 13}, 1, 1, 0, 1},
+                argmax_test_params{{2, 21, 7, 13}, {2, 1, 7, 13}, 1, 1, 1, 1},
+                argmax_test_params{{2, 21, 7, 13}, {2, 3, 7, 13}, 1, 1, 0, 3},
+                argmax_test_params{{2, 21, 7, 13}, {2, 21, 7, 4}, 1, -1, 1, 4},
+                argmax_test_params{{1, 3, 5, 1001}, {1, 3, 5, 1}, 1, 3, 0, 1}
+        ));
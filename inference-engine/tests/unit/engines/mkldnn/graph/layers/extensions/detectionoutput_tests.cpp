@@ -0,0 +1,301 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <random>
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct detectionoutput_test_params {
+    size_t num_images;
+    size_t num_priors;
+    size_t num_classes;
+    int top_k;
+    int keep_top_k;
+    float nms_threshold;
+    float confidence_threshold;
+};
+
+static float ref_overlap(const float *box1, float size1, const float *box2, float size2) {
+    if (box2[0] > box1[2] || box2[2] < box1[0] || box2[1] > box1[3] || box2[3] < box1[1])
+        return 0.0f;
+
+    float width = std::min(box1[2], box2[2]) - std::max(box1[0], box2[0]);
+    float height = std::min(box1[3], box2[3]) - std::max(box1[1], box2[1]);
+    if (width <= 0 || height <= 0)
+        return 0.0f;
+
+    float intersect = width * height;
+    return intersect / (size1 + size2 - intersect);
+}
+
+// Caffe style detection output with the shared locations and the corner-encoded boxes
+static void ref_detectionoutput(const float *loc, const float *conf, const float *priors, float *dst,
+                                detectionoutput_test_params p) {
+    const int P = static_cast<int>(p.num_priors);
+    const int C = static_cast<int>(p.num_classes);
+    const float *variances = priors + P * 4;
+
+    int count = 0;
+    for (int n = 0; n < static_cast<int>(p.num_images); n++) {
+        std::vector<float> boxes(P * 4);
+        std::vector<float> sizes(P);
+        for (int i = 0; i < P; i++) {
+            for (int k = 0; k < 4; k++)
+                boxes[i * 4 + k] = priors[i * 4 + k] + variances[i * 4 + k] * loc[n * P * 4 + i * 4 + k];
+            sizes[i] = (boxes[i * 4 + 2] - boxes[i * 4 + 0]) * (boxes[i * 4 + 3] - boxes[i * 4 + 1]);
+        }
+
+        auto score = [&](int c, int i) { return conf[n * P * C + i * C + c]; };
+
+        std::vector<std::vector<int>> kept(C);
+        int total = 0;
+        for (int c = 1; c < C; c++) {
+            std::vector<int> candidates;
+            for (int i = 0; i < P; i++) {
+                if (score(c, i) > p.confidence_threshold)
+                    candidates.push_back(i);
+            }
+            std::sort(candidates.begin(), candidates.end(), [&](int a, int b) {
+                return score(c, a) > score(c, b) || (score(c, a) == score(c, b) && a < b);
+            });
+            if (p.top_k > -1 && candidates.size() > static_cast<size_t>(p.top_k))
+                candidates.resize(p.top_k);
+
+            for (int idx : candidates) {
+                bool keep = true;
+                for (int k : kept[c])
+                    keep &= ref_overlap(&boxes[idx * 4], sizes[idx], &boxes[k * 4], sizes[k]) <= p.nms_threshold;
+                if (keep)
+                    kept[c].push_back(idx);
+            }
+            total += kept[c].size();
+        }
+
+        if (total > p.keep_top_k) {
+            std::vector<std::pair<float, std::pair<int, int>>> detections;
+            for (int c = 1; c < C; c++) {
+                for (int idx : kept[c])
+                    detections.push_back({score(c, idx), {c, idx}});
+                kept[c].clear();
+            }
+            std::sort(detections.begin(), detections.end(), [](const std::pair<float, std::pair<int, int>> &a,
+                                                               const std::pair<float, std::pair<int, int>> &b) {
+                return a.first > b.first || (a.first == b.first && a.second < b.second);
+            });
+            detections.resize(p.keep_top_k);
+            for (auto &detection : detections)
+                kept[detection.second.first].push_back(detection.second.second);
+        }
+
+        for (int c = 1; c < C; c++) {
+            for (int idx : kept[c]) {
+                float *out = dst + count * 7;
+                out[0] = static_cast<float>(n);
+                out[1] = static_cast<float>(c);
+                out[2] = score(c, idx);
+                for (int k = 0; k < 4; k++)
+                    out[3 + k] = boxes[idx * 4 + k];
+                count++;
+            }
+        }
+    }
+
+    if (count < static_cast<int>(p.num_images) * p.keep_top_k)
+        dst[count * 7] = -1;
+}
+
+class MKLDNNCPUExtDetectionOutputTests: public TestsCommon, public WithParamInterface<detectionoutput_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="DetectionOutput_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="loc" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conf" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="priors" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>_LOC_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="detection_out" type="DetectionOutput" precision="FP32" id="3">
+            <data num_classes="_C_" share_location="1" background_label_id="0" nms_threshold="_NMS_"
+                  top_k="_TOPK_" keep_top_k="_KEEPTOPK_" confidence_threshold="_CONFTHR_"
+                  code_type="caffe.PriorBoxParameter.CORNER" variance_encoded_in_target="0"/>
+            <input>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_LOC_</dim>
+                </port>
+                <port id="1">
+                    <dim>_N_</dim>
+                    <dim>_CONF_</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>_LOC_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>1</dim>
+                    <dim>_OUT_</dim>
+                    <dim>7</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(detectionoutput_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_N_", p.num_images);
+        REPLACE_WITH_NUM(model, "_LOC_", p.num_priors * 4);
+        REPLACE_WITH_NUM(model, "_CONF_", p.num_priors * p.num_classes);
+        REPLACE_WITH_NUM(model, "_C_", p.num_classes);
+        REPLACE_WITH_NUM(model, "_NMS_", p.nms_threshold);
+        REPLACE_WITH_NUM(model, "_TOPK_", p.top_k);
+        REPLACE_WITH_NUM(model, "_KEEPTOPK_", p.keep_top_k);
+        REPLACE_WITH_NUM(model, "_CONFTHR_", p.confidence_threshold);
+        REPLACE_WITH_NUM(model, "_OUT_", p.num_images * p.keep_top_k);
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            detectionoutput_test_params p = ::testing::WithParamInterface<detectionoutput_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            // the clusters of the overlapping boxes with the distinct scores
+            std::mt19937 gen(42);
+            std::uniform_real_distribution<float> uniform(0.f, 1.f);
+
+            Blob::Ptr priors = make_shared_blob<float>({Precision::FP32, {1, 2, p.num_priors * 4}, CHW});
+            priors->allocate();
+            float *prior_data = priors->buffer();
+            for (size_t i = 0; i < p.num_priors; i++) {
+                float cx = 0.1f + 0.2f * (i % 5) + 0.02f * uniform(gen);
+                float cy = 0.1f + 0.2f * (i % 3) + 0.02f * uniform(gen);
+                float w = 0.05f + 0.1f * uniform(gen);
+                float h = 0.05f + 0.1f * uniform(gen);
+                prior_data[i * 4 + 0] = cx - w;
+                prior_data[i * 4 + 1] = cy - h;
+                prior_data[i * 4 + 2] = cx + w;
+                prior_data[i * 4 + 3] = cy + h;
+            }
+            for (size_t i = 0; i < p.num_priors; i++) {
+                float *variance = prior_data + p.num_priors * 4 + i * 4;
+                variance[0] = variance[1] = 0.1f;
+                variance[2] = variance[3] = 0.2f;
+            }
+
+            Blob::Ptr loc = make_shared_blob<float>({Precision::FP32, {p.num_images, p.num_priors * 4}, NC});
+            loc->allocate();
+            float *loc_data = loc->buffer();
+            for (size_t i = 0; i < loc->size(); i++)
+                loc_data[i] = uniform(gen) - 0.5f;
+
+            Blob::Ptr conf = make_shared_blob<float>({Precision::FP32, {p.num_images, p.num_priors * p.num_classes}, NC});
+            conf->allocate();
+            float *conf_data = conf->buffer();
+            std::vector<float> scores(conf->size());
+            for (size_t i = 0; i < scores.size(); i++)
+                scores[i] = static_cast<float>(i + 1) / scores.size();
+            std::shuffle(scores.begin(), scores.end(), gen);
+            std::copy(scores.begin(), scores.end(), conf_data);
+
+            BlobMap srcs;
+            srcs["loc"] = loc;
+            srcs["conf"] = conf;
+            srcs["priors"] = priors;
+
+            OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            BlobMap outputBlobs;
+
+            std::pair<std::string, DataPtr> item = *out.begin();
+
+            TBlob<float>::Ptr output;
+            output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            memset(dst_ref.data(), 0, dst_ref.byteSize());
+            ref_detectionoutput(loc_data, conf_data, prior_data, dst_ref.data(), p);
+
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtDetectionOutputTests, TestsDetectionOutput) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsDetectionOutput, MKLDNNCPUExtDetectionOutputTests,
+        ::testing::Values(
+                detectionoutput_test_params{1, 100, 5, 50, 40, 0.45f, 0.01f},
+                detectionoutput_test_params{2, 200, 21, 100, 60, 0.45f, 0.05f},
+                detectionoutput_test_params{2, 300, 3, 400, 200, 0.3f, 0.f},
+                detectionoutput_test_params{3, 64, 4, 20, 100, 0.6f, 0.5f}
+        ));
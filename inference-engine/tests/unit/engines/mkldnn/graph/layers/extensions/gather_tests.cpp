@@ -688,3 +688,161 @@ INSTANTIATE_TEST_CASE_P(
     ::testing::Values(
         gatherTF_test_params{ { 1, 5, 2, 2 }, in1,{ 1, 3, 2, 2 }, dict, 1,{ 2, 2, 2, 2 }, ref_in1_a0_d322 }));
 
+
+
+struct gather_reduce_test_params {
+    std::string reduction;
+    InferenceEngine::SizeVector in_dim;
+    std::vector<int32_t> in;
+
+    InferenceEngine::SizeVector dct_dim;
+    std::vector<float> dct;
+
+    InferenceEngine::SizeVector ref_dim;
+    std::vector<float> ref;
+};
+
+class MKLDNNCPUExtGatherReduceTests : public TestsCommon, public WithParamInterface<gather_reduce_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="Gather_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="InputText" type="Input" precision="I32" id="1">
+            <output>
+                <port id="1">
+                    _IIDX_
+                </port>
+            </output>
+        </layer>
+        <layer name="InputDictionary" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="2">
+                    _IDICT_
+                </port>
+            </output>
+        </layer>
+        <layer name="gather" id="3" type="Gather" precision="FP32">
+            <data axis="0" reduction="_RED_"/>
+            <input>
+                <port id="1">
+                    _IDICT_
+                </port>
+                <port id="2">
+                    _IIDX_
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    _OUT_
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="2"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(gather_reduce_test_params p) {
+        std::string model = model_t;
+        std::string inIdx;
+        std::string inDict;
+        std::string out;
+
+        for (auto& idx : p.in_dim) {
+            inIdx += "<dim>";
+            inIdx += std::to_string(idx) + "</dim>\n";
+        }
+
+        for (auto& dct : p.dct_dim) {
+            inDict += "<dim>";
+            inDict += std::to_string(dct) + "</dim>\n";
+        }
+
+        for (auto& dst : p.ref_dim) {
+            out += "<dim>";
+            out += std::to_string(dst) + "</dim>\n";
+        }
+
+        REPLACE_WITH_STR(model, "_RED_", p.reduction);
+        REPLACE_WITH_STR(model, "_IIDX_", inIdx);
+        REPLACE_WITH_STR(model, "_IDICT_", inDict);
+        REPLACE_WITH_STR(model, "_OUT_", out);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            gather_reduce_test_params p = ::testing::WithParamInterface<gather_reduce_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            // Input Indexes
+            InferenceEngine::Blob::Ptr srcIdx;
+            srcIdx = InferenceEngine::make_shared_blob<int32_t>({ InferenceEngine::Precision::I32, p.in_dim, InferenceEngine::TensorDesc::getLayoutByDims(p.in_dim) });
+            srcIdx->allocate();
+            memcpy(static_cast<int32_t*>(srcIdx->buffer()), &p.in[0], sizeof(int32_t)*p.in.size());
+
+            //  Input Dictionary
+            InferenceEngine::Blob::Ptr srcDict = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, p.dct_dim, InferenceEngine::TensorDesc::getLayoutByDims(p.dct_dim) });
+            srcDict->allocate();
+            memcpy(srcDict->buffer(), &p.dct[0], sizeof(float)*p.dct.size());
+
+            //  Output Data
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            //  Output Reference
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            memcpy(dst_ref.data(), &p.ref[0], sizeof(float)*p.ref.size());
+
+            //  Infer
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputDictionary", srcDict));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputText", srcIdx));
+            graph.Infer(srcs, outputBlobs);
+
+            //  Check results
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtGatherReduceTests, TestsGather) {}
+
+//  The bags { 0, 2, -1 } and { 1, 1, 2 }, the index -1 pads the shorter bag
+std::vector<int32_t> bags = { 0, 2, -1, 1, 1, 2 };
+std::vector<float> dict_32 = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f };
+std::vector<float> ref_bags_sum = { 6.f, 8.f, 11.f, 14.f };
+std::vector<float> ref_bags_mean = { 3.f, 4.f, 11.f / 3.f, 14.f / 3.f };
+
+INSTANTIATE_TEST_CASE_P(
+        TestsGather, MKLDNNCPUExtGatherReduceTests,
+        ::testing::Values(
+        gather_reduce_test_params{ "sum", { 2, 3 }, bags, { 3, 2 }, dict_32, { 2, 2 }, ref_bags_sum },
+        gather_reduce_test_params{ "mean", { 2, 3 }, bags, { 3, 2 }, dict_32, { 2, 2 }, ref_bags_mean }));
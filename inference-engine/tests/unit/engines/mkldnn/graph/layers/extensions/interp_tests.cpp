@@ -35,12 +35,14 @@ struct interp_test_params {
     int pad_end;
 
     size_t num_prim_desc;
-
+    bool isBlockedFormat;
     int selectedType;
 
     std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
 };
 
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
 void interpolate(const int N, const int C, const float *src, const int x1, const int y1, const int IH_pad, const int IW_pad,
                       const int IH, const int IW, float *dst, const int x2, const int y2, const int OH_pad, const int OW_pad, const int OH, const int OW) {
     if (IH_pad == OH_pad && IW_pad == OW_pad) {
@@ -135,9 +137,7 @@ class MKLDNNCPUExtInterpTests: public TestsCommon, public WithParamInterface<int
                 </port>
             </output>
         </layer>
-        <layer name="interp1" id="1" type="Interp" precision="FP32">
-            <data pad_beg="_PB_" pad_end="_PE_" height="_OH_" width="_OW_"/>
-
+        <layer name="fakeLayer" id="1" type="_FL_" precision="FP32">
             <input>
                 <port id="1">
                     <dim>_IN_</dim>
@@ -148,6 +148,26 @@ class MKLDNNCPUExtInterpTests: public TestsCommon, public WithParamInterface<int
             </input>
             <output>
                 <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="interp1" id="2" type="Interp" precision="FP32">
+            <data pad_beg="_PB_" pad_end="_PE_" height="_OH_" width="_OW_"/>
+
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
                     <dim>_IN_</dim>
                     <dim>_IC_</dim>
                     <dim>_OH_</dim>
@@ -158,12 +178,18 @@ class MKLDNNCPUExtInterpTests: public TestsCommon, public WithParamInterface<int
     </layers>
     <edges>
         <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
     </edges>
 </Net>
 )V0G0N";
 
     std::string getModel(interp_test_params p) {
         std::string model = model_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
         REPLACE_WITH_NUM(model, "_IW_", p.in.w);
         REPLACE_WITH_NUM(model, "_IH_", p.in.h);
         REPLACE_WITH_NUM(model, "_IC_", p.in.c);
@@ -193,6 +219,7 @@ protected:
             InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
             MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
             extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+            extMgr->AddExtension(make_FakeExtensions());
 
             MKLDNNGraphTestClass graph;
             graph.CreateGraph(net_reader.getNetwork(), extMgr);
@@ -210,7 +237,10 @@ protected:
                               node->getSelectedPrimitiveDescriptor()->getImplementationType() & p.selectedType);
                 }
             }
-            ASSERT_LE(4, nodes.size());
+            if (p.isBlockedFormat)
+                ASSERT_EQ(6, nodes.size());
+            else
+                ASSERT_EQ(4, nodes.size());
 
             InferenceEngine::SizeVector dims_src = {p.in.w, p.in.h, p.in.c, p.in.n};
 
@@ -255,5 +285,11 @@ TEST_P(MKLDNNCPUExtInterpTests, TestsInterp) {}
 INSTANTIATE_TEST_CASE_P(
         TestsInterp, MKLDNNCPUExtInterpTests,
         ::testing::Values(
-                interp_test_params{{1, 256, 1, 1}, {33, 65}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown },
-                interp_test_params{{1, 2, 33, 65}, {33, 65}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown }));
+                interp_test_params{{1, 256, 1, 1}, {33, 65}, 0, 0, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{1, 2, 33, 65}, {33, 65}, 0, 0, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{2, 20, 17, 23}, {40, 51}, 0, 0, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{2, 16, 30, 42}, {15, 21}, 0, 0, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{1, 256, 1, 1}, {33, 65}, 0, 0, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{1, 2, 33, 65}, {33, 65}, 0, 0, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{2, 3, 17, 23}, {40, 51}, 0, 0, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{2, 5, 30, 42}, {15, 21}, 0, 0, 2, false, MKLDNNPlugin::impl_desc_type::unknown }));
@@ -359,3 +359,148 @@ INSTANTIATE_TEST_CASE_P(
         /*23*/  mvn_test_params{{2, 64, 24, 32, 40}, 1, 1, 0.00001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
                 mvn_test_params{{1, 64, 32, 32, 32}, 0, 1, 0.001f, 2, true, MKLDNNPlugin::impl_desc_type::unknown }
             ));
+
+class MKLDNNCPUExtMVNScaleShiftFusingTests: public TestsCommon, public WithParamInterface<mvn_test_params> {
+    std::string layers_t = R"V0G0N(
+        <layer name="mvn" id="1" type="MVN" precision="FP32">
+            <data across_channels="_AC_" normalize_variance="_NV_" eps="_EPS_"/>
+            <input>
+                <port id="1">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+        <layer name="scaleshift" id="2" type="ScaleShift" precision="FP32">
+            <data broadcast="0"/>
+            <weights offset="0" size="_S1_" />
+            <biases offset="_S1_" size="_S1_" />
+            <input>
+                <port id="3">
+                    __SRC_DIMS__
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    __SRC_DIMS__
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+)V0G0N";
+
+    std::string getModel(mvn_test_params p) {
+        std::string model = layers_t;
+
+        std::string s_dims;
+        for (auto& dim : p.dims) {
+            s_dims += "\n                    <dim>";
+            s_dims += std::to_string(dim) + "</dim>";
+        }
+        REPLACE_WITH_STR(model, "__SRC_DIMS__", s_dims);
+
+        REPLACE_WITH_NUM(model, "_AC_", p.across_channels);
+        REPLACE_WITH_NUM(model, "_NV_", p.normalize_variance);
+        REPLACE_WITH_NUM(model, "_EPS_", p.eps);
+        REPLACE_WITH_NUM(model, "_S1_", p.dims[1] * sizeof(float));
+
+        model = IRTemplateGenerator::getIRTemplate("MVN_ScaleShift", p.dims, "FP32", model, edges_t);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            mvn_test_params p = ::testing::WithParamInterface<mvn_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t C = p.dims[1];
+            TBlob<uint8_t> *weights = new TBlob<uint8_t>(Precision::U8, InferenceEngine::C, {2 * C * sizeof(float)});
+            weights->allocate();
+            fill_data_sine((float *) weights->buffer(), weights->size() / sizeof(float), 1, 2, 0.5);
+            TBlob<uint8_t>::Ptr weights_ptr = TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            // the ScaleShift is applied by the MVN kernel
+            for (auto &node : graph.getNodes()) {
+                ASSERT_NE(MKLDNNPlugin::Type::Depthwise, node->getType());
+            }
+
+            Layout layout = p.dims.size() == 5 ? NCDHW : NCHW;
+            Blob::Ptr src = make_shared_blob<float, const SizeVector>(Precision::FP32, layout, p.dims);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            BlobMap srcs;
+            srcs.insert(std::pair<std::string, Blob::Ptr>("in1", src));
+
+            OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            BlobMap outputBlobs;
+
+            std::pair<std::string, DataPtr> item = *out.begin();
+
+            TBlob<float>::Ptr output;
+            output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_mvn(*srcPtr, dst_ref, p);
+
+            const float *scales = (const float *) weights->buffer();
+            const float *shifts = scales + C;
+            float *dst_data = dst_ref.data();
+            size_t spatial = dst_ref.size() / (p.dims[0] * C);
+            for (size_t i = 0; i < dst_ref.size(); i++) {
+                size_t c = (i / spatial) % C;
+                dst_data[i] = dst_data[i] * scales[c] + shifts[c];
+            }
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtMVNScaleShiftFusingTests, TestsMVNScaleShiftFusing) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsMVNScaleShiftFusing, MKLDNNCPUExtMVNScaleShiftFusingTests,
+        ::testing::Values(
+                mvn_test_params{{2, 64, 15, 15}, 0, 1, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{2, 64, 15, 15}, 1, 1, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{2,  3, 33, 65}, 0, 0, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                mvn_test_params{{2, 64, 24, 32, 40}, 0, 1, 0.00001f, 2, false, MKLDNNPlugin::impl_desc_type::unknown }
+            ));
@@ -0,0 +1,255 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+#include "ir_gen_helper.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+using namespace single_layer_tests;
+
+
+struct normalize_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    int across_spatial;
+    int channel_shared;
+    float eps;
+
+    size_t num_prim_desc;
+    bool isBlockedFormat;
+    int selectedType;
+
+    vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+};
+
+extern InferenceEngine::IExtensionPtr make_FakeExtensions();
+
+template <typename data_t>
+void ref_normalize(const TBlob<data_t> &src, TBlob<data_t> &dst, const float *weights, normalize_test_params prm) {
+    const data_t *src_data = src.readOnly();
+    data_t *dst_data = dst.data();
+
+    size_t N = prm.in.n;
+    size_t C = prm.in.c;
+    size_t H = prm.in.h;
+    size_t W = prm.in.w;
+
+    for (size_t b = 0; b < N; b++) {
+        const data_t *psrc = src_data + b * C * H * W;
+        data_t *pdst = dst_data + b * C * H * W;
+
+        if (prm.across_spatial) {
+            double norm = prm.eps;
+            for (size_t i = 0; i < C * H * W; i++)
+                norm += psrc[i] * psrc[i];
+            norm = 1.0 / std::sqrt(norm);
+
+            for (size_t c = 0; c < C; c++) {
+                float s = prm.channel_shared ? weights[0] : weights[c];
+                for (size_t hw = 0; hw < H * W; hw++)
+                    pdst[c * H * W + hw] = psrc[c * H * W + hw] * norm * s;
+            }
+        } else {
+            for (size_t hw = 0; hw < H * W; hw++) {
+                double norm = prm.eps;
+                for (size_t c = 0; c < C; c++)
+                    norm += psrc[c * H * W + hw] * psrc[c * H * W + hw];
+                norm = 1.0 / std::sqrt(norm);
+
+                for (size_t c = 0; c < C; c++) {
+                    float s = prm.channel_shared ? weights[0] : weights[c];
+                    pdst[c * H * W + hw] = psrc[c * H * W + hw] * norm * s;
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtNormalizeTests: public TestsCommon, public WithParamInterface<normalize_test_params> {
+    std::string layers_t = R"V0G0N(
+        <layer name="fakeLayer" id="1" type="_FL_" precision="FP32">
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="normalize" id="2" type="Normalize" precision="FP32">
+            <data across_spatial="_AS_" channel_shared="_CS_" eps="_EPS_"/>
+            <blobs>
+                <weights offset="0" size="_WS_"/>
+            </blobs>
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+)V0G0N";
+
+    std::string getModel(normalize_test_params p) {
+        std::string model = layers_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_AS_", p.across_spatial);
+        REPLACE_WITH_NUM(model, "_CS_", p.channel_shared);
+        REPLACE_WITH_NUM(model, "_EPS_", p.eps);
+        REPLACE_WITH_NUM(model, "_WS_", (p.channel_shared ? 1 : p.in.c) * sizeof(float));
+
+        model = IRTemplateGenerator::getIRTemplate("Normalize_Only", {p.in.n, p.in.c, p.in.h, p.in.w}, "FP32", model, edges_t);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            normalize_test_params p = ::testing::WithParamInterface<normalize_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t weights_size = p.channel_shared ? 1 : p.in.c;
+            TBlob<uint8_t> *weights = new TBlob<uint8_t>(Precision::U8, C, {weights_size * sizeof(float)});
+            weights->allocate();
+            float *weights_data = weights->buffer().as<float *>();
+            for (size_t i = 0; i < weights_size; i++)
+                weights_data[i] = 0.5f + static_cast<float>(i % 7);
+            TBlob<uint8_t>::Ptr weights_ptr = TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+            extMgr->AddExtension(make_FakeExtensions());
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            auto& nodes = graph.getNodes();
+            nodes = graph.getNodes();
+
+            for (auto &node : nodes) {
+                if (node->getName() == "normalize") {
+                    ASSERT_EQ(p.num_prim_desc, node->getSupportedPrimitiveDescriptors().size());
+                    for (size_t j = 0; j < p.num_prim_desc && j < p.comp.size(); j++) {
+                        p.comp.at(j)(node->getSupportedPrimitiveDescriptors().at(j));
+                    }
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    ASSERT_EQ(p.selectedType,
+                              node->getSelectedPrimitiveDescriptor()->getImplementationType() & p.selectedType);
+                }
+            }
+            if (p.isBlockedFormat)
+                ASSERT_EQ(6, nodes.size());
+            else
+                ASSERT_EQ(5, nodes.size()); // TODO: should be 4 (redudant reorder in case of both layers are inplace)
+
+            SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+
+            Blob::Ptr src = make_shared_blob<float, const SizeVector>(Precision::FP32, NCHW, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            auto * srcPtr = dynamic_cast<TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            BlobMap srcs;
+            srcs.insert(std::pair<std::string, Blob::Ptr>("in1", src));
+
+            OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            BlobMap outputBlobs;
+
+            std::pair<std::string, DataPtr> item = *out.begin();
+
+            TBlob<float>::Ptr output;
+            output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_normalize(*srcPtr, dst_ref, weights_data, p);
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtNormalizeTests, TestsNormalize) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsNormalize, MKLDNNCPUExtNormalizeTests,
+        ::testing::Values(
+                normalize_test_params{{1, 32, 10, 10}, 0, 0, 1e-5f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 32, 10, 10}, 0, 0, 1e-5f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 19, 7, 13}, 0, 1, 1e-5f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 19, 7, 13}, 0, 1, 1e-5f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 32, 10, 10}, 1, 0, 1e-5f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{1, 32, 10, 10}, 1, 0, 1e-5f, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 21, 5, 9}, 1, 1, 1e-5f, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                normalize_test_params{{2, 21, 5, 9}, 1, 1, 1e-5f, 2, true, MKLDNNPlugin::impl_desc_type::unknown }
+        ));
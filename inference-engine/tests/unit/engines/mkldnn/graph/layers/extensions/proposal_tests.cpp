@@ -0,0 +1,339 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct proposal_test_params {
+    size_t num_images;
+    size_t height;
+    size_t width;
+    std::vector<float> ratios;
+    std::vector<float> scales;
+    int pre_nms_topn;
+    int post_nms_topn;
+    float nms_thresh;
+    std::string framework;
+};
+
+struct ref_box {
+    float x0, y0, x1, y1, score;
+};
+
+static float ref_iou(const ref_box &a, const ref_box &b, float offset) {
+    if (a.x0 > b.x1 || a.y0 > b.y1 || b.x0 > a.x1 || b.y0 > a.y1)
+        return 0.0f;
+
+    const float width = std::max(0.0f, std::min(a.x1, b.x1) - std::max(a.x0, b.x0) + offset);
+    const float height = std::max(0.0f, std::min(a.y1, b.y1) - std::max(a.y0, b.y0) + offset);
+    const float area = width * height;
+    const float a_area = (a.x1 - a.x0 + offset) * (a.y1 - a.y0 + offset);
+    const float b_area = (b.x1 - b.x0 + offset) * (b.y1 - b.y0 + offset);
+    return area / (a_area + b_area - area);
+}
+
+// the sequential proposal of one image after the other with the full sort and the greedy NMS
+static void ref_proposal(const float *scores, const float *deltas, const float *img_info, float *dst,
+                         proposal_test_params p, int feat_stride, int base_size, int min_size) {
+    const bool tf = p.framework == "tensorflow";
+    const float offset = tf ? 0.0f : 1.0f;
+    const int H = static_cast<int>(p.height);
+    const int W = static_cast<int>(p.width);
+    const int A = static_cast<int>(p.ratios.size() * p.scales.size());
+
+    std::vector<ref_box> anchors;
+    const float center = 0.5f * (base_size - offset);
+    for (float ratio : p.ratios) {
+        float ratio_w = std::sqrt(base_size * base_size / ratio);
+        float ratio_h = ratio_w * ratio;
+        if (!tf) {
+            ratio_w = std::roundf(ratio_w);
+            ratio_h = std::roundf(ratio_w * ratio);
+        }
+        for (float scale : p.scales) {
+            const float scale_w = 0.5f * (ratio_w * scale - offset);
+            const float scale_h = 0.5f * (ratio_h * scale - offset);
+            const float shift = tf ? 0.5f * base_size : 0.0f;
+            anchors.push_back({center - scale_w - shift, center - scale_h - shift,
+                               center + scale_w - shift, center + scale_h - shift, 0.0f});
+        }
+    }
+
+    const float img_H = img_info[tf ? 1 : 0];
+    const float img_W = img_info[tf ? 0 : 1];
+    const float min_box = min_size * img_info[2];
+
+    for (int n = 0; n < static_cast<int>(p.num_images); n++) {
+        const float *fg_scores = scores + n * 2 * A * H * W + A * H * W;
+        const float *img_deltas = deltas + n * 4 * A * H * W;
+
+        std::vector<ref_box> boxes;
+        for (int h = 0; h < H; h++) {
+            for (int w = 0; w < W; w++) {
+                for (int a = 0; a < A; a++) {
+                    const float x = static_cast<float>((tf ? h : w) * feat_stride);
+                    const float y = static_cast<float>((tf ? w : h) * feat_stride);
+                    ref_box box = {x + anchors[a].x0, y + anchors[a].y0, x + anchors[a].x1, y + anchors[a].y1, 0.0f};
+                    if (tf) {
+                        box.x0 = std::max(0.0f, std::min(box.x0, img_W));
+                        box.y0 = std::max(0.0f, std::min(box.y0, img_H));
+                        box.x1 = std::max(0.0f, std::min(box.x1, img_W));
+                        box.y1 = std::max(0.0f, std::min(box.y1, img_H));
+                    }
+
+                    const float *d = img_deltas + (a * 4) * H * W + h * W + w;
+                    const float ww = box.x1 - box.x0 + offset;
+                    const float hh = box.y1 - box.y0 + offset;
+                    const float ctr_x = box.x0 + 0.5f * ww + d[0] * ww;
+                    const float ctr_y = box.y0 + 0.5f * hh + d[H * W] * hh;
+                    const float pred_w = std::exp(d[2 * H * W]) * ww;
+                    const float pred_h = std::exp(d[3 * H * W]) * hh;
+
+                    box.x0 = std::max(0.0f, std::min(ctr_x - 0.5f * pred_w, img_W - offset));
+                    box.y0 = std::max(0.0f, std::min(ctr_y - 0.5f * pred_h, img_H - offset));
+                    box.x1 = std::max(0.0f, std::min(ctr_x + 0.5f * pred_w, img_W - offset));
+                    box.y1 = std::max(0.0f, std::min(ctr_y + 0.5f * pred_h, img_H - offset));
+
+                    const bool valid = box.x1 - box.x0 + offset >= min_box && box.y1 - box.y0 + offset >= min_box;
+                    box.score = valid ? fg_scores[a * H * W + h * W + w] : 0.0f;
+                    boxes.push_back(box);
+                }
+            }
+        }
+
+        std::stable_sort(boxes.begin(), boxes.end(), [](const ref_box &a, const ref_box &b) {
+            return a.score > b.score;
+        });
+        boxes.resize(std::min<size_t>(boxes.size(), p.pre_nms_topn));
+
+        std::vector<ref_box> kept;
+        for (const ref_box &box : boxes) {
+            if (kept.size() == static_cast<size_t>(p.post_nms_topn))
+                break;
+            bool keep = true;
+            for (const ref_box &k : kept)
+                keep &= !(p.nms_thresh < ref_iou(k, box, offset));
+            if (keep)
+                kept.push_back(box);
+        }
+
+        float *rois = dst + n * p.post_nms_topn * 5;
+        for (size_t i = 0; i < kept.size(); i++) {
+            rois[i * 5 + 0] = static_cast<float>(n);
+            rois[i * 5 + 1] = kept[i].x0;
+            rois[i * 5 + 2] = kept[i].y0;
+            rois[i * 5 + 3] = kept[i].x1;
+            rois[i * 5 + 4] = kept[i].y1;
+        }
+        if (kept.size() < static_cast<size_t>(p.post_nms_topn))
+            rois[kept.size() * 5] = -1;
+    }
+}
+
+class MKLDNNCPUExtProposalTests: public TestsCommon, public WithParamInterface<proposal_test_params> {
+    static const int feat_stride = 16;
+    static const int base_size = 16;
+    static const int min_size = 1;
+
+    std::string model_t = R"V0G0N(
+<net Name="Proposal_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="scores" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_SC_</dim>
+                    <dim>_H_</dim>
+                    <dim>_W_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="deltas" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_DC_</dim>
+                    <dim>_H_</dim>
+                    <dim>_W_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="img_info" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="proposal" type="Proposal" precision="FP32" id="3">
+            <data feat_stride="_FS_" base_size="_BS_" min_size="_MS_" ratio="_RATIOS_" scale="_SCALES_"
+                  pre_nms_topn="_PRE_" post_nms_topn="_POST_" nms_thresh="_NMS_" framework="_FW_"/>
+            <input>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_SC_</dim>
+                    <dim>_H_</dim>
+                    <dim>_W_</dim>
+                </port>
+                <port id="1">
+                    <dim>_N_</dim>
+                    <dim>_DC_</dim>
+                    <dim>_H_</dim>
+                    <dim>_W_</dim>
+                </port>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_OUT_</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    static std::string join(const std::vector<float> &values) {
+        std::string result;
+        for (size_t i = 0; i < values.size(); i++)
+            result += (i ? "," : "") + std::to_string(values[i]);
+        return result;
+    }
+
+    std::string getModel(proposal_test_params p) {
+        std::string model = model_t;
+        const size_t A = p.ratios.size() * p.scales.size();
+        REPLACE_WITH_NUM(model, "_N_", p.num_images);
+        REPLACE_WITH_NUM(model, "_SC_", 2 * A);
+        REPLACE_WITH_NUM(model, "_DC_", 4 * A);
+        REPLACE_WITH_NUM(model, "_H_", p.height);
+        REPLACE_WITH_NUM(model, "_W_", p.width);
+        REPLACE_WITH_NUM(model, "_FS_", feat_stride);
+        REPLACE_WITH_NUM(model, "_BS_", base_size);
+        REPLACE_WITH_NUM(model, "_MS_", min_size);
+        REPLACE_WITH_STR(model, "_RATIOS_", join(p.ratios));
+        REPLACE_WITH_STR(model, "_SCALES_", join(p.scales));
+        REPLACE_WITH_NUM(model, "_PRE_", p.pre_nms_topn);
+        REPLACE_WITH_NUM(model, "_POST_", p.post_nms_topn);
+        REPLACE_WITH_NUM(model, "_NMS_", p.nms_thresh);
+        REPLACE_WITH_STR(model, "_FW_", p.framework);
+        REPLACE_WITH_NUM(model, "_OUT_", p.num_images * p.post_nms_topn);
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            proposal_test_params p = ::testing::WithParamInterface<proposal_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            InferenceEngine::Extension cpuExt(make_so_name("cpu_extension"));
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(InferenceEngine::IExtensionPtr(&cpuExt, [](InferenceEngine::IExtension*){}));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            const size_t A = p.ratios.size() * p.scales.size();
+            std::mt19937 gen(42);
+            std::uniform_real_distribution<float> uniform(-0.5f, 0.5f);
+
+            // the distinct scores, so the order of the proposals does not depend on the sort
+            Blob::Ptr scores = make_shared_blob<float>({Precision::FP32, {p.num_images, 2 * A, p.height, p.width}, NCHW});
+            scores->allocate();
+            float *scores_data = scores->buffer();
+            std::vector<float> values(scores->size());
+            for (size_t i = 0; i < values.size(); i++)
+                values[i] = static_cast<float>(i + 1) / values.size();
+            std::shuffle(values.begin(), values.end(), gen);
+            std::copy(values.begin(), values.end(), scores_data);
+
+            Blob::Ptr deltas = make_shared_blob<float>({Precision::FP32, {p.num_images, 4 * A, p.height, p.width}, NCHW});
+            deltas->allocate();
+            float *deltas_data = deltas->buffer();
+            for (size_t i = 0; i < deltas->size(); i++)
+                deltas_data[i] = uniform(gen);
+
+            Blob::Ptr img_info = make_shared_blob<float>({Precision::FP32, {1, 3}, NC});
+            img_info->allocate();
+            float *img_info_data = img_info->buffer();
+            img_info_data[0] = static_cast<float>(p.height * feat_stride);
+            img_info_data[1] = static_cast<float>(p.width * feat_stride);
+            img_info_data[2] = 1.0f;
+
+            BlobMap srcs;
+            srcs["scores"] = scores;
+            srcs["deltas"] = deltas;
+            srcs["img_info"] = img_info;
+
+            OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            BlobMap outputBlobs;
+
+            std::pair<std::string, DataPtr> item = *out.begin();
+
+            TBlob<float>::Ptr output;
+            output = make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            memset(dst_ref.data(), 0, dst_ref.byteSize());
+            ref_proposal(scores_data, deltas_data, img_info_data, dst_ref.data(), p, feat_stride, base_size, min_size);
+
+            compare(*output, dst_ref, 1e-3f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtProposalTests, TestsProposal) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsProposal, MKLDNNCPUExtProposalTests,
+        ::testing::Values(
+                proposal_test_params{1, 7, 13, {0.5f, 1.0f, 2.0f}, {8.0f, 16.0f}, 300, 50, 0.7f, ""},
+                proposal_test_params{4, 10, 21, {0.5f, 1.0f, 2.0f}, {4.0f, 8.0f, 16.0f}, 1000, 100, 0.7f, ""},
+                proposal_test_params{2, 12, 40, {1.0f}, {2.0f, 4.0f}, 960, 300, 0.5f, ""},
+                proposal_test_params{3, 9, 17, {0.5f, 1.0f, 2.0f}, {1.0f, 2.0f}, 500, 200, 0.6f, "tensorflow"}
+        ));
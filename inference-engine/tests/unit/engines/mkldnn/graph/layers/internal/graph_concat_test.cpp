@@ -217,6 +217,11 @@ INSTANTIATE_TEST_CASE_P(
                         {1, 7, 9, 5},
                         2, 1, MKLDNNPlugin::impl_desc_type::ref
                 },
+                concat_test_params {
+                        {1, 1, 3, 5},
+                        {1, 1, 4, 5},
+                        2, 2
+                },
                 concat_test_params {
                         {1, 2, 3, 5, 3},
                         {1, 5, 3, 5, 3},
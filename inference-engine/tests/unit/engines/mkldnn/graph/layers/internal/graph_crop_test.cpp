@@ -10,6 +10,7 @@
 
 #include "single_layer_common.hpp"
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <mkldnn_plugin/nodes/mkldnn_crop_node.h>
 #include <inference_engine/cnn_network_impl.hpp>
 #include "tests_common.hpp"
 
@@ -323,3 +324,113 @@ INSTANTIATE_TEST_CASE_P(
                         }}},
                 crop_test_params{{1, 5, 32, 32}, {3}, {10}, {20}, 1, MKLDNNPlugin::impl_desc_type::unknown },
                 crop_test_params{{1, 5, 32, 20}, {2, 3}, {30, 10}, {2, 10}, 1, MKLDNNPlugin::impl_desc_type::unknown }));
+
+class MKLDNNGraphCropViewTests: public TestsCommon {
+protected:
+    std::string model = R"V0G0N(
+<Net Name="Crop_View" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="crop" id="1" type="Crop" precision="FP32">
+            <data axis="1,2,3" offset="2,3,5" dim="4,8,10" />
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" id="2" type="Power" precision="FP32">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                    <dim>8</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</Net>
+)V0G0N";
+};
+
+TEST_F(MKLDNNGraphCropViewTests, TestCropFeedingLayerIsViewOfInput) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(net_reader.getNetwork());
+
+    // the crop is not executed, its output is the memory of the input with the offset of the cropped part
+    for (auto &node : graph.getNodes()) {
+        if (node->getType() == MKLDNNPlugin::Crop) {
+            auto *crop = dynamic_cast<MKLDNNPlugin::MKLDNNCropNode *>(node.get());
+            ASSERT_NE(nullptr, crop);
+            ASSERT_TRUE(crop->isOptimized());
+            auto &srcMemory = node->getParentEdgeAt(0)->getMemory();
+            auto &dstMemory = node->getChildEdgeAt(0)->getMemory();
+            ASSERT_EQ(srcMemory.GetData(), dstMemory.GetData());
+        }
+    }
+
+    crop_test_params p = {{1, 8, 16, 16}, {1, 2, 3}, {2, 3, 5}, {4, 8, 10}};
+    InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+    InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, dims_src, InferenceEngine::NCHW));
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+
+    InferenceEngine::BlobMap srcs;
+    srcs["in1"] = src;
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[item.first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+    dst_ref.allocate();
+    ref_crop(*src, dst_ref, p);
+    float *ref_data = dst_ref.data();
+    for (size_t i = 0; i < dst_ref.size(); i++)
+        ref_data[i] = ref_data[i] * 2 + 1;
+
+    compare(*output, dst_ref);
+}
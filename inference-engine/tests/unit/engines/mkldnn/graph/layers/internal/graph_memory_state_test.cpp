@@ -0,0 +1,209 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/mkldnn_memory_state.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include "tests_common.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+class MKLDNNGraphMemoryStateTests: public TestsCommon {
+protected:
+    static const size_t C = 10;
+
+    // the state accumulates the inputs, the output is twice the new state: out = 2 * (in + state), state = in + state
+    std::string model = R"V0G0N(
+<net batch="1" name="Memory_Accumulator" version="2">
+    <layers>
+        <layer id="0" name="in" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="state_in" precision="FP32" type="Memory">
+            <data id="acc" index="1" size="2"/>
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="sum" precision="FP32" type="Eltwise">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="state_out" precision="FP32" type="Memory">
+            <data id="acc" index="0" size="2"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+        </layer>
+        <layer id="4" name="out" precision="FP32" type="Power">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>10</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+        <edge from-layer="2" from-port="2" to-layer="4" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    InferenceEngine::Blob::Ptr src, dst;
+    InferenceEngine::BlobMap srcs, outputBlobs;
+
+    virtual void SetUp() {
+        TestsCommon::SetUp();
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+        src = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, C},
+                                                        InferenceEngine::NC});
+        src->allocate();
+        srcs["in"] = src;
+        dst = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, C},
+                                                        InferenceEngine::NC});
+        dst->allocate();
+        outputBlobs["out"] = dst;
+    }
+
+    void fillInput(int inference) {
+        fill_data_sine(src->buffer(), C, inference, 0.5, 0.7);
+    }
+
+    // adds the input to the reference state and checks the output of the inference
+    void checkOutput(std::vector<float> &state) {
+        const float *in = src->buffer().as<float *>();
+        const float *out = dst->buffer().as<float *>();
+        for (size_t i = 0; i < C; i++) {
+            state[i] += in[i];
+            ASSERT_NEAR(2 * state[i], out[i], 1e-5) << "element " << i;
+        }
+    }
+};
+
+TEST_F(MKLDNNGraphMemoryStateTests, TestsStateIsCarriedAcrossInferences) {
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    // the state starts at zero
+    std::vector<float> state(C, 0.f);
+    for (int inference = 0; inference < 4; inference++) {
+        fillInput(inference);
+        ASSERT_NO_THROW(graph.Infer(srcs, outputBlobs));
+        checkOutput(state);
+    }
+}
+
+TEST_F(MKLDNNGraphMemoryStateTests, TestsGraphsOfOneNetworkKeepSeparateStates) {
+    MKLDNNGraphTestClass graph1, graph2;
+    ASSERT_NO_THROW(graph1.CreateGraph(net_reader.getNetwork()));
+    ASSERT_NO_THROW(graph2.CreateGraph(net_reader.getNetwork()));
+
+    std::vector<float> state1(C, 0.f), state2(C, 0.f);
+    for (int inference = 0; inference < 3; inference++) {
+        fillInput(inference);
+        ASSERT_NO_THROW(graph1.Infer(srcs, outputBlobs));
+        checkOutput(state1);
+        // the second graph runs every other inference only, so its state differs from the state of the first one
+        if (inference % 2 == 0) {
+            fillInput(inference + 10);
+            ASSERT_NO_THROW(graph2.Infer(srcs, outputBlobs));
+            checkOutput(state2);
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphMemoryStateTests, TestsQueryStateResetsAndSetsState) {
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), {}, {}));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+    InferenceEngine::IInferRequest::Ptr inferRequest;
+    execNetwork->CreateInferRequest(inferRequest);
+
+    InferenceEngine::ResponseDesc resp;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob("in", src, &resp)) << resp.msg;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob("out", dst, &resp)) << resp.msg;
+
+    auto states = execNetwork->QueryState();
+    ASSERT_EQ(1, states.size());
+    ASSERT_EQ("acc", states[0]->GetName());
+
+    std::vector<float> state(C, 0.f);
+    for (int inference = 0; inference < 2; inference++) {
+        fillInput(inference);
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+        checkOutput(state);
+    }
+
+    InferenceEngine::Blob::CPtr last = states[0]->GetLastState();
+    ASSERT_EQ(InferenceEngine::SizeVector({1, C}), last->getTensorDesc().getDims());
+    const float *last_data = last->cbuffer().as<const float *>();
+    for (size_t i = 0; i < C; i++)
+        ASSERT_NEAR(state[i], last_data[i], 1e-5) << "element " << i;
+
+    // the reset starts from zero again
+    states[0]->Reset();
+    std::fill(state.begin(), state.end(), 0.f);
+    for (int inference = 0; inference < 2; inference++) {
+        fillInput(inference + 2);
+        ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+        checkOutput(state);
+    }
+
+    InferenceEngine::Blob::Ptr newState = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, {1, C}, InferenceEngine::NC});
+    newState->allocate();
+    fill_data_sine(newState->buffer(), C, 0.1, 0.9, 1);
+    states[0]->SetState(newState);
+    const float *new_data = newState->buffer();
+    state.assign(new_data, new_data + C);
+    fillInput(4);
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+    checkOutput(state);
+}
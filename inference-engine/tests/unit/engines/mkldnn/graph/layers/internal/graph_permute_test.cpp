@@ -276,3 +276,87 @@ INSTANTIATE_TEST_CASE_P(
                 permute_test_params{{2, 12, 9}, {0, 2, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
                 permute_test_params{{2, 8, 3, 3, 4, 5}, {0, 3, 4, 1, 5, 2}, 1, MKLDNNPlugin::impl_desc_type::unknown}
         ));
+
+class MKLDNNGraphInt8PermuteTests: public MKLDNNGraphPermuteTests {
+protected:
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            permute_test_params p = ::testing::WithParamInterface<permute_test_params>::GetParam();
+            std::string model = getModel(p);
+            REPLACE_WITH_STR(model, "precision=\"FP32\" id=\"0\"", "precision=\"U8\" id=\"0\"");
+            REPLACE_WITH_STR(model, "type=\"Permute\" precision=\"FP32\"", "type=\"Permute\" precision=\"U8\"");
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+            for (auto &node : graph.getNodes()) {
+                if (node->getType() == MKLDNNPlugin::Permute) {
+                    // the quantized data is permuted as is, without the conversion to FP32
+                    ASSERT_EQ(MKLDNNPlugin::Input, node->getParentEdgeAt(0)->getParent()->getType());
+                    ASSERT_NE(nullptr, node->getSelectedPrimitiveDescriptor());
+                    auto &config = node->getSelectedPrimitiveDescriptor()->getConfig();
+                    ASSERT_EQ(InferenceEngine::Precision::U8, config.inConfs[0].desc.getPrecision());
+                    ASSERT_EQ(InferenceEngine::Precision::U8, config.outConfs[0].desc.getPrecision());
+                }
+            }
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<uint8_t>({InferenceEngine::Precision::U8, p.dims, InferenceEngine::TensorDesc::getLayoutByDims(p.dims)});
+            src->allocate();
+            uint8_t *src_data = src->buffer().as<uint8_t *>();
+            for (size_t i = 0; i < src->size(); i++)
+                src_data[i] = static_cast<uint8_t>(i % 251);
+
+            auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<uint8_t>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<uint8_t>.";
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            // the network output is converted to FP32 at the boundary
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TensorDesc td(InferenceEngine::Precision::U8, p.dims, InferenceEngine::TensorDesc::getLayoutByDims(p.dims));
+            InferenceEngine::TBlob<uint8_t> dst_ref(td);
+            dst_ref.allocate();
+
+            ref_permute(*srcPtr, dst_ref, p);
+
+            const float *dst_data = output->readOnly();
+            const uint8_t *ref_data = dst_ref.readOnly();
+            for (size_t i = 0; i < dst_ref.size(); i++)
+                ASSERT_EQ(static_cast<float>(ref_data[i]), dst_data[i]) << "element " << i;
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphInt8PermuteTests, TestsInt8Permute) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsInt8Permute, MKLDNNGraphInt8PermuteTests,
+        ::testing::Values(
+                permute_test_params{{2, 3, 4, 5}, {0, 2, 3, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 3, 4, 5}, {0, 2, 1, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 3, 4, 5}, {3, 0, 1, 2}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 3, 4, 5}, {1, 3, 2, 0}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 3, 4}, {0, 2, 1}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 8, 2, 2, 4, 5}, {0, 1, 4, 2, 5, 3}, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                permute_test_params{{2, 8, 3, 3, 4, 5}, {0, 3, 4, 1, 5, 2}, 1, MKLDNNPlugin::impl_desc_type::unknown}
+        ));
@@ -311,6 +311,8 @@ protected:
             };
             graph.checkDynBatch(srcs, outputBlobs, MB, MB, checkPower);
             graph.checkDynBatch(srcs, outputBlobs, 1, MB, checkPower);
+            // the nodes switch back to the primitives they created for the whole batch
+            graph.checkDynBatch(srcs, outputBlobs, MB, MB, checkPower);
         } catch (const InferenceEngine::details::InferenceEngineException &e) {
             FAIL() << e.what();
         }
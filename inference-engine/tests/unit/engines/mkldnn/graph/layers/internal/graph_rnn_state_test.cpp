@@ -0,0 +1,406 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/mkldnn_memory_state.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <cmath>
+#include "tests_common.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+class MKLDNNGraphRNNStateTests: public TestsCommon {
+protected:
+    static const size_t T = 3;
+    static const size_t DC = 5;
+    static const size_t SC = 4;
+
+    // the vanilla RNN sequence with the initial state input and the last state output
+    std::string model = R"V0G0N(
+<net batch="1" name="RNN_Seq" version="5">
+    <layers>
+        <layer id="0" name="in_data" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="in_state" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="rnn" precision="FP32" type="RNNSequence">
+            <data hidden_size="4" axis="1" direction="Forward" activations="tanh"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <blobs>
+                <weights offset="0" size="144"/>
+                <biases offset="144" size="16"/>
+            </blobs>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    InferenceEngine::TBlob<uint8_t>::Ptr weights;
+    InferenceEngine::Blob::Ptr src_data, src_state;
+    InferenceEngine::BlobMap srcs, outputBlobs;
+    InferenceEngine::Blob::Ptr dst_seq, dst_state;
+
+    virtual void SetUp() {
+        TestsCommon::SetUp();
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+        weights = InferenceEngine::TBlob<uint8_t>::Ptr(new InferenceEngine::TBlob<uint8_t>(
+                InferenceEngine::Precision::U8, InferenceEngine::C, {(SC * (DC + SC) + SC) * sizeof(float)}));
+        weights->allocate();
+        float *w = reinterpret_cast<float *>(weights->buffer().as<uint8_t *>());
+        fill_data_sine(w, SC * (DC + SC) + SC, 0, 0.5, 1);
+        net_reader.SetWeights(weights);
+
+        src_data = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, T, DC},
+                                                             InferenceEngine::CHW});
+        src_data->allocate();
+        src_state = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, SC},
+                                                              InferenceEngine::NC});
+        src_state->allocate();
+        fill_data_sine(src_state->buffer(), SC, 0.3, 0.2, 1);
+        srcs["in_data"] = src_data;
+        srcs["in_state"] = src_state;
+
+        for (auto &item : net_reader.getNetwork().getOutputsInfo()) {
+            InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(
+                    item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+            (item.second->getTensorDesc().getDims().size() == 3 ? dst_seq : dst_state) = output;
+        }
+        ASSERT_NE(nullptr, dst_seq);
+        ASSERT_NE(nullptr, dst_state);
+    }
+
+    void fillFrames(int chunk) {
+        fill_data_sine(src_data->buffer(), T * DC, chunk, 0.4, 0.7);
+    }
+
+    // h = tanh(W * x + R * h + B) for the frames of the source blob
+    std::vector<float> refFrames(std::vector<float> &state) {
+        const float *w = reinterpret_cast<float *>(weights->buffer().as<uint8_t *>());
+        const float *b = w + SC * (DC + SC);
+        const float *x = src_data->buffer();
+        std::vector<float> seq;
+        for (size_t t = 0; t < T; t++) {
+            std::vector<float> next(SC);
+            for (size_t o = 0; o < SC; o++) {
+                float acc = b[o];
+                for (size_t i = 0; i < DC; i++)
+                    acc += w[o * (DC + SC) + i] * x[t * DC + i];
+                for (size_t i = 0; i < SC; i++)
+                    acc += w[o * (DC + SC) + DC + i] * state[i];
+                next[o] = std::tanh(acc);
+            }
+            state = next;
+            seq.insert(seq.end(), next.begin(), next.end());
+        }
+        return seq;
+    }
+
+    void compare(const std::vector<float> &ref_seq, const std::vector<float> &ref_state) {
+        const float *seq = dst_seq->buffer().as<float *>();
+        const float *state = dst_state->buffer().as<float *>();
+        for (size_t i = 0; i < ref_seq.size(); i++)
+            ASSERT_NEAR(ref_seq[i], seq[i], 1e-5) << "sequence element " << i;
+        for (size_t i = 0; i < ref_state.size(); i++)
+            ASSERT_NEAR(ref_state[i], state[i], 1e-5) << "state element " << i;
+    }
+
+    std::shared_ptr<MKLDNNPlugin::MKLDNNRNN> findRNN(MKLDNNGraphTestClass &graph) {
+        for (auto &node : graph.getNodes()) {
+            if (node->getType() == MKLDNNPlugin::RNNSeq)
+                return std::dynamic_pointer_cast<MKLDNNPlugin::MKLDNNRNN>(node);
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(MKLDNNGraphRNNStateTests, TestsPersistentStateContinuesSequence) {
+    MKLDNNPlugin::Config config;
+    config.rnnPersistentState = true;
+    MKLDNNGraphTestClass graph;
+    graph.setConfig(config);
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+    auto rnn = findRNN(graph);
+    ASSERT_NE(nullptr, rnn);
+    ASSERT_TRUE(rnn->hasPersistentState());
+
+    const float *init = src_state->buffer();
+    std::vector<float> state(init, init + SC);
+    for (int chunk = 0; chunk < 3; chunk++) {
+        fillFrames(chunk);
+        ASSERT_NO_THROW(graph.Infer(srcs, outputBlobs));
+        auto ref_seq = refFrames(state);
+        compare(ref_seq, state);
+        // the initial state input is ignored until the reset
+        fill_data_sine(src_state->buffer(), SC, chunk + 1, 0.5, 1);
+    }
+}
+
+TEST_F(MKLDNNGraphRNNStateTests, TestsMemoryStateResetsAndSetsState) {
+    MKLDNNPlugin::Config config;
+    config.rnnPersistentState = true;
+    MKLDNNGraphTestClass graph;
+    graph.setConfig(config);
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+    MKLDNNPlugin::MKLDNNRNNMemoryState memoryState("rnn", {findRNN(graph)});
+    ASSERT_EQ("rnn", memoryState.GetName());
+
+    fillFrames(0);
+    ASSERT_NO_THROW(graph.Infer(srcs, outputBlobs));
+    ASSERT_NO_THROW(graph.Infer(srcs, outputBlobs));
+
+    InferenceEngine::Blob::CPtr last = memoryState.GetLastState();
+    ASSERT_EQ(InferenceEngine::SizeVector({1, 1, SC}), last->getTensorDesc().getDims());
+    const float *last_data = last->cbuffer().as<const float *>();
+    const float *output_state = dst_state->buffer().as<float *>();
+    for (size_t i = 0; i < SC; i++)
+        ASSERT_FLOAT_EQ(output_state[i], last_data[i]);
+
+    // the reset starts from the initial state input again
+    memoryState.Reset();
+    const float *init = src_state->buffer();
+    std::vector<float> state(init, init + SC);
+    ASSERT_NO_THROW(graph.Infer(srcs, outputBlobs));
+    auto ref_seq = refFrames(state);
+    compare(ref_seq, state);
+
+    InferenceEngine::Blob::Ptr newState = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, {1, 1, SC}, InferenceEngine::CHW});
+    newState->allocate();
+    fill_data_sine(newState->buffer(), SC, 0.1, 0.9, 1);
+    memoryState.SetState(newState);
+    const float *new_data = newState->buffer();
+    state.assign(new_data, new_data + SC);
+    ASSERT_NO_THROW(graph.Infer(srcs, outputBlobs));
+    ref_seq = refFrames(state);
+    compare(ref_seq, state);
+
+    InferenceEngine::Blob::Ptr wrongState = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, {2, SC}, InferenceEngine::NC});
+    wrongState->allocate();
+    ASSERT_THROW(memoryState.SetState(wrongState), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNGraphRNNStateTests, TestsStateIsNotKeptByDefault) {
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+    ASSERT_FALSE(findRNN(graph)->hasPersistentState());
+
+    fillFrames(0);
+    for (int inference = 0; inference < 2; inference++) {
+        const float *init = src_state->buffer();
+        std::vector<float> state(init, init + SC);
+        ASSERT_NO_THROW(graph.Infer(srcs, outputBlobs));
+        auto ref_seq = refFrames(state);
+        compare(ref_seq, state);
+    }
+}
+
+class MKLDNNGraphRNNSeqLengthsTests: public TestsCommon {
+protected:
+    static const size_t N = 3;
+    static const size_t T = 4;
+    static const size_t DC = 5;
+    static const size_t SC = 4;
+
+    // the vanilla RNN sequence of the batch with the lengths of the sequences
+    std::string model = R"V0G0N(
+<net batch="3" name="RNN_Seq_Lengths" version="5">
+    <layers>
+        <layer id="0" name="in_data" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="in_state" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>3</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="in_lengths" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="rnn" precision="FP32" type="RNNSequence">
+            <data hidden_size="4" axis="1" direction="Forward" activations="tanh"/>
+            <input>
+                <port id="0">
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>5</dim>
+                </port>
+                <port id="1">
+                    <dim>3</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="2">
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="4">
+                    <dim>3</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <blobs>
+                <weights offset="0" size="144"/>
+                <biases offset="144" size="16"/>
+            </blobs>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="0" to-layer="3" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    InferenceEngine::TBlob<uint8_t>::Ptr weights;
+    InferenceEngine::Blob::Ptr src_data, src_state, src_lengths;
+    InferenceEngine::BlobMap srcs, outputBlobs;
+    InferenceEngine::Blob::Ptr dst_seq, dst_state;
+
+    virtual void SetUp() {
+        TestsCommon::SetUp();
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+        weights = InferenceEngine::TBlob<uint8_t>::Ptr(new InferenceEngine::TBlob<uint8_t>(
+                InferenceEngine::Precision::U8, InferenceEngine::C, {(SC * (DC + SC) + SC) * sizeof(float)}));
+        weights->allocate();
+        float *w = reinterpret_cast<float *>(weights->buffer().as<uint8_t *>());
+        fill_data_sine(w, SC * (DC + SC) + SC, 0, 0.5, 1);
+        net_reader.SetWeights(weights);
+
+        src_data = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {N, T, DC},
+                                                             InferenceEngine::CHW});
+        src_data->allocate();
+        fill_data_sine(src_data->buffer(), N * T * DC, 0.1, 0.4, 0.7);
+        src_state = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {N, SC},
+                                                              InferenceEngine::NC});
+        src_state->allocate();
+        fill_data_sine(src_state->buffer(), N * SC, 0.3, 0.2, 1);
+        src_lengths = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {N},
+                                                                InferenceEngine::C});
+        src_lengths->allocate();
+        srcs["in_data"] = src_data;
+        srcs["in_state"] = src_state;
+        srcs["in_lengths"] = src_lengths;
+
+        for (auto &item : net_reader.getNetwork().getOutputsInfo()) {
+            InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(
+                    item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+            (item.second->getTensorDesc().getDims().size() == 3 ? dst_seq : dst_state) = output;
+        }
+    }
+
+    // h = tanh(W * x + R * h + B) for the steps of the sequence n, the steps beyond the length are zeros
+    void checkSequence(size_t n, size_t length) {
+        const float *w = reinterpret_cast<float *>(weights->buffer().as<uint8_t *>());
+        const float *b = w + SC * (DC + SC);
+        const float *x = src_data->buffer().as<float *>() + n * T * DC;
+        const float *seq = dst_seq->buffer().as<float *>() + n * T * SC;
+        const float *init = src_state->buffer().as<float *>() + n * SC;
+        std::vector<float> state(init, init + SC);
+        for (size_t t = 0; t < T; t++) {
+            std::vector<float> next(SC, 0.f);
+            if (t < length) {
+                for (size_t o = 0; o < SC; o++) {
+                    float acc = b[o];
+                    for (size_t i = 0; i < DC; i++)
+                        acc += w[o * (DC + SC) + i] * x[t * DC + i];
+                    for (size_t i = 0; i < SC; i++)
+                        acc += w[o * (DC + SC) + DC + i] * state[i];
+                    next[o] = std::tanh(acc);
+                }
+                state = next;
+            }
+            for (size_t o = 0; o < SC; o++)
+                ASSERT_NEAR(next[o], seq[t * SC + o], 1e-5) << "sequence " << n << " step " << t;
+        }
+        const float *last = dst_state->buffer().as<float *>() + n * SC;
+        for (size_t o = 0; o < SC; o++)
+            ASSERT_NEAR(state[o], last[o], 1e-5) << "state of sequence " << n;
+    }
+};
+
+TEST_F(MKLDNNGraphRNNSeqLengthsTests, TestsStepsBeyondLengthsAreNotComputed) {
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    const std::vector<std::vector<float>> batches = {{4, 4, 4}, {2, 4, 0}, {1, 3, 1}};
+    for (const auto &lengths : batches) {
+        std::copy(lengths.begin(), lengths.end(), src_lengths->buffer().as<float *>());
+        ASSERT_NO_THROW(graph.Infer(srcs, outputBlobs));
+        for (size_t n = 0; n < N; n++)
+            checkSequence(n, static_cast<size_t>(lengths[n]));
+    }
+}
@@ -0,0 +1,438 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct tensoriterator_test_params {
+    // the batch, the sequence is iterated along the axis 1
+    size_t n;
+    size_t seq;
+    size_t size;
+    int stride;
+};
+
+class MKLDNNGraphTensorIteratorTests: public TestsCommon,
+                                      public WithParamInterface<tensoriterator_test_params> {
+    // the cumulative sum of the sequence starting from the bias, the sum of all the sequence is the second output
+    std::string model_t = R"V0G0N(
+<net batch="1" name="Sum_TI" version="4">
+    <layers>
+        <layer id="0" name="input" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_SEQ_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="Bias" precision="FP32" type="Const">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="0" size="_BS_"/>
+            </blobs>
+        </layer>
+        <layer id="2" name="SumTI" precision="FP32" type="TensorIterator">
+            <input>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_SEQ_</dim>
+                    <dim>_S_</dim>
+                </port>
+                <port id="1">
+                    <dim>_N_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_N_</dim>
+                    <dim>_SEQ_</dim>
+                    <dim>_S_</dim>
+                </port>
+                <port id="4">
+                    <dim>_N_</dim>
+                    <dim>_S_</dim>
+                </port>
+            </output>
+            <port_map>
+                <input  external_port_id="0" internal_layer_id="0" internal_port_id="0" axis="1" stride="_STRIDE_"/>
+                <input  external_port_id="1" internal_layer_id="1" internal_port_id="1"/>
+                <output external_port_id="3" internal_layer_id="2" internal_port_id="1" axis="1" stride="_STRIDE_"/>
+                <output external_port_id="4" internal_layer_id="1" internal_port_id="2"/>
+            </port_map>
+            <back_edges>
+                <edge from-layer="1" from-port="2" to-layer="1" to-port="1"/>
+            </back_edges>
+            <body>
+                <layers>
+                    <layer id="0" name="TI_reshape_in" precision="FP32" type="Reshape">
+                        <data axis="0" dim="_N_,_S_" num_axes="-1"/>
+                        <input>
+                            <port id="0">
+                                <dim>_N_</dim>
+                                <dim>1</dim>
+                                <dim>_S_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>_N_</dim>
+                                <dim>_S_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer id="1" name="TI_sum" precision="FP32" type="Eltwise">
+                        <data operation="sum"/>
+                        <input>
+                            <port id="0">
+                                <dim>_N_</dim>
+                                <dim>_S_</dim>
+                            </port>
+                            <port id="1">
+                                <dim>_N_</dim>
+                                <dim>_S_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="2">
+                                <dim>_N_</dim>
+                                <dim>_S_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer id="2" name="TI_reshape_out" precision="FP32" type="Reshape">
+                        <data axis="0" dim="_N_,1,_S_" num_axes="-1"/>
+                        <input>
+                            <port id="0">
+                                <dim>_N_</dim>
+                                <dim>_S_</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>_N_</dim>
+                                <dim>1</dim>
+                                <dim>_S_</dim>
+                            </port>
+                        </output>
+                    </layer>
+                </layers>
+                <edges>
+                    <edge from-layer="0" from-port="1" to-layer="1" to-port="0"/>
+                    <edge from-layer="1" from-port="2" to-layer="2" to-port="0"/>
+                </edges>
+            </body>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(tensoriterator_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_N_", p.n);
+        REPLACE_WITH_NUM(model, "_SEQ_", p.seq);
+        REPLACE_WITH_NUM(model, "_S_", p.size);
+        REPLACE_WITH_NUM(model, "_BS_", p.n * p.size * sizeof(float));
+        REPLACE_WITH_NUM(model, "_STRIDE_", p.stride);
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            tensoriterator_test_params p = ::testing::WithParamInterface<tensoriterator_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            const size_t stateSize = p.n * p.size;
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(
+                    InferenceEngine::Precision::U8, InferenceEngine::C, {stateSize * sizeof(float)});
+            weights->allocate();
+            fill_data(reinterpret_cast<float *>(weights->buffer().as<uint8_t *>()), stateSize);
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            bool found = false;
+            for (auto &node : graph.getNodes())
+                found |= node->getType() == MKLDNNPlugin::TensorIterator;
+            ASSERT_TRUE(found);
+
+            InferenceEngine::SizeVector dims_src = {p.n, p.seq, p.size};
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
+                    InferenceEngine::Precision::FP32, InferenceEngine::CHW, dims_src);
+            src->allocate();
+            fill_data(src->buffer(), src->size());
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("input", src));
+
+            InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            ASSERT_EQ(2, out.size());
+            InferenceEngine::BlobMap outputBlobs;
+            for (auto &item : out) {
+                InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(
+                        item.second->getTensorDesc());
+                output->allocate();
+                outputBlobs[item.first] = output;
+            }
+
+            // the state is initialized from the bias on each inference
+            for (int inference = 0; inference < 2; inference++) {
+                graph.Infer(srcs, outputBlobs);
+
+                const float *bias = reinterpret_cast<float *>(weights->buffer().as<uint8_t *>());
+                const float *src_data = src->buffer();
+                std::vector<float> state(bias, bias + stateSize);
+                std::vector<float> ref_seq(src->size());
+                for (size_t i = 0; i < p.seq; i++) {
+                    const size_t t = p.stride > 0 ? i : p.seq - 1 - i;
+                    for (size_t n = 0; n < p.n; n++) {
+                        for (size_t s = 0; s < p.size; s++) {
+                            state[n * p.size + s] += src_data[(n * p.seq + t) * p.size + s];
+                            ref_seq[(n * p.seq + t) * p.size + s] = state[n * p.size + s];
+                        }
+                    }
+                }
+
+                InferenceEngine::Blob::Ptr dst_seq, dst_state;
+                for (auto &output : outputBlobs)
+                    (output.second->getTensorDesc().getDims().size() == 3 ? dst_seq : dst_state) = output.second;
+                ASSERT_NE(nullptr, dst_seq);
+                ASSERT_NE(nullptr, dst_state);
+                ASSERT_EQ(ref_seq.size(), dst_seq->size());
+                ASSERT_EQ(state.size(), dst_state->size());
+                const float *seq_data = dst_seq->buffer().as<float *>();
+                const float *state_data = dst_state->buffer().as<float *>();
+                for (size_t i = 0; i < ref_seq.size(); i++)
+                    ASSERT_NEAR(ref_seq[i], seq_data[i], 1e-5) << "sequence element " << i;
+                for (size_t i = 0; i < state.size(); i++)
+                    ASSERT_NEAR(state[i], state_data[i], 1e-5) << "state element " << i;
+            }
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphTensorIteratorTests, TestsTensorIterator) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsTensorIterator, MKLDNNGraphTensorIteratorTests,
+        ::testing::Values(
+                // the contiguous chunks are bound to the body
+                tensoriterator_test_params{1, 5, 16, 1},
+                tensoriterator_test_params{1, 5, 16, -1},
+                // the chunks of several rows are copied
+                tensoriterator_test_params{2, 5, 16, 1},
+                tensoriterator_test_params{3, 4, 8, -1}));
+
+class MKLDNNGraphTensorIteratorStateTests: public TestsCommon {
+protected:
+    // the scaled sequence and the sum of the sequence, the state is written by the body directly
+    std::string model = R"V0G0N(
+<net batch="1" name="State_TI" version="4">
+    <layers>
+        <layer id="0" name="input" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>6</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="Bias" precision="FP32" type="Const">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="0" size="32"/>
+            </blobs>
+        </layer>
+        <layer id="2" name="StateTI" precision="FP32" type="TensorIterator">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>6</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>6</dim>
+                    <dim>8</dim>
+                </port>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+            <port_map>
+                <input  external_port_id="0" internal_layer_id="0" internal_port_id="0" axis="1"/>
+                <input  external_port_id="0" internal_layer_id="2" internal_port_id="0" axis="1"/>
+                <input  external_port_id="1" internal_layer_id="1" internal_port_id="0"/>
+                <output external_port_id="3" internal_layer_id="2" internal_port_id="1" axis="1"/>
+                <output external_port_id="4" internal_layer_id="1" internal_port_id="2"/>
+            </port_map>
+            <back_edges>
+                <edge from-layer="1" from-port="2" to-layer="1" to-port="0"/>
+            </back_edges>
+            <body>
+                <layers>
+                    <layer id="0" name="TI_reshape_in" precision="FP32" type="Reshape">
+                        <data axis="0" dim="1,8" num_axes="-1"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>8</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>8</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer id="1" name="TI_sum" precision="FP32" type="Eltwise">
+                        <data operation="sum"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>8</dim>
+                            </port>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>8</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="2">
+                                <dim>1</dim>
+                                <dim>8</dim>
+                            </port>
+                        </output>
+                    </layer>
+                    <layer id="2" name="TI_scale" precision="FP32" type="Power">
+                        <data power="1" scale="2" shift="0"/>
+                        <input>
+                            <port id="0">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>8</dim>
+                            </port>
+                        </input>
+                        <output>
+                            <port id="1">
+                                <dim>1</dim>
+                                <dim>1</dim>
+                                <dim>8</dim>
+                            </port>
+                        </output>
+                    </layer>
+                </layers>
+                <edges>
+                    <edge from-layer="0" from-port="1" to-layer="1" to-port="1"/>
+                </edges>
+            </body>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+};
+
+TEST_F(MKLDNNGraphTensorIteratorStateTests, TestsTensorIteratorBoundState) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(
+            InferenceEngine::Precision::U8, InferenceEngine::C, {8 * sizeof(float)});
+    weights->allocate();
+    float *bias = reinterpret_cast<float *>(weights->buffer().as<uint8_t *>());
+    fill_data(bias, 8);
+    net_reader.SetWeights(InferenceEngine::TBlob<uint8_t>::Ptr(weights));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
+            InferenceEngine::Precision::FP32, InferenceEngine::CHW, {1, 6, 8});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+    InferenceEngine::BlobMap srcs;
+    srcs["input"] = src;
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    InferenceEngine::BlobMap outputBlobs;
+    InferenceEngine::Blob::Ptr dst_seq, dst_state;
+    for (auto &item : out) {
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(
+                item.second->getTensorDesc());
+        output->allocate();
+        outputBlobs[item.first] = output;
+        (item.second->getTensorDesc().getDims().size() == 3 ? dst_seq : dst_state) = output;
+    }
+    ASSERT_NE(nullptr, dst_seq);
+    ASSERT_NE(nullptr, dst_state);
+
+    for (int inference = 0; inference < 2; inference++) {
+        ASSERT_NO_THROW(graph.Infer(srcs, outputBlobs));
+
+        const float *src_data = src->buffer();
+        const float *seq_data = dst_seq->buffer().as<float *>();
+        const float *state_data = dst_state->buffer().as<float *>();
+        for (size_t i = 0; i < src->size(); i++)
+            ASSERT_NEAR(2 * src_data[i], seq_data[i], 1e-5) << "sequence element " << i;
+        for (size_t s = 0; s < 8; s++) {
+            float ref = bias[s];
+            for (size_t t = 0; t < 6; t++)
+                ref += src_data[t * 8 + s];
+            ASSERT_NEAR(ref, state_data[s], 1e-5) << "state element " << s;
+        }
+    }
+}
@@ -0,0 +1,327 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+#include <cmath>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct eltwise_chain_fusing_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    // the chain starts with ScaleShift if true, with ELU otherwise
+    bool depthwiseHead;
+    bool isBroadcast;
+
+    std::vector<MKLDNNPlugin::impl_desc_type> preferTypes;
+};
+
+// head -> ReLU(negative_slope = 0.1) -> Power(power = 2, scale = 0.5, shift = 1) -> ScaleShift
+template <typename data_t>
+void ref_eltwise_chain(const InferenceEngine::TBlob<data_t> &src, const data_t *weights,
+                       InferenceEngine::TBlob<data_t> &dst, eltwise_chain_fusing_test_params& prm) {
+    size_t C = prm.in.c;
+    size_t SP = prm.in.h * prm.in.w;
+
+    const data_t *src_data = src.readOnly();
+    data_t *dst_data = dst.data();
+
+    const data_t *h_weights = weights;
+    const data_t *h_bias = weights + C;
+    const data_t *d_weights = weights + 2 * C;
+    const data_t *d_bias = d_weights + (prm.isBroadcast ? 1 : C);
+
+    for (size_t n = 0; n < prm.in.n; n++) {
+        for (size_t c = 0; c < C; c++) {
+            for (size_t sp = 0; sp < SP; sp++) {
+                size_t idx = (n * C + c) * SP + sp;
+                data_t x = src_data[idx];
+
+                if (prm.depthwiseHead)
+                    x = x * h_weights[c] + h_bias[c];
+                else
+                    x = x > 0 ? x : std::exp(x) - 1;
+
+                x = x > 0 ? x : x * 0.1f;
+                x = (x * 0.5f + 1.0f) * (x * 0.5f + 1.0f);
+
+                size_t dc = prm.isBroadcast ? 0 : c;
+                dst_data[idx] = x * d_weights[dc] + d_bias[dc];
+            }
+        }
+    }
+}
+
+class MKLDNNGraphEltwiseChainFusingTests: public TestsCommon,
+                                          public WithParamInterface<eltwise_chain_fusing_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="Eltwise_Chain" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        _HEAD_
+        <layer name="relu" id="2" type="ReLU" precision="FP32">
+            <data negative_slope="0.1"/>
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" id="3" type="Power" precision="FP32">
+            <power_data power="2" scale="0.5" shift="1"/>
+            <input>
+                <port id="5">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="6">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="scaleshift" id="4" type="ScaleShift" precision="FP32">
+            <data broadcast="_BROADCAST_"/>
+            <weights offset="_D_S0_" size="_D_S1_" />
+            <biases offset="_D_S2_" size="_D_S1_" />
+            <input>
+                <port id="7">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="8">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="7"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string scaleshift_head_t = R"V0G0N(
+        <layer name="head" id="1" type="ScaleShift" precision="FP32">
+            <data broadcast="0" PrimitivesPriority="_IMPLS_"/>
+            <weights offset="0" size="_H_S1_" />
+            <biases offset="_H_S1_" size="_H_S1_" />
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string elu_head_t = R"V0G0N(
+        <layer name="head" id="1" type="ELU" precision="FP32">
+            <data alpha="1.0" PrimitivesPriority="_IMPLS_"/>
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+protected:
+    std::string getModel(eltwise_chain_fusing_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_STR(model, "_HEAD_", p.depthwiseHead ? scaleshift_head_t : elu_head_t);
+
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        size_t h_data_size = p.in.c * sizeof(float);
+        size_t d_data_size = (p.isBroadcast ? 1 : p.in.c) * sizeof(float);
+        REPLACE_WITH_NUM(model, "_H_S1_", h_data_size);
+        REPLACE_WITH_NUM(model, "_D_S0_", 2 * h_data_size);
+        REPLACE_WITH_NUM(model, "_D_S1_", d_data_size);
+        REPLACE_WITH_NUM(model, "_D_S2_", 2 * h_data_size + d_data_size);
+        REPLACE_WITH_NUM(model, "_BROADCAST_", p.isBroadcast ? 1 : 0);
+
+        std::string impls;
+        for (const auto& preferType : p.preferTypes) {
+            if (!impls.empty())
+                impls += ",";
+            impls += "cpu:" + MKLDNNGraphTestClass::getStrPrimitiveDescriptorType(preferType);
+        }
+        REPLACE_WITH_STR(model, "_IMPLS_", impls);
+
+        return model;
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            eltwise_chain_fusing_test_params p = ::testing::WithParamInterface<eltwise_chain_fusing_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t weights_size = 2 * p.in.c + 2 * (p.isBroadcast ? 1 : p.in.c);
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8, InferenceEngine::C, {weights_size * sizeof(float)});
+            weights->allocate();
+            fill_data_sine((float *) weights->buffer(), weights->size() / sizeof(float), 1, 2, 0.5);
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+
+            net_reader.SetWeights(weights_ptr);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            // the whole chain is one node if it starts with ScaleShift, otherwise the trailing ScaleShift stays
+            // separate, since the activation kernel does not know the channels
+            size_t activations = 0, depthwises = 0, powers = 0;
+            auto& nodes = graph.getNodes();
+            for (auto &node : nodes) {
+                if (node->getType() == MKLDNNPlugin::Activation) {
+                    activations++;
+                    ASSERT_EQ(2, node->getFusedWith().size());
+                } else if (node->getType() == MKLDNNPlugin::Depthwise) {
+                    depthwises++;
+                    ASSERT_EQ(p.depthwiseHead ? 3 : 0, node->getFusedWith().size());
+                } else if (node->getType() == MKLDNNPlugin::Power) {
+                    powers++;
+                }
+            }
+            ASSERT_EQ(p.depthwiseHead ? 0 : 1, activations);
+            ASSERT_EQ(1, depthwises);
+            ASSERT_EQ(0, powers);
+
+            InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+
+            InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src->allocate();
+            fill_data_sine(src->buffer().as<float *>(), src->size(), 0, 3, 0.3);
+
+            auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
+
+            if (srcPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+
+            ref_eltwise_chain(*srcPtr, (const float *)weights->buffer(), dst_ref, p);
+
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphEltwiseChainFusingTests, TestsEltwiseChainFusing) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsEltwiseChainFusing, MKLDNNGraphEltwiseChainFusingTests,
+        ::testing::Values(
+                eltwise_chain_fusing_test_params{{1, 32, 8, 8}, true, false},
+                eltwise_chain_fusing_test_params{{1, 32, 8, 8}, true, true},
+                eltwise_chain_fusing_test_params{{2, 3, 7, 9}, true, false},
+                eltwise_chain_fusing_test_params{{2, 3, 7, 9}, true, true},
+                eltwise_chain_fusing_test_params{{1, 20, 5, 5}, true, false},
+                eltwise_chain_fusing_test_params{{1, 32, 8, 8}, true, false, {MKLDNNPlugin::impl_desc_type::ref_any}},
+                eltwise_chain_fusing_test_params{{2, 3, 7, 9}, true, true, {MKLDNNPlugin::impl_desc_type::ref_any}},
+                eltwise_chain_fusing_test_params{{1, 32, 8, 8}, false, false},
+                eltwise_chain_fusing_test_params{{2, 3, 7, 9}, false, true},
+                eltwise_chain_fusing_test_params{{1, 32, 8, 8}, false, false, {MKLDNNPlugin::impl_desc_type::ref_any}}
+        ));
@@ -0,0 +1,268 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include "tests_common.hpp"
+#include <algorithm>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+class MKLDNNGraphExecPlanTestClass: public MKLDNNGraphTestClass {
+public:
+    std::vector<MKLDNNPlugin::MKLDNNNode *> getExecPlanNodes() {
+        std::vector<MKLDNNPlugin::MKLDNNNode *> nodes;
+        for (auto &step : execPlan)
+            nodes.push_back(step.node);
+        return nodes;
+    }
+};
+
+class MKLDNNGraphExecPlanTests: public TestsCommon {
+protected:
+    InferenceEngine::Blob::Ptr createBlob(const InferenceEngine::SizeVector &dims) {
+        InferenceEngine::Blob::Ptr blob = InferenceEngine::make_shared_blob<float>(
+                {InferenceEngine::Precision::FP32, dims, InferenceEngine::NCHW});
+        blob->allocate();
+        return blob;
+    }
+};
+
+TEST_F(MKLDNNGraphExecPlanTests, TestsBatchLimitSwitchedBetweenInferences) {
+    std::string model = R"V0G0N(
+<net batch="4" name="Pool_Power" version="2">
+    <layers>
+        <layer id="0" name="in1" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>4</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="pool" precision="FP32" type="Pooling">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="2" stride-y="2" pool-method="max"/>
+            <input>
+                <port id="0">
+                    <dim>4</dim>
+                    <dim>16</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>4</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="power" precision="FP32" type="Power">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="0">
+                    <dim>4</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>4</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+    const size_t MB = 4, C = 16, H = 8, W = 8, OH = 4, OW = 4;
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_ENABLED,
+                        InferenceEngine::PluginConfigParams::YES}});
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    auto src = createBlob({MB, C, H, W});
+    auto dst = createBlob({MB, C, OH, OW});
+    InferenceEngine::BlobMap srcs = {{"in1", src}};
+    InferenceEngine::BlobMap outputBlobs = {{"power", dst}};
+
+    // the limit changes back and forth, the nodes which derive something of it (as the reorders) must follow it
+    const std::vector<int> batches = {4, 2, 3, 2, 2, 1, 4};
+    for (size_t inference = 0; inference < batches.size(); inference++) {
+        const size_t batch = static_cast<size_t>(batches[inference]);
+        fill_data_sine(src->buffer().as<float *>(), src->size(), inference, 1, 0.3);
+        float *out = dst->buffer().as<float *>();
+        std::fill(out, out + dst->size(), -100.f);
+
+        graph.Infer(srcs, outputBlobs, batches[inference]);
+
+        const float *in = src->buffer().as<float *>();
+        for (size_t n = 0; n < MB; n++) {
+            for (size_t c = 0; c < C; c++) {
+                for (size_t oh = 0; oh < OH; oh++) {
+                    for (size_t ow = 0; ow < OW; ow++) {
+                        const float *window = in + ((n * C + c) * H + 2 * oh) * W + 2 * ow;
+                        float ref = std::max(std::max(window[0], window[1]), std::max(window[W], window[W + 1]));
+                        size_t idx = ((n * C + c) * OH + oh) * OW + ow;
+                        // the images beyond the limit are not copied to the output
+                        ASSERT_FLOAT_EQ(n < batch ? 2 * ref + 1 : -100.f, out[idx])
+                            << "inference " << inference << " batch " << batch << " image " << n;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphExecPlanTests, TestsSkippedNodesAreNotRun) {
+    std::string model = R"V0G0N(
+<net batch="1" name="Power_Reshape_SoftMax" version="2">
+    <layers>
+        <layer id="0" name="in1" precision="FP32" type="Input">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="power" precision="FP32" type="Power">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="reshape" precision="FP32" type="Reshape">
+            <data dim="1,48" axis="0" num_axes="-1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>48</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="softmax" precision="FP32" type="SoftMax">
+            <data axis="1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>48</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>48</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+        <edge from-layer="2" from-port="1" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+    MKLDNNGraphExecPlanTestClass graph;
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_PERF_COUNT, InferenceEngine::PluginConfigParams::YES}});
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    // the plan is the non-constant nodes doing work, the input and the reshape are skipped
+    auto plan = graph.getExecPlanNodes();
+    size_t skipped = 0;
+    for (auto &node : graph.getNodes()) {
+        bool inPlan = std::find(plan.begin(), plan.end(), node.get()) != plan.end();
+        ASSERT_EQ(!node->isConstant() && node->isExecutable(), inPlan) << node->getName();
+        if (node->getType() == MKLDNNPlugin::Input || node->getType() == MKLDNNPlugin::Reshape) {
+            ASSERT_FALSE(inPlan) << node->getName();
+            skipped++;
+        }
+    }
+    ASSERT_EQ(2, skipped);
+
+    auto src = createBlob({1, 3, 4, 4});
+    fill_data(src->buffer().as<float *>(), src->size());
+    InferenceEngine::BlobMap srcs = {{"in1", src}};
+    InferenceEngine::TBlob<float>::Ptr dst = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, {1, 48}, InferenceEngine::NC});
+    dst->allocate();
+    InferenceEngine::BlobMap outputBlobs = {{"softmax", dst}};
+    graph.Infer(srcs, outputBlobs);
+    graph.Infer(srcs, outputBlobs);
+
+    // the measured nodes are the executed ones, the skipped nodes are never run
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
+    graph.GetPerfData(perfMap);
+    for (auto &node : graph.getNodes()) {
+        if (std::find(plan.begin(), plan.end(), node.get()) != plan.end())
+            continue;
+        ASSERT_EQ(InferenceEngine::InferenceEngineProfileInfo::NOT_RUN, perfMap[node->getName()].status)
+            << node->getName();
+    }
+
+    // the output is still computed through the skipped reshape
+    InferenceEngine::TBlob<float> dst_ref({InferenceEngine::Precision::FP32, {1, 48}, InferenceEngine::NC});
+    dst_ref.allocate();
+    const float *in = src->buffer().as<float *>();
+    float *ref = dst_ref.data();
+    float maxValue = 2 * in[0] + 1, sum = 0;
+    for (size_t i = 0; i < 48; i++)
+        maxValue = std::max(maxValue, 2 * in[i] + 1);
+    for (size_t i = 0; i < 48; i++) {
+        ref[i] = std::exp(2 * in[i] + 1 - maxValue);
+        sum += ref[i];
+    }
+    for (size_t i = 0; i < 48; i++)
+        ref[i] /= sum;
+    compare(*dst, dst_ref);
+}
@@ -0,0 +1,439 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+#include <cmath>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct quantize_fusing_test_params {
+    enum producer_type { eltwise, pooling, concat, fc };
+
+    producer_type producer;
+    // the ranges of the quantize have one value per channel if true, one value for all channels otherwise
+    bool perChannel;
+};
+
+static const size_t IN = 1, IC = 8, IH = 8, IW = 8;
+static const size_t FC_OC = 16;
+static const int LEVELS = 5;
+
+// the same rounding as the quantize node, the ranges are given for every channel
+void ref_quantize(const InferenceEngine::TBlob<float> &src, InferenceEngine::TBlob<float> &dst,
+                  const std::vector<float> &ranges, size_t C) {
+    const float *src_data = src.readOnly();
+    float *dst_data = dst.data();
+    const float *il = &ranges[0], *ih = &ranges[C], *ol = &ranges[2 * C], *oh = &ranges[3 * C];
+    const float steps = static_cast<float>(LEVELS - 1);
+
+    size_t SP = src.size() / C;
+    for (size_t c = 0; c < C; c++) {
+        for (size_t sp = 0; sp < SP; sp++) {
+            size_t idx = c * SP + sp;
+            float x = src_data[idx];
+            if (x <= il[c])
+                dst_data[idx] = ol[c];
+            else if (x > ih[c])
+                dst_data[idx] = oh[c];
+            else
+                dst_data[idx] = roundf((x - il[c]) * (steps / (ih[c] - il[c]))) * ((oh[c] - ol[c]) / steps) + ol[c];
+        }
+    }
+}
+
+class MKLDNNGraphQuantizeFusingTests: public TestsCommon,
+                                      public WithParamInterface<quantize_fusing_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="Quantize_Fusing" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">_IDIMS_
+                </port>
+            </output>
+        </layer>
+        _PRODUCER_
+        _QUANTIZE_
+    </layers>
+    <edges>
+        _PRODUCER_EDGES_
+        _QUANTIZE_EDGES_
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string in2_t = R"V0G0N(
+        <layer name="in2" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">_IDIMS_
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string eltwise_t = R"V0G0N(
+        <layer name="prod" id="2" type="Eltwise" precision="FP32">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="0">_IDIMS_
+                </port>
+                <port id="1">_IDIMS_
+                </port>
+            </input>
+            <output>
+                <port id="2">_ODIMS_
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string pooling_t = R"V0G0N(
+        <layer name="prod" id="2" type="Pooling" precision="FP32">
+            <pooling_data kernel-x="2" kernel-y="2" pad-x="0" pad-y="0" stride-x="2" stride-y="2" pool-method="max"/>
+            <input>
+                <port id="0">_IDIMS_
+                </port>
+            </input>
+            <output>
+                <port id="2">_ODIMS_
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string relu_t = R"V0G0N(
+        <layer name="_NAME_" id="_ID_" type="ReLU" precision="FP32">
+            <input>
+                <port id="0">_IDIMS_
+                </port>
+            </input>
+            <output>
+                <port id="1">_IDIMS_
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string concat_t = R"V0G0N(
+        <layer name="prod" id="2" type="Concat" precision="FP32">
+            <concat_data axis="1"/>
+            <input>
+                <port id="0">_IDIMS_
+                </port>
+                <port id="1">_IDIMS_
+                </port>
+            </input>
+            <output>
+                <port id="2">_ODIMS_
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string fc_t = R"V0G0N(
+        <layer name="prod" id="2" type="InnerProduct" precision="FP32">
+            <fc out-size="_FC_OC_"/>
+            <weights offset="0" size="_FC_S1_"/>
+            <biases offset="_FC_S1_" size="_FC_S2_"/>
+            <input>
+                <port id="0">_IDIMS_
+                </port>
+            </input>
+            <output>
+                <port id="2">_ODIMS_
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string range_t = R"V0G0N(
+        <layer name="_NAME_" id="_ID_" type="Const" precision="FP32">
+            <output>
+                <port id="0">
+                    <dim>_RC_</dim>
+                </port>
+            </output>
+            <blobs>
+                <custom offset="_OFFSET_" size="_RS_"/>
+            </blobs>
+        </layer>
+)V0G0N";
+
+    std::string quantize_t = R"V0G0N(
+        <layer name="quantize" id="9" type="Quantize" precision="FP32">
+            <data levels="_LEVELS_"/>
+            <input>
+                <port id="0">_ODIMS_
+                </port>
+                <port id="1">
+                    <dim>_RC_</dim>
+                </port>
+                <port id="2">
+                    <dim>_RC_</dim>
+                </port>
+                <port id="3">
+                    <dim>_RC_</dim>
+                </port>
+                <port id="4">
+                    <dim>_RC_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5">_ODIMS_
+                </port>
+            </output>
+        </layer>
+)V0G0N";
+
+    std::string quantize_edges_t = R"V0G0N(
+        <edge from-layer="2" from-port="2" to-layer="9" to-port="0"/>
+        <edge from-layer="5" from-port="0" to-layer="9" to-port="1"/>
+        <edge from-layer="6" from-port="0" to-layer="9" to-port="2"/>
+        <edge from-layer="7" from-port="0" to-layer="9" to-port="3"/>
+        <edge from-layer="8" from-port="0" to-layer="9" to-port="4"/>
+)V0G0N";
+
+    static std::string dims(const InferenceEngine::SizeVector &values) {
+        std::string result;
+        for (auto value : values)
+            result += "\n                    <dim>" + std::to_string(value) + "</dim>";
+        return result;
+    }
+
+protected:
+    InferenceEngine::SizeVector getOutputDims(const quantize_fusing_test_params &p) {
+        switch (p.producer) {
+            case quantize_fusing_test_params::pooling: return {IN, IC, IH / 2, IW / 2};
+            case quantize_fusing_test_params::concat: return {IN, 2 * IC, IH, IW};
+            case quantize_fusing_test_params::fc: return {IN, FC_OC};
+            default: return {IN, IC, IH, IW};
+        }
+    }
+
+    bool hasSecondInput(const quantize_fusing_test_params &p) {
+        return p.producer == quantize_fusing_test_params::eltwise || p.producer == quantize_fusing_test_params::concat;
+    }
+
+    size_t getFcWeightsSize(const quantize_fusing_test_params &p) {
+        return p.producer == quantize_fusing_test_params::fc ? FC_OC * IC * IH * IW + FC_OC : 0;
+    }
+
+    size_t getRangeSize(const quantize_fusing_test_params &p) {
+        return p.perChannel ? getOutputDims(p)[1] : 1;
+    }
+
+    // the model without the quantize is the unfused reference, its output is the output of the producer
+    std::string getModel(const quantize_fusing_test_params &p, bool withQuantize) {
+        std::string model = model_t;
+        std::string producer, edges;
+        switch (p.producer) {
+            case quantize_fusing_test_params::eltwise:
+                producer = in2_t + eltwise_t;
+                edges = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+)V0G0N";
+                break;
+            case quantize_fusing_test_params::pooling:
+                producer = pooling_t;
+                edges = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+)V0G0N";
+                break;
+            case quantize_fusing_test_params::concat: {
+                std::string relu1 = relu_t, relu2 = relu_t;
+                REPLACE_WITH_STR(relu1, "_NAME_", "relu1");
+                REPLACE_WITH_NUM(relu1, "_ID_", 3);
+                REPLACE_WITH_STR(relu2, "_NAME_", "relu2");
+                REPLACE_WITH_NUM(relu2, "_ID_", 4);
+                producer = in2_t + relu1 + relu2 + concat_t;
+                edges = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="4" to-port="0"/>
+        <edge from-layer="3" from-port="1" to-layer="2" to-port="0"/>
+        <edge from-layer="4" from-port="1" to-layer="2" to-port="1"/>
+)V0G0N";
+                break;
+            }
+            case quantize_fusing_test_params::fc:
+                producer = fc_t;
+                edges = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+)V0G0N";
+                break;
+        }
+        REPLACE_WITH_STR(model, "_PRODUCER_EDGES_", edges);
+        REPLACE_WITH_STR(model, "_PRODUCER_", producer);
+
+        std::string quantize;
+        if (withQuantize) {
+            const char *names[] = {"input_low", "input_high", "output_low", "output_high"};
+            size_t rangeBytes = getRangeSize(p) * sizeof(float);
+            for (size_t i = 0; i < 4; i++) {
+                std::string range = range_t;
+                REPLACE_WITH_STR(range, "_NAME_", names[i]);
+                REPLACE_WITH_NUM(range, "_ID_", 5 + i);
+                REPLACE_WITH_NUM(range, "_OFFSET_", getFcWeightsSize(p) * sizeof(float) + i * rangeBytes);
+                REPLACE_WITH_NUM(range, "_RS_", rangeBytes);
+                quantize += range;
+            }
+            quantize += quantize_t;
+        }
+        REPLACE_WITH_STR(model, "_QUANTIZE_EDGES_", withQuantize ? quantize_edges_t : "");
+        REPLACE_WITH_STR(model, "_QUANTIZE_", quantize);
+
+        REPLACE_WITH_STR(model, "_IDIMS_", dims({IN, IC, IH, IW}));
+        REPLACE_WITH_STR(model, "_ODIMS_", dims(getOutputDims(p)));
+        REPLACE_WITH_NUM(model, "_RC_", getRangeSize(p));
+        REPLACE_WITH_NUM(model, "_LEVELS_", LEVELS);
+        REPLACE_WITH_NUM(model, "_FC_OC_", FC_OC);
+        REPLACE_WITH_NUM(model, "_FC_S1_", FC_OC * IC * IH * IW * sizeof(float));
+        REPLACE_WITH_NUM(model, "_FC_S2_", FC_OC * sizeof(float));
+
+        return model;
+    }
+
+    // the ranges of all channels, the broadcasted ones are stored in the weights once
+    std::vector<float> getRanges(const quantize_fusing_test_params &p) {
+        size_t C = getOutputDims(p)[1];
+        std::vector<float> ranges(4 * C);
+        for (size_t c = 0; c < C; c++) {
+            size_t rc = p.perChannel ? c : 0;
+            ranges[c] = -0.5f - 0.05f * rc;
+            ranges[C + c] = 0.5f + 0.05f * rc;
+            ranges[2 * C + c] = 0.f;
+            ranges[3 * C + c] = 1.f + 0.1f * rc;
+        }
+        return ranges;
+    }
+
+    InferenceEngine::TBlob<uint8_t>::Ptr getWeights(const quantize_fusing_test_params &p) {
+        size_t C = getOutputDims(p)[1];
+        size_t rangeSize = getRangeSize(p);
+        size_t fcSize = getFcWeightsSize(p);
+        InferenceEngine::TBlob<uint8_t>::Ptr weights = InferenceEngine::make_shared_blob<uint8_t>(
+                InferenceEngine::Precision::U8, InferenceEngine::C, {(fcSize + 4 * rangeSize) * sizeof(float)});
+        weights->allocate();
+        float *data = weights->buffer().as<float *>();
+        fill_data_sine(data, fcSize, 0, 0.05, 0.7);
+
+        auto ranges = getRanges(p);
+        for (size_t i = 0; i < 4; i++) {
+            for (size_t c = 0; c < rangeSize; c++)
+                data[fcSize + i * rangeSize + c] = ranges[i * C + c];
+        }
+        return weights;
+    }
+
+    InferenceEngine::Blob::Ptr infer(MKLDNNGraphTestClass &graph, InferenceEngine::CNNNetwork network,
+                                     const InferenceEngine::BlobMap &srcs) {
+        InferenceEngine::OutputsDataMap out = network.getOutputsInfo();
+        std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+        InferenceEngine::TBlob<float>::Ptr output;
+        output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        InferenceEngine::BlobMap outputBlobs;
+        outputBlobs[item.first] = output;
+
+        graph.Infer(srcs, outputBlobs);
+        return output;
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            quantize_fusing_test_params p = ::testing::WithParamInterface<quantize_fusing_test_params>::GetParam();
+            auto weights = getWeights(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            std::string model = getModel(p, true);
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+            net_reader.SetWeights(weights);
+
+            InferenceEngine::CNNNetReader ref_net_reader;
+            std::string ref_model = getModel(p, false);
+            ASSERT_NO_THROW(ref_net_reader.ReadNetwork(ref_model.data(), ref_model.length()));
+            ref_net_reader.SetWeights(weights);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            // the quantize is applied by the producer on its own output, the in-place concat stays possible
+            size_t quantizes = 0, producers = 0;
+            for (auto &node : graph.getNodes()) {
+                if (node->getType() == MKLDNNPlugin::Quantize) {
+                    quantizes++;
+                } else if (node->getName() == "prod") {
+                    producers++;
+                    ASSERT_EQ(1, node->getFusedWith().size());
+                    ASSERT_EQ(MKLDNNPlugin::Quantize, node->getFusedWith()[0]->getType());
+                    if (p.producer == quantize_fusing_test_params::concat) {
+                        bool hasInPlaceDescriptor = false;
+                        for (auto &pd : node->getSupportedPrimitiveDescriptors())
+                            hasInPlaceDescriptor |= pd.getConfig().inConfs[0].inPlace >= 0;
+                        ASSERT_TRUE(hasInPlaceDescriptor);
+                    }
+                }
+            }
+            ASSERT_EQ(0, quantizes);
+            ASSERT_EQ(1, producers);
+
+            InferenceEngine::SizeVector dims_src = {IN, IC, IH, IW};
+            InferenceEngine::BlobMap srcs;
+            for (auto &name : hasSecondInput(p) ? std::vector<std::string>{"in1", "in2"} : std::vector<std::string>{"in1"}) {
+                InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
+                        InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+                src->allocate();
+                fill_data_sine(src->buffer().as<float *>(), src->size(), 0, name == "in1" ? 1.0 : 0.7, name == "in1" ? 0.3 : 0.5);
+                srcs[name] = src;
+            }
+
+            auto output = infer(graph, net_reader.getNetwork(), srcs);
+
+            MKLDNNGraphTestClass ref_graph;
+            ref_graph.CreateGraph(ref_net_reader.getNetwork());
+            auto ref_output = infer(ref_graph, ref_net_reader.getNetwork(), srcs);
+            auto *refPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(ref_output.get());
+            if (refPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::TBlob<float> dst_ref(output->getTensorDesc());
+            dst_ref.allocate();
+            ref_quantize(*refPtr, dst_ref, getRanges(p), getOutputDims(p)[1]);
+
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphQuantizeFusingTests, TestsQuantizeFusing) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsQuantizeFusing, MKLDNNGraphQuantizeFusingTests,
+        ::testing::Values(
+                quantize_fusing_test_params{quantize_fusing_test_params::eltwise, false},
+                quantize_fusing_test_params{quantize_fusing_test_params::eltwise, true},
+                quantize_fusing_test_params{quantize_fusing_test_params::pooling, false},
+                quantize_fusing_test_params{quantize_fusing_test_params::pooling, true},
+                quantize_fusing_test_params{quantize_fusing_test_params::concat, false},
+                quantize_fusing_test_params{quantize_fusing_test_params::concat, true},
+                quantize_fusing_test_params{quantize_fusing_test_params::fc, false},
+                quantize_fusing_test_params{quantize_fusing_test_params::fc, true}
+        ));
@@ -8,6 +8,7 @@
 
 #include "single_layer_common.hpp"
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <mkldnn_plugin/mkldnn_tuning.h>
 #include "tests_common.hpp"
 #include "../test_graph.hpp"
 #include <ext_list.hpp>
@@ -6638,6 +6639,80 @@ TEST_F(MKLDNNGraphStructureTests, TestCreateGraphAllDataToConcat) {
     compare(*outputBlobs["concat"], *dstOut);
 }
 
+TEST_F(MKLDNNGraphStructureTests, TestCreateGraphAllDataToConcatWithInterLayerParallelism) {
+    using namespace InferenceEngine;
+    // Build the network.
+    Builder::Network netBuilder("");
+
+    // First input layer
+    idx_t inpId = netBuilder.addLayer(InferenceEngine::Builder::InputLayer("input").setPort(InferenceEngine::Port({1, 1, 4, 5})));
+
+    std::vector<size_t> weightsSize = {1, 1, 1, 1};  // OIHW
+    auto weights = make_shared_blob<float>(Precision::FP32, InferenceEngine::Layout::OIHW, weightsSize);
+    weights->allocate();
+
+    std::vector<float> twos(1, 2);
+    weights->set(twos);
+    idx_t weightsId = netBuilder.addLayer({}, Builder::ConstLayer("weights").setData(weights));
+
+    // Convolution layer
+    idx_t firstConvId = netBuilder.addLayer({{inpId}, {weightsId}}, Builder::ConvolutionLayer("conv").setKernel({1, 1})
+            .setStrides({1, 1}).setDilation({1, 1}).setPaddingsBegin({0, 0}).setPaddingsEnd({0, 0}).setGroup(1).setOutDepth(1));
+
+    weights = make_shared_blob<float>(Precision::FP32, InferenceEngine::Layout::OIHW, weightsSize);
+    weights->allocate();
+
+    std::vector<float> threes(1, 3);
+    weights->set(threes);
+
+    weightsId = netBuilder.addLayer({}, Builder::ConstLayer("weights").setData(weights));
+    // Convolution layer
+    idx_t secondConvId = netBuilder.addLayer({{inpId}, {weightsId}}, Builder::ConvolutionLayer("conv").setKernel({1, 1})
+            .setStrides({1, 1}).setDilation({1, 1}).setPaddingsBegin({0, 0}).setPaddingsEnd({0, 0}).setGroup(1).setOutDepth(1));
+
+    // Concat layer
+    idx_t concatId = netBuilder.addLayer({{inpId}, {firstConvId}, {secondConvId}},
+                                         InferenceEngine::Builder::ConcatLayer("concat").setAxis(1).setInputPorts(std::vector<InferenceEngine::Port>(3)));
+
+    // Output layer
+    InferenceEngine::Builder::OutputLayer outLayer("output");
+    netBuilder.addLayer({concatId}, outLayer);
+
+    auto cnn = CNNNetwork(Builder::convertToICNNNetwork(netBuilder.build()));
+
+    // Load the network
+    std::vector<size_t> inpSize = {5, 4, 1, 1};
+    std::vector<size_t> outSize = {5, 4, 3, 1};
+
+    InferenceEngine::BlobMap inputBlobs;
+    InferenceEngine::BlobMap outputBlobs;
+
+    std::vector<float> inpData(4*5, 1);
+    std::vector<float> outData(3*4*5, 1);
+    for (int i = 0; i < 4*5; ++i)
+    {
+        inpData[i] = i;
+    }
+
+    inputBlobs["input"] = InferenceEngine::make_shared_blob<float>(InferenceEngine::Precision::FP32, inpSize, &inpData[0]);
+    outputBlobs["concat"] = InferenceEngine::make_shared_blob<float>(InferenceEngine::Precision::FP32, outSize, &outData[0]);
+
+
+    // both convolutions are executed concurrently
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{PluginConfigParams::KEY_CPU_INTER_LAYER_PARALLELISM, PluginConfigParams::YES}});
+    graph.CreateGraph(cnn);
+    graph.Infer(inputBlobs, outputBlobs);
+
+    std::vector<float> refDst = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+                                 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38,
+                                 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45, 48, 51, 54, 57};
+
+    InferenceEngine::TBlob<float>::Ptr dstOut = InferenceEngine::make_shared_blob<float>(outputBlobs["concat"]->getTensorDesc(), refDst.data());
+
+    compare(*outputBlobs["concat"], *dstOut);
+}
+
 TEST_F(MKLDNNGraphStructureTests, TestCreateGraphAllDataFromInputToConcat) {
     using namespace InferenceEngine;
     // Build the network.
@@ -6736,4 +6811,426 @@ TEST_F(MKLDNNGraphStructureTests, TestCheckIncorrectScaleShift) {
 
     MKLDNNGraphTestClass graph;
     ASSERT_THROW(graph.CreateGraph(reader.getNetwork()), InferenceEngine::details::InferenceEngineException);
-}
\ No newline at end of file
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestGraphForShapesIsCachedAndInferred) {
+    std::string model = R"V0G0N(
+<net name="Power_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" id="1" type="Power" precision="FP32">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{InferenceEngine::PluginConfigParams::KEY_CPU_DYN_SHAPES_CACHE_SIZE, "1"}});
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    auto makeInput = [](InferenceEngine::SizeVector dims) {
+        InferenceEngine::Blob::Ptr blob = InferenceEngine::make_shared_blob<float>(
+                InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, dims, InferenceEngine::NCHW));
+        blob->allocate();
+        auto *data = blob->buffer().as<float *>();
+        for (size_t i = 0; i < blob->size(); i++) data[i] = static_cast<float>(i);
+        return InferenceEngine::BlobMap{{"data", blob}};
+    };
+
+    InferenceEngine::BlobMap loaded = makeInput({1, 3, 8, 8});
+    ASSERT_EQ(&graph, graph.getGraphForShapes(loaded));
+
+    InferenceEngine::BlobMap narrow = makeInput({1, 3, 8, 5});
+    MKLDNNPlugin::MKLDNNGraph *narrowGraph = graph.getGraphForShapes(narrow);
+    ASSERT_NE(&graph, narrowGraph);
+    ASSERT_EQ(narrowGraph, graph.getGraphForShapes(narrow));
+
+    // the network output blob is re-allocated with the new dims
+    InferenceEngine::BlobMap outputs = makeInput({1, 3, 8, 8});
+    outputs["power"] = outputs["data"];
+    outputs.erase("data");
+    InferenceEngine::OutputsDataMap networkOutputs = net_reader.getNetwork().getOutputsInfo();
+    MKLDNNPlugin::RequestBlobs requestBlobs;
+    narrowGraph->reshapeOutputBlobs(outputs, networkOutputs, requestBlobs);
+    ASSERT_EQ(InferenceEngine::SizeVector({1, 3, 8, 5}), outputs["power"]->getTensorDesc().getDims());
+
+    narrowGraph->PushInputData("data", narrow["data"]);
+    narrowGraph->Infer();
+    narrowGraph->PullOutputData(outputs);
+    const auto *src = narrow["data"]->cbuffer().as<const float *>();
+    const auto *dst = outputs["power"]->cbuffer().as<const float *>();
+    for (size_t i = 0; i < outputs["power"]->size(); i++)
+        ASSERT_FLOAT_EQ(src[i] * 2 + 1, dst[i]);
+
+    // the cache keeps the only shape, the new one evicts the previous
+    InferenceEngine::BlobMap wide = makeInput({1, 3, 4, 8});
+    ASSERT_NE(narrowGraph, graph.getGraphForShapes(wide));
+
+    InferenceEngine::BlobMap exceeding = makeInput({1, 3, 8, 9});
+    ASSERT_THROW(graph.getGraphForShapes(exceeding), InferenceEngine::details::InferenceEngineException);
+    InferenceEngine::BlobMap otherChannels = makeInput({1, 2, 8, 8});
+    ASSERT_THROW(graph.getGraphForShapes(otherChannels), InferenceEngine::details::InferenceEngineException);
+}
+
+static const std::string zeroCopyModel = R"V0G0N(
+<net name="Power_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" id="1" type="Power" precision="FP32">
+            <power_data power="1" scale="2" shift="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>8</dim>
+                    <dim>8</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+TEST_F(MKLDNNGraphStructureTests, TestZeroCopyCompatibleBlobs) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(zeroCopyModel.data(), zeroCopyModel.length()));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    InferenceEngine::TensorDesc nchw(InferenceEngine::Precision::FP32, {1, 3, 8, 8}, InferenceEngine::NCHW);
+    ASSERT_EQ(nchw.getBlockingDesc(), graph.getPreferredDesc("data").getBlockingDesc());
+    ASSERT_EQ(nchw.getBlockingDesc(), graph.getPreferredDesc("power").getBlockingDesc());
+    ASSERT_THROW(graph.getPreferredDesc("unknown"), InferenceEngine::details::InferenceEngineException);
+
+    InferenceEngine::Blob::Ptr planar = InferenceEngine::make_shared_blob<float>(nchw);
+    planar->allocate();
+    ASSERT_TRUE(graph.isZeroCopyCompatible("data", planar));
+    ASSERT_TRUE(graph.isZeroCopyCompatible("power", planar));
+
+    InferenceEngine::Blob::Ptr nhwc = InferenceEngine::make_shared_blob<float>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 3, 8, 8}, InferenceEngine::NHWC));
+    nhwc->allocate();
+    ASSERT_FALSE(graph.isZeroCopyCompatible("data", nhwc));
+
+    InferenceEngine::Blob::Ptr u8 = InferenceEngine::make_shared_blob<uint8_t>(
+            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {1, 3, 8, 8}, InferenceEngine::NCHW));
+    u8->allocate();
+    ASSERT_FALSE(graph.isZeroCopyCompatible("data", u8));
+
+    std::vector<float> buffer(planar->size() + 1);
+    auto *misaligned = reinterpret_cast<float *>(reinterpret_cast<uint8_t *>(buffer.data()) + 1);
+    InferenceEngine::Blob::Ptr shifted = InferenceEngine::make_shared_blob<float>(nchw, misaligned);
+    ASSERT_FALSE(graph.isZeroCopyCompatible("data", shifted));
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestInferWithBoundAndReorderedBlobs) {
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(zeroCopyModel.data(), zeroCopyModel.length()));
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), {}, {}));
+    InferenceEngine::InputsDataMap _networkInputs = net_reader.getNetwork().getInputsInfo();
+    InferenceEngine::OutputsDataMap _networkOutputs = net_reader.getNetwork().getOutputsInfo();
+    execNetwork->setNetworkInputs(_networkInputs);
+    execNetwork->setNetworkOutputs(_networkOutputs);
+
+    for (auto layout : {InferenceEngine::NCHW, InferenceEngine::NHWC}) {
+        InferenceEngine::IInferRequest::Ptr inferRequest;
+        execNetwork->CreateInferRequest(inferRequest);
+
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(
+                InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, {1, 3, 8, 8}, layout));
+        src->allocate();
+        InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(
+                _networkOutputs.begin()->second->getTensorDesc());
+        output->allocate();
+
+        InferenceEngine::ResponseDesc resp;
+        InferenceEngine::StatusCode sts = inferRequest->SetBlob("data", src, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+        sts = inferRequest->SetBlob(_networkOutputs.begin()->first.c_str(), output, &resp);
+        ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+        // the second inference reads the data updated in the same blob
+        for (float base : {0.f, 100.f}) {
+            auto *src_data = src->buffer().as<float *>();
+            for (size_t i = 0; i < src->size(); i++)
+                src_data[i] = base + static_cast<float>(i);
+
+            sts = inferRequest->Infer(&resp);
+            ASSERT_EQ(InferenceEngine::OK, sts) << resp.msg;
+
+            // the output is planar, the NHWC input is reordered
+            const float *dst_data = output->readOnly();
+            for (size_t c = 0; c < 3; c++) {
+                for (size_t hw = 0; hw < 64; hw++) {
+                    float ref = layout == InferenceEngine::NCHW ? src_data[c * 64 + hw] : src_data[hw * 3 + c];
+                    ASSERT_FLOAT_EQ(ref * 2 + 1, dst_data[c * 64 + hw]);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestDepthFirstChainIsEqualToLayerByLayer) {
+    using namespace InferenceEngine;
+    // conv -> relu -> pool -> conv at the resolution whose intermediates outgrow the caches
+    const size_t C = 16, H = 768, W = 768;
+    Builder::Network netBuilder("");
+    idx_t layerId = netBuilder.addLayer(Builder::InputLayer("input").setPort(Port({1, C, H, W})));
+
+    auto addConvolution = [&](const std::string &name, idx_t input) {
+        auto weights = make_shared_blob<float>(Precision::FP32, Layout::OIHW, {C, C, 3, 3});
+        weights->allocate();
+        fill_data(weights->buffer().as<float *>(), weights->size());
+        idx_t weightsId = netBuilder.addLayer({}, Builder::ConstLayer(name + "_weights").setData(weights));
+        return netBuilder.addLayer({{input}, {weightsId}}, Builder::ConvolutionLayer(name).setKernel({3, 3})
+                .setStrides({1, 1}).setDilation({1, 1}).setPaddingsBegin({1, 1}).setPaddingsEnd({1, 1})
+                .setGroup(1).setOutDepth(C));
+    };
+    layerId = addConvolution("conv1", layerId);
+    layerId = netBuilder.addLayer({{layerId}}, Builder::ReLULayer("relu"));
+    layerId = netBuilder.addLayer({{layerId}}, Builder::PoolingLayer("pool").setExcludePad(true).setKernel({2, 2})
+            .setStrides({2, 2}).setPaddingsBegin({0, 0}).setPaddingsEnd({0, 0})
+            .setPoolingType(Builder::PoolingLayer::PoolingType::MAX));
+    layerId = addConvolution("conv2", layerId);
+    netBuilder.addLayer({layerId}, Builder::OutputLayer("output"));
+
+    auto cnn = CNNNetwork(Builder::convertToICNNNetwork(netBuilder.build()));
+
+    TBlob<float>::Ptr src = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, C, H, W}, NCHW));
+    src->allocate();
+    fill_data(src->buffer().as<float *>(), src->size());
+    BlobMap inputBlobs = {{"input", src}};
+
+    std::vector<TBlob<float>::Ptr> outputs;
+    for (auto depthFirst : {PluginConfigParams::NO, PluginConfigParams::YES}) {
+        TBlob<float>::Ptr dst = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, C, H / 2, W / 2}, NCHW));
+        dst->allocate();
+        BlobMap outputBlobs = {{"conv2", dst}};
+
+        MKLDNNGraphTestClass graph;
+        graph.setProperty({{PluginConfigParams::KEY_CPU_DEPTH_FIRST, depthFirst}});
+        graph.CreateGraph(cnn);
+        graph.Infer(inputBlobs, outputBlobs);
+        outputs.push_back(dst);
+    }
+
+    compare(*outputs[1], *outputs[0]);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestTuningFileKeepsTheImplementationsOfConvolutions) {
+    using namespace InferenceEngine;
+    const size_t C = 16, H = 32, W = 32;
+    Builder::Network netBuilder("");
+    idx_t layerId = netBuilder.addLayer(Builder::InputLayer("input").setPort(Port({1, C, H, W})));
+
+    auto weights = make_shared_blob<float>(Precision::FP32, Layout::OIHW, {C, C, 3, 3});
+    weights->allocate();
+    fill_data(weights->buffer().as<float *>(), weights->size());
+    idx_t weightsId = netBuilder.addLayer({}, Builder::ConstLayer("conv_weights").setData(weights));
+    layerId = netBuilder.addLayer({{layerId}, {weightsId}}, Builder::ConvolutionLayer("conv").setKernel({3, 3})
+            .setStrides({1, 1}).setDilation({1, 1}).setPaddingsBegin({1, 1}).setPaddingsEnd({1, 1})
+            .setGroup(1).setOutDepth(C));
+    netBuilder.addLayer({layerId}, Builder::OutputLayer("output"));
+
+    auto cnn = CNNNetwork(Builder::convertToICNNNetwork(netBuilder.build()));
+
+    TBlob<float>::Ptr src = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, C, H, W}, NCHW));
+    src->allocate();
+    fill_data(src->buffer().as<float *>(), src->size());
+    BlobMap inputBlobs = {{"input", src}};
+
+    const std::string tuningFile = "mkldnn_tuning_test.txt";
+    std::remove(tuningFile.c_str());
+
+    std::vector<TBlob<float>::Ptr> outputs;
+    for (auto mode : {PluginConfigParams::TUNING_DISABLED, PluginConfigParams::TUNING_CREATE,
+                      PluginConfigParams::TUNING_USE_EXISTING}) {
+        TBlob<float>::Ptr dst = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, C, H, W}, NCHW));
+        dst->allocate();
+        BlobMap outputBlobs = {{"conv", dst}};
+
+        MKLDNNGraphTestClass graph;
+        graph.setProperty({{PluginConfigParams::KEY_TUNING_MODE, mode},
+                           {PluginConfigParams::KEY_TUNING_FILE, tuningFile}});
+        graph.CreateGraph(cnn);
+        graph.Infer(inputBlobs, outputBlobs);
+        outputs.push_back(dst);
+    }
+
+    // every line of the file is a key and the name of an implementation of this machine
+    std::ifstream file(tuningFile);
+    std::string line;
+    while (std::getline(file, line)) {
+        ASSERT_NE(std::string::npos, line.find('\t'));
+        ASSERT_EQ(0, line.find(MKLDNNPlugin::MKLDNNTuningCache::isaName() + ";"));
+    }
+    file.close();
+    std::remove(tuningFile.c_str());
+
+    compare(*outputs[1], *outputs[0]);
+    compare(*outputs[2], *outputs[0]);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestGraphsOfOneScratchArenaShareIntermediateData) {
+    using namespace InferenceEngine;
+    const size_t C = 8, W = 16;
+    auto createNetwork = [&](size_t H) {
+        Builder::Network netBuilder("");
+        idx_t layerId = netBuilder.addLayer(Builder::InputLayer("input").setPort(Port({1, C, H, W})));
+        for (std::string name : {"conv1", "conv2"}) {
+            auto weights = make_shared_blob<float>(Precision::FP32, Layout::OIHW, {C, C, 3, 3});
+            weights->allocate();
+            fill_data(weights->buffer().as<float *>(), weights->size());
+            idx_t weightsId = netBuilder.addLayer({}, Builder::ConstLayer(name + "_weights").setData(weights));
+            layerId = netBuilder.addLayer({{layerId}, {weightsId}}, Builder::ConvolutionLayer(name).setKernel({3, 3})
+                    .setStrides({1, 1}).setDilation({1, 1}).setPaddingsBegin({1, 1}).setPaddingsEnd({1, 1})
+                    .setGroup(1).setOutDepth(C));
+        }
+        netBuilder.addLayer({layerId}, Builder::OutputLayer("output"));
+        return CNNNetwork(Builder::convertToICNNNetwork(netBuilder.build()));
+    };
+    auto infer = [&](MKLDNNGraphTestClass &graph, size_t H) {
+        TBlob<float>::Ptr src = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, C, H, W}, NCHW));
+        src->allocate();
+        fill_data(src->buffer().as<float *>(), src->size());
+        TBlob<float>::Ptr dst = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, C, H, W}, NCHW));
+        dst->allocate();
+        BlobMap inputBlobs = {{"input", src}};
+        BlobMap outputBlobs = {{"conv2", dst}};
+        graph.Infer(inputBlobs, outputBlobs);
+        return dst;
+    };
+    auto intermediateData = [](MKLDNNGraphTestClass &graph) -> void * {
+        for (auto &node : graph.getNodes())
+            if (node->getName() == "conv2")
+                return node->getParentEdgeAt(0)->getMemory().GetData();
+        return nullptr;
+    };
+
+    const size_t smallH = 8, bigH = 32;
+    CNNNetwork smallNet = createNetwork(smallH), bigNet = createNetwork(bigH);
+    MKLDNNGraphTestClass smallRef, bigRef;
+    smallRef.CreateGraph(smallNet);
+    bigRef.CreateGraph(bigNet);
+
+    // the arena grows for the second graph, the first one follows it at the next inference
+    const std::map<std::string, std::string> arenaConfig = {{PluginConfigParams::KEY_CPU_SCRATCH_ARENA, "test_arena"}};
+    MKLDNNGraphTestClass smallGraph, bigGraph;
+    smallGraph.setProperty(arenaConfig);
+    smallGraph.CreateGraph(smallNet);
+    bigGraph.setProperty(arenaConfig);
+    bigGraph.CreateGraph(bigNet);
+
+    for (int i = 0; i < 2; i++) {
+        compare(*infer(smallGraph, smallH), *infer(smallRef, smallH));
+        compare(*infer(bigGraph, bigH), *infer(bigRef, bigH));
+    }
+    ASSERT_NE(nullptr, intermediateData(smallGraph));
+    ASSERT_EQ(intermediateData(smallGraph), intermediateData(bigGraph));
+    ASSERT_NE(intermediateData(smallRef), intermediateData(bigRef));
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestLayoutRefinementKeepsChainWithoutReorders) {
+    using namespace InferenceEngine;
+    const size_t C = 8, H = 16, W = 16;
+    Builder::Network netBuilder("");
+    idx_t layerId = netBuilder.addLayer(Builder::InputLayer("input").setPort(Port({1, C, H, W})));
+
+    auto addConvolution = [&](const std::string &name, idx_t input) {
+        auto weights = make_shared_blob<float>(Precision::FP32, Layout::OIHW, {C, C, 1, 1});
+        weights->allocate();
+        std::fill_n(weights->buffer().as<float *>(), weights->size(), 1.f);
+        idx_t weightsId = netBuilder.addLayer({}, Builder::ConstLayer(name + "_weights").setData(weights));
+        return netBuilder.addLayer({{input}, {weightsId}}, Builder::ConvolutionLayer(name).setKernel({1, 1})
+                .setStrides({1, 1}).setDilation({1, 1}).setPaddingsBegin({0, 0}).setPaddingsEnd({0, 0})
+                .setGroup(1).setOutDepth(C));
+    };
+    auto addPooling = [&](const std::string &name, idx_t input) {
+        return netBuilder.addLayer({{input}}, Builder::PoolingLayer(name).setExcludePad(true).setKernel({2, 2})
+                .setStrides({2, 2}).setPaddingsBegin({0, 0}).setPaddingsEnd({0, 0})
+                .setPoolingType(Builder::PoolingLayer::PoolingType::MAX));
+    };
+    layerId = addConvolution("conv1", layerId);
+    layerId = addPooling("pool1", layerId);
+    layerId = netBuilder.addLayer({{layerId}}, Builder::ReLULayer("relu"));
+    layerId = addPooling("pool2", layerId);
+    layerId = addConvolution("conv2", layerId);
+    netBuilder.addLayer({layerId}, Builder::OutputLayer("output"));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(CNNNetwork(Builder::convertToICNNNetwork(netBuilder.build())));
+
+    // the nodes of the chain agree on one layout, only the planar input and output are reordered
+    size_t reorders_num = 0;
+    for (auto &node : graph.getNodes()) {
+        if (node->getType() == MKLDNNPlugin::Reorder)
+            reorders_num++;
+    }
+    ASSERT_LE(reorders_num, 2);
+
+    TBlob<float>::Ptr src = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, C, H, W}, NCHW));
+    src->allocate();
+    std::fill_n(src->buffer().as<float *>(), src->size(), 1.f);
+    TBlob<float>::Ptr dst = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, C, H / 4, W / 4}, NCHW));
+    dst->allocate();
+    BlobMap inputBlobs = {{"input", src}};
+    BlobMap outputBlobs = {{"conv2", dst}};
+    graph.Infer(inputBlobs, outputBlobs);
+
+    const float *dst_data = dst->readOnly();
+    for (size_t i = 0; i < dst->size(); i++)
+        ASSERT_FLOAT_EQ(static_cast<float>(C * C), dst_data[i]) << "i = " << i;
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <mkldnn.hpp>
+#include <vector>
+
+using namespace ::testing;
+using namespace mkldnn;
+
+class MKLDNNJitKernelCacheTests : public ::testing::Test {
+protected:
+    virtual void TearDown() override {
+        mkldnn_set_jit_kernel_cache_capacity(256);
+    }
+
+    // 3x3 convolution of 16 channels with the unit weights and the zero padding
+    std::vector<float> convolve(const engine &eng, float value) {
+        memory::desc src_md({1, 16, 8, 8}, memory::f32, memory::nChw8c);
+        memory::desc wei_md({16, 16, 3, 3}, memory::f32, memory::OIhw8i8o);
+        memory::desc dst_md({1, 16, 8, 8}, memory::f32, memory::nChw8c);
+
+        convolution_forward::desc desc(prop_kind::forward_inference, convolution_direct,
+                                       src_md, wei_md, dst_md, {1, 1}, {1, 1}, {1, 1}, padding_kind::zero);
+        convolution_forward::primitive_desc pd(desc, eng);
+
+        std::vector<float> src(1 * 16 * 8 * 8, value), wei(16 * 16 * 3 * 3, 1.f), dst(1 * 16 * 8 * 8, 0.f);
+        memory src_mem({src_md, eng}, src.data());
+        memory wei_mem({wei_md, eng}, wei.data());
+        memory dst_mem({dst_md, eng}, dst.data());
+
+        convolution_forward conv(pd, src_mem, wei_mem, dst_mem);
+        stream(stream::kind::eager).submit({conv}).wait();
+        return dst;
+    }
+
+    void checkConvolution(const std::vector<float> &dst, float value) {
+        // nChw8c: the element (c, h, w) is at ((c / 8) * 8 * 8 + h * 8 + w) * 8 + c % 8
+        for (int h = 0; h < 8; h++) {
+            for (int w = 0; w < 8; w++) {
+                int kh = 3 - (h == 0) - (h == 7);
+                int kw = 3 - (w == 0) - (w == 7);
+                float expected = value * 16 * kh * kw;
+                for (int c = 0; c < 16; c++) {
+                    ASSERT_FLOAT_EQ(expected, dst[((c / 8) * 64 + h * 8 + w) * 8 + c % 8])
+                        << "c=" << c << " h=" << h << " w=" << w;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(MKLDNNJitKernelCacheTests, primitivesOfSameDescCanShareKernel) {
+    engine eng(engine::cpu, 0);
+    ASSERT_EQ(mkldnn_success, mkldnn_set_jit_kernel_cache_capacity(16));
+
+    // the second primitive takes the kernel of the first one, but works on its own memory
+    checkConvolution(convolve(eng, 1.f), 1.f);
+    checkConvolution(convolve(eng, 2.f), 2.f);
+}
+
+TEST_F(MKLDNNJitKernelCacheTests, canDisableCache) {
+    engine eng(engine::cpu, 0);
+    ASSERT_EQ(mkldnn_success, mkldnn_set_jit_kernel_cache_capacity(0));
+
+    checkConvolution(convolve(eng, 3.f), 3.f);
+}
+
+TEST_F(MKLDNNJitKernelCacheTests, returnsErrorOnNegativeCapacity) {
+    ASSERT_EQ(mkldnn_invalid_arguments, mkldnn_set_jit_kernel_cache_capacity(-1));
+}
@@ -0,0 +1,151 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <ie_plugin_config.hpp>
+#include <cpp/ie_cnn_net_reader.h>
+#include "mkldnn_plugin/mkldnn_model_serial.h"
+#include "mkldnn_plugin/mkldnn_plugin.h"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+class MKLDNNModelSerialTests : public ::testing::Test {
+protected:
+    std::string model = R"V0G0N(
+<Net Name="Power_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" id="1" type="Power" precision="FP32">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</Net>
+)V0G0N";
+};
+
+TEST_F(MKLDNNModelSerialTests, canExportAndImportNetwork) {
+    CNNNetReader reader;
+    ASSERT_NO_THROW(reader.ReadNetwork(model.data(), model.length()));
+    CNNNetwork network = reader.getNetwork();
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    network.getInputsInfo().begin()->second->getPreProcess().setResizeAlgorithm(RESIZE_BILINEAR);
+
+    Config config;
+    config.throughputStreams = 2;
+    config.useThreadBinding = false;
+
+    std::stringstream stream;
+    ASSERT_NO_THROW(MKLDNNModelSerial::Export(stream, network, config,
+                                              network.getInputsInfo(), network.getOutputsInfo()));
+
+    CNNNetReader importedReader;
+    std::map<std::string, std::string> importedConfig;
+    ASSERT_NO_THROW(MKLDNNModelSerial::Import(stream, importedReader, importedConfig));
+    CNNNetwork imported = importedReader.getNetwork();
+
+    ASSERT_EQ(network.layerCount(), imported.layerCount());
+    ASSERT_EQ("2", importedConfig[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS]);
+    ASSERT_EQ(PluginConfigParams::NO, importedConfig[PluginConfigParams::KEY_CPU_BIND_THREAD]);
+
+    auto input = imported.getInputsInfo().find("in1");
+    ASSERT_NE(imported.getInputsInfo().end(), input);
+    ASSERT_EQ(Precision::U8, input->second->getPrecision());
+    ASSERT_EQ(RESIZE_BILINEAR, input->second->getPreProcess().getResizeAlgorithm());
+
+    Config parsed;
+    ASSERT_NO_THROW(parsed.readProperties(importedConfig));
+    ASSERT_EQ(2, parsed.throughputStreams);
+    ASSERT_FALSE(parsed.useThreadBinding);
+}
+
+TEST_F(MKLDNNModelSerialTests, throwsOnWrongMagic) {
+    std::stringstream stream("NOTAMODEL");
+    CNNNetReader reader;
+    std::map<std::string, std::string> config;
+    ASSERT_THROW(MKLDNNModelSerial::Import(stream, reader, config), details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNModelSerialTests, throwsOnTruncatedStream) {
+    CNNNetReader reader;
+    ASSERT_NO_THROW(reader.ReadNetwork(model.data(), model.length()));
+    CNNNetwork network = reader.getNetwork();
+
+    std::stringstream stream;
+    ASSERT_NO_THROW(MKLDNNModelSerial::Export(stream, network, Config(),
+                                              network.getInputsInfo(), network.getOutputsInfo()));
+    const std::string exported = stream.str();
+
+    // the cuts are in the header, in the middle and in the last field of the stream
+    for (size_t size : {static_cast<size_t>(2), static_cast<size_t>(6), exported.size() / 2, exported.size() - 1}) {
+        std::stringstream truncated(exported.substr(0, size));
+        CNNNetReader importedReader;
+        std::map<std::string, std::string> importedConfig;
+        try {
+            MKLDNNModelSerial::Import(truncated, importedReader, importedConfig);
+            FAIL() << "Import accepted the stream truncated to " << size << " bytes";
+        } catch (const details::InferenceEngineException &e) {
+            ASSERT_NE(std::string::npos, std::string(e.what()).find("Imported network is corrupted")) << e.what();
+        }
+    }
+}
+
+TEST_F(MKLDNNModelSerialTests, enforceBF16IsExportedAndRejectedOnLoad) {
+    CNNNetReader reader;
+    ASSERT_NO_THROW(reader.ReadNetwork(model.data(), model.length()));
+    CNNNetwork network = reader.getNetwork();
+
+    Config config;
+    ASSERT_NO_THROW(config.readProperties({{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES}}));
+    ASSERT_TRUE(config.enforceBF16);
+    ASSERT_THROW(config.readProperties({{PluginConfigParams::KEY_ENFORCE_BF16, "ON"}}), details::InferenceEngineException);
+
+    std::stringstream stream;
+    ASSERT_NO_THROW(MKLDNNModelSerial::Export(stream, network, config,
+                                              network.getInputsInfo(), network.getOutputsInfo()));
+    CNNNetReader importedReader;
+    std::map<std::string, std::string> importedConfig;
+    ASSERT_NO_THROW(MKLDNNModelSerial::Import(stream, importedReader, importedConfig));
+    ASSERT_EQ(PluginConfigParams::YES, importedConfig[PluginConfigParams::KEY_ENFORCE_BF16]);
+
+    // there is no BF16 execution path, so the load fails instead of running the network in FP32
+    Engine engine;
+    IExecutableNetwork::Ptr executableNetwork;
+    try {
+        engine.LoadNetwork(executableNetwork, network, {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES}});
+        FAIL() << "LoadNetwork accepted ENFORCE_BF16";
+    } catch (const details::InferenceEngineException &e) {
+        ASSERT_NE(std::string::npos, std::string(e.what()).find("NOT_IMPLEMENTED"));
+    }
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <blob_factory.hpp>
+#include "mkldnn_request_blobs.h"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class MKLDNNRequestBlobsTests : public ::testing::Test {
+protected:
+    static Blob::Ptr allocated(const TensorDesc &desc) {
+        Blob::Ptr blob = make_blob_with_precision(desc);
+        blob->allocate();
+        return blob;
+    }
+};
+
+TEST_F(MKLDNNRequestBlobsTests, smallerOutputsAreViewsOfLoadedOutput) {
+    MKLDNNPlugin::RequestBlobs requestBlobs;
+    Blob::Ptr loaded = allocated(TensorDesc(Precision::FP32, {1, 3, 16, 16}, Layout::NCHW));
+
+    Blob::Ptr smaller = requestBlobs.outputFor("out", loaded, {1, 3, 8, 8});
+    ASSERT_EQ(SizeVector({1, 3, 8, 8}), smaller->getTensorDesc().getDims());
+    ASSERT_EQ(loaded->buffer().as<void*>(), smaller->buffer().as<void*>());
+
+    // the same dims give the same blob, the loaded dims give the loaded blob back
+    ASSERT_EQ(smaller, requestBlobs.outputFor("out", smaller, {1, 3, 8, 8}));
+    ASSERT_EQ(loaded, requestBlobs.outputFor("out", smaller, {1, 3, 16, 16}));
+    ASSERT_EQ(smaller, requestBlobs.outputFor("out", loaded, {1, 3, 8, 8}));
+}
+
+TEST_F(MKLDNNRequestBlobsTests, largerOutputsAreAllocatedOnce) {
+    MKLDNNPlugin::RequestBlobs requestBlobs;
+    Blob::Ptr loaded = allocated(TensorDesc(Precision::FP32, {1, 3, 8, 8}, Layout::NCHW));
+
+    Blob::Ptr larger = requestBlobs.outputFor("out", loaded, {1, 3, 16, 16});
+    ASSERT_NE(loaded->buffer().as<void*>(), larger->buffer().as<void*>());
+    ASSERT_EQ(larger, requestBlobs.outputFor("out", loaded, {1, 3, 16, 16}));
+}
+
+TEST_F(MKLDNNRequestBlobsTests, outputSetByUserReplacesLoadedOutput) {
+    MKLDNNPlugin::RequestBlobs requestBlobs;
+    Blob::Ptr loaded = allocated(TensorDesc(Precision::FP32, {1, 3, 16, 16}, Layout::NCHW));
+    requestBlobs.outputFor("out", loaded, {1, 3, 8, 8});
+
+    Blob::Ptr user = allocated(TensorDesc(Precision::FP32, {1, 3, 16, 16}, Layout::NCHW));
+    Blob::Ptr smaller = requestBlobs.outputFor("out", user, {1, 3, 8, 8});
+    ASSERT_EQ(user->buffer().as<void*>(), smaller->buffer().as<void*>());
+}
+
+TEST_F(MKLDNNRequestBlobsTests, convertedInputIsReused) {
+    MKLDNNPlugin::RequestBlobs requestBlobs;
+    Blob::Ptr input = allocated(TensorDesc(Precision::U8, {1, 3, 2, 2}, Layout::NCHW));
+    for (size_t i = 0; i < input->size(); i++)
+        input->buffer().as<uint8_t*>()[i] = static_cast<uint8_t>(i);
+
+    Blob::Ptr first = requestBlobs.convertToFloat("in", input);
+    ASSERT_EQ(Precision::FP32, first->precision());
+    for (size_t i = 0; i < input->size(); i++)
+        ASSERT_EQ(static_cast<float>(i), first->cbuffer().as<const float*>()[i]);
+    ASSERT_EQ(first, requestBlobs.convertToFloat("in", input));
+
+    Blob::Ptr other = allocated(TensorDesc(Precision::U8, {1, 3, 4, 4}, Layout::NCHW));
+    ASSERT_NE(first, requestBlobs.convertToFloat("in", other));
+}
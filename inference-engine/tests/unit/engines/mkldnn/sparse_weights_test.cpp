@@ -0,0 +1,91 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <blob_factory.hpp>
+#include <vector>
+#include "mkldnn_sparse_weights.h"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class MKLDNNSparseWeightsTests : public ::testing::Test {
+protected:
+    // every tenth weight is nonzero
+    static Blob::Ptr prunedWeights(size_t rows, size_t cols) {
+        Blob::Ptr blob = make_blob_with_precision(TensorDesc(Precision::FP32, {rows, cols}, Layout::NC));
+        blob->allocate();
+        float *data = blob->buffer().as<float *>();
+        for (size_t i = 0; i < blob->size(); i++)
+            data[i] = i % 10 == 3 ? static_cast<float>(i % 7) - 3.f : 0.f;
+        return blob;
+    }
+
+    static Blob::Ptr biases(size_t rows) {
+        Blob::Ptr blob = make_blob_with_precision(TensorDesc(Precision::FP32, {rows}, Layout::C));
+        blob->allocate();
+        float *data = blob->buffer().as<float *>();
+        for (size_t i = 0; i < rows; i++)
+            data[i] = 0.5f * static_cast<float>(i);
+        return blob;
+    }
+};
+
+TEST_F(MKLDNNSparseWeightsTests, denseWeightsAreNotCompressed) {
+    Blob::Ptr weights = make_blob_with_precision(TensorDesc(Precision::FP32, {4, 8}, Layout::NC));
+    weights->allocate();
+    std::fill_n(weights->buffer().as<float *>(), weights->size(), 1.f);
+    ASSERT_EQ(nullptr, MKLDNNPlugin::MKLDNNSparseWeights::get("dense", weights, nullptr, 4));
+}
+
+TEST_F(MKLDNNSparseWeightsTests, multiplyRowsIsFullyConnected) {
+    const size_t rows = 16, cols = 40, batch = 3;
+    Blob::Ptr weights = prunedWeights(rows, cols);
+    Blob::Ptr bias = biases(rows);
+    auto sparse = MKLDNNPlugin::MKLDNNSparseWeights::get("fc", weights, bias, rows);
+    ASSERT_NE(nullptr, sparse);
+    ASSERT_NEAR(0.9f, sparse->getSparsity(), 0.01f);
+
+    std::vector<float> src(batch * cols), dst(batch * rows);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 5) - 2.f;
+    sparse->multiplyRows(src.data(), dst.data(), batch);
+
+    const float *w = weights->cbuffer().as<const float *>();
+    const float *b = bias->cbuffer().as<const float *>();
+    for (size_t n = 0; n < batch; n++) {
+        for (size_t r = 0; r < rows; r++) {
+            float expected = b[r];
+            for (size_t c = 0; c < cols; c++)
+                expected += w[r * cols + c] * src[n * cols + c];
+            ASSERT_FLOAT_EQ(expected, dst[n * rows + r]);
+        }
+    }
+}
+
+TEST_F(MKLDNNSparseWeightsTests, multiplyPlanesIsConvolution1x1) {
+    const size_t rows = 8, cols = 20, batch = 2, planeSize = 9;
+    Blob::Ptr weights = prunedWeights(rows, cols);
+    auto sparse = MKLDNNPlugin::MKLDNNSparseWeights::get("conv", weights, nullptr, rows);
+    ASSERT_NE(nullptr, sparse);
+    // the same weights of the same node are shared
+    ASSERT_EQ(sparse, MKLDNNPlugin::MKLDNNSparseWeights::get("conv", weights, nullptr, rows));
+
+    std::vector<float> src(batch * cols * planeSize), dst(batch * rows * planeSize);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 11) - 5.f;
+    sparse->multiplyPlanes(src.data(), dst.data(), batch, planeSize);
+
+    const float *w = weights->cbuffer().as<const float *>();
+    for (size_t n = 0; n < batch; n++) {
+        for (size_t r = 0; r < rows; r++) {
+            for (size_t p = 0; p < planeSize; p++) {
+                float expected = 0.f;
+                for (size_t c = 0; c < cols; c++)
+                    expected += w[r * cols + c] * src[(n * cols + c) * planeSize + p];
+                ASSERT_FLOAT_EQ(expected, dst[(n * rows + r) * planeSize + p]);
+            }
+        }
+    }
+}
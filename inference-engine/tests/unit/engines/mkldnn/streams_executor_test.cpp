@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include "mkldnn_plugin/mkldnn_streams.h"
+
+using namespace std;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+class MKLDNNStreamsExecutorTests : public ::testing::Test {
+protected:
+    static std::vector<Task::Ptr> initTasks(size_t num) {
+        std::vector<Task::Ptr> tasks;
+        for (size_t i = 0; i < num; i++)
+            tasks.push_back(std::make_shared<Task>());
+        return tasks;
+    }
+};
+
+TEST_F(MKLDNNStreamsExecutorTests, canRunAllTasks) {
+    auto executor = std::make_shared<MultiWorkerTaskExecutor>(initTasks(4));
+    std::atomic<int> counter(0);
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 100; i++) {
+        tasks.push_back(std::make_shared<Task>([&counter]() { counter++; }));
+        ASSERT_TRUE(executor->startTask(tasks.back()));
+    }
+    for (auto& task : tasks)
+        ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+    ASSERT_EQ(100, counter);
+}
+
+TEST_F(MKLDNNStreamsExecutorTests, canRunAllTasksWithNumaGroups) {
+    auto executor = std::make_shared<MultiWorkerTaskExecutor>(initTasks(4), "Default", 2);
+    std::atomic<int> counter(0);
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 100; i++) {
+        tasks.push_back(std::make_shared<Task>([&counter]() { counter++; }));
+        ASSERT_TRUE(executor->startTask(tasks.back()));
+    }
+    for (auto& task : tasks)
+        ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+    ASSERT_EQ(100, counter);
+}
+
+TEST_F(MKLDNNStreamsExecutorTests, idleWorkerStealsTasksOfBlockedOne) {
+    auto executor = std::make_shared<MultiWorkerTaskExecutor>(initTasks(2));
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    // the first task blocks its worker, the tasks queued behind it must be stolen by the other worker
+    auto blocking = std::make_shared<Task>([released]() { released.wait(); });
+    ASSERT_TRUE(executor->startTask(blocking));
+    std::vector<Task::Ptr> tasks;
+    for (int i = 0; i < 10; i++) {
+        tasks.push_back(std::make_shared<Task>());
+        ASSERT_TRUE(executor->startTask(tasks.back()));
+    }
+    for (auto& task : tasks)
+        ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+    release.set_value();
+    ASSERT_EQ(Task::Status::TS_DONE, blocking->wait(-1));
+}
+
+TEST_F(MKLDNNStreamsExecutorTests, destructorWaitsForQueuedTasks) {
+    std::atomic<int> counter(0);
+    {
+        MultiWorkerTaskExecutor executor(initTasks(3));
+        for (int i = 0; i < 30; i++)
+            executor.startTask(std::make_shared<Task>([&counter]() { counter++; }));
+    }
+    ASSERT_EQ(30, counter);
+}
@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <cpp/ie_cnn_net_reader.h>
+#include "mkldnn_plugin/mkldnn_trace.h"
+#include "graph/test_graph.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+class MKLDNNTraceTests : public ::testing::Test {
+protected:
+    static size_t countOf(const std::string &str, const std::string &pattern) {
+        size_t count = 0;
+        for (size_t pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1))
+            count++;
+        return count;
+    }
+
+    static std::string exportTrace(const MKLDNNTrace &trace) {
+        std::ostringstream os;
+        trace.exportChromeTrace(os);
+        return os.str();
+    }
+
+    std::string model = R"V0G0N(
+<Net Name="Power_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="power" id="1" type="Power" precision="FP32">
+            <power_data power="1" scale="2" shift="0"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</Net>
+)V0G0N";
+};
+
+TEST_F(MKLDNNTraceTests, exportsEventsInChromeFormat) {
+    MKLDNNTrace trace(16);
+    int conv = trace.addLabel("conv1", "Convolution", "jit_avx2");
+    int relu = trace.addLabel("relu1", "Activation", "ref_any");
+
+    trace.record(conv, 0, 1500, 4000);
+    trace.record(relu, 1, 4000, 4250);
+    ASSERT_EQ(2, trace.size());
+
+    std::string json = exportTrace(trace);
+    ASSERT_EQ(0, json.find("{\"traceEvents\":["));
+    ASSERT_NE(std::string::npos, json.find(
+            "{\"name\":\"conv1\",\"cat\":\"Convolution\",\"ph\":\"X\",\"ts\":1.500,\"dur\":2.500,\"pid\":0,"));
+    ASSERT_NE(std::string::npos, json.find("\"args\":{\"impl\":\"jit_avx2\"}"));
+    ASSERT_NE(std::string::npos, json.find(
+            "{\"name\":\"relu1\",\"cat\":\"Activation\",\"ph\":\"X\",\"ts\":4.000,\"dur\":0.250,\"pid\":1,"));
+    ASSERT_NE(std::string::npos, json.find("\"args\":{\"name\":\"CPU stream 0\"}"));
+    ASSERT_NE(std::string::npos, json.find("\"args\":{\"name\":\"CPU stream 1\"}"));
+}
+
+TEST_F(MKLDNNTraceTests, escapesNames) {
+    MKLDNNTrace trace(4);
+    trace.record(trace.addLabel("a\"b\\c", "Type", ""), 0, 0, 1);
+
+    ASSERT_NE(std::string::npos, exportTrace(trace).find("\"name\":\"a\\\"b\\\\c\""));
+}
+
+TEST_F(MKLDNNTraceTests, keepsMostRecentEvents) {
+    MKLDNNTrace trace(4);
+    std::vector<int> labels;
+    for (int i = 0; i < 10; i++)
+        labels.push_back(trace.addLabel("node" + std::to_string(i), "Type", ""));
+    for (int i = 0; i < 10; i++)
+        trace.record(labels[i], 0, i * 1000, i * 1000 + 500);
+    ASSERT_EQ(4, trace.size());
+
+    std::string json = exportTrace(trace);
+    ASSERT_EQ(4, countOf(json, "\"ph\":\"X\""));
+    for (int i = 0; i < 10; i++)
+        ASSERT_EQ(i >= 6, json.find("\"node" + std::to_string(i) + "\"") != std::string::npos) << "event " << i;
+}
+
+TEST_F(MKLDNNTraceTests, canRecordConcurrently) {
+    MKLDNNTrace trace(8192);
+    int label = trace.addLabel("node", "Type", "");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&trace, label, t] {
+            for (int i = 0; i < 1000; i++) {
+                uint64_t start = trace.now();
+                trace.record(label, t, start, trace.now());
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    ASSERT_EQ(4000, trace.size());
+
+    std::string json = exportTrace(trace);
+    ASSERT_EQ(4000, countOf(json, "\"ph\":\"X\""));
+    ASSERT_EQ(4, countOf(json, "\"process_name\""));
+}
+
+TEST_F(MKLDNNTraceTests, throwsOnEmptyBuffer) {
+    ASSERT_THROW(MKLDNNTrace(0), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNTraceTests, graphRecordsEveryInference) {
+    CNNNetReader reader;
+    ASSERT_NO_THROW(reader.ReadNetwork(model.data(), model.length()));
+
+    auto trace = std::make_shared<MKLDNNTrace>(64);
+    MKLDNNGraphTestClass graph;
+    graph.setTrace(trace, 3);
+    ASSERT_NO_THROW(graph.CreateGraph(reader.getNetwork()));
+    // nothing is recorded until the first inference, the constant nodes executed on load are not traced
+    ASSERT_EQ(0, trace->size());
+
+    Blob::Ptr src = make_shared_blob<float>({Precision::FP32, {1, 3, 4, 4}, Layout::NCHW});
+    src->allocate();
+    BlobMap srcs;
+    srcs["in1"] = src;
+
+    OutputsDataMap out = reader.getNetwork().getOutputsInfo();
+    BlobMap outputBlobs;
+    TBlob<float>::Ptr output = make_shared_blob<float>(out.begin()->second->getTensorDesc());
+    output->allocate();
+    outputBlobs[out.begin()->first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+    graph.Infer(srcs, outputBlobs);
+
+    // the whole inference and each of the nodes
+    const size_t nodesCount = graph.getNodes().size();
+    ASSERT_EQ(2 * (nodesCount + 1), trace->size());
+
+    std::string json = exportTrace(*trace);
+    ASSERT_EQ(2, countOf(json, "{\"name\":\"Infer\",\"cat\":\"Graph\""));
+    ASSERT_EQ(2, countOf(json, "{\"name\":\"power\",\"cat\":\"Power\""));
+    ASSERT_EQ(2 * (nodesCount + 1), countOf(json, "\"pid\":3,\"tid\""));
+}
@@ -0,0 +1,232 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <multi-device/multi_device_config.hpp>
+#include <multi_device.hpp>
+
+#include <mock_iexecutable_network.hpp>
+#include <mock_iasync_infer_request.hpp>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace MultiDevicePlugin;
+
+TEST(MultiDevicePrioritiesTests, canParseDevicesWithNumberOfRequests) {
+    auto devices = ParseDevicePriorities("GPU(4),CPU");
+    ASSERT_EQ(2, devices.size());
+    ASSERT_EQ("GPU", devices[0].deviceName);
+    ASSERT_EQ(4, devices[0].numRequests);
+    ASSERT_EQ("CPU", devices[1].deviceName);
+    ASSERT_EQ(2, devices[1].numRequests);
+}
+
+TEST(MultiDevicePrioritiesTests, failToParseEmptyPriorities) {
+    ASSERT_THROW(ParseDevicePriorities(""), details::InferenceEngineException);
+}
+
+TEST(MultiDevicePrioritiesTests, failToParseEmptyDeviceName) {
+    ASSERT_THROW(ParseDevicePriorities("GPU,,CPU"), details::InferenceEngineException);
+    ASSERT_THROW(ParseDevicePriorities("(2)"), details::InferenceEngineException);
+}
+
+TEST(MultiDevicePrioritiesTests, failToParseWrongNumberOfRequests) {
+    for (auto &&priorities : {"GPU(0)", "GPU(-1)", "GPU(x)", "GPU()", "GPU(4", "GPU(4)x"}) {
+        ASSERT_THROW(ParseDevicePriorities(priorities), details::InferenceEngineException) << priorities;
+    }
+}
+
+TEST(MultiDevicePrioritiesTests, setConfigChecksPriorities) {
+    Engine engine;
+    ASSERT_THROW(engine.SetConfig({{MULTI_CONFIG_KEY(DEVICE_PRIORITIES), ""}}), details::InferenceEngineException);
+    ASSERT_NO_THROW(engine.SetConfig({{MULTI_CONFIG_KEY(DEVICE_PRIORITIES), "GPU(4),CPU(2)"}}));
+}
+
+class MultiDeviceExecutableNetworkTests : public ::testing::Test {
+protected:
+    const std::string inputName = "input";
+    const std::string outputName = "output";
+
+    /* The request of a device, completed by the test thread instead of the device */
+    struct DeviceRequest {
+        std::shared_ptr<NiceMock<MockIInferRequest>> request;
+        void *userData = nullptr;
+        IInferRequest::CompletionCallback callback = nullptr;
+        // the input blobs of the application requests the device request has been started with
+        std::vector<Blob::Ptr> inputs;
+        Blob::Ptr lastInput;
+        StatusCode startStatus = OK;
+
+        void complete(StatusCode status) {
+            callback(request, status);
+        }
+    };
+
+    std::vector<std::unique_ptr<DeviceRequest>> deviceRequests;
+    MultiDeviceExecutableNetwork::Ptr network;
+    // the indices of the application requests in the order their callbacks are called, with the statuses
+    std::vector<std::pair<int, StatusCode>> completed;
+
+    void TearDown() override {
+        // the network waits for all device requests to be idle in the destructor
+        for (auto &&deviceRequest : deviceRequests) {
+            ASSERT_TRUE(Mock::VerifyAndClearExpectations(deviceRequest->request.get()));
+        }
+    }
+
+    IInferRequest::Ptr createDeviceRequest() {
+        deviceRequests.emplace_back(new DeviceRequest());
+        auto deviceRequest = deviceRequests.back().get();
+        deviceRequest->request = std::make_shared<NiceMock<MockIInferRequest>>();
+        auto &request = *deviceRequest->request;
+        ON_CALL(request, SetUserData(_, _)).WillByDefault(Invoke([deviceRequest](void *data, ResponseDesc *) {
+            deviceRequest->userData = data;
+            return OK;
+        }));
+        ON_CALL(request, GetUserData(_, _)).WillByDefault(Invoke([deviceRequest](void **data, ResponseDesc *) {
+            *data = deviceRequest->userData;
+            return OK;
+        }));
+        ON_CALL(request, SetCompletionCallback(_)).WillByDefault(
+                Invoke([deviceRequest](IInferRequest::CompletionCallback callback) {
+                    deviceRequest->callback = callback;
+                    return OK;
+                }));
+        ON_CALL(request, SetBlob(_, _, _)).WillByDefault(
+                Invoke([this, deviceRequest](const char *name, const Blob::Ptr &blob, ResponseDesc *) {
+                    if (name == inputName) deviceRequest->lastInput = blob;
+                    return OK;
+                }));
+        ON_CALL(request, StartAsync(_)).WillByDefault(Invoke([deviceRequest](ResponseDesc *) {
+            if (deviceRequest->startStatus == OK) deviceRequest->inputs.push_back(deviceRequest->lastInput);
+            return deviceRequest->startStatus;
+        }));
+        return deviceRequest->request;
+    }
+
+    ExecutableNetwork createDeviceNetwork(unsigned int numRequests) {
+        auto deviceNetwork = std::make_shared<MockIExecutableNetwork>();
+        EXPECT_CALL(*deviceNetwork, CreateInferRequest(_, _)).Times(numRequests).WillRepeatedly(
+                Invoke([this](IInferRequest::Ptr &request, ResponseDesc *) {
+                    request = createDeviceRequest();
+                    return OK;
+                }));
+        return ExecutableNetwork(deviceNetwork);
+    }
+
+    void createNetwork(const std::vector<DeviceInformation> &devices) {
+        std::vector<std::pair<DeviceInformation, ExecutableNetwork>> networks;
+        for (auto &&device : devices) {
+            networks.emplace_back(device, createDeviceNetwork(device.numRequests));
+        }
+        network = std::make_shared<MultiDeviceExecutableNetwork>(networks);
+
+        auto inputInfo = std::make_shared<InputInfo>();
+        inputInfo->setInputData(std::make_shared<Data>(inputName, TensorDesc(Precision::FP32, {1, 3}, NC)));
+        network->setNetworkInputs({{inputName, inputInfo}});
+        network->setNetworkOutputs({{outputName,
+                                     std::make_shared<Data>(outputName, TensorDesc(Precision::FP32, {1, 3}, NC))}});
+    }
+
+    InferRequest createRequest(int index) {
+        IInferRequest::Ptr request;
+        network->CreateInferRequest(request);
+        InferRequest wrapper(request);
+        wrapper.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [this, index](InferRequest, StatusCode status) { completed.emplace_back(index, status); });
+        return wrapper;
+    }
+};
+
+TEST_F(MultiDeviceExecutableNetworkTests, canDispatchToFirstIdleDeviceAndFallBack) {
+    createNetwork({{"A", 1}, {"B", 1}});
+    ASSERT_EQ(2, deviceRequests.size());
+    auto &deviceA = *deviceRequests[0];
+    auto &deviceB = *deviceRequests[1];
+    std::vector<InferRequest> requests = {createRequest(0), createRequest(1), createRequest(2)};
+
+    // both devices are idle and not measured yet, the first one in the order of priority is taken
+    requests[0].StartAsync();
+    ASSERT_EQ(std::vector<Blob::Ptr>{requests[0].GetBlob(inputName)}, deviceA.inputs);
+    // the first device is busy, so the request falls back to the next one
+    requests[1].StartAsync();
+    ASSERT_EQ(std::vector<Blob::Ptr>{requests[1].GetBlob(inputName)}, deviceB.inputs);
+
+    deviceA.complete(OK);
+    ASSERT_EQ(OK, requests[0].Wait(IInferRequest::WaitMode::RESULT_READY));
+    // only the first device is idle now
+    requests[2].StartAsync();
+    ASSERT_EQ(2, deviceA.inputs.size());
+    ASSERT_EQ(requests[2].GetBlob(inputName), deviceA.inputs[1]);
+    ASSERT_EQ(1, deviceB.inputs.size());
+
+    deviceA.complete(OK);
+    deviceB.complete(OK);
+    ASSERT_EQ(OK, requests[1].Wait(IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(OK, requests[2].Wait(IInferRequest::WaitMode::RESULT_READY));
+    std::vector<std::pair<int, StatusCode>> ref = {{0, OK}, {2, OK}, {1, OK}};
+    ASSERT_EQ(ref, completed);
+}
+
+TEST_F(MultiDeviceExecutableNetworkTests, pendingRequestsAreInferredInOrderOfStart) {
+    createNetwork({{"A", 1}});
+    auto &device = *deviceRequests[0];
+    std::vector<InferRequest> requests = {createRequest(0), createRequest(1), createRequest(2)};
+
+    for (auto &&request : requests) {
+        request.StartAsync();
+    }
+    ASSERT_EQ(1, device.inputs.size());
+    ASSERT_EQ(RESULT_NOT_READY, requests[1].Wait(IInferRequest::WaitMode::STATUS_ONLY));
+
+    // the device request takes the next pending request before the callback of the inferred one is called
+    device.complete(OK);
+    device.complete(OK);
+    device.complete(OK);
+    std::vector<Blob::Ptr> refInputs;
+    for (auto &&request : requests) {
+        refInputs.push_back(request.GetBlob(inputName));
+    }
+    ASSERT_EQ(refInputs, device.inputs);
+    std::vector<std::pair<int, StatusCode>> ref = {{0, OK}, {1, OK}, {2, OK}};
+    ASSERT_EQ(ref, completed);
+}
+
+TEST_F(MultiDeviceExecutableNetworkTests, errorOfDeviceRequestIsPassedToCallback) {
+    createNetwork({{"A", 1}});
+    auto &device = *deviceRequests[0];
+    auto request = createRequest(0);
+
+    request.StartAsync();
+    device.complete(GENERAL_ERROR);
+    ASSERT_EQ(GENERAL_ERROR, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+    std::vector<std::pair<int, StatusCode>> ref = {{0, GENERAL_ERROR}};
+    ASSERT_EQ(ref, completed);
+}
+
+TEST_F(MultiDeviceExecutableNetworkTests, failedStartOfDeviceRequestIsPassedToCallbackAndNextRequestIsStarted) {
+    createNetwork({{"A", 1}});
+    auto &device = *deviceRequests[0];
+    std::vector<InferRequest> requests = {createRequest(0), createRequest(1)};
+
+    requests[0].StartAsync();
+    requests[1].StartAsync();
+    device.startStatus = GENERAL_ERROR;
+    // the device request fails to start the pending request, so it is idle again
+    device.complete(OK);
+    ASSERT_EQ(GENERAL_ERROR, requests[1].Wait(IInferRequest::WaitMode::RESULT_READY));
+    std::vector<std::pair<int, StatusCode>> ref = {{1, GENERAL_ERROR}, {0, OK}};
+    ASSERT_EQ(ref, completed);
+
+    device.startStatus = OK;
+    requests[1].StartAsync();
+    ASSERT_EQ(2, device.inputs.size());
+    device.complete(OK);
+    ASSERT_EQ(OK, requests[1].Wait(IInferRequest::WaitMode::RESULT_READY));
+}
@@ -60,6 +60,30 @@ TEST_F(GraphToolsTest, canRunCycleDFS) {
 }
 
 
+TEST_F(GraphToolsTest, canRunDFSOnDeepChain) {
+    // the depth of the unrolled sequences is far beyond the call stack of a recursive traversal
+    const size_t depth = 200000;
+    std::vector<CNNLayerPtr> chain;
+    for (size_t i = 0; i < depth; i++) {
+        chain.push_back(std::make_shared<CNNLayer>(LayerParams{std::to_string(i), "dummy", Precision::FP32}));
+        if (i > 0) {
+            auto data = std::make_shared<Data>(std::to_string(i - 1) + "_out", Precision::FP32);
+            data->getCreatorLayer() = chain[i - 1];
+            data->getInputTo()[chain[i]->name] = chain[i];
+            chain[i - 1]->outData.push_back(data);
+            chain[i]->insData.push_back(data);
+        }
+    }
+
+    size_t idx = 0;
+    bool inOrder = true;
+    EXPECT_TRUE(CNNNetDFS(chain[0], [&](const CNNLayerPtr &layer) {
+        inOrder = inOrder && layer == chain[depth - 1 - idx++];
+    }, false));
+    EXPECT_EQ(depth, idx);
+    EXPECT_TRUE(inOrder);
+}
+
 TEST_F(GraphToolsTest, canRunBFS) {
 
     CONNECT(0, 1);
@@ -0,0 +1,151 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <string>
+#include <vector>
+
+#include "ie_auto_batch.hpp"
+#include "cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp"
+#include "cpp_interfaces/base/ie_executable_network_base.hpp"
+#include "details/ie_irelease.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+
+/**
+ * @brief Doubles the input and counts the inferred batches
+ */
+class DoublingInferRequest : public InferRequestInternal {
+public:
+    DoublingInferRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs, atomic<int> &batches,
+                         bool isDynamicBatch)
+            : InferRequestInternal(networkInputs, networkOutputs), _batches(batches), _isDynamicBatch(isDynamicBatch) {
+        _inputs["in"] = make_shared_blob<float>(networkInputs["in"]->getTensorDesc());
+        _inputs["in"]->allocate();
+        _outputs["out"] = make_shared_blob<float>(networkOutputs["out"]->getTensorDesc());
+        _outputs["out"]->allocate();
+    }
+
+    void InferImpl() override {
+        _batches++;
+        const float *src = _inputs["in"]->cbuffer().as<const float *>();
+        float *dst = _outputs["out"]->buffer().as<float *>();
+        size_t size = _inputs["in"]->size() / _inputs["in"]->getTensorDesc().getDims()[0];
+        size_t batch = m_curBatch > 0 ? static_cast<size_t>(m_curBatch) : _inputs["in"]->getTensorDesc().getDims()[0];
+        for (size_t i = 0; i < batch * size; i++) {
+            dst[i] = 2.0f * src[i];
+        }
+    }
+
+    void SetBatch(int batch) override {
+        if (!_isDynamicBatch) THROW_IE_EXCEPTION << "Dynamic batch is not enabled";
+        m_curBatch = batch;
+    }
+
+    void GetPerformanceCounts(map<string, InferenceEngineProfileInfo> &) const override {}
+
+private:
+    atomic<int> &_batches;
+    bool _isDynamicBatch;
+};
+
+class DoublingExecutableNetwork : public ExecutableNetworkThreadSafeDefault {
+public:
+    DoublingExecutableNetwork(size_t batch, atomic<int> &batches, bool isDynamicBatch)
+            : _batches(batches), _isDynamicBatch(isDynamicBatch) {
+        InputInfo::Ptr input(new InputInfo());
+        input->setInputData(make_shared<Data>("in", TensorDesc(Precision::FP32, {batch, 3}, Layout::NC)));
+        _networkInputs["in"] = input;
+        _networkOutputs["out"] = make_shared<Data>("out", TensorDesc(Precision::FP32, {batch, 3}, Layout::NC));
+    }
+
+    InferRequestInternal::Ptr CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                     OutputsDataMap networkOutputs) override {
+        return make_shared<DoublingInferRequest>(networkInputs, networkOutputs, _batches, _isDynamicBatch);
+    }
+
+private:
+    atomic<int> &_batches;
+    bool _isDynamicBatch;
+};
+
+ExecutableNetwork makeDoublingNetwork(size_t batch, atomic<int> &batches, bool isDynamicBatch = true) {
+    auto impl = make_shared<DoublingExecutableNetwork>(batch, batches, isDynamicBatch);
+    return ExecutableNetwork(details::shared_from_irelease(new ExecutableNetworkBase<ExecutableNetworkInternal>(impl)));
+}
+
+}  // namespace
+
+class AutoBatchExecutableNetworkTests : public ::testing::Test {
+protected:
+    atomic<int> batches {0};
+
+    void inferAndCheck(ExecutableNetwork network, size_t requestsNum) {
+        vector<InferRequest> requests;
+        atomic<size_t> callbacks(0);
+        for (size_t r = 0; r < requestsNum; r++) {
+            requests.push_back(network.CreateInferRequest());
+            auto input = requests.back().GetBlob("in");
+            ASSERT_EQ(SizeVector({1, 3}), input->getTensorDesc().getDims());
+            for (size_t i = 0; i < 3; i++) {
+                input->buffer().as<float *>()[i] = static_cast<float>(r * 3 + i);
+            }
+            requests.back().SetCompletionCallback([&callbacks] { callbacks++; });
+        }
+        for (auto &&request : requests) {
+            request.StartAsync();
+        }
+        for (size_t r = 0; r < requestsNum; r++) {
+            ASSERT_EQ(OK, requests[r].Wait(IInferRequest::WaitMode::RESULT_READY));
+            auto output = requests[r].GetBlob("out")->cbuffer().as<const float *>();
+            for (size_t i = 0; i < 3; i++) {
+                ASSERT_EQ(2.0f * (r * 3 + i), output[i]);
+            }
+        }
+        // the callbacks are called after the requests are released
+        for (int i = 0; i < 1000 && callbacks != requestsNum; i++) {
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        ASSERT_EQ(requestsNum, callbacks);
+    }
+};
+
+TEST_F(AutoBatchExecutableNetworkTests, collectsFullBatch) {
+    // the timeout is large, so only the full batches are inferred
+    auto network = CreateAutoBatchExecutableNetwork(makeDoublingNetwork(4, batches), 0, 10000000);
+    inferAndCheck(network, 8);
+    ASSERT_EQ(2, batches);
+}
+
+TEST_F(AutoBatchExecutableNetworkTests, infersPartialBatchOnTimeout) {
+    auto network = CreateAutoBatchExecutableNetwork(makeDoublingNetwork(4, batches), 4, 1000);
+    inferAndCheck(network, 3);
+    ASSERT_EQ(1, batches);
+}
+
+TEST_F(AutoBatchExecutableNetworkTests, infersWholeBatchWithoutDynamicBatch) {
+    auto network = CreateAutoBatchExecutableNetwork(makeDoublingNetwork(4, batches, false), 4, 1000);
+    inferAndCheck(network, 2);
+}
+
+TEST_F(AutoBatchExecutableNetworkTests, canInferSynchronously) {
+    auto network = CreateAutoBatchExecutableNetwork(makeDoublingNetwork(2, batches), 2, 1000);
+    auto request = network.CreateInferRequest();
+    request.GetBlob("in")->buffer().as<float *>()[1] = 3.0f;
+    ASSERT_NO_THROW(request.Infer());
+    ASSERT_EQ(6.0f, request.GetBlob("out")->cbuffer().as<const float *>()[1]);
+}
+
+TEST_F(AutoBatchExecutableNetworkTests, throwsIfMaxBatchIsMoreThanNetworkBatch) {
+    ASSERT_THROW(CreateAutoBatchExecutableNetwork(makeDoublingNetwork(2, batches), 3, 1000),
+                 details::InferenceEngineException);
+}
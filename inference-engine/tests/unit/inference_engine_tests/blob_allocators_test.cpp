@@ -0,0 +1,103 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "pool_allocator.hpp"
+#include "hugepage_allocator.hpp"
+#include "numa_allocator.hpp"
+#include "page_aligned_allocator.hpp"
+#include "ie_plugin_config.hpp"
+#include "blob_factory.hpp"
+#include "details/ie_irelease.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class BlobAllocatorsTests: public ::testing::Test {
+};
+
+TEST_F(BlobAllocatorsTests, poolSizeClassesWasteAtMostAQuarter) {
+    ASSERT_EQ(4096, MemoryPool::sizeClass(1));
+    ASSERT_EQ(5 * 1024, MemoryPool::sizeClass(4097));
+    ASSERT_EQ(8 * 1024, MemoryPool::sizeClass(8 * 1024));
+    for (size_t size = 4096; size < (64 << 20); size = size * 3 / 2 + 1) {
+        const size_t sizeClass = MemoryPool::sizeClass(size);
+        ASSERT_GE(sizeClass, size);
+        ASSERT_LE(sizeClass - size, size / 4);
+    }
+}
+
+TEST_F(BlobAllocatorsTests, poolReusesReleasedBuffers) {
+    auto pool = std::make_shared<MemoryPool>();
+    std::shared_ptr<IAllocator> allocator = details::shared_from_irelease(new PoolAllocator(pool));
+    void* first = allocator->alloc(100000);
+    ASSERT_NE(nullptr, first);
+    ASSERT_TRUE(PageAlignedAllocator::isAligned(first));
+    ASSERT_TRUE(allocator->free(first));
+    ASSERT_EQ(MemoryPool::sizeClass(100000), pool->cachedBytes());
+
+    // the same size class takes the released buffer
+    void* second = allocator->alloc(99000);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(0, pool->cachedBytes());
+    ASSERT_TRUE(allocator->free(second));
+    ASSERT_FALSE(allocator->free(reinterpret_cast<void*>(&pool)));
+}
+
+TEST_F(BlobAllocatorsTests, poolFreesBuffersAboveCacheLimit) {
+    auto pool = std::make_shared<MemoryPool>(8192);
+    void* small = pool->take(8192);
+    void* large = pool->take(10000);
+    ASSERT_TRUE(pool->give(small));
+    ASSERT_TRUE(pool->give(large));
+    ASSERT_EQ(8192, pool->cachedBytes());
+}
+
+TEST_F(BlobAllocatorsTests, hugePageBuffersAreAlignedToHugePages) {
+    std::shared_ptr<IAllocator> allocator = details::shared_from_irelease(new HugePageAllocator());
+    for (size_t size : std::vector<size_t>{100, 2 * HugePageAllocator::hugePageSize + 1}) {
+        auto* data = static_cast<uint8_t*>(allocator->alloc(size));
+        ASSERT_NE(nullptr, data);
+        ASSERT_TRUE(PageAlignedAllocator::isAligned(data));
+        if (size >= HugePageAllocator::hugePageSize)
+            ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % HugePageAllocator::hugePageSize);
+        std::memset(data, 1, size);
+        ASSERT_EQ(1, data[size - 1]);
+        ASSERT_TRUE(allocator->free(data));
+    }
+}
+
+TEST_F(BlobAllocatorsTests, numaBuffersAreWritable) {
+    std::shared_ptr<IAllocator> allocator = details::shared_from_irelease(new NumaAllocator(NumaAllocator::currentNode()));
+    auto* data = static_cast<uint8_t*>(allocator->alloc(10000));
+    ASSERT_NE(nullptr, data);
+    std::memset(data, 1, 10000);
+    ASSERT_EQ(1, data[9999]);
+    ASSERT_TRUE(allocator->free(data));
+    ASSERT_FALSE(allocator->free(reinterpret_cast<void*>(&allocator)));
+}
+
+TEST_F(BlobAllocatorsTests, canCreateEveryConfiguredAllocator) {
+    for (auto kind : {PluginConfigParams::ALLOCATOR_SYSTEM, PluginConfigParams::ALLOCATOR_POOL,
+                      PluginConfigParams::ALLOCATOR_HUGEPAGES, PluginConfigParams::ALLOCATOR_NUMA}) {
+        IAllocator* allocator = CreateAllocator(kind);
+        ASSERT_NE(nullptr, allocator) << kind;
+        auto blob = make_blob_with_precision(TensorDesc(Precision::FP32, {1, 3, 5, 7}, Layout::NCHW),
+                                             details::shared_from_irelease(allocator));
+        blob->allocate();
+        float* data = blob->buffer().as<float*>();
+        ASSERT_NE(nullptr, data) << kind;
+        data[blob->size() - 1] = 1.0f;
+        ASSERT_EQ(1.0f, blob->cbuffer().as<const float*>()[blob->size() - 1]);
+    }
+    ASSERT_EQ(nullptr, CreateAllocator("UNKNOWN"));
+    ASSERT_EQ(nullptr, CreateAllocator(nullptr));
+}
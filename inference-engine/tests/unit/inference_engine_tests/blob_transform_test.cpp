@@ -0,0 +1,103 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "blob_transform.hpp"
+
+using namespace InferenceEngine;
+
+class BlobTransformTests : public ::testing::Test {
+protected:
+    // the strides of the descriptor are widened by the given paddings of the blocked dimensions
+    static TensorDesc padded(Precision prc, const SizeVector &dims, Layout layout, const SizeVector &pads) {
+        BlockingDesc blk = TensorDesc(prc, dims, layout).getBlockingDesc();
+        SizeVector blkDims = blk.getBlockDims();
+        SizeVector strides(blkDims.size());
+        size_t stride = 1;
+        for (size_t i = blkDims.size(); i-- > 0;) {
+            strides[i] = stride;
+            stride *= blkDims[i] + pads[i];
+        }
+        return TensorDesc(prc, dims, BlockingDesc(blkDims, blk.getOrder(), 3, SizeVector(blkDims.size(), 0), strides));
+    }
+
+    static SizeVector index(size_t i, const SizeVector &dims) {
+        SizeVector idx(dims.size());
+        for (size_t k = dims.size(); k-- > 0;) {
+            idx[k] = i % dims[k];
+            i /= dims[k];
+        }
+        return idx;
+    }
+
+    static size_t count(const SizeVector &dims) {
+        size_t n = 1;
+        for (auto dim : dims)
+            n *= dim;
+        return n;
+    }
+
+    static size_t span(const TensorDesc &desc) {
+        size_t last = 0;
+        for (size_t i = 0; i < count(desc.getDims()); i++)
+            last = std::max(last, desc.offset(index(i, desc.getDims())));
+        return last + 1;
+    }
+
+    template <typename T>
+    static void check(const TensorDesc &srcDesc, const TensorDesc &dstDesc) {
+        std::vector<T> srcData(span(srcDesc)), dstData(span(dstDesc));
+        for (size_t i = 0; i < srcData.size(); i++)
+            srcData[i] = static_cast<T>(i * 2654435761u >> 7);
+        auto src = make_shared_blob<T>(srcDesc, srcData.data(), srcData.size());
+        auto dst = make_shared_blob<T>(dstDesc, dstData.data(), dstData.size());
+
+        blob_copy(src, dst);
+
+        const SizeVector &dims = srcDesc.getDims();
+        for (size_t i = 0; i < count(dims); i++) {
+            SizeVector idx = index(i, dims);
+            ASSERT_EQ(srcData[srcDesc.offset(idx)], dstData[dstDesc.offset(idx)])
+                << "element " << i << " from " << srcDesc.getLayout() << " to " << dstDesc.getLayout();
+        }
+    }
+
+    template <typename T>
+    static void checkLayouts(Precision prc) {
+        for (SizeVector dims : {SizeVector{2, 3, 17, 33}, SizeVector{1, 16, 64, 64}, SizeVector{2, 40, 7, 130}}) {
+            for (Layout from : {NCHW, NHWC}) {
+                for (Layout to : {NCHW, NHWC}) {
+                    check<T>(TensorDesc(prc, dims, from), TensorDesc(prc, dims, to));
+                    check<T>(padded(prc, dims, from, {0, 1, 2, 3}), padded(prc, dims, to, {1, 0, 3, 1}));
+                }
+            }
+        }
+        for (SizeVector dims : {SizeVector{2, 3, 4, 17, 33}, SizeVector{1, 16, 8, 32, 32}}) {
+            for (Layout from : {NCDHW, NDHWC}) {
+                for (Layout to : {NCDHW, NDHWC})
+                    check<T>(TensorDesc(prc, dims, from), TensorDesc(prc, dims, to));
+            }
+        }
+
+        // nChw8c
+        SizeVector dims = {2, 16, 5, 7};
+        TensorDesc blocked(prc, dims, BlockingDesc({2, 2, 5, 7, 8}, {0, 1, 2, 3, 1}));
+        check<T>(TensorDesc(prc, dims, NCHW), blocked);
+        check<T>(blocked, TensorDesc(prc, dims, NHWC));
+    }
+};
+
+TEST_F(BlobTransformTests, copiesU8BetweenLayouts) {
+    checkLayouts<uint8_t>(Precision::U8);
+}
+
+TEST_F(BlobTransformTests, copiesU16BetweenLayouts) {
+    checkLayouts<uint16_t>(Precision::U16);
+}
+
+TEST_F(BlobTransformTests, copiesFP32BetweenLayouts) {
+    checkLayouts<float>(Precision::FP32);
+}
@@ -0,0 +1,115 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "cpp/ie_completion_queue.hpp"
+#include "cpp/ie_executable_network.hpp"
+#include "cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp"
+#include "cpp_interfaces/base/ie_executable_network_base.hpp"
+#include "details/ie_irelease.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+
+class FailingInferRequest : public InferRequestInternal {
+public:
+    FailingInferRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs)
+            : InferRequestInternal(networkInputs, networkOutputs) {
+        _inputs["in"] = make_shared_blob<float>(networkInputs["in"]->getTensorDesc());
+        _inputs["in"]->allocate();
+        _outputs["out"] = make_shared_blob<float>(networkOutputs["out"]->getTensorDesc());
+        _outputs["out"]->allocate();
+    }
+
+    /**
+     * @brief Fails if the first input element is negative
+     */
+    void InferImpl() override {
+        if (_inputs["in"]->cbuffer().as<const float *>()[0] < 0) THROW_IE_EXCEPTION << "Negative input";
+    }
+
+    void GetPerformanceCounts(map<string, InferenceEngineProfileInfo> &) const override {}
+};
+
+class FailingExecutableNetwork : public ExecutableNetworkThreadSafeDefault {
+public:
+    FailingExecutableNetwork() {
+        InputInfo::Ptr input(new InputInfo());
+        input->setInputData(make_shared<Data>("in", TensorDesc(Precision::FP32, {1, 3}, Layout::NC)));
+        _networkInputs["in"] = input;
+        _networkOutputs["out"] = make_shared<Data>("out", TensorDesc(Precision::FP32, {1, 3}, Layout::NC));
+    }
+
+    InferRequestInternal::Ptr CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                     OutputsDataMap networkOutputs) override {
+        return make_shared<FailingInferRequest>(networkInputs, networkOutputs);
+    }
+};
+
+}  // namespace
+
+class CompletionQueueTests : public ::testing::Test {
+protected:
+    ExecutableNetwork network {details::shared_from_irelease(
+            new ExecutableNetworkBase<ExecutableNetworkInternal>(make_shared<FailingExecutableNetwork>()))};
+
+    size_t addRequest(CompletionQueue &queue, float value) {
+        auto request = network.CreateInferRequest();
+        request.GetBlob("in")->buffer().as<float *>()[0] = value;
+        return queue.add(request);
+    }
+};
+
+TEST_F(CompletionQueueTests, waitAnyReturnsEveryCompletionOnce) {
+    CompletionQueue queue;
+    vector<size_t> ids;
+    for (int i = 0; i < 4; i++) {
+        ids.push_back(addRequest(queue, 1.0f));
+        queue.startAsync(ids.back());
+    }
+    vector<size_t> completed;
+    CompletionQueue::Completion completion;
+    while (completed.size() < ids.size()) {
+        ASSERT_TRUE(queue.waitAny(completion));
+        ASSERT_EQ(OK, completion.second);
+        completed.push_back(completion.first);
+    }
+    sort(completed.begin(), completed.end());
+    ASSERT_EQ(ids, completed);
+    ASSERT_FALSE(queue.waitAny(completion, 0));
+}
+
+TEST_F(CompletionQueueTests, waitAllReportsFailedRequests) {
+    CompletionQueue queue;
+    auto good = addRequest(queue, 1.0f);
+    auto bad = addRequest(queue, -1.0f);
+    queue.startAsync(good);
+    queue.startAsync(bad);
+
+    auto completed = queue.waitAll();
+    ASSERT_EQ(2, completed.size());
+    for (auto &&completion : completed) {
+        ASSERT_EQ(completion.first == bad ? GENERAL_ERROR : OK, completion.second);
+    }
+}
+
+TEST_F(CompletionQueueTests, requestCanBeRestartedAfterCompletion) {
+    CompletionQueue queue;
+    auto id = addRequest(queue, 1.0f);
+    CompletionQueue::Completion completion;
+    for (int i = 0; i < 3; i++) {
+        queue.startAsync(id);
+        ASSERT_TRUE(queue.waitAny(completion));
+        ASSERT_EQ(id, completion.first);
+    }
+    ASSERT_TRUE(queue.waitAll().empty());
+}
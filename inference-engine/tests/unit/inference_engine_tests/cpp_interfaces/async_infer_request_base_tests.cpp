@@ -183,6 +183,22 @@ TEST_F(InferRequestBaseTests, canCatchUnknownErrorInSetBlob) {
     ASSERT_EQ(UNEXPECTED, request->SetBlob(nullptr, data, nullptr));
 }
 
+// SetRoiBlobs
+TEST_F(InferRequestBaseTests, canForwardSetRoiBlobs) {
+    Blob::Ptr frame;
+    std::vector<ROI> rois = {{0, 1, 2, 3, 4}};
+    const char *name = "";
+    EXPECT_CALL(*mock_impl.get(), SetRoiBlobs(name, Ref(frame), Ref(rois))).Times(1);
+    ASSERT_EQ(OK, request->SetRoiBlobs(name, frame, rois, &dsc));
+}
+
+TEST_F(InferRequestBaseTests, canReportErrorInSetRoiBlobs) {
+    EXPECT_CALL(*mock_impl.get(), SetRoiBlobs(_, _, _)).WillOnce(Throw(std::runtime_error("compare")));
+    Blob::Ptr frame;
+    ASSERT_NE(request->SetRoiBlobs(nullptr, frame, {}, &dsc), OK);
+    ASSERT_STREQ(dsc.msg, "compare");
+}
+
 // SetCompletionCallback
 TEST_F(InferRequestBaseTests, canForwardSetCompletionCallback) {
     InferenceEngine::IInferRequest::CompletionCallback callback = nullptr;
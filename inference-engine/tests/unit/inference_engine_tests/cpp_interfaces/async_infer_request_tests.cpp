@@ -201,6 +201,24 @@ TEST_F(InferRequestTests, throwsIfSetBlobReturnNotOK) {
     ASSERT_THROW(requestWrapper->SetBlob(name, blob), InferenceEngineException);
 }
 
+// SetRoiBlobs
+TEST_F(InferRequestTests, canForwardSetRoiBlobs) {
+    Blob::Ptr frame;
+    std::vector<ROI> rois = {{0, 0, 0, 2, 2}};
+    std::string name = "blob1";
+
+    EXPECT_CALL(*mock_request.get(), SetRoiBlobs(StrEq(name.c_str()), frame, _, _)).WillOnce(Return(OK));
+    ASSERT_NO_THROW(requestWrapper->SetRoiBlobs(name, frame, rois));
+}
+
+TEST_F(InferRequestTests, throwsIfSetRoiBlobsReturnNotOK) {
+    Blob::Ptr frame;
+    std::string name = "blob1";
+
+    EXPECT_CALL(*mock_request.get(), SetRoiBlobs(_, _, _, _)).WillOnce(Return(GENERAL_ERROR));
+    ASSERT_THROW(requestWrapper->SetRoiBlobs(name, frame, {}), InferenceEngineException);
+}
+
 TEST_F(InferRequestTests, throwsIfSetOutputReturnNotOK) {
     EXPECT_CALL(*mock_request.get(), SetBlob(_, _, _)).WillOnce(Return(GENERAL_ERROR));
     BlobMap blobMap{{{}, {}}};
@@ -216,3 +216,91 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+// SetPriority
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetPriority) {
+    testRequest->setRequestBusy();
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->SetPriority(1, 0); }, REQUEST_BUSY_str));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, throwsOnNegativeDeadline) {
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->SetPriority(0, -1); },
+                                               PARAMETER_MISMATCH_str));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, requestIsNotInferredIfDeadlineExpiredInQueue) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    // the executor is kept busy past the deadline of the request
+    auto blockingTask = std::make_shared<Task>([]() { std::this_thread::sleep_for(std::chrono::milliseconds(50)); });
+    taskExecutor->startTask(blockingTask);
+
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(0);
+    testRequest->SetPriority(0, 1);
+    testRequest->StartAsync();
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() {
+        testRequest->Wait(IInferRequest::WaitMode::RESULT_READY);
+    }, "deadline"));
+}
+
+// Metrics
+TEST_F(InferRequestThreadSafeDefaultTests, asyncRequestRecordsItsStagesToMetrics) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+    auto metrics = std::make_shared<MetricsRegistry>();
+    mockInferRequestInternal->setMetricsRegistry(metrics);
+
+    testRequest->SetCompletionCallback([](InferenceEngine::IInferRequest::Ptr request, StatusCode status) {});
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+
+    testRequest->StartAsync();
+    testRequest->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+
+    auto snapshot = metrics->snapshot();
+    ASSERT_EQ(1u, snapshot["Requests"].count);
+    ASSERT_EQ(0u, snapshot["FailedRequests"].count);
+    ASSERT_EQ(1u, snapshot["QueueWait"].count);
+    ASSERT_EQ(1u, snapshot["Infer"].count);
+    ASSERT_EQ(1u, snapshot["Callback"].count);
+    // there is no preprocessing of the inputs to time
+    ASSERT_EQ(0u, snapshot["Preprocessing"].count);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, failedAndExpiredRequestsAreCounted) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+    auto metrics = std::make_shared<MetricsRegistry>();
+    mockInferRequestInternal->setMetricsRegistry(metrics);
+
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).WillOnce(Throw(std::exception()));
+    testRequest->StartAsync();
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
+
+    auto blockingTask = std::make_shared<Task>([]() { std::this_thread::sleep_for(std::chrono::milliseconds(50)); });
+    taskExecutor->startTask(blockingTask);
+    testRequest->SetPriority(0, 1);
+    testRequest->StartAsync();
+    EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
+
+    auto snapshot = metrics->snapshot();
+    ASSERT_EQ(1u, snapshot["Requests"].count);
+    ASSERT_EQ(1u, snapshot["FailedRequests"].count);
+    ASSERT_EQ(1u, snapshot["ExpiredRequests"].count);
+    ASSERT_EQ(2u, snapshot["QueueWait"].count);
+}
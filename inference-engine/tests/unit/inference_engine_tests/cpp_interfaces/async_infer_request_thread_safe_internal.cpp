@@ -117,6 +117,13 @@ TEST_F(AsyncInferRequestThreadSafeInternalTests, returnRequestBusyOnSetBlob) {
     ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->SetBlob(nullptr, nullptr); }, REQUEST_BUSY_str));
 }
 
+// SetRoiBlobs
+TEST_F(AsyncInferRequestThreadSafeInternalTests, returnRequestBusyOnSetRoiBlobs) {
+    testRequest->setRequestBusy();
+    ASSERT_TRUE(_doesThrowExceptionWithMessage([this]() { testRequest->SetRoiBlobs(nullptr, nullptr, {}); },
+                                               REQUEST_BUSY_str));
+}
+
 // SetCompletionCallback
 TEST_F(AsyncInferRequestThreadSafeInternalTests, returnRequestBusyOnSetCompletionCallback) {
     testRequest->setRequestBusy();
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 #include <cpp_interfaces/ie_executor_manager.hpp>
+#include <cpp_interfaces/ie_thread_pool_task_executor.hpp>
 #include <ie_device.hpp>
 
 using namespace ::testing;
@@ -46,3 +47,27 @@ TEST_F(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST_F(ExecutorManagerTests, returnTheSameThreadPoolExecutorForTheSameId) {
+    auto executor1 = _manager.getThreadPoolExecutor("Callbacks", 2);
+    auto executor2 = _manager.getThreadPoolExecutor("Callbacks", 2);
+    auto executor = _manager.getExecutor("Callbacks");
+
+    ASSERT_EQ(executor1, executor2);
+    ASSERT_NE(executor, executor1);
+    ASSERT_EQ(2, _manager.getExecutorsNumber());
+}
+
+TEST_F(ExecutorManagerTests, threadPoolExecutorsAreCappedByThreadsLimit) {
+    _manager.setThreadsLimit(2);
+    auto executor = std::dynamic_pointer_cast<ThreadPoolTaskExecutor>(_manager.getThreadPoolExecutor("Callbacks", 8));
+    auto defaultExecutor = std::dynamic_pointer_cast<ThreadPoolTaskExecutor>(_manager.getThreadPoolExecutor("Default", 0));
+    ASSERT_EQ(2, _manager.getThreadsLimit());
+    _manager.setThreadsLimit(0);
+
+    ASSERT_NE(nullptr, executor);
+    ASSERT_NE(nullptr, defaultExecutor);
+    ASSERT_EQ(2, executor->getThreadsNum());
+    ASSERT_EQ(2, defaultExecutor->getThreadsNum());
+    ASSERT_EQ(0, _manager.getThreadsLimit());
+}
@@ -167,6 +167,128 @@ TEST_F(InferenceEnginePluginInternalTest, failToSetNotAllocatedBlob) {
     ASSERT_EQ(refError, dsc.msg);
 }
 
+class RoisInferRequest : public MockInferRequestInternal {
+public:
+    RoisInferRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs)
+            : MockInferRequestInternal(networkInputs, networkOutputs) {
+        for (auto &&input : _networkInputs) {
+            _inputs[input.first] = make_blob_with_precision(input.second->getTensorDesc());
+            _inputs[input.first]->allocate();
+        }
+    }
+
+    BlobMap &getInputs() {
+        return _inputs;
+    }
+
+    void convertInPreprocessing() {
+        _convertInPreprocessing = true;
+    }
+};
+
+class InferRequestInternalRoisTest : public ::testing::Test {
+protected:
+    const std::string inputName = "input";
+    const std::string outputName = "output";
+    shared_ptr<RoisInferRequest> request;
+
+    void createRequest(ResizeAlgorithm algorithm, size_t batch = 3, Precision precision = Precision::U8,
+                       MeanVariant meanVariant = NONE) {
+        auto inputInfo = make_shared<InputInfo>();
+        inputInfo->setInputData(make_shared<Data>(inputName, TensorDesc(precision, {batch, 1, 2, 2}, NCHW)));
+        inputInfo->getPreProcess().setResizeAlgorithm(algorithm);
+        if (meanVariant != NONE) {
+            inputInfo->getPreProcess().init(1);
+            inputInfo->getPreProcess()[0]->meanValue = 2.f;
+            inputInfo->getPreProcess()[0]->stdScale = 0.5f;
+            inputInfo->getPreProcess().setVariant(meanVariant);
+        }
+        InputsDataMap inputs = {{inputName, inputInfo}};
+        OutputsDataMap outputs = {{outputName, make_shared<Data>(outputName,
+                                                                 TensorDesc(Precision::FP32, {batch, 1}, NC))}};
+        request = make_shared<RoisInferRequest>(inputs, outputs);
+    }
+
+    // the frame 4x4 with the constant top left quadrant 10 and the constant bottom right quadrant 20
+    Blob::Ptr createFrame() {
+        auto frame = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 4, 4}, NCHW));
+        frame->allocate();
+        auto *data = frame->buffer().as<uint8_t *>();
+        for (size_t y = 0; y < 4; y++) {
+            for (size_t x = 0; x < 4; x++) {
+                data[y * 4 + x] = y < 2 && x < 2 ? 10 : y >= 2 && x >= 2 ? 20 : 0;
+            }
+        }
+        return frame;
+    }
+};
+
+TEST_F(InferRequestInternalRoisTest, canResizeRoisOfFrameToBatches) {
+    createRequest(RESIZE_BILINEAR);
+    auto frame = createFrame();
+    auto &input = request->getInputs()[inputName];
+    std::fill_n(input->buffer().as<uint8_t *>(), input->size(), 7);
+
+    ASSERT_NO_THROW(request->SetRoiBlobs(inputName.c_str(), frame, {{0, 0, 0, 2, 2}, {1, 2, 2, 2, 2}}));
+    Blob::Ptr roiBlob;
+    ASSERT_NO_THROW(request->GetBlob(inputName.c_str(), roiBlob));
+    ASSERT_EQ(frame, roiBlob);
+
+    ASSERT_NO_THROW(request->execDataPreprocessing(request->getInputs()));
+    const auto *data = input->cbuffer().as<const uint8_t *>();
+    // the batch after the last ROI is left intact
+    const std::vector<uint8_t> ref = {10, 10, 10, 10, 20, 20, 20, 20, 7, 7, 7, 7};
+    ASSERT_EQ(ref, std::vector<uint8_t>(data, data + input->size()));
+}
+
+TEST_F(InferRequestInternalRoisTest, failToSetRoiBlobsWithoutResizeAlgorithm) {
+    createRequest(NO_RESIZE);
+    ASSERT_THROW(request->SetRoiBlobs(inputName.c_str(), createFrame(), {{0, 0, 0, 2, 2}}), InferenceEngineException);
+}
+
+TEST_F(InferRequestInternalRoisTest, failToSetMoreRoisThanBatch) {
+    createRequest(RESIZE_BILINEAR, 1);
+    ASSERT_THROW(request->SetRoiBlobs(inputName.c_str(), createFrame(), {{0, 0, 0, 2, 2}, {1, 2, 2, 2, 2}}),
+                 InferenceEngineException);
+}
+
+TEST_F(InferRequestInternalRoisTest, failToSetRoiBlobsToOutput) {
+    createRequest(RESIZE_BILINEAR);
+    ASSERT_THROW(request->SetRoiBlobs(outputName.c_str(), createFrame(), {{0, 0, 0, 2, 2}}), InferenceEngineException);
+}
+
+TEST_F(InferRequestInternalRoisTest, canConvertAndNormalizeU8BlobOfFP32Input) {
+    createRequest(RESIZE_BILINEAR, 1, Precision::FP32, MEAN_VALUE);
+    request->convertInPreprocessing();
+    ASSERT_FALSE(request->isNormalizedByPreprocessing(inputName));
+
+    ASSERT_NO_THROW(request->SetBlob(inputName.c_str(), createFrame()));
+    ASSERT_TRUE(request->isNormalizedByPreprocessing(inputName));
+    ASSERT_NO_THROW(request->execDataPreprocessing(request->getInputs()));
+    // the quadrants are resized to the pixels, then the mean 2 is subtracted and the result is divided by the scale
+    auto &input = request->getInputs()[inputName];
+    const auto *data = input->cbuffer().as<const float *>();
+    ASSERT_EQ(std::vector<float>({16.f, -4.f, -4.f, 36.f}), std::vector<float>(data, data + input->size()));
+}
+
+TEST_F(InferRequestInternalRoisTest, canConvertU8BlobOfFP32InputWithoutMeanValues) {
+    createRequest(RESIZE_BILINEAR, 1, Precision::FP32);
+    request->convertInPreprocessing();
+
+    ASSERT_NO_THROW(request->SetBlob(inputName.c_str(), createFrame()));
+    // the plugin still applies the mean image of the input itself
+    ASSERT_FALSE(request->isNormalizedByPreprocessing(inputName));
+    ASSERT_NO_THROW(request->execDataPreprocessing(request->getInputs()));
+    auto &input = request->getInputs()[inputName];
+    const auto *data = input->cbuffer().as<const float *>();
+    ASSERT_EQ(std::vector<float>({10.f, 0.f, 0.f, 20.f}), std::vector<float>(data, data + input->size()));
+}
+
+TEST_F(InferRequestInternalRoisTest, failToSetU8BlobOfFP32InputWithoutConversion) {
+    createRequest(RESIZE_BILINEAR, 1, Precision::FP32);
+    ASSERT_THROW(request->SetBlob(inputName.c_str(), createFrame()), InferenceEngineException);
+}
+
 class InferenceEnginePluginInternal2Test : public ::testing::Test {
 protected:
     shared_ptr<IInferencePlugin> plugin;
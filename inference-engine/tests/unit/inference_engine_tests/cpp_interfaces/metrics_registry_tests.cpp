@@ -0,0 +1,116 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <cpp_interfaces/ie_metrics.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class MetricsRegistryTests : public ::testing::Test {
+};
+
+TEST_F(MetricsRegistryTests, bucketsArePowersOfTwoOfMicroseconds) {
+    ASSERT_EQ(0u, MetricHistogram::bucketOf(0));
+    ASSERT_EQ(1u, MetricHistogram::bucketOf(1));
+    ASSERT_EQ(2u, MetricHistogram::bucketOf(2));
+    ASSERT_EQ(2u, MetricHistogram::bucketOf(3));
+    ASSERT_EQ(3u, MetricHistogram::bucketOf(4));
+    ASSERT_EQ(10u, MetricHistogram::bucketOf(1023));
+    ASSERT_EQ(11u, MetricHistogram::bucketOf(1024));
+    // the longest samples are kept in the last bucket
+    const size_t last = MetricHistogram::BUCKETS_NUM - 1;
+    ASSERT_EQ(last, MetricHistogram::bucketOf(~0ull));
+}
+
+TEST_F(MetricsRegistryTests, recordsOfAllThreadsAreSummed) {
+    MetricsRegistry metrics;
+    const size_t threadsNum = 4, recordsNum = 1000;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&] {
+            for (size_t i = 0; i < recordsNum; i++) {
+                metrics.increment(MetricsRegistry::REQUESTS);
+                metrics.record(MetricsRegistry::INFER, 0, 3);
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    auto snapshot = metrics.snapshot();
+    ASSERT_EQ(InferenceEngineMetricInfo::COUNTER, snapshot["Requests"].type);
+    ASSERT_EQ(threadsNum * recordsNum, snapshot["Requests"].count);
+    auto infer = snapshot["Infer"];
+    ASSERT_EQ(InferenceEngineMetricInfo::HISTOGRAM, infer.type);
+    ASSERT_EQ(threadsNum * recordsNum, infer.count);
+    ASSERT_EQ(3 * threadsNum * recordsNum, infer.sum_uSec);
+    ASSERT_EQ(threadsNum * recordsNum, infer.buckets[2]);
+}
+
+TEST_F(MetricsRegistryTests, streamsAreReportedOnlyForSeveralStreams) {
+    auto single = MetricsRegistry(1).snapshot();
+    ASSERT_EQ(single.end(), single.find("Infer.stream0"));
+
+    MetricsRegistry metrics(2);
+    metrics.record(MetricsRegistry::INFER, 0, 5);
+    metrics.record(MetricsRegistry::INFER, 1, 100);
+    // the streams beyond the ones of the network wrap around
+    metrics.record(MetricsRegistry::INFER, 3, 1);
+    auto snapshot = metrics.snapshot();
+    ASSERT_EQ(1u, snapshot["Infer.stream0"].count);
+    ASSERT_EQ(2u, snapshot["Infer.stream1"].count);
+    ASSERT_EQ(101u, snapshot["Infer.stream1"].sum_uSec);
+    ASSERT_EQ(3u, snapshot["Infer"].count);
+    ASSERT_EQ(0u, snapshot["Callback.stream1"].count);
+}
+
+TEST_F(MetricsRegistryTests, scopeIsAttributedToStreamOfThread) {
+    MetricsRegistry metrics(2);
+    std::thread([&] {
+        MetricsRegistry::setCurrentStream(1);
+        MetricsRegistry::Scope scope(&metrics, MetricsRegistry::PREPROCESSING);
+    }).join();
+    ASSERT_EQ(0, MetricsRegistry::currentStream());
+
+    auto snapshot = metrics.snapshot();
+    ASSERT_EQ(0u, snapshot["Preprocessing.stream0"].count);
+    ASSERT_EQ(1u, snapshot["Preprocessing.stream1"].count);
+}
+
+TEST_F(MetricsRegistryTests, loadPhasesAreAccumulated) {
+    LoadPhaseReport report;
+    report.record("PrimitivesCreation", 300);
+    report.record("WeightsReorders", 10);
+    report.record("WeightsReorders", 20);
+    auto snapshot = report.snapshot();
+    ASSERT_EQ(2u, snapshot.size());
+    ASSERT_EQ(InferenceEngineMetricInfo::HISTOGRAM, snapshot["Load.WeightsReorders"].type);
+    ASSERT_EQ(2u, snapshot["Load.WeightsReorders"].count);
+    ASSERT_EQ(30u, snapshot["Load.WeightsReorders"].sum_uSec);
+    ASSERT_EQ(1u, snapshot["Load.PrimitivesCreation"].count);
+}
+
+TEST_F(MetricsRegistryTests, loadPhaseScopeRecordsToReportOfThread) {
+    LoadPhaseReport report;
+    {
+        // does nothing outside of a load
+        LoadPhaseScope scope("Edges");
+    }
+    std::thread([&] {
+        LoadPhaseReport::Binding binding(&report);
+        LoadPhaseScope scope("Edges");
+        {
+            LoadPhaseReport nested;
+            LoadPhaseReport::Binding nestedBinding(&nested);
+            LoadPhaseScope nestedScope("Edges");
+        }
+        ASSERT_EQ(&report, LoadPhaseReport::current());
+    }).join();
+    ASSERT_EQ(nullptr, LoadPhaseReport::current());
+    ASSERT_EQ(1u, report.snapshot()["Load.Edges"].count);
+}
@@ -223,3 +223,33 @@ TEST_F(TaskExecutorTests, callWaitOnTaskDtorIfProcessed) {
     isBlocked = false;
     cv_block_emulation.notify_all();
 }
+
+TEST_F(TaskExecutorTests, higherPriorityTasksGoAheadOfWaitingOnes) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool isBlocked = true;
+    auto blockingTask = make_shared<Task>([&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&isBlocked]() { return !isBlocked; });
+    });
+    taskExecutor->startTask(blockingTask);
+
+    std::vector<int> order;
+    std::vector<Task::Ptr> tasks;
+    for (int priority : std::vector<int>{0, 2, 0, 1, 2}) {
+        int id = static_cast<int>(tasks.size());
+        tasks.push_back(make_shared<Task>([&order, id]() { order.push_back(id); }));
+        tasks.back()->setPriority(priority);
+        taskExecutor->startTask(tasks.back());
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isBlocked = false;
+    }
+    cv.notify_all();
+    for (auto &&task : tasks) {
+        ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+    }
+    ASSERT_EQ((std::vector<int>{1, 4, 3, 0, 2}), order);
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cpp_interfaces/ie_thread_pool_task_executor.hpp>
+#include <ie_common.h>
+#include <atomic>
+#include <vector>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class ThreadPoolTaskExecutorTests : public ::testing::Test {};
+
+TEST_F(ThreadPoolTaskExecutorTests, canCreateThreadPoolTaskExecutor) {
+    ThreadPoolTaskExecutor::Ptr taskExecutor;
+    ASSERT_NO_THROW(taskExecutor = std::make_shared<ThreadPoolTaskExecutor>("Test", 3));
+    ASSERT_EQ(3, taskExecutor->getThreadsNum());
+}
+
+TEST_F(ThreadPoolTaskExecutorTests, canCatchException) {
+    auto taskExecutor = std::make_shared<ThreadPoolTaskExecutor>("Test", 2);
+    auto task = std::make_shared<Task>([]() {
+        THROW_IE_EXCEPTION;
+    });
+    taskExecutor->startTask(task);
+    auto status = task->wait(-1);
+    ASSERT_EQ(status, Task::Status::TS_ERROR);
+    EXPECT_THROW(task->checkException(), InferenceEngineException);
+}
+
+TEST_F(ThreadPoolTaskExecutorTests, cannotStartBusyTask) {
+    auto taskExecutor = std::make_shared<ThreadPoolTaskExecutor>("Test", 1);
+    std::atomic<bool> release(false);
+    auto task = std::make_shared<Task>([&release]() {
+        while (!release) std::this_thread::yield();
+    });
+    ASSERT_TRUE(taskExecutor->startTask(task));
+    ASSERT_FALSE(taskExecutor->startTask(task));
+    release = true;
+    ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+}
+
+TEST_F(ThreadPoolTaskExecutorTests, runsAllTasksFromManyThreads) {
+    // more tasks than the queue holds with no spinning to check the sleeping and the wakeups
+    auto taskExecutor = std::make_shared<ThreadPoolTaskExecutor>("Test", 4, 0);
+    const size_t tasksPerThread = 1000;
+    std::atomic<size_t> counter(0);
+    std::vector<std::thread> producers;
+    std::vector<std::vector<Task::Ptr>> tasks(4);
+    for (auto &&threadTasks : tasks) {
+        for (size_t i = 0; i < tasksPerThread; i++) {
+            threadTasks.push_back(std::make_shared<Task>([&counter]() { counter++; }));
+        }
+        producers.emplace_back([&taskExecutor, &threadTasks]() {
+            for (auto &&task : threadTasks) {
+                taskExecutor->startTask(task);
+            }
+        });
+    }
+    for (auto &&producer : producers) {
+        producer.join();
+    }
+    for (auto &&threadTasks : tasks) {
+        for (auto &&task : threadTasks) {
+            ASSERT_EQ(Task::Status::TS_DONE, task->wait(-1));
+        }
+    }
+    ASSERT_EQ(4 * tasksPerThread, counter);
+}
+
+TEST_F(ThreadPoolTaskExecutorTests, finishesQueuedTasksOnDestruction) {
+    std::atomic<size_t> counter(0);
+    std::vector<Task::Ptr> tasks;
+    {
+        ThreadPoolTaskExecutor taskExecutor("Test", 2);
+        for (size_t i = 0; i < 100; i++) {
+            tasks.push_back(std::make_shared<Task>([&counter]() { counter++; }));
+            taskExecutor.startTask(tasks.back());
+        }
+    }
+    ASSERT_EQ(100, counter);
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "mmap_allocator.hpp"
+#include "details/ie_irelease.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class MmapAllocatorTests: public ::testing::Test {
+protected:
+    virtual void TearDown() {
+        std::remove(fileName.c_str());
+    }
+
+    virtual void SetUp() {
+        content.resize(10000);
+        for (size_t i = 0; i < content.size(); i++)
+            content[i] = static_cast<char>(i % 127);
+
+        std::ofstream file(fileName, std::ios::binary);
+        file.write(content.data(), content.size());
+        file.close();
+
+        allocator = details::shared_from_irelease(new MmapAllocator(fileName));
+    }
+
+    std::string fileName = "mmap_allocator_test.bin";
+    std::vector<char> content;
+    std::shared_ptr<IAllocator> allocator;
+};
+
+TEST_F(MmapAllocatorTests, canMapFile) {
+    void* handle = allocator->alloc(content.size());
+    ASSERT_NE(nullptr, handle);
+
+    char * ptr = static_cast<char *>(allocator->lock(handle, LOCK_FOR_READ));
+    for (size_t i = 0; i < content.size(); i++)
+        ASSERT_EQ(content[i], ptr[i]);
+    allocator->unlock(ptr);
+    ASSERT_TRUE(allocator->free(handle));
+}
+
+TEST_F(MmapAllocatorTests, writesAreNotPropagatedToFile) {
+    void* handle = allocator->alloc(content.size());
+    ASSERT_NE(nullptr, handle);
+
+    char * ptr = static_cast<char *>(allocator->lock(handle));
+    ptr[9999] = 11;
+    ASSERT_EQ(ptr[9999], 11);
+    allocator->unlock(ptr);
+    allocator->free(handle);
+
+    std::ifstream file(fileName, std::ios::binary);
+    std::vector<char> read(content.size());
+    file.read(read.data(), read.size());
+    ASSERT_EQ(content, read);
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMoreThanFileSize) {
+    ASSERT_EQ(nullptr, allocator->alloc(content.size() + 1));
+}
+
+TEST_F(MmapAllocatorTests, cannotMapMissingFile) {
+    std::shared_ptr<IAllocator> missing = details::shared_from_irelease(new MmapAllocator("no_such_file.bin"));
+    ASSERT_EQ(nullptr, missing->alloc(100));
+}
@@ -0,0 +1,139 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <net_pass.h>
+#include <cnn_network_impl.hpp>
+#include "tests_common.hpp"
+#include "ir_gen_helper.hpp"
+
+using namespace ::testing;
+using namespace single_layer_tests;
+using namespace InferenceEngine;
+
+class NetPassTests: public TestsCommon {
+protected:
+    std::string port(size_t id, size_t channels) {
+        std::string p = R"V0G0N(
+                <port id="_ID_">
+                    <dim>1</dim>
+                    <dim>_C_</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>)V0G0N";
+        REPLACE_WITH_NUM(p, "_ID_", id);
+        REPLACE_WITH_NUM(p, "_C_", channels);
+        return p;
+    }
+
+    std::string relu(size_t id, const std::string &name) {
+        return "<layer id=\"" + std::to_string(id) + "\" name=\"" + name + "\" precision=\"FP32\" type=\"ReLU\">"
+               "<input>" + port(0, 3) + "</input><output>" + port(1, 3) + "</output></layer>\n";
+    }
+
+    std::string conv(size_t id, const std::string &name, size_t offset) {
+        return "<layer id=\"" + std::to_string(id) + "\" name=\"" + name + "\" precision=\"FP32\" type=\"Convolution\">"
+               "<data group=\"1\" kernel=\"1,1\" output=\"2\" pads_begin=\"0,0\" pads_end=\"0,0\" strides=\"1,1\"/>"
+               "<input>" + port(0, 3) + "</input><output>" + port(1, 2) + "</output>"
+               "<blobs><weights offset=\"" + std::to_string(offset) + "\" size=\"24\"/>"
+               "<biases offset=\"" + std::to_string(offset + 24) + "\" size=\"8\"/></blobs></layer>\n";
+    }
+
+    std::string edge(size_t from, size_t fromPort, size_t to, size_t toPort) {
+        return "<edge from-layer=\"" + std::to_string(from) + "\" from-port=\"" + std::to_string(fromPort) +
+               "\" to-layer=\"" + std::to_string(to) + "\" to-port=\"" + std::to_string(toPort) + "\"/>\n";
+    }
+
+    // in1 -> relu_1 -> conv_1 -> sum
+    //    \-> relu_2 -> conv_2 -/
+    //          relu_1 -> conv_3 (other weights)
+    CNNNetwork getNetwork() {
+        std::string layers = relu(1, "relu_1") + relu(2, "relu_2") + conv(3, "conv_1", 0) + conv(4, "conv_2", 0) +
+                             conv(5, "conv_3", 32) +
+                             "<layer id=\"6\" name=\"sum\" precision=\"FP32\" type=\"Eltwise\">"
+                             "<data operation=\"sum\"/><input>" + port(0, 2) + port(1, 2) + "</input>"
+                             "<output>" + port(2, 2) + "</output></layer>\n";
+        std::string edges = edge(0, 0, 1, 0) + edge(0, 0, 2, 0) + edge(1, 1, 3, 0) + edge(2, 1, 4, 0) +
+                            edge(1, 1, 5, 0) + edge(3, 1, 6, 0) + edge(4, 1, 6, 1);
+        std::string model = IRTemplateGenerator::getIRTemplate("Duplicates", {1, 3, 4, 4}, "FP32", layers, edges);
+
+        CNNNetReader net_reader;
+        net_reader.ReadNetwork(model.data(), model.length());
+
+        TBlob<uint8_t>::Ptr weights(new TBlob<uint8_t>(Precision::U8, C, {64}));
+        weights->allocate();
+        float *data = weights->buffer().as<float *>();
+        for (size_t i = 0; i < 16; i++)
+            data[i] = 0.1f * i;
+        net_reader.SetWeights(weights);
+        return net_reader.getNetwork();
+    }
+
+    bool hasLayer(CNNNetwork &network, const std::string &name) {
+        CNNLayerPtr layer;
+        return static_cast<ICNNNetwork &>(network).getLayerByName(name.c_str(), layer, nullptr) == OK;
+    }
+};
+
+TEST_F(NetPassTests, duplicatedBranchesAreMerged) {
+    auto network = getNetwork();
+    ASSERT_TRUE(NetPass::MergeDuplicatedLayers(network));
+
+    // either of the equal layers is kept
+    ASSERT_NE(hasLayer(network, "relu_1"), hasLayer(network, "relu_2"));
+    ASSERT_NE(hasLayer(network, "conv_1"), hasLayer(network, "conv_2"));
+    // the convolution with the other weights is kept
+    ASSERT_TRUE(hasLayer(network, "conv_3"));
+
+    auto sum = network.getLayerByName("sum");
+    auto conv = network.getLayerByName(hasLayer(network, "conv_1") ? "conv_1" : "conv_2");
+    auto relu = network.getLayerByName(hasLayer(network, "relu_1") ? "relu_1" : "relu_2");
+    ASSERT_EQ(2, sum->insData.size());
+    ASSERT_EQ(conv->outData[0], sum->insData[0].lock());
+    ASSERT_EQ(conv->outData[0], sum->insData[1].lock());
+    ASSERT_EQ(1, conv->outData[0]->getInputTo().size());
+    ASSERT_EQ(relu->outData[0], conv->insData[0].lock());
+    ASSERT_EQ(relu->outData[0], network.getLayerByName("conv_3")->insData[0].lock());
+    ASSERT_EQ(2, relu->outData[0]->getInputTo().size());
+    ASSERT_EQ(1, network.getInputsInfo().begin()->second->getInputData()->getInputTo().size());
+
+    // the second run finds nothing to merge
+    ASSERT_FALSE(NetPass::MergeDuplicatedLayers(network));
+}
+
+TEST_F(NetPassTests, layersProducingOutputsAreKept) {
+    auto network = getNetwork();
+    network.addOutput("conv_1");
+    network.addOutput("conv_2");
+    NetPass::MergeDuplicatedLayers(network);
+
+    ASSERT_TRUE(hasLayer(network, "conv_1"));
+    ASSERT_TRUE(hasLayer(network, "conv_2"));
+    ASSERT_NE(hasLayer(network, "relu_1"), hasLayer(network, "relu_2"));
+}
+
+TEST_F(NetPassTests, deadBranchIsRemoved) {
+    auto network = getNetwork();
+    auto impl = dynamic_cast<details::CNNNetworkImpl *>(&static_cast<ICNNNetwork &>(network));
+    ASSERT_NE(nullptr, impl);
+
+    // a branch nobody reads: it is not a network output and has no consumers
+    auto relu = network.getLayerByName("relu_1");
+    CNNLayerPtr dead(new CNNLayer({"dead", "ReLU", Precision::FP32}));
+    DataPtr deadData(new Data("dead", relu->outData[0]->getTensorDesc()));
+    deadData->getCreatorLayer() = dead;
+    dead->outData.push_back(deadData);
+    dead->insData.push_back(relu->outData[0]);
+    relu->outData[0]->getInputTo()["dead"] = dead;
+    impl->addLayer(dead);
+    impl->getData("dead") = deadData;
+
+    ASSERT_TRUE(NetPass::RemoveDeadLayers(network));
+    ASSERT_FALSE(hasLayer(network, "dead"));
+    ASSERT_EQ(relu->outData[0]->getInputTo().end(), relu->outData[0]->getInputTo().find("dead"));
+    ASSERT_TRUE(hasLayer(network, "relu_1"));
+    ASSERT_TRUE(hasLayer(network, "conv_3"));
+    ASSERT_FALSE(NetPass::RemoveDeadLayers(network));
+}
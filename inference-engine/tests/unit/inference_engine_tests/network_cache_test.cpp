@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_set>
+#include <unordered_map>
+
+#include <ie_util_internal.hpp>
+#include <ie_network_cache.hpp>
+#include "util_test.hpp"
+
+namespace IE = InferenceEngine;
+
+namespace {
+IE::details::CNNNetworkImplPtr makeFullyConnected(float weight) {
+    NetBuilder builder;
+    builder.data("data1", IE::SizeVector{1, 4}, IE::Precision::FP32, IE::Layout::NC)
+           .data("data2", IE::SizeVector{1, 2}, IE::Precision::FP32, IE::Layout::NC)
+           .layer<IE::CNNLayer>(IE::LayerParams{"input1", "Input", IE::Precision::FP32})
+           .layer<IE::FullyConnectedLayer>(IE::LayerParams{"layer1", "FullyConnected", IE::Precision::FP32})
+           .linkToData("input1", "data1")
+           .linkData("data1", "data2", "layer1")
+           .addInput("data1");
+
+    auto weights = IE::make_shared_blob<float>(IE::Precision::FP32, IE::C, {8});
+    weights->allocate();
+    std::fill_n(weights->buffer().as<float *>(), weights->size(), weight);
+    auto fc = std::dynamic_pointer_cast<IE::FullyConnectedLayer>(builder.getLayersMap().at("layer1"));
+    fc->_weights = weights;
+    fc->blobs["weights"] = weights;
+    fc->_out_num = 2;
+    fc->params["out-size"] = "2";
+    return builder.finalize();
+}
+}  // namespace
+
+TEST(NetworkCacheTests, samePathForTheSameNetwork) {
+    auto net1 = makeFullyConnected(1.f);
+    auto net2 = makeFullyConnected(1.f);
+    const std::string path = IE::compiledNetworkCachePath("cache", *net1, "CPU", {{"PERF_COUNT", "YES"}});
+    EXPECT_EQ(path, IE::compiledNetworkCachePath("cache", *net2, "CPU", {{"PERF_COUNT", "YES"}}));
+    EXPECT_EQ(0, path.find("cache"));
+}
+
+TEST(NetworkCacheTests, pathDependsOnWeightsDeviceConfigAndInputs) {
+    auto net = makeFullyConnected(1.f);
+    const std::string path = IE::compiledNetworkCachePath("cache", *net, "CPU", {});
+
+    EXPECT_NE(path, IE::compiledNetworkCachePath("cache", *makeFullyConnected(2.f), "CPU", {}));
+    EXPECT_NE(path, IE::compiledNetworkCachePath("cache", *net, "GPU", {}));
+    EXPECT_NE(path, IE::compiledNetworkCachePath("cache", *net, "CPU", {{"PERF_COUNT", "YES"}}));
+
+    IE::InputsDataMap inputs;
+    net->getInputsInfo(inputs);
+    ASSERT_EQ(1, inputs.size());
+    inputs.begin()->second->setPrecision(IE::Precision::U8);
+    EXPECT_NE(path, IE::compiledNetworkCachePath("cache", *net, "CPU", {}));
+}
@@ -0,0 +1,147 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cnn_network_int8_normalizer.hpp>
+#include <cnn_network_stats_impl.hpp>
+#include "tests_common.hpp"
+#include "ir_gen_helper.hpp"
+
+using namespace ::testing;
+using namespace single_layer_tests;
+
+class NormalizationAsymmetricTests: public TestsCommon {
+protected:
+    std::string layers_t = R"V0G0N(
+        <layer id="1" name="conv_1" precision="FP32" type="Convolution">
+            <data group="1" kernel="1,1" output="2" pads_begin="_PB_" pads_end="_PB_" strides="1,1"/>
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>2</dim>
+                    <dim>_OD_</dim>
+                    <dim>_OD_</dim>
+                </port>
+            </output>
+            <blobs>
+                <weights offset="0" size="24"/>
+                <biases offset="24" size="8"/>
+            </blobs>
+        </layer>
+)V0G0N";
+
+    std::string edges_t = R"V0G0N(
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+)V0G0N";
+
+    InferenceEngine::CNNNetwork getNetwork(size_t pad) {
+        std::string model = layers_t;
+        REPLACE_WITH_STR(model, "_PB_", pad ? "1,1" : "0,0");
+        REPLACE_WITH_NUM(model, "_OD_", 4 + 2 * pad);
+        model = IRTemplateGenerator::getIRTemplate("Asymmetric", {1, 3, 4, 4}, "FP32", model, edges_t);
+
+        InferenceEngine::CNNNetReader net_reader;
+        net_reader.ReadNetwork(model.data(), model.length());
+
+        InferenceEngine::TBlob<uint8_t>::Ptr weights(new InferenceEngine::TBlob<uint8_t>(
+                InferenceEngine::Precision::U8, InferenceEngine::C, {32}));
+        weights->allocate();
+        float *data = weights->buffer().as<float *>();
+        const float values[] = {0.5f, -0.25f, 1.f, -1.f, 0.75f, 0.125f, 0.3f, -0.2f};
+        std::copy(values, values + 8, data);
+        net_reader.SetWeights(weights);
+
+        return net_reader.getNetwork();
+    }
+
+    InferenceEngine::NetworkStatsMap getStats() {
+        InferenceEngine::NetworkStatsMap stats;
+        InferenceEngine::NetworkNodeStatsPtr inStats(new InferenceEngine::NetworkNodeStats(3));
+        inStats->_minOutputs = {-1.f, -2.f, -0.5f};
+        inStats->_maxOutputs = {3.f, 2.f, 1.f};
+        stats["in1"] = inStats;
+        InferenceEngine::NetworkNodeStatsPtr convStats(new InferenceEngine::NetworkNodeStats(2));
+        convStats->_minOutputs = {-4.f, -3.f};
+        convStats->_maxOutputs = {4.f, 3.f};
+        stats["conv_1"] = convStats;
+        return stats;
+    }
+};
+
+TEST_F(NormalizationAsymmetricTests, scalesAndZeroPointsCoverWholeRange) {
+    auto network = getNetwork(0);
+    InferenceEngine::details::CNNStatisticHelper statHelper(network, getStats(), 0x7F, 0xFF);
+    auto conv = network.getLayerByName("conv_1");
+
+    ASSERT_EQ(nullptr, statHelper.getInputShift(conv));
+    statHelper.setAsymmetricOutput("in1");
+
+    // the statistic of the regular convolution input is per tensor: [-2, 3]
+    auto scale = statHelper.getInputScale(conv);
+    auto shift = statHelper.getInputShift(conv);
+    ASSERT_NE(nullptr, shift);
+    ASSERT_EQ(3, shift->size());
+    for (size_t c = 0; c < 3; c++) {
+        ASSERT_FLOAT_EQ(5.f / 255.f, scale->buffer().as<float *>()[c]);
+        ASSERT_FLOAT_EQ(102.f, shift->buffer().as<float *>()[c]);
+    }
+    ASSERT_EQ(nullptr, statHelper.getOutputShift(conv));
+}
+
+TEST_F(NormalizationAsymmetricTests, zeroPointsAreCompensatedInBiases) {
+    auto network = getNetwork(0);
+    InferenceEngine::details::CNNNetworkStatsImpl stats;
+    stats.setNodesStats(getStats());
+
+    InferenceEngine::details::CNNNetworkInt8Normalizer::NormalizeNetwork(network, stats);
+
+    auto conv = network.getLayerByName("conv_1");
+    ASSERT_EQ(InferenceEngine::Precision::I8, conv->precision);
+    ASSERT_NE(conv->blobs.end(), conv->blobs.find("i-shift"));
+
+    auto scaleShift = conv->insData[0].lock()->creatorLayer.lock();
+    ASSERT_EQ("ScaleShift", scaleShift->type);
+    ASSERT_EQ(InferenceEngine::Precision::U8, scaleShift->outData[0]->getPrecision());
+    auto *ss = dynamic_cast<InferenceEngine::ScaleShiftLayer *>(scaleShift.get());
+    ASSERT_NE(nullptr, ss);
+    for (size_t c = 0; c < 3; c++) {
+        ASSERT_FLOAT_EQ(255.f / 5.f, ss->_weights->buffer().as<float *>()[c]);
+        ASSERT_FLOAT_EQ(102.f, ss->_biases->buffer().as<float *>()[c]);
+    }
+
+    const int8_t *weights = conv->blobs["weights"]->buffer().as<const int8_t *>();
+    const int32_t *biases = conv->blobs["biases"]->buffer().as<const int32_t *>();
+    const float *wScale = conv->blobs["w-scale"]->buffer().as<const float *>();
+    const float fp32Biases[] = {0.3f, -0.2f};
+    for (size_t co = 0; co < 2; co++) {
+        int32_t compensation = 0;
+        for (size_t ci = 0; ci < 3; ci++) {
+            compensation += weights[co * 3 + ci] * 102;
+        }
+        ASSERT_NEAR(std::round(fp32Biases[co] / wScale[co]) - compensation, biases[co], 1);
+    }
+}
+
+TEST_F(NormalizationAsymmetricTests, paddedConvolutionKeepsSymmetricInput) {
+    auto network = getNetwork(1);
+    InferenceEngine::details::CNNNetworkStatsImpl stats;
+    stats.setNodesStats(getStats());
+
+    InferenceEngine::details::CNNNetworkInt8Normalizer::NormalizeNetwork(network, stats);
+
+    auto conv = network.getLayerByName("conv_1");
+    ASSERT_EQ(conv->blobs.end(), conv->blobs.find("i-shift"));
+    auto scaleShift = conv->insData[0].lock()->creatorLayer.lock();
+    ASSERT_EQ(InferenceEngine::Precision::I8, scaleShift->outData[0]->getPrecision());
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "page_aligned_allocator.hpp"
+#include "blob_factory.hpp"
+#include "details/ie_irelease.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class PageAlignedAllocatorTests: public ::testing::Test {
+};
+
+TEST_F(PageAlignedAllocatorTests, allocatesAtPageBoundary) {
+    std::shared_ptr<IAllocator> allocator = details::shared_from_irelease(new PageAlignedAllocator());
+    for (size_t size : std::vector<size_t>{1, 100, 4096, 10000}) {
+        void* handle = allocator->alloc(size);
+        ASSERT_NE(nullptr, handle);
+        ASSERT_TRUE(PageAlignedAllocator::isAligned(allocator->lock(handle)));
+        allocator->unlock(handle);
+        ASSERT_TRUE(allocator->free(handle));
+    }
+}
+
+TEST_F(PageAlignedAllocatorTests, canBeUsedByBlob) {
+    auto blob = make_blob_with_precision(TensorDesc(Precision::FP32, {1, 3, 5, 7}, Layout::NCHW),
+                                         details::shared_from_irelease(new PageAlignedAllocator()));
+    blob->allocate();
+    float* data = blob->buffer().as<float*>();
+    ASSERT_TRUE(PageAlignedAllocator::isAligned(data));
+    data[blob->size() - 1] = 1.0f;
+    ASSERT_EQ(1.0f, blob->cbuffer().as<const float*>()[blob->size() - 1]);
+}
@@ -0,0 +1,51 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "precision_utils.h"
+
+using namespace InferenceEngine;
+
+class PrecisionUtilsTests : public ::testing::Test {};
+
+// the arrays are converted by the vectorized code when the CPU allows, its results are the scalar ones
+TEST_F(PrecisionUtilsTests, f16tof32ArraysMatchScalarForAllValues) {
+    // one more than all the values to pass the vector tails
+    std::vector<short> src(65536 + 7);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<short>(i);
+
+    for (float scale : {1.f, 0.5f}) {
+        std::vector<float> dst(src.size());
+        PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size(), scale, 1.f);
+        for (size_t i = 0; i < src.size(); i++) {
+            const float expected = PrecisionUtils::f16tof32(src[i]) * scale + 1.f;
+            ASSERT_EQ(0, std::memcmp(&expected, &dst[i], sizeof(float))) << "value " << i;
+        }
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f32tof16ArraysMatchScalar) {
+    // the random bits cover NAN, INF and the denormals, the exponents near the f16 range are more frequent
+    const size_t size = (1 << 18) + 7;
+    std::mt19937 gen(1);
+    std::vector<float> src(size);
+    for (size_t i = 0; i < size; i++) {
+        uint32_t bits = gen();
+        if (i % 2)
+            bits = (bits & 0x807FFFFF) | ((100 + gen() % 50) << 23);
+        std::memcpy(&src[i], &bits, sizeof(float));
+    }
+
+    for (float scale : {1.f, 3.f}) {
+        std::vector<short> dst(size);
+        PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), size, scale, 0.25f);
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(PrecisionUtils::f32tof16(src[i] * scale + 0.25f), dst[i]) << "value " << src[i];
+        }
+    }
+}
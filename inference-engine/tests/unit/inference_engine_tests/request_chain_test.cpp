@@ -0,0 +1,107 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "cpp/ie_request_chain.hpp"
+#include "cpp/ie_executable_network.hpp"
+#include "cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp"
+#include "cpp_interfaces/base/ie_executable_network_base.hpp"
+#include "details/ie_irelease.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+
+class IncrementInferRequest : public InferRequestInternal {
+public:
+    IncrementInferRequest(InputsDataMap networkInputs, OutputsDataMap networkOutputs)
+            : InferRequestInternal(networkInputs, networkOutputs) {
+        _inputs["in"] = make_shared_blob<float>(networkInputs["in"]->getTensorDesc());
+        _inputs["in"]->allocate();
+        _outputs["out"] = make_shared_blob<float>(networkOutputs["out"]->getTensorDesc());
+        _outputs["out"]->allocate();
+    }
+
+    /**
+     * @brief out = in + 1, fails if the first input element is negative
+     */
+    void InferImpl() override {
+        const float *in = _inputs["in"]->cbuffer().as<const float *>();
+        if (in[0] < 0) THROW_IE_EXCEPTION << "Negative input";
+        float *out = _outputs["out"]->buffer().as<float *>();
+        for (size_t i = 0; i < _outputs["out"]->size(); i++) out[i] = in[i] + 1.0f;
+    }
+
+    void GetPerformanceCounts(map<string, InferenceEngineProfileInfo> &) const override {}
+};
+
+class IncrementExecutableNetwork : public ExecutableNetworkThreadSafeDefault {
+public:
+    IncrementExecutableNetwork() {
+        InputInfo::Ptr input(new InputInfo());
+        input->setInputData(make_shared<Data>("in", TensorDesc(Precision::FP32, {1, 3}, Layout::NC)));
+        _networkInputs["in"] = input;
+        _networkOutputs["out"] = make_shared<Data>("out", TensorDesc(Precision::FP32, {1, 3}, Layout::NC));
+    }
+
+    InferRequestInternal::Ptr CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                     OutputsDataMap networkOutputs) override {
+        return make_shared<IncrementInferRequest>(networkInputs, networkOutputs);
+    }
+};
+
+}  // namespace
+
+class RequestChainTests : public ::testing::Test {
+protected:
+    ExecutableNetwork network {details::shared_from_irelease(
+            new ExecutableNetworkBase<ExecutableNetworkInternal>(make_shared<IncrementExecutableNetwork>()))};
+
+    // a chain of the requests, the output of every request is the input of the next one
+    void createChain(RequestChain &chain, size_t length, float value) {
+        for (size_t i = 0; i < length; i++) {
+            chain.add(network.CreateInferRequest());
+            if (i > 0) chain.bind(i - 1, "out", i, "in");
+        }
+        float *in = chain.get(0).GetBlob("in")->buffer().as<float *>();
+        std::fill_n(in, 3, value);
+    }
+};
+
+TEST_F(RequestChainTests, outputsArePassedWithoutCopy) {
+    RequestChain chain;
+    createChain(chain, 4, 1.0f);
+    ASSERT_EQ(chain.get(0).GetBlob("out"), chain.get(1).GetBlob("in"));
+
+    chain.startAsync();
+    ASSERT_EQ(OK, chain.wait());
+    const float *out = chain.get(3).GetBlob("out")->cbuffer().as<const float *>();
+    for (int i = 0; i < 3; i++)
+        ASSERT_FLOAT_EQ(5.0f, out[i]);
+}
+
+TEST_F(RequestChainTests, chainStopsAtFailedRequest) {
+    RequestChain chain;
+    createChain(chain, 3, -3.0f);
+    chain.startAsync();
+    ASSERT_EQ(GENERAL_ERROR, chain.wait());
+    ASSERT_EQ(INFER_NOT_STARTED, chain.get(1).Wait(IInferRequest::WaitMode::STATUS_ONLY));
+}
+
+TEST_F(RequestChainTests, chainCanBeRestartedAfterCompletion) {
+    RequestChain chain;
+    ASSERT_EQ(INFER_NOT_STARTED, chain.wait(0));
+    createChain(chain, 2, 1.0f);
+    for (int i = 0; i < 3; i++) {
+        chain.startAsync();
+        ASSERT_EQ(OK, chain.wait());
+    }
+    ASSERT_THROW(chain.bind(1, "out", 0, "in"), details::InferenceEngineException);
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "ie_blob.h"
+#include "shared_memory_allocator.hpp"
+#include "details/ie_irelease.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class SharedMemoryAllocatorTests: public ::testing::Test {
+protected:
+    std::shared_ptr<IAllocator> create() {
+        return details::shared_from_irelease(new SharedMemoryAllocator(name));
+    }
+
+    std::string name = "ie_shared_memory_allocator_test";
+};
+
+TEST_F(SharedMemoryAllocatorTests, allocatorsOfSameNameShareData) {
+    auto producer = create();
+    auto consumer = create();
+
+    void* produced = producer->alloc(10000);
+    ASSERT_NE(nullptr, produced);
+    void* consumed = consumer->alloc(10000);
+    ASSERT_NE(nullptr, consumed);
+    ASSERT_NE(produced, consumed);
+
+    char * src = static_cast<char *>(producer->lock(produced));
+    for (size_t i = 0; i < 10000; i++)
+        src[i] = static_cast<char>(i % 127);
+    producer->unlock(src);
+
+    const char * dst = static_cast<char *>(consumer->lock(consumed, LOCK_FOR_READ));
+    for (size_t i = 0; i < 10000; i++)
+        ASSERT_EQ(static_cast<char>(i % 127), dst[i]);
+    consumer->unlock(consumed);
+
+    ASSERT_TRUE(consumer->free(consumed));
+    ASSERT_TRUE(producer->free(produced));
+}
+
+TEST_F(SharedMemoryAllocatorTests, cannotMapMoreThanCreatedSize) {
+    auto producer = create();
+    void* produced = producer->alloc(100);
+    ASSERT_NE(nullptr, produced);
+
+    ASSERT_EQ(nullptr, create()->alloc(100000));
+    producer->free(produced);
+}
+
+TEST_F(SharedMemoryAllocatorTests, regionIsRemovedByCreator) {
+    auto producer = create();
+    void* produced = producer->alloc(100);
+    ASSERT_NE(nullptr, produced);
+    static_cast<char *>(producer->lock(produced))[0] = 11;
+    producer->free(produced);
+
+    // a new region of the name is created from scratch
+    auto next = create();
+    void* created = next->alloc(100000);
+    ASSERT_NE(nullptr, created);
+    ASSERT_EQ(0, static_cast<char *>(next->lock(created))[0]);
+    next->free(created);
+}
+
+TEST_F(SharedMemoryAllocatorTests, blobsOfSameNameShareData) {
+    TensorDesc desc(Precision::FP32, {1, 3, 4, 4}, Layout::NCHW);
+    auto frame = make_shared_blob<float>(desc, create());
+    frame->allocate();
+    auto input = make_shared_blob<float>(desc, create());
+    input->allocate();
+
+    for (size_t i = 0; i < frame->size(); i++)
+        frame->data()[i] = static_cast<float>(i);
+    for (size_t i = 0; i < input->size(); i++)
+        ASSERT_EQ(static_cast<float>(i), input->readOnly()[i]);
+}
@@ -93,4 +93,5 @@ TEST_F(TensorDescTests, CompareNDHWCandNCDHWLayouts) {
     ASSERT_NE(descNCDHW.getBlockingDesc().getOrder(), descNDHWC.getBlockingDesc().getOrder());
     ASSERT_EQ(descNCDHW.getBlockingDesc().getOrder(), ncdhw);
     ASSERT_EQ(descNDHWC.getBlockingDesc().getOrder(), ndhwc);
+    ASSERT_EQ(descNDHWC.getBlockingDesc().getBlockDims(), SizeVector({1, 4, 4, 2, 3}));
 }
@@ -4,11 +4,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <initializer_list>
 #include <string>
 #include <utility>
 #include <unordered_set>
 #include <unordered_map>
+#include <vector>
 
 #include <ie_util_internal.hpp>
 #include <tests_common.hpp>
@@ -19,6 +21,7 @@
 #include "util_test.hpp"
 #include "util_const_infer_test.hpp"
 #include <details/ie_cnn_network_tools.h>
+#include <cpp_interfaces/impl/mock_inference_plugin_internal.hpp>
 
 namespace IE = InferenceEngine;
 
@@ -603,6 +606,48 @@ TEST_F(RemoveLayerTests, canFullTrimConstToReshape) {
     ASSERT_EQ(layer1->insData[0].lock(), getData("data1"));
 }
 
+TEST_F(RemoveLayerTests, loadNetworkPassesFoldedNetworkToPlugin) {
+    IE::BlobMap refBlobs = initConstLayers({"input1", "input2", "input3"});
+    {
+        getLayer("layer1")->type = "Mul";
+        getLayer("layer2")->type = "Shape";
+        getLayer("layer3")->type = "Power";
+        getLayer("layer3")->params = {{"power", "1"},
+                                      {"scale", "2"},
+                                      {"shift", "-4"}};
+        getLayer("layer4")->type = "Mul";
+        getLayer("layer5")->type = "Mul";
+    }
+    float arr[] = {-2.f, 0.f, 54.f};
+    auto ref5 = make_blob_with_precision(getData("data9")->getTensorDesc(), arr);
+
+    auto plugin = std::make_shared<MockInferencePluginInternal>();
+    auto exeNetwork = std::make_shared<MockExecutableNetworkInternal>();
+    EXPECT_CALL(*exeNetwork, setNetworkInputs(testing::_)).Times(1);
+    EXPECT_CALL(*exeNetwork, setNetworkOutputs(testing::_)).Times(1);
+    std::vector<std::string> pluginLayers;
+    EXPECT_CALL(*plugin, LoadExeNetworkImpl(testing::_, testing::_)).WillOnce(testing::Invoke(
+            [&](IE::ICNNNetwork& network, const std::map<std::string, std::string>&)
+                    -> std::shared_ptr<IE::ExecutableNetworkInternal> {
+                for (const auto& layer : IE::details::CNNNetSortTopologically(network))
+                    pluginLayers.push_back(layer->name);
+                return exeNetwork;
+            }));
+
+    IE::IExecutableNetwork::Ptr executableNetwork;
+    ASSERT_NO_THROW(plugin->LoadNetwork(executableNetwork, *net, {}));
+
+    // the plugin gets only the non constant layers and the Const layer holding the folded subgraph
+    std::sort(pluginLayers.begin(), pluginLayers.end());
+    ASSERT_EQ(pluginLayers, std::vector<std::string>({"input4", "layer5__data9__Const", "layer6"}));
+    IE::CNNNetwork cnnNetwork(net);
+    auto folded = cnnNetwork.getLayerByName("layer5__data9__Const");
+    ASSERT_EQ(folded->type, "Const");
+    ASSERT_NE(folded->blobs["custom"], nullptr);
+    TestsCommon::compare(*folded->blobs["custom"], *ref5);
+    ASSERT_EQ(getLayer("layer6")->insData.size(), 2);
+}
+
 TEST_F(AdvancedShapeInferTests, canReshape) {
     //
     // I2-d2-Shape
@@ -828,3 +873,76 @@ TEST_F(AdvancedShapeInferTests, canReshapeWithScalar) {
     ASSERT_EQ(getData("data1")->getTensorDesc().getDims(), newInShape);
     ASSERT_EQ(getData("data3")->getTensorDesc().getDims(), newOutShape);
 }
+
+TEST_F(AdvancedShapeInferTests, loadNetworkFoldsShapeArithmeticOfReshape) {
+    //
+    //            begin end stride    minusOne
+    //                \  |  /            \
+    //   ---Shape-d2-StridedSlice-d3-Concat-d4
+    //  /                                    \
+    // I1-d1---------------------------Reshape-d5
+    //
+    net = netBuilder
+            .data("data1", IE::SizeVector{1, 2, 3, 4}, IE::Precision::FP32, IE::Layout::NCHW)
+            .data("data2", IE::SizeVector{4}, IE::Precision::FP32, IE::Layout::C)
+            .data("data3", IE::SizeVector{1}, IE::Precision::FP32, IE::Layout::C)
+            .data("data4", IE::SizeVector{2}, IE::Precision::FP32, IE::Layout::C)
+            .data("data5", IE::SizeVector{1, 24}, IE::Precision::FP32, IE::Layout::NC)
+            .data("beginData", IE::SizeVector{1}, IE::Precision::FP32, IE::Layout::C)
+            .data("endData", IE::SizeVector{1}, IE::Precision::FP32, IE::Layout::C)
+            .data("strideData", IE::SizeVector{1}, IE::Precision::FP32, IE::Layout::C)
+            .data("minusOneData", IE::SizeVector{1}, IE::Precision::FP32, IE::Layout::C)
+            .layer<IE::CNNLayer>(IE::LayerParams{"input1", "input", IE::Precision::FP32})
+            .layer<IE::CNNLayer>(IE::LayerParams{"begin", "dummy", IE::Precision::FP32})
+            .layer<IE::CNNLayer>(IE::LayerParams{"end", "dummy", IE::Precision::FP32})
+            .layer<IE::CNNLayer>(IE::LayerParams{"stride", "dummy", IE::Precision::FP32})
+            .layer<IE::CNNLayer>(IE::LayerParams{"minusOne", "dummy", IE::Precision::FP32})
+            .layer<IE::CNNLayer>(IE::LayerParams{"shape", "Shape", IE::Precision::FP32})
+            .layer<IE::CNNLayer>(IE::LayerParams{"slice", "StridedSlice", IE::Precision::FP32})
+            .layer<IE::CNNLayer>(IE::LayerParams{"concat", "Concat", IE::Precision::FP32})
+            .layer<IE::CNNLayer>(IE::LayerParams{"reshape", "Reshape", IE::Precision::FP32})
+            .linkToData("input1", "data1")
+            .linkToData("begin", "beginData")
+            .linkToData("end", "endData")
+            .linkToData("stride", "strideData")
+            .linkToData("minusOne", "minusOneData")
+            .linkDataTo("data1", "shape")
+            .linkToData("shape", "data2")
+            .linkDataTo("data2", "slice")
+            .linkDataTo("beginData", "slice")
+            .linkDataTo("endData", "slice")
+            .linkDataTo("strideData", "slice")
+            .linkToData("slice", "data3")
+            .linkDataTo("data3", "concat")
+            .linkDataTo("minusOneData", "concat")
+            .linkToData("concat", "data4")
+            .linkDataTo("data1", "reshape")
+            .linkDataTo("data4", "reshape")
+            .linkToData("reshape", "data5")
+            .addInput("data1")
+            .finalize();
+    initConstLayers({"begin", "end", "stride", "minusOne"});
+
+    auto plugin = std::make_shared<MockInferencePluginInternal>();
+    auto exeNetwork = std::make_shared<MockExecutableNetworkInternal>();
+    EXPECT_CALL(*exeNetwork, setNetworkInputs(testing::_)).Times(1);
+    EXPECT_CALL(*exeNetwork, setNetworkOutputs(testing::_)).Times(1);
+    std::vector<std::string> pluginLayers;
+    EXPECT_CALL(*plugin, LoadExeNetworkImpl(testing::_, testing::_)).WillOnce(testing::Invoke(
+            [&](IE::ICNNNetwork& network, const std::map<std::string, std::string>&)
+                    -> std::shared_ptr<IE::ExecutableNetworkInternal> {
+                for (const auto& layer : IE::details::CNNNetSortTopologically(network))
+                    pluginLayers.push_back(layer->name);
+                return exeNetwork;
+            }));
+
+    IE::IExecutableNetwork::Ptr executableNetwork;
+    ASSERT_NO_THROW(plugin->LoadNetwork(executableNetwork, *net, {}));
+
+    // the shape subgraph only defines the already inferred output dims of the Reshape, so it is removed whole
+    ASSERT_EQ(pluginLayers, std::vector<std::string>({"input1", "reshape"}));
+    auto reshape = getLayer("reshape");
+    ASSERT_EQ(reshape->insData.size(), 1);
+    ASSERT_EQ(reshape->insData[0].lock(), getData("data1"));
+    ASSERT_EQ(getData("data5")->getTensorDesc().getDims(), IE::SizeVector({1, 24}));
+}
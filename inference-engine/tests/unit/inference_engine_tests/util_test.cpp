@@ -727,6 +727,47 @@ TEST(UtilTests, cloneNet_const) {
     ASSERT_EQ("custom_val3", getLayer(cloned, "input3")->params["custom_param3"]);
 }
 
+TEST(UtilTests, cloneNet_sharesWeights) {
+    //
+    // I1-d1-L1-d2
+    //
+    auto net = NetBuilder()
+               .data("data1",IE::SizeVector{1,4},IE::Precision::FP32, IE::Layout::NC)
+               .data("data2",IE::SizeVector{1,2},IE::Precision::FP32, IE::Layout::NC)
+               .layer<IE::CNNLayer>(IE::LayerParams{"input1","input",IE::Precision::FP32})
+               .layer<IE::FullyConnectedLayer>(IE::LayerParams{"layer1","FullyConnected",IE::Precision::FP32})
+
+               .linkToData("input1", "data1")
+               .linkDataTo("data1", "layer1")
+               .linkToData("layer1", "data2")
+
+               .finalize();
+
+    auto weights = IE::make_shared_blob<float>(IE::Precision::FP32, IE::C, {8});
+    weights->allocate();
+    auto fc = std::dynamic_pointer_cast<IE::FullyConnectedLayer>(getLayer(net, "layer1"));
+    ASSERT_NE(nullptr, fc);
+    fc->_weights = weights;
+    fc->blobs["weights"] = weights;
+    fc->params["out-size"] = "2";
+
+    auto cloned = IE::cloneNet({getLayer(net, "layer1")}, nullptr);
+    auto clonedFc = std::dynamic_pointer_cast<IE::FullyConnectedLayer>(getLayer(cloned, "layer1"));
+    ASSERT_NE(nullptr, clonedFc);
+    ASSERT_NE(fc, clonedFc);
+
+    // the clone refers the weights of the source, a transformation of the clone replaces them instead of writing
+    EXPECT_EQ(weights, clonedFc->_weights);
+    EXPECT_EQ(weights, clonedFc->blobs["weights"]);
+    auto converted = IE::make_shared_blob<float>(IE::Precision::FP32, IE::C, {8});
+    clonedFc->_weights = converted;
+    clonedFc->blobs["weights"] = converted;
+    clonedFc->params["out-size"] = "3";
+    EXPECT_EQ(weights, fc->_weights);
+    EXPECT_EQ(weights, fc->blobs["weights"]);
+    EXPECT_EQ("2", fc->params["out-size"]);
+}
+
 TEST(UtilTests, getRootDataObjects) {
     //
     // I1-d1-L1-d7
@@ -0,0 +1,91 @@
+// Copyright (C) 2019 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "xml_stream_reader.hpp"
+#include "details/ie_exception.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class XmlStreamReaderTests: public ::testing::Test {
+protected:
+    virtual void TearDown() {
+        std::remove(fileName.c_str());
+    }
+
+    void write(const std::string &content) {
+        std::ofstream file(fileName, std::ios::binary);
+        file << content;
+    }
+
+    std::string fileName = "xml_stream_reader_test.xml";
+};
+
+TEST_F(XmlStreamReaderTests, readsChildrenOfSectionsOneByOne) {
+    write(R"V0G0N(<?xml version="1.0" ?>
+<!-- the network -->
+<net name="net" version="3">
+    <layers>
+        <layer id="0" name="a&gt;b" type="Input"><data shape="1,2"/></layer>
+        <!-- a comment between the layers -->
+        <layer id="1" name="c" type="ReLU" note="1 > 0"/>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+    <statistics><layer><name><![CDATA[a</layer>]]></name></layer></statistics>
+</net>
+)V0G0N");
+
+    XmlStreamReader stream(fileName, {"layers", "edges"});
+    ASSERT_TRUE(stream.open());
+    ASSERT_STREQ("net", stream.root().name());
+    ASSERT_STREQ("3", stream.root().attribute("version").value());
+    ASSERT_TRUE(stream.root().first_child().empty());
+
+    pugi::xml_document element;
+    std::string section;
+    ASSERT_TRUE(stream.next(element, section));
+    ASSERT_EQ("layers", section);
+    ASSERT_STREQ("a>b", element.document_element().attribute("name").value());
+    ASSERT_STREQ("1,2", element.document_element().child("data").attribute("shape").value());
+
+    ASSERT_TRUE(stream.next(element, section));
+    ASSERT_EQ("layers", section);
+    ASSERT_STREQ("1 > 0", element.document_element().attribute("note").value());
+
+    ASSERT_TRUE(stream.next(element, section));
+    ASSERT_EQ("edges", section);
+    ASSERT_STREQ("edge", element.document_element().name());
+
+    ASSERT_TRUE(stream.next(element, section));
+    ASSERT_EQ("", section);
+    ASSERT_STREQ("statistics", element.document_element().name());
+    ASSERT_STREQ("a</layer>", element.document_element().child("layer").child_value("name"));
+
+    ASSERT_FALSE(stream.next(element, section));
+}
+
+TEST_F(XmlStreamReaderTests, throwsOnNotClosedElement) {
+    write("<net><layers><layer id=\"0\"><data/></layers></net>");
+
+    XmlStreamReader stream(fileName, {"layers"});
+    ASSERT_TRUE(stream.open());
+    pugi::xml_document element;
+    std::string section;
+    ASSERT_THROW(stream.next(element, section), InferenceEngineException);
+}
+
+TEST_F(XmlStreamReaderTests, cannotOpenMissingFile) {
+    XmlStreamReader stream("no_such_file.xml", {"layers"});
+    ASSERT_FALSE(stream.open());
+}
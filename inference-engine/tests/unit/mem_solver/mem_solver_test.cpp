@@ -253,3 +253,121 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, ManyBoxesNoOverlapping) {
+    // tens of thousands of edges: mostly short ones with some long living (like the shortcuts)
+    std::vector<Box> boxes;
+    for (int i = 0; i < 40000; i++)
+        boxes.push_back({i / 2, i / 2 + 1 + (i % 97 == 0 ? 500 : i % 7), 1 + (i * 31) % 1000, i});
+
+    MemorySolver ms(boxes);
+    const int64_t total = ms.solve();
+    EXPECT_GE(total, ms.maxDepth());
+
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const int64_t off_i = ms.getOffset(boxes[i].id);
+        ASSERT_LE(off_i + boxes[i].size, total);
+        for (size_t j = i + 1; j < boxes.size() && boxes[j].start <= boxes[i].finish; j++) {
+            const int64_t off_j = ms.getOffset(boxes[j].id);
+            ASSERT_TRUE(off_i + boxes[i].size <= off_j || off_i >= off_j + boxes[j].size)
+                << "Box overlapping is detected";
+        }
+    }
+}
+
+TEST(MemSolverTest, CacheAwarePrefersRecentlyReleased) {
+    int n = 0;                 //  |         ____
+    std::vector<Box> boxes{    //  |        |_C__|  ____
+            {0, 4, 3, n++},    //  |   ____   |E|  |_D__|
+            {0, 1, 2, n++},    //  |  |_A__|
+            {1, 2, 2, n++},    //  |  |_B____________________|
+            {3, 4, 2, n++},    //  |___________________________
+            {2, 2, 1, n++},    //      0  1  2  3  4
+    };
+
+    // C is released last, its place is the hottest one for D
+    MemorySolver hot(boxes);
+    EXPECT_EQ(hot.solveCacheAware(2), 7);
+    EXPECT_EQ(hot.getOffset(3), hot.getOffset(2));
+    EXPECT_EQ(hot.hotReuse(), 3);
+
+    // nothing is in the cache, D takes the lowest free place of A
+    MemorySolver cold(boxes);
+    EXPECT_EQ(cold.solveCacheAware(0), 7);
+    EXPECT_EQ(cold.getOffset(3), cold.getOffset(1));
+    EXPECT_EQ(cold.hotReuse(), 0);
+}
+
+TEST(MemSolverTest, CacheAwareAlignsOffsets) {
+    int n = 0;
+    std::vector<Box> boxes{
+            {0, 1, 3, n++},
+            {0, 1, 3, n++},
+            {1, 2, 2, n++},
+    };
+
+    MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solveCacheAware(0, 4), 10);
+    for (int i = 0; i < n; i++)
+        EXPECT_EQ(ms.getOffset(i) % 4, 0);
+}
+
+TEST(MemSolverTest, CacheAwareAlignsBigBoxesToPage) {
+    int n = 0;
+    std::vector<Box> boxes{
+            {0, 1, 3, n++},
+            {1, 2, 8, n++},
+    };
+
+    MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solveCacheAware(0, 1, 8), 16);
+    EXPECT_EQ(ms.getOffset(0), 0);
+    EXPECT_EQ(ms.getOffset(1), 8);
+}
+
+TEST(MemSolverTest, CacheAwareNoOverlapping) {
+    int n = 0;
+    std::vector<Box> boxes{
+            {4, 8, 1, n++},
+            {6, 7, 3, n++},
+            {2, 3, 3, n++},
+            {2, 4, 2, n++},
+            {3, 5, 4, n++},
+            {5, 9, 2, n++},
+    };
+
+    MemorySolver ms(boxes);
+    ms.solveCacheAware(4, 2);
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int off1 = ms.getOffset(box1.id);
+        int off2 = ms.getOffset(box2.id);
+        return box1.finish < box2.start || box1.start > box2.finish ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++)
+        for (int j = i+1; j < n; j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+}
+
+TEST(MemSolverTest, CacheAwareManyBoxesNoOverlapping) {
+    // the edges of ManyBoxesNoOverlapping, the solver runs over them on every network load
+    std::vector<Box> boxes;
+    for (int i = 0; i < 40000; i++)
+        boxes.push_back({i / 2, i / 2 + 1 + (i % 97 == 0 ? 500 : i % 7), 1 + (i * 31) % 1000, i});
+
+    MemorySolver ms(boxes);
+    const int64_t total = ms.solveCacheAware(4096, 4, 512);
+
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const int64_t off_i = ms.getOffset(boxes[i].id);
+        ASSERT_EQ(off_i % (boxes[i].size >= 512 ? 512 : 4), 0);
+        ASSERT_LE(off_i + boxes[i].size, total);
+        for (size_t j = i + 1; j < boxes.size() && boxes[j].start <= boxes[i].finish; j++) {
+            const int64_t off_j = ms.getOffset(boxes[j].id);
+            ASSERT_TRUE(off_i + boxes[i].size <= off_j || off_i >= off_j + boxes[j].size)
+                << "Box overlapping is detected";
+        }
+    }
+}
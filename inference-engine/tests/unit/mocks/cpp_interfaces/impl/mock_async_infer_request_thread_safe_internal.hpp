@@ -46,8 +46,15 @@ public:
             const char *name,
             const Blob::Ptr &));
 
+    MOCK_METHOD3(SetRoiBlobs_ThreadUnsafe, void(
+            const char *name,
+            const Blob::Ptr &,
+            const std::vector<ROI> &));
+
     MOCK_METHOD1(SetCompletionCallback_ThreadUnsafe, void(IInferRequest::CompletionCallback));
 
 	MOCK_METHOD1(SetBatch, void(int));
+	MOCK_METHOD2(SetPriority, void(int, int64_t));
 	MOCK_METHOD1(SetBatch_ThreadUnsafe, void(int));
+	MOCK_METHOD2(SetPriority_ThreadUnsafe, void(int, int64_t));
 };
@@ -19,7 +19,10 @@ public:
     MOCK_METHOD0(Infer, void());
     MOCK_CONST_METHOD1(GetPerformanceCounts, void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &));
     MOCK_METHOD2(SetBlob, void(const char *name, const InferenceEngine::Blob::Ptr &));
+    MOCK_METHOD3(SetRoiBlobs, void(const char *name, const InferenceEngine::Blob::Ptr &,
+                                   const std::vector<InferenceEngine::ROI> &));
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
 	MOCK_METHOD1(SetBatch, void(int));
+	MOCK_METHOD2(SetPriority, void(int, int64_t));
 };
@@ -29,4 +29,6 @@ public:
     MOCK_METHOD1(GetMappedTopology, void(std::map<std::string, std::vector<PrimitiveInfo::Ptr>> &));
     MOCK_METHOD0(QueryState, std::vector<IMemoryStateInternal::Ptr>());
     MOCK_METHOD1(GetExecGraphInfo, void(ICNNNetwork::Ptr &));
+    typedef std::map<std::string, InferenceEngineMetricInfo> MetricsMap;
+    MOCK_METHOD0(GetMetrics, MetricsMap());
 };
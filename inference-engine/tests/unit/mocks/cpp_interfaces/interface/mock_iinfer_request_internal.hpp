@@ -16,5 +16,7 @@ public:
     MOCK_METHOD0(Infer, void());
     MOCK_CONST_METHOD1(GetPerformanceCounts, void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &));
     MOCK_METHOD2(SetBlob, void(const char *name, const InferenceEngine::Blob::Ptr &));
+    MOCK_METHOD3(SetRoiBlobs, void(const char *name, const InferenceEngine::Blob::Ptr &,
+                                   const std::vector<InferenceEngine::ROI> &));
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
 };
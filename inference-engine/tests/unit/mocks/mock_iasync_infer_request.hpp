@@ -27,5 +27,8 @@ public:
                            StatusCode(std::map<std::string, InferenceEngineProfileInfo> &perfMap, ResponseDesc*));
     MOCK_QUALIFIED_METHOD3(GetBlob, noexcept, StatusCode(const char*, Blob::Ptr&, ResponseDesc*));
     MOCK_QUALIFIED_METHOD3(SetBlob, noexcept, StatusCode(const char*, const Blob::Ptr&, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD4(SetRoiBlobs, noexcept,
+                           StatusCode(const char*, const Blob::Ptr&, const std::vector<ROI>&, ResponseDesc*));
 	MOCK_QUALIFIED_METHOD2(SetBatch, noexcept, StatusCode(int batch, ResponseDesc*));
+	MOCK_QUALIFIED_METHOD3(SetPriority, noexcept, StatusCode(int priority, int64_t millis_deadline, ResponseDesc*));
 };
@@ -23,4 +23,6 @@ public:
     MOCK_QUALIFIED_METHOD0(Release, noexcept, void ());
     MOCK_QUALIFIED_METHOD3(QueryState, noexcept, StatusCode(IMemoryState::Ptr &, size_t  , ResponseDesc*));
     MOCK_QUALIFIED_METHOD2(GetExecGraphInfo, noexcept, StatusCode(ICNNNetwork::Ptr &, ResponseDesc*));
+    typedef std::map<std::string, InferenceEngineMetricInfo> MetricsMap;
+    MOCK_QUALIFIED_METHOD2(GetMetrics, noexcept, StatusCode(MetricsMap &, ResponseDesc*));
 };
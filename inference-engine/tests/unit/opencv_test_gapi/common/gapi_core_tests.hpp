@@ -36,6 +36,33 @@ using PreprocParams = std::tuple< InferenceEngine::Precision     // input-output
 
 struct PreprocTest: public TestParams<PreprocParams> {};
 
+using PreprocNormalizeParams = std::tuple< InferenceEngine::ResizeAlgorithm // resize algorithm
+                                         , InferenceEngine::Layout        // input tensor layout
+                                         , InferenceEngine::Layout        // output tensor layout
+                                         , int                            // number of channels
+                                         , std::pair<cv::Size, cv::Size>
+                                         >;
+
+struct PreprocNormalizeTest: public TestParams<PreprocNormalizeParams> {};
+
+using PreprocRoisParams = std::tuple< InferenceEngine::ResizeAlgorithm // resize algorithm
+                                    , InferenceEngine::Layout        // input tensor layout
+                                    , InferenceEngine::Layout        // output tensor layout
+                                    , int                            // number of channels
+                                    , std::pair<cv::Size, cv::Size>  // frame size, output size
+                                    >;
+
+struct PreprocRoisTest: public TestParams<PreprocRoisParams> {};
+
+using PreprocSourcesParams = std::tuple< InferenceEngine::ResizeAlgorithm // resize algorithm
+                                       , InferenceEngine::Layout        // input tensor layout
+                                       , InferenceEngine::Layout        // output tensor layout
+                                       , int                            // number of channels
+                                       , cv::Size                       // output size
+                                       >;
+
+struct PreprocSourcesTest: public TestParams<PreprocSourcesParams> {};
+
 } // opencv_test
 
 #endif //OPENCV_GAPI_CORE_TESTS_HPP
@@ -19,6 +19,7 @@
 #include <cstdio>
 #include <ctime>
 
+#include <algorithm>
 #include <chrono>
 
 #include <fluid_test_computations.hpp>
@@ -628,6 +629,196 @@ TEST_P(PreprocTest, Performance)
 
 }
 
+TEST_P(PreprocNormalizeTest, Performance)
+{
+    using namespace InferenceEngine;
+    ResizeAlgorithm interp;
+    Layout in_layout, out_layout;
+    int ocv_chan = -1;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(interp, in_layout, out_layout, ocv_chan, sizes) = GetParam();
+    cv::Size in_size, out_size;
+    std::tie(in_size, out_size) = sizes;
+
+    initMatrixRandU(CV_MAKETYPE(CV_8U, ocv_chan), in_size, CV_MAKETYPE(CV_8U, ocv_chan), false);
+    cv::Mat out_mat(out_size, CV_MAKETYPE(CV_32F, ocv_chan));
+
+    Blob::Ptr in_blob = img2Blob<Precision::U8>(in_mat1, in_layout);
+    Blob::Ptr out_blob = img2Blob<Precision::FP32>(out_mat, out_layout);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(interp);
+    info.init(ocv_chan);
+    std::vector<float> means(ocv_chan), scales(ocv_chan);
+    for (int c = 0; c < ocv_chan; c++) {
+        info[c]->meanValue = means[c] = 100.f + 10.f * c;
+        info[c]->stdScale = 50.f + 5.f * c;
+        scales[c] = 1.f / info[c]->stdScale;
+    }
+    info.setVariant(MEAN_VALUE);
+
+    PreProcessData preprocess;
+    preprocess.setRoiBlob(in_blob);
+
+    // test once to warm-up cache
+    preprocess.execute(out_blob, info, false);
+
+    Blob2Img<Precision::FP32>(out_blob, out_mat, out_layout);
+
+    cv::Mat ocv_resized;
+    auto cv_interp = interp == RESIZE_AREA ? cv::INTER_AREA : cv::INTER_LINEAR;
+    cv::resize(in_mat1, ocv_resized, out_size, 0, 0, cv_interp);
+
+    std::vector<cv::Mat> ocv_planes;
+    cv::split(ocv_resized, ocv_planes);
+    for (int c = 0; c < ocv_chan; c++) {
+        ocv_planes[c].convertTo(ocv_planes[c], CV_32F, scales[c], -means[c] * scales[c]);
+    }
+    cv::Mat ocv_out_mat;
+    cv::merge(ocv_planes, ocv_out_mat);
+
+    // the resized values may differ by 1 before the normalization
+    cv::Mat absDiff;
+    cv::absdiff(ocv_out_mat, out_mat, absDiff);
+    EXPECT_EQ(cv::countNonZero(absDiff.reshape(1) > scales[0] + 1e-5), 0);
+
+#if PERF_TEST
+    test_ms([&]() { preprocess.execute(out_blob, info, false); },
+            300,
+            "PreprocNormalize %d %dx%d %dx%d",
+            ocv_chan,
+            in_size.width, in_size.height,
+            out_size.width, out_size.height);
+#endif // PERF_TEST
+}
+
+TEST_P(PreprocRoisTest, Performance)
+{
+    using namespace InferenceEngine;
+    ResizeAlgorithm interp;
+    Layout in_layout, out_layout;
+    int ocv_chan = -1;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(interp, in_layout, out_layout, ocv_chan, sizes) = GetParam();
+    cv::Size in_size, out_size;
+    std::tie(in_size, out_size) = sizes;
+
+    const int ocv_type = CV_MAKETYPE(CV_8U, ocv_chan);
+    initMatrixRandU(ocv_type, in_size, ocv_type, false);
+    Blob::Ptr in_blob = img2Blob<Precision::U8>(in_mat1, in_layout);
+
+    // the ROIs overlap and have different sizes, two of them have the same area
+    const int w = in_size.width, h = in_size.height;
+    const std::vector<cv::Rect> rects = { cv::Rect(0, 0, w, h),
+                                          cv::Rect(w / 4, h / 4, w / 2, h / 2),
+                                          cv::Rect(w / 8, h / 2, w / 2, h / 4),
+                                          cv::Rect(w / 2, h / 8, w / 4, h / 2) };
+    std::vector<ROI> rois;
+    for (size_t i = 0; i < rects.size(); i++) {
+        rois.push_back(ROI{i, static_cast<size_t>(rects[i].x), static_cast<size_t>(rects[i].y),
+                           static_cast<size_t>(rects[i].width), static_cast<size_t>(rects[i].height)});
+    }
+
+    // one more batch than ROIs, it is left intact
+    const size_t batch = rois.size() + 1;
+    const size_t batch_size = ocv_chan * out_size.width * out_size.height;
+    Blob::Ptr out_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8,
+        {batch, static_cast<size_t>(ocv_chan), static_cast<size_t>(out_size.height),
+         static_cast<size_t>(out_size.width)}, out_layout));
+    out_blob->allocate();
+    std::fill_n(out_blob->buffer().as<uint8_t*>(), out_blob->size(), 0);
+
+    PreProcessData preprocess;
+    preprocess.setRoiBlobs(in_blob, rois);
+    ASSERT_EQ(in_blob, preprocess.getRoiBlob());
+
+    // test once to warm-up cache
+    preprocess.execute(out_blob, interp, false);
+
+    auto cv_interp = interp == RESIZE_AREA ? cv::INTER_AREA : cv::INTER_LINEAR;
+    for (size_t i = 0; i < rects.size(); i++) {
+        Blob::Ptr batch_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8,
+            {1, static_cast<size_t>(ocv_chan), static_cast<size_t>(out_size.height),
+             static_cast<size_t>(out_size.width)}, out_layout),
+            out_blob->buffer().as<uint8_t*>() + i * batch_size);
+        cv::Mat out_mat(out_size, ocv_type);
+        Blob2Img<Precision::U8>(batch_blob, out_mat, out_layout);
+
+        cv::Mat ocv_out_mat;
+        cv::resize(in_mat1(rects[i]), ocv_out_mat, out_size, 0, 0, cv_interp);
+
+        cv::Mat absDiff;
+        cv::absdiff(ocv_out_mat, out_mat, absDiff);
+        EXPECT_EQ(cv::countNonZero(absDiff.reshape(1) > 1), 0) << "ROI " << i;
+    }
+
+    const auto *tail = out_blob->buffer().as<uint8_t*>() + rects.size() * batch_size;
+    EXPECT_EQ(std::count(tail, tail + batch_size, 0), static_cast<std::ptrdiff_t>(batch_size));
+
+#if PERF_TEST
+    test_ms([&]() { preprocess.execute(out_blob, interp, false); },
+            300,
+            "PreprocRois %d %dx%d %dx%d",
+            ocv_chan,
+            in_size.width, in_size.height,
+            out_size.width, out_size.height);
+#endif // PERF_TEST
+}
+
+TEST_P(PreprocSourcesTest, Performance)
+{
+    using namespace InferenceEngine;
+    ResizeAlgorithm interp;
+    Layout in_layout, out_layout;
+    int ocv_chan = -1;
+    cv::Size out_size;
+    std::tie(interp, in_layout, out_layout, ocv_chan, out_size) = GetParam();
+
+    // the frames of the sources with different resolutions come to the requests in turn
+    const int ocv_type = CV_MAKETYPE(CV_8U, ocv_chan);
+    const std::vector<cv::Size> in_sizes = { cv::Size(1920, 1080), cv::Size(1280, 720), cv::Size(640, 480) };
+    std::vector<cv::Mat> frames;
+    std::vector<Blob::Ptr> in_blobs;
+    for (const auto &in_size : in_sizes) {
+        frames.emplace_back(in_size, ocv_type);
+        cv::randu(frames.back(), cv::Scalar::all(0), cv::Scalar::all(255));
+        in_blobs.push_back(img2Blob<Precision::U8>(frames.back(), in_layout));
+    }
+
+    cv::Mat out_mat(out_size, ocv_type);
+    Blob::Ptr out_blob = img2Blob<Precision::U8>(out_mat, out_layout);
+
+    PreProcessData requests[2];
+    auto cv_interp = interp == RESIZE_AREA ? cv::INTER_AREA : cv::INTER_LINEAR;
+    for (size_t n = 0; n < 2 * in_blobs.size() * 2; n++) {
+        const size_t frame = n % in_blobs.size();
+        auto &preprocess = requests[n % 2];
+        preprocess.setRoiBlob(in_blobs[frame]);
+        preprocess.execute(out_blob, interp, false);
+        Blob2Img<Precision::U8>(out_blob, out_mat, out_layout);
+
+        cv::Mat ocv_out_mat;
+        cv::resize(frames[frame], ocv_out_mat, out_size, 0, 0, cv_interp);
+
+        cv::Mat absDiff;
+        cv::absdiff(ocv_out_mat, out_mat, absDiff);
+        EXPECT_EQ(cv::countNonZero(absDiff.reshape(1) > 1), 0) << "frame " << n;
+    }
+
+#if PERF_TEST
+    size_t n = 0;
+    test_ms([&]() {
+                auto &preprocess = requests[n % 2];
+                preprocess.setRoiBlob(in_blobs[n++ % in_blobs.size()]);
+                preprocess.execute(out_blob, interp, false);
+            },
+            300,
+            "PreprocSources %d %dx%d",
+            ocv_chan,
+            out_size.width, out_size.height);
+#endif // PERF_TEST
+}
+
 } // opencv_test
 
 #endif //OPENCV_GAPI_CORE_TESTS_INL_HPP
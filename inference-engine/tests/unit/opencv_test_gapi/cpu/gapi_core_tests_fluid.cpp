@@ -206,6 +206,29 @@ INSTANTIATE_TEST_CASE_P(ReorderResize_Patch, PreprocTest,
                                 Values(1, 3),
                                 PATCH_SIZES));
 
+INSTANTIATE_TEST_CASE_P(ResizeNormalize_Frame, PreprocNormalizeTest,
+                        Combine(Values(IE::ResizeAlgorithm::RESIZE_BILINEAR, IE::ResizeAlgorithm::RESIZE_AREA),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                Values(1, 3),
+                                FRAME_SIZES));
+
+INSTANTIATE_TEST_CASE_P(ResizeRois_Frame, PreprocRoisTest,
+                        Combine(Values(IE::ResizeAlgorithm::RESIZE_BILINEAR, IE::ResizeAlgorithm::RESIZE_AREA),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                Values(1, 3),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(224, 224)),
+                                       std::make_pair(cv::Size(1280, 720), cv::Size(64, 64)),
+                                       std::make_pair(cv::Size(640, 480), cv::Size(128, 384)))));
+
+INSTANTIATE_TEST_CASE_P(ResizeSources_Frame, PreprocSourcesTest,
+                        Combine(Values(IE::ResizeAlgorithm::RESIZE_BILINEAR, IE::ResizeAlgorithm::RESIZE_AREA),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                Values(IE::Layout::NCHW),
+                                Values(1, 3),
+                                Values(cv::Size(224, 224), cv::Size(544, 320))));
+
 INSTANTIATE_TEST_CASE_P(Everything, PreprocTest,
                         Combine(Values(IE::Precision::U8, IE::Precision::FP32),
                                 Values(IE::ResizeAlgorithm::RESIZE_BILINEAR, IE::ResizeAlgorithm::RESIZE_AREA),
@@ -765,6 +765,64 @@ INSTANTIATE_TEST_CASE_P(
         )
 );
 
+INSTANTIATE_TEST_CASE_P(
+        BuiltInDetectronImpls, BuiltInShapeInferImplTest,
+        ::testing::Values(
+                ::testing::make_tuple(LayerType("ExperimentalDetectronDetectionOutput"),
+                                      InOutShapes({{{1000, 4}, {1000, 324}, {1000, 81}, {1, 3}},
+                                                   {{100, 4}, {100}, {100}, {100}}}),
+                                      NewInOutShapes({{{500, 4}, {500, 324}, {500, 81}, {1, 3}},
+                                                      {{50, 4}, {50}, {50}, {50}}}),
+                                      MapParams(MapStrStr(std::map<std::string, std::string>{
+                                              {"max_detections_per_image", "50"}})),
+                                      LayerDataName("data"),
+                                      CanInfer(true)),
+                ::testing::make_tuple(LayerType("ExperimentalDetectronGenerateProposalsSingleImage"),
+                                      InOutShapes({{{3}, {12000, 4}, {3, 50, 50}, {3, 50, 50}},
+                                                   {{1000, 4}, {1000}}}),
+                                      NewInOutShapes({{{3}, {30000, 4}, {3, 100, 100}, {3, 100, 100}},
+                                                      {{300, 4}, {300}}}),
+                                      MapParams(MapStrStr(std::map<std::string, std::string>{
+                                              {"post_nms_count", "300"}})),
+                                      LayerDataName("data"),
+                                      CanInfer(true)),
+                ::testing::make_tuple(LayerType("ExperimentalDetectronPriorGridGenerator"),
+                                      InOutShapes({{{3, 4}, {1, 256, 50, 50}, {1, 3, 800, 800}},
+                                                   {{7500, 4}}}),
+                                      NewInOutShapes({{{3, 4}, {1, 256, 25, 40}, {1, 3, 400, 640}},
+                                                      {{3000, 4}}}),
+                                      MapParams(MapStrStr(std::map<std::string, std::string>{{"flatten", "1"}})),
+                                      LayerDataName("data"),
+                                      CanInfer(true)),
+                ::testing::make_tuple(LayerType("ExperimentalDetectronPriorGridGenerator"),
+                                      InOutShapes({{{3, 4}, {1, 256, 50, 50}, {1, 3, 800, 800}},
+                                                   {{50, 50, 3, 4}}}),
+                                      NewInOutShapes({{{3, 4}, {1, 256, 25, 40}, {1, 3, 400, 640}},
+                                                      {{10, 40, 3, 4}}}),
+                                      MapParams(MapStrStr(std::map<std::string, std::string>{{"flatten", "0"},
+                                                                                             {"h",       "10"}})),
+                                      LayerDataName("data"),
+                                      CanInfer(true)),
+                ::testing::make_tuple(LayerType("ExperimentalDetectronROIFeatureExtractor"),
+                                      InOutShapes({{{1000, 4}, {1, 256, 200, 200}, {1, 256, 100, 100}},
+                                                   {{1000, 256, 7, 7}, {1000, 4}}}),
+                                      NewInOutShapes({{{300, 4}, {1, 128, 100, 100}, {1, 128, 50, 50}},
+                                                      {{300, 128, 7, 7}, {300, 4}}}),
+                                      MapParams(MapStrStr(std::map<std::string, std::string>{
+                                              {"output_size", "7"}, {"pyramid_scales", "4,8"}, {"sampling_ratio", "2"}})),
+                                      LayerDataName("data"),
+                                      CanInfer(true)),
+                ::testing::make_tuple(LayerType("ExperimentalDetectronTopKROIs"),
+                                      InOutShapes({{{5000, 4}, {5000}},
+                                                   {{1000, 4}}}),
+                                      NewInOutShapes({{{2000, 4}, {2000}},
+                                                      {{1000, 4}}}),
+                                      MapParams(MapStrStr(std::map<std::string, std::string>{{"max_rois", "1000"}})),
+                                      LayerDataName("data"),
+                                      CanInfer(true))
+        )
+);
+
 class LayerValidatorNegativeTests : public BuiltInShapeInferImplTest {
 };
 
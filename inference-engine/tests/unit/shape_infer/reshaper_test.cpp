@@ -187,6 +187,28 @@ TEST_F(ReshaperTest, canResetOnReshape) {
     reshaper.run({{"0", {2}}});
 }
 
+TEST_F(ReshaperTest, canReshapeOnlyChangedInputs) {
+    EXPECT_CALL(mockNet, getInputsInfo(_)).WillRepeatedly(WithArg<0>(Invoke([&](InputsDataMap& maps) {
+        prepareInputs(maps);
+    })));
+    auto testCreator = std::make_shared<TestLauncherCreator>();
+    Reshaper reshaper(mockNet, testCreator);
+    auto mocks = testCreator->getMocks();
+    auto inputMock = mocks[0];
+    EXPECT_CALL(*(inputMock.launcher).get(), setShapeByName(_, _)).Times(2);
+    for (auto it:mocks) {
+        EXPECT_CALL(*(it.launcher).get(), getLayerName()).WillRepeatedly(Return(it.launcher->realGetLayerName()));
+        EXPECT_CALL(*(it.launcher).get(), reset()).Times(1);
+        EXPECT_CALL(*(it.launcher).get(), reshape(_)).Times(2);
+        EXPECT_CALL(*(it.launcher).get(), applyChanges(_)).Times(2);
+    }
+
+    SET_DIMS(0, {1, 2});
+    reshaper.run({{"0", {1, 2}}});
+    reshaper.run({{"0", {1, 2}}});
+    reshaper.run({{"0", {1, 3}}});
+}
+
 TEST_F(ReshaperTest, canUpdateFakeImpl) {
     EXPECT_CALL(mockNet, getInputsInfo(_)).WillRepeatedly(WithArg<0>(Invoke([&](InputsDataMap& maps) {
         prepareInputs(maps);
@@ -161,6 +161,9 @@ typedef struct
     uint32_t enable_memory_pool;                        ///< Enables memory usage optimization. memory objects will be reused when possible. 
     void* context;
     const char* tuning_cache_path;                      ///< Enables defining other than default path to tuning cache json 
+    const char* kernels_cache_dir;                      ///< Specifies a directory where the binaries of the built OpenCL programs are cached. Null/empty values means no caching.
+    uint16_t n_build_threads;                           ///< Max number of host threads which build the OpenCL programs concurrently. 0 means the number of hardware threads.
+    uint16_t n_streams;                                 ///< Number of the command queues (streams) the networks execute on concurrently. 0 means 1.
 }  cldnn_engine_configuration;
 
 /// @brief Information about the engine returned by cldnn_get_engine_info().
@@ -185,6 +188,7 @@ typedef struct
 
     uint8_t supports_imad;             ///< Does engine support int8 mad.
     uint8_t supports_immad;            ///< Does engine support int8 multi mad.
+    uint8_t supports_host_unified_memory; ///< Does engine share the physical memory with the host (CL_DEVICE_HOST_UNIFIED_MEMORY cap).
 }  cldnn_engine_info;
 /// @}
 
@@ -568,7 +572,7 @@ CLDNN_API void cldnn_release_topology(cldnn_topology topology, cldnn_status* sta
 /// @addtogroup c_engine
 /// @{
 
-/// @brief number of available engines of the particular type
+/// @brief number of available engines of the particular type, for the OCL engines the number of the GPUs
 CLDNN_API uint32_t cldnn_get_engine_count(/*cldnn_engine_type*/ int32_t type, cldnn_status* status);
 
 /// @brief Release pending memory allocated in OpenCL context.
@@ -579,7 +583,7 @@ CLDNN_API void cldnn_release_pending_memory(cldnn_engine engine, cldnn_status* s
 
 /// @brief Create new engine of the specified @p type, @p engine_num, and @p configuration options.
 /// @param[in] type Engine type @ref cldnn_engine_type. Only OCL engine is supported.
-/// @param[in] engine_num Engine index. Should be 0.
+/// @param[in] engine_num Engine index, the index of the GPU among the cldnn_get_engine_count() ones.
 /// @param[in] configuration Pointer to engine configuration options.
 CLDNN_API cldnn_engine cldnn_create_engine(/*cldnn_engine_type*/ int32_t type, uint32_t engine_num, const cldnn_engine_configuration* configuration, cldnn_status* status);
 
@@ -602,6 +606,24 @@ CLDNN_API int64_t cldnn_get_temp_used_device_memory_size(cldnn_engine engine, cl
 /// @brief Returns max size of resources allocated using given engine
 CLDNN_API int64_t cldnn_get_max_used_device_memory_size(cldnn_engine engine, cldnn_status* status);
 
+/// @brief Returns names of the binaries of the OpenCL programs built or added to the engine.
+/// @details Function fills user provided buffer by binary names. Each name is followed by '\0'.
+/// Empty name "\0\0" means end of data.
+/// @param[in] names Pointer to user-allocated buffer to store names.
+/// @param[in] size Size (in chars) of the buffer.
+/// @param[out] size_ret Required size (in chars) to store result.
+CLDNN_API void cldnn_get_engine_program_binary_names(cldnn_engine engine, char* names, size_t size, size_t* size_ret, cldnn_status* status);
+
+/// @brief Copies the binary of the OpenCL program with the @p name to the user provided buffer.
+/// @param[in] binary Pointer to user-allocated buffer to store the binary.
+/// @param[in] size Size (in bytes) of the buffer.
+/// @param[out] size_ret Required size (in bytes) to store result.
+CLDNN_API void cldnn_get_engine_program_binary(cldnn_engine engine, const char* name, void* binary, size_t size, size_t* size_ret, cldnn_status* status);
+
+/// @brief Adds the binary of the OpenCL program with the @p name to the engine.
+/// @details The programs built later by the engine from the same sources are created from the binary instead of compiling them.
+CLDNN_API void cldnn_add_engine_program_binary(cldnn_engine engine, const char* name, const void* binary, size_t size, cldnn_status* status);
+
 /// @addtogroup c_network
 /// @{
 
@@ -666,6 +688,12 @@ CLDNN_API        cldnn_network cldnn_build_network(cldnn_engine engine, cldnn_to
 /// @param[in] program The program object which holds binaries compiled from some topology and engine. Multiple network objects can share the same program.
 CLDNN_API        cldnn_network cldnn_allocate_network(cldnn_program program, cldnn_status* status);
 
+/// @brief Allocates a new network which is executed on the command queue of the stream @p stream_id of the engine.
+/// @details The networks of different streams are executed concurrently, the networks allocated from the same program share its constant data.
+/// @param[in] program The program object which holds binaries compiled from some topology and engine.
+/// @param[in] stream_id The stream of the network, less than the number of the engine streams.
+CLDNN_API        cldnn_network cldnn_allocate_network_on_stream(cldnn_program program, uint16_t stream_id, cldnn_status* status);
+
 /// @brief Increment reference counter for the network object.
 CLDNN_API                 void cldnn_retain_network(cldnn_network network, cldnn_status* status);
 
@@ -709,6 +737,10 @@ CLDNN_API        cldnn_program cldnn_get_network_program(cldnn_network network,
 /// @param[out] size_ret Required size (in chars) to store result.
 CLDNN_API                 void cldnn_get_network_output_names(cldnn_network network, char* names, size_t size, size_t* size_ret, cldnn_status* status);
 
+/// @brief Returns the size of the device memory used by the network: its intermediate buffers, outputs and constants.
+/// @details The buffers the network shares with the other networks of the engine are counted in full.
+CLDNN_API int64_t cldnn_get_network_used_device_memory_size(cldnn_network network, cldnn_status* status);
+
 /// @brief Returns names of executed primitives.
 /// @details Function fills user provided buffer by primitive names. Each name is followed by '\0'.
 /// Empty name "\0\0" means end of data.
@@ -769,6 +801,18 @@ CLDNN_API cldnn_memory cldnn_allocate_memory(cldnn_engine engine, cldnn_layout l
 /// @brief Create memory object attached to the buffer allocated by user.
 /// @note User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
 CLDNN_API cldnn_memory cldnn_attach_memory(cldnn_layout layout, void* pointer, size_t size, cldnn_status* status);
+/// @brief Create memory object of the @p engine which the device accesses directly in the buffer allocated by user.
+/// @note The buffer should be aligned to 4096 bytes and its size should be a multiple of 64 bytes, otherwise the driver may copy the data.
+/// User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
+CLDNN_API cldnn_memory cldnn_share_host_memory(cldnn_engine engine, cldnn_layout layout, void* pointer, size_t size, cldnn_status* status);
+/// @brief Copies the buffer allocated by user to the memory object on the transfer queue of the engine, the host is not blocked.
+/// @details The copy does not wait for the executed networks. The returned event can be passed to cldnn_execute_network(),
+/// so the network reads the memory after the copy.
+/// @note The buffer should not be changed or released until the returned event is complete.
+CLDNN_API cldnn_event cldnn_write_memory_async(cldnn_memory memory, const void* pointer, size_t size, cldnn_status* status);
+/// @brief Copies the memory object to the buffer allocated by user after the commands enqueued by @p network, the host is not blocked.
+/// @note The buffer should not be accessed or released until the returned event is complete.
+CLDNN_API cldnn_event cldnn_read_memory_async(cldnn_network network, cldnn_memory memory, void* pointer, size_t size, cldnn_status* status);
 /// @brief Checks if two memory objects refer to the same underlaying buffer.
 CLDNN_API int32_t cldnn_is_the_same_buffer(cldnn_memory mem1, cldnn_memory mem2, cldnn_status* status);
 /// @brief Increment reference counter for the memory object.
@@ -0,0 +1,52 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef NV12_TO_BGR_H
+#define NV12_TO_BGR_H
+
+#include "cldnn.h"
+
+
+/// @addtogroup c_api C API
+/// @{
+/// @addtogroup c_topology Network Topology
+/// @{
+/// @addtogroup c_primitives Primitives
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// @brief Converts the NV12 frames to the planar BGR images of the output size.
+/// @details The input is the u8 tensor of the height 3/2 of the frame height with the Y plane followed by
+/// the interleaved UV plane. The colors are converted as BT.601 and resized with the bilinear interpolation.
+CLDNN_BEGIN_PRIMITIVE_DESC(nv12_to_bgr)
+/// @brief Size of the output images, its feature is 3.
+cldnn_tensor output_size;
+CLDNN_END_PRIMITIVE_DESC(nv12_to_bgr)
+
+CLDNN_DECLARE_PRIMITIVE_TYPE_ID(nv12_to_bgr);
+
+#ifdef __cplusplus
+}
+#endif
+
+/// @}
+/// @}
+/// @}
+#endif // NV12_TO_BGR_H
@@ -17,6 +17,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "cldnn_defs.h"
+#include <cassert>
+#include <string>
+#include <vector>
 
 namespace cldnn
 {
@@ -69,6 +72,9 @@ struct engine_configuration
     bool enable_memory_pool;                    ///< Enables memory usage optimization. memory objects will be reused when possible (switched off for older drivers then NEO).
     void* context;              ///< Pointer to user context
     const std::string tuning_cache_path;        ///< Path to tuning kernel cache 
+    const std::string kernels_cache_dir;        ///< Specifies a directory where the binaries of the built OpenCL programs are cached between the runs. Empty by default (means no caching).
+    const uint16_t n_build_threads;             ///< Max number of host threads which build the OpenCL programs concurrently. 0 by default (means the number of hardware threads).
+    const uint16_t n_streams;                   ///< Number of the command queues (streams) the networks execute on concurrently. 1 by default.
 
     /// @brief Constructs engine configuration with specified options.
     /// @param profiling Enable per-primitive profiling.
@@ -76,6 +82,9 @@ struct engine_configuration
     /// @param dump_custom_program Dump the custom OpenCL programs to files
     /// @param options OpenCL compiler options string.
     /// @param single_kernel If provided, runs specific layer.
+    /// @param kernels_cache_dir If provided, the programs are loaded from the binaries cached in the directory instead of building them.
+    /// @param n_build_threads Max number of threads to build the programs, 0 means the number of hardware threads.
+    /// @param n_streams Number of the command queues, a network is executed on the queue of its stream.
     engine_configuration(
             bool profiling = false,
             bool decorate_kernel_names = false,
@@ -89,7 +98,10 @@ struct engine_configuration
             throttle_mode_types throttle_mode = throttle_mode_types::disabled,
             bool memory_pool = true,
             void* context = nullptr,
-            const std::string& tuning_cache_path = "cache.json")
+            const std::string& tuning_cache_path = "cache.json",
+            const std::string& kernels_cache_dir = std::string(),
+            uint16_t n_build_threads = 0,
+            uint16_t n_streams = 1)
         : enable_profiling(profiling)
         , meaningful_kernels_names(decorate_kernel_names)
         , dump_custom_program(dump_custom_program)
@@ -103,6 +115,9 @@ struct engine_configuration
         , enable_memory_pool(memory_pool)
         , context(context)
         , tuning_cache_path(tuning_cache_path)
+        , kernels_cache_dir(kernels_cache_dir)
+        , n_build_threads(n_build_threads)
+        , n_streams(n_streams)
     {}
 
     engine_configuration(const cldnn_engine_configuration& c_conf)
@@ -119,6 +134,9 @@ struct engine_configuration
         , enable_memory_pool(c_conf.enable_memory_pool != 0)
         , context(c_conf.context)
 		, tuning_cache_path(c_conf.tuning_cache_path)
+        , kernels_cache_dir(c_conf.kernels_cache_dir)
+        , n_build_threads(c_conf.n_build_threads)
+        , n_streams(c_conf.n_streams)
     {}
 
     /// @brief Implicit conversion to C API @ref ::cldnn_engine_configuration
@@ -137,7 +155,10 @@ struct engine_configuration
             static_cast<int16_t>(throttle_mode),
             enable_memory_pool,
             context,
-            tuning_cache_path.c_str()
+            tuning_cache_path.c_str(),
+            kernels_cache_dir.c_str(),
+            n_build_threads,
+            n_streams
         };
     }
 };
@@ -156,7 +177,7 @@ struct engine
 
     /// @brief Construct engine of the specified @p type, @p engine_num, and @p configuration options.
     /// @param[in] type Engine type @ref cldnn_engine_type. Only OCL engine is supported.
-    /// @param[in] engine_num Engine index. Should be 0.
+    /// @param[in] engine_num Engine index, the index of the GPU among the @ref engine_count() ones.
     /// @param[in] configuration Pointer to engine configuration options.
     engine(engine_types type, uint32_t engine_num, const engine_configuration& configuration = engine_configuration())
         :_impl(check_status<::cldnn_engine>("failed to create engine", [&](status_t* status)
@@ -245,6 +266,56 @@ struct engine
         });
     }
 
+    /// @brief Returns the names of the binaries of the OpenCL programs built or added to the engine.
+    std::vector<std::string> get_program_binary_names() const
+    {
+        size_t size_ret = 0;
+        status_t err_invalid_arg = CLDNN_SUCCESS;
+        cldnn_get_engine_program_binary_names(_impl, nullptr, 0, &size_ret, &err_invalid_arg);
+        assert(err_invalid_arg == CLDNN_INVALID_ARG);
+        assert(size_ret > 0);
+        std::vector<char> names_buf(size_ret);
+
+        check_status<void>("get program binary names failed", [&](status_t* status)
+        {
+            cldnn_get_engine_program_binary_names(_impl, names_buf.data(), names_buf.size(), &size_ret, status);
+        });
+
+        std::vector<std::string> result;
+        for (auto buf_ptr = names_buf.data(); *buf_ptr != 0; buf_ptr += result.back().size() + 1)
+        {
+            result.emplace_back(buf_ptr);
+        }
+        return result;
+    }
+
+    /// @brief Returns the binary of the OpenCL program with the @p name.
+    std::vector<unsigned char> get_program_binary(const std::string& name) const
+    {
+        size_t size_ret = 0;
+        status_t err_invalid_arg = CLDNN_SUCCESS;
+        cldnn_get_engine_program_binary(_impl, name.c_str(), nullptr, 0, &size_ret, &err_invalid_arg);
+        std::vector<unsigned char> binary(size_ret);
+        if (binary.empty())
+            return binary;
+
+        check_status<void>("get program binary failed", [&](status_t* status)
+        {
+            cldnn_get_engine_program_binary(_impl, name.c_str(), binary.data(), binary.size(), &size_ret, status);
+        });
+        return binary;
+    }
+
+    /// @brief Adds the binary of the OpenCL program with the @p name, got from @ref get_program_binary of another engine.
+    /// The programs built from the same sources for the same device are created from the binary instead of compiling them.
+    void add_program_binary(const std::string& name, const std::vector<unsigned char>& binary) const
+    {
+        check_status<void>("add program binary failed", [&](status_t* status)
+        {
+            cldnn_add_engine_program_binary(_impl, name.c_str(), binary.data(), binary.size(), status);
+        });
+    }
+
     /// @brief get C API engine handler.
     ::cldnn_engine get() const { return _impl; }
 
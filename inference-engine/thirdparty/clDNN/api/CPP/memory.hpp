@@ -21,6 +21,7 @@
 #include "compounds.h"
 #include "layout.hpp"
 #include "engine.hpp"
+#include "event.hpp"
 #include <memory>
 #include <iterator>
 
@@ -78,6 +79,27 @@ struct memory
         });
     }
 
+    /// Create memory object of the @p engine which the device accesses directly in the buffer allocated by user.
+    /// @param ptr  The pointer to user allocated buffer.
+    /// @param size Size (in bytes) of the buffer. Should be equal to @p layout.data_size()
+    /// @note The buffer should be aligned to 4096 bytes and its size should be a multiple of 64 bytes, otherwise the driver may copy the data.
+    /// User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
+    template<typename T>
+    static memory share_host_buffer(const engine& engine, const cldnn::layout& layout, T* ptr, size_t size)
+    {
+        if (!ptr) throw std::invalid_argument("pointer should not be null");
+        size_t data_size = size * sizeof(T);
+        if (data_size != layout.bytes_count()) {
+            std::string err_str("buffer size mismatch - input size " + std::to_string(data_size) + " layout size " + std::to_string(layout.bytes_count()));
+            throw std::invalid_argument(err_str);
+        }
+
+        return check_status<cldnn_memory>("memory sharing failed", [&](status_t* status)
+        {
+            return cldnn_share_host_memory(engine.get(), layout, ptr, data_size, status);
+        });
+    }
+
     memory(const memory& other)
         :_impl(other._impl), _layout(other._layout)
         ,_size(other._size), _count(other._count)
@@ -132,6 +154,18 @@ struct memory
         });
     }
 
+    /// @brief Copies the buffer allocated by user to the memory on the transfer queue of the engine, the host is not blocked.
+    /// @details The copy does not wait for the executed networks. Pass the returned event to network::execute(),
+    /// so the network reads the memory after the copy.
+    /// @note The buffer should not be changed or released until the returned event is complete.
+    event write_async(const void* ptr, size_t size) const
+    {
+        return check_status<cldnn_event>("asynchronous memory write failed", [&](status_t* status)
+        {
+            return cldnn_write_memory_async(_impl, ptr, size, status);
+        });
+    }
+
     /// Creates the @ref pointer object to get an access memory data
     template<typename T> friend struct cldnn::pointer;
     template<typename T> cldnn::pointer<T> pointer() const;
@@ -67,6 +67,16 @@ struct network
                 }))
     {}
 
+    /// @brief Allocate network executed on the command queue of the engine stream.
+    /// @param program The program object which contains compiled primitives this network should allocate memory for.
+    /// @param stream_id The stream of the network, the networks of different streams are executed concurrently.
+    network(program const& program, uint16_t stream_id)
+        :_impl(check_status<cldnn_network>("network allocation failed", [&](status_t* status)
+                {
+                    return cldnn_allocate_network_on_stream(program.get(), stream_id, status);
+                }))
+    {}
+
     /// @brief Constructs network object from implicitly created program object. This is a shorthand for network(program(engine, topology, options))
     /// @param engine
     /// @param topology
@@ -112,6 +122,12 @@ struct network
         return check_status<cldnn_engine>("get network engine failed", [&](status_t* status) { return cldnn_get_network_engine(_impl, status); });
     }
 
+    /// @brief Returns the size of the device memory used by the network, including the buffers it shares with the other networks.
+    uint64_t get_used_device_memory_size() const
+    {
+        return static_cast<uint64_t>(check_status<int64_t>("get network used device memory size failed", [&](status_t* status) { return cldnn_get_network_used_device_memory_size(_impl, status); }));
+    }
+
     /// @brief Returns network internal @ref program.
     program get_program() const
     {
@@ -277,6 +293,16 @@ struct network
         return result;
     }
 
+    /// @brief Copies the memory to the buffer allocated by user after the commands of the last execution, the host is not blocked.
+    /// @note The buffer should not be accessed or released until the returned event is complete.
+    event read_memory_async(const memory& mem, void* ptr, size_t size) const
+    {
+        return check_status<cldnn_event>("asynchronous memory read failed", [&](status_t* status)
+        {
+            return cldnn_read_memory_async(_impl, mem.get(), ptr, size, status);
+        });
+    }
+
     /// @brief Returns wrapped C API @ref cldnn_network handler.
     cldnn_network get() const { return _impl; }
 
@@ -0,0 +1,75 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "../C/nv12_to_bgr.h"
+#include "primitive.hpp"
+
+namespace  cldnn
+{
+/// @addtogroup cpp_api C++ API
+/// @{
+/// @addtogroup cpp_topology Network Topology
+/// @{
+/// @addtogroup cpp_primitives Primitives
+/// @{
+
+/// @brief Converts the NV12 frames to the planar BGR images of the output size.
+/// @details The input is the u8 tensor of the height 3/2 of the frame height with the Y plane followed by
+/// the interleaved UV plane. The colors are converted as BT.601 and resized with the bilinear interpolation.
+struct nv12_to_bgr : public primitive_base<nv12_to_bgr, CLDNN_PRIMITIVE_DESC(nv12_to_bgr)>
+{
+    CLDNN_DECLARE_PRIMITIVE(nv12_to_bgr)
+
+    /// @brief Constructs nv12_to_bgr primitive.
+    /// @param id This primitive id.
+    /// @param input Input NV12 frames primitive id.
+    /// @param output_size Size of the output images.
+    /// @param output_data_type Data type of the output images, f32 if not specified.
+    nv12_to_bgr(
+        const primitive_id& id,
+        const primitive_id& input,
+        const tensor& output_size,
+        const optional_data_type output_data_type = optional_data_type(),
+        const padding& output_padding = padding()
+    )
+        : primitive_base(id, {input}, output_padding, output_data_type)
+        , output_size(output_size)
+    {
+    }
+
+    /// @brief Constructs a copy from C API @CLDNN_PRIMITIVE_DESC{nv12_to_bgr}
+    nv12_to_bgr(const dto* dto)
+        : primitive_base(dto)
+        , output_size(dto->output_size)
+    {
+    }
+
+    /// @brief Size of the output images.
+    tensor output_size;
+protected:
+
+    void update_dto(dto& dto) const override
+    {
+        dto.output_size = output_size;
+    }
+};
+/// @}
+/// @}
+/// @}
+}
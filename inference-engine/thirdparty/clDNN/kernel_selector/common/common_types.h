@@ -74,7 +74,9 @@ namespace kernel_selector
         DEPTH_TO_SPACE,
         SHUFFLE_CHANNELS,
         STRIDED_SLICE,
-        REVERSE_SEQUENCE
+        REVERSE_SEQUENCE,
+        NV12_TO_BGR,
+        LSTM_SEQ
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -78,6 +78,7 @@ namespace kernel_selector
             {  0,  1,  2,  3, -1, -1 }, // WeightsLayout::os_is_y_x8_osv8_isv4
             {  0,  1,  2,  3,  4,  5 }, // WeightsLayout::bf_lyx_yx
             {  0,  1,  2,  3, -1, -1 }, // WeightsLayout::os_is_yx_osv16_isv4
+            {  0,  1,  2,  3, -1, -1 }, // WeightsLayout::winograd_4x4_3x3_s1_weights
         } };
 
         NDims DataTensor::GetSimpleDims(const std::vector<size_t>& d, DataLayout l)
@@ -415,6 +416,11 @@ namespace kernel_selector
                     vec[Channelndex(l, WeightsChannelName::X)] = 8;
                     vec[Channelndex(l, WeightsChannelName::Y)] = 3;
                 }
+                else if (l == WeightsLayout::winograd_4x4_3x3_s1_weights)
+                {
+                    vec[Channelndex(l, WeightsChannelName::X)] = 6;
+                    vec[Channelndex(l, WeightsChannelName::Y)] = 6;
+                }
             }
             else if (src_channels == 2 && dst_channels == 4)
             {
@@ -90,6 +90,7 @@ namespace kernel_selector
             os_is_y_x8_osv8_isv4, // for MMAD convolutions
             bf_lyx_yx,               // local convolution
             os_is_yx_osv16_isv4,     // swizzled weights for convolution using IMAD
+            winograd_4x4_3x3_s1_weights, // winograd convolution weights G * g * GT, F(4x4, 3x3) --filter 3x3 with stride 1
             WeightsLayoutCount       // NMBER OF ELEMENTS IN ENUM
         };
 
@@ -0,0 +1,125 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "convolution_kernel_imad_b_fs_yx_fsv4_dw.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector {
+
+    // the features packed in an element of b_fs_yx_fsv4 and the filter taps of one IMAD
+    static const size_t PACK = 4;
+
+    static size_t GetOutBlockWidth(const convolution_params& params)
+    {
+        return params.output.X().v >= 16 ? 8 : 4;
+    }
+
+    ParamsKey ConvolutionKernel_imad_b_fs_yx_fsv4_dw::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::INT8);
+        k.EnableInputDataType(Datatype::UINT8);
+        k.EnableOutputDataType(Datatype::INT8);
+        k.EnableOutputDataType(Datatype::UINT8);
+        k.EnableInputWeightsType(WeightsType::INT8);
+        k.EnableInputLayout(DataLayout::b_fs_yx_fsv4);
+        k.EnableOutputLayout(DataLayout::b_fs_yx_fsv4);
+        k.EnableDifferentInputWeightsTypes();
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableDilation();
+        k.EnableBiasPerFeature();
+        k.EnableNonBiasTerm();
+        k.EnableBatching();
+        k.EnableSplitSupport();
+        k.EnableGroupedConvolution();
+        k.EnableDepthwiseSeparableOpt();
+        k.EnableInt8Quantization();
+        k.EnableOutputCalibration();
+        k.DisableTuning();
+        return k;
+    }
+
+    bool ConvolutionKernel_imad_b_fs_yx_fsv4_dw::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!Parent::Validate(p, o))
+        {
+            return false;
+        }
+
+        const convolution_params& params = static_cast<const convolution_params&>(p);
+
+        // one input and one output feature per group, all the groups in one kernel
+        if (!params.depthwise_separable_opt ||
+            params.weights.IFM().v != 1 ||
+            params.weights.OFM().v * params.split != params.output.Feature().v ||
+            params.inputs[0].Feature().v != params.output.Feature().v ||
+            params.transposed ||
+            params.local_convolution)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    ConvolutionKernelBase::DispatchData ConvolutionKernel_imad_b_fs_yx_fsv4_dw::SetDefault(const convolution_params& params, int) const
+    {
+        DispatchData kd = Parent::SetDefault(params);
+
+        const auto& out = params.output;
+        std::vector<size_t> global = {
+            CeilDiv(out.X().v, GetOutBlockWidth(params)),
+            out.Y().v,
+            CeilDiv(out.Feature().v, PACK) * out.Batch().v
+        };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        kd.gws0 = global[0];
+        kd.gws1 = global[1];
+        kd.gws2 = global[2];
+
+        kd.lws0 = local[0];
+        kd.lws1 = local[1];
+        kd.lws2 = local[2];
+
+        kd.effiency = FORCE_PRIORITY_2;
+
+        return kd;
+    }
+
+    JitConstants ConvolutionKernel_imad_b_fs_yx_fsv4_dw::GetJitConstants(const convolution_params& params, const DispatchData& kd) const
+    {
+        auto jit = Parent::GetJitConstants(params, kd);
+
+        const size_t outBlockWidth = GetOutBlockWidth(params);
+        const size_t filterChunks = CeilDiv(params.filterSize.x, PACK);
+        jit.AddConstants({
+            MakeJitConstant("OUT_BLOCK_WIDTH", outBlockWidth),
+            MakeJitConstant("FEATURE_SLICES", CeilDiv(params.output.Feature().v, PACK)),
+            MakeJitConstant("FILTER_CHUNKS_X", filterChunks),
+            MakeJitConstant("IN_BLOCK_WIDTH", (outBlockWidth - 1) * params.stride.x + (filterChunks * PACK - 1) * params.dilation.x + 1),
+        });
+
+        return jit;
+    }
+
+    KernelsData ConvolutionKernel_imad_b_fs_yx_fsv4_dw::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetTunedKernelsDataByIndex(params, options);
+    }
+}
@@ -0,0 +1,47 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "convolution_kernel_base.h"
+
+namespace kernel_selector {
+
+    // INT8 depthwise convolution in b_fs_yx_fsv4: a work item computes a block of outputs along x for the 4 features
+    // of a slice, accumulating 4 filter taps at a time with IMAD, and requantizes and activates them before the store.
+    class ConvolutionKernel_imad_b_fs_yx_fsv4_dw : public ConvolutionKernelBase
+    {
+    public:
+        using Parent = ConvolutionKernelBase;
+        ConvolutionKernel_imad_b_fs_yx_fsv4_dw() : ConvolutionKernelBase("convolution_gpu_imad_b_fs_yx_fsv4_dw") {}
+        virtual ~ConvolutionKernel_imad_b_fs_yx_fsv4_dw() {}
+
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+
+    protected:
+        virtual ParamsKey GetSupportedKey() const override;
+        virtual bool Validate(const Params& params, const optional_params& options) const override;
+        JitConstants GetJitConstants(const convolution_params& params, const DispatchData& kd) const override;
+        DispatchData SetDefault(const convolution_params& params, int autoTuneIndex = -1) const override;
+
+        std::vector<WeightsLayout> GetSupportedWeightLayouts(const convolution_params&) const override
+        {
+            return{
+                WeightsLayout::oiyx
+            };
+        }
+    };
+}
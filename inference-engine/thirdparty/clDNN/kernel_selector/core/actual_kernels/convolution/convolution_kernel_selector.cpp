@@ -33,6 +33,7 @@
 #include "convolution_kernel_bfyx_1x1_gemm_buf.h"
 #include "convolution_kernel_winograd_2x3_s1_fused.h"
 #include "convolution_kernel_winograd_6x3_s1_fused.h"
+#include "convolution_kernel_winograd_4x4_3x3_s1.h"
 #include "convolution_kernel_MMAD.h"
 #include "convolution_kernel_MMAD_blocks.h"
 #include "convolution_kernel_1x1_gemm_MMAD.h"
@@ -51,6 +52,7 @@
 #include "convolution_kernel_imad_3x3.h"
 #include "convolution_kernel_imad_1x1.h"
 #include "convolution_kernel_imad_7x7.h"
+#include "convolution_kernel_imad_b_fs_yx_fsv4_dw.h"
 
 namespace kernel_selector 
 {
@@ -72,6 +74,7 @@ namespace kernel_selector
         Attach<ConvolutionKernel_Winograd_2x3_s1>();
         Attach<ConvolutionKernel_Winograd_2x3_s1_fused>();
         Attach<ConvolutionKernel_Winograd_6x3_s1_fused>();
+        Attach<ConvolutionKernel_Winograd_4x4_3x3_s1>();
         Attach<ConvolutionKernel_bfyx_1x1>();
         Attach<ConvolutionKernel_bfyx_1x1_gemm_buf>();
         Attach<ConvolutionKernel_MMAD>();
@@ -93,6 +96,7 @@ namespace kernel_selector
         Attach<ConvolutionKernel_imad_3x3>();
         Attach<ConvolutionKernel_imad_1x1>();
         Attach<ConvolutionKernel_imad_7x7>();
+        Attach<ConvolutionKernel_imad_b_fs_yx_fsv4_dw>();
     }
 
     KernelsData convolution_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
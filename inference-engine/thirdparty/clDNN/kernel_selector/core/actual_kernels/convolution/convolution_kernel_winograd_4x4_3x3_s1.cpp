@@ -0,0 +1,175 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "convolution_kernel_winograd_4x4_3x3_s1.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector {
+
+    // the side of the output tile of F(4x4, 3x3)
+    static const size_t WINOGRAD_TILE = 4;
+
+    ConvolutionKernel_Winograd_4x4_3x3_s1::ConvolutionKernel_Winograd_4x4_3x3_s1() : ConvolutionKernelBase("convolution_gpu_winograd_4x4_3x3_s1")
+    {
+        // more output features per work item reuse the transformed input tile, but take more registers
+        for (size_t ofmPerWorkItem : { 1, 2, 4 })
+        {
+            for (const auto& executionMode : ConvolutionKernelBase::autoTuneOptions)
+            {
+                autoTuneOptions.emplace_back(AutoTuneOption{ ofmPerWorkItem, executionMode });
+            }
+        }
+    }
+
+    ParamsKey ConvolutionKernel_Winograd_4x4_3x3_s1::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableInputWeightsType(WeightsType::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        k.EnableBiasPerFeature();
+        k.EnableBiasPerOutput();
+        k.EnableNonBiasTerm();
+        return k;
+    }
+
+    bool ConvolutionKernel_Winograd_4x4_3x3_s1::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!Parent::Validate(p, o))
+        {
+            return false;
+        }
+
+        const convolution_params& params = static_cast<const convolution_params&>(p);
+
+        if ((params.filterSize.x != 3) ||
+            (params.filterSize.y != 3) ||
+            (params.stride.x != 1) ||
+            (params.stride.y != 1) ||
+            (params.dilation.x != 1) ||
+            (params.dilation.y != 1) ||
+            (params.split != 1) ||
+            (params.groups != 1) ||
+            params.depthwise_separable_opt ||
+            params.transposed ||
+            params.local_convolution)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    ConvolutionKernel_Winograd_4x4_3x3_s1::AutoTuneOption ConvolutionKernel_Winograd_4x4_3x3_s1::GetAutoTuneOptions(const convolution_params& params, int autoTuneIndex) const
+    {
+        if ((autoTuneIndex >= 0) && (autoTuneIndex < (int)autoTuneOptions.size()))
+        {
+            return autoTuneOptions[autoTuneIndex];
+        }
+
+        return AutoTuneOption{ params.output.Feature().v % 2 == 0 ? 2u : 1u, DEFAULT };
+    }
+
+    ConvolutionKernel_Winograd_4x4_3x3_s1::Parent::DispatchData ConvolutionKernel_Winograd_4x4_3x3_s1::SetDefault(const convolution_params& params, int autoTuneIndex) const
+    {
+        DispatchData runInfo = Parent::SetDefault(params);
+
+        const auto option = GetAutoTuneOptions(params, autoTuneIndex);
+        const auto& out = params.output;
+
+        std::vector<size_t> global = {
+            CeilDiv(out.X().v, WINOGRAD_TILE),
+            CeilDiv(out.Y().v, WINOGRAD_TILE),
+            out.Feature().v / option.ofmPerWorkItem * out.Batch().v
+        };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        runInfo.gws0 = global[0];
+        runInfo.gws1 = global[1];
+        runInfo.gws2 = global[2];
+
+        runInfo.lws0 = local[0];
+        runInfo.lws1 = local[1];
+        runInfo.lws2 = local[2];
+
+        runInfo.cldnnStyle.blockWidth = WINOGRAD_TILE;
+        runInfo.cldnnStyle.blockHeight = WINOGRAD_TILE;
+
+        // offered to the auto-tuner, the untuned selection keeps the direct kernels
+        runInfo.effiency = DONT_USE_IF_HAVE_SOMETHING_ELSE;
+
+        return runInfo;
+    }
+
+    JitConstants ConvolutionKernel_Winograd_4x4_3x3_s1::GetJitConstants(const convolution_params& params, const DispatchData& runInfo) const
+    {
+        JitConstants jit = Parent::GetJitConstants(params, runInfo);
+
+        const auto& out = params.output;
+        jit.AddConstants({
+            MakeJitConstant("OFM_PER_WORK_ITEM", out.Feature().v * out.Batch().v / runInfo.gws2),
+            MakeJitConstant("OFM_BLOCKS", runInfo.gws2 / out.Batch().v),
+        });
+
+        return jit;
+    }
+
+    KernelsData ConvolutionKernel_Winograd_4x4_3x3_s1::GetTunedKernelsDataByIndex(const Params& params, const optional_params& options, const int autoTuneIndex) const
+    {
+        const convolution_params& convParams = static_cast<const convolution_params&>(params);
+        const auto option = GetAutoTuneOptions(convParams, autoTuneIndex);
+        if (convParams.output.Feature().v % option.ofmPerWorkItem != 0)
+        {
+            return{};
+        }
+
+        return GetCommonKernelsData(params, options, option.exeMode, autoTuneIndex);
+    }
+
+    KernelsData ConvolutionKernel_Winograd_4x4_3x3_s1::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetTunedKernelsDataByIndex(params, options, -1);
+    }
+
+    KernelsData ConvolutionKernel_Winograd_4x4_3x3_s1::GetKernelsDataForAutoTune(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        KernelsData res = {};
+
+        for (size_t i = 0; i < autoTuneOptions.size(); i++)
+        {
+            KernelsData kd = GetTunedKernelsDataByIndex(params, options, (int)i);
+            if (!kd.empty())
+            {
+                res.emplace_back(kd[0]);
+            }
+        }
+
+        return res;
+    }
+}
@@ -0,0 +1,54 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "convolution_kernel_base.h"
+
+namespace kernel_selector {
+
+    // Winograd F(4x4, 3x3) in bfyx: the 6x6 input tiles and the filters are transformed to the Winograd domain, where
+    // a 4x4 output tile takes 36 multiplications per input feature instead of 144. The filters are transformed once
+    // by the weights reorder. The number of the output features computed per work item is tuned.
+    class ConvolutionKernel_Winograd_4x4_3x3_s1 : public ConvolutionKernelBase
+    {
+    public:
+        using Parent = ConvolutionKernelBase;
+        ConvolutionKernel_Winograd_4x4_3x3_s1();
+        virtual ~ConvolutionKernel_Winograd_4x4_3x3_s1() {}
+
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual KernelsData GetKernelsDataForAutoTune(const Params& params, const optional_params& options) const override;
+        virtual KernelsData GetTunedKernelsDataByIndex(const Params& params, const optional_params& options, int autoTuneIndex) const override;
+
+    protected:
+        virtual ParamsKey GetSupportedKey() const override;
+        virtual std::vector<WeightsLayout> GetSupportedWeightLayouts(const convolution_params&) const override { return{ WeightsLayout::winograd_4x4_3x3_s1_weights }; }
+
+        JitConstants GetJitConstants(const convolution_params& params, const DispatchData& kd) const override;
+        bool Validate(const Params& p, const optional_params& o) const override;
+        DispatchData SetDefault(const convolution_params& arg, int autoTuneIndex = -1) const override;
+
+        struct AutoTuneOption
+        {
+            size_t ofmPerWorkItem;
+            std::string exeMode;
+        };
+
+        AutoTuneOption GetAutoTuneOptions(const convolution_params& params, int autoTuneIndex) const;
+        std::vector<AutoTuneOption> autoTuneOptions = {};
+    };
+}
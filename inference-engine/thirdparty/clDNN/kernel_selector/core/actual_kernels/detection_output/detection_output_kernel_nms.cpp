@@ -0,0 +1,141 @@
+﻿/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "detection_output_kernel_nms.h"
+#include "kernel_selector_utils.h"
+
+#define PRIOR_BOX_SIZE 4 // Each prior-box consists of [xmin, ymin, xmax, ymax].
+
+namespace kernel_selector
+{
+    namespace
+    {
+        // the candidates of a class are sorted in the local memory
+        constexpr size_t max_sort_size = 1024;
+        constexpr size_t max_work_group_size = 256;
+    }
+
+    ParamsKey DetectionOutputKernel_nms::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    KernelsData DetectionOutputKernel_nms::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        assert(params.GetType() == KernelType::DETECTION_OUTPUT &&
+               options.GetType() == KernelType::DETECTION_OUTPUT);
+
+        const detection_output_params& detectOutParams = static_cast<const detection_output_params&>(params);
+        const auto& dedicated = detectOutParams.detectOutParams;
+
+        // the adaptive NMS threshold depends on the boxes kept before, it is left to the sequential NMS
+        if (dedicated.eta < 1.0f)
+        {
+            return{};
+        }
+
+        const size_t num_images = detectOutParams.inputs[0].Batch().v;
+        const size_t num_loc_classes = dedicated.share_location ? 1 : dedicated.num_classes;
+        const size_t num_priors = detectOutParams.inputs[0].LogicalSize() / (num_images * num_loc_classes * PRIOR_BOX_SIZE);
+        const size_t scores_count = (dedicated.top_k != -1 && static_cast<size_t>(dedicated.top_k) < num_priors) ?
+            static_cast<size_t>(dedicated.top_k) : num_priors;
+        size_t sort_size = 32;
+        while (sort_size < scores_count)
+        {
+            sort_size *= 2;
+        }
+        if (sort_size > max_sort_size)
+        {
+            return{};
+        }
+
+        // keys, indexes and boxes of the candidates, the bitmasks and the histogram
+        const size_t local_mem_size = sort_size * (2 * sizeof(uint32_t) + PRIOR_BOX_SIZE * sizeof(float)) +
+                                      sort_size / 32 * 2 * sizeof(uint32_t) + 256 * sizeof(uint32_t);
+        if (params.engineInfo.maxLocalMemSize != 0 && local_mem_size > params.engineInfo.maxLocalMemSize)
+        {
+            return{};
+        }
+        size_t work_group_size = max_work_group_size;
+        if (params.engineInfo.maxWorkGroupSize != 0)
+        {
+            work_group_size = std::min<size_t>(work_group_size, params.engineInfo.maxWorkGroupSize);
+        }
+
+        KernelData kd = KernelData::Default<detection_output_params>(params, 2);
+
+        auto cldnnJit = GetJitConstants(detectOutParams);
+        cldnnJit.AddConstants({
+            MakeJitConstant("WORK_GROUP_SIZE", work_group_size),
+            MakeJitConstant("SORT_SIZE", sort_size),
+        });
+
+        // a work group per class of an image
+        {
+            DispatchData runInfo = SetDefault(detectOutParams);
+            runInfo.gws0 = work_group_size;
+            runInfo.gws1 = dedicated.num_classes;
+            runInfo.gws2 = num_images;
+            runInfo.lws0 = work_group_size;
+            runInfo.lws1 = 1;
+            runInfo.lws2 = 1;
+
+            auto jitConstants = cldnnJit;
+            jitConstants.AddConstant(MakeJitConstant("DETECTION_OUTPUT_COUNT", 0));
+            auto entryPoint = GetEntryPoint(kernelName, detectOutParams.layerID, options);
+            auto jit = CreateJit(kernelName, jitConstants, entryPoint);
+
+            auto& kernel = kd.kernels[0];
+            FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entryPoint);
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 1 });
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 2 });
+        }
+
+        // the number of the kept boxes of every image, after all the classes are written
+        {
+            DispatchData runInfo = SetDefault(detectOutParams);
+            runInfo.gws0 = num_images;
+            runInfo.gws1 = 1;
+            runInfo.gws2 = 1;
+            runInfo.lws0 = 1;
+            runInfo.lws1 = 1;
+            runInfo.lws2 = 1;
+
+            auto jitConstants = cldnnJit;
+            jitConstants.AddConstant(MakeJitConstant("DETECTION_OUTPUT_COUNT", 1));
+            auto entryPoint = GetEntryPoint(kernelName, detectOutParams.layerID, options);
+            auto jit = CreateJit(kernelName, jitConstants, entryPoint);
+
+            auto& kernel = kd.kernels[1];
+            FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entryPoint);
+            kernel.arguments = { { ArgumentDescriptor::Types::OUTPUT, 0 } };
+        }
+
+        kd.estimatedTime = FORCE_PRIORITY_7;
+
+        return{ kd };
+    }
+}
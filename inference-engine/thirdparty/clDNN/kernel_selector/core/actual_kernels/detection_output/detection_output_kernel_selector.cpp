@@ -17,12 +17,14 @@
 #include "detection_output_kernel_selector.h"
 #include "detection_output_kernel_ref.h"
 #include "detection_output_kernel_sort.h"
+#include "detection_output_kernel_nms.h"
  
 namespace kernel_selector
 {
     detection_output_kernel_selector::detection_output_kernel_selector()
     {
         Attach<DetectionOutputKernel>();
+        Attach<DetectionOutputKernel_nms>();
     }
 
     KernelsData detection_output_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
@@ -106,7 +106,8 @@ namespace kernel_selector
             newParams,
             options,
             wl,
-            kd.weightsReorderParams);
+            kd.weightsReorderParams,
+            GetSupportedKey());
 
         if (!succeed)
         {
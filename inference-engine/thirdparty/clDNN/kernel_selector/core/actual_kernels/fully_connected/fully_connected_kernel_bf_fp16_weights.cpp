@@ -0,0 +1,101 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "fully_connected_kernel_bf_fp16_weights.h"
+
+namespace kernel_selector {
+
+    static const size_t LOCAL_WORK_GROUP_SIZE = 64;
+
+    ParamsKey FullyConnected_bf_fp16_weights::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableDifferentInputWeightsTypes();
+        k.EnableInputLayout(DataLayout::bf);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bf);
+        k.EnableBiasPerOutput();
+        k.EnableBiasPerFeature();
+        k.EnableNonBiasTerm();
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    bool FullyConnected_bf_fp16_weights::Validate(const Params& params, const optional_params& options) const
+    {
+        if (!Parent::Validate(params, options))
+        {
+            return false;
+        }
+
+        const auto& fcParams = static_cast<const fully_connected_params&>(params);
+        const auto& input = fcParams.inputs[0];
+
+        // the kernel reads the weights as half
+        if (!params.engineInfo.bFP16Support)
+        {
+            return false;
+        }
+
+        // the row of the input is read as one contiguous vector
+        if (input.GetLayout() == DataLayout::bf && input.PitchesDifferFromLogicalDims())
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    FullyConnected_bf_fp16_weights::DispatchData FullyConnected_bf_fp16_weights::SetDefault(const fully_connected_params& params, int autoTuneIndex) const
+    {
+        auto runInfo = Parent::SetDefault(params, autoTuneIndex);
+
+        // the work group splits the dot product of one output and reduces it in the local memory
+        runInfo.gws0 = LOCAL_WORK_GROUP_SIZE;
+        runInfo.gws1 = params.output.Feature().v;
+        runInfo.gws2 = params.output.Batch().v;
+
+        runInfo.lws0 = LOCAL_WORK_GROUP_SIZE;
+        runInfo.lws1 = 1;
+        runInfo.lws2 = 1;
+
+        runInfo.effiency = FORCE_PRIORITY_1;
+
+        return runInfo;
+    }
+
+    JitConstants FullyConnected_bf_fp16_weights::GetJitConstants(const fully_connected_params& params, const DispatchData& kd) const
+    {
+        auto jit = Parent::GetJitConstants(params, kd);
+
+        jit.AddConstants({
+            MakeJitConstant("LOCAL_WORK_GROUP_SIZE", LOCAL_WORK_GROUP_SIZE),
+            MakeJitConstant("VEC_SIZE", 8),
+        });
+
+        return jit;
+    }
+
+    KernelsData FullyConnected_bf_fp16_weights::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options, DataLayout::bf, { WeightsLayout::oiyx }, FORCE_PRIORITY_1);
+    }
+}
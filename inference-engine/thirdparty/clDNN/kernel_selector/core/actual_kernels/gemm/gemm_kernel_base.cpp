@@ -36,9 +36,27 @@ namespace kernel_selector
             MakeJitConstant("TRANSPOSE_INPUT2", params.transpose_input2),
             });
 
+        // the product of the matrices of a batch: M x K by K x N, the inputs with a single batch are broadcast
+        const size_t m = params.transpose_input1 ? params.inputs[0].X().v : params.inputs[0].Y().v;
+        const size_t k = params.transpose_input1 ? params.inputs[0].Y().v : params.inputs[0].X().v;
+        const size_t n = params.transpose_input2 ? params.inputs[1].Y().v : params.inputs[1].X().v;
+        const size_t batch = params.output.Batch().v;
+        auto batch_stride = [batch](const DataTensor& input, size_t size) {
+            return input.Batch().v == 1 && batch > 1 ? 0 : size;
+        };
+        jit.AddConstants({
+            MakeJitConstant("GEMM_M", m),
+            MakeJitConstant("GEMM_K", k),
+            MakeJitConstant("GEMM_N", n),
+            MakeJitConstant("INPUT0_BATCH_STRIDE", batch_stride(params.inputs[0], m * k)),
+            MakeJitConstant("INPUT1_BATCH_STRIDE", batch_stride(params.inputs[1], k * n)),
+            MakeJitConstant("OUTPUT_BATCH_STRIDE", m * n),
+            });
+
         if (params.inputs.size() > 2)
         {
             jit.AddConstants({MakeJitConstant("OUT_BIAS_TERM", true),});
+            jit.AddConstants({MakeJitConstant("INPUT2_BATCH_STRIDE", batch_stride(params.inputs[2], m * n)),});
         }
         else
             jit.AddConstants({ MakeJitConstant("OUT_BIAS_TERM", false)});
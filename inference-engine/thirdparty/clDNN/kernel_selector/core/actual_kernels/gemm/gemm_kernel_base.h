@@ -62,8 +62,8 @@ namespace kernel_selector
         using DispatchData = CommonDispatchData;
 
     protected:
-        JitConstants GetJitConstants(const gemm_params& params) const;
-        DispatchData SetDefault(const gemm_params& params) const;
+        virtual JitConstants GetJitConstants(const gemm_params& params) const;
+        virtual DispatchData SetDefault(const gemm_params& params) const;
         KernelsData GetCommonKernelsData(const Params& params, const optional_params&, float estimated_time) const;
     };
 }
@@ -16,12 +16,14 @@
 
 #include "gemm_kernel_selector.h"
 #include "gemm_kernel_ref.h"
+#include "gemm_kernel_tiled_opt.h"
 
 namespace kernel_selector
 {
     gemm_kernel_selector::gemm_kernel_selector()
     {
         Attach<GemmKernelRef>();
+        Attach<GemmKernelTiledOpt>();
     }
 
     KernelsData gemm_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
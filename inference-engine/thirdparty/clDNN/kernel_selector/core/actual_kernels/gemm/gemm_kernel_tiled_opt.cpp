@@ -0,0 +1,108 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "gemm_kernel_tiled_opt.h"
+
+#include "kernel_selector_utils.h"
+
+
+namespace kernel_selector
+{
+    namespace
+    {
+        constexpr size_t sub_group_size = 16;
+
+        struct gemm_sizes
+        {
+            size_t m;
+            size_t n;
+        };
+
+        gemm_sizes get_sizes(const gemm_params& params)
+        {
+            return { params.transpose_input1 ? params.inputs[0].X().v : params.inputs[0].Y().v,
+                     params.transpose_input2 ? params.inputs[1].Y().v : params.inputs[1].X().v };
+        }
+
+        size_t get_tile_m(size_t m)
+        {
+            if (m >= 16)
+                return 8;
+            if (m >= 4)
+                return 4;
+            return 1;
+        }
+    }
+
+    ParamsKey GemmKernelTiledOpt::GetSupportedKey() const
+    {
+        ParamsKey k;
+
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+
+        k.EnableBatching();
+        k.EnableSubGroup();
+
+        return k;
+    }
+
+    JitConstants GemmKernelTiledOpt::GetJitConstants(const gemm_params& params) const
+    {
+        JitConstants jit = GemmKernelBase::GetJitConstants(params);
+
+        jit.AddConstants({
+            MakeJitConstant("SUB_GROUP_SIZE", sub_group_size),
+            MakeJitConstant("TILE_M", get_tile_m(get_sizes(params).m)),
+            });
+
+        return jit;
+    }
+
+    GemmKernelTiledOpt::DispatchData GemmKernelTiledOpt::SetDefault(const gemm_params& params) const
+    {
+        const auto sizes = get_sizes(params);
+
+        DispatchData kd;
+
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        // a sub group per SUB_GROUP_SIZE columns and TILE_M rows of the output
+        kd.gws0 = RoundUp(sizes.n, sub_group_size);
+        kd.gws1 = CeilDiv(sizes.m, get_tile_m(sizes.m));
+        kd.gws2 = params.output.Batch().v;
+
+        kd.lws0 = sub_group_size;
+        kd.lws1 = 1;
+        kd.lws2 = 1;
+
+        return kd;
+    }
+
+    KernelsData GemmKernelTiledOpt::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        const auto sizes = get_sizes(static_cast<const gemm_params&>(params));
+
+        // the narrow products leave the most of the lanes idle, the reference kernel is faster for them
+        const bool small = sizes.n < 8 || sizes.m * sizes.n < 256;
+
+        return GetCommonKernelsData(params, options, small ? DONT_USE_IF_HAVE_SOMETHING_ELSE : FORCE_PRIORITY_3);
+    }
+}
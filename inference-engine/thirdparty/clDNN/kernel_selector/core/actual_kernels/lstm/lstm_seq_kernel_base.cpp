@@ -0,0 +1,151 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "lstm_seq_kernel_base.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector
+{
+    static const size_t max_work_group_size = 256;
+
+    JitConstants LSTMSeqKernelBase::GetJitConstants(const lstm_seq_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+        const auto& input = params.inputs[0];
+        const size_t hidden_size = params.recurrent.X().v;
+
+        jit.AddConstants({
+            MakeJitConstant("WEIGHTS", params.weights),
+            MakeJitConstant("RECURRENT", params.recurrent),
+            MakeJitConstant("LSTM_SEQ_LEN", input.Feature().v),
+            MakeJitConstant("LSTM_INPUT_SIZE", input.X().v),
+            MakeJitConstant("LSTM_HIDDEN_SIZE", hidden_size),
+            MakeJitConstant("LSTM_GATES_SIZE", 4 * hidden_size),
+        });
+        if (params.hasBias) {
+            jit.AddConstants({ MakeJitConstant("BIAS", params.bias), MakeJitConstant("BIAS_TERM", true) });
+        }
+        if (params.hasHidden) {
+            jit.AddConstants({ MakeJitConstant("HIDDEN", params.hidden), MakeJitConstant("HIDDEN_TERM", true) });
+        }
+        if (params.hasCell) {
+            jit.AddConstants({ MakeJitConstant("CELL", params.cell), MakeJitConstant("CELL_TERM", true) });
+        }
+        if (params.clip > 0) {
+            std::string psclip = toCodeString(params.clip);
+            std::string nsclip = toCodeString(-params.clip);
+            jit.AddConstants({ MakeJitConstant("CLIP(x)", "((x > " + psclip + ") ? " +
+                psclip + ": (x < " + nsclip + ") ? " + nsclip + " : (x))") });
+        }
+        else {
+            jit.AddConstants({ MakeJitConstant("CLIP(x)", "(x)") });
+        }
+        if (params.input_forget) {
+            jit.AddConstants({ MakeJitConstant("INPUT_FORGET", true) });
+        }
+        if (params.emit_sequence) {
+            jit.AddConstants({ MakeJitConstant("EMIT_SEQUENCE", true) });
+        }
+        if (params.emit_last_cell) {
+            // the cell follows the hidden of all the steps or the last hidden
+            jit.AddConstants({
+                MakeJitConstant("EMIT_LAST_CELL", true),
+                MakeJitConstant("CELL_OUTPUT_FEATURE", params.emit_sequence ? input.Feature().v : 1),
+            });
+        }
+
+        jit.AddConstants({
+            MakeJitConstant("GEMM_OFFSET_I", params.GetOffsetIndexI() * hidden_size),
+            MakeJitConstant("GEMM_OFFSET_O", params.GetOffsetIndexO() * hidden_size),
+            MakeJitConstant("GEMM_OFFSET_F", params.GetOffsetIndexF() * hidden_size),
+            MakeJitConstant("GEMM_OFFSET_Z", params.GetOffsetIndexZ() * hidden_size),
+        });
+        return jit;
+    }
+
+    KernelsData LSTMSeqKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const lstm_seq_params& orgParams = static_cast<const lstm_seq_params&>(params);
+        const auto& input = orgParams.inputs[0];
+        const auto& out = orgParams.output;
+
+        // a single direction of the sequences concatenated along the feature
+        if (input.Y().v != 1 || orgParams.weights.Feature().v != 1 || orgParams.recurrent.Feature().v != 1)
+        {
+            return{};
+        }
+
+        const size_t hidden_size = orgParams.recurrent.X().v;
+        size_t work_group_size = std::min(hidden_size, max_work_group_size);
+        if (orgParams.engineInfo.maxWorkGroupSize != 0)
+        {
+            work_group_size = std::min<size_t>(work_group_size, orgParams.engineInfo.maxWorkGroupSize);
+        }
+
+        // the input of a step and the hidden of the previous and of the current step
+        const size_t state_mem_size = input.X().v * sizeof(float) + 2 * hidden_size * BytesPerElement(out.GetDType());
+        const size_t recurrent_mem_size = 4 * hidden_size * hidden_size * BytesPerElement(orgParams.recurrent.GetDType());
+        const size_t local_mem_size = orgParams.engineInfo.maxLocalMemSize;
+        if (local_mem_size != 0 && state_mem_size > local_mem_size)
+        {
+            return{};
+        }
+
+        KernelData kd = KernelData::Default<lstm_seq_params>(params, 1);
+
+        auto& kernel = kd.kernels[0];
+        auto cldnnJit = GetJitConstants(orgParams);
+        cldnnJit.AddConstants({
+            MakeJitConstant("LWS", work_group_size),
+            MakeJitConstant("UNITS_PER_WI", CeilDiv(hidden_size, work_group_size)),
+        });
+        // the recurrent weights are read by every step, they are kept in the local memory when they fit
+        if (local_mem_size != 0 && state_mem_size + recurrent_mem_size <= local_mem_size)
+        {
+            cldnnJit.AddConstant(MakeJitConstant("RECURRENT_IN_SLM", true));
+        }
+        auto entryPoint = GetEntryPoint(kernelName, orgParams.layerID, options);
+        auto jit = CreateJit(kernelName, cldnnJit, entryPoint);
+
+        // a work group per batch runs all the steps, the steps are synchronized by the barriers of the group
+        kernel.workGroups.global = { work_group_size, out.Batch().v, 1 };
+        kernel.workGroups.local = { work_group_size, 1, 1 };
+        kernel.kernelString = GetKernelString(kernelName, jit, entryPoint, params.engineInfo);
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 0 });
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::OUTPUT, 0 });
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::WEIGHTS, 0 });
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::RECURRENT, 0 });
+        if (orgParams.hasBias) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::BIAS, 0 });
+        }
+        if (orgParams.hasHidden) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::HIDDEN, 0 });
+        }
+        if (orgParams.hasCell) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::CELL, 0 });
+        }
+
+        kd.estimatedTime = FORCE_PRIORITY_1;
+
+        return{ kd };
+    }
+}
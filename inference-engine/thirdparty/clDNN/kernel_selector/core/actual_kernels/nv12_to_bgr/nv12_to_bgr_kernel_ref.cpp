@@ -0,0 +1,92 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "nv12_to_bgr_kernel_ref.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    ParamsKey NV12ToBGRKernelRef::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::UINT8);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        k.EnableDifferentTypes();
+        return k;
+    }
+
+    CommonDispatchData NV12ToBGRKernelRef::SetDefault(const nv12_to_bgr_params& params, const optional_params&) const
+    {
+        CommonDispatchData runInfo;
+
+        std::vector<size_t> global = { params.output.X().v, params.output.Y().v, params.output.Batch().v };
+
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        runInfo.gws0 = global[0];
+        runInfo.gws1 = global[1];
+        runInfo.gws2 = global[2];
+
+        runInfo.lws0 = local[0];
+        runInfo.lws1 = local[1];
+        runInfo.lws2 = local[2];
+
+        return runInfo;
+    }
+
+    JitConstants NV12ToBGRKernelRef::GetJitConstants(const nv12_to_bgr_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+
+        // the Y plane takes 2/3 of the input rows and the UV plane of the half resolution the rest
+        const size_t frame_height = params.inputs[0].Y().v * 2 / 3;
+        const size_t frame_width = params.inputs[0].X().v;
+
+        jit.AddConstant(MakeJitConstant("FRAME_HEIGHT", frame_height));
+        jit.AddConstant(MakeJitConstant("FRAME_WIDTH", frame_width));
+        jit.AddConstant(MakeJitConstant("SCALE_X", static_cast<float>(frame_width) / params.output.X().v));
+        jit.AddConstant(MakeJitConstant("SCALE_Y", static_cast<float>(frame_height) / params.output.Y().v));
+
+        return jit;
+    }
+
+    KernelsData NV12ToBGRKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        KernelData kd = KernelData::Default<nv12_to_bgr_params>(params);
+        nv12_to_bgr_params& newParams = *static_cast<nv12_to_bgr_params*>(kd.params.get());
+
+        assert(params.GetType() == KernelType::NV12_TO_BGR);
+
+        auto runInfo = SetDefault(newParams, options);
+        auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
+        auto cldnn_jit = GetJitConstants(newParams);
+        std::string jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+        auto& kernel = kd.kernels[0];
+
+        FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entry_point);
+
+        kd.estimatedTime = DONT_USE_IF_HAVE_SOMETHING_ELSE;
+
+        return{ kd };
+    }
+}
@@ -0,0 +1,54 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "common_kernel_base.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // nv12_to_bgr_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct nv12_to_bgr_params : public base_params
+    {
+        nv12_to_bgr_params() : base_params(KernelType::NV12_TO_BGR) {}
+
+        virtual ParamsKey GetParamsKey() const
+        {
+            return base_params::GetParamsKey();
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // nv12_to_bgr_optional_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct nv12_to_bgr_optional_params : optional_params
+    {
+        nv12_to_bgr_optional_params() : optional_params(KernelType::NV12_TO_BGR) {}
+    };
+
+    class NV12ToBGRKernelRef : public common_kernel_base
+    {
+    public:
+        NV12ToBGRKernelRef() : common_kernel_base("nv12_to_bgr_ref") {}
+        virtual ~NV12ToBGRKernelRef() {}
+        virtual JitConstants GetJitConstants(const nv12_to_bgr_params& params) const;
+        virtual CommonDispatchData SetDefault(const nv12_to_bgr_params& params, const optional_params&) const;
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+    };
+}
@@ -16,12 +16,14 @@
 
 #include "permute_kernel_selector.h"
 #include "permute_kernel_ref.h"
+#include "permute_kernel_tiled.h"
  
 namespace kernel_selector {
 
     permute_kernel_selector::permute_kernel_selector()
     {
         Attach<PermuteKernelRef>();
+        Attach<PermuteKernelTiled>();
     }
 
     KernelsData permute_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
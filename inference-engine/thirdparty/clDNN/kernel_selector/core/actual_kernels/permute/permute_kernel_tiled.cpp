@@ -0,0 +1,114 @@
+﻿/*
+// Copyright (c) 2016-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "permute_kernel_tiled.h"
+#include "kernel_selector_utils.h" 
+ 
+namespace kernel_selector 
+{
+    namespace
+    {
+        constexpr size_t tile_size = 16;
+    }
+
+    ParamsKey PermuteKernelTiled::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableInputDataType(Datatype::INT8);
+        k.EnableInputDataType(Datatype::INT32);
+        k.EnableInputDataType(Datatype::INT64);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::INT8);
+        k.EnableOutputDataType(Datatype::INT32);
+        k.EnableOutputDataType(Datatype::INT64);
+        // x is the innermost dimension of both tensors
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    KernelsData PermuteKernelTiled::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        assert(params.GetType() == KernelType::PERMUTE);
+
+        KernelData kd = KernelData::Default<permute_params>(params);
+        permute_params& newParams = *static_cast<permute_params*>(kd.params.get());
+
+        if (newParams.order.size() != 4)
+        {
+            return{};
+        }
+
+        const auto& in = newParams.inputs[0];
+        // the sizes in the [b, f, x, y] order of the permute order
+        const size_t sizes[4] = { in.Batch().v, in.Feature().v, in.X().v, in.Y().v };
+
+        // the input dimension which becomes the x of the output
+        const size_t tile_dim = newParams.order[2];
+        std::vector<size_t> other_dims;
+        for (size_t dim : { 0, 1, 3 })
+        {
+            if (dim != tile_dim)
+                other_dims.push_back(dim);
+        }
+        if (tile_dim == 2)
+        {
+            other_dims.resize(2);
+        }
+        else if (params.engineInfo.maxWorkGroupSize < tile_size * tile_size)
+        {
+            return{};
+        }
+
+        auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
+        JitConstants cldnn_jit = MakeBaseParamsJitConstants(newParams);
+        cldnn_jit.AddConstants({
+            MakeJitConstant("PERMUTE_ORDER", newParams.order),
+            MakeJitConstant("TILE_SIZE", tile_size),
+            MakeJitConstant("TILE_DIM", tile_dim),
+            MakeJitConstant("TILE_DIM_SIZE", sizes[tile_dim]),
+            MakeJitConstant("OTHER_DIM0", other_dims[0]),
+            MakeJitConstant("OTHER_DIM1", other_dims[1]),
+            MakeJitConstant("OTHER_DIM1_SIZE", sizes[other_dims[1]]),
+        });
+        std::string jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+        auto& kernel = kd.kernels[0];
+        if (tile_dim == 2)
+        {
+            kernel.workGroups.global = { in.X().v, in.Y().v, sizes[other_dims[0]] * sizes[other_dims[1]] };
+            kernel.workGroups.local = GetOptimalLocalWorkGroupSizes(kernel.workGroups.global);
+        }
+        else
+        {
+            kernel.workGroups.global = { RoundUp(in.X().v, tile_size), RoundUp(sizes[tile_dim], tile_size),
+                                         sizes[other_dims[0]] * sizes[other_dims[1]] };
+            kernel.workGroups.local = { tile_size, tile_size, 1 };
+        }
+        kernel.kernelString = GetKernelString(kernelName, jit, entry_point, params.engineInfo, DEFAULT);
+        kernel.arguments = GetArgsDesc(1, false, false);
+
+        kd.estimatedTime = FORCE_PRIORITY_7;
+
+        return{ kd };
+    }
+}
@@ -18,6 +18,7 @@
 #include "reorder_weights_kernel.h"
 #include "reorder_weights_winograd_2x3_kernel.h"
 #include "reorder_weights_winograd_6x3_kernel.h"
+#include "reorder_weights_winograd_4x4_3x3_kernel.h"
 #include "reorder_weights_image_fyx_b_kernel.h"
 #include "reorder_weights_image_winograd_6x3_kernel.h"
  
@@ -28,6 +29,7 @@ namespace kernel_selector {
         Attach<ReorderWeightsKernel>();
         Attach<ReorderWeightsWinograd2x3Kernel>();
         Attach<ReorderWeightsWinograd6x3Kernel>();
+        Attach<ReorderWeightsWinograd4x4_3x3Kernel>();
         Attach<ReorderWeightsImage_fyx_b_Kernel>();
         Attach<ReorderWeightsImageWinograd6x3Kernel>();
     }
@@ -0,0 +1,67 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "reorder_weights_winograd_4x4_3x3_kernel.h"
+#include "kernel_selector_utils.h"
+ 
+namespace kernel_selector 
+{
+    ParamsKey ReorderWeightsWinograd4x4_3x3Kernel::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableInputWeightsType(WeightsType::F32);
+        k.EnableOutputWeightsType(WeightsType::F16);
+        k.EnableOutputWeightsType(WeightsType::F32);
+        k.EnableInputWeightsLayout(WeightsLayout::oiyx);
+        k.EnableInputWeightsLayout(WeightsLayout::oyxi);
+        k.EnableInputWeightsLayout(WeightsLayout::iyxo);
+        k.EnableInputWeightsLayout(WeightsLayout::yxio);
+        k.EnableOutputWeightsLayout(WeightsLayout::winograd_4x4_3x3_s1_weights);
+        k.EnableWinogradReorder();
+        k.EnableDifferentTypes();
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        return k;
+    }
+
+    ReorderWeightsWinograd4x4_3x3Kernel::DispatchData ReorderWeightsWinograd4x4_3x3Kernel::SetDefault(const reorder_weights_params& params) const
+    {
+        DispatchData kd;
+
+        const auto& input = params.input;
+
+        // a work item transforms the 3x3 filter of an (ofm, ifm) pair
+        std::vector<size_t> global = { input.IFM().v, input.OFM().v, 1 };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        kd.gws0 = global[0];
+        kd.gws1 = global[1];
+        kd.gws2 = global[2];
+
+        kd.lws0 = local[0];
+        kd.lws1 = local[1];
+        kd.lws2 = local[2];
+
+        return kd;
+    }
+
+    KernelsData ReorderWeightsWinograd4x4_3x3Kernel::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        const reorder_weights_params& orgParams = static_cast<const reorder_weights_params&>(params);
+        return GetCommonKernelsData(orgParams, options, FORCE_PRIORITY_4);
+    }
+}
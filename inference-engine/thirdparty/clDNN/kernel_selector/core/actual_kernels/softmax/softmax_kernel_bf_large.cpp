@@ -0,0 +1,84 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "softmax_kernel_bf_large.h"
+
+namespace kernel_selector
+{
+    // data sets starting from this size do not fit the private memory of softmax_gpu_bf without spilling
+    static const size_t large_data_set_size = 4096;
+    static const size_t sub_group_size = 16;
+    static const size_t max_lws = 256;
+
+    ParamsKey SoftmaxKernel_bf_large::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableInputLayout(DataLayout::bf);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bf);
+        k.EnableSoftmaxDim(SoftmaxDim::X);         // in case that it can be flatten
+        k.EnableSoftmaxDim(SoftmaxDim::Y);
+        k.EnableSoftmaxDim(SoftmaxDim::FEATURE);
+        k.EnableBatching();
+        k.EnableSubGroup();
+        return k;
+    }
+
+    bool SoftmaxKernel_bf_large::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!Parent::Validate(p, o))
+        {
+            return false;
+        }
+
+        const softmax_params& params = static_cast<const softmax_params&>(p);
+
+        return params.engineInfo.maxWorkGroupSize >= sub_group_size &&
+               params.inputs[0].FlattenFeatureAndSpatials().Feature().v >= large_data_set_size;
+    }
+
+    SoftmaxKernel_bf_large::Parent::DispatchData SoftmaxKernel_bf_large::SetDefault(const softmax_params& params, const optional_params& optParams) const
+    {
+        auto kd = Parent::SetDefault(params, optParams);
+
+        // one work group per data set, the widest power of two that the device allows
+        kd.lws0 = sub_group_size;
+        while (2 * kd.lws0 <= std::min(params.engineInfo.maxWorkGroupSize, max_lws))
+        {
+            kd.lws0 *= 2;
+        }
+
+        kd.gws0 = kd.lws0;
+        kd.gws1 = kd.dataSetsCount;
+        kd.itemsNum = CeilDiv(kd.dataSetSize, kd.lws0);
+        kd.leftovers = 0;
+
+        kd.normIndex = 0;
+
+        kd.effiency = FORCE_PRIORITY_5;
+        return kd;
+    }
+
+    KernelsData SoftmaxKernel_bf_large::GetKernelsData(const Params& params, const optional_params& optionalParams) const
+    {
+        return GetCommonKernelsData(params, optionalParams);
+    }
+}
@@ -17,6 +17,7 @@
 #include "softmax_kernel_selector.h"
 #include "softmax_kernel_ref.h"
 #include "softmax_kernel_bf.h"
+#include "softmax_kernel_bf_large.h"
 #include "softmax_kernel_fb.h"
 #include "softmax_kernel_items_class_optimized.h"
 
@@ -26,6 +27,7 @@ namespace kernel_selector {
     {
         Attach<SoftmaxKernelRef>();
         Attach<SoftmaxKernel_bf>();
+        Attach<SoftmaxKernel_bf_large>();
         Attach<SoftmaxKernel_fb>();
         Attach<SoftmaxKerneItemsClassOptimized>();
     }
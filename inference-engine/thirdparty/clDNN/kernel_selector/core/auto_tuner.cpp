@@ -26,34 +26,92 @@
 
 namespace kernel_selector
 {
-    std::tuple<std::string, int> AutoTuner::LoadKernelOnline(const TuningMode tuningMode, const std::string& cacheFilePath, const uint32_t computeUnitsCount,  const std::string& hash)
+    namespace
     {
-        std::lock_guard<std::mutex> lock(mutex);
-        rapidjson::Document cacheData;
-        std::ifstream tuningFile(cacheFilePath);
-        if (tuningFile && tuningFile.good())
+        bool ReadCacheFile(const std::string& cacheFilePath, rapidjson::Document& cacheData)
         {
+            std::ifstream tuningFile(cacheFilePath);
+            if (!tuningFile || !tuningFile.good())
+            {
+                return false;
+            }
             rapidjson::IStreamWrapper isw{ tuningFile };
             cacheData.ParseStream(isw);
+            if (cacheData.HasParseError())
+            {
+                cacheData.SetNull();
+            }
+            return true;
+        }
+
+        // Adds the entries of the source cache the target cache doesn't have yet. The caches of the different
+        // devices (compute units counts) and models are disjoint, so the tuning files can be merged in any order.
+        void MergeCache(rapidjson::Document& target, const rapidjson::Document& source)
+        {
+            if (!source.IsObject())
+            {
+                return;
+            }
+            auto& allocator = target.GetAllocator();
+            if (!target.IsObject())
+            {
+                target.SetObject();
+            }
+            for (auto device = source.MemberBegin(); device != source.MemberEnd(); ++device)
+            {
+                if (!device->value.IsObject())
+                {
+                    continue;
+                }
+                if (!target.HasMember(device->name))
+                {
+                    target.AddMember(rapidjson::Value(device->name, allocator), rapidjson::Value(rapidjson::kObjectType), allocator);
+                }
+                auto& targetDevice = target[device->name];
+                for (auto entry = device->value.MemberBegin(); entry != device->value.MemberEnd(); ++entry)
+                {
+                    if (!targetDevice.HasMember(entry->name))
+                    {
+                        targetDevice.AddMember(rapidjson::Value(entry->name, allocator), rapidjson::Value(entry->value, allocator), allocator);
+                    }
+                }
+            }
         }
-        else // Tuning file doesn't exist
+    }
+
+    std::shared_ptr<rapidjson::Document> AutoTuner::GetOnlineCache(const TuningMode tuningMode, const std::string& cacheFilePath)
+    {
+        auto& onlineCache = onlineCaches[cacheFilePath];
+        if (onlineCache)
+        {
+            return onlineCache;
+        }
+
+        rapidjson::Document cacheData;
+        if (!ReadCacheFile(cacheFilePath, cacheData)) // Tuning file doesn't exist
         {
             if (tuningMode == TuningMode::TUNING_USE_CACHE)
             {
+                onlineCaches.erase(cacheFilePath);
                 throw std::runtime_error("Tuning file: " + cacheFilePath + " could not be read! Must provide a valid cache file in USE_CACHE mode.");
             }
 
             // Create a new tuning file and write the versions
             std::ofstream newTuningFile(cacheFilePath, std::ofstream::out);
-
         }
-        tuningFile.close();
 
         onlineCache = std::make_shared<rapidjson::Document>(std::move(cacheData));
+        return onlineCache;
+    }
+
+    std::tuple<std::string, int> AutoTuner::LoadKernelOnline(const TuningMode tuningMode, const std::string& cacheFilePath, const uint32_t computeUnitsCount,  const std::string& hash)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto onlineCache = GetOnlineCache(tuningMode, cacheFilePath);
 
         // Tuning file is loaded
         auto computeUnitsStr = std::to_string(computeUnitsCount);
-        if (!onlineCache->IsNull())
+        if (onlineCache->IsObject())
         {
             auto cacheObject = onlineCache->GetObject();
             if (onlineCache->HasMember(computeUnitsStr.c_str()))
@@ -73,6 +131,7 @@ namespace kernel_selector
     {
         std::lock_guard<std::mutex> lock(mutex);
         auto computeUnitsStr = std::to_string(computeUnitsCount);
+        auto onlineCache = GetOnlineCache(TuningMode::TUNING_TUNE_AND_CACHE, cacheFilePath);
         rapidjson::Document::AllocatorType& allocator = onlineCache->GetAllocator();
         rapidjson::Value dataArray(rapidjson::kArrayType);
         rapidjson::Value hashStr(rapidjson::kStringType);
@@ -80,9 +139,17 @@ namespace kernel_selector
         dataArray.PushBack(rapidjson::Value().Set(implementationName.c_str(),allocator) , allocator);
         dataArray.PushBack(rapidjson::Value().SetInt(tuneIndex), allocator);
 
+        // Keep the kernels other processes tuning into the same file stored since it was read,
+        // so the models can be tuned in parallel into one tuning file.
+        rapidjson::Document fileData;
+        if (ReadCacheFile(cacheFilePath, fileData))
+        {
+            MergeCache(*onlineCache, fileData);
+        }
+
         rapidjson::Value newVal(rapidjson::kObjectType);
         newVal.SetObject();
-        if (onlineCache->IsNull())
+        if (!onlineCache->IsObject())
         {
             onlineCache->Parse("{}");
         }
@@ -92,7 +159,15 @@ namespace kernel_selector
         }
 
         auto cache = onlineCache->GetObject();
-        cache[computeUnitsStr.c_str()].AddMember(hashStr, dataArray, allocator);
+        auto& deviceCache = cache[computeUnitsStr.c_str()];
+        if (deviceCache.HasMember(hashStr))
+        {
+            deviceCache[hashStr] = dataArray;
+        }
+        else
+        {
+            deviceCache.AddMember(hashStr, dataArray, allocator);
+        }
 
         std::ofstream cachedKernelsFile(cacheFilePath);
         rapidjson::StringBuffer buffer(0, 1024);
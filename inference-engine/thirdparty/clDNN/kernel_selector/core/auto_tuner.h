@@ -35,7 +35,11 @@ namespace kernel_selector
         std::tuple<std::string, int> LoadKernelOffline(std::shared_ptr<rapidjson::Document> cache, const std::string& hash);
 
     private:    
-        std::shared_ptr<rapidjson::Document> onlineCache; // Tuning file name -> kernel/config per hash (hash -> [implementation name, tuning index])
+        std::shared_ptr<rapidjson::Document> GetOnlineCache(const TuningMode tuningMode, const std::string& tuningFilePath);
+
+        // Tuning file name -> kernel/config per hash (hash -> [implementation name, tuning index]).
+        // Every file is parsed once, so the kernels of the networks using the tuning data are selected without reading it again.
+        std::map<std::string, std::shared_ptr<rapidjson::Document>> onlineCaches;
         std::mutex mutex; // Mutex to synchronize cache updates
         
         /*
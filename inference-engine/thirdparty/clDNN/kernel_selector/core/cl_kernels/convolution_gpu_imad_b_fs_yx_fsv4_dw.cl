@@ -0,0 +1,141 @@
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+#include "include/fetch.cl"
+#include "include/imad.cl"
+
+#define INPUT_PACKED_TYPE CAT(INPUT0_TYPE, 4)
+#define AS_INPUT_PACKED_TYPE CAT(as_, INPUT_PACKED_TYPE)
+#define OUTPUT_PACKED_TYPE CAT(OUTPUT_TYPE, 4)
+#define TO_OUTPUT_TYPE_SAT(v) CAT(CAT(convert_, OUTPUT_TYPE), _sat)(v)
+
+// The 4 features of a slice are packed in an int of b_fs_yx_fsv4. A feature depends only on itself, so the taps
+// of a filter row are taken 4 at a time for one feature and accumulated with one IMAD.
+KERNEL(convolution_gpu_imad_b_fs_yx_fsv4_dw)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    const __global FILTER_TYPE* weights,
+#if BIAS_TERM
+    const __global BIAS_TYPE* biases,
+#endif
+#if QUANTIZATION_TERM
+    const __global float* quantizations,
+#endif
+#if CALIBRATION_TERM
+    const __global float* calibrations,
+#endif
+    uint split_idx)
+{
+    const uint x0 = (uint)get_global_id(0) * OUT_BLOCK_WIDTH;
+    const uint y  = (uint)get_global_id(1);
+    const uint f0 = ((uint)get_global_id(2) % FEATURE_SLICES) * 4;
+    const uint b  = (uint)get_global_id(2) / FEATURE_SLICES;
+
+    const int input_x = (int)x0 * STRIDE_SIZE_X - PADDING_SIZE_X;
+    const int input_y = (int)y * STRIDE_SIZE_Y - PADDING_SIZE_Y;
+
+    int acc[OUT_BLOCK_WIDTH][4];
+    for (uint ob = 0; ob < OUT_BLOCK_WIDTH; ob++)
+    {
+        for (uint c = 0; c < 4; c++)
+            acc[ob][c] = 0;
+    }
+
+    for (uint j = 0; j < FILTER_SIZE_Y; j++)
+    {
+        const int input_offset_y = input_y + (int)(j * DILATION_SIZE_Y);
+        if (input_offset_y < 0 || input_offset_y >= INPUT0_SIZE_Y)
+            continue;
+
+        // the input row of the block, zero outside of the input
+        int row[IN_BLOCK_WIDTH];
+        const uint row_idx = GET_DATA_B_FS_YX_FSV4_INDEX(INPUT0, b, f0, input_offset_y, 0);
+        for (uint i = 0; i < IN_BLOCK_WIDTH; i++)
+        {
+            const int input_offset_x = input_x + (int)i;
+            const bool zero_x = input_offset_x < 0 || input_offset_x >= INPUT0_SIZE_X;
+            row[i] = zero_x ? 0 : *((const __global int*)(input + row_idx + input_offset_x * 4));
+        }
+
+        for (uint q = 0; q < FILTER_CHUNKS_X; q++)
+        {
+            // 4 taps of the row for each feature, zero past the filter width and the features
+            char4 w[4];
+            for (uint c = 0; c < 4; c++)
+            {
+                for (uint t = 0; t < 4; t++)
+                {
+                    const uint i = q * 4 + t;
+                    const bool zero = i >= FILTER_SIZE_X || f0 + c >= OUTPUT_FEATURE_NUM;
+                    w[c][t] = zero ? 0 : weights[(f0 + c) * FILTER_OFM_PITCH + j * FILTER_Y_PITCH + i * FILTER_X_PITCH];
+                }
+            }
+
+            for (uint ob = 0; ob < OUT_BLOCK_WIDTH; ob++)
+            {
+                for (uint c = 0; c < 4; c++)
+                {
+                    INPUT_PACKED_TYPE in;
+                    for (uint t = 0; t < 4; t++)
+                        in[t] = AS_INPUT_PACKED_TYPE(row[ob * STRIDE_SIZE_X + (q * 4 + t) * DILATION_SIZE_X])[c];
+                    acc[ob][c] = IMAD(acc[ob][c], in, w[c]);
+                }
+            }
+        }
+    }
+
+    for (uint ob = 0; ob < OUT_BLOCK_WIDTH; ob++)
+    {
+        const uint x = x0 + ob;
+        if (x >= OUTPUT_SIZE_X)
+            break;
+
+        OUTPUT_PACKED_TYPE res;
+        for (uint c = 0; c < 4; c++)
+        {
+            const uint f = f0 + c;
+            if (f >= OUTPUT_FEATURE_NUM)
+            {
+                res[c] = 0;
+                continue;
+            }
+
+            int dotProd = acc[ob][c];
+#if QUANTIZATION_TERM
+            float val = (float)dotProd * quantizations[f] * I_QF;
+#if BIAS_TERM
+            val += biases[f];
+#endif
+#if CALIBRATION_TERM
+            val *= calibrations[f];
+#else
+            val *= O_QF;
+#endif
+            dotProd = convert_int_sat_rte(val);
+#elif BIAS_TERM
+            dotProd += (int)biases[f];
+#endif
+            res[c] = ACTIVATION(TO_OUTPUT_TYPE_SAT(dotProd), NL_M, NL_N);
+        }
+
+        *((__global int*)(output + GET_DATA_B_FS_YX_FSV4_INDEX(OUTPUT, b, f0, y, x))) = as_int(res);
+    }
+}
+
+#undef INPUT_PACKED_TYPE
+#undef AS_INPUT_PACKED_TYPE
+#undef OUTPUT_PACKED_TYPE
+#undef TO_OUTPUT_TYPE_SAT
@@ -0,0 +1,139 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+// Winograd F(4x4, 3x3): every work item transforms a 6x6 input tile V = BT * d * B per input feature, accumulates
+// M = sum(U * V) with the transformed filters U of OFM_PER_WORK_ITEM output features and writes Y = AT * M * A.
+KERNEL(convolution_gpu_winograd_4x4_3x3_s1)(
+    __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    __global FILTER_TYPE* weights,
+#if BIAS_TERM
+    __global BIAS_TYPE* biases,
+#endif
+    uint split_idx)
+{
+    const uint tile_x = get_global_id(0);
+    const uint tile_y = get_global_id(1);
+    const uint f0 = (get_global_id(2) % OFM_BLOCKS) * OFM_PER_WORK_ITEM;
+    const uint b = get_global_id(2) / OFM_BLOCKS;
+
+    const int x0 = (int)tile_x * 4 - PADDING_SIZE_X;
+    const int y0 = (int)tile_y * 4 - PADDING_SIZE_Y;
+
+    float m[OFM_PER_WORK_ITEM][36];
+    for (uint o = 0; o < OFM_PER_WORK_ITEM; o++)
+    {
+        for (uint n = 0; n < 36; n++)
+        {
+            m[o][n] = 0.f;
+        }
+    }
+
+    for (uint k = 0; k < FILTER_IFM_NUM; k++)
+    {
+        float d[6][6];
+        for (uint j = 0; j < 6; j++)
+        {
+            const int y = y0 + (int)j;
+            for (uint i = 0; i < 6; i++)
+            {
+                const int x = x0 + (int)i;
+                const bool inside = x >= 0 && x < INPUT0_SIZE_X && y >= 0 && y < INPUT0_SIZE_Y;
+                d[j][i] = inside ? (float)input[GET_DATA_INDEX(INPUT0, b, k, y, x)] : 0.f;
+            }
+        }
+
+        // t = BT * d
+        float t[6][6];
+        for (uint i = 0; i < 6; i++)
+        {
+            t[0][i] = 4.f * d[0][i] - 5.f * d[2][i] + d[4][i];
+            t[1][i] = -4.f * (d[1][i] + d[2][i]) + d[3][i] + d[4][i];
+            t[2][i] = 4.f * (d[1][i] - d[2][i]) - d[3][i] + d[4][i];
+            t[3][i] = 2.f * (d[3][i] - d[1][i]) - d[2][i] + d[4][i];
+            t[4][i] = 2.f * (d[1][i] - d[3][i]) - d[2][i] + d[4][i];
+            t[5][i] = 4.f * d[1][i] - 5.f * d[3][i] + d[5][i];
+        }
+
+        // v = t * B
+        float v[36];
+        for (uint j = 0; j < 6; j++)
+        {
+            v[j * 6 + 0] = 4.f * t[j][0] - 5.f * t[j][2] + t[j][4];
+            v[j * 6 + 1] = -4.f * (t[j][1] + t[j][2]) + t[j][3] + t[j][4];
+            v[j * 6 + 2] = 4.f * (t[j][1] - t[j][2]) - t[j][3] + t[j][4];
+            v[j * 6 + 3] = 2.f * (t[j][3] - t[j][1]) - t[j][2] + t[j][4];
+            v[j * 6 + 4] = 2.f * (t[j][1] - t[j][3]) - t[j][2] + t[j][4];
+            v[j * 6 + 5] = 4.f * t[j][1] - 5.f * t[j][3] + t[j][5];
+        }
+
+        for (uint o = 0; o < OFM_PER_WORK_ITEM; o++)
+        {
+            const uint filter_idx = (f0 + o) * FILTER_OFM_PITCH + k * FILTER_IFM_PITCH;
+            for (uint n = 0; n < 36; n++)
+            {
+                m[o][n] += v[n] * (float)weights[filter_idx + n];
+            }
+        }
+    }
+
+    for (uint o = 0; o < OFM_PER_WORK_ITEM; o++)
+    {
+        const uint f = f0 + o;
+
+        // s = AT * m
+        float s[4][6];
+        for (uint i = 0; i < 6; i++)
+        {
+            const float m1 = m[o][6 + i], m2 = m[o][12 + i], m3 = m[o][18 + i], m4 = m[o][24 + i];
+            s[0][i] = m[o][i] + m1 + m2 + m3 + m4;
+            s[1][i] = m1 - m2 + 2.f * (m3 - m4);
+            s[2][i] = m1 + m2 + 4.f * (m3 + m4);
+            s[3][i] = m1 - m2 + 8.f * (m3 - m4) + m[o][30 + i];
+        }
+
+        for (uint j = 0; j < 4; j++)
+        {
+            const uint y = tile_y * 4 + j;
+            if (y >= OUTPUT_SIZE_Y)
+                break;
+
+            // r = s * A
+            float r[4];
+            r[0] = s[j][0] + s[j][1] + s[j][2] + s[j][3] + s[j][4];
+            r[1] = s[j][1] - s[j][2] + 2.f * (s[j][3] - s[j][4]);
+            r[2] = s[j][1] + s[j][2] + 4.f * (s[j][3] + s[j][4]);
+            r[3] = s[j][1] - s[j][2] + 8.f * (s[j][3] - s[j][4]) + s[j][5];
+
+            for (uint i = 0; i < 4; i++)
+            {
+                const uint x = tile_x * 4 + i;
+                if (x >= OUTPUT_SIZE_X)
+                    break;
+
+                UNIT_TYPE dotProd = (UNIT_TYPE)r[i];
+#if BIAS_TERM
+#if BIAS_PER_OUTPUT
+                dotProd += (UNIT_TYPE)biases[GET_DATA_INDEX(BIAS, b, f, y, x)];
+#elif BIAS_PER_OFM
+                dotProd += (UNIT_TYPE)biases[f];
+#endif
+#endif
+                output[GET_DATA_INDEX(OUTPUT, b, f, y, x)] = ACTIVATION(dotProd, NL_M, NL_N);
+            }
+        }
+    }
+}
@@ -0,0 +1,350 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+#include "include/detection_output_common.cl"
+
+// The first part of the detection output as detection_output.cl, the kept boxes of every class are written to the
+// block of SCORES_COUNT rows of the class and the rest of the block is filled with the rows of -1 image id.
+//
+// A work group processes one class of one image: the TOP_K best candidates are selected by a radix select of the scores,
+// sorted in the local memory by a bitonic sort and suppressed in parallel, the kept ones are marked in a bitmask.
+// The second kernel (DETECTION_OUTPUT_COUNT) writes the number of the kept boxes of every image.
+
+#if DETECTION_OUTPUT_COUNT
+
+KERNEL (detection_output_nms)(__global UNIT_TYPE* output)
+{
+    const uint idx_image = get_global_id(0);
+
+    uint count = 0;
+    for (uint idx_class = 0; idx_class < NUM_CLASSES_OUT; idx_class++)
+    {
+        const uint output_offset = (idx_image * NUM_CLASSES_OUT + idx_class) * SCORES_COUNT;
+        for (uint i = 0; i < SCORES_COUNT; i++)
+        {
+            if (output[(output_offset + i) * OUTPUT_ROW_SIZE + OUTPUT_OFFSET] == -1)
+            {
+                break;
+            }
+            count++;
+        }
+    }
+    output[idx_image] = count;
+}
+
+#else
+
+#define WORDS_NUM (SORT_SIZE / 32)
+
+// The order of the keys is the order of the scores, 0 is below the key of any score
+inline uint FUNC(score_key)(float score)
+{
+    const uint bits = as_uint(score);
+    return (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+}
+
+inline float FUNC(get_confidence)(__global UNIT_TYPE* input_confidence, const uint idx_prior, const uint idx_class, const uint idx_image)
+{
+    const uint confidence_offset =
+            (idx_prior * NUM_CLASSES + idx_image * NUM_OF_PRIORS * NUM_CLASSES + idx_class) *
+            CONF_XY_SIZE_PRODUCT +
+            CONF_PADDING;
+
+    return input_confidence[confidence_offset];
+}
+
+// The higher scores first, the lower prior index first for the equal scores
+inline bool FUNC(is_before)(const uint key1, const uint index1, const uint key2, const uint index2)
+{
+    return key1 > key2 || (key1 == key2 && index1 < index2);
+}
+
+inline float FUNC(get_overlap)(const float4 bbox1, const float4 bbox2)
+{
+    const bool intersecting =
+        (bbox1.s0 < bbox2.s2) &
+        (bbox2.s0 < bbox1.s2) &
+        (bbox1.s1 < bbox2.s3) &
+        (bbox2.s1 < bbox1.s3);
+
+    if (!intersecting)
+    {
+        return 0;
+    }
+
+    const float intersect_width = min(bbox1.s2, bbox2.s2) - max(bbox1.s0, bbox2.s0);
+    const float intersect_height = min(bbox1.s3, bbox2.s3) - max(bbox1.s1, bbox2.s1);
+    const float intersect_size = intersect_width * intersect_height;
+    const float bbox1_area = (bbox1.s2 - bbox1.s0) * (bbox1.s3 - bbox1.s1);
+    const float bbox2_area = (bbox2.s2 - bbox2.s0) * (bbox2.s3 - bbox2.s1);
+    return intersect_size / (bbox1_area + bbox2_area - intersect_size);
+}
+
+inline void FUNC(write_empty_row)(__global UNIT_TYPE* output, const uint row)
+{
+    const uint out_idx = row * OUTPUT_ROW_SIZE + OUTPUT_OFFSET;
+    output[out_idx] = -1.0;
+    for (uint i = 1; i < OUTPUT_ROW_SIZE; i++)
+    {
+        output[out_idx + i] = 0.0;
+    }
+}
+
+__attribute__((reqd_work_group_size(WORK_GROUP_SIZE, 1, 1)))
+KERNEL (detection_output_nms)(__global UNIT_TYPE* input_location, __global UNIT_TYPE* output, __global UNIT_TYPE* input_confidence, __global UNIT_TYPE* input_prior_box)
+{
+    const uint lid = get_local_id(0);
+    const uint idx_class = get_group_id(1);
+    const uint idx_image = get_group_id(2);
+
+    if (HIDDEN_CLASS && idx_class == 0)
+    {
+        // the background class has no block in the output
+        return;
+    }
+
+    const uint output_offset = (idx_image * NUM_CLASSES_OUT + idx_class - HIDDEN_CLASS) * SCORES_COUNT;
+    if (idx_class == BACKGROUND_LABEL_ID)
+    {
+        for (uint i = lid; i < SCORES_COUNT; i += WORK_GROUP_SIZE)
+        {
+            FUNC_CALL(write_empty_row)(output, output_offset + i);
+        }
+        return;
+    }
+
+    __local uint histogram[256];
+    __local uint keys[SORT_SIZE];
+    __local uint indexes[SORT_SIZE];
+    __local float bboxes[SORT_SIZE * PRIOR_BOX_SIZE];
+    __local uint alive[WORDS_NUM];
+    __local uint kept_in_word[WORDS_NUM];
+    __local uint threshold_key;
+    __local uint equal_to_take;
+    __local uint equal_taken;
+    __local uint candidates_num;
+    __local bool selected;
+
+    //-------------------------------------------------------------------------------------------------------------------
+    // Radix select of the key of the SCORES_COUNT-th candidate, a byte of the key per pass
+    //-------------------------------------------------------------------------------------------------------------------
+    if (lid == 0)
+    {
+        threshold_key = 0;
+        equal_to_take = 0;
+        equal_taken = 0;
+        candidates_num = 0;
+        selected = false;
+    }
+
+    uint remaining = SCORES_COUNT;
+    for (int shift = 24; shift >= 0; shift -= 8)
+    {
+        for (uint i = lid; i < 256; i += WORK_GROUP_SIZE)
+        {
+            histogram[i] = 0;
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        if (selected)
+        {
+            break;
+        }
+
+        // the higher bytes of the candidates counted in this pass are the bytes selected so far
+        const uint prefix = threshold_key;
+        const uint prefix_mask = shift == 24 ? 0 : (0xFFFFFFFF << (shift + 8));
+        for (uint p = lid; p < NUM_OF_PRIORS; p += WORK_GROUP_SIZE)
+        {
+            const float score = FUNC_CALL(get_confidence)(input_confidence, p, idx_class, idx_image);
+            const uint key = FUNC_CALL(score_key)(score);
+            if (score > CONFIDENCE_THRESHOLD && (key & prefix_mask) == prefix)
+            {
+                atomic_inc(&histogram[(key >> shift) & 0xFF]);
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        if (lid == 0)
+        {
+            uint total = 0;
+            for (uint i = 0; i < 256; i++)
+            {
+                total += histogram[i];
+            }
+
+            if (shift == 24 && total <= SCORES_COUNT)
+            {
+                // all the candidates are taken, their keys are above 0
+                selected = true;
+            }
+            else
+            {
+                uint digit = 255;
+                uint above = 0;
+                while (above + histogram[digit] < remaining)
+                {
+                    above += histogram[digit];
+                    digit--;
+                }
+                threshold_key = prefix | (digit << shift);
+                equal_to_take = remaining - above;
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        remaining = equal_to_take;
+    }
+
+    //-------------------------------------------------------------------------------------------------------------------
+    // Compaction of the selected candidates to the local memory and their bitonic sort
+    //-------------------------------------------------------------------------------------------------------------------
+    for (uint p = lid; p < NUM_OF_PRIORS; p += WORK_GROUP_SIZE)
+    {
+        const float score = FUNC_CALL(get_confidence)(input_confidence, p, idx_class, idx_image);
+        const uint key = FUNC_CALL(score_key)(score);
+        if (score > CONFIDENCE_THRESHOLD &&
+            (key > threshold_key || (key == threshold_key && atomic_inc(&equal_taken) < equal_to_take)))
+        {
+            const uint slot = atomic_inc(&candidates_num);
+            keys[slot] = key;
+            indexes[slot] = p;
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    const uint num = candidates_num;
+    uint sort_num = 2;
+    while (sort_num < num)
+    {
+        sort_num <<= 1;
+    }
+    for (uint i = num + lid; i < sort_num; i += WORK_GROUP_SIZE)
+    {
+        keys[i] = 0;
+        indexes[i] = 0xFFFFFFFF;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (uint size = 2; size <= sort_num; size <<= 1)
+    {
+        for (uint stride = size >> 1; stride > 0; stride >>= 1)
+        {
+            for (uint i = lid; i < sort_num / 2; i += WORK_GROUP_SIZE)
+            {
+                const uint pos = 2 * i - (i & (stride - 1));
+                const uint partner = pos + stride;
+                const bool forward = (pos & size) == 0;
+                const bool swap = forward ?
+                    FUNC_CALL(is_before)(keys[partner], indexes[partner], keys[pos], indexes[pos]) :
+                    FUNC_CALL(is_before)(keys[pos], indexes[pos], keys[partner], indexes[partner]);
+                if (swap)
+                {
+                    const uint key = keys[pos];
+                    const uint index = indexes[pos];
+                    keys[pos] = keys[partner];
+                    indexes[pos] = indexes[partner];
+                    keys[partner] = key;
+                    indexes[partner] = index;
+                }
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+    }
+
+    //-------------------------------------------------------------------------------------------------------------------
+    // Decode of the sorted candidates and the suppression of the boxes overlapping the kept ones
+    //-------------------------------------------------------------------------------------------------------------------
+    const uint shared_class = (SHARE_LOCATION)? 0 : idx_class;
+    for (uint i = lid; i < num; i += WORK_GROUP_SIZE)
+    {
+        UNIT_TYPE decoded_bbox[4];
+        FUNC_CALL(get_decoded_bbox)(decoded_bbox, input_location, input_prior_box, indexes[i], shared_class, idx_image);
+        vstore4((float4)((float)decoded_bbox[0], (float)decoded_bbox[1], (float)decoded_bbox[2], (float)decoded_bbox[3]), i, bboxes);
+    }
+    for (uint w = lid; w < WORDS_NUM; w += WORK_GROUP_SIZE)
+    {
+        const uint bits = num > w * 32 ? num - w * 32 : 0;
+        alive[w] = bits >= 32 ? 0xFFFFFFFF : ((1u << bits) - 1);
+    }
+
+    for (uint i = 0; i < num; i++)
+    {
+        barrier(CLK_LOCAL_MEM_FENCE);
+        // the bit of the box is final, only the bits of the following boxes are cleared in this iteration
+        if (atomic_or(&alive[i / 32], 0) & (1u << (i % 32)))
+        {
+            const float4 kept_bbox = vload4(i, bboxes);
+            for (uint j = i + 1 + lid; j < num; j += WORK_GROUP_SIZE)
+            {
+                if (FUNC_CALL(get_overlap)(kept_bbox, vload4(j, bboxes)) > NMS_THRESHOLD)
+                {
+                    atomic_and(&alive[j / 32], ~(1u << (j % 32)));
+                }
+            }
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    //-------------------------------------------------------------------------------------------------------------------
+    // Output of the kept boxes in the order of the scores
+    //-------------------------------------------------------------------------------------------------------------------
+    for (uint w = lid; w < WORDS_NUM; w += WORK_GROUP_SIZE)
+    {
+        kept_in_word[w] = popcount(alive[w]);
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    uint kept_num = 0;
+    for (uint w = 0; w < WORDS_NUM; w++)
+    {
+        kept_num += kept_in_word[w];
+    }
+
+    for (uint w = lid; w < WORDS_NUM; w += WORK_GROUP_SIZE)
+    {
+        uint row = 0;
+        for (uint v = 0; v < w; v++)
+        {
+            row += kept_in_word[v];
+        }
+
+        uint bits = alive[w];
+        while (bits != 0)
+        {
+            const uint i = w * 32 + 31 - clz(bits & (~bits + 1));
+            bits &= bits - 1;
+
+            const float4 bbox = vload4(i, bboxes);
+            const uint out_idx = (output_offset + row) * OUTPUT_ROW_SIZE + OUTPUT_OFFSET;
+            output[out_idx] = TO_UNIT_TYPE(idx_image);
+            output[out_idx + 1] = TO_UNIT_TYPE(idx_class);
+            output[out_idx + 2] = TO_UNIT_TYPE(FUNC_CALL(get_confidence)(input_confidence, indexes[i], idx_class, idx_image));
+            output[out_idx + 3] = TO_UNIT_TYPE(bbox.s0);
+            output[out_idx + 4] = TO_UNIT_TYPE(bbox.s1);
+            output[out_idx + 5] = TO_UNIT_TYPE(bbox.s2);
+            output[out_idx + 6] = TO_UNIT_TYPE(bbox.s3);
+            row++;
+        }
+    }
+
+    for (uint i = kept_num + lid; i < SCORES_COUNT; i += WORK_GROUP_SIZE)
+    {
+        FUNC_CALL(write_empty_row)(output, output_offset + i);
+    }
+}
+
+#undef WORDS_NUM
+
+#endif
@@ -0,0 +1,71 @@
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/include_all.cl"
+
+// Every work group computes one output: its work items accumulate the parts of the dot product in float,
+// reading the half weights and the float input VEC_SIZE elements at once, and the parts are reduced in the local memory.
+__attribute__((reqd_work_group_size(LOCAL_WORK_GROUP_SIZE, 1, 1)))
+KERNEL(fully_connected_gpu_bf_fp16_weights)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    const __global FILTER_TYPE* weights
+#if BIAS_TERM
+    , const __global BIAS_TYPE* biases
+#endif
+    )
+{
+    const uint lid = get_local_id(0);
+    const uint ofm = get_global_id(1);
+    const uint b = get_global_id(2);
+
+    const __global INPUT0_TYPE* input_row = input + INPUT0_OFFSET + b * INPUT0_BATCH_PITCH;
+    const __global FILTER_TYPE* weights_row = weights + ofm * FILTER_OFM_PITCH;
+
+    ACCUMULATOR_TYPE dotProd = ACCUMULATOR_TYPE_ZERO;
+
+    const uint vectors_count = INPUT0_ELEMENTS_COUNT / VEC_SIZE;
+    for (uint v = lid; v < vectors_count; v += LOCAL_WORK_GROUP_SIZE)
+    {
+        const float8 in = convert_float8(vload8(v, input_row));
+        const float8 w = convert_float8(vload8(v, weights_row));
+        dotProd += dot(in.lo, w.lo) + dot(in.hi, w.hi);
+    }
+    for (uint i = vectors_count * VEC_SIZE + lid; i < INPUT0_ELEMENTS_COUNT; i += LOCAL_WORK_GROUP_SIZE)
+    {
+        dotProd += (ACCUMULATOR_TYPE)input_row[i] * (ACCUMULATOR_TYPE)weights_row[i];
+    }
+
+    __local ACCUMULATOR_TYPE partial_sums[LOCAL_WORK_GROUP_SIZE];
+    partial_sums[lid] = dotProd;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (uint stride = LOCAL_WORK_GROUP_SIZE / 2; stride > 0; stride /= 2)
+    {
+        if (lid < stride)
+            partial_sums[lid] += partial_sums[lid + stride];
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (lid == 0)
+    {
+        ACCUMULATOR_TYPE result = partial_sums[0];
+#if BIAS_TERM
+        result += (ACCUMULATOR_TYPE)biases[ofm];
+#endif
+        const uint output_idx = GET_DATA_INDEX(OUTPUT, b, ofm, 0, 0);
+        output[output_idx] = ACTIVATION((UNIT_TYPE)result, NL_M, NL_N);
+    }
+}
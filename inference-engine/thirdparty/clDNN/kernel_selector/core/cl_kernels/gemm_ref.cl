@@ -31,37 +31,27 @@ KERNEL(gemm_ref)
 	uint in1_idx=0;
 	float value = 0;
 	
-#if TRANSPOSE_INPUT1
-for (uint i = 0; i < Y1; ++i)
+	for (uint i = 0; i < GEMM_K; ++i)
 	{
-		in0_idx = i * X1 + x + b * X1 * Y1; 
+#if TRANSPOSE_INPUT1
+		in0_idx = i * X1 + x + b * INPUT0_BATCH_STRIDE;
 #else
-	for (uint i = 0; i < X1; ++i)
-	{
-		in0_idx = x * X1 + i + b * X1 * Y1; 
+		in0_idx = x * X1 + i + b * INPUT0_BATCH_STRIDE;
 #endif
 
 #if TRANSPOSE_INPUT2
-	in1_idx = y * X2 + i + b * X2 * Y2;
+		in1_idx = y * X2 + i + b * INPUT1_BATCH_STRIDE;
 #else
-	in1_idx = i * X2 + y + b * X2 * Y2;
+		in1_idx = i * X2 + y + b * INPUT1_BATCH_STRIDE;
 #endif
 
 		value = fma(input0[in0_idx], input1[in1_idx], value);
 	}
-#if TRANSPOSE_INPUT1 && TRANSPOSE_INPUT2
-	uint out_idx = x * Y2 + y + b * X1 * Y2;
-#elif TRANSPOSE_INPUT1
-	uint out_idx = x * X2 + y + b * X1 * Y1;
-#elif TRANSPOSE_INPUT2
-	uint out_idx = x * Y2 + y + b * X2 * Y2;
-#else
-	uint out_idx = x * X2 + y + b * X2 * Y1;
-#endif
+	uint out_idx = x * GEMM_N + y + b * OUTPUT_BATCH_STRIDE;
 	
 	float beta_out = 0;
 #if OUT_BIAS_TERM
-	beta_out = BETA * input2[out_idx];
+	beta_out = BETA * input2[x * GEMM_N + y + b * INPUT2_BATCH_STRIDE];
 #endif
 	output[out_idx] = fma(ALPHA, value, beta_out);
 }
@@ -0,0 +1,90 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+
+// Every work item computes TILE_M rows of a column of the output. The rows of a tile of the first matrix are read once
+// per sub group: each lane loads one of SUB_GROUP_SIZE consecutive elements of a row and the others get it by shuffle.
+
+#if TRANSPOSE_INPUT1
+#define INPUT0_IDX(m, k) ((k) * X1 + (m))
+#else
+#define INPUT0_IDX(m, k) ((m) * X1 + (k))
+#endif
+
+#if TRANSPOSE_INPUT2
+#define INPUT1_IDX(k, n) ((n) * X2 + (k))
+#else
+#define INPUT1_IDX(k, n) ((k) * X2 + (n))
+#endif
+
+__attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE)))
+__attribute__((reqd_work_group_size(SUB_GROUP_SIZE, 1, 1)))
+KERNEL(gemm_tiled_opt)
+	(const __global UNIT_TYPE* input0,
+	const __global UNIT_TYPE* input1,
+#if OUT_BIAS_TERM
+	const __global UNIT_TYPE* input2,
+#endif
+	__global UNIT_TYPE* output)
+{
+	const uint n = (uint)get_global_id(0);
+	const uint m0 = (uint)get_group_id(1) * TILE_M;
+	const uint b = (uint)get_global_id(2);
+	const uint lane = get_sub_group_local_id();
+
+	const __global UNIT_TYPE* a_ptr = input0 + b * INPUT0_BATCH_STRIDE;
+	const __global UNIT_TYPE* b_ptr = input1 + b * INPUT1_BATCH_STRIDE;
+
+	float acc[TILE_M];
+	for (uint i = 0; i < TILE_M; ++i)
+		acc[i] = 0;
+
+	// the lanes beyond the last column take part in the shuffles, they only skip the stores
+	for (uint k0 = 0; k0 < GEMM_K; k0 += SUB_GROUP_SIZE)
+	{
+		const uint k_size = min((uint)SUB_GROUP_SIZE, (uint)GEMM_K - k0);
+
+		float a[TILE_M];
+		for (uint i = 0; i < TILE_M; ++i)
+			a[i] = (lane < k_size && m0 + i < GEMM_M) ? (float)a_ptr[INPUT0_IDX(m0 + i, k0 + lane)] : 0;
+
+		for (uint kk = 0; kk < k_size; ++kk)
+		{
+			const float b_val = n < GEMM_N ? (float)b_ptr[INPUT1_IDX(k0 + kk, n)] : 0;
+			for (uint i = 0; i < TILE_M; ++i)
+				acc[i] = fma(intel_sub_group_shuffle(a[i], kk), b_val, acc[i]);
+		}
+	}
+
+	if (n >= GEMM_N)
+		return;
+
+	for (uint i = 0; i < TILE_M; ++i)
+	{
+		const uint m = m0 + i;
+		if (m >= GEMM_M)
+			break;
+
+		float beta_out = 0;
+#if OUT_BIAS_TERM
+		beta_out = BETA * input2[m * GEMM_N + n + b * INPUT2_BATCH_STRIDE];
+#endif
+		output[m * GEMM_N + n + b * OUTPUT_BATCH_STRIDE] = (UNIT_TYPE)fma(ALPHA, acc[i], beta_out);
+	}
+}
+
+#undef INPUT0_IDX
+#undef INPUT1_IDX
@@ -0,0 +1,169 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/include_all.cl"
+
+#define ACTIVATION_LOGISTIC(input)                      (UNIT_VAL_ONE/(UNIT_VAL_ONE + exp(-input)))
+#define ACTIVATION_HYPERBOLIC_TAN(input)                (tanh(input))
+
+#if RECURRENT_IN_SLM
+#define RECURRENT_VAL(y, x) ((ACCUMULATOR_TYPE)recurrent_slm[(x) * LSTM_GATES_SIZE + (y)])
+#else
+#define RECURRENT_VAL(y, x) ((ACCUMULATOR_TYPE)recurrent[GET_DATA_INDEX(RECURRENT, 0, 0, (y), (x))])
+#endif
+
+// input     = [    batch,  sequence,               1,      input_size ]
+// weights   = [        1,         1, 4 * hidden_size,      input_size ]
+// recurrent = [        1,         1, 4 * hidden_size,     hidden_size ]
+// biases    = [        1,         1,               1, 4 * hidden_size ] optional
+// hidden    = [    batch,         1,               1,     hidden_size ] optional
+// cell      = [    batch,         1,               1,     hidden_size ] optional
+// output    = [    batch,  sequence,               1,     hidden_size ] the hidden of every step or of the last one,
+//                                                                       followed by the last cell if it is emitted
+//
+// A work group runs all the steps of a batch, a work item owns the hidden units lid, lid + LWS, ...
+// The hidden state stays in the local memory and the cell state in the registers between the steps.
+__attribute__((reqd_work_group_size(LWS, 1, 1)))
+KERNEL(lstm_seq)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    const __global WEIGHTS_TYPE* weights,
+    const __global RECURRENT_TYPE* recurrent
+#if BIAS_TERM
+    , const __global BIAS_TYPE* biases
+#endif
+#if HIDDEN_TERM
+    , const __global HIDDEN_TYPE* hidden
+#endif
+#if CELL_TERM
+    , const __global CELL_TYPE* cell
+#endif
+    )
+{
+    const uint lid = get_local_id(0);
+    const uint b = get_global_id(1);
+
+    __local ACCUMULATOR_TYPE input_slm[LSTM_INPUT_SIZE];
+    // the hidden of the previous and of the current step
+    __local OUTPUT_TYPE hidden_slm[2][LSTM_HIDDEN_SIZE];
+#if RECURRENT_IN_SLM
+    // transposed, so the work items of a group read the consecutive words
+    __local RECURRENT_TYPE recurrent_slm[LSTM_HIDDEN_SIZE * LSTM_GATES_SIZE];
+    for (uint i = lid; i < LSTM_GATES_SIZE * LSTM_HIDDEN_SIZE; i += LWS)
+    {
+        const uint y = i / LSTM_HIDDEN_SIZE;
+        const uint x = i % LSTM_HIDDEN_SIZE;
+        recurrent_slm[x * LSTM_GATES_SIZE + y] = recurrent[GET_DATA_INDEX(RECURRENT, 0, 0, y, x)];
+    }
+#endif
+
+    ACCUMULATOR_TYPE cell_state[UNITS_PER_WI];
+    for (uint u = 0; u < UNITS_PER_WI; ++u)
+    {
+        const uint x = lid + u * LWS;
+#if CELL_TERM
+        cell_state[u] = x < LSTM_HIDDEN_SIZE ? (ACCUMULATOR_TYPE)cell[GET_DATA_INDEX(CELL, b, 0, 0, x)] : ACCUMULATOR_TYPE_ZERO;
+#else
+        cell_state[u] = ACCUMULATOR_TYPE_ZERO;
+#endif
+        if (x < LSTM_HIDDEN_SIZE)
+        {
+#if HIDDEN_TERM
+            hidden_slm[0][x] = (OUTPUT_TYPE)hidden[GET_DATA_INDEX(HIDDEN, b, 0, 0, x)];
+#else
+            hidden_slm[0][x] = (OUTPUT_TYPE)0;
+#endif
+        }
+    }
+
+    for (uint s = 0; s < LSTM_SEQ_LEN; ++s)
+    {
+        const uint cur = s % 2;
+        for (uint x = lid; x < LSTM_INPUT_SIZE; x += LWS)
+        {
+            input_slm[x] = (ACCUMULATOR_TYPE)input[GET_DATA_INDEX(INPUT0, b, s, 0, x)];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (uint u = 0; u < UNITS_PER_WI; ++u)
+        {
+            const uint h = lid + u * LWS;
+            if (h >= LSTM_HIDDEN_SIZE)
+                break;
+
+            // the four gates of the unit share the reads of the input and of the hidden
+#if BIAS_TERM
+            ACCUMULATOR_TYPE it = (ACCUMULATOR_TYPE)biases[GET_DATA_INDEX(BIAS, 0, 0, 0, h + GEMM_OFFSET_I)];
+            ACCUMULATOR_TYPE ot = (ACCUMULATOR_TYPE)biases[GET_DATA_INDEX(BIAS, 0, 0, 0, h + GEMM_OFFSET_O)];
+            ACCUMULATOR_TYPE ft = (ACCUMULATOR_TYPE)biases[GET_DATA_INDEX(BIAS, 0, 0, 0, h + GEMM_OFFSET_F)];
+            ACCUMULATOR_TYPE zt = (ACCUMULATOR_TYPE)biases[GET_DATA_INDEX(BIAS, 0, 0, 0, h + GEMM_OFFSET_Z)];
+#else
+            ACCUMULATOR_TYPE it = ACCUMULATOR_TYPE_ZERO;
+            ACCUMULATOR_TYPE ot = ACCUMULATOR_TYPE_ZERO;
+            ACCUMULATOR_TYPE ft = ACCUMULATOR_TYPE_ZERO;
+            ACCUMULATOR_TYPE zt = ACCUMULATOR_TYPE_ZERO;
+#endif
+            for (uint x = 0; x < LSTM_INPUT_SIZE; ++x)
+            {
+                const ACCUMULATOR_TYPE in_val = input_slm[x];
+                it += in_val * (ACCUMULATOR_TYPE)weights[GET_DATA_INDEX(WEIGHTS, 0, 0, h + GEMM_OFFSET_I, x)];
+                ot += in_val * (ACCUMULATOR_TYPE)weights[GET_DATA_INDEX(WEIGHTS, 0, 0, h + GEMM_OFFSET_O, x)];
+                ft += in_val * (ACCUMULATOR_TYPE)weights[GET_DATA_INDEX(WEIGHTS, 0, 0, h + GEMM_OFFSET_F, x)];
+                zt += in_val * (ACCUMULATOR_TYPE)weights[GET_DATA_INDEX(WEIGHTS, 0, 0, h + GEMM_OFFSET_Z, x)];
+            }
+            for (uint x = 0; x < LSTM_HIDDEN_SIZE; ++x)
+            {
+                const ACCUMULATOR_TYPE hv = (ACCUMULATOR_TYPE)hidden_slm[cur][x];
+                it += hv * RECURRENT_VAL(h + GEMM_OFFSET_I, x);
+                ot += hv * RECURRENT_VAL(h + GEMM_OFFSET_O, x);
+                ft += hv * RECURRENT_VAL(h + GEMM_OFFSET_F, x);
+                zt += hv * RECURRENT_VAL(h + GEMM_OFFSET_Z, x);
+            }
+
+            // the same element wise part as lstm_elt, a missing initial cell is zero
+            ACCUMULATOR_TYPE val = ACTIVATION_LOGISTIC(CLIP(it)) * ACTIVATION_HYPERBOLIC_TAN(CLIP(zt));
+#if INPUT_FORGET
+            val *= ((ACCUMULATOR_TYPE)1 - ft);
+#endif
+            // the states are rounded to the output type as they are between the separate primitives
+            val = (ACCUMULATOR_TYPE)(OUTPUT_TYPE)(val + cell_state[u] * ACTIVATION_LOGISTIC(CLIP(ft)));
+            cell_state[u] = val;
+
+            const OUTPUT_TYPE hidden_val = (OUTPUT_TYPE)(ACTIVATION_HYPERBOLIC_TAN(val) * ACTIVATION_LOGISTIC(ot));
+            hidden_slm[cur ^ 1][h] = hidden_val;
+#if EMIT_SEQUENCE
+            output[GET_DATA_INDEX(OUTPUT, b, s, 0, h)] = hidden_val;
+#else
+            if (s == LSTM_SEQ_LEN - 1)
+                output[GET_DATA_INDEX(OUTPUT, b, 0, 0, h)] = hidden_val;
+#endif
+        }
+        // the next step reads the whole hidden and overwrites the input
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+#if EMIT_LAST_CELL
+    for (uint u = 0; u < UNITS_PER_WI; ++u)
+    {
+        const uint h = lid + u * LWS;
+        if (h < LSTM_HIDDEN_SIZE)
+            output[GET_DATA_INDEX(OUTPUT, b, CELL_OUTPUT_FEATURE, 0, h)] = (OUTPUT_TYPE)cell_state[u];
+    }
+#endif
+}
+
+#undef RECURRENT_VAL
+#undef ACTIVATION_LOGISTIC
+#undef ACTIVATION_HYPERBOLIC_TAN
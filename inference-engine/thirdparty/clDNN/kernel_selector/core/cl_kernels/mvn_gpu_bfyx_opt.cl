@@ -52,17 +52,16 @@ KERNEL (mvn_gpu_bfyx_opt)(const __global UNIT_TYPE* input, __global UNIT_TYPE* o
 
     lg_storage[in_data_set_idx] = my_sum;
 
+    //LWS is a power of two, the partial sums are reduced by a tree in log2(LWS) steps
     barrier(CLK_LOCAL_MEM_FENCE);
-    if (in_data_set_idx == 0)
+    for (uint offset = LWS / 2; offset > 0; offset /= 2)
     {
-        for (uint i=1; i<LWS; ++i)
-            my_sum += lg_storage[i];
-
-        lg_storage[0] = my_sum / data_set_size;
+        if (in_data_set_idx < offset)
+            lg_storage[in_data_set_idx] += lg_storage[in_data_set_idx + offset];
+        barrier(CLK_LOCAL_MEM_FENCE);
     }
-    barrier(CLK_LOCAL_MEM_FENCE);
 
-    my_sum = lg_storage[0];
+    my_sum = lg_storage[0] / data_set_size;
 
 #if NORMALIZE_VARIANCE == 0
     for (uint i=0; i<ITEMS_NUM; ++i)
@@ -91,17 +90,14 @@ KERNEL (mvn_gpu_bfyx_opt)(const __global UNIT_TYPE* input, __global UNIT_TYPE* o
     lg_storage[in_data_set_idx] = my_variance;
 
     barrier(CLK_LOCAL_MEM_FENCE);
-    if (in_data_set_idx == 0)
+    for (uint offset = LWS / 2; offset > 0; offset /= 2)
     {
-        for (uint i=1; i<LWS; ++i)
-            my_variance += lg_storage[i];
-
-        my_variance /= data_set_size;
-        lg_storage[0] = native_powr(my_variance + (float)EPSILON, -0.5f);
+        if (in_data_set_idx < offset)
+            lg_storage[in_data_set_idx] += lg_storage[in_data_set_idx + offset];
+        barrier(CLK_LOCAL_MEM_FENCE);
     }
-    barrier(CLK_LOCAL_MEM_FENCE);
 
-    my_variance = lg_storage[0];
+    my_variance = native_powr(lg_storage[0] / data_set_size + (float)EPSILON, -0.5f);
 
     for (uint i=0; i<ITEMS_NUM; ++i)
         output[my_data_offset + i * workers_per_data_set] = ACTIVATION((UNIT_CVT_FUNC(input[my_data_offset + i * workers_per_data_set]) - UNIT_CVT_FUNC(my_sum)) * UNIT_CVT_FUNC(my_variance), NL_M ,NL_N);
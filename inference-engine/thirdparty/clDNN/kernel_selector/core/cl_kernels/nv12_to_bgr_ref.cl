@@ -0,0 +1,73 @@
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+#include "include/include_all.cl"
+
+inline uint FUNC(y_index)(uint b, uint y, uint x)
+{
+    return INPUT0_OFFSET + b * INPUT0_BATCH_PITCH + y * INPUT0_Y_PITCH + x * INPUT0_X_PITCH;
+}
+
+// the UV plane follows the Y plane, every pair of U and V is shared by the 2x2 pixels
+inline uint FUNC(uv_index)(uint b, uint y, uint x)
+{
+    return INPUT0_OFFSET + b * INPUT0_BATCH_PITCH + (FRAME_HEIGHT + y / 2) * INPUT0_Y_PITCH + (x & ~1u) * INPUT0_X_PITCH;
+}
+
+KERNEL(nv12_to_bgr_ref)(const __global uchar* input, __global OUTPUT_TYPE* output)
+{
+    const uint x = get_global_id(0);
+    const uint y = get_global_id(1);
+    const uint b = get_global_id(2);
+
+    // bilinear interpolation with the pixel centers aligned
+    const float in_x = max(((float)x + 0.5f) * SCALE_X - 0.5f, 0.0f);
+    const float in_y = max(((float)y + 0.5f) * SCALE_Y - 0.5f, 0.0f);
+    const uint x0 = min((uint)in_x, (uint)FRAME_WIDTH - 1);
+    const uint y0 = min((uint)in_y, (uint)FRAME_HEIGHT - 1);
+    const uint x1 = min(x0 + 1, (uint)FRAME_WIDTH - 1);
+    const uint y1 = min(y0 + 1, (uint)FRAME_HEIGHT - 1);
+    const float dx = in_x - (float)x0;
+    const float dy = in_y - (float)y0;
+
+    const uint xs[4] = { x0, x1, x0, x1 };
+    const uint ys[4] = { y0, y0, y1, y1 };
+    const float weights[4] = { (1.0f - dx) * (1.0f - dy), dx * (1.0f - dy), (1.0f - dx) * dy, dx * dy };
+
+    float Y = 0.0f;
+    float U = 0.0f;
+    float V = 0.0f;
+    for (uint i = 0; i < 4; i++)
+    {
+        const uint uv = FUNC_CALL(uv_index)(b, ys[i], xs[i]);
+        Y += weights[i] * (float)input[FUNC_CALL(y_index)(b, ys[i], xs[i])];
+        U += weights[i] * (float)input[uv];
+        V += weights[i] * (float)input[uv + INPUT0_X_PITCH];
+    }
+
+    // BT.601 of the limited range the video decoders produce
+    Y = 1.164f * (Y - 16.0f);
+    U -= 128.0f;
+    V -= 128.0f;
+    const float B = clamp(Y + 2.018f * U, 0.0f, 255.0f);
+    const float G = clamp(Y - 0.813f * V - 0.391f * U, 0.0f, 255.0f);
+    const float R = clamp(Y + 1.596f * V, 0.0f, 255.0f);
+
+    const uint output_index = OUTPUT_OFFSET + b * OUTPUT_BATCH_PITCH + y * OUTPUT_Y_PITCH + x * OUTPUT_X_PITCH;
+    output[output_index] = TO_OUTPUT_TYPE(B);
+    output[output_index + OUTPUT_FEATURE_PITCH] = TO_OUTPUT_TYPE(G);
+    output[output_index + 2 * OUTPUT_FEATURE_PITCH] = TO_OUTPUT_TYPE(R);
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2017 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+// The indices are in the [b, f, x, y] order of PERMUTE_ORDER. TILE_DIM is the input dimension which becomes the x of the
+// output, the other two are OTHER_DIM0 and OTHER_DIM1 (of OTHER_DIM1_SIZE elements).
+//
+// When x stays the innermost dimension (TILE_DIM == 2) the consecutive work items read and write the consecutive
+// elements. Otherwise a TILE_SIZE x TILE_SIZE tile is read along the input x to the local memory and written along the
+// output x from it, so both the reads and the writes are coalesced.
+
+inline uint FUNC(output_offset)(const uint in_idx[4])
+{
+    return GET_DATA_INDEX(OUTPUT, in_idx[PERMUTE_ORDER[0]], in_idx[PERMUTE_ORDER[1]], in_idx[PERMUTE_ORDER[3]], in_idx[PERMUTE_ORDER[2]]);
+}
+
+#if TILE_DIM == 2
+KERNEL (permute_tiled)(const __global UNIT_TYPE* input, __global UNIT_TYPE* output)
+{
+    //gws(x, y, b*f)
+    uint in_idx[4];
+    in_idx[2] = get_global_id(0);
+    in_idx[3] = get_global_id(1);
+    in_idx[OTHER_DIM0] = get_global_id(2) / OTHER_DIM1_SIZE;
+    in_idx[OTHER_DIM1] = get_global_id(2) % OTHER_DIM1_SIZE;
+
+    const uint input_offset = GET_DATA_INDEX(INPUT0, in_idx[0], in_idx[1], in_idx[3], in_idx[2]);
+    output[FUNC_CALL(output_offset)(in_idx)] = ACTIVATION(input[input_offset], NL_M, NL_N);
+}
+#else
+__attribute__((reqd_work_group_size(TILE_SIZE, TILE_SIZE, 1)))
+KERNEL (permute_tiled)(const __global UNIT_TYPE* input, __global UNIT_TYPE* output)
+{
+    // the padding column keeps the transposed reads of the tile free of the bank conflicts
+    __local UNIT_TYPE tile[TILE_SIZE][TILE_SIZE + 1];
+
+    //gws(x rounded up, size of TILE_DIM rounded up, the other dimensions)
+    const uint lx = get_local_id(0);
+    const uint ly = get_local_id(1);
+    const uint x0 = get_group_id(0) * TILE_SIZE;
+    const uint d0 = get_group_id(1) * TILE_SIZE;
+
+    uint in_idx[4];
+    in_idx[OTHER_DIM0] = get_global_id(2) / OTHER_DIM1_SIZE;
+    in_idx[OTHER_DIM1] = get_global_id(2) % OTHER_DIM1_SIZE;
+
+    in_idx[2] = x0 + lx;
+    in_idx[TILE_DIM] = d0 + ly;
+    if (in_idx[2] < INPUT0_SIZE_X && in_idx[TILE_DIM] < TILE_DIM_SIZE)
+        tile[ly][lx] = input[GET_DATA_INDEX(INPUT0, in_idx[0], in_idx[1], in_idx[3], in_idx[2])];
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    in_idx[2] = x0 + ly;
+    in_idx[TILE_DIM] = d0 + lx;
+    if (in_idx[2] < INPUT0_SIZE_X && in_idx[TILE_DIM] < TILE_DIM_SIZE)
+        output[FUNC_CALL(output_offset)(in_idx)] = ACTIVATION(tile[lx][ly], NL_M, NL_N);
+}
+#endif
@@ -0,0 +1,56 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+// U = G * g * GT of F(4x4, 3x3), the 6x6 transformed filter of the pair (ofm, ifm) is stored row by row
+KERNEL(reorder_weights_winograd_4x4_3x3_s1)(const __global INPUT0_TYPE* input, __global OUTPUT_TYPE* output)
+{
+    const uint i = get_global_id(0);
+    const uint o = get_global_id(1);
+
+    float g[3][3];
+    for (uint y = 0; y < 3; y++)
+    {
+        for (uint x = 0; x < 3; x++)
+        {
+            g[y][x] = (float)input[GET_FILTER_INDEX(INPUT0, o, i, y, x)];
+        }
+    }
+
+    // t = G * g
+    float t[6][3];
+    for (uint x = 0; x < 3; x++)
+    {
+        t[0][x] = g[0][x] / 4.f;
+        t[1][x] = -(g[0][x] + g[1][x] + g[2][x]) / 6.f;
+        t[2][x] = -(g[0][x] - g[1][x] + g[2][x]) / 6.f;
+        t[3][x] = g[0][x] / 24.f + g[1][x] / 12.f + g[2][x] / 6.f;
+        t[4][x] = g[0][x] / 24.f - g[1][x] / 12.f + g[2][x] / 6.f;
+        t[5][x] = g[2][x];
+    }
+
+    // u = t * GT
+    uint out_idx = o * OUTPUT_OFM_PITCH + i * OUTPUT_IFM_PITCH;
+    for (uint y = 0; y < 6; y++)
+    {
+        output[out_idx + 0 * OUTPUT_X_PITCH] = TO_OUTPUT_TYPE(t[y][0] / 4.f);
+        output[out_idx + 1 * OUTPUT_X_PITCH] = TO_OUTPUT_TYPE(-(t[y][0] + t[y][1] + t[y][2]) / 6.f);
+        output[out_idx + 2 * OUTPUT_X_PITCH] = TO_OUTPUT_TYPE(-(t[y][0] - t[y][1] + t[y][2]) / 6.f);
+        output[out_idx + 3 * OUTPUT_X_PITCH] = TO_OUTPUT_TYPE(t[y][0] / 24.f + t[y][1] / 12.f + t[y][2] / 6.f);
+        output[out_idx + 4 * OUTPUT_X_PITCH] = TO_OUTPUT_TYPE(t[y][0] / 24.f - t[y][1] / 12.f + t[y][2] / 6.f);
+        output[out_idx + 5 * OUTPUT_X_PITCH] = TO_OUTPUT_TYPE(t[y][2]);
+        out_idx += OUTPUT_Y_PITCH;
+    }
+}
@@ -52,15 +52,14 @@ KERNEL (softmax_gpu_continoues_bfyx)(const __global UNIT_TYPE* input, __global U
 
     lg_storage[in_data_set_idx] = my_maximum;
 
+    //LWS is a power of two, the partial results are reduced by a tree in log2(LWS) steps
     barrier(CLK_LOCAL_MEM_FENCE);
-    if (in_data_set_idx == 0)
+    for (uint offset = LWS / 2; offset > 0; offset /= 2)
     {
-        for (uint i=1; i<LWS; ++i)
-            my_maximum = max(my_maximum, lg_storage[i]);
-
-        lg_storage[0] = my_maximum;
+        if (in_data_set_idx < offset)
+            lg_storage[in_data_set_idx] = max(lg_storage[in_data_set_idx], lg_storage[in_data_set_idx + offset]);
+        barrier(CLK_LOCAL_MEM_FENCE);
     }
-    barrier(CLK_LOCAL_MEM_FENCE);
 
     //my_maximum from this point is in fact global maximum
     my_maximum = lg_storage[0];
@@ -84,14 +83,12 @@ KERNEL (softmax_gpu_continoues_bfyx)(const __global UNIT_TYPE* input, __global U
     lg_storage[in_data_set_idx] = my_sum;
 
     barrier(CLK_LOCAL_MEM_FENCE);
-    if (in_data_set_idx == 0)
+    for (uint offset = LWS / 2; offset > 0; offset /= 2)
     {
-        for (uint i=1; i<LWS; ++i)
-            my_sum += lg_storage[i];
-
-        lg_storage[0] = my_sum;
+        if (in_data_set_idx < offset)
+            lg_storage[in_data_set_idx] += lg_storage[in_data_set_idx + offset];
+        barrier(CLK_LOCAL_MEM_FENCE);
     }
-    barrier(CLK_LOCAL_MEM_FENCE);
 
     my_sum = lg_storage[0];
 
@@ -0,0 +1,73 @@
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+
+#define SUB_GROUP_SIZE 16
+#define SUB_GROUPS_NUM (LWS / SUB_GROUP_SIZE)
+
+// One work group per data set. The data set is too long to be kept in the private memory, so it is streamed
+// from the global memory in every phase; the partial results are reduced in the subgroups first and then across
+// the subgroups in SLM. The accumulation is done in float for both input precisions.
+__attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE)))
+__attribute__((reqd_work_group_size(LWS, 1, 1)))
+KERNEL (softmax_gpu_bf_large)(const __global UNIT_TYPE* input, __global UNIT_TYPE* output)
+{
+    const uint data_set_idx = get_global_id(1);     //in processing of which data set this WI participates?
+    const uint in_data_set_idx = get_local_id(0);   //this WI's id in group of items processing single data set
+    const uint sub_group_idx = get_sub_group_id();
+    const uint data_set_offset = data_set_idx * DATA_SET_SIZE;
+
+    __local float lg_storage[SUB_GROUPS_NUM];
+
+    // PHASE 1. Calculate MAX value
+    float my_maximum = -FLT_MAX;
+    for (uint i = in_data_set_idx; i < DATA_SET_SIZE; i += LWS)
+        my_maximum = max(my_maximum, (float)input[data_set_offset + i]);
+
+    my_maximum = sub_group_reduce_max(my_maximum);
+    if (get_sub_group_local_id() == 0)
+        lg_storage[sub_group_idx] = my_maximum;
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+    for (uint i = 0; i < SUB_GROUPS_NUM; ++i)
+        my_maximum = max(my_maximum, lg_storage[i]);
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // PHASE 2. Calculate DENOMINATOR
+    float my_sum = 0.f;
+    for (uint i = in_data_set_idx; i < DATA_SET_SIZE; i += LWS)
+        my_sum += native_exp((float)input[data_set_offset + i] - my_maximum);
+
+    my_sum = sub_group_reduce_add(my_sum);
+    if (get_sub_group_local_id() == 0)
+        lg_storage[sub_group_idx] = my_sum;
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+    my_sum = 0.f;
+    for (uint i = 0; i < SUB_GROUPS_NUM; ++i)
+        my_sum += lg_storage[i];
+
+    // PHASE 3. Write out results
+    const float inv_sum = 1.f / my_sum;
+    for (uint i = in_data_set_idx; i < DATA_SET_SIZE; i += LWS)
+    {
+        const UNIT_TYPE res = (UNIT_TYPE)(native_exp((float)input[data_set_offset + i] - my_maximum) * inv_sum);
+        output[data_set_offset + i] = ACTIVATION(res, NL_M ,NL_N);
+    }
+}
+
+#undef SUB_GROUPS_NUM
+#undef SUB_GROUP_SIZE
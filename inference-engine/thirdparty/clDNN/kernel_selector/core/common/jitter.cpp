@@ -232,7 +232,7 @@ namespace kernel_selector {
                                                         (UNIT_MAX_FUNC(input, UNIT_VAL_ZERO) + TO_UNIT_TYPE(slope) * UNIT_MIN_FUNC(input, UNIT_VAL_ZERO))");
         case ActivationFunction::ELU:
             return MakeJitConstant(name + "(input, alpha, n)", "(UNIT_MAX_FUNC(input, UNIT_VAL_ZERO) +  \
-                                                        TO_UNIT_TYPE(alpha) * (exp(UNIT_MIN_FUNC(input, UNIT_VAL_ZERO)) - UNIT_VAL_ONE));");
+                                                        TO_UNIT_TYPE(alpha) * (exp(UNIT_MIN_FUNC(input, UNIT_VAL_ZERO)) - UNIT_VAL_ONE))");
         case ActivationFunction::CLAMP:
             return MakeJitConstant(name + "(input, m, n)", "(UNIT_MAX_FUNC(TO_UNIT_TYPE(m), UNIT_MIN_FUNC(TO_UNIT_TYPE(n), input)))");
         case ActivationFunction::SOFTRELU:
@@ -383,6 +383,26 @@ namespace kernel_selector {
         };
     }
 
+    JitConstants MakeFusedActivationsJitConstants(const base_activation_params& params, const std::vector<base_activation_params>& fused_activations)
+    {
+        // the kernels pass NL_M and NL_N to ACTIVATION, so the first function keeps them and the fused ones have their own,
+        // the inner results are parenthesized since not all the function bodies are
+        JitConstants jit{
+            MakeJitConstant("NL_M", params.m),
+            MakeJitConstant("NL_N", params.n),
+            MakeActivationJitConstants(params.function, "_FUSED0"),
+        };
+        std::string chain = "ACTIVATION_FUSED0(input, m, n)";
+        for (size_t i = 0; i < fused_activations.size(); i++)
+        {
+            const std::string suffix = "_FUSED" + toCodeString(i + 1);
+            jit.Merge(MakeActivationJitConstants(fused_activations[i], suffix));
+            chain = "ACTIVATION" + suffix + "((" + chain + "), NL_M" + suffix + ", NL_N" + suffix + ")";
+        }
+        jit.AddConstant(MakeJitConstant("ACTIVATION(input, m, n)", chain));
+        return jit;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // MakeBaseParamsJitConstants
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,7 +467,14 @@ namespace kernel_selector {
         }
 
         // for activation function
-        jit.Merge(MakeActivationJitConstants(params.activation));
+        if (params.fused_activations.empty())
+        {
+            jit.Merge(MakeActivationJitConstants(params.activation));
+        }
+        else
+        {
+            jit.Merge(MakeFusedActivationsJitConstants(params.activation, params.fused_activations));
+        }
 
         for (size_t i = 0; i < params.inputs.size(); i++)
         {
@@ -239,6 +239,7 @@ public:
 };
 
 JitConstants MakeActivationJitConstants(const base_activation_params& params, const std::string& suffix="");
+JitConstants MakeFusedActivationsJitConstants(const base_activation_params& params, const std::vector<base_activation_params>& fused_activations);
 JitConstants MakeBaseParamsJitConstants(const base_params& params);
 JitConstants MakeLoopUnrollParamsJitConstants(uint32_t loopCount);
 JitConstants MakeUnitTypeJitConstants(Datatype dataType);
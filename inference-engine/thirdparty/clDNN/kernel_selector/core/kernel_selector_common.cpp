@@ -333,6 +333,7 @@ namespace kernel_selector
         case WeightsLayout::is_o32_yx_isv32_swizzled_by_4: return "IS_O32_YX_ISV32_SWIZZLED_BY_4";
         case WeightsLayout::os_is_y_x8_osv8_isv4: return "OS_IS_Y_X8_OSV8_ISV4";
         case WeightsLayout::os_is_yx_osv16_isv4:  return "OS_IS_YX_OSV16_ISV4";
+        case WeightsLayout::winograd_4x4_3x3_s1_weights: return "WINOGRAD_4x4_3x3_S1_WEIGHTS";
 
         default:
             return "";
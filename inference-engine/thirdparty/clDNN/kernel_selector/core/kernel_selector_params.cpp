@@ -580,6 +580,10 @@ namespace kernel_selector {
         std::stringstream s;
         s << Params::to_string() << "_";
         s << activation.to_string() << "_";
+        for (const auto& fused : fused_activations)
+        {
+            s << fused.to_string() << "_";
+        }
 
         for (auto input : inputs)
         {
@@ -187,6 +187,11 @@ namespace kernel_selector
                         struct lstm_elt_t {
                             uint32_t cell : 1;
                         } lstm_elt;
+                        struct lstm_seq_t {
+                            uint32_t bias : 1;
+                            uint32_t hidden : 1;
+                            uint32_t cell : 1;
+                        } lstm_seq;
                         struct fused_conv_eltw_t {
                             // conv
                             uint32_t split : 1;
@@ -316,6 +321,9 @@ namespace kernel_selector
         void EnableLSTMGEMMBias() { key.restrict.val.dedicated.lstm_gemm.bias = 1; }
         void EnableLSTMGEMMHidden() { key.restrict.val.dedicated.lstm_gemm.hidden = 1; }
         void EnableLSTMEltCell() { key.restrict.val.dedicated.lstm_elt.cell = 1; }
+        void EnableLSTMSeqBias() { key.restrict.val.dedicated.lstm_seq.bias = 1; }
+        void EnableLSTMSeqHidden() { key.restrict.val.dedicated.lstm_seq.hidden = 1; }
+        void EnableLSTMSeqCell() { key.restrict.val.dedicated.lstm_seq.cell = 1; }
         void EnableConcatKernelPerInput() { key.restrict.val.dedicated.concat.kernelPerInput = 1; }
         void DisableTuning() { key.enableTuning = 0; }
         void EnableConcatOneKernel() { key.restrict.val.dedicated.concat.oneKernel = 1; }
@@ -406,6 +414,8 @@ namespace kernel_selector
         virtual ~base_params() {}
 
         base_activation_params activation;
+        // the elementwise operations fused after the activation, they are applied in turn by the ACTIVATION macro
+        std::vector<base_activation_params> fused_activations;
         MultiDataTensor        inputs;
         DataTensor             output;
         bool                   gradient = false;
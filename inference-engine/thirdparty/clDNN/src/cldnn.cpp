@@ -181,7 +181,7 @@ uint32_t cldnn_get_engine_count(/*cldnn_engine_type*/ int32_t type, cldnn_status
     if (type == cldnn_engine_type::cldnn_engine_ocl)
     {
         if (status) *status = CLDNN_SUCCESS;
-        return 1;
+        return cldnn::engine_impl::get_device_count();
     }
     else
     {
@@ -201,7 +201,7 @@ void cldnn_release_pending_memory(cldnn_engine engine, cldnn_status* status)
 
 cldnn_engine cldnn_create_engine(/*cldnn_engine_type*/ int32_t type, uint32_t engine_num, const cldnn_engine_configuration* configuration, cldnn_status* status)
 {
-    if (engine_num > 0 || (type != cldnn_engine_type::cldnn_engine_ocl))
+    if (type != cldnn_engine_type::cldnn_engine_ocl)
     {
         if (status)
             *status = CLDNN_DEVICE_ERROR;
@@ -210,7 +210,7 @@ cldnn_engine cldnn_create_engine(/*cldnn_engine_type*/ int32_t type, uint32_t en
 
     return exception_handler<cldnn_engine>(CLDNN_ERROR, status, nullptr, [&]()
     {
-        return api_cast(new cldnn::engine_impl(configuration ? cldnn::engine_configuration(*configuration) : cldnn::engine_configuration()));
+        return api_cast(new cldnn::engine_impl(configuration ? cldnn::engine_configuration(*configuration) : cldnn::engine_configuration(), engine_num));
     });
 }
 
@@ -234,7 +234,7 @@ void cldnn_release_engine(cldnn_engine engine, cldnn_status* status)
 
 cldnn_engine_info cldnn_get_engine_info(cldnn_engine engine, cldnn_status* status)
 {
-    return exception_handler<cldnn_engine_info>(CLDNN_ERROR, status, { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, [&]() -> cldnn_engine_info
+    return exception_handler<cldnn_engine_info>(CLDNN_ERROR, status, { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, [&]() -> cldnn_engine_info
     {
         SHOULD_NOT_BE_NULL(engine, "Engine");
         auto info = api_cast(engine)->get_engine_info();
@@ -251,7 +251,10 @@ cldnn_engine_info cldnn_get_engine_info(cldnn_engine engine, cldnn_status* statu
             info.supports_fp16,
             info.supports_fp16_denorms,
             info.supports_subgroups_short,
-            info.supports_image
+            info.supports_image,
+            info.supports_imad,
+            info.supports_immad,
+            info.supports_host_unified_memory
        };
     });
 }
@@ -267,19 +270,62 @@ cldnn_engine_info cldnn_get_engine_info(cldnn_engine engine, cldnn_status* statu
 
 int64_t cldnn_get_max_used_device_memory_size(cldnn_engine engine, cldnn_status* status)
 {
-    return exception_handler<int32_t>(CLDNN_ERROR, status, cldnn_engine_ocl, [&]()
+    return exception_handler<int64_t>(CLDNN_ERROR, status, 0, [&]()
     {
         SHOULD_NOT_BE_NULL(engine, "Engine");
-        return static_cast<int32_t>(api_cast(engine)->get_max_used_device_memory());
+        return static_cast<int64_t>(api_cast(engine)->get_max_used_device_memory());
     });
 }
 
 int64_t cldnn_get_temp_used_device_memory_size(cldnn_engine engine, cldnn_status* status)
 {
-    return exception_handler<int32_t>(CLDNN_ERROR, status, cldnn_engine_ocl, [&]()
+    return exception_handler<int64_t>(CLDNN_ERROR, status, 0, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        return static_cast<int64_t>(api_cast(engine)->get_used_device_memory());
+    });
+}
+
+void cldnn_get_engine_program_binary_names(cldnn_engine engine, char* names, size_t size, size_t* size_ret, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        auto&& binary_names = api_cast(engine)->get_program_binary_names();
+        primitive_id_vector_to_char_array(names, size, size_ret, status, binary_names);
+    });
+}
+
+void cldnn_get_engine_program_binary(cldnn_engine engine, const char* name, void* binary, size_t size, size_t* size_ret, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        SHOULD_NOT_BE_NULL(name, "Name");
+        SHOULD_NOT_BE_NULL(size_ret, "Size");
+        auto program_binary = api_cast(engine)->get_program_binary(name);
+        *size_ret = program_binary.size();
+
+        if (size < *size_ret)
+        {
+            if (status) *status = CLDNN_INVALID_ARG;
+            return;
+        }
+        if (!program_binary.empty())
+            std::copy(program_binary.begin(), program_binary.end(), static_cast<unsigned char*>(binary));
+    });
+}
+
+void cldnn_add_engine_program_binary(cldnn_engine engine, const char* name, const void* binary, size_t size, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
     {
         SHOULD_NOT_BE_NULL(engine, "Engine");
-        return static_cast<int32_t>(api_cast(engine)->get_used_device_memory());
+        SHOULD_NOT_BE_NULL(name, "Name");
+        SHOULD_NOT_EQUAL_0(size, "Binary size");
+        SHOULD_NOT_BE_NULL(binary, "Binary");
+        auto data = static_cast<const unsigned char*>(binary);
+        api_cast(engine)->add_program_binary(name, std::vector<unsigned char>(data, data + size));
     });
 }
 
@@ -425,6 +471,16 @@ cldnn_network cldnn_allocate_network(cldnn_program program, cldnn_status* status
     });
 }
 
+cldnn_network cldnn_allocate_network_on_stream(cldnn_program program, uint16_t stream_id, cldnn_status* status)
+{
+    return exception_handler<cldnn_network>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(program, "Program");
+        network_impl* p = api_cast(program)->get_engine().allocate_network(*api_cast(program), false, stream_id).detach();
+        return api_cast(p);
+    });
+}
+
 cldnn_network cldnn_build_network(cldnn_engine engine, cldnn_topology topology, cldnn_build_option* options, size_t options_num, cldnn_status* status)
 {
     cldnn_program program = cldnn_build_program(engine, topology, options, options_num, status);
@@ -502,6 +558,15 @@ cldnn_program cldnn_get_network_program(cldnn_network network, cldnn_status* sta
     });
 }
 
+int64_t cldnn_get_network_used_device_memory_size(cldnn_network network, cldnn_status* status)
+{
+    return exception_handler<int64_t>(CLDNN_ERROR, status, 0, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        return static_cast<int64_t>(api_cast(network)->get_used_device_memory_size());
+    });
+}
+
 void cldnn_get_primitive_info(cldnn_network network, cldnn_primitive_id prim_id, char* info, size_t size, size_t* size_ret, cldnn_status* status)
 {
     return exception_handler(CLDNN_ERROR, status, [&]()
@@ -662,6 +727,50 @@ cldnn_memory cldnn_attach_memory(cldnn_layout layout, void* pointer, size_t size
     });
 }
 
+cldnn_memory cldnn_share_host_memory(cldnn_engine engine, cldnn_layout layout, void* pointer, size_t size, cldnn_status* status)
+{
+    return exception_handler<cldnn_memory>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        SHOULD_NOT_BE_NULL(pointer, "Pointer");
+        cldnn::layout layout_obj(layout);
+        if (layout_obj.bytes_count() > size)
+            throw std::invalid_argument("buffer size does not match layout size");
+        return api_cast(api_cast(engine)->share_host_memory(layout_obj, pointer).detach());
+    });
+}
+
+cldnn_event cldnn_write_memory_async(cldnn_memory memory, const void* pointer, size_t size, cldnn_status* status)
+{
+    return exception_handler<cldnn_event>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(memory, "Memory");
+        SHOULD_NOT_BE_NULL(pointer, "Pointer");
+        auto& mem = *api_cast(memory);
+        if (mem.get_engine() == nullptr)
+            throw std::invalid_argument("memory is not allocated by an engine");
+        if (mem.size() != size)
+            throw std::invalid_argument("buffer size does not match memory size");
+        return api_cast(mem.get_engine()->write_memory_async(mem, pointer).detach());
+    });
+}
+
+cldnn_event cldnn_read_memory_async(cldnn_network network, cldnn_memory memory, void* pointer, size_t size, cldnn_status* status)
+{
+    return exception_handler<cldnn_event>(CLDNN_ERROR, status, nullptr, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        SHOULD_NOT_BE_NULL(memory, "Memory");
+        SHOULD_NOT_BE_NULL(pointer, "Pointer");
+        auto& mem = *api_cast(memory);
+        if (!mem.is_allocated_by(api_cast(network)->get_engine()))
+            throw std::invalid_argument("memory is not allocated by the engine of the network");
+        if (mem.size() != size)
+            throw std::invalid_argument("buffer size does not match memory size");
+        return api_cast(api_cast(network)->get_engine().read_memory_async(mem, pointer, api_cast(network)->get_stream_id()).detach());
+    });
+}
+
 CLDNN_API int32_t cldnn_is_the_same_buffer(cldnn_memory mem1, cldnn_memory mem2, cldnn_status* status)
 {
     return static_cast<int32_t>(exception_handler<bool>(CLDNN_ERROR, status, false, [&]()
@@ -848,3 +957,4 @@ PRIMITIVE_TYPE_ID_CALL_IMPL(depth_to_space)
 PRIMITIVE_TYPE_ID_CALL_IMPL(shuffle_channels)
 PRIMITIVE_TYPE_ID_CALL_IMPL(strided_slice)
 PRIMITIVE_TYPE_ID_CALL_IMPL(reverse_sequence)
+PRIMITIVE_TYPE_ID_CALL_IMPL(nv12_to_bgr)
@@ -28,6 +28,13 @@ primitive_type_id detection_output_type_id()
     return &instance;
 }
 
+bool detection_output_node::runs_on_gpu() const
+{
+    auto desc = get_primitive();
+    return get_program().get_options().get<build_option_type::detection_output_gpu>()->enabled() &&
+           !desc->decrease_label_id && !desc->clip_before_nms && !desc->clip_after_nms;
+}
+
 layout detection_output_inst::calc_output_layout(detection_output_node const& node)
 {
     assert((bool)node.get_primitive()->output_data_type == false
@@ -64,7 +71,7 @@ layout detection_output_inst::calc_output_layout(detection_output_node const& no
     // Add space for number of output results per image - needed in the next detection output step
     output_size += ((input_layout.size.batch[0] + 15) / 16) * 16;
 
-    if (node.get_program().get_options().get<build_option_type::detection_output_gpu>()->enabled())
+    if (node.runs_on_gpu())
     {
         return{ input_layout.data_type, cldnn::format::bfyx, cldnn::tensor(1, 1, 1, output_size) };
     }
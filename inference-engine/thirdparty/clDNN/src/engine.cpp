@@ -22,6 +22,9 @@
 #include "gpu/ocl_toolkit.h"
 #include "gpu/memory_gpu.h"
 #include "gpu/ocl_user_event.h"
+#include "gpu/ocl_builder.h"
+
+#include <cstring>
 
 namespace cldnn
 {
@@ -42,15 +45,38 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf)
     result.throttle_mode = static_cast<cldnn_throttle_mode_type>(conf.throttle_mode);
     result.user_context = static_cast<cl::Context*>(conf.context);
     result.tuning_cache_path = conf.tuning_cache_path;
+    result.kernels_cache_dir = conf.kernels_cache_dir;
+    if (conf.n_build_threads != 0)
+        result.n_build_threads = conf.n_build_threads;
+    if (conf.n_streams != 0)
+        result.n_streams = conf.n_streams;
+    return result;
+}
+
+static gpu_toolkit_config convert_configuration(const engine_configuration conf, uint32_t engine_num)
+{
+    auto result = convert_configuration(conf);
+    result.device_id = static_cast<uint16_t>(engine_num);
     return result;
 }
 
-engine_impl::engine_impl(const engine_configuration& conf)
+engine_impl::engine_impl(const engine_configuration& conf, uint32_t engine_num)
     : _configuration(conf)
-    , _context(gpu_toolkit::create(convert_configuration(conf)))
+    , _context(gpu_toolkit::create(convert_configuration(conf, engine_num)))
     , _memory_pool(*this)
 { }
 
+uint32_t engine_impl::get_device_count()
+{
+    try {
+        return static_cast<uint32_t>(gpu::ocl_builder::count_devices(convert_configuration(engine_configuration())));
+    }
+    catch (...) {
+        // no OpenCL platforms
+        return 0;
+    }
+}
+
 engine_impl::~engine_impl()
 { 
     /*
@@ -65,10 +91,10 @@ memory_impl::ptr engine_impl::allocate_memory(layout layout)
     return _memory_pool.get_memory(layout);
 }
 
-memory_impl::ptr engine_impl::allocate_memory(layout layout, primitive_id id, uint32_t network_id, std::set<primitive_id> dependencies, bool reusable)
+memory_impl::ptr engine_impl::allocate_memory(layout layout, primitive_id id, uint32_t network_id, std::set<primitive_id> dependencies, bool reusable, uint16_t stream_id)
 {
     if (use_memory_pool())
-        return _memory_pool.get_memory(layout, id, network_id, dependencies, reusable);
+        return _memory_pool.get_memory(layout, id, network_id, dependencies, reusable, stream_id);
     return _memory_pool.get_memory(layout);
 }
 
@@ -94,6 +120,21 @@ memory_impl::ptr engine_impl::reinterpret_buffer(const memory_impl& memory, layo
     }
 }
 
+memory_impl::ptr engine_impl::share_host_memory(layout layout, void* pointer)
+{
+    if (layout.format.is_image())
+        throw error("trying to share host memory as image", CLDNN_ERROR);
+
+    try {
+        // the device works on the host memory directly if it is unified with the device memory
+        cl::Buffer buffer(_context->context(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, layout.bytes_count(), pointer);
+        return{ new gpu::gpu_buffer(this, layout, buffer), false };
+    }
+    catch (cl::Error const& err) {
+        throw gpu::ocl_error(err);
+    }
+}
+
 bool engine_impl::is_the_same_buffer(const memory_impl& mem1, const memory_impl& mem2)
 {
     if (mem1.get_engine() != this || mem2.get_engine() != this)
@@ -104,19 +145,57 @@ bool engine_impl::is_the_same_buffer(const memory_impl& mem1, const memory_impl&
     return (reinterpret_cast<const gpu::gpu_buffer&>(mem1).get_buffer() == reinterpret_cast<const gpu::gpu_buffer&>(mem2).get_buffer());
 }
 
-event_impl::ptr engine_impl::create_user_event(bool set)
+event_impl::ptr engine_impl::write_memory_async(memory_impl& memory, const void* pointer)
+{
+    if (auto buffer = dynamic_cast<gpu::gpu_buffer*>(&memory))
+        return _context->enqueue_write_buffer(buffer->get_buffer(), pointer, memory.size());
+
+    // the images and the memory of the user are copied by the host
+    mem_lock<char> dst(memory);
+    std::memcpy(dst.data(), pointer, memory.size());
+    return create_user_event(true);
+}
+
+event_impl::ptr engine_impl::read_memory_async(memory_impl& memory, void* pointer, uint16_t stream_id)
+{
+    if (auto buffer = dynamic_cast<gpu::gpu_buffer*>(&memory))
+        return _context->enqueue_read_buffer(stream_id, buffer->get_buffer(), pointer, memory.size());
+
+    _context->queue(stream_id).finish();
+    mem_lock<char> src(memory);
+    std::memcpy(pointer, src.data(), memory.size());
+    return create_user_event(true, stream_id);
+}
+
+memory_impl::ptr engine_impl::get_reordered_weights(memory_impl& source, const std::string& reorder_key)
+{
+    std::lock_guard<std::mutex> lock(_reordered_weights_mutex);
+    auto it = source._reordered_weights.find(reorder_key);
+    if (it == source._reordered_weights.end())
+        return nullptr;
+    return it->second;
+}
+
+void engine_impl::add_reordered_weights(memory_impl& source, const std::string& reorder_key, memory_impl& reordered)
+{
+    // the reordered weights live as long as the source, so the weights of an unloaded network are released with it
+    std::lock_guard<std::mutex> lock(_reordered_weights_mutex);
+    source._reordered_weights[reorder_key] = memory_impl::ptr(&reordered);
+}
+
+event_impl::ptr engine_impl::create_user_event(bool set, uint16_t stream_id)
 {
     try {
-        return _context->create_user_event(set);
+        return _context->create_user_event(set, stream_id);
     }
     catch (cl::Error const& err) {
         throw gpu::ocl_error(err);
     }
 }
 
-void engine_impl::flush_network()
+void engine_impl::flush_network(uint16_t stream_id)
 { 
-    get_context()->flush();
+    get_context()->flush(stream_id);
 }
 
 void engine_impl::release_pending_memory()
@@ -144,9 +223,11 @@ network_impl::ptr engine_impl::build_network(const std::set<std::shared_ptr<prog
     return{ new network_impl(*this, nodes, options, is_internal), false };
 }
 
-network_impl::ptr engine_impl::allocate_network(const program_impl& program, bool is_internal)
+network_impl::ptr engine_impl::allocate_network(const program_impl& program, bool is_internal, uint16_t stream_id)
 {
-    return{ new network_impl(program, is_internal), false };
+    if (stream_id >= _context->get_streams_count())
+        throw error("the stream id " + std::to_string(stream_id) + " is out of the engine streams count", CLDNN_INVALID_ARG);
+    return{ new network_impl(program, is_internal, stream_id), false };
 }
 
 void engine_impl::wait_for_events(std::vector<event_impl::ptr> const & events)
@@ -168,6 +249,21 @@ void engine_impl::compile_program(program_impl& program)
     _context->get_kernels_cache().build_all();
 }
 
+std::vector<std::string> engine_impl::get_program_binary_names() const
+{
+    return _context->get_kernels_cache().get_program_binary_names();
+}
+
+std::vector<unsigned char> engine_impl::get_program_binary(const std::string& name) const
+{
+    return _context->get_kernels_cache().get_program_binary(name);
+}
+
+void engine_impl::add_program_binary(const std::string& name, std::vector<unsigned char> binary)
+{
+    _context->get_kernels_cache().add_program_binary(name, std::move(binary));
+}
+
 bool engine_impl::use_memory_pool() const
 {
     if (configuration().enable_memory_pool && get_context()->is_neo_driver())
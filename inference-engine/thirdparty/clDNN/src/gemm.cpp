@@ -20,6 +20,8 @@
 #include "error_handler.h"
 #include "json_object.h"
 
+#include <algorithm>
+
 namespace cldnn
 {
 primitive_type_id gemm_type_id()
@@ -37,18 +39,20 @@ layout gemm_inst::calc_output_layout(gemm_node const& node)
     auto input2_layout = node.input(1).get_output_layout();
     bool transpose_input1 = node.get_primitive()->transpose_input1;
     bool transpose_input2 = node.get_primitive()->transpose_input2;
+    // an input with a single batch is multiplied by every batch of the other one
+    auto batch = std::max(input1_layout.size.batch[0], input2_layout.size.batch[0]);
 
     if (!transpose_input1 && !transpose_input2)
-        return layout(input1_layout.data_type, format::bfyx, tensor(input1_layout.size.batch[0],  1, 
+        return layout(input1_layout.data_type, format::bfyx, tensor(batch,  1, 
                       input2_layout.size.spatial[0], input1_layout.size.spatial[1]));
     else if (!transpose_input1 && transpose_input2)
-        return layout(input1_layout.data_type, format::bfyx, tensor(input1_layout.size.batch[0], 1,
+        return layout(input1_layout.data_type, format::bfyx, tensor(batch, 1,
             input2_layout.size.spatial[1], input1_layout.size.spatial[1]));
     else if (transpose_input1 && !transpose_input2)
-        return layout(input1_layout.data_type, format::bfyx, tensor(input1_layout.size.batch[0], 1,
+        return layout(input1_layout.data_type, format::bfyx, tensor(batch, 1,
             input2_layout.size.spatial[0], input1_layout.size.spatial[0]));
     else
-        return layout(input1_layout.data_type, format::bfyx, tensor(input1_layout.size.batch[0], 1,
+        return layout(input1_layout.data_type, format::bfyx, tensor(batch, 1,
             input2_layout.size.spatial[1], input1_layout.size.spatial[0]));
     
 }
@@ -85,6 +89,9 @@ gemm_inst::typed_primitive_inst(network_impl& network, gemm_node const& node)
     bool transpose_input1 = node.get_primitive()->transpose_input1;
     bool transpose_input2 = node.get_primitive()->transpose_input2;
 
+    if (input_layout.size.batch[0] != 1 && input2_layout.size.batch[0] != 1)
+        CLDNN_ERROR_NOT_EQUAL(node.id(), "Input1 Batch size", input_layout.size.batch[0], "Input2 Batch size", input2_layout.size.batch[0], "");
+
     if (!transpose_input1 && !transpose_input2)
     {
         CLDNN_ERROR_NOT_EQUAL(node.id(), "Input1 Columns count", input_layout.size.spatial[0], "Input2 Rows count", input2_layout.size.spatial[1], "");
@@ -35,7 +35,7 @@ struct condition_gpu : typed_primitive_impl<condition>
         {
             a->wait();
         }
-        auto ev = instance.get_network().get_engine().create_user_event(false);
+        auto ev = instance.get_network().get_engine().create_user_event(false, instance.get_network().get_stream_id());
 
         bool exec_branch = choose_branch_to_exec(instance);
         memory_impl::ptr memory_to_copy;
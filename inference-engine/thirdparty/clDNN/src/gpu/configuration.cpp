@@ -16,6 +16,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "confiugration.h"
+#include <algorithm>
+#include <thread>
 
 namespace cldnn {
     namespace gpu {
@@ -32,6 +34,10 @@ namespace cldnn {
             , ocl_sources_dumps_dir("")
             , user_context(nullptr)            
             , tuning_cache_path("cache.json")        
+            , kernels_cache_dir("")
+            , n_build_threads(static_cast<uint16_t>(std::max(std::thread::hardware_concurrency(), 1u)))
+            , n_streams(1)
+            , device_id(0)
         {}
     }
 }
@@ -45,6 +45,11 @@ namespace cldnn {
             cldnn_throttle_mode_type throttle_mode;
             cl::Context* user_context;
             std::string tuning_cache_path;
+            std::string kernels_cache_dir;
+            uint16_t n_build_threads;
+            uint16_t n_streams;
+            // the index of the device among the ones matching the configuration
+            uint16_t device_id;
         };
     }
 }
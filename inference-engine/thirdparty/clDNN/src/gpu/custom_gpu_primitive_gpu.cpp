@@ -55,8 +55,9 @@ struct custom_gpu_primitive_gpu : typed_primitive_impl<custom_gpu_primitive>
             args.inputs.push_back(&(dep->output_memory()));
         }
         args.output = &instance.output_memory();
-        _kernel.set_output_event(instance.node.is_output());
-        return _kernel.run(*cl_kernel.get(), events, args);
+        const auto stream_id = instance.get_network().get_stream_id();
+        _kernel.set_output_event(stream_id, instance.node.is_output());
+        return _kernel.run(stream_id, *cl_kernel.get(), events, args);
     }
 };
 
@@ -209,6 +210,9 @@ static primitive_impl* create(const custom_gpu_primitive_node& arg)
     {
         cl_kernel->kernelString->str += s + "\n";
     }
+    // the defines of the layer are undefined after its source, so the custom kernels are built in the shared
+    // programs with the other kernels, the same binaries are taken from the cache
+    cl_kernel->kernelString->batch_compilation = true;
 
     cl_kernel->workGroups.global = primitive->gws;
     cl_kernel->workGroups.local = primitive->lws;
@@ -613,7 +613,7 @@ struct detection_output_cpu : typed_primitive_impl<detection_output>
             a->wait();
         }
 
-        auto ev = instance.get_network().get_engine().create_user_event(false);
+        auto ev = instance.get_network().get_engine().create_user_event(false, instance.get_network().get_stream_id());
 
         const int num_of_images = instance.location_memory().get_layout().size.batch[0]; //batch size
 
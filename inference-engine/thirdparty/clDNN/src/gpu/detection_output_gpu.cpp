@@ -64,7 +64,7 @@ public:
 
     static primitive_impl* create(const detection_output_node& arg)
     {
-        if (!arg.get_program().get_options().get<build_option_type::detection_output_gpu>()->enabled())
+        if (!arg.runs_on_gpu())
         {
             return runDetectOutCpu(arg);
         }
@@ -35,12 +35,14 @@ namespace cldnn {
 
             using type = Type;
 
-            event_impl::ptr get_from_pool(std::shared_ptr<gpu_toolkit>& ctx)
+            // the events are handed out in turn after a reset, so the search starts after the last one taken and an
+            // event which is not attached yet, like an unset user event, is not handed out twice
+            event_impl::ptr get_from_pool(const std::shared_ptr<gpu_toolkit>& ctx)
             {
-                for (auto& ev : _events)
+                for (; _next < _events.size(); _next++)
                 {
-                    if (!ev->is_valid())
-                        return ev;
+                    if (!_events[_next]->is_valid())
+                        return _events[_next++];
                 }
                 return allocate({ new Type(ctx), false });
             }
@@ -49,21 +51,24 @@ namespace cldnn {
             {
                 for (auto& ev : _events)
                     ev->reset();
+                _next = 0;
             }
 
         private:
             std::vector<event_impl::ptr> _events;
+            size_t _next = 0;
 
             event_impl::ptr allocate(const event_impl::ptr& obj)
             {
                 _events.emplace_back(obj);
+                _next = _events.size();
                 return _events.back();
             }
         };
 
         struct base_event_pool : event_pool_impl<base_event>
         {
-            event_impl::ptr get(std::shared_ptr<gpu_toolkit>& ctx, const cl::Event& ev, const uint64_t q_stamp)
+            event_impl::ptr get(const std::shared_ptr<gpu_toolkit>& ctx, const cl::Event& ev, const uint64_t q_stamp)
             {
                 auto ret = get_from_pool(ctx);
                 dynamic_cast<type*>(ret.get())->attach_ocl_event(ev, q_stamp);
@@ -77,7 +82,7 @@ namespace cldnn {
 
         struct user_event_pool : event_pool_impl<user_event>
         {
-            event_impl::ptr get(std::shared_ptr<gpu_toolkit>& ctx, bool set = false)
+            event_impl::ptr get(const std::shared_ptr<gpu_toolkit>& ctx, bool set = false)
             {
                 auto ret = get_from_pool(ctx);
                 dynamic_cast<type*>(ret.get())->attach_event(set);
@@ -91,7 +96,7 @@ namespace cldnn {
 
         struct group_event_pool : event_pool_impl<base_events>
         {
-            event_impl::ptr get(std::shared_ptr<gpu_toolkit>& ctx, const std::vector<event_impl::ptr>& deps)
+            event_impl::ptr get(const std::shared_ptr<gpu_toolkit>& ctx, const std::vector<event_impl::ptr>& deps)
             {
                 auto ret_ev = get_from_pool(ctx);
                 dynamic_cast<type*>(ret_ev.get())->attach_events(deps);
@@ -108,17 +113,17 @@ namespace cldnn {
         public:
             events_pool() = default;
 
-            event_impl::ptr get_from_base_pool(std::shared_ptr<gpu_toolkit> ctx, const cl::Event& ev, const uint64_t q_stamp)
+            event_impl::ptr get_from_base_pool(const std::shared_ptr<gpu_toolkit>& ctx, const cl::Event& ev, const uint64_t q_stamp)
             {
                 return _base_pool.get(ctx, ev, q_stamp);
             }
 
-            event_impl::ptr get_from_user_pool(std::shared_ptr<gpu_toolkit> ctx, bool set = false)
+            event_impl::ptr get_from_user_pool(const std::shared_ptr<gpu_toolkit>& ctx, bool set = false)
             {
                 return _user_pool.get(ctx, set);
             }
 
-            event_impl::ptr get_from_group_pool(std::shared_ptr<gpu_toolkit> ctx, const std::vector<event_impl::ptr>& deps)
+            event_impl::ptr get_from_group_pool(const std::shared_ptr<gpu_toolkit>& ctx, const std::vector<event_impl::ptr>& deps)
             {
                 return _group_pool.get(ctx, deps);
             }
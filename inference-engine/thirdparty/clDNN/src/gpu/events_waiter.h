@@ -26,12 +26,12 @@ public:
     explicit events_waiter(std::shared_ptr<gpu_toolkit> context) : context_holder(context)
     {}
 
-    event_impl::ptr run(const std::vector<event_impl::ptr>& dependencies)
+    event_impl::ptr run(uint16_t stream_id, const std::vector<event_impl::ptr>& dependencies)
     {
         if (dependencies.size() == 1)
             return dependencies[0];
 
-        return context()->enqueue_marker(dependencies);
+        return context()->enqueue_marker(stream_id, dependencies);
     }
 };
 }}
\ No newline at end of file
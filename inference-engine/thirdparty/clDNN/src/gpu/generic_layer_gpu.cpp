@@ -48,8 +48,9 @@ struct generic_layer_gpu : typed_primitive_impl<generic_layer>
             args.inputs.push_back(&instance.input_memory(i));
         }
         args.output = &instance.output_memory();
-        _kernel.set_output_event(instance.node.is_output());
-        return _kernel.run(_cl_kernel_data, events, args);
+        const auto stream_id = instance.get_network().get_stream_id();
+        _kernel.set_output_event(stream_id, instance.node.is_output());
+        return _kernel.run(stream_id, _cl_kernel_data, events, args);
     }
 };
 
@@ -78,7 +79,7 @@ struct generic_layer_cpu : typed_primitive_impl<generic_layer>
 
         cpu_kernel.Execute(old_pointer.data(), old_pointer.size(), new_pointer.data(), new_pointer.size());
 
-        return instance.get_network().get_engine().create_user_event(true);
+        return instance.get_network().get_engine().create_user_event(true, instance.get_network().get_stream_id());
     }
 };
 
@@ -16,7 +16,10 @@
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <cstring>
 #include <iterator>
+#include <mutex>
+#include <type_traits>
 #include "kernel.h"
 #include "memory_gpu.h"
 
@@ -38,8 +41,53 @@ namespace {
         }
     }
 
+    // sets the arguments of a kernel skipping the ones which already have the same value
+    class argument_binder
+    {
+    public:
+        argument_binder(cl::Kernel& kernel, kernels_cache::bound_arguments* bound)
+            : _kernel(kernel)
+            , _bound(bound)
+        {}
+
+        cl_int setArg(uint32_t index, const cl::Memory& memory)
+        {
+            cl_mem handle = memory();
+            return set(index, sizeof(handle), &handle);
+        }
+
+        template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+        cl_int setArg(uint32_t index, T value)
+        {
+            return set(index, sizeof(value), &value);
+        }
+
+    private:
+        cl_int set(uint32_t index, size_t size, const void* value)
+        {
+            if (_bound == nullptr)
+                return clSetKernelArg(_kernel(), index, size, value);
+
+            kernels_cache::bound_argument argument;
+            argument.size = size;
+            std::memcpy(&argument.value, value, size);
+            if (index < _bound->size() && (*_bound)[index] == argument)
+                return CL_SUCCESS;
+
+            const cl_int status = clSetKernelArg(_kernel(), index, size, value);
+            if (index >= _bound->size())
+                _bound->resize(index + 1);
+            // a failed argument is forgotten, so it is set again on the next run
+            (*_bound)[index] = status == CL_SUCCESS ? argument : kernels_cache::bound_argument();
+            return status;
+        }
+
+        cl::Kernel& _kernel;
+        kernels_cache::bound_arguments* _bound;
+    };
+
     void set_arguments(
-        cl::Kernel& kernel,
+        argument_binder& kernel,
         const kernel_selector::kernel_arguments& args,
         const kernel::kernel_arguments_data& data)
     {
@@ -231,19 +279,31 @@ namespace {
 }
 
 event_impl::ptr kernel::run(
+    uint16_t stream_id,
     const kernel_selector::cl_kernel_data& kernel_data,
     const std::vector<event_impl::ptr>& dependencies,
     const kernel_arguments_data& args) const
 {
-    auto clkernel = context()->get_kernels_cache().get_kernel(_kernel_id, _one_time_kernel);
+    // the arguments are captured by the enqueue, so the lock is only needed for the networks of other streams
+    std::unique_lock<std::mutex> lock(context()->get_enqueue_mutex(), std::defer_lock);
+    if (context()->get_streams_count() > 1)
+        lock.lock();
+    if (_cl_kernel() == nullptr)
+    {
+        _cl_kernel = context()->get_kernels_cache().get_kernel(_kernel_id, _one_time_kernel);
+        if (!_one_time_kernel)
+            _bound_arguments = context()->get_kernels_cache().get_bound_arguments(_kernel_id);
+    }
+    auto& clkernel = _cl_kernel;
     try {
-        set_arguments(clkernel, kernel_data.arguments, args);
+        argument_binder binder(clkernel, _bound_arguments.get());
+        set_arguments(binder, kernel_data.arguments, args);
     }
     catch (cl::Error const& err) {
         throw ocl_error(err);
     }
 
-    return context()->enqueue_kernel(clkernel, toNDRange(kernel_data.workGroups.global), toNDRange(kernel_data.workGroups.local), dependencies);
+    return context()->enqueue_kernel(stream_id, clkernel, toNDRange(kernel_data.workGroups.global), toNDRange(kernel_data.workGroups.local), dependencies);
 }
 
 } }
\ No newline at end of file
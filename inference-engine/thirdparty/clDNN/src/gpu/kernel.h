@@ -30,6 +30,9 @@ class kernel : public context_holder
 {
     kernels_cache::kernel_id _kernel_id;
     bool _one_time_kernel; //If this flag is true, the kernel is intended to be executed only once (can be removed later from the cache).
+    // resolved on the first run, the later runs skip the cache lookup and set only the arguments which changed
+    mutable kernels_cache::kernel_type _cl_kernel;
+    mutable std::shared_ptr<kernels_cache::bound_arguments> _bound_arguments;
 
 public:
     explicit kernel(std::shared_ptr<gpu_toolkit> context, const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program = false, bool one_time_kernel = false)
@@ -49,6 +52,8 @@ public:
 
         _kernel_id = other._kernel_id;
         _one_time_kernel = other._one_time_kernel;
+        _cl_kernel = kernels_cache::kernel_type();
+        _bound_arguments.reset();
 
         return *this;
     }
@@ -77,9 +82,10 @@ public:
         const kernel_selector::kernel_scalar_arguments* scalars = nullptr;
     };
 
-    void set_output_event(bool is_out_event) { context()->set_output_event(is_out_event); }
+    void set_output_event(uint16_t stream_id, bool is_out_event) { context()->set_output_event(stream_id, is_out_event); }
 
     event_impl::ptr run(
+        uint16_t stream_id,
         const kernel_selector::cl_kernel_data& kernel_data,
         const std::vector<event_impl::ptr>& dependencies,
         const kernel_arguments_data& args) const;
@@ -147,7 +147,7 @@ std::vector<uint64_t> kernel_runner::run_kernels(const kernel_selector::KernelsD
                 event_impl::ptr event;
                 try
                 {
-                    event = kernels[i].run(it->kernels[0], {}, args);
+                    event = kernels[i].run(0, it->kernels[0], {}, args);
                 }
                 catch (...)
                 {
@@ -21,7 +21,12 @@
 #include <cassert>
 #include <sstream>
 #include <fstream>
+#include <iomanip>
+#include <iterator>
 #include <set>
+#include <cstdio>
+#include <thread>
+#include <exception>
 
 #include "kernel_selector_helper.h"
 
@@ -110,9 +115,103 @@ namespace {
             options.find("-D") == std::string::npos &&
             options.find("-I") == std::string::npos;
     }
+
+    // FNV-1a, unlike std::hash it gives the same file names in the different builds of the library
+    inline uint64_t hash_string(uint64_t hash, const std::string& str)
+    {
+        for (const auto c : str)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001b3ULL;
+        }
+        return hash;
+    }
+
+    // the binary depends on the sources, the build options and the compiler, which comes with the driver
+    std::string get_program_cache_file_name(const kernels_cache::source_code& sources, const std::string& options, const engine_info_internal& info)
+    {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (const auto& s : sources)
+            hash = hash_string(hash, s);
+        hash = hash_string(hash, options);
+        hash = hash_string(hash, info.dev_id);
+        hash = hash_string(hash, info.driver_version);
+
+        std::stringstream ss;
+        ss << "clDNN_program_" << std::hex << std::setfill('0') << std::setw(16) << hash << ".bin";
+        return ss.str();
+    }
+
+    std::vector<unsigned char> load_program_binary(const std::string& file_name)
+    {
+        std::ifstream file(file_name, std::ios::binary);
+        if (!file.good())
+            return {};
+        return std::vector<unsigned char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    // runs func(i) for i in [0, work_amount) on up to n_threads threads including the calling one
+    template <typename F>
+    void run_in_parallel(size_t n_threads, size_t work_amount, const F& func)
+    {
+        n_threads = std::min(n_threads, work_amount);
+        if (n_threads <= 1)
+        {
+            for (size_t i = 0; i < work_amount; i++)
+                func(i);
+            return;
+        }
+
+        std::atomic<size_t> next{ 0 };
+        std::exception_ptr error;
+        std::mutex error_mutex;
+        auto worker = [&]()
+        {
+            try
+            {
+                for (size_t i = next++; i < work_amount; i = next++)
+                    func(i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error)
+                    error = std::current_exception();
+                next = work_amount;
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < n_threads; t++)
+            threads.emplace_back(worker);
+        worker();
+        for (auto& t : threads)
+            t.join();
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    void save_program_binary(const std::string& file_name, const std::vector<unsigned char>& binary)
+    {
+        // the file is renamed only when it is complete, so another process never reads a partial binary
+        const std::string tmp_file_name = file_name + ".tmp";
+        {
+            std::ofstream file(tmp_file_name, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+            if (!file.good())
+            {
+                file.close();
+                std::remove(tmp_file_name.c_str());
+                return;
+            }
+        }
+        if (std::rename(tmp_file_name.c_str(), file_name.c_str()) != 0)
+            std::remove(tmp_file_name.c_str());
+    }
 }
 
-kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code& kernels_source_code) const 
+kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code& kernels_source_code, bool allow_batch_compilation) const 
 {
     sorted_code scode;
 
@@ -125,7 +224,7 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
         bool                dump_custom_program = code.second.dump_custom_program;
         bool                one_time_kernel     = code.second.one_time_kernel;
 
-        batch_compilation &= does_options_support_batch_compilation(options);
+        batch_compilation &= allow_batch_compilation && does_options_support_batch_compilation(options);
 
         if (batch_compilation)
         {
@@ -150,6 +249,17 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
             key += " __ONE_TIME__";
         }
 
+        // the kernels of a program have different entry points, the same custom kernel with other defines
+        // goes to the next program
+        if (batch_compilation)
+        {
+            const std::string program_key = key;
+            for (size_t n = 1; scode.count(key) && scode[key].entry_point_to_id.count(entry_point); n++)
+            {
+                key = program_key + " __NEXT_PROGRAM__" + std::to_string(n);
+            }
+        }
+
         auto& current_bucket = scode[key];
         current_bucket.dump_custom_program = dump_custom_program;
         current_bucket.one_time = one_time_kernel;
@@ -162,9 +272,11 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
         if ((current_bucket.kernels_counter % MAX_KERNELS_PER_PROGRAM) == 0)
         {
             current_bucket.source.push_back({});
+            current_bucket.part_kernels.push_back({});
         }
 
         current_bucket.entry_point_to_id[entry_point] = code.second.id;
+        current_bucket.part_kernels.back().push_back(code.first);
 
         source_code new_source_code = org_source_code;
 
@@ -214,7 +326,7 @@ kernels_cache::kernel_id kernels_cache::set_kernel_source(const std::shared_ptr<
     return id;
 }
 
-kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source) const
+std::string kernels_cache::get_dump_file_name(const program_code& program_source) const
 {
     static uint32_t current_file_index = 0;
 
@@ -229,75 +341,121 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
 
         dump_file_name += "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
     }
+    return dump_file_name;
+}
+
+kernels_cache::kernels_map kernels_cache::build_program_part(const program_code& program_source, uint32_t part_idx, const std::string& dump_file_name, std::string& err_log) const
+{
+    const auto& sources = program_source.source[part_idx];
+    bool dump_sources = !dump_file_name.empty();
+
+    std::string cache_dir = _context.get_configuration().kernels_cache_dir;
+    if (!cache_dir.empty() && cache_dir.back() != '/')
+        cache_dir += '/';
 
     try
     {
         kernels_map kmap;
-        std::string err_log; //accumulated build log from all program's parts (only contains messages from parts which failed to compile)
 
-        uint32_t part_idx = 0;
-        for (const auto& sources : program_source.source)
+        auto current_dump_file_name = dump_file_name + std::to_string(part_idx) + ".cl";
+        std::ofstream dump_file;
+
+        if (dump_sources)
         {
-            auto current_dump_file_name = dump_file_name + std::to_string(part_idx++) + ".cl";
-            std::ofstream dump_file;
+            dump_file.open(current_dump_file_name);
 
-            if (dump_sources)
+            if (dump_file.good())
             {
-                dump_file.open(current_dump_file_name);
+                for (auto& s : sources)
+                    dump_file << s;
+            }
+        }
+
+        try
+        {
+            cl::Program program;
+            bool loaded_from_cache = false;
+
+            const std::string binary_name = get_program_cache_file_name(sources, program_source.options, _context.get_engine_info());
+            const std::string cache_file_name = cache_dir.empty() ? std::string() : cache_dir + binary_name;
 
-                if (dump_file.good())
+            // the binaries added to the engine come first, then the ones cached on the disk
+            std::vector<unsigned char> binary = get_program_binary(binary_name);
+            bool binary_from_file = false;
+            if (binary.empty() && !cache_file_name.empty())
+            {
+                binary = load_program_binary(cache_file_name);
+                binary_from_file = !binary.empty();
+            }
+
+            if (!binary.empty())
+            {
+                // a stale or broken binary is not an error, the program is built from the sources then
+                try
+                {
+                    program = cl::Program(_context.context(), { _context.device() }, { binary });
+                    program.build({ _context.device() }, program_source.options.c_str());
+                    loaded_from_cache = true;
+                }
+                catch (const cl::Error&)
                 {
-                    for (auto& s : sources)
-                        dump_file << s;
+                    binary_from_file = false;
                 }
             }
 
-            try
+            if (!loaded_from_cache)
             {
-                cl::Program program(_context.context(), sources);
+                program = cl::Program(_context.context(), sources);
                 program.build({ _context.device() }, program_source.options.c_str());
+            }
+
+            auto binaries = program.getInfo<CL_PROGRAM_BINARIES>();
+            if (!binaries.empty())
+            {
+                if (!cache_file_name.empty() && !binary_from_file)
+                    save_program_binary(cache_file_name, binaries.front());
+
+                std::lock_guard<std::mutex> lock(_binaries_mutex);
+                _program_binaries[binary_name] = binaries.front();
                 ///Store kernels for serialization process.
-                _context.store_binaries(program.getInfo<CL_PROGRAM_BINARIES>());
+                if (_context.get_serialization_flag())
+                    _context.store_binaries(binaries);
+            }
 
-                if (dump_sources && dump_file.good())
-                {
-                    dump_file << "\n/* Build Log:\n";
-                    for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
-                        dump_file << p.second << "\n";
+            if (dump_sources && dump_file.good())
+            {
+                dump_file << "\n/* Build Log:\n";
+                for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
+                    dump_file << p.second << "\n";
 
-                    dump_file << "*/\n";
-                }
+                dump_file << "*/\n";
+            }
 
-                cl::vector<cl::Kernel> kernels;
-                program.createKernels(&kernels);
+            cl::vector<cl::Kernel> kernels;
+            program.createKernels(&kernels);
 
-                for (auto& k : kernels)
-                {
-                    auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
-                    kmap.emplace(kernel_name, k);
-                }
+            for (auto& k : kernels)
+            {
+                auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
+                kmap.emplace(kernel_name, k);
             }
-            catch (const cl::BuildError& err)
+        }
+        catch (const cl::BuildError& err)
+        {
+            if (dump_sources && dump_file.good())
+                dump_file << "\n/* Build Log:\n";
+
+            for (auto& p : err.getBuildLog())
             {
                 if (dump_sources && dump_file.good())
-                    dump_file << "\n/* Build Log:\n";
+                    dump_file << p.second << "\n";
 
-                for (auto& p : err.getBuildLog())
-                {
-                    if (dump_sources && dump_file.good())
-                        dump_file << p.second << "\n";
-                
-                    err_log += p.second + '\n';
-                }
-
-                if (dump_sources && dump_file.good())
-                    dump_file << "*/\n";
+                err_log += p.second + '\n';
             }
-            
-        }
 
-        if (!err_log.empty())
-            throw std::runtime_error("Program build failed:\n" + std::move(err_log));
+            if (dump_sources && dump_file.good())
+                dump_file << "*/\n";
+        }
 
         return kmap;
     }
@@ -320,6 +478,37 @@ kernels_cache::kernel_type kernels_cache::get_kernel(kernel_id id, bool one_time
     }
 }
 
+std::shared_ptr<kernels_cache::bound_arguments> kernels_cache::get_bound_arguments(kernel_id id)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& arguments = _bound_arguments[id];
+    if (!arguments)
+        arguments = std::make_shared<bound_arguments>();
+    return arguments;
+}
+
+std::vector<std::string> kernels_cache::get_program_binary_names() const
+{
+    std::lock_guard<std::mutex> lock(_binaries_mutex);
+    std::vector<std::string> names;
+    for (const auto& binary : _program_binaries)
+        names.push_back(binary.first);
+    return names;
+}
+
+std::vector<unsigned char> kernels_cache::get_program_binary(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(_binaries_mutex);
+    auto it = _program_binaries.find(name);
+    return it == _program_binaries.end() ? std::vector<unsigned char>() : it->second;
+}
+
+void kernels_cache::add_program_binary(const std::string& name, std::vector<unsigned char> binary)
+{
+    std::lock_guard<std::mutex> lock(_binaries_mutex);
+    _program_binaries[name] = std::move(binary);
+}
+
 void kernels_cache::build_all()
 {
     if (!_pending_compilation)
@@ -327,18 +516,74 @@ void kernels_cache::build_all()
 
     std::lock_guard<std::mutex> lock(_mutex);
 
+    // the parts of all the programs are independent, so they are built concurrently
+    struct program_part
+    {
+        program_code* program;
+        uint32_t part_idx;
+        std::string dump_file_name;
+        kernels_map kernels;
+        std::string err_log; //build log of the part (only contains messages if the part failed to compile)
+    };
+
+    auto build_parts = [this](sorted_code& sorted_program_code)
+    {
+        std::vector<program_part> parts;
+        for (auto& program : sorted_program_code)
+        {
+            auto dump_file_name = get_dump_file_name(program.second);
+            for (uint32_t part_idx = 0; part_idx < program.second.source.size(); part_idx++)
+                parts.push_back({ &program.second, part_idx, dump_file_name, {}, {} });
+        }
+
+        run_in_parallel(_context.get_configuration().n_build_threads, parts.size(), [&](size_t i)
+        {
+            auto& part = parts[i];
+            part.kernels = build_program_part(*part.program, part.part_idx, part.dump_file_name, part.err_log);
+        });
+        return parts;
+    };
+
     auto sorted_program_code = get_program_source(_kernels_code);
+    auto parts = build_parts(sorted_program_code);
 
-    _one_time_kernels.clear();
-    for (auto& program : sorted_program_code)
+    // the sources of the kernels batched into a program may clash (e.g. the helper functions of the custom
+    // kernels), the kernels of a failed part are built in the separate programs then
+    kernels_code separate_code;
+    for (auto& part : parts)
     {
-        auto kernels = build_program(program.second);
+        const auto& part_kernels = part.program->part_kernels[part.part_idx];
+        if (part.err_log.empty() || part_kernels.size() < 2)
+            continue;
 
-        for (auto& k : kernels)
+        for (const auto& key : part_kernels)
+            separate_code.insert(*_kernels_code.find(key));
+        part.err_log.clear();
+    }
+
+    sorted_code separate_program_code;
+    if (!separate_code.empty())
+    {
+        separate_program_code = get_program_source(separate_code, false);
+        auto separate_parts = build_parts(separate_program_code);
+        std::move(separate_parts.begin(), separate_parts.end(), std::back_inserter(parts));
+    }
+
+    std::string err_log; //accumulated build log from all the parts which failed to compile
+    for (auto& part : parts)
+        err_log += part.err_log;
+
+    if (!err_log.empty())
+        throw std::runtime_error("Program build failed:\n" + std::move(err_log));
+
+    _one_time_kernels.clear();
+    for (auto& part : parts)
+    {
+        for (auto& k : part.kernels)
         {
             const auto& entry_point = k.first;
-            const auto& k_id = program.second.entry_point_to_id[entry_point];
-            if (program.second.one_time)
+            const auto& k_id = part.program->entry_point_to_id[entry_point];
+            if (part.program->one_time)
             {
                 _one_time_kernels[k_id] = k.second;
             }
@@ -54,6 +54,7 @@ public:
         bool dump_custom_program = false;
         bool one_time = false;
         std::map<std::string, std::string> entry_point_to_id;
+        std::vector<std::vector<std::string>> part_kernels; // the keys of the kernels of every part in the kernels code
     };
 
     struct kernel_code
@@ -66,6 +67,16 @@ public:
 
     typedef std::string kernel_id;
     typedef cl::Kernel kernel_type;
+
+    // value of an argument set to a kernel, the memory handles and the scalars fit 8 bytes
+    struct bound_argument
+    {
+        size_t size = 0;
+        uint64_t value = 0;
+        bool operator==(const bound_argument& other) const { return size == other.size && value == other.value; }
+    };
+    // arguments currently set to an OpenCL kernel, the kernels with the same source share the kernel object and its arguments
+    using bound_arguments = std::vector<bound_argument>;
     using sorted_code = std::map<std::string, program_code>;
     using kernels_map = std::map<std::string, kernel_type>;
     using kernels_code = std::map<std::string, kernel_code>;
@@ -77,18 +88,27 @@ private:
     std::atomic<bool> _pending_compilation{ false };
     std::map<std::string, kernel_type> _kernels;
     std::map<std::string, kernel_type> _one_time_kernels; // These kernels are intended to be executed only once (can be removed later from the cache).
+    std::map<std::string, std::shared_ptr<bound_arguments>> _bound_arguments;
 
-    sorted_code get_program_source(const kernels_code& kernels_source_code) const;
+    sorted_code get_program_source(const kernels_code& kernels_source_code, bool allow_batch_compilation = true) const;
     friend class gpu_toolkit;
     explicit kernels_cache(gpu_toolkit& context);
-    kernels_map build_program(const program_code& pcode) const;
+    std::string get_dump_file_name(const program_code& pcode) const;
+    kernels_map build_program_part(const program_code& pcode, uint32_t part_idx, const std::string& dump_file_name, std::string& err_log) const;
+    mutable std::mutex _binaries_mutex;
+    mutable std::map<std::string, std::vector<unsigned char>> _program_binaries; // built or added program binaries by their names, guarded by _binaries_mutex
 
 public:
     kernel_id set_kernel_source(const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program, bool one_time_kernel);
     kernel_type get_kernel(kernel_id id, bool one_time_kernel);
+    std::shared_ptr<bound_arguments> get_bound_arguments(kernel_id id);
     gpu_toolkit& get_context() { return _context; }
     //forces compilation of all pending kernels/programs
     void build_all();
+    std::vector<std::string> get_program_binary_names() const;
+    std::vector<unsigned char> get_program_binary(const std::string& name) const;
+    //the programs with the same name are created from the binary instead of being compiled
+    void add_program_binary(const std::string& name, std::vector<unsigned char> binary);
 };
 
 }}
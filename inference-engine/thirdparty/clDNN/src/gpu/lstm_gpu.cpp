@@ -0,0 +1,108 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "lstm_inst.h"
+#include "primitive_gpu_base.h"
+#include "implementation_map.h"
+#include "kernel_selector_helper.h"
+#include "lstm/lstm_seq_kernel_selector.h"
+#include "lstm/lstm_seq_kernel_base.h"
+#include "network_impl.h"
+#include "error_handler.h"
+
+namespace cldnn { namespace gpu {
+
+struct lstm_gpu : typed_primitive_gpu_impl<lstm>
+{
+    using parent = typed_primitive_gpu_impl<lstm>;
+    using parent::parent;
+
+protected:
+
+    virtual kernel::kernel_arguments_data get_arguments(typed_primitive_inst<lstm>& instance, int32_t) const override
+    {
+        kernel::kernel_arguments_data args = parent::get_arguments(instance, 0);
+
+        args.output     = &instance.output_memory();
+        args.weights    = &instance.weights_memory();
+        args.recurrent  = &instance.recurrent_memory();
+        args.bias       = instance.bias_term() ? &instance.bias_memory() : nullptr;
+        args.hidden     = instance.initial_hidden_term() ? &instance.initial_hidden_memory() : nullptr;
+        args.cell       = instance.initial_cell_term() ? &instance.initial_cell_memory() : nullptr;
+
+        return args;
+    }
+
+public:
+
+    static primitive_impl* create(const lstm_node& arg)
+    {
+        auto desc = arg.get_primitive();
+        auto lstm_seq_params = get_default_params<kernel_selector::lstm_seq_params>(arg);
+        lstm_seq_params.weights = convert_data_tensor(arg.weights().get_output_layout());
+        lstm_seq_params.recurrent = convert_data_tensor(arg.recurrent().get_output_layout());
+
+        if (arg.bias_term())
+        {
+            lstm_seq_params.SetBias(convert_data_tensor(arg.bias().get_output_layout()));
+        }
+        if (arg.initial_hidden_term())
+        {
+            lstm_seq_params.SetHidden(convert_data_tensor(arg.inital_hidden().get_output_layout()));
+        }
+        if (arg.initial_cell_term())
+        {
+            lstm_seq_params.SetCell(convert_data_tensor(arg.inital_cell().get_output_layout()));
+        }
+
+        lstm_seq_params.SetOffsetOrder(desc->offset_order);
+        lstm_seq_params.clip = desc->clip;
+        lstm_seq_params.input_forget = desc->input_forget;
+        lstm_seq_params.emit_sequence = desc->output_selection == cldnn_lstm_output_sequence ||
+            desc->output_selection == cldnn_lstm_output_sequence_cell;
+        lstm_seq_params.emit_last_cell = desc->output_selection == cldnn_lstm_output_hidden_cell ||
+            desc->output_selection == cldnn_lstm_output_sequence_cell;
+
+        auto lstm_seq_optional_params = get_default_optional_params<kernel_selector::lstm_seq_optional_params>(arg.get_program());
+
+        auto& kernel_selector = kernel_selector::lstm_seq_kernel_selector::Instance();
+        auto best_kernels = kernel_selector.GetBestKernels(lstm_seq_params, lstm_seq_optional_params);
+
+        CLDNN_ERROR_BOOL(arg.id(), "Best_kernel.empty()", best_kernels.empty(), "Cannot find a proper kernel with this arguments");
+
+        auto lstm = new lstm_gpu(arg, best_kernels[0]);
+
+        return lstm;
+    };
+};
+
+
+namespace {
+    struct attach {
+        attach() {
+            auto val_fw = lstm_gpu::create;
+
+            implementation_map<lstm>::add({
+                { std::make_tuple(engine_types::ocl, data_types::f32, format::bfyx), val_fw },
+                { std::make_tuple(engine_types::ocl, data_types::f16, format::bfyx), val_fw },
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+} }
@@ -45,7 +45,7 @@ public:
     {
         //clear output buffer
         std::vector<event_impl::ptr> tmp_events(events);
-        auto ev = instance.get_network().get_engine().create_user_event(false);
+        auto ev = instance.get_network().get_engine().create_user_event(false, instance.get_network().get_stream_id());
         instance.output_memory().fill(0, ev);
         tmp_events.push_back(ev);
         return parent::execute_impl(tmp_events, instance);
@@ -0,0 +1,69 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "nv12_to_bgr_inst.h"
+#include "primitive_gpu_base.h"
+#include "implementation_map.h"
+#include "kernel_selector_helper.h"
+#include "nv12_to_bgr/nv12_to_bgr_kernel_selector.h"
+#include "nv12_to_bgr/nv12_to_bgr_kernel_ref.h"
+#include "error_handler.h"
+
+using namespace cldnn;
+
+namespace cldnn
+{
+    namespace gpu
+    {
+        struct nv12_to_bgr_gpu : typed_primitive_gpu_impl<nv12_to_bgr>
+        {
+            using parent = typed_primitive_gpu_impl<nv12_to_bgr>;
+            using parent::parent;
+
+        public:
+
+            static primitive_impl* create(const nv12_to_bgr_node& arg)
+            {
+                auto nv12_to_bgr_params = get_default_params<kernel_selector::nv12_to_bgr_params>(arg);
+                auto nv12_to_bgr_optional_params =
+                        get_default_optional_params<kernel_selector::nv12_to_bgr_optional_params>(arg.get_program());
+
+                auto& kernel_selector = kernel_selector::nv12_to_bgr_kernel_selector::Instance();
+                auto best_kernels = kernel_selector.GetBestKernels(nv12_to_bgr_params, nv12_to_bgr_optional_params);
+
+                CLDNN_ERROR_BOOL(arg.id(), "Best_kernel.empty()", best_kernels.empty(), "Cannot find a proper kernel with this arguments");
+
+                auto nv12_to_bgr = new nv12_to_bgr_gpu(arg, best_kernels[0]);
+
+                return nv12_to_bgr;
+            }
+        };
+
+        namespace
+        {
+            struct attach
+            {
+                attach()
+                {
+                    auto val_fw = nv12_to_bgr_gpu::create;
+                    implementation_map<nv12_to_bgr>::add(std::make_tuple(engine_types::ocl, data_types::u8, format::bfyx), val_fw);
+                }
+                ~attach() = default;
+            };
+            attach attach_impl;
+        }
+    } //namespace cldnn
+} //namespace gpu
@@ -76,9 +76,8 @@ namespace cldnn { namespace gpu{
 
     }
 
-    void ocl_builder::build_device(const configuration& config)
+    std::vector<cl::Device> ocl_builder::get_matching_devices(const configuration& config, std::list<std::string>& reasons)
     {
-        std::list<std::string> reasons;
         cl_uint n = 0;
 
         // Get number of platforms availible
@@ -94,6 +93,7 @@ namespace cldnn { namespace gpu{
             throw std::runtime_error("clGetPlatformIDs error " + std::to_string(err));
         }
 
+        std::vector<cl::Device> matching;
         for (auto& id : platform_ids)
         {
             cl::Platform platform = cl::Platform(id);
@@ -102,12 +102,31 @@ namespace cldnn { namespace gpu{
             for (auto& d : devices)
             {
                 if (does_device_match_config(config, d, reasons))
-                {
-                    _device = d;
-                    return;
-                }
+                    matching.push_back(d);
             }
         }
+        return matching;
+    }
+
+    size_t ocl_builder::count_devices(const configuration& config)
+    {
+        std::list<std::string> reasons;
+        return get_matching_devices(config, reasons).size();
+    }
+
+    void ocl_builder::build_device(const configuration& config)
+    {
+        std::list<std::string> reasons;
+        auto devices = get_matching_devices(config, reasons);
+        if (config.device_id < devices.size())
+        {
+            _device = devices[config.device_id];
+            return;
+        }
+
+        if (!devices.empty())
+            throw std::invalid_argument("Device " + std::to_string(config.device_id) + " is requested but only " +
+                                        std::to_string(devices.size()) + " matching OpenCL devices are found");
 
         if (reasons.empty())
             throw std::runtime_error("Could not find any OpenCL device");
@@ -22,6 +22,7 @@
 #define CL_HPP_TARGET_OPENCL_VERSION 120
 #include <cl2_wrapper.h>
 #include <list>
+#include <vector>
 
 namespace cldnn {
 namespace gpu {
@@ -36,6 +37,9 @@ namespace gpu {
         cl_platform_id get_platform_id() const { return _platform_id; }
         bool is_user_context() const { return _is_user_context; }
 
+        // the number of the devices of all the platforms which match the configuration
+        static size_t count_devices(const configuration& config);
+
     private:
         cl::Context _context;
         cl::Device  _device;
@@ -45,7 +49,8 @@ namespace gpu {
         void build_device_from_user_context(const configuration& config);
         void build_device(const configuration& config);
         void build_context();
-        bool does_device_match_config(const configuration& config, const cl::Device& dev, std::list<std::string>& reasons);
+        static std::vector<cl::Device> get_matching_devices(const configuration& config, std::list<std::string>& reasons);
+        static bool does_device_match_config(const configuration& config, const cl::Device& dev, std::list<std::string>& reasons);
         void build_platform_id();
     };
 
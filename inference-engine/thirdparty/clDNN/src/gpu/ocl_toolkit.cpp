@@ -21,6 +21,7 @@
 #include "command_queues_builder.h"
 #include "events_pool.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iomanip>
 #include <ios>
@@ -97,7 +98,6 @@ gpu_toolkit::gpu_toolkit(const configuration& config)
     , _platform_id(_ocl_builder.get_platform_id())
     , _engine_info(*this)
     , _kernels_cache(*this)
-    , _events_pool(new events_pool())
 {
     _ocl_builder.get_device().getInfo(CL_DEVICE_EXTENSIONS, &_extensions);
     build_command_queues(config);
@@ -119,6 +119,9 @@ gpu_toolkit::gpu_toolkit(const configuration& config)
             << "    out-of-order: "        << std::boolalpha << _configuration.host_out_of_order << "\n"
             << "    engine log: "          << _configuration.log << "\n"
             << "    sources dumps: "       << _configuration.ocl_sources_dumps_dir << "\n"
+            << "    kernels cache: "       << _configuration.kernels_cache_dir << "\n"
+            << "    build threads: "       << _configuration.n_build_threads << "\n"
+            << "    streams: "             << _configuration.n_streams << "\n"
             << "\nEngine info:\n"
             << "    device id: "           << _engine_info.dev_id << "\n"
             << "    cores count: "         << _engine_info.cores_count << "\n"
@@ -137,7 +140,8 @@ void gpu_toolkit::build_command_queues(const configuration& config)
 {
     command_queues_builder queue_builder(_context, _ocl_builder.get_device(), _platform_id);
     queue_builder.set_profiling(config.enable_profiling);
-    queue_builder.set_out_of_order((config.host_out_of_order && _neo_driver));
+    _in_order_queue = !(config.host_out_of_order && _neo_driver);
+    queue_builder.set_out_of_order(!_in_order_queue);
 
     bool priorty_extensions = extension_supported("cl_khr_priority_hints") && extension_supported("cl_khr_create_command_queue");
     queue_builder.set_priority_mode(config.priority_mode, priorty_extensions);
@@ -145,14 +149,27 @@ void gpu_toolkit::build_command_queues(const configuration& config)
     bool throttle_extensions = extension_supported("cl_khr_throttle_hints") && extension_supported("cl_khr_create_command_queue");
     queue_builder.set_throttle_mode(config.throttle_mode, throttle_extensions);
 
-    queue_builder.build();
+    for (uint16_t i = 0; i < std::max<uint16_t>(config.n_streams, 1); i++)
+    {
+        queue_builder.build();
+
+        std::unique_ptr<stream> s(new stream());
+        s->queue = queue_builder.queue();
+        s->events.reset(new events_pool());
+        _streams.push_back(std::move(s));
+    }
 
-    _command_queue = queue_builder.queue();
+    // the copies are ordered by the events, so the transfer queue is always in-order
+    queue_builder.set_out_of_order(false);
+    queue_builder.build();
+    _transfer_queue = queue_builder.queue();
 }
 
-event_impl::ptr gpu_toolkit::enqueue_kernel(cl::Kernel const& kern, cl::NDRange const& global, cl::NDRange const& local, std::vector<event_impl::ptr> const & deps)
+event_impl::ptr gpu_toolkit::enqueue_kernel(uint16_t stream_id, cl::Kernel const& kern, cl::NDRange const& global, cl::NDRange const& local, std::vector<event_impl::ptr> const & deps)
 {
-    std::vector<cl::Event> dep_events;
+    auto& s = *_streams.at(stream_id);
+    auto& dep_events = s.dep_events;
+    dep_events.clear();
     auto dep_events_ptr = &dep_events;
     if (!_configuration.host_out_of_order)
     {
@@ -163,18 +180,18 @@ event_impl::ptr gpu_toolkit::enqueue_kernel(cl::Kernel const& kern, cl::NDRange
     else
     {
         dep_events_ptr = nullptr;
-        sync_events(deps);
+        sync_events(s, deps);
     }
 
     cl::Event ret_ev;
     try {
-        if (!_configuration.host_out_of_order || _output_event || _configuration.enable_profiling)
+        if (!_configuration.host_out_of_order || s.output_event || _configuration.enable_profiling)
         {
-            _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, &ret_ev);
+            s.queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, &ret_ev);
         }
         else
         {
-            _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, nullptr);
+            s.queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, nullptr);
         }
     }
     catch (cl::Error const& err) {
@@ -189,28 +206,30 @@ event_impl::ptr gpu_toolkit::enqueue_kernel(cl::Kernel const& kern, cl::NDRange
         else
             msg += events_list_to_string(deps);
 
-        log(_queue_counter + 1, msg);
+        log(s.queue_counter + 1, msg);
     }
-    return _events_pool->get_from_base_pool(shared_from_this(), ret_ev, ++_queue_counter);
+    return s.events->get_from_base_pool(shared_from_this(), ret_ev, ++s.queue_counter);
 }
 
-event_impl::ptr gpu_toolkit::enqueue_marker(std::vector<event_impl::ptr> const& deps)
+event_impl::ptr gpu_toolkit::enqueue_marker(uint16_t stream_id, std::vector<event_impl::ptr> const& deps)
 {
+    auto& s = *_streams.at(stream_id);
     if (deps.empty())
-        return _events_pool->get_from_user_pool(shared_from_this(), true);
+        return s.events->get_from_user_pool(shared_from_this(), true);
 
     if (!_configuration.host_out_of_order)
     {
         cl::Event ret_ev;
         if (!enabled_single_kernel())
         {
-            std::vector<cl::Event> dep_events;
+            auto& dep_events = s.dep_events;
+            dep_events.clear();
             for (auto& dep : deps)
                 if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
                     dep_events.push_back(ocl_ev->get());
 
             try {
-                _command_queue.enqueueMarkerWithWaitList(&dep_events, &ret_ev);
+                s.queue.enqueueMarkerWithWaitList(&dep_events, &ret_ev);
             }
             catch (cl::Error const& err) {
                 throw ocl_error(err);
@@ -219,7 +238,7 @@ event_impl::ptr gpu_toolkit::enqueue_marker(std::vector<event_impl::ptr> const&
         else
         {
             try {
-                _command_queue.enqueueMarkerWithWaitList(nullptr, &ret_ev);
+                s.queue.enqueueMarkerWithWaitList(nullptr, &ret_ev);
             }
             catch (cl::Error const& err) {
                 throw ocl_error(err);
@@ -227,41 +246,112 @@ event_impl::ptr gpu_toolkit::enqueue_marker(std::vector<event_impl::ptr> const&
         }
 
         if (logging_enabled())
-            log(_queue_counter + 1, "Marker with dependencies: " + events_list_to_string(deps));
-        return _events_pool->get_from_base_pool(shared_from_this(), ret_ev, ++_queue_counter);
+            log(s.queue_counter + 1, "Marker with dependencies: " + events_list_to_string(deps));
+        return s.events->get_from_base_pool(shared_from_this(), ret_ev, ++s.queue_counter);
+    }
+    else if (_in_order_queue)
+    {
+        // the marker completes after all the commands enqueued before it, so the dependencies are not listed
+        cl::Event ret_ev;
+        try {
+            s.queue.enqueueMarkerWithWaitList(nullptr, &ret_ev);
+        }
+        catch (cl::Error const& err) {
+            throw ocl_error(err);
+        }
+        return s.events->get_from_base_pool(shared_from_this(), ret_ev, ++s.queue_counter);
     }
     else
     {
-        sync_events(deps);
-        return _events_pool->get_from_base_pool(shared_from_this(), _last_barrier_ev, _last_barrier);
+        sync_events(s, deps);
+        return s.events->get_from_base_pool(shared_from_this(), s.last_barrier_ev, s.last_barrier);
+    }
+}
+
+event_impl::ptr gpu_toolkit::group_events(uint16_t stream_id, std::vector<event_impl::ptr> const& deps)
+{
+    return _streams.at(stream_id)->events->get_from_group_pool(shared_from_this(), deps);
+}
+
+event_impl::ptr gpu_toolkit::enqueue_write_buffer(cl::Buffer const& buffer, const void* pointer, size_t size)
+{
+    cl::Event ret_ev;
+    try {
+        _transfer_queue.enqueueWriteBuffer(buffer, CL_FALSE, 0, size, pointer, nullptr, &ret_ev);
+        _transfer_queue.flush();
+    }
+    catch (cl::Error const& err) {
+        throw ocl_error(err);
     }
+
+    if (logging_enabled())
+        log(0, "Write buffer on the transfer queue, size: " + std::to_string(size));
+    return{ new base_event(shared_from_this(), ret_ev), false };
+}
+
+event_impl::ptr gpu_toolkit::enqueue_read_buffer(uint16_t stream_id, cl::Buffer const& buffer, void* pointer, size_t size)
+{
+    auto& s = *_streams.at(stream_id);
+    cl::Event ret_ev;
+    try {
+        // an out-of-order queue needs a barrier to read after the commands enqueued before
+        if (!_in_order_queue)
+            s.queue.enqueueBarrierWithWaitList(nullptr, nullptr);
+        s.queue.enqueueReadBuffer(buffer, CL_FALSE, 0, size, pointer, nullptr, &ret_ev);
+        s.queue.flush();
+    }
+    catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+
+    if (logging_enabled())
+        log(s.queue_counter, "Read buffer, size: " + std::to_string(size));
+    return{ new base_event(shared_from_this(), ret_ev), false };
 }
 
-event_impl::ptr gpu_toolkit::group_events(std::vector<event_impl::ptr> const& deps)
+void gpu_toolkit::enqueue_wait(uint16_t stream_id, std::vector<event_impl::ptr> const& deps)
 {
-    return _events_pool->get_from_group_pool(shared_from_this(), deps);
+    std::vector<cl::Event> dep_events;
+    for (auto& dep : deps)
+        if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
+            if (ocl_ev->get()() != nullptr)
+                dep_events.push_back(ocl_ev->get());
+    if (dep_events.empty())
+        return;
+
+    auto& s = *_streams.at(stream_id);
+    try {
+        s.queue.enqueueBarrierWithWaitList(&dep_events, nullptr);
+    }
+    catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+
+    if (logging_enabled())
+        log(s.queue_counter, "Wait for events: " + events_list_to_string(deps));
 }
 
-event_impl::ptr gpu_toolkit::create_user_event(bool set)
+event_impl::ptr gpu_toolkit::create_user_event(bool set, uint16_t stream_id)
 {
-    return _events_pool->get_from_user_pool(shared_from_this(), set);
+    return _streams.at(stream_id)->events->get_from_user_pool(shared_from_this(), set);
 }
 
-void gpu_toolkit::reset_events()
+void gpu_toolkit::reset_events(uint16_t stream_id)
 {
-    _events_pool->reset_events();
+    _streams.at(stream_id)->events->reset_events();
 }
 
 void gpu_toolkit::release_events_pool()
 {
-    _events_pool.reset();
+    for (auto& s : _streams)
+        s->events.reset();
 }
 
-void gpu_toolkit::flush()
+void gpu_toolkit::flush(uint16_t stream_id)
 {
     if (logging_enabled())
         log(0, "Flush");
-    queue().flush();
+    queue(stream_id).flush();
 }
 void gpu_toolkit::release_pending_memory()
 {
@@ -270,7 +360,8 @@ void gpu_toolkit::release_pending_memory()
     */
     void* ptr = nullptr;
     ptr = _mm_malloc(4096, 4096);
-    queue().finish();
+    for (auto& s : _streams)
+        s->queue.finish();
     try
     {
         cl::Buffer flusher(_context, CL_MEM_USE_HOST_PTR, (size_t)4096, ptr);
@@ -310,16 +401,16 @@ void gpu_toolkit::log(uint64_t id, std::string const & msg)
     open_log() << "[" << id << "] " << msg << std::endl;
 }
 
-void gpu_toolkit::sync_events(std::vector<event_impl::ptr> const & deps)
+void gpu_toolkit::sync_events(stream& s, std::vector<event_impl::ptr> const & deps)
 {
-    if (!_configuration.host_out_of_order)
+    if (!_configuration.host_out_of_order || _in_order_queue)
         return;
 
     bool needs_barrier = false;
     for (auto& dep : deps)
     {
         auto* ocl_ev = dynamic_cast<ocl_base_event*>(dep.get());
-        if (ocl_ev->get_queue_stamp() > _last_barrier)
+        if (ocl_ev->get_queue_stamp() > s.last_barrier)
         {
             needs_barrier = true;
         }
@@ -328,13 +419,13 @@ void gpu_toolkit::sync_events(std::vector<event_impl::ptr> const & deps)
     if (needs_barrier)
     {
         try {
-            if (_output_event)
+            if (s.output_event)
             {
-                _command_queue.enqueueBarrierWithWaitList(nullptr, &_last_barrier_ev);
+                s.queue.enqueueBarrierWithWaitList(nullptr, &s.last_barrier_ev);
             }
             else
             {
-                _command_queue.enqueueBarrierWithWaitList(nullptr, nullptr);
+                s.queue.enqueueBarrierWithWaitList(nullptr, nullptr);
             }
 
         }
@@ -342,9 +433,9 @@ void gpu_toolkit::sync_events(std::vector<event_impl::ptr> const & deps)
             throw ocl_error(err);
         }
 
-        _last_barrier = ++_queue_counter;
+        s.last_barrier = ++s.queue_counter;
         if (logging_enabled())
-            log(_last_barrier, "Barrier");
+            log(s.last_barrier, "Barrier");
     }
 }
 
@@ -26,6 +26,8 @@
 
 #include <memory>
 #include <chrono>
+#include <mutex>
+#include <vector>
 
 namespace cldnn {
     typedef cl::vector<cl::vector<unsigned char>> kernels_binaries_vector;
@@ -68,7 +70,12 @@ public:
     static std::shared_ptr<gpu_toolkit> create(const configuration& cfg = configuration());
     const cl::Context& context() const { return _context; }
     const cl::Device& device() const { return _ocl_builder.get_device(); }
-    const cl::CommandQueue& queue() const { return _command_queue; }
+    const cl::CommandQueue& queue(uint16_t stream_id = 0) const { return _streams.at(stream_id)->queue; }
+    uint16_t get_streams_count() const { return static_cast<uint16_t>(_streams.size()); }
+    // the copies between the host and the device memory, they do not wait for the commands of the streams
+    const cl::CommandQueue& transfer_queue() const { return _transfer_queue; }
+    // the kernels are shared by the networks of all the streams, so their arguments are set and enqueued under the lock
+    std::mutex& get_enqueue_mutex() { return _enqueue_mutex; }
 
     const configuration& get_configuration() const { return _configuration; }
     engine_info_internal get_engine_info() const { return _engine_info; }
@@ -86,39 +93,56 @@ public:
     gpu_toolkit& operator=(gpu_toolkit&& other) = delete;
     std::string single_kernel_name() const { return _configuration.single_kernel_name; }
     bool enabled_single_kernel() const { return single_kernel_name() == "" ? false : true; }
-    void set_output_event(bool out_event) { _output_event = out_event; }
-
-    event_impl::ptr enqueue_kernel(cl::Kernel const& kern, cl::NDRange const& global, cl::NDRange const& local, std::vector<event_impl::ptr> const& deps);
-    event_impl::ptr enqueue_marker(std::vector<event_impl::ptr> const& deps);
-    event_impl::ptr group_events(std::vector<event_impl::ptr> const& deps);
-    void reset_events();
-    event_impl::ptr create_user_event(bool set);
+    void set_output_event(uint16_t stream_id, bool out_event) { _streams.at(stream_id)->output_event = out_event; }
+
+    event_impl::ptr enqueue_kernel(uint16_t stream_id, cl::Kernel const& kern, cl::NDRange const& global, cl::NDRange const& local, std::vector<event_impl::ptr> const& deps);
+    event_impl::ptr enqueue_marker(uint16_t stream_id, std::vector<event_impl::ptr> const& deps);
+    event_impl::ptr group_events(uint16_t stream_id, std::vector<event_impl::ptr> const& deps);
+    event_impl::ptr enqueue_write_buffer(cl::Buffer const& buffer, const void* pointer, size_t size);
+    event_impl::ptr enqueue_read_buffer(uint16_t stream_id, cl::Buffer const& buffer, void* pointer, size_t size);
+    // the commands enqueued to the stream after the call wait for the events, which may come from the other queues
+    void enqueue_wait(uint16_t stream_id, std::vector<event_impl::ptr> const& deps);
+    void reset_events(uint16_t stream_id = 0);
+    event_impl::ptr create_user_event(bool set, uint16_t stream_id = 0);
     void release_events_pool();
 
-    void flush();
+    void flush(uint16_t stream_id = 0);
     void release_pending_memory();
     void wait_for_events(std::vector<event_impl::ptr> const& events);
 
     void log(uint64_t id, std::string const& msg);
     bool logging_enabled() const { return !_configuration.log.empty(); }
     bool is_neo_driver() { return _neo_driver; }
+    // the commands of an in-order queue are executed in the order they are enqueued, so they need no barriers
+    bool is_in_order_queue() const { return _in_order_queue; }
 private:
     configuration _configuration;
     ocl_builder _ocl_builder;
     bool _user_context = false;
     bool _neo_driver = false;
+    bool _in_order_queue = true;
     cl::Context _context;
-    cl::CommandQueue _command_queue;
     cl_platform_id _platform_id;
     engine_info_internal _engine_info;
     kernels_cache _kernels_cache;
     kernels_binaries_container _binaries;
     bool _serialize = false;
 
-    std::atomic<uint64_t> _queue_counter{ 0 };
-    std::atomic<uint64_t> _last_barrier{ 0 };
-    std::unique_ptr<events_pool> _events_pool;
-    cl::Event _last_barrier_ev;
+    // the command queue of a stream with the state of its events, the streams are used by different networks concurrently
+    struct stream
+    {
+        cl::CommandQueue queue;
+        std::atomic<uint64_t> queue_counter{ 0 };
+        std::atomic<uint64_t> last_barrier{ 0 };
+        std::unique_ptr<events_pool> events;
+        cl::Event last_barrier_ev;
+        bool output_event = false;
+        // the OpenCL events of the dependencies of an enqueue, kept to not allocate the list for every command
+        std::vector<cl::Event> dep_events;
+    };
+    std::vector<std::unique_ptr<stream>> _streams;
+    cl::CommandQueue _transfer_queue;
+    std::mutex _enqueue_mutex;
 
     std::string _extensions;
 
@@ -126,8 +150,7 @@ private:
     std::unique_ptr<ocl_logger> _logger;
 
     //returns whether a barrier has been added
-    void sync_events(std::vector<event_impl::ptr> const& deps);
-    bool _output_event = false;
+    void sync_events(stream& s, std::vector<event_impl::ptr> const& deps);
     std::ofstream& open_log();
 
     std::string get_device_version() { return _ocl_builder.get_device().getInfo<CL_DEVICE_VERSION>(); }
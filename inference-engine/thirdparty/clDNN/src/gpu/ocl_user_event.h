@@ -37,9 +37,12 @@ struct user_event : public base_event, public cldnn::user_event
     void set_impl() override;
     void attach_event(bool set)
     {
-        _event = cl::UserEvent(get_context()->context());
+        // a completed user event stays completed, so it is kept when the event is reused as a set one again
+        if (!set || !_set || _event() == nullptr)
+            _event = cl::UserEvent(get_context()->context());
         //we need to reset the timer(since attach_ocl_event is called only when this object is being reused)
         _timer = cldnn::instrumentation::timer<>(); 
+        _set = false;
         if (set)
         {
             set_impl();
@@ -19,6 +19,7 @@
 
 #include "primitive_inst.h"
 #include "program_impl.h"
+#include "network_impl.h"
 #include "kernel.h"
 #include "events_waiter.h"
 #include "error_handler.h"
@@ -103,22 +104,23 @@ protected:
         return 1;
     }
 
-    event_impl::ptr aggregate_events(const std::vector<event_impl::ptr>& events, bool group=false) const
+    event_impl::ptr aggregate_events(uint16_t stream_id, const std::vector<event_impl::ptr>& events, bool group=false) const
     {
         if (events.size() == 1)
             return events[0];
 
         if (group)
-            return _outer.get_program().get_engine().get_context()->group_events(events);
+            return _outer.get_program().get_engine().get_context()->group_events(stream_id, events);
 
-        return events_waiter(_outer.get_program().get_engine().get_context()).run(events);
+        return events_waiter(_outer.get_program().get_engine().get_context()).run(stream_id, events);
     }
 
     virtual event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, typed_primitive_inst<PType>& instance) override
     {
+        const auto stream_id = instance.get_network().get_stream_id();
         if (optimized_out(instance))
         {
-            return aggregate_events(events);
+            return aggregate_events(stream_id, events);
         }
 
         std::vector<event_impl::ptr> tmp_events(events);
@@ -149,14 +151,14 @@ protected:
                 bool next_prim_is_cpu = is_any_user_cpu(users);
                 if (next_prim_is_cpu)
                 {
-                    _kernels[k].set_output_event(true);
+                    _kernels[k].set_output_event(stream_id, true);
                 }
                 else
                 {
-                    _kernels[k].set_output_event(instance.node.is_output());
+                    _kernels[k].set_output_event(stream_id, instance.node.is_output());
                 }
     
-                auto event = _kernels[k].run(_kernel_data.kernels[k], tmp_events, args);
+                auto event = _kernels[k].run(stream_id, _kernel_data.kernels[k], tmp_events, args);
                 new_events.push_back(event);
             }
 
@@ -164,7 +166,7 @@ protected:
         }
 
         bool group_events = split > 1 ? true : false;
-        return aggregate_events(tmp_events, group_events);
+        return aggregate_events(stream_id, tmp_events, group_events);
     }
 };
 
@@ -387,7 +387,7 @@ struct proposal_gpu : typed_primitive_impl<proposal>
             a->wait();
         }
 
-        auto ev = instance.get_network().get_engine().create_user_event(false);
+        auto ev = instance.get_network().get_engine().create_user_event(false, instance.get_network().get_stream_id());
 
         if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type == data_types::f16)
         {
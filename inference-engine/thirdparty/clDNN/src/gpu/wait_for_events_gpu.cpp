@@ -33,7 +33,7 @@ public:
     event_impl::ptr execute(const std::vector<event_impl::ptr>& events, primitive_inst& instance) override
     {
         events_waiter events_waiter(instance.get_network().get_engine().get_context());
-        return events_waiter.run(events);
+        return events_waiter.run(instance.get_network().get_stream_id(), events);
     }
 
     bool validate(const primitive_inst&) const override
@@ -305,8 +305,8 @@ namespace cldnn
             auto node_itr = itr++;
             auto& node = *(*node_itr).second;
             // Create second part detection output primitive and replace nodes names - do it only once
-            if ((p.get_options().get<build_option_type::detection_output_gpu>()->enabled()) &&
-                (node.is_type<detection_output>()) &&
+            if ((node.is_type<detection_output>()) &&
+                (node.as<detection_output>().runs_on_gpu()) &&
                 (node.id().find("_pre") == std::string::npos))    //ToDo: this will fail if user will name the primitive with using _pre like do_pre
                                                                   //      we need to use node mark() or some other idea to prevent it   
             {
@@ -358,6 +358,10 @@ namespace cldnn
             has_lstm_children = false;
             // replace lstm node with lstm_gemm and lstm_elt nodes
             if (node->is_type<lstm>()) {
+                // the fused kernel iterates over the sequence itself
+                if (node->as<lstm>().fused_sequence())
+                    continue;
+
                 bool initial_hidden_term = node->as<lstm>().initial_hidden_term();
                 bool initial_cell_term = node->as<lstm>().initial_cell_term();
                 bool bias_term = node->as<lstm>().bias_term();
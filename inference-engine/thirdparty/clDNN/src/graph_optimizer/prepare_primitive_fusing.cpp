@@ -27,6 +27,7 @@
 #include "batch_norm_inst.h"
 #include "batch_norm_grad_inst.h"
 #include "crop_inst.h"
+#include "data_inst.h"
 #include "eltwise_inst.h"
 #include "fused_conv_bn_scale_inst.h"
 #include "fused_conv_eltwise_inst.h"
@@ -41,6 +42,8 @@
 #include "scale_grad_weights_inst.h"
 #include "upsampling_inst.h"
 
+#include "api_impl.h"
+
 
 void prepare_primitive_fusing::fuse_skip_layers(program_impl& p, program_node* node)
 {
@@ -66,7 +69,11 @@ void prepare_primitive_fusing::fuse_skip_layers(program_impl& p, program_node* n
         p.get_processing_order().insert(&node, &to_fuse_with);
 
         if (node.get_fused_activation_func() != activation_none)
+        {
             to_fuse_with.set_fused_activation(node.get_fused_activation_func(), node.get_fused_activation_params());
+            for (const auto& fused : node.get_fused_activations_chain())
+                to_fuse_with.add_fused_activation(fused.activation_func, fused.additional_params);
+        }
         to_fuse_with.set_output_padding(node.get_output_layout().data_padding);
 
         p.extract_and_remove(node);
@@ -79,6 +86,54 @@ static bool node_is_type(program_node* n)
     return n->is_type<T>();
 }
 
+//TODO: new api needs to be created to read such caps
+//right now use whitelist so no new primitives will be affected in case of lack of fused activation support
+static bool supports_fused_activation(const program_node& node)
+{
+    return node.is_type<batch_norm>() || node.is_type<concatenation>() || node.is_type<convolution>() ||
+        node.is_type<crop>() || node.is_type<deconvolution>() || node.is_type<eltwise>() ||
+        node.is_type<fully_connected>() || node.is_type<lrn>() || node.is_type<normalize>() ||
+        node.is_type<permute>() || node.is_type<pooling>() || node.is_type<reorder>() ||
+        node.is_type<reshape>() || node.is_type<roi_pooling>() || node.is_type<scale>() ||
+        node.is_type<softmax>() || node.is_type<upsampling>() || node.is_type<mvn>();
+}
+
+// the fused functions are nested in the ACTIVATION macro of the kernels, so the chain is kept short
+static const size_t max_fused_activations = 4;
+
+static size_t fused_activations_count(const program_node& node)
+{
+    if (node.get_fused_activation_func() == activation_none)
+        return 0;
+    return 1 + node.get_fused_activations_chain().size();
+}
+
+// reads the constant of a single element, the scale by it is fused as the linear activation
+static bool get_scalar_value(const program_node& node, float& value)
+{
+    if (!node.is_type<data>() || node.get_output_layout().count() != 1)
+        return false;
+
+    auto& mem = node.as<data>().get_attached_memory();
+    switch (node.get_output_layout().data_type)
+    {
+    case data_types::f32:
+    {
+        mem_lock<float> ptr{ mem };
+        value = *ptr.data();
+        return true;
+    }
+    case data_types::f16:
+    {
+        mem_lock<uint16_t> ptr{ mem };
+        value = half_to_float(*ptr.data());
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
 void prepare_primitive_fusing::fuse_conv_bn_scale(program_impl& p, program_node* node)
 {
     program_helpers::do_for_types<convolution>(*node, [&p](convolution_node& node)
@@ -384,6 +439,51 @@ void prepare_primitive_fusing::run(program_impl& p)
         });
     }
 
+    //This loop tries fusing the scales by a constant of a single element as the linear activation
+    itr = p.processing_order.begin();
+    while (itr != p.processing_order.end())
+    {
+        auto node_itr = itr++;
+        auto& node = (*node_itr);
+
+        program_helpers::do_for_types<scale>(*node, [&p, is_debug](scale_node& node)
+        {
+            auto& input = node.input();
+
+            //Restrictions:
+            // - inputs cannot be padded
+            // - primitives input cannot be output
+            // - input was optimized
+            if (node.has_padded_dependency() || (input.is_output() && !is_debug) || node.is_output() ||
+                input.can_be_optimized())
+                return;
+
+            // - the scale and the bias are constants of a single element
+            float scale_value = 1.0f;
+            float bias_value = 0.0f;
+            if (!get_scalar_value(node.scale_in(), scale_value) ||
+                (node.bias_term() && !get_scalar_value(node.bias(), bias_value)))
+                return;
+
+            // - limit to primitives which implementations support activation fusing
+            if (input.get_users().size() != 1 || !supports_fused_activation(input) ||
+                fused_activations_count(input) + 1 + fused_activations_count(node) > max_fused_activations)
+                return;
+
+            input.add_fused_activation(activation_linear, { scale_value, bias_value });
+            input.add_fused_activations(node);
+            input.set_output_padding(node.get_output_layout().data_padding);
+
+            while (node.get_dependencies().size() > 1)
+            {
+                auto& dep = node.get_dependency(node.get_dependencies().size() - 1);
+                p.remove_connection(dep, node);
+                p.remove_if_dangling(dep);
+            }
+            p.extract_and_remove(node);
+        });
+    }
+
     itr = p.processing_order.begin();
     while (itr != p.processing_order.end())
     {
@@ -403,20 +503,13 @@ void prepare_primitive_fusing::run(program_impl& p)
                 node.get_dependencies().size() != 1 || input.can_be_optimized())
                 return;
 
-            // - check if there is no activation fused already
+            // - the activations fused already are chained, up to max_fused_activations
             // - limit to primitives which implementations support activation fusing
-            if (input.get_users().size() != 1 || input.get_fused_activation_func() != activation_none ||
-                //TODO: new api needs to be created to read such caps
-                //right now use whitelist so no new primitives will be affected in case of lack of fused activation support
-                (!input.is_type<batch_norm>() && !input.is_type<concatenation>() && !input.is_type<convolution>() &&
-                    !input.is_type<crop>() && !input.is_type<deconvolution>() && !input.is_type<eltwise>() &&
-                    !input.is_type<fully_connected>() && !input.is_type<lrn>() && !input.is_type<normalize>() &&
-                    !input.is_type<permute>() && !input.is_type<pooling>() && !input.is_type<reorder>() &&
-                    !input.is_type<reshape>() && !input.is_type<roi_pooling>() && !input.is_type<scale>() &&
-                    !input.is_type<softmax>() && !input.is_type<upsampling>() && !input.is_type<mvn>()))
+            if (input.get_users().size() != 1 || fused_activations_count(input) >= max_fused_activations ||
+                !supports_fused_activation(input))
                 return;
 
-            input.set_fused_activation(node.get_primitive()->activation_func, node.get_primitive()->additional_params);
+            input.add_fused_activation(node.get_primitive()->activation_func, node.get_primitive()->additional_params);
             input.set_output_padding(node.get_output_layout().data_padding);
 
             p.extract_and_remove(node);
@@ -22,6 +22,9 @@
 #include "program_impl.h"
 #include "network_impl.h"
 #include "data_inst.h"
+#include "generic_layer_inst.h"
+#include "reorder_inst.h"
+#include "api_impl.h"
 
 
 using namespace cldnn;
@@ -31,11 +34,19 @@ void propagate_constants::run(program_impl& p)
 {
     for (auto& node : p.get_processing_order())
     {
-        if (node->is_constant())
+        if (node->is_constant() && !reuse_weights_reorder(p, *node) && !calculate_on_host(p, *node))
             handle_constant(p, *node);
     }
 
     auto&& to_replace = calculate(p.get_engine());
+    for (auto& cout : to_replace)
+    {
+        auto reorder = new_weights_reorders.find(cout.first);
+        if (reorder != new_weights_reorders.end())
+            p.get_engine().add_reordered_weights(*reorder->second.first, reorder->second.second, *cout.second);
+    }
+    to_replace.splice(to_replace.end(), reused_weights);
+    to_replace.splice(to_replace.end(), host_results);
 
     //remove all nodes which are no longer relevant, i.e. nodes which:
     // 1. are constants, and
@@ -144,6 +155,140 @@ std::list<std::pair<primitive_id, memory_impl::ptr>> propagate_constants::calcul
     return ret;
 }
 
+// identifies the weights reorder regardless of the program it is built in - the jit of its kernel without the unique name
+static std::string get_weights_reorder_key(const generic_layer_node& node)
+{
+    auto& params = node.get_primitive()->generic_params;
+    if (params.engine != kernel_selector::generic_kernel_params::Engine::GPU || !params.clKernel || !params.clKernel->kernelString)
+        return{};
+
+    auto& kernel = *params.clKernel->kernelString;
+    std::string key = kernel.jit;
+    if (!kernel.entry_point.empty())
+    {
+        for (auto pos = key.find(kernel.entry_point); pos != std::string::npos; pos = key.find(kernel.entry_point, pos))
+            key.erase(pos, kernel.entry_point.size());
+    }
+    auto& output_layout = node.get_primitive()->output_layout;
+    return key + "\n// output: " + std::to_string(static_cast<int>(output_layout.format.value)) + " " + std::to_string(output_layout.count());
+}
+
+// the weights reordered at build time are taken from the engine if another program has already reordered the same
+// memory, otherwise the reorder is computed and stored there for the next programs
+bool propagate_constants::reuse_weights_reorder(program_impl& prog, program_node& node)
+{
+    if (!node.is_type<generic_layer>() || node.get_dependencies().size() != 1 || !node.get_dependency(0).is_type<data>() ||
+        !has_non_const_user(node))
+        return false;
+
+    auto key = get_weights_reorder_key(node.as<generic_layer>());
+    if (key.empty())
+        return false;
+
+    auto& source = node.get_dependency(0).as<data>().get_attached_memory();
+    if (!source.is_allocated_by(prog.get_engine()))
+        return false;
+
+    if (auto reordered = prog.get_engine().get_reordered_weights(source, key))
+    {
+        reused_weights.push_back({ node.id(), reordered });
+        return true;
+    }
+
+    new_weights_reorders[node.id()] = { memory_impl::ptr(&source), key };
+    return false;
+}
+
+namespace {
+
+bool is_plain_format(format fmt)
+{
+    return fmt == format::bfyx || fmt == format::yxfb || fmt == format::byxf || fmt == format::fyxb;
+}
+
+float to_float(float value) { return value; }
+float to_float(uint16_t value) { return half_to_float(value); }
+
+template <typename T>
+T from_float(float value);
+template <>
+float from_float<float>(float value) { return value; }
+template <>
+uint16_t from_float<uint16_t>(float value) { return float_to_half(value); }
+
+// copies the rows along x with their pitches, a row of the same type and unit pitches is a plain copy
+template <typename In, typename Out>
+void reorder_on_host(memory_impl& input, memory_impl& output)
+{
+    auto& in_layout = input.get_layout();
+    auto& out_layout = output.get_layout();
+    auto in_pitch = static_cast<size_t>(in_layout.get_pitches().spatial[0]);
+    auto out_pitch = static_cast<size_t>(out_layout.get_pitches().spatial[0]);
+
+    mem_lock<In> in_lock(input);
+    mem_lock<Out> out_lock(output);
+    const In* src = in_lock.data();
+    Out* dst = out_lock.data();
+
+    auto& size = out_layout.size;
+    for (int b = 0; b < size.batch[0]; b++)
+    {
+        for (int f = 0; f < size.feature[0]; f++)
+        {
+            for (int y = 0; y < size.spatial[1]; y++)
+            {
+                const In* src_row = src + in_layout.get_linear_offset(tensor(b, f, 0, y));
+                Out* dst_row = dst + out_layout.get_linear_offset(tensor(b, f, 0, y));
+                for (int x = 0; x < size.spatial[0]; x++)
+                    dst_row[x * out_pitch] = from_float<Out>(to_float(src_row[x * in_pitch]));
+            }
+        }
+    }
+}
+
+}
+
+// a reorder of the data between the plain formats and the floating point types, which only the non-constant nodes use,
+// is computed on the host: a constants network is not built for it
+bool propagate_constants::calculate_on_host(program_impl& prog, program_node& node)
+{
+    if (!node.is_type<reorder>() || node.get_dependencies().size() != 1 || !node.get_dependency(0).is_type<data>() ||
+        node.is_output() || node.get_fused_activation_func() != activation_none)
+        return false;
+
+    auto& reorder_node = node.as<reorder>();
+    if (reorder_node.has_mean() || !reorder_node.get_primitive()->subtract_per_feature.empty())
+        return false;
+
+    for (auto& user : node.get_users())
+    {
+        if (user->is_constant())
+            return false;
+    }
+
+    auto& input = node.get_dependency(0).as<data>().get_attached_memory();
+    auto in_layout = input.get_layout();
+    auto out_layout = node.get_output_layout();
+    auto is_float = [](data_types type) { return type == data_types::f32 || type == data_types::f16; };
+    if (!is_plain_format(in_layout.format) || !is_plain_format(out_layout.format) ||
+        !is_float(in_layout.data_type) || !is_float(out_layout.data_type) ||
+        in_layout.size != out_layout.size || out_layout.data_padding)
+        return false;
+
+    auto output = prog.get_engine().allocate_memory(out_layout);
+    if (in_layout.data_type == data_types::f32 && out_layout.data_type == data_types::f32)
+        reorder_on_host<float, float>(input, *output);
+    else if (in_layout.data_type == data_types::f32)
+        reorder_on_host<float, uint16_t>(input, *output);
+    else if (out_layout.data_type == data_types::f32)
+        reorder_on_host<uint16_t, float>(input, *output);
+    else
+        reorder_on_host<uint16_t, uint16_t>(input, *output);
+
+    host_results.push_back({ node.id(), output });
+    return true;
+}
+
 void propagate_constants::handle_constant(program_impl& prog, program_node& node)
 {
     if (!node.is_type<data>())
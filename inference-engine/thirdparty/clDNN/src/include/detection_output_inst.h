@@ -38,6 +38,10 @@ public:
     program_node& location() const { return get_dependency(0); }
     program_node& confidence() const { return get_dependency(1); }
     program_node& prior_box() const { return get_dependency(2); }
+
+    // The GPU kernels are used if they are enabled by the build option and support the parameters of the primitive,
+    // the clipping and the decrease of the labels are done by the CPU implementation only.
+    bool runs_on_gpu() const;
 };
 
 using detection_output_node = typed_program_node<detection_output>;
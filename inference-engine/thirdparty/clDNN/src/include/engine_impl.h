@@ -24,8 +24,11 @@
 #include "memory_pool.h"
 #include "gpu/engine_info.h"
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
+#include <string>
 
 namespace cldnn {
 namespace gpu { 
@@ -48,25 +51,37 @@ struct typed_program_node;
 struct engine_impl : public refcounted_obj<engine_impl>
 {
 public:
-    engine_impl(const engine_configuration& conf);
+    engine_impl(const engine_configuration& conf, uint32_t engine_num = 0);
     ~engine_impl();
     engine_types type() const { return engine_types::ocl; }
+    // the number of the GPUs the engines can be created on, the engine number is the index of the GPU
+    static uint32_t get_device_count();
     refcounted_obj_ptr<memory_impl> allocate_memory(layout layout);
-    refcounted_obj_ptr<memory_impl> allocate_memory(layout layout, primitive_id, uint32_t, std::set<primitive_id>, bool reusable = true);
+    refcounted_obj_ptr<memory_impl> allocate_memory(layout layout, primitive_id, uint32_t, std::set<primitive_id>, bool reusable = true, uint16_t stream_id = 0);
     refcounted_obj_ptr<memory_impl> reinterpret_buffer(const memory_impl& memory, layout new_layout);
+    refcounted_obj_ptr<memory_impl> share_host_memory(layout layout, void* pointer);
     bool is_the_same_buffer(const memory_impl& mem1, const memory_impl& mem2);
 
-    refcounted_obj_ptr<event_impl> create_user_event(bool set = false);
+    // the host buffers should not be changed or released until the returned events are complete
+    refcounted_obj_ptr<event_impl> write_memory_async(memory_impl& memory, const void* pointer);
+    refcounted_obj_ptr<event_impl> read_memory_async(memory_impl& memory, void* pointer, uint16_t stream_id = 0);
+
+    // the weights reordered at build time are kept with their source memory, so the programs built on the same weights
+    // reuse them instead of running the reorder again, the key identifies the reorder regardless of the program
+    refcounted_obj_ptr<memory_impl> get_reordered_weights(memory_impl& source, const std::string& reorder_key);
+    void add_reordered_weights(memory_impl& source, const std::string& reorder_key, memory_impl& reordered);
+
+    refcounted_obj_ptr<event_impl> create_user_event(bool set = false, uint16_t stream_id = 0);
     void wait_for_events(std::vector<event_impl::ptr> const& events);
 
     refcounted_obj_ptr<program_impl> build_program(const topology_impl& topology, const build_options& options, bool is_internal = false, bool no_optimizations = false);
     refcounted_obj_ptr<program_impl> build_program(const std::set<std::shared_ptr<program_node>>& nodes, const build_options & options, bool is_internal);
     void compile_program(program_impl& prog);
 
-    refcounted_obj_ptr<network_impl> allocate_network(const program_impl& program, bool is_internal = false);
+    refcounted_obj_ptr<network_impl> allocate_network(const program_impl& program, bool is_internal = false, uint16_t stream_id = 0);
     refcounted_obj_ptr<network_impl> build_network(const topology_impl& topology, const build_options& options, bool is_internal = false);
     refcounted_obj_ptr<network_impl> build_network(const std::set<std::shared_ptr<program_node>>& nodes, const build_options & options, bool is_internal);
-    void flush_network();
+    void flush_network(uint16_t stream_id = 0);
     void release_pending_memory();
 
     template <class T>
@@ -107,10 +122,15 @@ public:
     void dump_memory_pool(const program_impl& program, std::string path, std::string dependencies) { _memory_pool.dump_memory_pool(program, path, dependencies); }
     bool use_memory_pool() const;
 
+    std::vector<std::string> get_program_binary_names() const;
+    std::vector<unsigned char> get_program_binary(const std::string& name) const;
+    void add_program_binary(const std::string& name, std::vector<unsigned char> binary);
+
 private:
     engine_configuration _configuration;
     std::shared_ptr<gpu_toolkit> _context;
 	memory_pool _memory_pool;
+    std::mutex _reordered_weights_mutex;
 };
 }
 
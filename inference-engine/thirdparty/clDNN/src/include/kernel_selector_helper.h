@@ -136,6 +136,17 @@ inline void convert_fused_activation_func_params(const arg_t& arg, kernel_select
     params.function = get_kernel_selector_activation_param(arg.get_fused_activation_func());
 }
 
+template <typename arg_t>
+inline void convert_fused_activations_chain(const arg_t& arg, std::vector<kernel_selector::base_activation_params>& params)
+{
+    for (const auto& fused : arg.get_fused_activations_chain())
+    {
+        kernel_selector::base_activation_params activation(fused.additional_params.a, fused.additional_params.b);
+        activation.function = get_kernel_selector_activation_param(fused.activation_func);
+        params.push_back(activation);
+    }
+}
+
 template <typename p_type>
 inline void convert_new_activation_func(const p_type primitive, kernel_selector::base_activation_params& params)
 {
@@ -162,6 +173,7 @@ inline params_t get_default_params(const arg_t& arg, uint32_t split = 1)
     params.layerID = arg.id();
 
     convert_fused_activation_func_params(arg, params.activation);
+    convert_fused_activations_chain(arg, params.fused_activations);
 
     return params;
 }
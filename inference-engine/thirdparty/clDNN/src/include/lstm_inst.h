@@ -38,7 +38,7 @@ public:
     }
     program_node& inital_cell() const {
         // This doesn't scale. We should use a map to get the dependencies index at primitive level
-        return get_dependency(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 2));
+        return get_dependency(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 3));
     }
     program_node& peepholes() const { return get_dependency(6); }
     bool bias_term() const { return !get_primitive()->bias.empty(); }
@@ -48,6 +48,8 @@ public:
     std::vector<cldnn_activation_func> activations() const { return get_primitive()->activations; }
     std::vector<cldnn_activation_additional_params> activation_params() const { return get_primitive()->activation_params; }
     size_t sequence_len() const { return get_primitive()->input.size(); }
+    // the whole sequence runs in a single kernel instead of being expanded to lstm_gemm and lstm_elt per step
+    bool fused_sequence() const;
 };
 
 using lstm_node = typed_program_node<lstm>;
@@ -72,7 +74,7 @@ public:
         return dep_memory(bias_term() ? 4 : 3);
     }
     memory_impl& initial_cell_memory() const {
-        return dep_memory(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 2));
+        return dep_memory(bias_term() ? (initial_hidden_term() ? 5 : 4) : (initial_hidden_term() ? 4 : 3));
     }
     memory_impl& peepholes_memory() const { return dep_memory(6); }
     bool bias_term() const { return !argument.bias.empty(); }
@@ -52,6 +52,9 @@ protected:
     const layout _layout;
 private:
     bool _reused;
+    // the reorders of these weights computed at build time by the programs of the engine, see engine_impl::get_reordered_weights
+    friend struct engine_impl;
+    std::map<std::string, refcounted_obj_ptr<memory_impl>> _reordered_weights;
 };
 
 struct simple_attached_memory : memory_impl
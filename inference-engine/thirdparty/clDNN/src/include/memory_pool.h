@@ -69,8 +69,9 @@ struct memory_record
     memory_set _users; // list of primitives that already use this memory object
     refcounted_obj_ptr<memory_impl> _memory;
     uint32_t _network_id;
+    uint16_t _stream_id; // the networks of different streams run concurrently, so they never share the memory
 
-    memory_record(memory_set users, refcounted_obj_ptr<memory_impl>& memory, uint32_t net_id);
+    memory_record(memory_set users, refcounted_obj_ptr<memory_impl>& memory, uint32_t net_id, uint16_t stream_id);
 };
 
 struct padded_pool_comparer
@@ -123,11 +124,11 @@ class memory_pool
 public:
     memory_pool(engine_impl& engine);
     ~memory_pool();
-    refcounted_obj_ptr<memory_impl> get_memory(const layout& layout, const primitive_id& id, uint32_t network_id,  const std::set<primitive_id>& restrictions, bool reusable = true); // get from pool or create memory allocation
+    refcounted_obj_ptr<memory_impl> get_memory(const layout& layout, const primitive_id& id, uint32_t network_id,  const std::set<primitive_id>& restrictions, bool reusable = true, uint16_t stream_id = 0); // get from pool or create memory allocation
     refcounted_obj_ptr<memory_impl> get_memory(const layout& layout);
-    refcounted_obj_ptr<memory_impl> get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>&);
-    refcounted_obj_ptr<memory_impl> get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions);
-    refcounted_obj_ptr<memory_impl> get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t network_id);
+    refcounted_obj_ptr<memory_impl> get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>&, uint16_t stream_id);
+    refcounted_obj_ptr<memory_impl> get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions, uint16_t stream_id);
+    refcounted_obj_ptr<memory_impl> get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t network_id, uint16_t stream_id);
     void clear_pool();
     void color_graph(const program_impl&);
     void dump_memory_pool(const program_impl&, std::string, std::string);
@@ -37,7 +37,7 @@ class primitive_inst;
 struct network_impl : public refcounted_obj<network_impl>
 {
 public:
-    network_impl(const program_impl& program, bool is_internal = false);
+    network_impl(const program_impl& program, bool is_internal = false, uint16_t stream_id = 0);
     network_impl(engine_impl& engine, const topology_impl& topo, const build_options& options = build_options(), bool is_internal = false);
     network_impl(engine_impl& engine, const std::set<std::shared_ptr<program_node>>& nodes, const build_options & options, bool is_internal);
 
@@ -61,12 +61,19 @@ public:
     std::vector<primitive_id> get_executed_primitive_ids() const;
     std::vector<primitive_id> get_all_primitive_ids() const;
     std::vector<primitive_id> get_all_primitive_org_ids() const;
+    uint64_t get_used_device_memory_size() const;
     void execute(const std::vector<event_impl::ptr>& events);
     void validate_primitives();
     // Implementation specific calls
     std::shared_ptr<primitive_inst> get_primitive(const primitive_id& id);
     std::string get_primitive_info(const primitive_id& id) const;
-    const event_impl::ptr& get_primitive_event(const primitive_id& id) const { return _events.at(id); }
+    const event_impl::ptr& get_primitive_event(const primitive_id& id) const
+    {
+        auto& ev = _events.at(id);
+        if (!ev)
+            throw std::out_of_range("primitive " + id + " has not been executed");
+        return ev;
+    }
     std::vector<std::shared_ptr<primitive_inst>> get_primitives(const std::vector<primitive_id>& ids);
     std::vector<std::shared_ptr<primitive_inst>> get_primitives(const std::vector<program_node*>& nodes);
     void execute_primitive(const std::shared_ptr<primitive_inst>& primitive, const std::vector<event_impl::ptr>& events);
@@ -75,10 +82,13 @@ public:
     uint32_t get_id() const { return net_id; }
     void build_exec_order();    
     bool is_internal() const { return _internal; }
+    // the command queue the network is executed on, the networks of different streams execute concurrently
+    uint16_t get_stream_id() const { return _stream_id; }
 private:
     uint32_t net_id = 0; 
     const program_impl::cptr _program;
     bool _internal;
+    uint16_t _stream_id;
     float _learning_rate = float(0.00001);
 
     std::map<primitive_id, std::shared_ptr<primitive_inst>> _primitives;
@@ -86,6 +96,8 @@ private:
     std::vector<std::shared_ptr<primitive_inst>> _outputs;
     std::list<std::shared_ptr<primitive_inst>> _exec_order;
     std::list<std::shared_ptr<primitive_inst>> _data_outputs;
+    // the mutable_data primitives with the user or the dependency whose event they take after the execution
+    std::vector<std::pair<primitive_id, primitive_id>> _mutable_data_events;
 
     std::unordered_map<primitive_id, event_impl::ptr> _events;
 
@@ -0,0 +1,51 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "api/CPP/nv12_to_bgr.hpp"
+#include "primitive_inst.h"
+
+namespace  cldnn
+{
+template <>
+struct typed_program_node<nv12_to_bgr> : public typed_program_node_base<nv12_to_bgr>
+{
+    using parent = typed_program_node_base<nv12_to_bgr>;
+
+public:
+    using parent::parent;
+
+    program_node& input() const { return get_dependency(0); }
+};
+
+using nv12_to_bgr_node = typed_program_node<nv12_to_bgr>;
+
+template <>
+class typed_primitive_inst<nv12_to_bgr> : public typed_primitive_inst_base<nv12_to_bgr>
+{
+    using parent = typed_primitive_inst_base<nv12_to_bgr>;
+
+public:
+    static layout calc_output_layout(nv12_to_bgr_node const& node);
+    static std::string to_string(nv12_to_bgr_node const& node);
+
+public:
+    typed_primitive_inst(network_impl& network, nv12_to_bgr_node const& desc);
+};
+
+using nv12_to_bgr_inst = typed_primitive_inst<nv12_to_bgr>;
+}
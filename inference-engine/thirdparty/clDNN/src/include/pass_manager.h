@@ -19,6 +19,8 @@
 #include "program_impl.h"
 #include "layout_optimizer.h"
 
+#include <chrono>
+
 namespace cldnn
 {
     class base_pass
@@ -47,7 +49,9 @@ namespace cldnn
         }
         void run(program_impl& p, base_pass& pass)
         {
+            auto start = std::chrono::high_resolution_clock::now();
             pass.run(p);
+            pass_timings.emplace_back(pass.get_name(), std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start));
             std::string dump_file_name;
             if (pass_count < 10)
                 dump_file_name += "0";
@@ -58,9 +62,12 @@ namespace cldnn
         }
         uint32_t get_pass_count() { return pass_count; }
         uint32_t inc_pass_count() { return ++pass_count; }
+        // the time taken by every pass run, in the order of the runs
+        const std::vector<std::pair<std::string, std::chrono::microseconds>>& get_pass_timings() const { return pass_timings; }
         ~pass_manager() {}
     private:
         uint32_t pass_count;
+        std::vector<std::pair<std::string, std::chrono::microseconds>> pass_timings;
     };
 
     class add_required_reorders : public base_pass
@@ -242,11 +249,18 @@ namespace cldnn
         void handle_constant(program_impl& prog, program_node& node);
         void add_constant(program_impl& prog, program_node& node);
         void add_deps_to_tpl(program_impl& prog, const std::vector<program_node*>& node);
+        bool reuse_weights_reorder(program_impl& prog, program_node& node);
+        bool calculate_on_host(program_impl& prog, program_node& node);
 
         bool has_non_trivial_constants = false;
         std::list<typed_program_node<data>*> const_inputs;
         std::vector<primitive_id> const_outputs;
         std::set<std::shared_ptr<program_node>> nodes;
+        // the weights reorders found in the engine and the computed ones to store there, by the id of the reorder
+        std::list<std::pair<primitive_id, memory_impl::ptr>> reused_weights;
+        std::map<primitive_id, std::pair<memory_impl::ptr, std::string>> new_weights_reorders;
+        // the constants computed on the host instead of the constants network
+        std::list<std::pair<primitive_id, memory_impl::ptr>> host_results;
     };
 
     class remove_redundant_reorders : public base_pass
@@ -87,9 +87,10 @@ public:
 
     memory_impl& dep_memory(size_t index) const { return dependencies().at(index)->output_memory(); }
     memory_impl& output_memory() const { return *_output; }
+    bool has_output_memory() const { return _output != nullptr; }
     size_t inputs_memory_count() const { return _node.get_primitive()->input.size(); }
     primitive_type_id type() const { return _node.type(); }
-    primitive_id id() const { return _node.id(); }
+    const primitive_id& id() const { return _node.id(); }
     primitive_id org_id() const { return _node.get_org_primitive_id(); }
     bool can_be_optimized() const { return _node.can_be_optimized(); }
     std::shared_ptr<const primitive> desc() const { return _node.get_primitive(); }
@@ -130,6 +131,8 @@ protected:
     // but it is also possible to have, for example, only one fused primitive which will calculate multiple outputs (for example device enqueue can work in such manner)
     // in general - this member is introduced to relax logical connection between primitives which have to be executed and memories which are used by this primitive
     std::vector<std::shared_ptr<primitive_inst>> _exec_deps;
+    // the events of _exec_deps gathered for an execution, kept to not allocate the list for every execution
+    std::vector<event_impl::ptr> _exec_dep_events;
 
     //_output is optional because its initialization might be postponed (reshape_inst may either allocate it's own buffer or attach input as output
     // depending on reshape_node.is_in_place())
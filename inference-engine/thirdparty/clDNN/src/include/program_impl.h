@@ -171,6 +171,8 @@ public:
 
     void remove_nodes(std::list<program_node*>& to_remove);
     void dump_program(const char* stage, bool with_full_info, std::function<bool(program_node const&)> const& filter = nullptr) const;
+    // writes the time taken by the optimizer passes next to the graph dumps
+    void dump_pass_timings() const;
 
 private:
     uint32_t prog_id = 0;
@@ -171,12 +171,48 @@ public:
     bool is_marked(uint8_t val) const { return user_mark == val; }
     uint8_t get_user_mark() const { return user_mark; }
 
+    struct fused_activation_params
+    {
+        cldnn_activation_func activation_func = activation_none;
+        cldnn_activation_additional_params additional_params = { 0.0f, 0.0f };
+    };
+
     void set_fused_activation(cldnn_activation_func activation_func, cldnn_activation_additional_params additional_params)
     {
         fused_activation.activation_func = activation_func;
         fused_activation.additional_params = additional_params;
     }
 
+    // the first fused activation is set, the next ones are chained after it
+    void add_fused_activation(cldnn_activation_func activation_func, cldnn_activation_additional_params additional_params)
+    {
+        if (fused_activation.activation_func == activation_none)
+            set_fused_activation(activation_func, additional_params);
+        else
+        {
+            fused_activation_params fused;
+            fused.activation_func = activation_func;
+            fused.additional_params = additional_params;
+            fused_activations_chain.push_back(fused);
+        }
+    }
+
+    // the fused activations applied in turn after get_fused_activation_func()
+    const std::vector<fused_activation_params>& get_fused_activations_chain() const
+    {
+        return fused_activations_chain;
+    }
+
+    // moves the fused activations of the node after the ones of this node
+    void add_fused_activations(const program_node& node)
+    {
+        if (node.get_fused_activation_func() == activation_none)
+            return;
+        add_fused_activation(node.get_fused_activation_func(), node.get_fused_activation_params());
+        for (const auto& fused : node.get_fused_activations_chain())
+            fused_activations_chain.push_back(fused);
+    }
+
     cldnn_activation_func get_fused_activation_func() const
     {
         return fused_activation.activation_func;
@@ -275,13 +311,8 @@ protected:
 
     const primitive_id org_id;
 
-    struct fused_activation_params
-    {
-        cldnn_activation_func activation_func = activation_none;
-        cldnn_activation_additional_params additional_params = { 0.0f, 0.0f };
-    };
-
     fused_activation_params fused_activation;
+    std::vector<fused_activation_params> fused_activations_chain;
 
     void invalidate_users() const;
 };
@@ -29,12 +29,38 @@ primitive_type_id lstm_type_id()
 }
 
 
+bool lstm_node::fused_sequence() const
+{
+    auto desc = get_primitive();
+    // a single direction of a sequence concatenated along the feature, the stacked layers are expanded
+    if (desc->input.size() != 1 || !desc->peepholes.empty())
+        return false;
+    for (auto user : get_users())
+    {
+        if (user->is_type<lstm>())
+            return false;
+    }
+
+    auto input_layout = input().get_output_layout();
+    if (input_layout.format != format::bfyx || input_layout.size.spatial[1] != 1 ||
+        (input_layout.data_type != data_types::f32 && input_layout.data_type != data_types::f16))
+        return false;
+    if (weights().get_output_layout().size.feature[0] != 1 || recurrent().get_output_layout().size.feature[0] != 1)
+        return false;
+    if (initial_hidden_term() && inital_hidden().get_output_layout().size.spatial[1] != 1)
+        return false;
+    if (initial_cell_term() && inital_cell().get_output_layout().size.spatial[1] != 1)
+        return false;
+    return true;
+}
+
 layout lstm_inst::calc_output_layout(lstm_node const& node)
 {
     assert((bool)node.get_primitive()->output_data_type == false
            && "Output data type forcing is not supported for lstm_node!");
+    auto desc = node.get_primitive();
     auto input_layout = node.input().get_output_layout();
-    auto hidden_layout = node.inital_hidden().get_output_layout();
+    auto recurrent_layout = node.recurrent().get_output_layout();
 
     // input     = [ batch,  sequence,       direction,      input_size ]
     // weights   = [     1, direction, 4 * hidden_size,      input_size ]
@@ -43,9 +69,17 @@ layout lstm_inst::calc_output_layout(lstm_node const& node)
     // hidden    = [ batch,         1,       direction,     hidden_size ]
     // cell      = [ batch,         1,       direction,     hidden_size ]
     // output    = [ batch,  sequence,       direction,     hidden_size ]
-	auto result = layout(input_layout.data_type, format::bfyx,
-                  tensor(hidden_layout.size.feature[0], input_layout.size.feature[0],
-                         hidden_layout.size.spatial[0], hidden_layout.size.spatial[1]));
+    // the output has the hidden of every step or of the last one, the last cell follows it if it is selected
+    bool emit_last_cell = desc->output_selection == cldnn_lstm_output_hidden_cell ||
+        desc->output_selection == cldnn_lstm_output_sequence_cell;
+    bool emit_sequence = desc->output_selection == cldnn_lstm_output_sequence_cell ||
+        desc->output_selection == cldnn_lstm_output_sequence;
+    auto sequence_len = desc->input.size() > 1 ? static_cast<int32_t>(desc->input.size()) : input_layout.size.feature[0];
+    auto output_len = (emit_sequence ? sequence_len : 1) + (emit_last_cell ? 1 : 0);
+
+    auto result = layout(input_layout.data_type, format::bfyx,
+                  tensor(input_layout.size.batch[0], output_len,
+                         recurrent_layout.size.spatial[0], recurrent_layout.size.feature[0]));
     return result;
 }
 
@@ -29,10 +29,11 @@
 #include "gpu/memory_gpu.h"
 namespace cldnn
 {
-    memory_record::memory_record(memory_set users, refcounted_obj_ptr<memory_impl>& memory, uint32_t net_id) :
+    memory_record::memory_record(memory_set users, refcounted_obj_ptr<memory_impl>& memory, uint32_t net_id, uint16_t stream_id) :
         _users(users)
         , _memory(memory)
         , _network_id(net_id)
+        , _stream_id(stream_id)
     {}
 
     memory_impl::ptr memory_pool::alloc_memory(const layout& layout)
@@ -90,12 +91,12 @@ namespace cldnn
         return !intersection.empty();
     }
 
-    memory_impl::ptr memory_pool::get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions)
+    memory_impl::ptr memory_pool::get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions, uint16_t stream_id)
     {
         auto it = _non_padded_pool.lower_bound(layout.bytes_count());
         while (it != _non_padded_pool.end())
         {
-            if (!has_conflict(it->second._users, restrictions, network_id))
+            if (it->second._stream_id == stream_id && !has_conflict(it->second._users, restrictions, network_id))
             {
                 it->second._users.insert(memory_user( id, network_id ));
                 auto ret_mem = _engine->reinterpret_buffer(*it->second._memory, layout);
@@ -107,14 +108,14 @@ namespace cldnn
         // didn't find anything for you? create new resource
         auto mem = alloc_memory(layout);
         {
-            _non_padded_pool.emplace(layout.bytes_count(), memory_record({ {id, network_id } }, mem, network_id));
+            _non_padded_pool.emplace(layout.bytes_count(), memory_record({ {id, network_id } }, mem, network_id, stream_id));
             // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
             _engine->release();
         }
         return mem;
     }
 
-    memory_impl::ptr memory_pool::get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions)
+    memory_impl::ptr memory_pool::get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions, uint16_t stream_id)
     {
         auto first_level_cache = _padded_pool.find(layout);
         
@@ -122,7 +123,8 @@ namespace cldnn
         {
             for (auto& rec_list : first_level_cache->second)
             {
-                if (layout.size.feature[0] <= rec_list._memory->get_layout().size.feature[0] &&
+                if (rec_list._stream_id == stream_id &&
+                    layout.size.feature[0] <= rec_list._memory->get_layout().size.feature[0] &&
                     layout.size.batch[0] <= rec_list._memory->get_layout().size.batch[0] &&
                     !has_conflict(rec_list._users, restrictions, network_id))
                 {
@@ -132,13 +134,13 @@ namespace cldnn
                 }
             }
             auto mem = alloc_memory(layout);
-            first_level_cache->second.emplace_back(memory_record({ { id, network_id } }, mem, network_id));
+            first_level_cache->second.emplace_back(memory_record({ { id, network_id } }, mem, network_id, stream_id));
             // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
             _engine->release();
             return mem;            
         }
         auto mem = alloc_memory(layout);
-        std::list<memory_record> list = { memory_record({ { id, network_id } },mem, network_id) };
+        std::list<memory_record> list = { memory_record({ { id, network_id } },mem, network_id, stream_id) };
         _padded_pool.emplace(layout, std::move(list));
         // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
         _engine->release();
@@ -148,13 +150,13 @@ namespace cldnn
     /*
         This is not reusable within one network or it's internal micronetworks. But we can use this memory records between networks.
     */
-    memory_impl::ptr memory_pool::get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t network_id)
+    memory_impl::ptr memory_pool::get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t network_id, uint16_t stream_id)
     {
         auto it = _no_reusable_pool.lower_bound(layout.bytes_count());
 
         while (it != _no_reusable_pool.end())
         {
-            if (it->second._network_id != network_id) // don't use non reusable resources within the same network
+            if (it->second._network_id != network_id && it->second._stream_id == stream_id) // don't use non reusable resources within the same network
             {
                 if (!has_conflict(it->second._users, {}, network_id))
                 {
@@ -167,7 +169,7 @@ namespace cldnn
         }
         auto mem = alloc_memory(layout);
         {
-            _no_reusable_pool.emplace(layout.bytes_count(), memory_record({ { id, network_id } }, mem, network_id));
+            _no_reusable_pool.emplace(layout.bytes_count(), memory_record({ { id, network_id } }, mem, network_id, stream_id));
             // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
             _engine->release();
         }
@@ -179,17 +181,17 @@ namespace cldnn
         return alloc_memory(layout);
     }
 
-    memory_impl::ptr memory_pool::get_memory(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions, bool reusable_across_network)
+    memory_impl::ptr memory_pool::get_memory(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions, bool reusable_across_network, uint16_t stream_id)
     {
         if (reusable_across_network) //reusable within the same network
         {
             if (!layout.format.is_image() && layout.data_padding == padding{ { 0,0,0,0 }, 0 }) // non-padded buffers
             {
-                return get_from_non_padded_pool(layout, id, network_id, restrictions);
+                return get_from_non_padded_pool(layout, id, network_id, restrictions, stream_id);
             }
             else if (!layout.format.is_image()) // padded buffers
             {
-                return get_from_padded_pool(layout, id, network_id, restrictions);
+                return get_from_padded_pool(layout, id, network_id, restrictions, stream_id);
             }
             else  // images
             {
@@ -199,7 +201,7 @@ namespace cldnn
         }
         else
         {
-            return get_from_across_networks_pool(layout, id, network_id);
+            return get_from_across_networks_pool(layout, id, network_id, stream_id);
         }
     }
 
@@ -31,6 +31,7 @@
 #include <algorithm>
 
 #include "gpu/ocl_toolkit.h"
+#include "gpu/memory_gpu.h"
 
 
 //#define DEBUG_DUMP_PATH "/tmp/dump/"
@@ -38,6 +39,7 @@
 
 #ifdef DEBUG_DUMP_PATH
 #include <iomanip>
+#include <set>
 #include <fstream>
 
 #define DUMP_VERBOSE 0
@@ -160,9 +162,10 @@ static float convert_half_to_float(half_t val, bool flush_denorm_to_zero = false
 /*
 Network_impl will always have net_id = 0 when it will be cldnn internal micronetwork (created i.e by propagate_constants opt pass).
 */
-network_impl::network_impl(const program_impl& program, bool is_internal)
+network_impl::network_impl(const program_impl& program, bool is_internal, uint16_t stream_id)
     : _program(&program)
     , _internal(is_internal)
+    , _stream_id(stream_id)
 {
     static std::atomic<uint32_t> id_gen{ 0 };
     if (!_internal)
@@ -205,7 +208,7 @@ void network_impl::reset_execution(bool wait)
         for (auto& pair : _events)
         {
             auto& ev = pair.second;
-            if (ev->is_set())
+            if (!ev || ev->is_set())
                 continue;
 
             events.push_back(ev);
@@ -213,7 +216,9 @@ void network_impl::reset_execution(bool wait)
 
         get_engine().wait_for_events(events);
     }
-    _events.clear();
+    // the entries are kept for the next execution, so it does not allocate them again
+    for (auto& pair : _events)
+        pair.second.reset(nullptr, false);
 }
 
 void network_impl::set_input_data(const primitive_id& id, memory_impl& data)
@@ -329,6 +334,36 @@ void network_impl::build_exec_order()
         {
             add_to_exec_order(node->id());
         }
+
+        //Special handling for mutable data. The event should be the same as the user or dependency with highest processing_num as
+        //the mutable_data can be updated when is both user or dependency. The order is fixed, so the source is found once.
+        if (node->is_type<mutable_data>())
+        {
+            decltype(_program->get_processing_order().get_processing_number(node)) proc_num = 0;
+            const program_node* source = nullptr;
+            for (auto& user : node->get_users())
+            {
+                auto user_proc_num = _program->get_processing_order().get_processing_number(user);
+                if (user_proc_num > proc_num)
+                {
+                    source = user;
+                    proc_num = user_proc_num;
+                }
+            }
+
+            for (auto& dep : node->get_dependencies())
+            {
+                auto dep_proc_num = _program->get_processing_order().get_processing_number(dep);
+                if (dep_proc_num > proc_num)
+                {
+                    source = dep;
+                    proc_num = dep_proc_num;
+                }
+            }
+
+            if (source != nullptr)
+                _mutable_data_events.emplace_back(node->id(), source->id());
+        }
     }
 }
 void network_impl::add_to_exec_order(const primitive_id& id)
@@ -342,6 +377,10 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
     //Wait for previous execution completion
     reset_execution(false);
 
+    // the dependencies may come from the other queues, e.g. the uploads of the inputs, so the queue waits for them
+    if (!events.empty())
+        get_engine().get_context()->enqueue_wait(_stream_id, events);
+
     for (auto& inst : _exec_order)
     {
 #ifdef DEBUG_DUMP_PATH
@@ -370,45 +409,18 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
         {
             log_memory_to_file(get_primitive(inst->id())->output_memory(), layer_name + "_dst_0");
         }
-        get_engine().flush_network();
+        get_engine().flush_network(_stream_id);
 #endif
     }
 
-    for (auto& inst : _program->get_processing_order())
+    for (auto& mutable_data_event : _mutable_data_events)
     {
-        //Special handling for mutable data. The event should be the same as the user or dependency with highest processing_num as
-        //the mutable_data can be updated when is both user or dependency.
-        if (inst->is_type<mutable_data>())
-        {
-            decltype(_program->get_processing_order().get_processing_number(inst)) proc_num = 0;
-            for (auto& user : inst->get_users())
-            {
-                auto user_proc_num = _program->get_processing_order().get_processing_number(user);
-                if (user_proc_num > proc_num)
-                {
-                    _events[inst->id()] = _events[user->id()];
-                    proc_num = user_proc_num;
-                }
-            }
-
-            if (!inst->get_dependencies().empty())
-            {
-                for (auto& dep : inst->get_dependencies())
-                {
-                    auto dep_proc_num = _program->get_processing_order().get_processing_number(dep);
-                    if (dep_proc_num > proc_num)
-                    {
-                        _events[inst->id()] = _events[dep->id()];
-                        proc_num = dep_proc_num;
-                    }
-                }
-            }
-        }
+        _events[mutable_data_event.first] = _events[mutable_data_event.second];
     }
 
     for (auto& dout : _data_outputs) //data primitives are not executed so if they are marked as output we need to add them valid events manually
     {
-        _events[dout->id()] = get_engine().create_user_event(true);
+        _events[dout->id()] = get_engine().create_user_event(true, _stream_id);
     }
 
     for (auto& prim : _primitives)
@@ -416,12 +428,14 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
         prim.second->reset_output_change();
     }
 
-    get_engine().get_context()->reset_events();
+    get_engine().get_context()->reset_events(_stream_id);
 
     // Using output of previouse network as input to another one may cause hazard (in OOOQ mode) if user would not
     // provide proper event to execution. Flushing pipeline should prevent this kind of issues.
     // In scenarios with a big number of very small networks it can provide performance drop.
-    get_engine().flush_network();
+    // An in-order queue executes the networks in the order they are enqueued, and waiting for an output flushes it.
+    if (!get_engine().get_context()->is_in_order_queue())
+        get_engine().flush_network(_stream_id);
 }
 
 std::vector<primitive_id> network_impl::get_output_ids() const
@@ -465,6 +479,35 @@ std::vector<primitive_id> network_impl::get_all_primitive_org_ids() const
     return ret;
 }
 
+uint64_t network_impl::get_used_device_memory_size() const
+{
+    // the primitives reusing a pooled buffer reinterpret the same allocation, so every allocation is counted once
+    std::set<cl_mem> allocations;
+    uint64_t size = 0;
+    for (auto const& primitive : _primitives)
+    {
+        // the inputs are the user memory
+        if (primitive.second->type() == input_layout::type_id() || !primitive.second->has_output_memory())
+            continue;
+
+        auto& memory = primitive.second->output_memory();
+        cl_mem allocation = nullptr;
+        size_t allocation_size = memory.size();
+        if (auto buffer = dynamic_cast<const gpu::gpu_buffer*>(&memory))
+        {
+            allocation = buffer->get_buffer().get();
+            allocation_size = buffer->get_buffer().getInfo<CL_MEM_SIZE>();
+        }
+        else if (auto image = dynamic_cast<const gpu::gpu_image2d*>(&memory))
+        {
+            allocation = image->get_buffer().get();
+        }
+        if (allocation == nullptr || allocations.insert(allocation).second)
+            size += allocation_size;
+    }
+    return size;
+}
+
 std::shared_ptr<primitive_inst> network_impl::get_primitive(const primitive_id& id)
 {
     if (!_primitives.count(id))
@@ -489,17 +532,15 @@ std::vector<std::shared_ptr<primitive_inst>> network_impl::get_primitives(const
 
 void network_impl::execute_primitive(const std::shared_ptr<primitive_inst>& primitive, const std::vector<refcounted_obj_ptr<event_impl>>& events)
 {
-    auto id = primitive->id();
-    auto it = _events.find(id);
-    bool found = (it != _events.end());
+    const auto& id = primitive->id();
+    auto& ev = _events[id];
+    bool found = static_cast<bool>(ev);
     CLDNN_ERROR_BOOL(id, "Invalid primitive call ", found, "Primitive " + id + " is tried to be executed for the second time");
 
-    event_impl::ptr ev;
     if (!get_engine().get_context()->enabled_single_kernel() || get_engine().get_context()->single_kernel_name() == id)
         ev = primitive->execute(events);
     else
-        ev = get_engine().create_user_event(true);
-    _events.insert({ id, ev });
+        ev = get_engine().create_user_event(true, _stream_id);
 }
 
 void network_impl::allocate_primitive_instance(program_node const& node)
@@ -0,0 +1,72 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "nv12_to_bgr_inst.h"
+
+#include "primitive_type_base.h"
+#include "error_handler.h"
+#include "json_object.h"
+
+namespace cldnn
+{
+primitive_type_id nv12_to_bgr_type_id()
+{
+    static primitive_type_base<nv12_to_bgr> instance;
+    return &instance;
+}
+
+layout nv12_to_bgr_inst::calc_output_layout(nv12_to_bgr_node const& node)
+{
+    auto desc = node.get_primitive();
+    auto input_layout = node.input().get_output_layout();
+
+    if (input_layout.data_type != data_types::u8)
+        CLDNN_ERROR_MESSAGE(node.id(), "NV12 frames are u8");
+    CLDNN_ERROR_NOT_EQUAL(node.id(), "Input feature", input_layout.size.feature[0], "expected feature", 1, "NV12 frames have one plane of bytes");
+    if (input_layout.size.spatial[1] % 3 != 0 || input_layout.size.spatial[0] % 2 != 0)
+        CLDNN_ERROR_MESSAGE(node.id(), "The NV12 frame of the even width and height takes 3/2 of its height. Actual input size is " +
+            std::to_string(input_layout.size.spatial[0]) + "x" + std::to_string(input_layout.size.spatial[1]));
+    CLDNN_ERROR_NOT_EQUAL(node.id(), "Output feature", desc->output_size.feature[0], "expected feature", 3, "BGR images have three channels");
+    CLDNN_ERROR_NOT_EQUAL(node.id(), "Output batch", desc->output_size.batch[0], "input batch", input_layout.size.batch[0], "");
+
+    auto output_type = desc->output_data_type ? *desc->output_data_type : data_types::f32;
+    return layout{output_type, format::bfyx, desc->output_size};
+}
+
+std::string nv12_to_bgr_inst::to_string(nv12_to_bgr_node const& node)
+{
+    auto desc = node.get_primitive();
+    auto node_info = node.desc_to_json();
+    auto& input = node.input();
+
+    std::stringstream primitive_description;
+
+    json_composite nv12_to_bgr_info;
+    nv12_to_bgr_info.add("input id", input.id());
+    nv12_to_bgr_info.add("output size", desc->output_size.to_string());
+
+    node_info->add("nv12_to_bgr info", nv12_to_bgr_info);
+    node_info->dump(primitive_description);
+
+    return primitive_description.str();
+}
+
+nv12_to_bgr_inst::typed_primitive_inst(network_impl& network, nv12_to_bgr_node const& node)
+    : parent(network, node)
+{
+}
+
+}
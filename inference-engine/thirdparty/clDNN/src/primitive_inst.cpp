@@ -41,29 +41,29 @@ uint32_t primitive_inst::get_network_id() const
 
 event_impl::ptr primitive_inst::execute(const std::vector<event_impl::ptr>& events)
 {
-    const auto primitive_id = id();
+    const auto& primitive_id = id();
     CLDNN_ERROR_BOOL(primitive_id, "Invalid/unset input", !_has_valid_input, "Cannot execute primitive " + primitive_id + " with invalid/unset input");
     on_execute();
 
     if (_exec_deps.size() == 0)
         return _impl->execute(events, *this);
 
-    std::vector<event_impl::ptr> dependencies;
-    dependencies.reserve(_exec_deps.size());
+    _exec_dep_events.clear();
     for (auto& input : _exec_deps)
     {
-        auto id = input->id();
+        const auto& id = input->id();
         try {
             // if the requested event deos not exits it means that it has not been executed, so the processing_order is wrong or synchronization failed.
-            auto ev = get_network().get_primitive_event(id);
-            dependencies.emplace_back(ev);
+            _exec_dep_events.emplace_back(get_network().get_primitive_event(id));
             }
         catch (const std::out_of_range& oor) {
             std::string temp = std::string("internal CLDNN error: execution order corrupted.") + std::string("\n") + std::string(oor.what() + std::string("\n"));
             CLDNN_ERROR_MESSAGE(id, temp);
         }
     }
-    return _impl->execute(dependencies, *this);
+    auto ev = _impl->execute(_exec_dep_events, *this);
+    _exec_dep_events.clear();
+    return ev;
 }
 
 void primitive_inst::build_deps()
@@ -128,7 +128,7 @@ memory_impl::ptr primitive_inst::allocate_output()
         (_node.can_be_optimized() ||
         _node.is_type<generic_layer>()))
     {
-        return get_network().get_engine().allocate_memory(layout, _node.id(), get_network_id(), _node.get_memory_dependencies(), false);
+        return get_network().get_engine().allocate_memory(layout, _node.id(), get_network_id(), _node.get_memory_dependencies(), false, get_network().get_stream_id());
     }
     else if (_network.is_internal() ||
              (!_node.can_share_buffer()) ||
@@ -137,7 +137,7 @@ memory_impl::ptr primitive_inst::allocate_output()
     {
         return get_network().get_engine().allocate_memory(layout);
     }
-    return get_network().get_engine().allocate_memory(layout, _node.id(), get_network_id(), _node.get_memory_dependencies(), true);
+    return get_network().get_engine().allocate_memory(layout, _node.id(), get_network_id(), _node.get_memory_dependencies(), true, get_network().get_stream_id());
 }
 
 std::vector<std::shared_ptr<primitive_inst>> primitive_inst::build_exec_deps(std::vector<std::shared_ptr<primitive_inst>> const& deps)
@@ -309,6 +309,7 @@ void program_impl::build_program(bool is_internal)
     }
     engine->compile_program(*this);
     this->dump_program("finished", true);
+    dump_pass_timings();
     cleanup();
 }
 
@@ -1136,6 +1137,24 @@ void program_impl::dump_memory_pool() const
     dump_program(dump_file_name.c_str(), true);
 }
 
+void program_impl::dump_pass_timings() const
+{
+    auto path = get_dir_path(options);
+    if (path.empty())
+    {
+        return;
+    }
+
+    std::ofstream timings(path + "cldnn_program_" + std::to_string(prog_id) + "_pass_timings.log");
+    std::chrono::microseconds total(0);
+    for (auto& pass : pm->get_pass_timings())
+    {
+        timings << pass.first << " " << pass.second.count() << " us\n";
+        total += pass.second;
+    }
+    timings << "total " << total.count() << " us\n";
+}
+
 //TODO: break this function into number of smaller ones + add per-primitive fields (possibly use primitive_inst::to_string?)
 void program_impl::dump_program(const char* stage, bool with_full_info, std::function<bool(program_node const&)> const& filter) const
 {
@@ -29,6 +29,8 @@
 #include "test_utils/test_utils.h"
 #include "test_utils/float16.h"
 #include "api/CPP/reorder.hpp"
+#include "api/CPP/eltwise.hpp"
+#include "api/CPP/scale.hpp"
 
 using namespace cldnn;
 using namespace tests;
@@ -501,3 +503,56 @@ TEST(activation_f32_fw_gpu, relu_basic_output_padding_yxfb) {
         EXPECT_FLOAT_EQ(output_vec[i], output_ptr[i]);
     }
 }
+
+TEST(activation_f32_fw_gpu, fused_chain_of_activations_and_scalar_scale) {
+    //  Input1 + Input2:
+    //  -2  1  0  3
+    //
+    //  relu, then linear 2*x+1, then scale by 3 with the bias -1
+    //
+    //  Output:
+    //  2  8  2  20
+
+    const auto& engine = get_test_engine();
+
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 4, 1 } });
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 4, 1 } });
+    auto scale_mem = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 1, 1 } });
+    auto bias_mem = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 1, 1 } });
+    set_values(input1, { -1.0f, 0.5f, 1.0f, 1.0f });
+    set_values(input2, { -1.0f, 0.5f, -1.0f, 2.0f });
+    set_values(scale_mem, { 3.0f });
+    set_values(bias_mem, { -1.0f });
+    VF<float> output_vec = { 2.0f, 8.0f, 2.0f, 20.0f };
+
+    topology topology(
+        input_layout("input1", input1.get_layout()),
+        input_layout("input2", input2.get_layout()),
+        data("scale_data", scale_mem),
+        data("bias_data", bias_mem),
+        eltwise("sum", "input1", "input2", eltwise_mode::sum),
+        activation("relu", "sum", activation_relu),
+        activation("linear", "relu", activation_linear, { 2.0f, 1.0f }),
+        scale("scale", "linear", "scale_data", "bias_data"),
+        reorder("output", "scale", format::yxfb, data_types::f32));
+
+    build_options opts;
+    opts.set_option(build_option::optimize_data(true));
+
+    network network(engine, topology, opts);
+    network.set_input_data("input1", input1);
+    network.set_input_data("input2", input2);
+    auto outputs = network.execute();
+    auto executed_primitives = network.get_executed_primitives();
+
+    // the activations and the scale are applied by the eltwise kernel
+    EXPECT_EQ(executed_primitives.count("relu"), size_t(0));
+    EXPECT_EQ(executed_primitives.count("linear"), size_t(0));
+    EXPECT_EQ(executed_primitives.count("scale"), size_t(0));
+    ASSERT_EQ(outputs.count("output"), size_t(1));
+
+    auto output_ptr = outputs.at("output").get_memory().pointer<float>();
+    for (size_t i = 0; i < output_vec.size(); ++i) {
+        EXPECT_FLOAT_EQ(output_vec[i], output_ptr[i]);
+    }
+}
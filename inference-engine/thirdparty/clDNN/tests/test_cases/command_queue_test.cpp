@@ -19,6 +19,7 @@
 #include <api/CPP/network.hpp>
 #include <api/CPP/engine.hpp>
 #include <api/CPP/input_layout.hpp>
+#include <api/CPP/program.hpp>
 #include "test_utils/test_utils.h"
 #include "api/CPP/arg_max_min.hpp"
 
@@ -162,4 +163,62 @@ TEST(command_queue_test, test_priority_and_throttle_hints) {
             throttle_mode_types::low);
     cldnn::engine engine(configuration);
     exexute_network(engine);
-}
\ No newline at end of file
+}
+
+TEST(command_queue_test, test_networks_on_separate_streams) {
+    engine_configuration configuration =
+        engine_configuration(
+            false,          // profiling
+            false,          // decorate_kernel_names
+            false,          // dump_custom_program
+            "",             // options
+            "",             // single_kernel
+            true,           // primitives_parallelisation
+            "",             // engine_log
+            "",             // sources_dumps_dir
+            priority_mode_types::disabled,
+            throttle_mode_types::disabled,
+            true,           // memory_pool
+            nullptr,        // context
+            "cache.json",   // tuning_cache_path
+            "",             // kernels_cache_dir
+            0,              // n_build_threads
+            2);             // n_streams
+    cldnn::engine engine(configuration);
+
+    auto input0 = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 4, 1, 1 } });
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 4, 1, 1 } });
+    set_values(input0, { 0.1f, 0.7f, -2.f, 0.3f });
+    set_values(input1, { 5.f, 0.7f, -2.f, 0.3f });
+
+    topology topology;
+    topology.add(input_layout("input", input0.get_layout()));
+    topology.add(arg_max_min("arg_max", "input", arg_max_min::max));
+    program program(engine, topology);
+
+    network network0(program, 0);
+    network network1(program, 1);
+    EXPECT_ANY_THROW(network(program, 2));
+
+    network0.set_input_data("input", input0);
+    network1.set_input_data("input", input1);
+    auto outputs0 = network0.execute();
+    auto outputs1 = network1.execute();
+
+    auto output0 = outputs0.at("arg_max").get_memory();
+    auto output1 = outputs1.at("arg_max").get_memory();
+    EXPECT_NE(output0, output1);
+    EXPECT_EQ(get_value<float>(output0.pointer<float>(), 0), 1.f);
+    EXPECT_EQ(get_value<float>(output1.pointer<float>(), 0), 0.f);
+}
+
+TEST(command_queue_test, test_engines_of_all_devices) {
+    const auto devices = engine::engine_count(engine_types::ocl);
+    ASSERT_GE(devices, 1u);
+    for (uint32_t device = 0; device < devices; device++)
+    {
+        cldnn::engine engine(engine_types::ocl, device);
+        exexute_network(engine);
+    }
+    EXPECT_ANY_THROW(cldnn::engine(engine_types::ocl, devices));
+}
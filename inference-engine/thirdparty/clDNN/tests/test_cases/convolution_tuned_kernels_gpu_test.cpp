@@ -0,0 +1,308 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/reorder.hpp>
+#include "test_utils/test_utils.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+
+const std::string reference_kernel = "convolution_gpu_bfyx_ref";
+
+tuning_config_options get_tuning_config(tuning_mode mode, const std::string& cache_file_path)
+{
+    tuning_config_options config;
+    config.mode = mode;
+    config.cache_file_path = cache_file_path;
+    return config;
+}
+
+// There is no option selecting the kernel of a primitive, so the kernel is forced through the on-line tuning cache:
+// the network is tuned once to get the cache entries of its convolutions, then every entry is pointed at the kernel.
+// The tuning caches are kept per file for the whole process, so every network gets its own files.
+// The engine must be created with profiling enabled to tune.
+network build_network_with_kernel(const engine& engine, const topology& topology, const std::string& kernel_name, int tune_index = 0)
+{
+    static int networks_count = 0;
+    const std::string cache_name = "tuned_kernels_cache_" + std::to_string(networks_count++);
+    const std::string tuned_cache_path = cache_name + "_tuned.json";
+    const std::string forced_cache_path = cache_name + "_forced.json";
+
+    {
+        build_options options;
+        options.set_option(build_option::tuning_config(get_tuning_config(tuning_mode::tuning_tune_and_cache, tuned_cache_path)));
+        network tuned_network(engine, topology, options);
+    }
+
+    std::stringstream tuned_cache;
+    tuned_cache << std::ifstream(tuned_cache_path).rdbuf();
+    const std::regex cache_entry("\\[\\s*\"[^\"]*\"\\s*,\\s*-?[0-9]+\\s*\\]");
+    const std::string forced_entry = "[\"" + kernel_name + "\", " + std::to_string(tune_index) + "]";
+    std::ofstream(forced_cache_path) << std::regex_replace(tuned_cache.str(), cache_entry, forced_entry);
+
+    build_options options;
+    options.set_option(build_option::tuning_config(get_tuning_config(tuning_mode::tuning_use_cache, forced_cache_path)));
+    network forced_network(engine, topology, options);
+
+    std::remove(tuned_cache_path.c_str());
+    std::remove(forced_cache_path.c_str());
+    return forced_network;
+}
+
+bool uses_kernel(const network& network, const primitive_id& id, const std::string& kernel_name)
+{
+    return network.get_primitive_info(id).find(kernel_name) != std::string::npos;
+}
+
+} // namespace
+
+using TestParamType_winograd_4x4_3x3_s1 = ::testing::tuple<int,   // 0 - Input size
+                                                           int,   // 1 - Input features
+                                                           int,   // 2 - Output features
+                                                           int,   // 3 - Tune index
+                                                           bool>; // 4 - With bias
+
+struct convolution_winograd_4x4_3x3_s1_gpu : public ::testing::TestWithParam<TestParamType_winograd_4x4_3x3_s1>
+{
+    static std::string
+    PrintToStringParamName(testing::TestParamInfo<TestParamType_winograd_4x4_3x3_s1> param_info)
+    {
+        // construct a readable name
+        return std::to_string(testing::get<0>(param_info.param))
+            + 'x' + std::to_string(testing::get<0>(param_info.param))
+            + "_f" + std::to_string(testing::get<1>(param_info.param))
+            + "_ofm" + std::to_string(testing::get<2>(param_info.param))
+            + "_tune" + std::to_string(testing::get<3>(param_info.param))
+            + (testing::get<4>(param_info.param) ? "_bias" : "");
+    }
+};
+
+TEST_P(convolution_winograd_4x4_3x3_s1_gpu, same_output_as_reference_kernel)
+{
+    const int in_B = 2;
+    const int in_XY = testing::get<0>(GetParam());
+    const int in_F = testing::get<1>(GetParam());
+    const int out_F = testing::get<2>(GetParam());
+    const int tune_index = testing::get<3>(GetParam());
+    const bool with_bias = testing::get<4>(GetParam());
+
+    engine engine(engine_configuration(true));
+
+    auto input = memory::allocate(engine, {data_types::f32, format::bfyx, {in_B, in_F, in_XY, in_XY}});
+    auto weights = memory::allocate(engine, {data_types::f32, format::bfyx, {out_F, in_F, 3, 3}});
+    auto bias = memory::allocate(engine, {data_types::f32, format::bfyx, {1, 1, out_F, 1}});
+
+    std::vector<float> input_data(input.get_layout().count());
+    for (size_t i = 0; i < input_data.size(); i++)
+        input_data[i] = static_cast<float>(static_cast<int>(i % 13) - 6) / 8.f;
+    std::vector<float> weights_data(weights.get_layout().count());
+    for (size_t i = 0; i < weights_data.size(); i++)
+        weights_data[i] = static_cast<float>(static_cast<int>(i % 7) - 3) / 4.f;
+    std::vector<float> bias_data(out_F);
+    for (size_t i = 0; i < bias_data.size(); i++)
+        bias_data[i] = static_cast<float>(i) / 4.f - 1.f;
+    set_values(input, input_data);
+    set_values(weights, weights_data);
+    set_values(bias, bias_data);
+
+    // the output keeps the size of the input, so a part of the border tiles is out of the output when it is not a multiple of 4
+    topology topology(input_layout("input", input.get_layout()), data("weights", weights));
+    if (with_bias)
+    {
+        topology.add(data("bias", bias),
+                     convolution("conv", "input", {"weights"}, {"bias"}, {1, 1, 1, 1}, {0, 0, -1, -1}));
+    }
+    else
+    {
+        topology.add(convolution("conv", "input", {"weights"}, {1, 1, 1, 1}, {0, 0, -1, -1}));
+    }
+
+    network ref_network = build_network_with_kernel(engine, topology, reference_kernel);
+    network winograd_network = build_network_with_kernel(engine, topology, "convolution_gpu_winograd_4x4_3x3_s1", tune_index);
+    ASSERT_TRUE(uses_kernel(ref_network, "conv", reference_kernel));
+    ASSERT_TRUE(uses_kernel(winograd_network, "conv", "convolution_gpu_winograd_4x4_3x3_s1"));
+
+    ref_network.set_input_data("input", input);
+    winograd_network.set_input_data("input", input);
+    auto ref_outputs = ref_network.execute();
+    auto winograd_outputs = winograd_network.execute();
+
+    auto ref_ptr = ref_outputs.at("conv").get_memory().pointer<float>();
+    auto winograd_ptr = winograd_outputs.at("conv").get_memory().pointer<float>();
+
+    ASSERT_EQ(ref_ptr.size(), winograd_ptr.size());
+    for (size_t i = 0; i < ref_ptr.size(); i++)
+    {
+        // the transforms of the tiles round differently from the direct sums
+        ASSERT_NEAR(ref_ptr[i], winograd_ptr[i], 1e-3f * std::max(1.f, std::abs(ref_ptr[i]))) << "at " << i;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(convolution_winograd_4x4_3x3_s1,
+                        convolution_winograd_4x4_3x3_s1_gpu,
+                        ::testing::Values(
+                            // Input size, Input features, Output features, Tune index, With bias
+                            TestParamType_winograd_4x4_3x3_s1(12, 8, 16, 0, false),
+                            TestParamType_winograd_4x4_3x3_s1(12, 8, 16, 0, true),
+                            TestParamType_winograd_4x4_3x3_s1(10, 8, 16, 3, true),
+                            TestParamType_winograd_4x4_3x3_s1(10, 3, 16, 6, false),
+                            TestParamType_winograd_4x4_3x3_s1(7, 3, 4, 6, true),
+                            TestParamType_winograd_4x4_3x3_s1(17, 16, 6, 3, true)
+                        ),
+                        convolution_winograd_4x4_3x3_s1_gpu::PrintToStringParamName);
+
+using TestParamType_imad_b_fs_yx_fsv4_dw = ::testing::tuple<int,   // 0 - Filter size
+                                                            int,   // 1 - Features
+                                                            int,   // 2 - Stride
+                                                            int,   // 3 - Dilation
+                                                            int>;  // 4 - Input size
+
+struct convolution_imad_b_fs_yx_fsv4_dw_gpu : public ::testing::TestWithParam<TestParamType_imad_b_fs_yx_fsv4_dw>
+{
+    static std::string
+    PrintToStringParamName(testing::TestParamInfo<TestParamType_imad_b_fs_yx_fsv4_dw> param_info)
+    {
+        // construct a readable name
+        return std::to_string(testing::get<0>(param_info.param))
+            + 'x' + std::to_string(testing::get<0>(param_info.param))
+            + "_f" + std::to_string(testing::get<1>(param_info.param))
+            + "_stride" + std::to_string(testing::get<2>(param_info.param))
+            + "_dilation" + std::to_string(testing::get<3>(param_info.param))
+            + "_in" + std::to_string(testing::get<4>(param_info.param));
+    }
+
+    // the depthwise convolution is split in a group per feature, the input is reordered to the format of the convolution
+    // and the output back to bfyx. Every topology gets its own data, as the split data is merged when the network is built
+    topology make_topology(const engine& engine, const memory& input, format conv_format) const
+    {
+        const int filter = testing::get<0>(GetParam());
+        const int features = testing::get<1>(GetParam());
+        const int stride = testing::get<2>(GetParam());
+        const int dilation = testing::get<3>(GetParam());
+        const int offset = -(filter / 2) * dilation;
+
+        const auto& input_size = input.get_layout().size;
+        topology topology(input_layout("input", input.get_layout()),
+                          reorder("reorder_in", "input", layout(data_types::i8, conv_format, input_size)));
+
+        std::vector<primitive_id> weights_ids, bias_ids, quant_ids, calib_ids;
+        for (int f = 0; f < features; f++)
+        {
+            auto weights = memory::allocate(engine, {data_types::i8, format::bfyx, {1, 1, filter, filter}});
+            std::vector<char> weights_data(filter * filter);
+            for (size_t i = 0; i < weights_data.size(); i++)
+                weights_data[i] = static_cast<char>(static_cast<int>((f + i) % 5) - 2);
+            set_values(weights, std::move(weights_data));
+
+            auto bias = memory::allocate(engine, {data_types::f32, format::bfyx, {1, 1, 1, 1}});
+            auto quant = memory::allocate(engine, {data_types::f32, format::bfyx, {1, 1, 1, 1}});
+            auto calib = memory::allocate(engine, {data_types::f32, format::bfyx, {1, 1, 1, 1}});
+            set_values(bias, {0.1f * (f % 9) - 0.4f});
+            set_values(quant, {0.3f + 0.01f * (f % 50)});
+            set_values(calib, {0.2f + 0.02f * (f % 30)});
+
+            const std::string suffix = "_" + std::to_string(f);
+            weights_ids.push_back("weights" + suffix);
+            bias_ids.push_back("bias" + suffix);
+            quant_ids.push_back("quant" + suffix);
+            calib_ids.push_back("calib" + suffix);
+            topology.add(data(weights_ids.back(), weights),
+                         data(bias_ids.back(), bias),
+                         data(quant_ids.back(), quant),
+                         data(calib_ids.back(), calib));
+        }
+
+        topology.add(convolution("conv",
+                                 "reorder_in",
+                                 weights_ids,
+                                 bias_ids,
+                                 quant_ids,
+                                 calib_ids,
+                                 1.0f,
+                                 {1, 1, stride, stride},
+                                 {0, 0, offset, offset},
+                                 {1, 1, dilation, dilation}),
+                     reorder("reorder_out", "conv", format::bfyx, data_types::i8));
+        return topology;
+    }
+};
+
+TEST_P(convolution_imad_b_fs_yx_fsv4_dw_gpu, same_output_as_reference_kernel)
+{
+    const int in_B = 2;
+    const int in_F = testing::get<1>(GetParam());
+    const int in_XY = testing::get<4>(GetParam());
+
+    engine engine(engine_configuration(true));
+
+    auto input = memory::allocate(engine, {data_types::i8, format::bfyx, {in_B, in_F, in_XY, in_XY}});
+    std::vector<char> input_data(input.get_layout().count());
+    for (size_t i = 0; i < input_data.size(); i++)
+        input_data[i] = static_cast<char>(static_cast<int>(i % 7) - 3);
+    set_values(input, std::move(input_data));
+
+    network ref_network = build_network_with_kernel(engine, make_topology(engine, input, format::bfyx), reference_kernel);
+    network imad_network = build_network_with_kernel(engine, make_topology(engine, input, format::b_fs_yx_fsv4),
+                                                     "convolution_gpu_imad_b_fs_yx_fsv4_dw");
+    ASSERT_TRUE(uses_kernel(ref_network, "conv", reference_kernel));
+    ASSERT_TRUE(uses_kernel(imad_network, "conv", "convolution_gpu_imad_b_fs_yx_fsv4_dw"));
+
+    ref_network.set_input_data("input", input);
+    imad_network.set_input_data("input", input);
+    auto ref_outputs = ref_network.execute();
+    auto imad_outputs = imad_network.execute();
+
+    auto ref_ptr = ref_outputs.at("reorder_out").get_memory().pointer<char>();
+    auto imad_ptr = imad_outputs.at("reorder_out").get_memory().pointer<char>();
+
+    ASSERT_EQ(ref_ptr.size(), imad_ptr.size());
+    for (size_t i = 0; i < ref_ptr.size(); i++)
+    {
+        ASSERT_EQ(ref_ptr[i], imad_ptr[i]) << "at " << i;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(convolution_imad_b_fs_yx_fsv4_dw,
+                        convolution_imad_b_fs_yx_fsv4_dw_gpu,
+                        ::testing::Values(
+                            // Filter size, Features, Stride, Dilation, Input size
+                            TestParamType_imad_b_fs_yx_fsv4_dw(3, 32, 1, 1, 20),
+                            TestParamType_imad_b_fs_yx_fsv4_dw(3, 32, 2, 1, 20),
+                            TestParamType_imad_b_fs_yx_fsv4_dw(3, 32, 1, 2, 20),
+                            TestParamType_imad_b_fs_yx_fsv4_dw(5, 32, 1, 1, 20),
+                            TestParamType_imad_b_fs_yx_fsv4_dw(5, 32, 2, 2, 20),
+                            TestParamType_imad_b_fs_yx_fsv4_dw(3, 18, 1, 1, 13),
+                            TestParamType_imad_b_fs_yx_fsv4_dw(7, 16, 2, 1, 9)
+                        ),
+                        convolution_imad_b_fs_yx_fsv4_dw_gpu::PrintToStringParamName);
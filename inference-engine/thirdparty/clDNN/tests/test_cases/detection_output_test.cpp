@@ -1013,3 +1013,83 @@ TYPED_TEST(detection_output_test, test_detection_output_sort_gpu)
     this->check_results(output_prim, 19, "-1 0 0 0 0 0 0");
 }
 
+
+namespace {
+
+// Runs the detection output of the overlapping priors of a grid on the host or on the GPU
+std::vector<float> run_detection_output_grid(bool runOnGPU, int top_k)
+{
+    const int num_of_images = 2;
+    const int num_classes = 3;
+    const int grid_size = 25;
+    const int num_priors = grid_size * grid_size;
+    const int keep_top_k = 50;
+
+    const auto& engine = get_test_engine();
+    memory input_location = memory::allocate(engine, { data_types::f32, format::bfyx,{ num_of_images, num_priors * 4, 1, 1 } });
+    memory input_confidence = memory::allocate(engine, { data_types::f32, format::bfyx,{ num_of_images, num_priors * num_classes, 1, 1 } });
+    memory input_prior_box = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 2, 1, num_priors * 4 } });
+
+    {
+        auto prior_ptr = input_prior_box.pointer<float>();
+        auto confidence_ptr = input_confidence.pointer<float>();
+        auto location_ptr = input_location.pointer<float>();
+
+        // the boxes of the neighbour priors overlap, the variances follow the boxes
+        for (int p = 0; p < num_priors; p++)
+        {
+            const float center_x = (p % grid_size + 0.5f) / grid_size;
+            const float center_y = (p / grid_size + 0.5f) / grid_size;
+            prior_ptr[p * 4 + 0] = center_x - 0.06f;
+            prior_ptr[p * 4 + 1] = center_y - 0.06f;
+            prior_ptr[p * 4 + 2] = center_x + 0.06f;
+            prior_ptr[p * 4 + 3] = center_y + 0.06f;
+            for (int i = 0; i < 4; i++)
+                prior_ptr[num_priors * 4 + p * 4 + i] = 0.1f;
+        }
+        // the scores of a class are distinct, so the order of the kept boxes does not depend on the sort
+        for (int i = 0; i < num_of_images; i++)
+            for (int p = 0; p < num_priors; p++)
+                for (int c = 0; c < num_classes; c++)
+                    confidence_ptr[(i * num_priors + p) * num_classes + c] =
+                        static_cast<float>((p * 7 + c * 101 + i * 13) % num_priors) / num_priors;
+        for (int i = 0; i < num_of_images * num_priors * 4; i++)
+            location_ptr[i] = static_cast<float>(i % 11) / 11.f - 0.5f;
+    }
+
+    topology topology;
+    topology.add(input_layout("input_location", input_location.get_layout()));
+    topology.add(input_layout("input_confidence", input_confidence.get_layout()));
+    topology.add(input_layout("input_prior_box", input_prior_box.get_layout()));
+    topology.add(detection_output("detection_output", "input_location", "input_confidence", "input_prior_box",
+                                  num_classes, keep_top_k, true, 0, 0.45f, top_k));
+
+    build_options opts;
+    if (runOnGPU)
+    {
+        opts.set_option(build_option::detection_output_gpu(true));
+    }
+
+    network network(engine, topology, opts);
+    network.set_input_data("input_location", input_location);
+    network.set_input_data("input_confidence", input_confidence);
+    network.set_input_data("input_prior_box", input_prior_box);
+
+    auto outputs = network.execute();
+    auto output_ptr = outputs.at("detection_output").get_memory().pointer<float>();
+    return std::vector<float>(output_ptr.begin(), output_ptr.end());
+}
+
+}  // namespace
+
+TEST(detection_output_gpu_f32, grid_top_k_matches_cpu)
+{
+    const auto expected = run_detection_output_grid(false, 200);
+    const auto actual = run_detection_output_grid(true, 200);
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_NEAR(expected[i], actual[i], 1e-4f) << " at " << i;
+    }
+}
@@ -0,0 +1,85 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/event.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/reorder.hpp>
+#include <api/CPP/reshape.hpp>
+#include "test_utils/test_utils.h"
+
+#include <vector>
+
+using namespace cldnn;
+using namespace tests;
+
+TEST(events_pool_gpu, events_recycled_across_executions)
+{
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, {data_types::f32, format::bfyx, {1, 2, 2, 2}});
+    auto constant = memory::allocate(engine, {data_types::f32, format::bfyx, {1, 1, 2, 1}});
+    set_values(constant, {3.f, 4.f});
+
+    // the data output gets a set user event on every execution, the reshape may be optimized out
+    topology topology(input_layout("input", input.get_layout()),
+                      reorder("reorder", "input", input.get_layout(), std::vector<float>{1.f, 2.f}),
+                      reshape("reshape", "reorder", tensor(1, 1, 8, 1)),
+                      data("constant", constant));
+    build_options options;
+    options.set_option(build_option::outputs({"reshape", "constant"}));
+    network network(engine, topology, options);
+
+    for (int execution = 0; execution < 4; execution++)
+    {
+        std::vector<float> input_data(8);
+        for (size_t i = 0; i < input_data.size(); i++)
+            input_data[i] = static_cast<float>(10 * execution + i);
+        set_values(input, input_data);
+        network.set_input_data("input", input);
+
+        // the user event comes from the pool the network takes its events from and is set after the execution has
+        // been enqueued, so handing it out as one of the events of the execution would never complete the wait for it
+        auto user_event = event::create_user_event(engine);
+        auto outputs = network.execute({user_event});
+        user_event.set();
+
+        for (auto& executed : network.get_executed_primitives())
+            executed.second.wait();
+        outputs.at("constant").get_event().wait();
+
+        auto output_ptr = outputs.at("reshape").get_memory().pointer<float>();
+        ASSERT_EQ(input_data.size(), output_ptr.size());
+        for (size_t i = 0; i < input_data.size(); i++)
+        {
+            EXPECT_FLOAT_EQ(input_data[i] - (i < 4 ? 1.f : 2.f), output_ptr[i]) << "execution " << execution;
+        }
+
+        auto constant_ptr = outputs.at("constant").get_memory().pointer<float>();
+        EXPECT_FLOAT_EQ(3.f, constant_ptr[0]);
+        EXPECT_FLOAT_EQ(4.f, constant_ptr[1]);
+    }
+
+    // the events are dropped with the outputs when the next execution is prepared
+    network.set_input_data("input", input);
+    EXPECT_ANY_THROW(network.get_output("reshape"));
+}
@@ -357,6 +357,59 @@ TEST(fully_connected_gpu, xb_f32_batch_1) {
     EXPECT_EQ(7.0f, output_ptr[3]);
 }
 
+TEST(fully_connected_gpu, bf_f32_input_f16_weights) {
+    // The half weights are read as they are with the float input, the accumulation is done in float.
+    // The input size is not a multiple of the vector size on purpose.
+    const int32_t output_f = 3, input_x = 20, input_b = 2;
+
+    const auto& engine = get_test_engine();
+
+    auto input_prim = memory::allocate(engine, { data_types::f32, format::bfyx, { input_b, 1, input_x, 1 } });
+    auto weights_prim = memory::allocate(engine, { data_types::f16, format::bfyx, { output_f, 1, input_x, 1 } });
+    auto bias_prim = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, output_f, 1 } });
+
+    std::vector<float> input_data(input_b * input_x);
+    for (size_t i = 0; i < input_data.size(); i++)
+        input_data[i] = (static_cast<float>(i % 5) - 2.0f) * 0.5f;
+    std::vector<FLOAT16> weights_data;
+    for (int32_t o = 0; o < output_f; o++)
+        for (int32_t i = 0; i < input_x; i++)
+            weights_data.push_back(FLOAT16(static_cast<float>((o + i) % 3) - 1.0f));
+    std::vector<float> bias_data = { 1.0f, 2.0f, 3.0f };
+
+    set_values(input_prim, input_data);
+    set_values(weights_prim, weights_data);
+    set_values(bias_prim, bias_data);
+
+    topology topology(
+        input_layout("input", input_prim.get_layout()),
+        data("weights", weights_prim),
+        data("bias", bias_prim),
+        fully_connected("full_con_prim", "input", "weights", "bias")
+    );
+
+    network network(engine, topology);
+    network.set_input_data("input", input_prim);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+
+    auto output_prim = outputs.begin()->second.get_memory();
+    EXPECT_EQ(output_prim.get_layout().data_type, data_types::f32);
+    auto output_ptr = output_prim.pointer<float>();
+
+    for (int32_t b = 0; b < input_b; b++)
+    {
+        for (int32_t o = 0; o < output_f; o++)
+        {
+            float expected = bias_data[o];
+            for (int32_t i = 0; i < input_x; i++)
+                expected += input_data[b * input_x + i] * (static_cast<float>((o + i) % 3) - 1.0f);
+            EXPECT_FLOAT_EQ(expected, output_ptr[b * output_f + o]);
+        }
+    }
+}
+
 TEST(fully_connected_gpu, xb_f32_batch_2) {
     //  Input  : 3x2
     //  Output : 4x2
@@ -3250,3 +3250,99 @@ TEST(gemm_gpu, basic_smarcink2) {
     }
 }
 
+
+namespace {
+
+// Multiplies the batches of M x K by K x N matrices on the host, an input with a single batch is broadcast
+std::vector<float> reference_gemm(const std::vector<float>& a, const std::vector<float>& b, const std::vector<float>& c,
+                                  int batch0, int batch1, int M, int K, int N, bool transpose_input1, bool transpose_input2,
+                                  float alpha, float beta) {
+    const int batch = std::max(batch0, batch1);
+    std::vector<float> out(batch * M * N);
+    for (int bi = 0; bi < batch; ++bi) {
+        const float* a_ptr = a.data() + (batch0 == 1 ? 0 : bi * M * K);
+        const float* b_ptr = b.data() + (batch1 == 1 ? 0 : bi * K * N);
+        for (int m = 0; m < M; ++m) {
+            for (int n = 0; n < N; ++n) {
+                float value = 0.f;
+                for (int k = 0; k < K; ++k) {
+                    const float a_value = transpose_input1 ? a_ptr[k * M + m] : a_ptr[m * K + k];
+                    const float b_value = transpose_input2 ? b_ptr[n * K + k] : b_ptr[k * N + n];
+                    value += a_value * b_value;
+                }
+                const size_t out_idx = bi * M * N + m * N + n;
+                out[out_idx] = alpha * value + (c.empty() ? 0.f : beta * c[out_idx]);
+            }
+        }
+    }
+    return out;
+}
+
+void test_gemm_random(int batch0, int batch1, int M, int K, int N, bool transpose_input1, bool transpose_input2,
+                      bool bias) {
+    const auto& engine = get_test_engine();
+    const int batch = std::max(batch0, batch1);
+    const float alpha = 0.5f;
+    const float beta = bias ? 2.f : 0.f;
+
+    // the transposed matrices are stored as K x M and N x K
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,
+        { batch0, 1, transpose_input1 ? M : K, transpose_input1 ? K : M } });
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx,
+        { batch1, 1, transpose_input2 ? K : N, transpose_input2 ? N : K } });
+    auto input3 = memory::allocate(engine, { data_types::f32, format::bfyx, { batch, 1, N, M } });
+
+    auto input_data = generate_random_1d<float>(batch0 * M * K, -2, 2);
+    auto input_data2 = generate_random_1d<float>(batch1 * K * N, -2, 2);
+    std::vector<float> input_data3;
+    if (bias)
+        input_data3 = generate_random_1d<float>(batch * M * N, -2, 2);
+    set_values(input, input_data);
+    set_values(input2, input_data2);
+    if (bias)
+        set_values(input3, input_data3);
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(input_layout("input2", input2.get_layout()));
+    if (bias) {
+        topology.add(input_layout("input3", input3.get_layout()));
+        topology.add(gemm("output", "input", "input2", "input3", transpose_input1, transpose_input2, alpha, beta));
+    } else {
+        topology.add(gemm("output", "input", "input2", transpose_input1, transpose_input2, alpha, beta));
+    }
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    network.set_input_data("input2", input2);
+    if (bias)
+        network.set_input_data("input3", input3);
+    auto outputs = network.execute();
+
+    auto output = outputs.at("output").get_memory();
+    auto output_ptr = output.pointer<float>();
+    auto out_data = reference_gemm(input_data, input_data2, input_data3, batch0, batch1, M, K, N,
+                                   transpose_input1, transpose_input2, alpha, beta);
+
+    ASSERT_EQ(output_ptr.size(), out_data.size());
+    for (size_t i = 0; i < out_data.size(); ++i) {
+        EXPECT_NEAR(output_ptr[i], out_data[i], 1e-3f * std::max(1.f, std::abs(out_data[i]))) << " at " << i;
+    }
+}
+
+}  // namespace
+
+TEST(gemm_gpu, random_large_bfyx) {
+    test_gemm_random(2, 2, 67, 45, 81, false, false, false);
+}
+
+TEST(gemm_gpu, random_large_t1t2_bias) {
+    test_gemm_random(1, 1, 33, 70, 40, true, true, true);
+    test_gemm_random(1, 1, 33, 70, 40, true, false, true);
+    test_gemm_random(1, 1, 33, 70, 40, false, true, true);
+}
+
+TEST(gemm_gpu, random_batch_broadcast) {
+    test_gemm_random(3, 1, 20, 17, 32, false, false, false);
+    test_gemm_random(1, 3, 20, 17, 32, false, true, true);
+}
@@ -0,0 +1,219 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/activation.hpp>
+#include <api/CPP/pooling.hpp>
+#include <api/CPP/softmax.hpp>
+#include "test_utils/test_utils.h"
+
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+
+engine_configuration get_kernels_cache_configuration(const std::string& kernels_cache_dir, uint16_t n_build_threads = 0)
+{
+    return engine_configuration(
+            false,          // profiling
+            false,          // decorate_kernel_names
+            false,          // dump_custom_program
+            "",             // options
+            "",             // single_kernel
+            true,           // primitives_parallelisation
+            "",             // engine_log
+            "",             // sources_dumps_dir
+            priority_mode_types::disabled,
+            throttle_mode_types::disabled,
+            true,           // memory_pool
+            nullptr,        // context
+            "cache.json",   // tuning_cache_path
+            kernels_cache_dir,
+            n_build_threads);
+}
+
+// the network needs several OpenCL programs, as every kernel is built with its own options
+std::vector<float> execute_test_network(const engine& engine)
+{
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 6, 6 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 2, 3, 3 } });
+
+    std::vector<float> input_values(input.count());
+    for (size_t i = 0; i < input_values.size(); i++)
+        input_values[i] = static_cast<float>(i % 7) - 3.f;
+    set_values(input, input_values);
+    std::vector<float> weights_values(weights.count());
+    for (size_t i = 0; i < weights_values.size(); i++)
+        weights_values[i] = static_cast<float>(i % 5) * 0.25f - 0.5f;
+    set_values(weights, weights_values);
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("weights", weights));
+    topology.add(convolution("conv", "input", { "weights" }));
+    topology.add(activation("relu", "conv", activation_relu));
+    topology.add(pooling("pool", "relu", pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+    topology.add(softmax("softmax", "pool"));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+    auto output = outputs.at("softmax").get_memory().pointer<float>();
+    return std::vector<float>(output.begin(), output.end());
+}
+
+// two activations of the same shape and parameters run the same kernel object
+topology get_chained_activations_topology(const layout& input_layout)
+{
+    topology topology;
+    topology.add(cldnn::input_layout("input", input_layout));
+    topology.add(activation("act1", "input", activation_relu_negative_slope, { 0.5f, 0.f }));
+    topology.add(activation("act2", "act1", activation_relu_negative_slope, { 0.5f, 0.f }));
+    return topology;
+}
+
+std::vector<float> get_chained_activations_reference(const std::vector<float>& input)
+{
+    std::vector<float> reference;
+    for (auto value : input)
+        reference.push_back(value > 0.f ? value : value * 0.25f);
+    return reference;
+}
+
+std::vector<float> execute_network(network& network, const memory& input)
+{
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+    auto output = outputs.at("act2").get_memory().pointer<float>();
+    return std::vector<float>(output.begin(), output.end());
+}
+
+void expect_equal_outputs(const std::vector<float>& expected, const std::vector<float>& actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_FLOAT_EQ(expected[i], actual[i]) << "i = " << i;
+}
+
+}  // namespace
+
+//The second engine creates the programs from the binaries the first one stored in the directory
+TEST(kernels_cache, programs_loaded_from_cache_dir_give_same_outputs) {
+    const std::string cache_dir = "clDNN_kernels_cache_test";
+#ifdef _WIN32
+    _mkdir(cache_dir.c_str());
+#else
+    mkdir(cache_dir.c_str(), 0755);
+#endif
+    auto expected = execute_test_network(get_test_engine());
+
+    {
+        cldnn::engine engine(get_kernels_cache_configuration(cache_dir));
+        expect_equal_outputs(expected, execute_test_network(engine));
+    }
+    cldnn::engine engine(get_kernels_cache_configuration(cache_dir));
+    expect_equal_outputs(expected, execute_test_network(engine));
+}
+
+//The programs built by one thread and by several threads concurrently compute the same outputs
+TEST(kernels_cache, programs_built_concurrently_give_same_outputs) {
+    cldnn::engine serial_engine(get_kernels_cache_configuration("", 1));
+    auto expected = execute_test_network(serial_engine);
+
+    cldnn::engine concurrent_engine(get_kernels_cache_configuration("", 4));
+    expect_equal_outputs(expected, execute_test_network(concurrent_engine));
+}
+
+//The binaries exported from one engine are imported to another, which creates the programs from them
+TEST(kernels_cache, programs_created_from_imported_binaries_give_same_outputs) {
+    cldnn::engine exporting_engine;
+    auto expected = execute_test_network(exporting_engine);
+    auto names = exporting_engine.get_program_binary_names();
+    ASSERT_FALSE(names.empty());
+
+    cldnn::engine importing_engine;
+    for (const auto& name : names)
+    {
+        auto binary = exporting_engine.get_program_binary(name);
+        ASSERT_FALSE(binary.empty()) << name;
+        importing_engine.add_program_binary(name, binary);
+    }
+    EXPECT_EQ(names, importing_engine.get_program_binary_names());
+    expect_equal_outputs(expected, execute_test_network(importing_engine));
+}
+
+//The repeated executions set again only the arguments which changed, the swapped inputs must still be read
+TEST(kernels_cache, repeated_executions_with_swapped_inputs_give_own_outputs) {
+    const auto& engine = get_test_engine();
+    layout input_layout = { data_types::f32, format::bfyx, { 1, 2, 4, 4 } };
+    std::vector<float> values_a(input_layout.count()), values_b(input_layout.count());
+    for (size_t i = 0; i < values_a.size(); i++)
+    {
+        values_a[i] = static_cast<float>(i % 9) - 4.f;
+        values_b[i] = 4.f - static_cast<float>(i % 5);
+    }
+    auto input_a = memory::allocate(engine, input_layout);
+    auto input_b = memory::allocate(engine, input_layout);
+    set_values(input_a, values_a);
+    set_values(input_b, values_b);
+
+    network network(engine, get_chained_activations_topology(input_layout));
+    for (int i = 0; i < 2; i++)
+    {
+        expect_equal_outputs(get_chained_activations_reference(values_a), execute_network(network, input_a));
+        expect_equal_outputs(get_chained_activations_reference(values_b), execute_network(network, input_b));
+    }
+}
+
+//The networks of one engine share the kernel objects, so the arguments of one must not be kept for the other
+TEST(kernels_cache, interleaved_networks_sharing_kernels_give_own_outputs) {
+    const auto& engine = get_test_engine();
+    layout input_layout = { data_types::f32, format::bfyx, { 1, 2, 4, 4 } };
+    std::vector<float> values_a(input_layout.count()), values_b(input_layout.count());
+    for (size_t i = 0; i < values_a.size(); i++)
+    {
+        values_a[i] = static_cast<float>(i % 7) - 3.f;
+        values_b[i] = static_cast<float>(i % 3) - 2.f;
+    }
+    auto input_a = memory::allocate(engine, input_layout);
+    auto input_b = memory::allocate(engine, input_layout);
+    set_values(input_a, values_a);
+    set_values(input_b, values_b);
+
+    network network_a(engine, get_chained_activations_topology(input_layout));
+    network network_b(engine, get_chained_activations_topology(input_layout));
+    for (int i = 0; i < 2; i++)
+    {
+        expect_equal_outputs(get_chained_activations_reference(values_a), execute_network(network_a, input_a));
+        expect_equal_outputs(get_chained_activations_reference(values_b), execute_network(network_b, input_b));
+    }
+}
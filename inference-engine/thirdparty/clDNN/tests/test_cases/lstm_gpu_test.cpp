@@ -32,6 +32,7 @@
 #include "instrumentation.h"
 #include <test_utils/float16.h>
 
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 
@@ -1272,6 +1273,101 @@ void lstm_gpu_concatenated_input_test(int layers, int sequence_len, int directio
 	}
 }
 
+// This test checks the unidirectional LSTM with the concatenated input, which runs as a single fused kernel
+template<typename T>
+void lstm_gpu_fused_sequence_test(int sequence_len, int batch_size, int input_size, int hidden_size,
+                                  bool has_bias, bool has_initial_hidden, bool has_initial_cell,
+                                  float clip_threshold, bool input_forget, const cldnn_lstm_output& output_selection)
+{
+    int min_random = -2, max_random = 2;
+    VVVVF<T> ref_input = generate_random_4d<T>(batch_size, sequence_len, 1, input_size, min_random, max_random);
+    VVVVF<T> ref_weights = generate_random_4d<T>(1, 1, 4 * hidden_size, input_size, min_random, max_random);
+    VVVVF<T> ref_recurrent = generate_random_4d<T>(1, 1, 4 * hidden_size, hidden_size, min_random, max_random);
+    VVVVF<T> ref_bias = generate_random_4d<T>(1, 1, 1, 4 * hidden_size, min_random, max_random);
+    VVVVF<T> ref_hidden = generate_random_4d<T>(batch_size, 1, 1, hidden_size, min_random, max_random);
+    VVVVF<T> ref_cell = generate_random_4d<T>(batch_size, 1, 1, hidden_size, min_random, max_random);
+    VVVVF<T> ref_output(batch_size, VVVF<T>(sequence_len, VVF<T>(1, VF<T>(hidden_size))));
+
+    VF<T> ref_input_vec = flatten_4d<T>(cldnn::format::bfyx, ref_input);
+    VF<T> ref_weights_vec = flatten_4d<T>(cldnn::format::bfyx, ref_weights);
+    VF<T> ref_recurrent_vec = flatten_4d<T>(cldnn::format::bfyx, ref_recurrent);
+    VF<T> ref_bias_vec = flatten_4d<T>(cldnn::format::bfyx, ref_bias);
+    VF<T> ref_hidden_vec = flatten_4d<T>(cldnn::format::bfyx, ref_hidden);
+    VF<T> ref_cell_vec = flatten_4d<T>(cldnn::format::bfyx, ref_cell);
+
+    VVVVF<T> last_hidden(batch_size, VVVF<T>(1, VVF<T>(1, VF<T>(hidden_size))));
+    VVVVF<T> last_cell(batch_size, VVVF<T>(1, VVF<T>(1, VF<T>(hidden_size))));
+    lstm_reference(ref_input, ref_hidden, ref_cell, ref_weights, ref_recurrent, ref_bias, ref_output,
+                   last_hidden, last_cell, has_bias, has_initial_hidden, has_initial_cell,
+                   clip_threshold, input_forget, true);
+
+    const auto& engine = get_test_engine();
+
+    memory input = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { batch_size, sequence_len, input_size, 1 } });
+    memory weights = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { 1, 1, input_size, 4 * hidden_size } });
+    memory recurrent = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { 1, 1, hidden_size, 4 * hidden_size } });
+    memory biases = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { 1, 1, 4 * hidden_size, 1 } });
+    memory hidden = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { batch_size, 1, hidden_size, 1 } });
+    memory cell = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { batch_size, 1, hidden_size, 1 } });
+    set_values(input, ref_input_vec);
+    set_values(weights, ref_weights_vec);
+    set_values(recurrent, ref_recurrent_vec);
+    set_values(biases, ref_bias_vec);
+    set_values(hidden, ref_hidden_vec);
+    set_values(cell, ref_cell_vec);
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("weights", weights));
+    topology.add(data("recurrent", recurrent));
+    if (has_bias) topology.add(data("biases", biases));
+    if (has_initial_hidden) topology.add(input_layout("hidden", hidden.get_layout()));
+    if (has_initial_cell) topology.add(input_layout("cell", cell.get_layout()));
+    topology.add(lstm("lstm", { "input" }, "weights", "recurrent",
+                      has_bias ? "biases" : "", has_initial_hidden ? "hidden" : "", has_initial_cell ? "cell" : "", "",
+                      clip_threshold, input_forget, {}, {}, output_selection, default_offset_type));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    if (has_initial_hidden) network.set_input_data("hidden", hidden);
+    if (has_initial_cell) network.set_input_data("cell", cell);
+    auto outputs = network.execute();
+
+    // the lstm is not expanded to the steps
+    auto executed = network.get_executed_primitive_ids();
+    EXPECT_NE(std::find(executed.begin(), executed.end(), "lstm"), executed.end());
+
+    bool emit_last_cell = output_selection == cldnn_lstm_output_hidden_cell ||
+                          output_selection == cldnn_lstm_output_sequence_cell;
+    bool emit_sequence = output_selection == cldnn_lstm_output_sequence ||
+                         output_selection == cldnn_lstm_output_sequence_cell;
+    int32_t hidden_len = emit_sequence ? sequence_len : 1;
+
+    ASSERT_EQ(outputs.size(), size_t(1));
+    auto output = outputs.at("lstm").get_memory();
+    auto output_tensor = output.get_layout().size;
+    ASSERT_EQ(batch_size, output_tensor.batch[0]);
+    ASSERT_EQ(hidden_len + (emit_last_cell ? 1 : 0), output_tensor.feature[0]);
+    ASSERT_EQ(1, output_tensor.spatial[1]);
+    ASSERT_EQ(hidden_size, output_tensor.spatial[0]);
+
+    auto output_ptr = output.pointer<T>();
+    int32_t i = 0;
+    for (int32_t b = 0; b < batch_size; ++b) {
+        for (int32_t s = 0; s < hidden_len; ++s) {
+            for (int32_t x = 0; x < hidden_size; ++x) {
+                T ref = emit_sequence ? ref_output[b][s][0][x] : last_hidden[b][0][0][x];
+                ASSERT_NEAR(ref, output_ptr[i++], FERROR);
+            }
+        }
+        if (emit_last_cell) {
+            for (int32_t x = 0; x < hidden_size; ++x) {
+                ASSERT_NEAR(last_cell[b][0][0][x], output_ptr[i++], FERROR);
+            }
+        }
+    }
+}
+
 // This test checks chained and stacked LSTM topology. The configuration allows to create
 // LSTM topology with multiple layers and can also be chained together.
 template<typename T>
@@ -1892,6 +1988,32 @@ TEST(lstm_gpu, generic_lstm_concatenated_input_multi_layer) {
     lstm_gpu_concatenated_input_test<float>(5, 5, 2, 1, 1, 4, true, true, true);
 }
 
+// Test for the unidirectional LSTM running the whole sequence in one kernel
+TEST(lstm_gpu, fused_sequence_f32) {
+    lstm_gpu_fused_sequence_test<float>(7, 3, 5, 6, true, true, true, 0.f, false, cldnn_lstm_output_sequence);
+}
+
+TEST(lstm_gpu, fused_sequence_no_bias_hidden_cell_f32) {
+    lstm_gpu_fused_sequence_test<float>(7, 3, 5, 6, false, false, false, 0.f, false, cldnn_lstm_output_sequence);
+}
+
+TEST(lstm_gpu, fused_sequence_clip_input_forget_f32) {
+    lstm_gpu_fused_sequence_test<float>(5, 2, 3, 4, true, true, true, 0.3f, true, cldnn_lstm_output_sequence);
+}
+
+TEST(lstm_gpu, fused_sequence_hidden_cell_f32) {
+    lstm_gpu_fused_sequence_test<float>(6, 2, 4, 3, true, true, true, 0.f, false, cldnn_lstm_output_hidden_cell);
+}
+
+TEST(lstm_gpu, fused_sequence_sequence_cell_f32) {
+    lstm_gpu_fused_sequence_test<float>(6, 2, 4, 3, true, false, true, 0.f, false, cldnn_lstm_output_sequence_cell);
+}
+
+TEST(lstm_gpu, fused_sequence_large_hidden_f32) {
+    // the hidden units outnumber the work items, the recurrent weights do not fit the local memory
+    lstm_gpu_fused_sequence_test<float>(4, 2, 16, 260, true, true, true, 0.f, false, cldnn_lstm_output_sequence);
+}
+
 // test for LSTM with chain and stack (multilayer)
 TEST(lstm_gpu, generic_lstm_chained_unidirectional_f32) {
     // batch size = 1
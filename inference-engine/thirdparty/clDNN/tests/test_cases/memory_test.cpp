@@ -105,6 +105,32 @@ TEST(memory_pool, basic_non_padded_relu_pipe) {
  }
 
 
+TEST(memory_pool, network_used_device_memory_size) {
+    // the network uses all the engine memory but the input, the reused buffers are counted once
+    const cldnn::engine engine;// here we need new engine
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ tensor(spatial(1, 1), feature(4), batch(1)) } });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("relu", "input", activation_relu));
+    topology.add(activation("relu1", "relu", activation_relu));
+    topology.add(activation("relu2", "relu1", activation_relu));
+    topology.add(activation("relu3", "relu2", activation_relu));
+    topology.add(activation("relu4", "relu3", activation_relu));
+    topology.add(activation("relu5", "relu4", activation_relu));
+
+    set_values(input, { -1.f, 2.f, -3.f, 4.f });
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+
+    network network(engine, topology, bo);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    EXPECT_EQ(network.get_used_device_memory_size(), engine.get_max_used_device_memory_size() - input.get_layout().bytes_count());
+}
+
 TEST(memory_pool, basic_non_padded_relu_and_pooling_pipe) {
     // uncomment this line to disable memory pool
     /*engine_configuration cfg{ false, false, false, std::string(), std::string(), true, std::string(),std::string(), 0, false };
@@ -565,4 +591,56 @@ TEST(memory_pool, add_mem_dep_test) {
     EXPECT_EQ(out2_ptr[1], 6.0f);
     EXPECT_EQ(out2_ptr[2], 7.0f);
     EXPECT_EQ(out2_ptr[3], 8.0f);
-}
\ No newline at end of file
+}
+
+TEST(memory_tests, shared_host_buffer_is_read_in_place) {
+    const cldnn::engine engine;
+    // 16 floats make the 64 bytes of one cache line
+    layout in_layout{ data_types::f32, format::bfyx,{ 1, 16, 1, 1 } };
+    float* host_ptr = static_cast<float*>(_mm_malloc(in_layout.bytes_count(), 4096));
+    for (int i = 0; i < 16; i++)
+        host_ptr[i] = static_cast<float>(i % 2 ? i : -i);
+
+    auto shared = memory::share_host_buffer(engine, in_layout, host_ptr, 16);
+    EXPECT_TRUE(shared.is_allocated_by(engine));
+    EXPECT_ANY_THROW(memory::share_host_buffer(engine, in_layout, host_ptr, 8));
+
+    topology topology;
+    topology.add(input_layout("input", in_layout));
+    topology.add(activation("relu", "input", activation_relu));
+
+    network network(engine, topology);
+    network.set_input_data("input", shared);
+    auto outputs = network.execute();
+    auto output_ptr = outputs.at("relu").get_memory().pointer<float>();
+    for (int i = 0; i < 16; i++)
+        EXPECT_EQ(output_ptr[i], static_cast<float>(i % 2 ? i : 0));
+
+    _mm_free(host_ptr);
+}
+
+TEST(memory_tests, asynchronous_write_and_read) {
+    const cldnn::engine engine;
+    layout in_layout{ data_types::f32, format::bfyx,{ 1, 16, 1, 1 } };
+    std::vector<float> input_data(16);
+    for (int i = 0; i < 16; i++)
+        input_data[i] = static_cast<float>(i % 2 ? i : -i);
+
+    auto input = memory::allocate(engine, in_layout);
+    EXPECT_ANY_THROW(input.write_async(input_data.data(), input.size() / 2));
+
+    topology topology;
+    topology.add(input_layout("input", in_layout));
+    topology.add(activation("relu", "input", activation_relu));
+
+    network network(engine, topology);
+    auto write_event = input.write_async(input_data.data(), input.size());
+    network.set_input_data("input", input);
+    network.execute({ write_event });
+
+    std::vector<float> output_data(16);
+    auto read_event = network.read_memory_async(network.get_output_memory("relu"), output_data.data(), input.size());
+    read_event.wait();
+    for (int i = 0; i < 16; i++)
+        EXPECT_EQ(output_data[i], static_cast<float>(i % 2 ? i : 0));
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+#include <gtest/gtest.h>
+
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/nv12_to_bgr.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <tests/test_utils/test_utils.h>
+
+using namespace cldnn;
+using namespace ::tests;
+
+// BT.601 of the limited range, the pixel of the frame without the interpolation
+static void nv12_pixel_to_bgr(const std::vector<uint8_t>& frame, int width, int height, int x, int y, float* bgr) {
+    float Y = 1.164f * (frame[y * width + x] - 16.f);
+    float U = frame[(height + y / 2) * width + (x & ~1)] - 128.f;
+    float V = frame[(height + y / 2) * width + (x & ~1) + 1] - 128.f;
+    bgr[0] = std::min(std::max(Y + 2.018f * U, 0.f), 255.f);
+    bgr[1] = std::min(std::max(Y - 0.813f * V - 0.391f * U, 0.f), 255.f);
+    bgr[2] = std::min(std::max(Y + 1.596f * V, 0.f), 255.f);
+}
+
+static std::vector<uint8_t> make_nv12_frame(int width, int height) {
+    std::vector<uint8_t> frame(width * height * 3 / 2);
+    for (size_t i = 0; i < frame.size(); i++)
+        frame[i] = static_cast<uint8_t>((i * 37 + 11) % 256);
+    return frame;
+}
+
+TEST(nv12_to_bgr_gpu, same_size_f32) {
+    //  Input  : 1x1x8x6 (the 8x4 frame)
+    //  Output : 1x3x8x4
+    const int width = 8, height = 4;
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::u8, format::bfyx, { 1, 1, width, height * 3 / 2 } });
+    auto frame = make_nv12_frame(width, height);
+    set_values(input, frame);
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(nv12_to_bgr("nv12_to_bgr", "input", { 1, 3, width, height }));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    auto output = outputs.at("nv12_to_bgr").get_memory();
+    EXPECT_EQ(output.get_layout().data_type, data_types::f32);
+    auto output_ptr = output.pointer<float>();
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            float bgr[3];
+            nv12_pixel_to_bgr(frame, width, height, x, y, bgr);
+            for (int c = 0; c < 3; c++)
+                EXPECT_NEAR(bgr[c], output_ptr[(c * height + y) * width + x], 1e-3f);
+        }
+    }
+}
+
+TEST(nv12_to_bgr_gpu, downscale_by_two_f16) {
+    //  Input  : 2x1x8x6 (two 8x4 frames)
+    //  Output : 2x3x4x2, every output pixel is the average of the 2x2 frame pixels
+    const int width = 8, height = 4;
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::u8, format::bfyx, { 2, 1, width, height * 3 / 2 } });
+    auto frame = make_nv12_frame(width, height);
+    std::vector<uint8_t> frames(frame);
+    frames.insert(frames.end(), frame.rbegin(), frame.rend());
+    set_values(input, frames);
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(nv12_to_bgr("nv12_to_bgr", "input", { 2, 3, width / 2, height / 2 }, data_types::f16));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    auto output = outputs.at("nv12_to_bgr").get_memory();
+    auto output_ptr = output.pointer<uint16_t>();
+
+    std::vector<uint8_t> second(frame.rbegin(), frame.rend());
+    for (int b = 0; b < 2; b++) {
+        const auto& ref_frame = b == 0 ? frame : second;
+        for (int y = 0; y < height / 2; y++) {
+            for (int x = 0; x < width / 2; x++) {
+                // the chroma of the 2x2 pixels is the same, so the average of Y is converted
+                float Y = 0.f;
+                for (int i = 0; i < 4; i++)
+                    Y += ref_frame[(2 * y + i / 2) * width + 2 * x + i % 2] / 4.f;
+                float U = ref_frame[(height + y) * width + 2 * x] - 128.f;
+                float V = ref_frame[(height + y) * width + 2 * x + 1] - 128.f;
+                Y = 1.164f * (Y - 16.f);
+                float bgr[3] = {
+                    std::min(std::max(Y + 2.018f * U, 0.f), 255.f),
+                    std::min(std::max(Y - 0.813f * V - 0.391f * U, 0.f), 255.f),
+                    std::min(std::max(Y + 1.596f * V, 0.f), 255.f)
+                };
+                for (int c = 0; c < 3; c++) {
+                    size_t index = ((b * 3 + c) * (height / 2) + y) * (width / 2) + x;
+                    EXPECT_NEAR(bgr[c], float16_to_float32(output_ptr[index]), 0.5f);
+                }
+            }
+        }
+    }
+}
+
+TEST(nv12_to_bgr_gpu, odd_frame_height_throws) {
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::u8, format::bfyx, { 1, 1, 8, 5 } });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(nv12_to_bgr("nv12_to_bgr", "input", { 1, 3, 8, 4 }));
+
+    EXPECT_ANY_THROW(network(engine, topology));
+}
@@ -618,3 +618,61 @@ TEST(fc_permute_gpu, basic_permute_bfyx)
     for (int i = 0; i < 5 * 256; i++)
         EXPECT_NEAR(input_ptr[i], output_ptr[i], 1e-3f);
 }
+
+namespace {
+
+// Permutes a bfyx tensor of the given sizes in the [b, f, x, y] order on the host and compares with the primitive
+void test_permute_random(const std::vector<int>& sizes, const std::vector<uint16_t>& order)
+{
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, tensor(sizes[0], sizes[1], sizes[2], sizes[3]) });
+    auto input_data = generate_random_1d<float>(input.get_layout().count(), -10, 10);
+    set_values(input, input_data);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        permute("permute", "input", order));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    auto output = outputs.at("permute").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    int out_sizes[4];
+    for (size_t i = 0; i < 4; i++)
+        out_sizes[i] = sizes[order[i]];
+
+    int in_idx[4];
+    for (in_idx[0] = 0; in_idx[0] < sizes[0]; in_idx[0]++)
+    for (in_idx[1] = 0; in_idx[1] < sizes[1]; in_idx[1]++)
+    for (in_idx[3] = 0; in_idx[3] < sizes[3]; in_idx[3]++)
+    for (in_idx[2] = 0; in_idx[2] < sizes[2]; in_idx[2]++)
+    {
+        const int in_offset = ((in_idx[0] * sizes[1] + in_idx[1]) * sizes[3] + in_idx[3]) * sizes[2] + in_idx[2];
+        int out_idx[4];
+        for (size_t i = 0; i < 4; i++)
+            out_idx[i] = in_idx[order[i]];
+        const int out_offset = ((out_idx[0] * out_sizes[1] + out_idx[1]) * out_sizes[3] + out_idx[3]) * out_sizes[2] + out_idx[2];
+        ASSERT_EQ(input_data[in_offset], output_ptr[out_offset]) << " at input " << in_offset;
+    }
+}
+
+}  // namespace
+
+TEST(permute_gpu_f32, random_bfyx_permute_inner_dim_kept)
+{
+    test_permute_random({ 2, 5, 37, 9 }, { 1, 0, 2, 3 });
+    test_permute_random({ 2, 5, 37, 9 }, { 0, 3, 2, 1 });
+}
+
+TEST(permute_gpu_f32, random_bfyx_permute_tiled)
+{
+    // the sizes are not multiples of the tile
+    test_permute_random({ 2, 3, 35, 21 }, { 0, 1, 3, 2 });
+    test_permute_random({ 3, 40, 18, 7 }, { 0, 3, 1, 2 });
+    test_permute_random({ 3, 40, 18, 7 }, { 0, 2, 1, 3 });
+    test_permute_random({ 17, 3, 20, 2 }, { 2, 1, 0, 3 });
+}
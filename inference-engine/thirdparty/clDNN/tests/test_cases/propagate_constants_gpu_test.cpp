@@ -27,6 +27,8 @@
 #include <api/CPP/reorder.hpp>
 #include <api/CPP/data.hpp>
 #include <api/CPP/reshape.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/eltwise.hpp>
 
 using namespace cldnn;
 using namespace tests;
@@ -66,4 +68,74 @@ TEST(propagate_constants, copy_dependecies_from_nodes) {
         auto output = it.second.get_memory().pointer<float>();
         EXPECT_NEAR(7.8f, output[0], epsilon);
     }
-}
\ No newline at end of file
+}
+
+//The reordered weights are kept with their source memory, so the second network reuses them instead of
+//reordering the weights again and still computes the same result after the first network is released
+TEST(propagate_constants, networks_share_reordered_weights) {
+    const auto& engine = get_test_engine();
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 4, 4 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx,{ 2, 1, 3, 3 } });
+
+    set_values(input, std::vector<float>(16, 1.0f));
+    set_values(weights, std::vector<float>(18, 1.0f));
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("weights", weights));
+    topology.add(convolution("conv", { "input" }, { "weights" }));
+
+    std::vector<float> expected(8, 9.0f);
+    auto check = [&](network& net)
+    {
+        net.set_input_data("input", input);
+        auto outputs = net.execute();
+        auto output = outputs.at("conv").get_memory().pointer<float>();
+        ASSERT_EQ(output.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++)
+            EXPECT_FLOAT_EQ(expected[i], output[i]);
+    };
+
+    std::unique_ptr<network> first(new network(engine, topology, build_opt));
+    network second(engine, topology, build_opt);
+    check(*first);
+    first.reset();
+    check(second);
+}
+
+//The reorder of the constant data to another plain format and type is computed on the host
+TEST(propagate_constants, reorder_of_data_on_host) {
+    const auto& engine = get_test_engine();
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 2, 2, 3, 2 } });
+    auto constant = memory::allocate(engine, { data_types::f16, format::yxfb,{ 2, 2, 3, 2 } });
+
+    // yxfb: the batch changes fastest, then the feature, x and y
+    std::vector<FLOAT16> constant_values;
+    for (int y = 0; y < 2; y++)
+        for (int x = 0; x < 3; x++)
+            for (int f = 0; f < 2; f++)
+                for (int b = 0; b < 2; b++)
+                    constant_values.push_back(FLOAT16(static_cast<float>(((b * 2 + f) * 2 + y) * 3 + x)));
+    set_values(input, std::vector<float>(24, 0.5f));
+    set_values(constant, constant_values);
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("constant", constant));
+    topology.add(reorder("reorder", "constant", layout(data_types::f32, format::bfyx, { 2, 2, 3, 2 })));
+    topology.add(eltwise("sum", { "input", "reorder" }, eltwise_mode::sum));
+    network network(engine, topology, build_opt);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    auto output = outputs.at("sum").get_memory().pointer<float>();
+    ASSERT_EQ(output.size(), size_t(24));
+    for (size_t i = 0; i < output.size(); i++)
+        EXPECT_FLOAT_EQ(static_cast<float>(i) + 0.5f, output[i]);
+}
@@ -444,6 +444,52 @@ TEST(softmax_gpu_bfyx_f32, normalize_f) {
     }
 }
 
+TEST(softmax_gpu_bfyx_f32, normalize_f_large) {
+    //  Input  : 2x30000x1x1, the data sets are long enough for the streaming kernel
+    static const int32_t feature_num = 30000, batch_num = 2;
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ batch_num, feature_num, 1, 1 } });
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(softmax("softmax", "input"));
+
+    vector<float> input_vec(batch_num * feature_num);
+    for (size_t i = 0; i < input_vec.size(); i++)
+    {
+        input_vec[i] = static_cast<float>(static_cast<int>(i % 37) - 18) / 4.f;
+    }
+    set_values(input, input_vec);
+
+    network network(engine, topology);
+
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "softmax");
+
+    auto output = outputs.at("softmax").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    for (int32_t b = 0; b < batch_num; b++)
+    {
+        const float* in = input_vec.data() + b * feature_num;
+        float max_value = *std::max_element(in, in + feature_num);
+        double denominator = 0.;
+        for (int32_t f = 0; f < feature_num; f++)
+        {
+            denominator += std::exp(in[f] - max_value);
+        }
+
+        for (int32_t f = 0; f < feature_num; f++)
+        {
+            float expected = static_cast<float>(std::exp(in[f] - max_value) / denominator);
+            EXPECT_NEAR(expected, output_ptr[b * feature_num + f], 1e-6f);
+        }
+    }
+}
+
 TEST(softmax_gpu_yxfb_f32, normalize_f) {
 
     static const int32_t x_size = 1, y_size = 2, feature_num = 1,
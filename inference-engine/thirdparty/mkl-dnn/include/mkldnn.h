@@ -1911,6 +1911,15 @@ const mkldnn_version_t MKLDNN_API *mkldnn_version();
  *     function defaults to 32KB of L1, 512KB of L2 and 1MB of L3 per core. */
 unsigned int MKLDNN_API mkldnn_get_cache_size(int level, int per_core);
 
+/** Sets the capacity of the process-wide cache of the JIT kernels.
+ * The primitives created with the same parameters share the generated code
+ * of the kernels available in the cache.
+ * capacity equals:
+ *  - zero -- the kernels are not cached
+ *  - positive -- the maximum number of the cached kernels (256 by default),
+ *    the least recently used kernels are evicted */
+mkldnn_status_t MKLDNN_API mkldnn_set_jit_kernel_cache_capacity(int capacity);
+
 /** @} */
 
 /** @addtogroup c_api_blas BLAS functions
@@ -28,6 +28,7 @@
 #include "cpu_reducer.hpp"
 
 #include "jit_avx2_1x1_conv_kernel_f32.hpp"
+#include "jit_kernel_cache.hpp"
 #include "jit_uni_1x1_conv_utils.hpp"
 
 #include "jit_uni_depthwise.hpp"
@@ -122,23 +123,20 @@ struct jit_avx2_1x1_convolution_fwd_t: public cpu_primitive_t {
     jit_avx2_1x1_convolution_fwd_t(const pd_t *apd, const input_vector &inputs,
             const output_vector &outputs)
         : cpu_primitive_t(apd, inputs, outputs)
-        , kernel_(nullptr), rtus_driver_(nullptr)
+        , rtus_driver_(nullptr)
     {
-        kernel_ = new jit_avx2_1x1_conv_kernel_f32(pd()->jcp_, pd()->jcp_dw_, *pd()->attr());
+        kernel_ = get_jit_kernel<jit_avx2_1x1_conv_kernel_f32>(pd()->jcp_,
+                pd()->jcp_dw_, *pd()->attr());
         init_rtus_driver<avx2>(this);
 
         if (pd()->jcp_.with_dw_conv) {
-            kernel_dw_ = new jit_uni_dw_conv_row_f32<avx2>(pd()->jcp_dw_, *pd()->attr(), pd()->jcp_dw_.ch_block);
+            kernel_dw_ = get_jit_kernel<jit_uni_dw_conv_row_f32<avx2>>(
+                    pd()->jcp_dw_, *pd()->attr(), pd()->jcp_dw_.ch_block);
         }
     }
 
     ~jit_avx2_1x1_convolution_fwd_t() {
-        delete kernel_;
         delete rtus_driver_;
-
-        if (pd()->jcp_.with_dw_conv) {
-            delete kernel_dw_;
-        }
     }
 
     typedef typename prec_traits<data_type::f32>::type data_t;
@@ -157,8 +155,8 @@ private:
     void execute_forward_with_dw_conv() const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd(); }
 
-    jit_avx2_1x1_conv_kernel_f32 *kernel_;
-    jit_uni_dw_conv_row_f32<avx2> *kernel_dw_;
+    std::shared_ptr<jit_avx2_1x1_conv_kernel_f32> kernel_;
+    std::shared_ptr<jit_uni_dw_conv_row_f32<avx2>> kernel_dw_;
     rtus_driver_t<avx2> *rtus_driver_;
 };
 
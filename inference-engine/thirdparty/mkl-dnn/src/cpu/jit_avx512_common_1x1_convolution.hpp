@@ -27,6 +27,7 @@
 #include "cpu_reducer.hpp"
 
 #include "jit_avx512_common_1x1_conv_kernel.hpp"
+#include "jit_kernel_cache.hpp"
 #include "jit_uni_1x1_conv_utils.hpp"
 #include "jit_transpose_src_utils.hpp"
 
@@ -128,15 +129,14 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
     jit_avx512_common_1x1_convolution_fwd_t(const pd_t *apd,
             const input_vector &inputs, const output_vector &outputs)
         : cpu_primitive_t(apd, inputs, outputs)
-        , kernel_(nullptr), rtus_driver_(nullptr)
+        , rtus_driver_(nullptr)
     {
-        kernel_ =
-            new jit_avx512_common_1x1_conv_kernel(pd()->jcp_, *pd()->attr());
+        kernel_ = get_jit_kernel<jit_avx512_common_1x1_conv_kernel>(
+                pd()->jcp_, *pd()->attr());
         init_rtus_driver<avx512_common>(this);
     }
 
     ~jit_avx512_common_1x1_convolution_fwd_t() {
-        delete kernel_;
         delete rtus_driver_;
     }
 
@@ -157,7 +157,7 @@ struct jit_avx512_common_1x1_convolution_fwd_t : public cpu_primitive_t {
             const memory_tracking::grantor_t &scratchpad) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd(); }
 
-    jit_avx512_common_1x1_conv_kernel *kernel_;
+    std::shared_ptr<jit_avx512_common_1x1_conv_kernel> kernel_;
     rtus_driver_t<avx512_common> *rtus_driver_;
 };
 
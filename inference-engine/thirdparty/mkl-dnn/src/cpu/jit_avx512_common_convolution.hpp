@@ -28,6 +28,7 @@
 
 #include "jit_transpose_src_utils.hpp"
 #include "jit_avx512_common_conv_kernel.hpp"
+#include "jit_kernel_cache.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -92,10 +93,9 @@ struct jit_avx512_common_convolution_fwd_t : public cpu_primitive_t {
             const input_vector &inputs, const output_vector &outputs)
         : cpu_primitive_t(apd, inputs, outputs)
     {
-        kernel_ = new jit_avx512_common_conv_fwd_kernel(pd()->jcp_,
-                    *pd()->attr());
+        kernel_ = get_jit_kernel<jit_avx512_common_conv_fwd_kernel>(
+                pd()->jcp_, *pd()->attr());
     }
-    ~jit_avx512_common_convolution_fwd_t() { delete kernel_; }
 
     typedef typename prec_traits<src_type>::type src_data_t;
     typedef typename prec_traits<wei_type>::type wei_data_t;
@@ -125,7 +125,7 @@ private:
     void execute_forward_3d() const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd(); }
 
-    jit_avx512_common_conv_fwd_kernel *kernel_;
+    std::shared_ptr<jit_avx512_common_conv_fwd_kernel> kernel_;
 };
 
 template <impl::data_type_t diff_dst_type,
@@ -0,0 +1,142 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mkldnn.h"
+
+#include "jit_kernel_cache.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+jit_kernel_cache_t &jit_kernel_cache_t::instance() {
+    static jit_kernel_cache_t cache;
+    return cache;
+}
+
+void jit_kernel_cache_t::set_capacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+    evict();
+}
+
+size_t jit_kernel_cache_t::capacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+}
+
+size_t jit_kernel_cache_t::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lru_.size();
+}
+
+std::shared_ptr<void> jit_kernel_cache_t::find(const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = kernels_.find(key);
+    if (it == kernels_.end())
+        return nullptr;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->second;
+}
+
+std::shared_ptr<void> jit_kernel_cache_t::add(const std::string &key,
+        const std::shared_ptr<void> &kernel) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = kernels_.find(key);
+    if (it != kernels_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return it->second->second;
+    }
+    if (capacity_ == 0)
+        return kernel;
+
+    lru_.emplace_front(key, kernel);
+    kernels_[key] = lru_.begin();
+    evict();
+    return kernel;
+}
+
+void jit_kernel_cache_t::evict() {
+    while (lru_.size() > capacity_) {
+        kernels_.erase(lru_.back().first);
+        lru_.pop_back();
+    }
+}
+
+void jit_kernel_key_append(std::string &key, const primitive_attr_t &attr) {
+    jit_kernel_key_append(key, attr.round_mode_);
+
+    const auto &scales = attr.output_scales_;
+    jit_kernel_key_append(key, scales.count_);
+    jit_kernel_key_append(key, scales.mask_);
+    key.append(reinterpret_cast<const char *>(scales.scales_),
+            sizeof(float) * scales.count_);
+
+    /* only the fields of the post-op kind are appended, since the rest of
+     * the union is not initialized */
+    const auto &p = attr.post_ops_;
+    jit_kernel_key_append(key, p.len_);
+    for (int i = 0; i < p.len_; i++) {
+        const auto &e = p.entry_[i];
+        jit_kernel_key_append(key, e.kind);
+        switch (e.kind) {
+        case primitive_kind::sum:
+            jit_kernel_key_append(key, e.sum.scale);
+            break;
+        case primitive_kind::eltwise:
+            jit_kernel_key_append(key, e.eltwise.alg);
+            jit_kernel_key_append(key, e.eltwise.scale);
+            jit_kernel_key_append(key, e.eltwise.alpha);
+            jit_kernel_key_append(key, e.eltwise.beta);
+            break;
+        case primitive_kind::depthwise:
+            jit_kernel_key_append(key, e.depthwise.alg);
+            jit_kernel_key_append(key, e.depthwise.weights_data);
+            jit_kernel_key_append(key, e.depthwise.biases_data);
+            break;
+        case primitive_kind::convolution:
+            jit_kernel_key_append(key, e.dw_conv.in_h);
+            jit_kernel_key_append(key, e.dw_conv.in_w);
+            jit_kernel_key_append(key, e.dw_conv.ker_h);
+            jit_kernel_key_append(key, e.dw_conv.ker_w);
+            jit_kernel_key_append(key, e.dw_conv.str_h);
+            jit_kernel_key_append(key, e.dw_conv.str_w);
+            jit_kernel_key_append(key, e.dw_conv.weights_data);
+            jit_kernel_key_append(key, e.dw_conv.biases_data);
+            break;
+        case primitive_kind::binarization:
+            jit_kernel_key_append(key, e.binarization.alg);
+            jit_kernel_key_append(key, e.binarization.weights_data);
+            break;
+        default:
+            break;
+        }
+    }
+
+    jit_kernel_key_append(key, attr.rnn_data_qparams_.scale_);
+    jit_kernel_key_append(key, attr.rnn_data_qparams_.shift_);
+}
+
+}
+}
+}
+
+mkldnn_status_t mkldnn_set_jit_kernel_cache_capacity(int capacity) {
+    using namespace mkldnn::impl::status;
+    if (capacity < 0) return invalid_arguments;
+    mkldnn::impl::cpu::jit_kernel_cache_t::instance().set_capacity(capacity);
+    return success;
+}
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_JIT_KERNEL_CACHE_HPP
+#define CPU_JIT_KERNEL_CACHE_HPP
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "c_types_map.hpp"
+#include "primitive_attr.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+/* Process-wide LRU cache of the generated JIT kernels.
+ *
+ * A primitive is bound to its memory, so the primitives themselves cannot be
+ * shared, but the code the kernels generate depends only on the parameters
+ * they are created with. The primitives of the same shape (in one network or
+ * in several networks loaded into the process) take the kernel from the cache
+ * instead of generating the identical code once more. The kernel is released
+ * when it is evicted and the last primitive which uses it is destroyed.
+ *
+ * The kernels are generated outside of the lock, so the concurrent creation of
+ * the primitives is not serialized; if two threads generate the same kernel,
+ * the one which comes second takes the cached copy and drops its own. */
+struct jit_kernel_cache_t {
+    enum { default_capacity = 256 };
+
+    static jit_kernel_cache_t &instance();
+
+    void set_capacity(size_t capacity);
+    size_t capacity() const;
+    size_t size() const;
+
+    std::shared_ptr<void> find(const std::string &key);
+    /* returns the kernel cached under the key, which is not necessarily
+     * the one passed if the key was added concurrently */
+    std::shared_ptr<void> add(const std::string &key,
+            const std::shared_ptr<void> &kernel);
+
+private:
+    jit_kernel_cache_t(): capacity_(default_capacity) {}
+
+    void evict();
+
+    typedef std::list<std::pair<std::string, std::shared_ptr<void>>> lru_t;
+
+    mutable std::mutex mutex_;
+    size_t capacity_;
+    lru_t lru_;
+    std::unordered_map<std::string, lru_t::iterator> kernels_;
+};
+
+/* Appends the raw bytes of the argument to the key */
+template <typename T>
+inline void jit_kernel_key_append(std::string &key, const T &arg) {
+    key.append(reinterpret_cast<const char *>(&arg), sizeof(T));
+}
+
+/* Appends all the attributes the kernels may bake into the code: the round
+ * mode, the output scales and the post-ops (including the pointers to the
+ * depthwise, dw convolution and binarization data, which are the immediate
+ * operands of the code) */
+void jit_kernel_key_append(std::string &key, const primitive_attr_t &attr);
+
+/* Unique address per kernel type, so the different kernels created with the
+ * same arguments have different keys */
+template <typename kernel_t>
+struct jit_kernel_tag_t { static const char tag; };
+
+template <typename kernel_t>
+const char jit_kernel_tag_t<kernel_t>::tag = 0;
+
+/* Returns the kernel created with the same arguments if there is one in the
+ * cache, otherwise creates the kernel and puts it into the cache.
+ *
+ * @note The kernel must not use the references to the arguments after the
+ *       code is generated, since the cached kernel outlives the primitive it
+ *       was created for (the attributes are only read in generate()). */
+template <typename kernel_t, typename... args_t>
+inline std::shared_ptr<kernel_t> get_jit_kernel(const args_t &... args) {
+    auto &cache = jit_kernel_cache_t::instance();
+    if (cache.capacity() == 0)
+        return std::make_shared<kernel_t>(args...);
+
+    std::string key;
+    jit_kernel_key_append(key, &jit_kernel_tag_t<kernel_t>::tag);
+    int expand[] = { 0, (jit_kernel_key_append(key, args), 0)... };
+    (void)expand;
+
+    auto kernel = cache.find(key);
+    if (!kernel)
+        kernel = cache.add(key, std::make_shared<kernel_t>(args...));
+    return std::static_pointer_cast<kernel_t>(kernel);
+}
+
+}
+}
+}
+
+#endif
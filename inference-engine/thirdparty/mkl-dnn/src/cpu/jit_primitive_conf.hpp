@@ -292,6 +292,7 @@ struct jit_bin_conv_conf_t {
     bool with_eltwise;
     bool with_dw_conv;
     bool with_binarization;
+    bool with_vpopcnt;
 
     float pad_value;
     bool exclude_pad;
@@ -22,6 +22,7 @@
 #include "cpu_engine.hpp"
 #include "jit_primitive_conf.hpp"
 #include "jit_sse42_conv_kernel_f32.hpp"
+#include "jit_kernel_cache.hpp"
 #include "jit_uni_depthwise.hpp"
 
 namespace mkldnn {
@@ -109,21 +110,15 @@ struct jit_sse42_convolution_fwd_t: public cpu_primitive_t {
             const output_vector &outputs)
         : cpu_primitive_t(apd, inputs, outputs)
     {
-        kernel_ = new jit_sse42_conv_fwd_kernel_f32(pd()->jcp_, pd()->jcp_dw_, *pd()->attr());
+        kernel_ = get_jit_kernel<jit_sse42_conv_fwd_kernel_f32>(pd()->jcp_,
+                pd()->jcp_dw_, *pd()->attr());
 
         if (pd()->jcp_.with_dw_conv) {
-            kernel_dw_ = new jit_uni_dw_conv_row_f32<sse42>(pd()->jcp_dw_, *pd()->attr(), pd()->jcp_dw_.ch_block);
+            kernel_dw_ = get_jit_kernel<jit_uni_dw_conv_row_f32<sse42>>(
+                    pd()->jcp_dw_, *pd()->attr(), pd()->jcp_dw_.ch_block);
         }
     }
 
-    ~jit_sse42_convolution_fwd_t() {
-        delete kernel_;
-
-        if (pd()->jcp_.with_dw_conv) {
-            delete kernel_dw_;
-        }
-    };
-
     typedef typename prec_traits<data_type::f32>::type data_t;
 
     virtual void execute(event_t *e) const {
@@ -140,8 +135,8 @@ private:
     void execute_forward_with_dw_conv() const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd(); }
 
-    jit_sse42_conv_fwd_kernel_f32 *kernel_;
-    jit_uni_dw_conv_row_f32<sse42> *kernel_dw_;
+    std::shared_ptr<jit_sse42_conv_fwd_kernel_f32> kernel_;
+    std::shared_ptr<jit_uni_dw_conv_row_f32<sse42>> kernel_dw_;
 };
 
 }
@@ -174,30 +174,35 @@ void jit_uni_bin_conv_fwd_kernel<isa>::apply_filter(int ur_w, int pad_l, int pad
                         if (jcp.ic_padded != jcp.ic && last_icb && ifm2 == (ic_blocks - 1))
                             uni_vandps(vmm_tmp, vmm_tmp, ptr[reg_table + 224]);
 
-                        if (isa == sse42) {
-                            movups(vmm_tmp1, vmm_tmp);
-                            pand(vmm_tmp1, vmm_mask);
+                        if (jcp.with_vpopcnt) {
+                            // the EVEX encoded popcount of the dwords replaces the nibble lookups and the sums
+                            vpopcntd(vmm_tmp, vmm_tmp);
                         } else {
-                            uni_vandps(vmm_tmp1, vmm_mask, vmm_tmp);
-                        }
+                            if (isa == sse42) {
+                                movups(vmm_tmp1, vmm_tmp);
+                                pand(vmm_tmp1, vmm_mask);
+                            } else {
+                                uni_vandps(vmm_tmp1, vmm_mask, vmm_tmp);
+                            }
 
-                        uni_vpsrld(vmm_tmp, vmm_tmp, 4);
-                        uni_vandps(vmm_tmp, vmm_tmp, vmm_mask);
+                            uni_vpsrld(vmm_tmp, vmm_tmp, 4);
+                            uni_vandps(vmm_tmp, vmm_tmp, vmm_mask);
+
+                            if (isa == sse42) {
+                                movups(vmm_tmp2, vmm_lookup);
+                                pshufb(vmm_tmp2, vmm_tmp);
+                                movups(vmm_tmp, vmm_lookup);
+                                pshufb(vmm_tmp, vmm_tmp1);
+                                paddb(vmm_tmp, vmm_tmp2);
+                            } else {
+                                uni_vpshufb(vmm_tmp, vmm_lookup, vmm_tmp);
+                                uni_vpshufb(vmm_tmp1, vmm_lookup, vmm_tmp1);
+                                uni_vpaddb(vmm_tmp, vmm_tmp, vmm_tmp1);
+                            }
 
-                        if (isa == sse42) {
-                            movups(vmm_tmp2, vmm_lookup);
-                            pshufb(vmm_tmp2, vmm_tmp);
-                            movups(vmm_tmp, vmm_lookup);
-                            pshufb(vmm_tmp, vmm_tmp1);
-                            paddb(vmm_tmp, vmm_tmp2);
-                        } else {
-                            uni_vpshufb(vmm_tmp, vmm_lookup, vmm_tmp);
-                            uni_vpshufb(vmm_tmp1, vmm_lookup, vmm_tmp1);
-                            uni_vpaddb(vmm_tmp, vmm_tmp, vmm_tmp1);
+                            uni_vpmaddubsw(vmm_tmp, vmm_tmp, vmm_one_u8);
+                            uni_vpmaddwd(vmm_tmp, vmm_tmp, vmm_one_s16);
                         }
-
-                        uni_vpmaddubsw(vmm_tmp, vmm_tmp, vmm_one_u8);
-                        uni_vpmaddwd(vmm_tmp, vmm_tmp, vmm_one_s16);
                         uni_vpaddd(Vmm(1 + r*jcp.ur_w*jcp.nb_oc_blocking + ur_w * ii + jj),
                                    Vmm(1 + r*jcp.ur_w*jcp.nb_oc_blocking + ur_w * ii + jj), vmm_tmp);
                     }
@@ -861,6 +866,9 @@ status_t jit_uni_bin_conv_fwd_kernel<isa>::init_conf(jit_bin_conv_conf_t &jcp,
 
     jcp.nb_oc_blocking = isa == sse42 ? 2 : 4; /* the optimal value for the kernel */
 
+    /* AVX512VL lets the ymm kernel use the EVEX encoded VPOPCNTD of AVX512_VPOPCNTDQ */
+    jcp.with_vpopcnt = isa == avx2 && mayiuse(avx512_core) && cpu.has(Xbyak::util::Cpu::tAVX512_VPOPCNTDQ);
+
     args_ok = true
         && jcp.l_pad <= jcp.ur_w
         && IMPLICATION(jcp.kw > 7, (jcp.t_pad == 0 && jcp.l_pad == 0)
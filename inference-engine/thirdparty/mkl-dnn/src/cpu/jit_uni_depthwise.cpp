@@ -39,6 +39,7 @@ struct jit_args {
     const float *weights;
     const float *bias;
     size_t work_amount;
+    size_t oc_off;
 };
 
 struct jit_uni_depthwise_kernel_f32 : public c_compatible {
@@ -204,13 +205,28 @@ struct jit_uni_scale_shift_kernel_f32 : public jit_uni_depthwise_kernel_f32,
     public jit_generator
 {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_scale_shift_kernel_f32)
-    jit_uni_scale_shift_kernel_f32(const depthwise_desc_t &desc, bool with_bias)
+    jit_uni_scale_shift_kernel_f32(const depthwise_desc_t &desc, bool with_bias,
+            const primitive_attr_t &attr)
         : jit_uni_depthwise_kernel_f32(desc, with_bias), jit_generator() {
         assert(desc.alg_kind == alg_kind::depthwise_scale_shift);
         assert(isa == sse42 || isa == avx2 || isa == avx512_common);
 
         bool isFlat = desc.src_desc.format == nchw && desc.dst_desc.format == nchw;
 
+        const auto &p = attr.post_ops_;
+        int depthwise_post_ops = 0;
+        for (int i = 0; i < p.len_; i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors.push_back(new jit_uni_eltwise_injector_f32<isa>(
+                        this, post_op.eltwise));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors.push_back(new jit_uni_depthwise_injector_f32<isa>(
+                        this, post_op.depthwise.alg));
+                depthwise_post_ops++;
+            }
+        }
+
         Reg64 param = abi_param1;
 
         const int block_size = isa == avx512_common ? 16 : 8;
@@ -222,9 +238,36 @@ struct jit_uni_scale_shift_kernel_f32 : public jit_uni_depthwise_kernel_f32,
         mov(reg_to, ptr[param + GET_OFF(to)]);
         mov(reg_scale, ptr[param + GET_OFF(weights)]);
         mov(reg_work_amount, ptr[param + GET_OFF(work_amount)]);
+        mov(reg_oc_off, ptr[param + GET_OFF(oc_off)]);
         if (with_bias_)
             mov(reg_shift, ptr[param + GET_OFF(bias)]);
 
+        // all the pixels of a flat plane belong to the same channel, so the
+        // depthwise post-ops take the broadcast channel values from the stack
+        if (isFlat && depthwise_post_ops > 0) {
+            sub(rsp, depthwise_post_ops * 2 * vlen);
+
+            int depthwise_inj_idx = 0;
+            for (int i = 0; i < p.len_; i++) {
+                auto &post_op = p.entry_[i];
+                if (!post_op.is_depthwise())
+                    continue;
+
+                const size_t off = depthwise_inj_idx * 2 * vlen;
+                mov(reg_d_weights, reinterpret_cast<size_t>(post_op.depthwise.weights_data));
+                add(reg_d_weights, reg_oc_off);
+                uni_vbroadcastss(vmm_aux, ptr[reg_d_weights]);
+                uni_vmovups(ptr[rsp + off], vmm_aux);
+
+                mov(reg_d_bias, reinterpret_cast<size_t>(post_op.depthwise.biases_data));
+                add(reg_d_bias, reg_oc_off);
+                uni_vbroadcastss(vmm_aux, ptr[reg_d_bias]);
+                uni_vmovups(ptr[rsp + off + vlen], vmm_aux);
+
+                depthwise_inj_idx++;
+            }
+        }
+
         Label main_loop_label;
         Label tail_loop_label;
         Label exit_label;
@@ -263,6 +306,7 @@ struct jit_uni_scale_shift_kernel_f32 : public jit_uni_depthwise_kernel_f32,
                 uni_vmovups(vmm_src, ptr[reg_from + i*4*sizeof(float)]);
                 uni_vmovups(vmm_dst, get_shift_reg(i));
                 uni_vfmadd231ps(vmm_dst, vmm_src, get_scale_reg(i));
+                apply_post_ops(p, isFlat, i);
                 uni_vmovups(ptr[reg_to + i*4*sizeof(float)], vmm_dst);
             }
 
@@ -280,6 +324,7 @@ struct jit_uni_scale_shift_kernel_f32 : public jit_uni_depthwise_kernel_f32,
             movss(xmm_src, ptr[reg_from]);
             uni_vmovups(xmm_dst, xmm_shift);
             uni_vfmadd231ps(xmm_dst, xmm_src, xmm_scale);
+            apply_post_ops(p, isFlat, 0);
             movss(ptr[reg_to], xmm_dst);
 
             add(reg_from, 1*sizeof(float));
@@ -291,26 +336,83 @@ struct jit_uni_scale_shift_kernel_f32 : public jit_uni_depthwise_kernel_f32,
 
         L(exit_label);
 
+        if (isFlat && depthwise_post_ops > 0)
+            add(rsp, depthwise_post_ops * 2 * vlen);
+
         this->postamble();
 
+        for (auto inj : eltwise_injectors)
+            inj->prepare_table();
+
         ker_ = (decltype(ker_))this->getCode();
     }
 
+    ~jit_uni_scale_shift_kernel_f32() {
+        for (auto inj : eltwise_injectors)
+            delete inj;
+        eltwise_injectors.clear();
+
+        for (auto inj : depthwise_injectors)
+            delete inj;
+        depthwise_injectors.clear();
+    }
+
 private:
     using Vmm = typename utils::conditional3<isa == sse42, Xmm,
                                              isa == avx2, Ymm, Zmm>::type;
 
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+
     inline Vmm get_scale_reg(int idx) { return Vmm(idx + 2); }
     inline Vmm get_shift_reg(int idx) { return Vmm(idx + 4); }
 
+    // applies the post-ops to vmm_dst; the single element of the tail loop is
+    // computed in the whole register as well
+    void apply_post_ops(const post_ops_t &p, bool isFlat, int repeat) {
+        int eltwise_inj_idx = 0;
+        int depthwise_inj_idx = 0;
+        for (int i = 0; i < p.len_; i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors[eltwise_inj_idx]->compute_vector_range(
+                        vmm_dst.getIdx(), vmm_dst.getIdx() + 1);
+                eltwise_inj_idx++;
+            } else if (post_op.is_depthwise()) {
+                if (isFlat) {
+                    const size_t off = depthwise_inj_idx * 2 * vlen;
+                    lea(reg_d_weights, ptr[rsp + off]);
+                    lea(reg_d_bias, ptr[rsp + off + vlen]);
+                } else {
+                    // sse42 processes the block of 8 channels in two halves
+                    mov(reg_d_weights, reinterpret_cast<size_t>(post_op.depthwise.weights_data + repeat * 4));
+                    add(reg_d_weights, reg_oc_off);
+                    mov(reg_d_bias, reinterpret_cast<size_t>(post_op.depthwise.biases_data + repeat * 4));
+                    add(reg_d_bias, reg_oc_off);
+                }
+
+                depthwise_injectors[depthwise_inj_idx]->compute_vector_range(
+                        vmm_dst.getIdx(), vmm_dst.getIdx() + 1, reg_d_weights, reg_d_bias);
+                depthwise_inj_idx++;
+            }
+        }
+    }
+
     Reg64 reg_from = r8;
     Reg64 reg_to = r9;
     Reg64 reg_work_amount = r10;
     Reg64 reg_scale = r11;
     Reg64 reg_shift = r12;
 
+    Reg64 reg_oc_off = r13;
+    Reg64 reg_d_weights = r14;
+    Reg64 reg_d_bias = r15;
+
     Vmm vmm_src = Vmm(0);
     Vmm vmm_dst = Vmm(1);
+    Vmm vmm_aux = Vmm(8);
+
+    nstl::vector<jit_uni_eltwise_injector_f32<isa>*> eltwise_injectors;
+    nstl::vector<jit_uni_depthwise_injector_f32<isa>*> depthwise_injectors;
 
     Xmm xmm_src = Xmm(0);
     Xmm xmm_dst = Xmm(1);
@@ -466,11 +568,36 @@ status_t jit_uni_depthwise_fwd_t<isa>::pd_t::init() {
         && utils::one_of(desc()->dst_desc.format, desired_blk_fmt, nchw)
         && utils::one_of(desc()->weights_desc.format, x)
         && IMPLICATION(this->with_bias(), x == desc()->bias_desc.format)
-        && attr()->has_default_values();
+        && post_ops_ok();
 
     return ok ? status::success : status::unimplemented;
 }
 
+template <cpu_isa_t isa>
+bool jit_uni_depthwise_fwd_t<isa>::pd_t::post_ops_ok() const {
+    using namespace alg_kind;
+
+    const auto &p = attr()->post_ops_;
+    if (p.len_ > 0 && desc()->alg_kind != depthwise_scale_shift)
+        return false;
+
+    for (int i = 0; i < p.len_; i++) {
+        const auto &e = p.entry_[i];
+        bool ok = false
+            || (e.is_eltwise() && utils::one_of(e.eltwise.alg, eltwise_relu,
+                    eltwise_tanh, eltwise_elu, eltwise_square, eltwise_abs,
+                    eltwise_sqrt, eltwise_linear, eltwise_bounded_relu,
+                    eltwise_soft_relu, eltwise_logistic, eltwise_clamp,
+                    eltwise_exp))
+            || e.is_depthwise();
+        if (!ok) return false;
+    }
+
+    return true
+        && attr()->round_mode_ == round_mode::nearest
+        && attr()->output_scales_.has_default_values();
+}
+
 template <cpu_isa_t isa>
 jit_uni_depthwise_fwd_t<isa>::jit_uni_depthwise_fwd_t(const pd_t *apd,
         const input_vector &inputs, const output_vector &outputs)
@@ -479,7 +606,7 @@ jit_uni_depthwise_fwd_t<isa>::jit_uni_depthwise_fwd_t(const pd_t *apd,
     const auto &desc = *pd()->desc();
     switch (desc.alg_kind) {
         case alg_kind::depthwise_scale_shift:
-            kernel_ = new jit_uni_scale_shift_kernel_f32<isa>(desc, pd()->with_bias()); break;
+            kernel_ = new jit_uni_scale_shift_kernel_f32<isa>(desc, pd()->with_bias(), *pd()->attr()); break;
         case alg_kind::depthwise_prelu:
             kernel_ = new jit_uni_prelu_kernel_f32<isa>(desc, pd()->with_bias()); break;
         default: assert(!"unknown depthwise alg_kind");
@@ -552,6 +679,7 @@ void jit_uni_depthwise_fwd_t<isa>::execute_forward() const {
         if (bias)
             arg.bias = &bias[bias_d.blk_off(cb * ch_block_size)];
         arg.work_amount = (size_t)W;
+        arg.oc_off = cb * ch_block_size * sizeof(float);
 
         (*kernel_)(&arg);
     });
@@ -91,6 +91,9 @@ struct jit_uni_depthwise_fwd_t : public cpu_primitive_t {
                 jit_uni_depthwise_fwd_t<isa>);
 
         virtual status_t init() override;
+
+    protected:
+        bool post_ops_ok() const;
     };
 
     jit_uni_depthwise_fwd_t(const pd_t *apd, const input_vector &inputs,
@@ -25,6 +25,7 @@
 #include "cpu_reducer.hpp"
 
 #include "jit_uni_dw_conv_kernel_f32.hpp"
+#include "jit_kernel_cache.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -100,10 +101,11 @@ struct _jit_uni_dw_convolution_fwd_t: public cpu_primitive_t {
 
     _jit_uni_dw_convolution_fwd_t(const pd_t *apd, const input_vector &inputs,
             const output_vector &outputs)
-        : cpu_primitive_t(apd, inputs, outputs), kernel_(nullptr)
-    { kernel_ = new jit_uni_dw_conv_fwd_kernel_f32<isa>(pd()->jcp_, *pd()->attr()); }
-
-    ~_jit_uni_dw_convolution_fwd_t() { delete kernel_; }
+        : cpu_primitive_t(apd, inputs, outputs)
+    {
+        kernel_ = get_jit_kernel<jit_uni_dw_conv_fwd_kernel_f32<isa>>(
+                pd()->jcp_, *pd()->attr());
+    }
 
     typedef typename prec_traits<data_type::f32>::type data_t;
 
@@ -116,7 +118,7 @@ private:
     void execute_forward() const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd(); }
 
-    jit_uni_dw_conv_fwd_kernel_f32<isa> *kernel_;
+    std::shared_ptr<jit_uni_dw_conv_fwd_kernel_f32<isa>> kernel_;
 };
 
 using jit_avx512_common_dw_convolution_fwd_t =
@@ -932,16 +932,24 @@ struct jit_uni_kernel_fwd_f32: public jit_uni_eltwise_kernel_f32,
     public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_kernel_fwd_f32)
 
-    jit_uni_kernel_fwd_f32(const eltwise_desc_t &desc)
+    jit_uni_kernel_fwd_f32(const eltwise_desc_t &desc,
+            const primitive_attr_t &attr)
         : jit_uni_eltwise_kernel_f32(desc), jit_generator() {
 
         eltwise_injector_ = new jit_uni_eltwise_injector_f32<isa>(this,
                 desc.alg_kind, desc.alpha, desc.beta, false, r9, Opmask(1));
 
+        // the post-ops use their own tables, so they save the state
+        const auto &p = attr.post_ops_;
+        for (int i = 0; i < p.len_; i++) {
+            post_ops_injectors_.push_back(new jit_uni_eltwise_injector_f32<isa>(
+                    this, p.entry_[i].eltwise, true, r9, Opmask(1)));
+        }
+
         using namespace alg_kind;
 
         assert(is_bwd() == false);
-        assert(utils::one_of(desc.alg_kind, eltwise_tanh, eltwise_elu,
+        assert(utils::one_of(desc.alg_kind, eltwise_relu, eltwise_tanh, eltwise_elu,
                     eltwise_square, eltwise_abs, eltwise_sqrt, eltwise_linear,
                     eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic,
                     eltwise_clamp, eltwise_exp));
@@ -964,6 +972,7 @@ struct jit_uni_kernel_fwd_f32: public jit_uni_eltwise_kernel_f32,
 
         uni_vmovups(vmm_src, ptr[reg_from]);
         eltwise_injector_->compute_vector(vmm_src.getIdx());
+        apply_post_ops(vmm_src.getIdx());
         uni_vmovups(ptr[reg_to], vmm_src);
 
         add(reg_from, vlen);
@@ -982,6 +991,7 @@ struct jit_uni_kernel_fwd_f32: public jit_uni_eltwise_kernel_f32,
 
         movss(xmm_src, ptr[reg_from]);
         eltwise_injector_->compute_vector(xmm_src.getIdx());
+        apply_post_ops(xmm_src.getIdx());
         movss(ptr[reg_to], xmm_src);
 
         add(reg_from, sizeof(float));
@@ -995,13 +1005,24 @@ struct jit_uni_kernel_fwd_f32: public jit_uni_eltwise_kernel_f32,
         postamble();
 
         eltwise_injector_->prepare_table();
+        for (auto inj : post_ops_injectors_)
+            inj->prepare_table();
 
         ker_ = (decltype(ker_))this->getCode();
     }
 
-    ~jit_uni_kernel_fwd_f32() { delete eltwise_injector_; }
+    ~jit_uni_kernel_fwd_f32() {
+        delete eltwise_injector_;
+        for (auto inj : post_ops_injectors_)
+            delete inj;
+    }
 
 private:
+    void apply_post_ops(size_t idx) {
+        for (auto inj : post_ops_injectors_)
+            inj->compute_vector(idx);
+    }
+
     using Vmm = typename utils::conditional3<isa == sse42, Xmm,
                 isa == avx2, Ymm, Zmm>::type;
 
@@ -1017,6 +1038,7 @@ private:
     Vmm vmm_src = Vmm(1);
 
     jit_uni_eltwise_injector_f32<isa> *eltwise_injector_;
+    nstl::vector<jit_uni_eltwise_injector_f32<isa> *> post_ops_injectors_;
 };
 
 } /* namespace */
@@ -1038,22 +1060,46 @@ status_t jit_uni_eltwise_fwd_t<isa>::pd_t::init() {
         && memory_desc_wrapper(src_pd()).is_dense(true)
         && IMPLICATION(!memory_desc_wrapper(src_pd()).is_dense(false),
                 math::eltwise_fwd_preserves_zero(desc()->alg_kind, true))
-        && attr()->has_default_values();
+        && post_ops_ok();
 
     return ok ? status::success : status::unimplemented;
 }
 
+template <cpu_isa_t isa>
+bool jit_uni_eltwise_fwd_t<isa>::pd_t::post_ops_ok() const {
+    using namespace alg_kind;
+
+    const auto &p = attr()->post_ops_;
+    const bool is_padded = !memory_desc_wrapper(src_pd()).is_dense(false);
+    for (int i = 0; i < p.len_; i++) {
+        const auto &e = p.entry_[i];
+        // the padded area must stay zero after the whole chain
+        bool ok = true
+            && e.is_eltwise()
+            && utils::one_of(e.eltwise.alg, eltwise_relu, eltwise_tanh,
+                    eltwise_elu, eltwise_square, eltwise_abs, eltwise_sqrt,
+                    eltwise_linear, eltwise_bounded_relu, eltwise_soft_relu,
+                    eltwise_logistic, eltwise_clamp, eltwise_exp)
+            && IMPLICATION(is_padded,
+                    math::eltwise_fwd_preserves_zero(e.eltwise.alg, true));
+        if (!ok) return false;
+    }
+
+    return true
+        && attr()->round_mode_ == round_mode::nearest
+        && attr()->output_scales_.has_default_values();
+}
+
 template <cpu_isa_t isa>
 jit_uni_eltwise_fwd_t<isa>::jit_uni_eltwise_fwd_t(const pd_t *apd,
         const input_vector &inputs, const output_vector &outputs)
     : cpu_primitive_t(apd, inputs, outputs), kernel_(nullptr) {
     const auto &desc = *pd()->desc();
-    switch (desc.alg_kind) {
-    case alg_kind::eltwise_relu:
-        kernel_ = new jit_uni_relu_kernel_f32<isa>(desc); break;
-    default:
-        kernel_ = new jit_uni_kernel_fwd_f32<isa>(desc);
-    }
+    const bool with_post_ops = !pd()->attr()->post_ops_.has_default_values();
+    if (desc.alg_kind == alg_kind::eltwise_relu && !with_post_ops)
+        kernel_ = new jit_uni_relu_kernel_f32<isa>(desc);
+    else
+        kernel_ = new jit_uni_kernel_fwd_f32<isa>(desc, *pd()->attr());
 }
 
 template <cpu_isa_t isa>
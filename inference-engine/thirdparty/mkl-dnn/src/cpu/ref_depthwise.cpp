@@ -71,6 +71,7 @@ void ref_depthwise_fwd_t<data_type>::execute_forward() const {
     const int H = pd()->H();
     const int W = pd()->W();
     const auto alg_kind = pd()->desc()->alg_kind;
+    const auto &p = pd()->attr()->post_ops_;
 
     parallel_nd(MB, C, D, H, W,
         [&](int n, int c, int d, int h, int w) {
@@ -90,6 +91,19 @@ void ref_depthwise_fwd_t<data_type>::execute_forward() const {
             case depthwise_prelu: d_val = prelu_fwd(s_val, w_val); break;
             default: assert(!"unknown depthwise alg_kind");
         }
+
+        int eltwise_inj_idx = 0;
+        int depthwise_inj_idx = 0;
+        for (int i = 0; i < p.len_; i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                d_val = eltwise_injectors[eltwise_inj_idx++]->compute_scalar(d_val);
+            } else if (post_op.is_depthwise()) {
+                d_val = depthwise_injectors[depthwise_inj_idx++]->compute_scalar(d_val,
+                        post_op.depthwise.weights_data + c,
+                        post_op.depthwise.biases_data + c);
+            }
+        }
     });
 }
 
@@ -24,6 +24,7 @@
 #include "cpu_engine.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
+#include "ref_eltwise.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -56,16 +57,55 @@ struct ref_depthwise_fwd_t: public cpu_primitive_t {
                 && utils::one_of(desc()->prop_kind, forward_training,
                         forward_inference)
                 && utils::everyone_is(data_type, desc()->src_desc.data_type, desc()->dst_desc.data_type)
-                && attr()->has_default_values();
+                && post_ops_ok();
             if (!ok) return status::unimplemented;
 
             return status::success;
         }
+
+    protected:
+        bool post_ops_ok() const {
+            const auto &p = attr()->post_ops_;
+            for (int i = 0; i < p.len_; i++)
+                if (!p.entry_[i].is_eltwise() && !p.entry_[i].is_depthwise())
+                    return false;
+
+            return true
+                && attr()->round_mode_ == round_mode::nearest
+                && attr()->output_scales_.has_default_values();
+        }
     };
 
     ref_depthwise_fwd_t(const pd_t *apd, const input_vector &inputs,
             const output_vector &outputs)
-        : cpu_primitive_t(apd, inputs, outputs) {}
+        : cpu_primitive_t(apd, inputs, outputs) {
+        const auto &post_ops = pd()->attr()->post_ops_;
+        for (int i = 0; i < post_ops.len_; i++) {
+            auto &post_op = post_ops.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors.push_back(new ref_eltwise_scalar_fwd_t(
+                        post_op.eltwise.alg,
+                        post_op.eltwise.alpha,
+                        post_op.eltwise.beta
+                ));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors.push_back(new ref_depthwise_scalar_fwd_t(
+                        post_op.depthwise.alg
+                ));
+            }
+        }
+    }
+
+    ~ref_depthwise_fwd_t() {
+        for (auto inj : eltwise_injectors)
+            delete inj;
+        eltwise_injectors.clear();
+
+        for (auto inj : depthwise_injectors)
+            delete inj;
+        depthwise_injectors.clear();
+    }
+
     typedef typename prec_traits<data_type>::type data_t;
 
     virtual void execute(event_t *e) const {
@@ -76,6 +116,9 @@ struct ref_depthwise_fwd_t: public cpu_primitive_t {
 private:
     void execute_forward() const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd(); }
+
+    nstl::vector<ref_eltwise_scalar_fwd_t*> eltwise_injectors;
+    nstl::vector<ref_depthwise_scalar_fwd_t*> depthwise_injectors;
 };
 
 }
@@ -129,6 +129,7 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_generic() const {
     const float alpha = pd()->desc()->alpha;
     const float beta = pd()->desc()->beta;
     const bool is_3d = pd()->desc()->data_desc.ndims == 5;
+    const auto &p = pd()->attr()->post_ops_;
 
     parallel_nd(MB, C, D, H, W,
         [&](int n, int c, int id, int h, int w) {
@@ -153,6 +154,9 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_generic() const {
             case eltwise_not: d = not_fwd(s); break;
             default: assert(!"unknown eltwise alg_kind");
         }
+
+        for (int i = 0; i < p.len_; i++)
+            d = eltwise_injectors[i]->compute_scalar(d);
     });
 }
 
@@ -61,11 +61,14 @@ struct ref_eltwise_fwd_t: public cpu_primitive_t {
 
             auto src_d = memory_desc_wrapper(src_pd());
 
-            use_dense_ = false
+            // the post-ops are only applied in the generic loop
+            const bool with_post_ops = !attr()->post_ops_.has_default_values();
+
+            use_dense_ = !with_post_ops && (false
                 || src_d.is_dense()
-                || (src_d.is_dense(true) && is_zero_preserved());
+                || (src_d.is_dense(true) && is_zero_preserved()));
 
-            use_nCspBc_padded_ = !use_dense_
+            use_nCspBc_padded_ = !use_dense_ && !with_post_ops
                 && one_of(desc()->data_desc.format, nChw8c, nChw16c,
                     nCdhw8c, nCdhw16c)
                 && src_d.only_padded_dim(1)
@@ -81,18 +84,48 @@ struct ref_eltwise_fwd_t: public cpu_primitive_t {
                         forward_inference)
                 && everyone_is(data_type, desc()->data_desc.data_type)
                 && IMPLICATION(use_generic, one_of(src_d.ndims(), 4, 5))
-                && attr()->has_default_values();
+                && post_ops_ok();
             if (!ok) return status::unimplemented;
 
             return status::success;
         }
 
         bool use_dense_, use_nCspBc_padded_;
+
+    protected:
+        bool post_ops_ok() const {
+            const auto &p = attr()->post_ops_;
+            for (int i = 0; i < p.len_; i++)
+                if (!p.entry_[i].is_eltwise())
+                    return false;
+
+            return true
+                && attr()->round_mode_ == round_mode::nearest
+                && attr()->output_scales_.has_default_values()
+                && IMPLICATION(p.len_ > 0, data_type == mkldnn::impl::data_type::f32);
+        }
     };
 
     ref_eltwise_fwd_t(const pd_t *apd, const input_vector &inputs,
             const output_vector &outputs)
-        : cpu_primitive_t(apd, inputs, outputs) {}
+        : cpu_primitive_t(apd, inputs, outputs) {
+        const auto &post_ops = pd()->attr()->post_ops_;
+        for (int i = 0; i < post_ops.len_; i++) {
+            auto &post_op = post_ops.entry_[i];
+            eltwise_injectors.push_back(new ref_eltwise_scalar_fwd_t(
+                    post_op.eltwise.alg,
+                    post_op.eltwise.alpha,
+                    post_op.eltwise.beta
+            ));
+        }
+    }
+
+    ~ref_eltwise_fwd_t() {
+        for (auto inj : eltwise_injectors)
+            delete inj;
+        eltwise_injectors.clear();
+    }
+
     typedef typename prec_traits<data_type>::type data_t;
 
     virtual void execute(event_t *e) const {
@@ -110,6 +143,8 @@ private:
     void execute_forward_dense() const;
     void execute_forward_generic() const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd(); }
+
+    nstl::vector<ref_eltwise_scalar_fwd_t*> eltwise_injectors;
 };
 
 template <impl::data_type_t data_type>
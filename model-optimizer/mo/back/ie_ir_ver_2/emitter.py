@@ -24,7 +24,11 @@ from mo.utils.utils import refer_to_faq_msg
 from mo.utils.version import get_version
 
 
-def serialize_constants(graph: Graph, bin_file_name:str, data_type=np.float32):
+# blobs are hashed and written by parts of this size to not create a copy of the whole blob
+BLOB_CHUNK_SIZE = 64 * 1024 * 1024
+
+
+def serialize_constants(graph: Graph, bin_file_name:str, data_type=np.float32, release_blobs: bool = False):
     """
     Found all data constants that has output edges with 'bin' attribute.
     Serialize content for such constants to a binary file with name bin_file_name in
@@ -35,35 +39,60 @@ def serialize_constants(graph: Graph, bin_file_name:str, data_type=np.float32):
         @graph: input graph with op and data nodes
         @bin_file_name: path to file to write blobs to
         @data_type: numpy data type to convert all blob elemnts to
+        @release_blobs: drop values of the constants consumed as blobs only once they are written to the file
 
     """
     bin_hashes = {}
-    with open(bin_file_name, 'wb') as bin_file:
-        serialize_constants_recursively(graph, bin_file, data_type, bin_hashes)
+    with open(bin_file_name, 'w+b') as bin_file:
+        serialize_constants_recursively(graph, bin_file, data_type, bin_hashes, release_blobs)
+
+
+def blob_chunks(blob: np.ndarray):
+    """ Splits the raw content of the blob to memory views of at most BLOB_CHUNK_SIZE bytes """
+    data = np.ascontiguousarray(blob).reshape(-1).view(np.uint8)
+    for start in range(0, data.size, BLOB_CHUNK_SIZE):
+        yield memoryview(data[start:start + BLOB_CHUNK_SIZE])
+
 
+def blob_hash(blob: np.ndarray):
+    hasher = hashlib.sha512()
+    for chunk in blob_chunks(blob):
+        hasher.update(chunk)
+    return blob.dtype.str, tuple(blob.shape), hasher.hexdigest()
 
-def serialize_constants_recursively(graph: Graph, bin_file, data_type, bin_hashes):
+
+def is_blob_written(bin_file, blob: np.ndarray, offset: int):
+    """ Compares the blob with the content of the bin file written at the offset """
+    end = bin_file.tell()
+    bin_file.seek(offset)
+    equal = all(bin_file.read(len(chunk)) == chunk for chunk in blob_chunks(blob))
+    bin_file.seek(end)
+    return equal
+
+
+def serialize_constants_recursively(graph: Graph, bin_file, data_type, bin_hashes, release_blobs: bool = False):
     nodes = sorted(graph.nodes())
     for node in nodes:
         node = Node(graph, node)
 
-        if node.kind == 'data' and node.value is not None and any('bin' in d for u, v, d in graph.out_edges(node.node, data=True)):
+        out_edges = graph.out_edges(node.node, data=True)
+        if node.kind == 'data' and node.value is not None and any('bin' in d for u, v, d in out_edges):
             blob = node.value
-            blob_hash = hashlib.sha512(blob.tobytes()).hexdigest()
+            key = blob_hash(blob)
 
-            if blob_hash in bin_hashes and np.array_equal(blob, bin_hashes[blob_hash]['blob']):
-                graph.node[node.node]['offset'] = bin_hashes[blob_hash]['offset']
-                graph.node[node.node]['size'] = bin_hashes[blob_hash]['size']
+            if key in bin_hashes and is_blob_written(bin_file, blob, bin_hashes[key]['offset']):
+                graph.node[node.node]['offset'] = bin_hashes[key]['offset']
+                graph.node[node.node]['size'] = bin_hashes[key]['size']
             else:
                 start = bin_file.tell()
-                blob.tofile(bin_file)
+                for chunk in blob_chunks(blob):
+                    bin_file.write(chunk)
                 end = bin_file.tell()
 
                 graph.node[node.node]['offset'] = start
                 graph.node[node.node]['size'] = end - start
 
-                bin_hashes[blob_hash] = {'offset': graph.node[node.node]['offset'],
-                                         'size': graph.node[node.node]['size'], 'blob': blob}
+                bin_hashes[key] = {'offset': graph.node[node.node]['offset'], 'size': graph.node[node.node]['size']}
 
                 assert (blob.dtype.itemsize * np.prod(node.shape) == end - start)
 
@@ -71,6 +100,10 @@ def serialize_constants_recursively(graph: Graph, bin_file, data_type, bin_hashe
                 "Detected binary for graph: '{}', node: '{}', id: {}, shape: '{}', offset: '{}', size: '{}'".format(
                     graph, node.soft_get('name'), node.id, node.shape, node.offset, node.size))
 
+            # the IR refers to the blob by the offset and the size, the value is not needed to emit the XML
+            if release_blobs and all('bin' in d for u, v, d in out_edges):
+                graph.node[node.node]['value'] = None
+
     # separate loop for sub-graph to dump them after all blobs for more natural blob offset ordering
     # TODO: implement strict order for all blobs in entier IR
     for node in nodes:
@@ -79,7 +112,7 @@ def serialize_constants_recursively(graph: Graph, bin_file, data_type, bin_hashe
         if node.has_valid('sub_graphs'):
             for sub_graph_attr_name in node.sub_graphs:
                 sub_graph = node[sub_graph_attr_name]
-                serialize_constants_recursively(sub_graph, bin_file, data_type, bin_hashes)
+                serialize_constants_recursively(sub_graph, bin_file, data_type, bin_hashes, release_blobs)
 
 
 def serialize_mean_image(bin_file_name: str, mean_data=[]):
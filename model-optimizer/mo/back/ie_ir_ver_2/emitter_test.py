@@ -14,14 +14,17 @@
  limitations under the License.
 """
 
+import os
+import tempfile
 import unittest
 from unittest.mock import MagicMock
 from xml.etree.ElementTree import Element, tostring
 
 import numpy as np
 
-from mo.back.ie_ir_ver_2.emitter import soft_get, xml_shape
+from mo.back.ie_ir_ver_2.emitter import serialize_constants, soft_get, xml_shape
 from mo.utils.error import Error
+from mo.utils.unittest.graph import build_graph
 
 expected_result = b'<net><dim>2</dim><dim>10</dim><dim>50</dim><dim>50</dim></net>'
 
@@ -72,3 +75,46 @@ class TestSoftGet(unittest.TestCase):
     def test_not_node_2(self):
         node = 'something-else'
         self.assertEqual(soft_get(node, 'string'), '<SUB-ELEMENT>')
+
+
+class TestSerializeConstants(unittest.TestCase):
+    def setUp(self):
+        weights = np.arange(12, dtype=np.float32).reshape([3, 4])
+        self.nodes = {
+            'weights_1': {'kind': 'data', 'value': weights, 'shape': np.array(weights.shape)},
+            'weights_2': {'kind': 'data', 'value': weights.copy(), 'shape': np.array(weights.shape)},
+            'biases': {'kind': 'data', 'value': np.ones([3], dtype=np.float32), 'shape': np.array([3])},
+            'fc_1': {'kind': 'op', 'op': 'FullyConnected'},
+            'fc_2': {'kind': 'op', 'op': 'FullyConnected'},
+            'add': {'kind': 'op', 'op': 'Add'},
+        }
+        bin_file = tempfile.NamedTemporaryFile(suffix='.bin', delete=False)
+        bin_file.close()
+        self.bin_file_name = bin_file.name
+
+    def tearDown(self):
+        os.remove(self.bin_file_name)
+
+    def test_identical_blobs_are_written_once(self):
+        graph = build_graph(self.nodes, [('weights_1', 'fc_1', {'bin': 'weights'}),
+                                         ('weights_2', 'fc_2', {'bin': 'weights'}),
+                                         ('biases', 'fc_2', {'bin': 'biases'})])
+        serialize_constants(graph, self.bin_file_name)
+
+        # the blobs are written in the order of the node names
+        self.assertEqual(graph.node['biases']['offset'], 0)
+        self.assertEqual(graph.node['weights_1']['offset'], 12)
+        self.assertEqual(graph.node['weights_2']['offset'], 12)
+        self.assertEqual(os.path.getsize(self.bin_file_name), 12 + 48)
+        self.assertTrue(np.array_equal(np.fromfile(self.bin_file_name, dtype=np.float32)[3:],
+                                       np.arange(12, dtype=np.float32)))
+
+    def test_release_blobs_keeps_values_of_not_binary_consumers(self):
+        graph = build_graph(self.nodes, [('weights_1', 'fc_1', {'bin': 'weights'}),
+                                         ('biases', 'fc_1', {'bin': 'biases'}),
+                                         ('biases', 'add', {'in': 1})])
+        serialize_constants(graph, self.bin_file_name, release_blobs=True)
+
+        self.assertIsNone(graph.node['weights_1']['value'])
+        self.assertIsNotNone(graph.node['biases']['value'])
+        self.assertEqual(graph.node['weights_1']['size'], 48)
@@ -295,5 +295,11 @@ def read_blob(file_desc: io.BufferedReader, size: int, dtype=np.float32):
         np.float32: 4,
         np.int32: 4
     }
+    if isinstance(file_desc, io.BytesIO):
+        # the values are copied from the buffer of the component without a temporary bytes object
+        offset = file_desc.tell()
+        blob = np.frombuffer(file_desc.getbuffer(), dtype=dtype, count=size, offset=offset).copy()
+        file_desc.seek(offset + size * dsizes[dtype])
+        return blob
     data = file_desc.read(size * dsizes[dtype])
     return np.fromstring(data, dtype=dtype)
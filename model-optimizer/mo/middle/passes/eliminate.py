@@ -72,6 +72,11 @@ def mark_output_reachable_nodes(graph: Graph):
                     lambda graph, node_name: mark_input_nodes(graph, node_name, 'is_output_reachable', True), visited)
 
 
+def has_constant_inputs(graph: Graph, node_name: str):
+    in_nodes = [graph.node[u] for u, _ in graph.in_edges(node_name)]
+    return len(in_nodes) != 0 and all(attrs.get('value') is not None for attrs in in_nodes)
+
+
 def mark_undead_nodes(graph: Graph, undead_types: list):
     """
     Mark output nodes and nodes of the specific type as undead, meaning that they should survive the dead nodes
@@ -89,6 +94,9 @@ def mark_undead_nodes(graph: Graph, undead_types: list):
     # mark specifically defined with node type set of nodes
     for type in undead_types:
         node_of_specific_type = graph.get_nodes_with_attributes(type=type)
+        if type == 'Shape':
+            # the shape of a constant does not change when the network is reshaped so it is folded as any constant
+            node_of_specific_type = [n for n in node_of_specific_type if not has_constant_inputs(graph, n)]
         nx.set_node_attributes(G=graph, name='is_undead', values={n: True for n in node_of_specific_type})
 
     undead_nodes = graph.get_nodes_with_attributes(is_undead=True)
@@ -19,7 +19,8 @@ import unittest
 import numpy as np
 
 from mo.graph.graph import Node, Graph
-from mo.middle.passes.eliminate import mark_output_reachable_nodes, graph_clean_up, mark_const_producer_nodes
+from mo.middle.passes.eliminate import mark_output_reachable_nodes, graph_clean_up, mark_const_producer_nodes, \
+    mark_undead_nodes
 from mo.utils.unittest.graph import build_graph
 
 nodes_attributes = {'placeholder_1': {'type': 'Placeholder', 'kind': 'op'},
@@ -39,6 +40,8 @@ nodes_attributes = {'placeholder_1': {'type': 'Placeholder', 'kind': 'op'},
                     'data_node_4': {'value': None, 'kind': 'data'},
                     'data_node_5': {'value': None, 'shape': None, 'kind': 'data'},
                     'data_node_6': {'value': None, 'shape': None, 'kind': 'data'},
+                    'shape_1': {'type': 'Shape', 'kind': 'op'},
+                    'shape_2': {'type': 'Shape', 'kind': 'op'},
                     'tf_call_1': {'type': 'TFCustomSubgraphCall', 'kind': 'op'},
                     'tf_call_2': {'type': 'TFCustomSubgraphCall', 'kind': 'op'},
                     'tf_call_3': {'type': 'TFCustomSubgraphCall', 'kind': 'op'},
@@ -160,6 +163,37 @@ class TestEliminatePass(unittest.TestCase):
         """
         pass
 
+    def test_undead_shape_nodes_with_constant_inputs(self):
+        """
+        Checks that Shape of a constant is not marked as undead so it is folded as any other constant while Shape of a
+        non-constant tensor is kept.
+        "shape_1" gets non-constant "placeholder_1_data_node", "shape_2" gets constant "data_node_3".
+
+        placeholder_1->placeholder_1_data_node->shape_1->data_node_1->node_1->data_node_2
+                                                                      /
+                                          data_node_3->shape_2->data_node_4
+
+        :return: None
+        """
+        graph = build_graph(nodes_attributes,
+                            [('placeholder_1', 'placeholder_1_data_node'),
+                             ('placeholder_1_data_node', 'shape_1'),
+                             ('shape_1', 'data_node_1'),
+                             ('data_node_1', 'node_1'),
+                             ('data_node_3', 'shape_2'),
+                             ('shape_2', 'data_node_4'),
+                             ('data_node_4', 'node_1'),
+                             ('node_1', 'data_node_2'),
+                             ('data_node_2', 'op_output')
+                             ],
+                            {'data_node_1': {'value': np.array([1, 3])},
+                             'data_node_3': {'value': np.ones([2, 2])},
+                             'data_node_4': {'value': np.array([2, 2])}},
+                            nodes_with_edges_only=True)
+        mark_undead_nodes(graph, ['Shape'])
+        self.assertTrue(graph.node['shape_1']['is_undead'])
+        self.assertFalse(graph.node['shape_2']['is_undead'])
+
     def test_remove_node_from_graph(self):
         """
         Checks case when remove node from graph.
@@ -19,6 +19,7 @@ from collections import deque
 
 import numpy as np
 
+from mo.front.common.layout import get_features_dim
 from mo.front.common.partial_infer.utils import int64_array
 from mo.front.extractor import add_attrs_props
 from mo.graph.graph import Node, Graph
@@ -29,7 +30,7 @@ from mo.ops.op import Op
 from mo.middle.passes.fusing.helpers import backward_bfs, forward_bfs, get_tensor_id, get_value_id
 
 
-def _fuse_mul(graph: Graph, node: Node, fuse_nodes: list, backward: bool = True):
+def _fuse_mul(graph: Graph, node: Node, fuse_nodes: list, backward: bool = True, values: list = None):
     """
     This function takes Mul node and array of convolution/fc nodes for further fusion
     Parameters
@@ -37,6 +38,7 @@ def _fuse_mul(graph: Graph, node: Node, fuse_nodes: list, backward: bool = True)
     x : bool
         If backward is False, that means that Convolution/FC goes after Mul node
         else means that Mul goes after Convolutions/FC
+        :param values: the parts of the Mul constant for each of fuse_nodes, the whole constant is used by default
         :param backward:
         :param fuse_nodes:
         :param node:
@@ -77,9 +79,9 @@ def _fuse_mul(graph: Graph, node: Node, fuse_nodes: list, backward: bool = True)
             log.warning('Node {} has wrong weights shape'.format(fuse_node.id))
             return False
 
-    for fuse_node in fuse_nodes:
+    for idx, fuse_node in enumerate(fuse_nodes):
         weights_node = fuse_node.in_node(1)
-        value = np.array(node.in_node(const_id).value)
+        value = np.array(node.in_node(const_id).value if values is None else values[idx])
 
         value = np.squeeze(value)
 
@@ -142,10 +144,11 @@ def _fuse_mul(graph: Graph, node: Node, fuse_nodes: list, backward: bool = True)
     return is_fused
 
 
-def _fuse_add(graph: Graph, node: Node, fuse_nodes: list, backward: bool = True):
+def _fuse_add(graph: Graph, node: Node, fuse_nodes: list, backward: bool = True, values: list = None):
     """
     This function takes Add node and Convolution/FC nodes for further fusion and then deletes Add node
     In case if Convolution/FC Bias absence it will be created
+    The values are the parts of the Add constant for each of fuse_nodes, the whole constant is used by default
     """
     is_fused = False
     const_id, tensor_id = get_value_id(node), get_tensor_id(node)
@@ -169,8 +172,8 @@ def _fuse_add(graph: Graph, node: Node, fuse_nodes: list, backward: bool = True)
             log.warning('Node {} has no weights node'.format(fuse_node.id))
             return False
 
-    for fuse_node in fuse_nodes:
-        value = np.array(node.in_node(const_id).value)
+    for idx, fuse_node in enumerate(fuse_nodes):
+        value = np.array(node.in_node(const_id).value if values is None else values[idx])
 
         # If forward, broadcast value
         if not backward:
@@ -234,6 +237,90 @@ def _fuse_add(graph: Graph, node: Node, fuse_nodes: list, backward: bool = True)
     return is_fused
 
 
+def _backward_fuse_nodes(data: Node, value: np.ndarray, op: str, layout: str):
+    """
+    Searches the Convolution/Deconvolution/FC nodes producing the data through the operations the linear operation
+    commutes with: Concat splits the per channel constant between its inputs, Pooling keeps the channels, Permute and
+    Reshape move the channels so only a scalar goes through them. Each tensor on the way should have one consumer.
+    Returns the list of (node, part of the constant) pairs or None if the operation can not be moved to all the
+    producers.
+    """
+    if len(data.in_nodes()) != 1 or len(data.out_nodes()) != 1:
+        return None
+    producer = data.in_node(0)
+    producer_type = producer.soft_get('type')
+
+    if producer_type in ['Convolution', 'Deconvolution', 'FullyConnected']:
+        return [(producer, value)]
+
+    is_scalar = value.size == 1
+    if producer_type == 'Pooling' and op == 'Mul' and \
+            (producer.soft_get('pool_method') == 'avg' or producer.soft_get('pool_method') == 'max' and np.all(value >= 0)):
+        # avg is linear, max commutes only with non-negative scale
+        return _backward_fuse_nodes(producer.in_node(0), value, op, layout)
+
+    if producer_type in ['Permute', 'Reshape'] and is_scalar:
+        return _backward_fuse_nodes(producer.in_node(0), value, op, layout)
+
+    if producer_type == 'Concat' and producer.has_valid('axis') and data.shape is not None:
+        in_data = [producer.in_node(port) for port in sorted(producer.in_nodes().keys())]
+        if is_scalar:
+            parts = [value] * len(in_data)
+        else:
+            if len(data.shape) not in [2, 4, 5]:
+                return None
+            features_dim = get_features_dim(layout, len(data.shape)) if len(data.shape) != 2 else 1
+            if producer.axis % len(data.shape) != features_dim or value.size != data.shape[features_dim]:
+                return None
+            if any(in_node.shape is None for in_node in in_data):
+                return None
+            parts = np.split(value, np.cumsum([in_node.shape[features_dim] for in_node in in_data])[:-1])
+
+        result = []
+        for in_node, part in zip(in_data, parts):
+            nodes = _backward_fuse_nodes(in_node, part, op, layout)
+            if nodes is None:
+                return None
+            result.extend(nodes)
+        return result
+
+    return None
+
+
+def _fuse_through_commuting_ops(graph: Graph, node: Node):
+    """
+    Fuses Mul/Add with the constant to the Convolution/Deconvolution/FC nodes found by _backward_fuse_nodes
+    """
+    const_id, tensor_id = get_value_id(node), get_tensor_id(node)
+    if const_id is None or tensor_id is None or graph.graph.get('layout') is None:
+        return False
+
+    value = np.squeeze(np.array(node.in_node(const_id).value))
+    fuse_nodes = _backward_fuse_nodes(node.in_node(tensor_id), value, node.op, graph.graph['layout'])
+    # the direct producers are handled by backward_bfs
+    if not fuse_nodes or len(fuse_nodes) == 1 and fuse_nodes[0][0].id == node.in_node(tensor_id).in_node(0).id:
+        return False
+
+    nodes, values = [fuse_node for fuse_node, _ in fuse_nodes], [part for _, part in fuse_nodes]
+    if len(set(fuse_node.id for fuse_node in nodes)) != len(nodes):
+        return False
+    if node.op == 'Mul':
+        return _fuse_mul(graph, node, nodes, values=values)
+    return _fuse_add(graph, node, nodes, values=values)
+
+
+def report_unfused_linear_ops(graph: Graph):
+    """
+    Logs the Mul/Add operations with a constant input the fusing have not folded to the neighbouring layers, they are
+    executed as ScaleShift/Power/Eltwise layers
+    """
+    unfused = [node.soft_get('name') for node in graph.get_op_nodes()
+               if node.soft_get('op') in ['Mul', 'Add'] and get_value_id(node) is not None]
+    if len(unfused) != 0:
+        log.info('{} linear operation(s) were not fused to Convolution/Deconvolution/FullyConnected: {}'.format(
+            len(unfused), ', '.join(sorted(map(str, unfused)))))
+
+
 def fuse_linear_ops(graph: Graph):
     """
     This function makes fusing of linear operations (Mul,Add) to Convolution/FC.
@@ -256,6 +343,10 @@ def fuse_linear_ops(graph: Graph):
             fuse_nodes = backward_bfs(node, [], ['Convolution', 'Deconvolution', 'FullyConnected'])
             is_fused = _fuse_add(graph, node, fuse_nodes)
 
+        # Fuse Mul/Add to Convolution/FC through Concat, Pooling and Permute
+        if not is_fused and node.soft_get('op') in ['Mul', 'Add'] and node.soft_get('can_be_fused') == True:
+            is_fused = _fuse_through_commuting_ops(graph, node)
+
         fuse_count += is_fused
 
     # Fusion in forward direction
@@ -277,3 +368,4 @@ def fuse_linear_ops(graph: Graph):
         fuse_count += is_fused
 
     log.debug("Fused {} nodes".format(fuse_count))
+    report_unfused_linear_ops(graph)
@@ -1504,3 +1504,100 @@ class FuseLinOpsTests(unittest.TestCase):
 
         (flag, resp) = compare_graphs(graph, graph_ref, 'concat_1_data')
         self.assertTrue(flag, resp)
+
+    # Conv(w+b)-+->Concat->Mul(array)     Conv1-+->Concat
+    #           |                    =>         |
+    # Conv(w+b)-+                         Conv2-+
+    def test_fuse_mul_through_concat(self):
+        mul_value = np.concatenate((np.full(96, 2.0), np.full(96, 3.0)))
+        graph = build_graph(nodes_attributes,
+                            [('placeholder_1', 'placeholder_1_data'),
+                             ('placeholder_1_data', 'conv_1'),
+                             ('const_conv_1_w', 'conv_1_w'),
+                             ('const_conv_1_b', 'conv_1_b'),
+                             ('conv_1_w', 'conv_1'),
+                             ('conv_1_b', 'conv_1'),
+                             ('conv_1', 'conv_1_data'),
+                             ('placeholder_1_data', 'conv_2'),
+                             ('const_conv_2_w', 'conv_2_w'),
+                             ('const_conv_2_b', 'conv_2_b'),
+                             ('conv_2_w', 'conv_2'),
+                             ('conv_2_b', 'conv_2'),
+                             ('conv_2', 'conv_2_data'),
+                             ('conv_1_data', 'concat_1'),
+                             ('conv_2_data', 'concat_1'),
+                             ('concat_1', 'concat_1_data'),
+                             ('concat_1_data', 'mul_1'),
+                             ('const_mul_1_w', 'mul_1_w'),
+                             ('mul_1_w', 'mul_1'),
+                             ('mul_1', 'mul_1_data'),
+                             ('mul_1_data', 'op_output')
+                             ],
+                            {'placeholder_1_data': {'shape': np.array([1, 227, 227, 3])},
+                             'const_conv_1_w': {'shape': np.array([11, 11, 3, 96]), 'value': np.ones((11, 11, 3, 96))},
+                             'conv_1_w': {'shape': np.array([11, 11, 3, 96]), 'value': np.ones((11, 11, 3, 96)),
+                                          'output_channel_dim': 3, 'input_channel_dim': 2,
+                                          'dims_number': 4},
+                             'const_conv_1_b': {'shape': np.array([96]), 'value': np.ones(96)},
+                             'conv_1_b': {'shape': np.array([96]), 'value': np.ones(96)},
+                             'conv_1_data': {'shape': np.array([1, 55, 55, 96])},
+                             'const_conv_2_w': {'shape': np.array([11, 11, 3, 96]), 'value': np.ones((11, 11, 3, 96))},
+                             'conv_2_w': {'shape': np.array([11, 11, 3, 96]), 'value': np.ones((11, 11, 3, 96)),
+                                          'output_channel_dim': 3, 'input_channel_dim': 2,
+                                          'dims_number': 4},
+                             'const_conv_2_b': {'shape': np.array([96]), 'value': np.ones(96)},
+                             'conv_2_b': {'shape': np.array([96]), 'value': np.ones(96)},
+                             'conv_2_data': {'shape': np.array([1, 55, 55, 96])},
+                             'concat_1': {'axis': 3},
+                             'concat_1_data': {'shape': np.array([1, 55, 55, 192])},
+                             'const_mul_1_w': {'shape': np.array([192]), 'value': mul_value},
+                             'mul_1_w': {'shape': np.array([192]), 'value': mul_value},
+                             'mul_1_data': {'shape': np.array([1, 55, 55, 192])},
+                             })
+        graph.graph['layout'] = 'NHWC'
+
+        graph_ref = build_graph(nodes_attributes,
+                                [('placeholder_1', 'placeholder_1_data'),
+                                 ('placeholder_1_data', 'conv_1'),
+                                 ('const_conv_1_w', 'conv_1_w'),
+                                 ('const_conv_1_b', 'conv_1_b'),
+                                 ('conv_1_w', 'conv_1'),
+                                 ('conv_1_b', 'conv_1'),
+                                 ('conv_1', 'conv_1_data'),
+                                 ('placeholder_1_data', 'conv_2'),
+                                 ('const_conv_2_w', 'conv_2_w'),
+                                 ('const_conv_2_b', 'conv_2_b'),
+                                 ('conv_2_w', 'conv_2'),
+                                 ('conv_2_b', 'conv_2'),
+                                 ('conv_2', 'conv_2_data'),
+                                 ('conv_1_data', 'concat_1'),
+                                 ('conv_2_data', 'concat_1'),
+                                 ('concat_1', 'concat_1_data'),
+                                 ('concat_1_data', 'op_output')
+                                 ],
+                                {'placeholder_1_data': {'shape': np.array([1, 227, 227, 3])},
+                                 'const_conv_1_w': {'shape': np.array([11, 11, 3, 96]),
+                                                    'value': np.full((11, 11, 3, 96), 2.0)},
+                                 'conv_1_w': {'shape': np.array([11, 11, 3, 96]), 'value': np.full((11, 11, 3, 96), 2.0),
+                                              'output_channel_dim': 3, 'input_channel_dim': 2,
+                                              'dims_number': 4},
+                                 'const_conv_1_b': {'shape': np.array([96]), 'value': np.full(96, 2.0)},
+                                 'conv_1_b': {'shape': np.array([96]), 'value': np.full(96, 2.0)},
+                                 'conv_1_data': {'shape': np.array([1, 55, 55, 96])},
+                                 'const_conv_2_w': {'shape': np.array([11, 11, 3, 96]),
+                                                    'value': np.full((11, 11, 3, 96), 3.0)},
+                                 'conv_2_w': {'shape': np.array([11, 11, 3, 96]), 'value': np.full((11, 11, 3, 96), 3.0),
+                                              'output_channel_dim': 3, 'input_channel_dim': 2,
+                                              'dims_number': 4},
+                                 'const_conv_2_b': {'shape': np.array([96]), 'value': np.full(96, 3.0)},
+                                 'conv_2_b': {'shape': np.array([96]), 'value': np.full(96, 3.0)},
+                                 'conv_2_data': {'shape': np.array([1, 55, 55, 96])},
+                                 'concat_1': {'axis': 3},
+                                 'concat_1_data': {'shape': np.array([1, 55, 55, 192])},
+                                 })
+
+        fuse_linear_ops(graph)
+        graph_clean_up(graph)
+
+        (flag, resp) = compare_graphs(graph, graph_ref, 'concat_1_data')
+        self.assertTrue(flag, resp)
@@ -124,7 +124,7 @@ def prepare_emit_ir(graph: Graph, data_type: str, output_dir: str, output_model_
     tensor_names.propagate_op_name_to_tensor(graph)
 
     bin_file = os.path.join(output_dir, '{}.bin'.format(output_model_name))
-    serialize_constants(graph, bin_file)
+    serialize_constants(graph, bin_file, release_blobs=True)
 
     mean_offset = None
     mean_size = None
@@ -152,6 +152,8 @@ def driver(argv: argparse.Namespace, model_file_name: str, output_model_name: st
     permute_op_nodes_attrs(graph)
 
     class_registration.apply_replacements(graph, class_registration.ClassType.BACK_REPLACER)
+    # fold the constant sub-graphs created by the back replacers, the IR keeps only Const layers for them
+    for_graph_and_each_sub_graph_recursively(graph, graph_clean_up_onnx)
 
     for_graph_and_each_sub_graph_recursively(graph, remove_const_ops)
 
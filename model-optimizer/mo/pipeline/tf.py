@@ -218,6 +218,8 @@ def tf2nx(argv: argparse.Namespace, model_file_name: str, output_model_name: str
     for_graph_and_each_sub_graph_recursively(graph, graph_clean_up_tf)
 
     class_registration.apply_replacements(graph, class_registration.ClassType.BACK_REPLACER)
+    # fold the constant sub-graphs created by the back replacers, the IR keeps only Const layers for them
+    for_graph_and_each_sub_graph_recursively(graph, graph_clean_up_tf)
 
     for_graph_and_each_sub_graph_recursively(graph, remove_const_ops)
     CreateConstNodesReplacement().find_and_replace_pattern(graph)
@@ -56,6 +56,8 @@ class BaseReader(ClassProvider):
         self.config = config
         self.data_source_is_dir = True
         self.data_source_optional = False
+        # the readers keeping the position in the source can not read the batches in parallel
+        self.multithreaded = True
         self.read_dispatcher = singledispatch(self.read)
         self.read_dispatcher.register(list, self._read_list)
 
@@ -103,6 +105,7 @@ class ReaderCombiner(BaseReader):
             reading_scheme[pattern] = reader
 
         self.reading_scheme = reading_scheme
+        self.multithreaded = all(reader.multithreaded for reader in reading_scheme.values())
 
     def read(self, data_id, data_dir):
         for pattern, reader in self.reading_scheme.items():
@@ -140,6 +143,7 @@ class OpenCVFrameReader(BaseReader):
         self.data_source_is_dir = False
         self.source = None
         self.current = -1
+        self.multithreaded = False
 
     def read(self, data_id, data_dir):
         # source video changed, capture initialization
@@ -52,6 +52,7 @@ class DatasetConfig(ConfigValidator):
     annotation_conversion = DictField(optional=True)
     subsample_size = BaseField(optional=True)
     subsample_seed = NumberField(floats=False, min_value=0, optional=True)
+    workers = NumberField(floats=False, min_value=1, optional=True)
 
 
 class Dataset:
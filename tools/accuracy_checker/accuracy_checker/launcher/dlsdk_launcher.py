@@ -15,6 +15,7 @@ limitations under the License.
 """
 
 import subprocess
+from collections import deque
 from pathlib import Path
 import os
 import platform
@@ -22,7 +23,7 @@ import numpy as np
 from cpuinfo import get_cpu_info
 import openvino.inference_engine as ie
 
-from ..config import ConfigError, NumberField, PathField, StringField, DictField, ListField, BoolField
+from ..config import ConfigError, BaseField, NumberField, PathField, StringField, DictField, ListField, BoolField
 from ..logging import warning
 from ..utils import read_yaml, contains_all, extract_image_representations, get_path
 from .launcher import Launcher, LauncherConfig
@@ -88,6 +89,8 @@ class DLSDKLauncherConfig(LauncherConfig):
     allow_reshape_input = BoolField(optional=True)
     affinity_map = PathField(optional=True)
     batch = NumberField(floats=False, min_value=1, optional=True)
+    num_requests = NumberField(floats=False, min_value=1, optional=True)
+    streams = BaseField(optional=True)
 
     _models_prefix = PathField(is_directory=True, optional=True)
     _model_optimizer = PathField(optional=True, allow_none=True, is_directory=True)
@@ -206,8 +209,13 @@ class DLSDKLauncher(Launcher):
             self._set_affinity(affinity_map_path)
         elif affinity_map_path:
             warning('affinity_map config is applicable only for HETERO device')
-        self.exec_network = self.plugin.load(network=self.network)
         self.allow_reshape_input = self._config.get('allow_reshape_input', False)
+        self._num_requests = self._config.get('num_requests', 1)
+        if self._num_requests > 1 and self.allow_reshape_input:
+            warning('allow_reshape_input reloads the network between the infer requests, num_requests is set to 1')
+            self._num_requests = 1
+        self._set_streams(self._config.get('streams'))
+        self.exec_network = self.plugin.load(network=self.network, num_requests=self._num_requests)
 
     @property
     def inputs(self):
@@ -223,6 +231,10 @@ class DLSDKLauncher(Launcher):
     def batch(self):
         return self._batch
 
+    @property
+    def num_requests(self):
+        return self._num_requests
+
     def predict(self, identifiers, data_representation, *args, **kwargs):
         """
         Args:
@@ -232,8 +244,81 @@ class DLSDKLauncher(Launcher):
             output of model converted to appropriate representation.
         """
         _, metadata = extract_image_representations(data_representation)
-        non_constant_inputs = self.input_feeder.fill_non_constant_inputs(data_representation)
+        return self._infer(self._fill_network_inputs(data_representation, **kwargs), identifiers, metadata, **kwargs)
+
+    def predict_async(self, batches, *args, **kwargs):
+        """
+        Args:
+            batches: iterable of (batch_id, batch_annotation, data_representation) tuples.
+        Returns:
+            generator of (batch_id, batch_annotation, output of model converted to appropriate representation) tuples
+            in the order of the batches. The batches are started on the idle infer requests, the outputs of the oldest
+            batch are converted while the next ones are inferred.
+        """
+        requests = self.exec_network.requests
+        idle_requests = deque(range(len(requests)))
+        started_batches = deque()
+
+        def finish_oldest_batch():
+            batch_id, batch_annotation, metadata, batch_requests = started_batches.popleft()
+            results = []
+            for request_id, network_inputs_data in batch_requests:
+                request = requests[request_id]
+                status = request.wait()
+                if status != 0:
+                    raise RuntimeError('infer request of batch {} failed with status {}'.format(batch_id, status))
+                # the request is reused by the next batches, its output blobs are overwritten
+                result = request.get_outputs(copy=True)
+
+                raw_outputs_callback = kwargs.get('output_callback')
+                if raw_outputs_callback:
+                    # the input blobs of the first request hold the data of another batch
+                    raw_outputs_callback(result, inputs=network_inputs_data)
+
+                results.append(result)
+                idle_requests.append(request_id)
+
+            identifiers = [annotation.identifier for annotation in batch_annotation]
+            return batch_id, batch_annotation, self._convert_results(results, identifiers, metadata)
+
+        for batch_id, batch_annotation, batch_input in batches:
+            _, metadata = extract_image_representations(batch_input)
+            batch_inputs = list(self._fill_network_inputs(batch_input, **kwargs))
+            if len(batch_inputs) > len(requests):
+                # the infers of the batch do not fit the requests, it is inferred after the started batches
+                while started_batches:
+                    yield finish_oldest_batch()
+                identifiers = [annotation.identifier for annotation in batch_annotation]
+                yield batch_id, batch_annotation, self._infer(batch_inputs, identifiers, metadata, **kwargs)
+                continue
+
+            batch_requests = []
+            for network_inputs_data in batch_inputs:
+                while not idle_requests:
+                    yield finish_oldest_batch()
+                request_id = idle_requests.popleft()
+                requests[request_id].async_infer(network_inputs_data)
+                batch_requests.append((request_id, network_inputs_data))
+            started_batches.append((batch_id, batch_annotation, metadata, batch_requests))
+
+        while started_batches:
+            yield finish_oldest_batch()
+
+    def _infer(self, network_inputs, identifiers, metadata, **kwargs):
         results = []
+        for network_inputs_data in network_inputs:
+            result = self.exec_network.infer(network_inputs_data)
+
+            raw_outputs_callback = kwargs.get('output_callback')
+            if raw_outputs_callback:
+                raw_outputs_callback(result)
+
+            results.append(result)
+
+        return self._convert_results(results, identifiers, metadata)
+
+    def _fill_network_inputs(self, data_representation, **kwargs):
+        non_constant_inputs = self.input_feeder.fill_non_constant_inputs(data_representation)
         for infer_inputs in non_constant_inputs:
             input_shapes = {}
             do_reshape = False
@@ -260,14 +345,9 @@ class DLSDKLauncher(Launcher):
             if benchmark:
                 benchmark(network_inputs_data)
 
-            result = self.exec_network.infer(network_inputs_data)
-
-            raw_outputs_callback = kwargs.get('output_callback')
-            if raw_outputs_callback:
-                raw_outputs_callback(result)
-
-            results.append(result)
+            yield network_inputs_data
 
+    def _convert_results(self, results, identifiers, metadata):
         if self.adapter:
             self.adapter.output_blob = self.adapter.output_blob or next(iter(self.original_outputs))
             results = self.adapter(results, identifiers, [self._provide_inputs_info_to_meta(meta) for meta in metadata])
@@ -377,7 +457,8 @@ class DLSDKLauncher(Launcher):
         self.network.reshape(shapes)
         del self.exec_network
         self._create_ie_plugin(log=False)
-        self.exec_network = self.plugin.load(network=self.network)
+        self._set_streams(self._config.get('streams'))
+        self.exec_network = self.plugin.load(network=self.network, num_requests=self._num_requests)
 
     def _set_batch_size(self, batch_size):
         # in some cases we can not use explicit property for setting batch size, so we need to use reshape instead
@@ -406,6 +487,19 @@ class DLSDKLauncher(Launcher):
 
         return data.reshape(input_shape)
 
+    def _set_streams(self, streams):
+        if not streams:
+            return
+        streams = str(streams).upper()
+        if streams != 'AUTO' and not (streams.isdigit() and int(streams) > 0):
+            raise ConfigError('streams should be a positive integer or AUTO, {} provided'.format(streams))
+        if self._device == 'CPU':
+            self.plugin.set_config({'CPU_THROUGHPUT_STREAMS': 'CPU_THROUGHPUT_AUTO' if streams == 'AUTO' else streams})
+        elif self._device == 'GPU' and streams != 'AUTO':
+            self.plugin.set_config({'CLDNN_THROUGHPUT_STREAMS': streams})
+        else:
+            warning('streams config is applicable only for CPU and GPU devices, AUTO only for CPU')
+
     def _create_ie_plugin(self, log=True):
         if hasattr(self, 'plugin'):
             del self.plugin
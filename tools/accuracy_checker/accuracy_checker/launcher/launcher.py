@@ -51,6 +51,27 @@ class Launcher(ClassProvider):
     def batch(self):
         raise NotImplementedError
 
+    @property
+    def num_requests(self):
+        """
+        Returns:
+            number of the batches the launcher infers at once, predict_async is used when it is greater than 1.
+        """
+
+        return 1
+
+    def predict_async(self, batches, *args, **kwargs):
+        """
+        Args:
+            batches: iterable of (batch_id, batch_annotation, data_representation) tuples.
+        Returns:
+            generator of (batch_id, batch_annotation, raw data from network) tuples in the order of the batches.
+        """
+
+        for batch_id, batch_annotation, batch_input in batches:
+            batch_identifiers = [annotation.identifier for annotation in batch_annotation]
+            yield batch_id, batch_annotation, self.predict(batch_identifiers, batch_input, *args, **kwargs)
+
     @property
     def inputs(self):
         raise NotImplementedError
@@ -16,10 +16,12 @@ limitations under the License.
 
 import copy
 import pickle
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor
 
 from .utils import get_path
 from .dataset import Dataset
-from .launcher import create_launcher, DummyLauncher
+from .launcher import create_launcher, DummyLauncher, Launcher
 from .launcher.loaders import PickleLoader
 from .logging import print_info
 from .metrics import MetricsExecutor
@@ -28,12 +30,13 @@ from .preprocessor import PreprocessingExecutor
 
 
 class ModelEvaluator:
-    def __init__(self, launcher, preprocessor, postprocessor, dataset, metric):
+    def __init__(self, launcher, preprocessor, postprocessor, dataset, metric, workers=1):
         self.launcher = launcher
         self.preprocessor = preprocessor
         self.postprocessor = postprocessor
         self.dataset = dataset
         self.metric_executor = metric
+        self.workers = workers
 
         self._annotations = []
         self._predictions = []
@@ -47,8 +50,10 @@ class ModelEvaluator:
         launcher = create_launcher(launcher_config, dataset.metadata)
         postprocessor = PostprocessingExecutor(dataset_config.get('postprocessing'), dataset_name, dataset.metadata)
         metric_dispatcher = MetricsExecutor(dataset_config, dataset)
+        # by default the data for all the infer requests of the launcher is prepared at once
+        workers = dataset_config.get('workers', launcher.num_requests) if dataset.read_image_fn.multithreaded else 1
 
-        return cls(launcher, preprocessor, postprocessor, dataset, metric_dispatcher)
+        return cls(launcher, preprocessor, postprocessor, dataset, metric_dispatcher, workers)
 
     def process_dataset(self, stored_predictions, progress_reporter, *args, **kwargs):
         if self._is_stored(stored_predictions) or isinstance(self.launcher, DummyLauncher):
@@ -60,10 +65,7 @@ class ModelEvaluator:
 
         self.dataset.batch = self.launcher.batch
         predictions_to_store = []
-        for batch_id, (batch_annotation, batch_input) in enumerate(self.dataset):
-            batch_identifiers = [annotation.identifier for annotation in batch_annotation]
-            batch_predictions = self.launcher.predict(batch_identifiers, batch_input, *args, **kwargs)
-
+        for batch_id, batch_annotation, batch_predictions in self._predict(self._read_batches(), *args, **kwargs):
             if stored_predictions:
                 predictions_to_store.extend(copy.deepcopy(batch_predictions))
 
@@ -88,6 +90,30 @@ class ModelEvaluator:
 
         return self.postprocessor.process_dataset(self._annotations, self._predictions)
 
+    def _read_batches(self):
+        if self.workers <= 1:
+            for batch_id, (batch_annotation, batch_input) in enumerate(self.dataset):
+                yield batch_id, batch_annotation, batch_input
+            return
+
+        # the images are read and preprocessed by the pool ahead of the inference, in the order of the batches
+        batches_count = len(self.dataset)
+        with ThreadPoolExecutor(max_workers=self.workers) as executor:
+            read_batches = deque()
+            for batch_id in range(batches_count):
+                next_batch_id = batch_id + len(read_batches)
+                while next_batch_id < batches_count and len(read_batches) < 2 * self.workers:
+                    read_batches.append(executor.submit(self.dataset.__getitem__, next_batch_id))
+                    next_batch_id += 1
+                batch_annotation, batch_input = read_batches.popleft().result()
+                yield batch_id, batch_annotation, batch_input
+
+    def _predict(self, batches, *args, **kwargs):
+        if isinstance(self.launcher, Launcher) and self.launcher.num_requests > 1:
+            return self.launcher.predict_async(batches, *args, **kwargs)
+
+        return Launcher.predict_async(self.launcher, batches, *args, **kwargs)
+
     @staticmethod
     def _is_stored(stored_predictions=None):
         if not stored_predictions:
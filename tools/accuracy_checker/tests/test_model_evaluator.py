@@ -88,6 +88,19 @@ class TestModelEvaluator:
         assert self.postprocessor.process_dataset.called
         assert not self.postprocessor.full_process.called
 
+    def test_process_dataset_with_several_workers_keeps_order_of_batches(self):
+        self.postprocessor.has_dataset_processors = False
+        self.dataset.__len__.return_value = len(self.annotations)
+        self.dataset.__getitem__.side_effect = lambda batch_id: self.annotations[batch_id]
+        self.evaluator.workers = 2
+
+        self.evaluator.process_dataset(None, None)
+
+        assert self.dataset.__getitem__.call_count == len(self.annotations)
+        predicted_identifiers = [predict_call[0][0] for predict_call in self.launcher.predict.call_args_list]
+        assert predicted_identifiers == [[annotation[0].identifier] for annotation, _ in self.annotations]
+        assert self.metric.update_metrics_on_batch.call_count == len(self.annotations)
+
     def test_process_dataset_with_storing_predictions_and_without_dataset_processors(self):
         self.postprocessor.has_dataset_processors = False
 
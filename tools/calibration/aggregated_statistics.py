@@ -45,10 +45,12 @@ class AggregatedStatistics:
         self,
         network: ie.IENetwork,
         exec_network: ie.ExecutableNetwork,
-        inference_result
+        inference_result,
+        inputs: dict = None
     ):
         '''
-        Add inference result to aggregated statistics instance
+        Add inference result to aggregated statistics instance,
+        inputs are the data of the network inputs when the result is not the one of the first request
         '''
         layer_names = network.layers.keys()
 
@@ -65,7 +67,7 @@ class AggregatedStatistics:
                 continue
 
             if out_layer_name in network.inputs:
-                output_blob = exec_network.requests[0].inputs[out_layer_name]
+                output_blob = inputs[out_layer_name] if inputs else exec_network.requests[0].inputs[out_layer_name]
                 shape = Shape.create(network.inputs[out_layer_name].layout, output_blob.shape)
             else:
                 # TODO: can be refactored: we are itterating by all layers (to cover input layers output) to collect statistics
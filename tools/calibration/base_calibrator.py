@@ -81,13 +81,13 @@ class DatasetCallback:
         self._infer_raw_results = InferRawResults() if collect_resuls else None
         self._latencies = list()
 
-    def callback(self, value, latency = None):
+    def callback(self, value, latency = None, inputs = None):
         if self._collect_aggregated_statistics:
             if not self._aggregated_statistics:
                 self._aggregated_statistics = AggregatedStatistics(
                     iterations_count = self._iterations_count,
                     dataset_size = self._dataset_size)
-            self._aggregated_statistics.add(self._network, self._exec_network, value)
+            self._aggregated_statistics.add(self._network, self._exec_network, value, inputs)
 
         if self._collect_results:
             if self._collect_layers:
@@ -432,7 +432,8 @@ class BaseCalibrator:
                 del model_evaluator.launcher.network
                 del model_evaluator.launcher.exec_network
                 model_evaluator.launcher.network = network
-                model_evaluator.launcher.exec_network = model_evaluator.launcher.plugin.load(network)
+                model_evaluator.launcher.exec_network = model_evaluator.launcher.plugin.load(
+                    network, num_requests=model_evaluator.launcher.num_requests)
 
             if collect_performance_counters:
                 model_evaluator.launcher.plugin.set_config({'PERF_COUNT': 'YES'})
@@ -467,9 +468,6 @@ class BaseCalibrator:
             model_evaluator.process_dataset(None,
                                             progress_reporter=progress_reporter,
                                             output_callback=process_dataset_callback.callback)
-            if len(model_evaluator.launcher.exec_network.requests) != 1:
-                raise ValueError("unexpected network requests count")
-
             inference_result = process_dataset_callback.infer_raw_result
             inference_latencies = process_dataset_callback.latencies
 
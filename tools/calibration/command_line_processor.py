@@ -110,6 +110,11 @@ class CommandLineProcessor:
             with Network(str(launcher['model']), str(launcher['weights'])) as network:
                 batch_size = network.ie_network.batch_size
 
+        if args.num_requests:
+            launcher['num_requests'] = args.num_requests
+        if args.streams:
+            launcher['streams'] = args.streams
+
         if 'cpu_extensions' in launcher:
             cpu_extension = DLSDKLauncher.get_cpu_extension(launcher['cpu_extensions'], args.cpu_extensions_mode)
             launcher['cpu_extensions'] = cpu_extension
@@ -167,6 +167,20 @@ class CommandLineReader:
             type=int,
             required=False)
 
+        parser.add_argument(
+            '-nireq', '--num_requests', '--num-requests',
+            help='Optional. Number of infer requests the dataset is inferred with asynchronously. '
+                 'If not specified, the value is determined from launcher config (1 is default)',
+            type=int,
+            required=False)
+
+        parser.add_argument(
+            '-nstreams', '--streams',
+            help='Optional. Number of CPU or GPU throughput streams or AUTO for CPU. '
+                 'If not specified, the value is determined from launcher config',
+            type=str,
+            required=False)
+
         parser.add_argument(
             '-th', '--threshold',
             help='Optional. Accuracy drop of quantized model should not exceed this threshold. '